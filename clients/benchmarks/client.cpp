@@ -1,9 +1,13 @@
 /* ************************************************************************
- * Copyright 2020-2021 Advanced Micro Devices, Inc.
+ * Copyright 2020-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
 #include "../include/hipsolver_dispatcher.hpp"
 #include "../rocblascommon/program_options.hpp"
+#include "client_output.hpp"
+#include "client_plan.hpp"
+
+#include <algorithm>
 
 using rocblas_int    = int;
 using rocblas_stride = ptrdiff_t;
@@ -28,10 +32,194 @@ m) and a square-size matrix will be assumed.
 Example: ./hipsolver-bench -f getrf -m 30 --lda 75
 This will test getrf with a random 30x30 matrix.
 
+Several sizes can be benchmarked in a single run with the options --sizem, --sizen, --sizenrhs and
+--sizebatch. Each takes a comma-separated list of values and ranges, where a range start:end:step
+adds step to each value (or multiplies it by step, if written as xstep) until end is exceeded.
+All combinations of the given sizes are run in the same process, reusing the same handle, and the
+results are printed as a single table with one row per case.
+
+Example: ./hipsolver-bench -f getrf --sizem 64:8192:x2 --sizen 64,128
+This will test getrf with random 64x64, 64x128, 128x64, ..., 8192x128 matrices.
+
+A list of cases can also be given in a test plan with --plan. The plan is a JSON file (which is also
+valid YAML) holding a list of cases, each an object with the function to test and, optionally, the
+precision, the api (normal, fortran or compat) and the arguments of the function. Any field may take
+a list of values, and sizes may be written as ranges, as with --sizem; every combination of the
+values of a case is run. Failed cases are reported and the rest of the plan is run.
+
+Example: [{"function": ["getrf", "potrf"], "precision": ["s", "d"], "n": "64:1024:x2"},
+          {"function": "gesvd", "m": 300, "n": [100, 200], "jobu": "A", "jobv": "N"}]
+
+Besides the average, the time of each call in the GPU timing loop is kept, and the client reports
+its min, median, p95, p99 and standard deviation. Both the wall time of the calls and the device
+time measured with hipEvents are reported; their difference is the host overhead.
+
+With --output-format csv or --output-format json, the arguments and results of each case are also
+written to stdout, together with the achieved GFLOPS and GB/s. These rates are computed from the
+gpu time and the leading-order flop and memory traffic counts of the tested function.
+
 Options:
 )HELP_STR";
 // clang-format on
 
+// Prints the statistics of the last timing loop
+static void print_timing_stats()
+{
+    hipsolver_bench_timing& timing = hipsolver_bench_timing::get();
+    if(timing.wall.samples == 0)
+        return;
+
+    std::stringstream ss;
+    ss << "Timing statistics (us):\n" << std::left;
+    for(const char* col : {"", "samples", "mean", "min", "median", "p95", "p99", "stddev"})
+        ss << std::setw(15) << col << ' ';
+    for(auto& t : {std::make_pair("wall", timing.wall), std::make_pair("device", timing.device)})
+    {
+        ss << '\n' << std::setw(15) << t.first << ' ' << std::setw(15) << t.second.samples;
+        for(double v : {t.second.mean,
+                        t.second.min,
+                        t.second.median,
+                        t.second.p95,
+                        t.second.p99,
+                        t.second.stddev})
+            ss << ' ' << std::setw(15) << v;
+    }
+    std::cerr << ss.str() << '\n' << std::endl;
+}
+
+// Runs the requested function for every combination of the swept sizes and prints a row per case
+using size_sweeps = std::vector<std::pair<std::string, std::vector<rocblas_int>>>;
+
+static void run_size_sweep(const std::string&        function,
+                           char                      precision,
+                           Arguments&                argus,
+                           const size_sweeps&        sweeps,
+                           bench_writer&             writer,
+                           const roc::variables_map& vm)
+{
+    // share a single handle among all the cases
+    hipsolver_local_handle handle;
+    hipsolver_local_handle::shared_handle() = handle;
+
+    // the compact output of each case completes the row started here
+    argus.perf = 1;
+
+    std::stringstream header;
+    for(auto& sweep : sweeps)
+        header << std::left << std::setw(15) << sweep.first << ' ';
+    header << std::left << std::setw(15) << "gpu_time_us";
+    if(argus.norm_check)
+        header << ' ' << std::setw(15) << "error";
+    std::cerr << header.str() << std::endl;
+
+    std::vector<size_t> idx(sweeps.size(), 0);
+    while(true)
+    {
+        Arguments         point = argus;
+        std::stringstream row;
+        writer.begin_case();
+        for(size_t i = 0; i < sweeps.size(); i++)
+        {
+            rocblas_int val = sweeps[i].second[idx[i]];
+            if(sweeps[i].first == "batch_count")
+                point.batch_count = val;
+            else
+                point.set<rocblas_int>(sweeps[i].first, val);
+            row << std::left << std::setw(15) << val << ' ';
+            rocsolver_bench_record::get().add_field(sweeps[i].first, std::to_string(val));
+        }
+        std::cerr << row.str();
+
+        hipsolver_dispatcher::invoke(function, precision, point);
+        writer.end_case(function, precision, vm);
+
+        // advance to the next combination, with the last size varying fastest
+        size_t i = sweeps.size();
+        while(i > 0 && ++idx[i - 1] == sweeps[i - 1].second.size())
+            idx[--i] = 0;
+        if(i == 0)
+            break;
+    }
+
+    hipsolver_local_handle::shared_handle() = nullptr;
+}
+
+// Runs every case of a test plan and prints a row per case. Returns the number of failed cases
+static int run_test_plan(const std::vector<plan_case>& cases,
+                         Arguments&                    argus,
+                         bench_writer&                 writer,
+                         const roc::variables_map&     vm)
+{
+    // share a single handle among all the cases
+    hipsolver_local_handle handle;
+    hipsolver_local_handle::shared_handle() = handle;
+
+    // the compact output of each case completes the row started here
+    argus.perf = 1;
+
+    int failures = 0;
+    for(auto& pc : cases)
+    {
+        Arguments         point = argus;
+        std::stringstream row;
+        bool              started = false;
+        writer.begin_case();
+        row << std::left << std::setw(15) << pc.function << ' ' << pc.precision << ' '
+            << std::setw(8) << api2string(pc.api) << ' ';
+        rocsolver_bench_record::get().add_field("api", api2string(pc.api));
+
+        try
+        {
+            for(auto& arg : pc.args)
+            {
+                const std::string& name = arg.first;
+                const std::string& val  = arg.second;
+                if(name == "jobu" || name == "jobv" || name == "jobz" || name == "side"
+                   || name == "trans" || name == "uplo" || name == "itype")
+                {
+                    if(val.size() != 1)
+                        throw std::invalid_argument("Invalid value for " + name + ": " + val);
+                    point.set<char>(name, val[0]);
+                }
+                else
+                {
+                    size_t      len;
+                    rocblas_int num = std::stoi(val, &len);
+                    if(len != val.size())
+                        throw std::invalid_argument("Invalid value for " + name + ": " + val);
+                    if(name == "batch_count")
+                        point.batch_count = num;
+                    else
+                        point.set<rocblas_int>(name, num);
+                }
+                row << name << '=' << val << ' ';
+                rocsolver_bench_record::get().add_field(name, val);
+            }
+            point.validate_operation("trans");
+            point.validate_side("side");
+            point.validate_fill("uplo");
+            point.validate_svect("jobu");
+            point.validate_svect("jobv");
+            point.validate_itype("itype");
+            point.validate_evect("jobz");
+
+            std::cerr << row.str();
+            started = true;
+            hipsolver_dispatcher::invoke(pc.function, pc.precision, point, pc.api);
+            writer.end_case(pc.function, pc.precision, vm);
+        }
+        catch(const std::logic_error& exp)
+        {
+            // report the failed case and continue with the rest of the plan
+            std::cerr << (started ? "" : row.str()) << "FAILED: " << exp.what() << std::endl;
+            failures++;
+        }
+    }
+
+    hipsolver_local_handle::shared_handle() = nullptr;
+    return failures;
+}
+
 int main(int argc, char* argv[])
 try
 {
@@ -47,6 +235,8 @@ try
     std::string function;
     char        precision;
     rocblas_int device_id;
+    rocblas_int cpu_threads;
+    rocblas_int pinned;
 
     // take arguments and set default values
     // clang-format off
@@ -60,6 +250,14 @@ try
             "                           Only applicable to batch routines.\n"
             "                           ")
 
+        ("cpu_threads",
+         value<rocblas_int>(&cpu_threads)->default_value(0),
+            "Host threads used to generate the random inputs and to run the reference\n"
+            "                           LAPACK computations of batches. 0 = the value of\n"
+            "                           HIPSOLVER_CPU_THREADS, or all hardware threads. The\n"
+            "                           timed CPU call is always serial.\n"
+            "                           ")
+
         ("device",
          value<rocblas_int>(&device_id)->default_value(0),
             "Set the default device to be used for subsequent program runs.\n"
@@ -77,12 +275,44 @@ try
             "                           Reported time will be the average.\n"
             "                           ")
 
+        ("time_budget",
+         value<double>(&hipsolver_bench_timing::get().time_budget)->default_value(0),
+            "Time budget of the GPU timing loop, in milliseconds.\n"
+            "                           If positive, the timed calls are repeated until the budget is spent,\n"
+            "                           instead of running the number of iterations given by --iters.\n"
+            "                           ")
+
+        ("warmup",
+         value<rocblas_int>(&hipsolver_bench_timing::get().warmup)->default_value(2),
+            "Untimed calls to run before the GPU timing loop.\n"
+            "                           ")
+
+        ("output-format",
+         value<std::string>()->default_value("text"),
+            "Format of the results. Options are: text, csv, json.\n"
+            "                           With csv or json, the arguments, times, error, GFLOPS and GB/s\n"
+            "                           of each case are also written to stdout.\n"
+            "                           ")
+
         ("perf",
          value<rocblas_int>(&argus.perf)->default_value(0),
             "Ignore CPU timing results? 0 = No, 1 = Yes.\n"
             "                           This forces the client to print only the GPU time and the error if requested.\n"
             "                           ")
 
+        ("pinned",
+         value<rocblas_int>(&pinned)->default_value(0),
+            "Allocate the host arrays in pinned memory? 0 = No, 1 = Yes.\n"
+            "                           Transfers between host and device are then queued on the stream of the handle,\n"
+            "                           without the staging copy of pageable memory.\n"
+            "                           ")
+
+        ("plan",
+         value<std::string>(),
+            "Test plan to run, written in JSON.\n"
+            "                           The cases of the plan are run in a single process, reusing the same handle.\n"
+            "                           ")
+
         ("precision,r",
          value<char>(&precision)->default_value('s'),
             "Precision to be used in the tests.\n"
@@ -95,6 +325,28 @@ try
         //     "                           This will produce matrices that are singular, non positive-definite, etc.\n"
         //     "                           ")
 
+        ("sizebatch",
+         value<std::string>(),
+            "List or range of values of batch_count to sweep over.\n"
+            "                           For example: 1,10,100 or 1:1000:x10.\n"
+            "                           ")
+
+        ("sizem",
+         value<std::string>(),
+            "List or range of values of m to sweep over.\n"
+            "                           For example: 64,100,128 or 64:8192:x2 or 100:1000:100.\n"
+            "                           ")
+
+        ("sizen",
+         value<std::string>(),
+            "List or range of values of n to sweep over.\n"
+            "                           ")
+
+        ("sizenrhs",
+         value<std::string>(),
+            "List or range of values of nrhs to sweep over.\n"
+            "                           ")
+
         ("verify,v",
          value<rocblas_int>(&argus.norm_check)->default_value(0),
             "Validate GPU results with CPU? 0 = No, 1 = Yes.\n"
@@ -355,6 +607,12 @@ try
 
     argus.populate(vm);
 
+    if(cpu_threads < 0)
+        throw std::invalid_argument("Invalid value for --cpu_threads");
+    if(cpu_threads > 0)
+        hipsolver_host_threads() = cpu_threads;
+    host_pinned_memory() = (pinned != 0);
+
     // set device ID
     if(!argus.perf)
     {
@@ -377,8 +635,46 @@ try
     argus.validate_itype("itype");
     argus.validate_evect("jobz");
 
+    // collect the sizes to sweep over, if any
+    size_sweeps sweeps;
+    for(std::string name : {"m", "n", "nrhs", "batch"})
+    {
+        if(!vm.count("size" + name))
+            continue;
+        if(name != "batch" && vm.count(name))
+            throw std::invalid_argument("Cannot use both --" + name + " and --size" + name);
+        sweeps.emplace_back(name == "batch" ? "batch_count" : name,
+                            parse_size_sweep("size" + name, vm["size" + name].as<std::string>()));
+    }
+
+    bench_writer writer(parse_bench_output_format(vm["output-format"].as<std::string>()));
+
     // select and dispatch function test/benchmark
-    hipsolver_dispatcher::invoke(function, precision, argus);
+    if(vm.count("plan"))
+    {
+        if(!sweeps.empty())
+            throw std::invalid_argument("Cannot use both --plan and size sweeps");
+        std::vector<plan_case> cases = read_test_plan(vm["plan"].as<std::string>(), precision);
+        int                    failures = run_test_plan(cases, argus, writer, vm);
+        writer.finish();
+        if(failures)
+        {
+            std::cerr << failures << " of " << cases.size() << " cases failed" << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+    else if(sweeps.empty())
+    {
+        writer.begin_case();
+        hipsolver_dispatcher::invoke(function, precision, argus);
+        if(!argus.perf)
+            print_timing_stats();
+        writer.end_case(function, precision, vm);
+    }
+    else
+        run_size_sweep(function, precision, argus, sweeps, writer, vm);
+    writer.finish();
 
     return 0;
 }
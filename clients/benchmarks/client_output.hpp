@@ -0,0 +1,404 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../include/utility.hpp"
+#include "../rocsolvercommon/rocsolver_arguments.hpp"
+#include "../rocsolvercommon/rocsolver_test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief machine-readable output of the benchmark client, with flop and byte models used to
+ * report the achieved GFLOPS and GB/s.
+ */
+
+enum class bench_output_format
+{
+    text,
+    csv,
+    json
+};
+
+inline bench_output_format parse_bench_output_format(const std::string& name)
+{
+    if(name == "text")
+        return bench_output_format::text;
+    else if(name == "csv")
+        return bench_output_format::csv;
+    else if(name == "json")
+        return bench_output_format::json;
+    else
+        throw std::invalid_argument("Invalid value for --output-format");
+}
+
+/* ============================================================================================
+ */
+/*! \brief  size parameters of a benchmarked case, taken from the values reported by the test or,
+ * failing that, from the command line */
+class bench_sizes
+{
+    const std::vector<std::pair<std::string, std::string>>& m_fields;
+    const roc::variables_map&                               m_vm;
+
+    const std::string* find_field(const std::string& name) const
+    {
+        for(auto& f : m_fields)
+            if(f.first == name)
+                return &f.second;
+        return nullptr;
+    }
+
+public:
+    bench_sizes(const std::vector<std::pair<std::string, std::string>>& fields,
+                const roc::variables_map&                               vm)
+        : m_fields(fields)
+        , m_vm(vm)
+    {
+    }
+
+    // returns the first of the given size parameters that has a value, or deflt
+    double get(std::initializer_list<const char*> names, double deflt) const
+    {
+        for(const char* name : names)
+        {
+            const std::string* f = find_field(name);
+            if(f)
+                return std::stod(*f);
+
+            auto v = m_vm.find(name);
+            if(v != m_vm.end() && !v->second.empty())
+                return v->second.as<rocblas_int>();
+        }
+        return deflt;
+    }
+
+    char get_char(const char* name, char deflt) const
+    {
+        const std::string* f = find_field(name);
+        if(f && !f->empty())
+            return (*f)[0];
+
+        auto v = m_vm.find(name);
+        if(v != m_vm.end() && !v->second.empty())
+            return v->second.as<char>();
+        return deflt;
+    }
+};
+
+// Number of real floating point operations and of elements of memory moved by one problem of the
+// given function. Only the leading-order terms of the usual LAPACK operation counts are
+// considered. Returns false if there is no model for the function.
+inline bool bench_model(std::string fn, const bench_sizes& s, double& flops, double& elems)
+{
+    // batched variants follow the model of the single problem
+    // (vbatched variants use the largest problem of the batch)
+    for(const char* suffix : {"_strided_batched", "_vbatched", "_batched", "_npvt", "_nopivot"})
+    {
+        size_t pos = fn.find(suffix);
+        if(pos != std::string::npos)
+            fn.erase(pos, std::string(suffix).size());
+    }
+
+    double m    = s.get({"m", "max_m"}, -1);
+    double n    = s.get({"n", "max_n"}, m);
+    double nrhs = s.get({"nrhs", "max_nrhs"}, n);
+    if(m < 0)
+        m = n;
+    if(n < 0)
+        return false;
+    double k = s.get({"k"}, std::min(m, n));
+
+    double mn = std::min(m, n), mx = std::max(m, n);
+
+    if(fn == "getrf")
+    {
+        flops = mx * mn * mn - mn * mn * mn / 3;
+        elems = 2 * m * n;
+    }
+    else if(fn == "getrs")
+    {
+        flops = 2 * n * n * nrhs;
+        elems = n * n + 2 * n * nrhs;
+    }
+    else if(fn == "gesv")
+    {
+        flops = 2 * n * n * n / 3 + 2 * n * n * nrhs;
+        elems = 2 * n * n + 2 * n * nrhs;
+    }
+    else if(fn == "potrf" || fn == "sytrf" || fn == "pptrf")
+    {
+        flops = n * n * n / 3;
+        elems = n * n;
+    }
+    else if(fn == "potrf_update" || fn == "potrf_downdate")
+    {
+        flops = 2 * k * n * n;
+        elems = n * n + n * k;
+    }
+    else if(fn == "potrs" || fn == "pptrs")
+    {
+        flops = 2 * n * n * nrhs;
+        elems = n * n / 2 + 2 * n * nrhs;
+    }
+    else if(fn == "posv")
+    {
+        flops = n * n * n / 3 + 2 * n * n * nrhs;
+        elems = n * n + 2 * n * nrhs;
+    }
+    else if(fn == "potri")
+    {
+        flops = 2 * n * n * n / 3;
+        elems = n * n;
+    }
+    else if(fn == "pbtrf")
+    {
+        double kd = s.get({"kd"}, 0);
+        flops     = n * kd * (kd + 3);
+        elems     = 2 * n * (kd + 1);
+    }
+    else if(fn == "pbtrs")
+    {
+        double kd = s.get({"kd"}, 0);
+        flops     = 4 * n * kd * nrhs;
+        elems     = n * (kd + 1) + 2 * n * nrhs;
+    }
+    else if(fn == "gtsv")
+    {
+        flops = 8 * n + 5 * n * nrhs;
+        elems = 3 * n + 2 * n * nrhs;
+    }
+    else if(fn == "geqrf")
+    {
+        flops = 2 * mx * mn * mn - 2 * mn * mn * mn / 3;
+        elems = 2 * m * n;
+    }
+    else if(fn == "gels")
+    {
+        flops = 2 * m * n * n - 2 * n * n * n / 3 + 4 * m * n * nrhs - n * n * nrhs;
+        elems = 2 * m * n + 2 * m * nrhs;
+    }
+    else if(fn == "gebrd")
+    {
+        flops = 4 * mx * mn * mn - 4 * mn * mn * mn / 3;
+        elems = 2 * m * n;
+    }
+    else if(fn == "sytrd" || fn == "hetrd" || fn == "orgtr" || fn == "ungtr")
+    {
+        flops = 4 * n * n * n / 3;
+        elems = n * n;
+    }
+    else if(fn == "orgqr" || fn == "ungqr" || fn == "orgbr" || fn == "ungbr")
+    {
+        flops = 4 * m * n * k - 2 * (m + n) * k * k + 4 * k * k * k / 3;
+        elems = 2 * m * n;
+    }
+    else if(fn == "ormqr" || fn == "unmqr")
+    {
+        bool left = s.get_char("side", 'L') == 'L';
+        flops     = 4 * m * n * k - 2 * (left ? n : m) * k * k;
+        elems     = (left ? m : n) * k + 2 * m * n;
+    }
+    else if(fn == "ormtr" || fn == "unmtr")
+    {
+        double nq = s.get_char("side", 'L') == 'L' ? m : n;
+        flops     = 2 * m * n * nq;
+        elems     = nq * nq + 2 * m * n;
+    }
+    else if(fn == "gesvd" || fn == "gesvdj")
+    {
+        bool vectors = s.get_char("jobu", 'N') != 'N' || s.get_char("jobv", 'N') != 'N'
+                       || s.get_char("jobz", 'N') != 'N';
+        if(vectors)
+            flops = 4 * mx * mx * mn + 8 * mx * mn * mn + 9 * mn * mn * mn;
+        else
+            flops = 4 * mx * mn * mn - 4 * mn * mn * mn / 3;
+        elems = 2 * m * n + (vectors ? m * m + n * n : 0);
+    }
+    else if(fn == "syevd" || fn == "heevd" || fn == "syevj" || fn == "heevj" || fn == "spevd"
+            || fn == "hpevd")
+    {
+        bool vectors = s.get_char("jobz", 'N') != 'N';
+        flops        = vectors ? 9 * n * n * n : 4 * n * n * n / 3;
+        elems        = vectors ? 2 * n * n : n * n;
+    }
+    else if(fn == "sygvd" || fn == "hegvd" || fn == "sygvj" || fn == "hegvj")
+    {
+        bool vectors = s.get_char("jobz", 'N') != 'N';
+        flops        = n * n * n / 3 + n * n * n + (vectors ? 10 * n * n * n : 4 * n * n * n / 3);
+        elems        = 2 * n * n + (vectors ? n * n : 0);
+    }
+    else if(fn == "trttp" || fn == "tpttr")
+    {
+        flops = 0;
+        elems = n * (n + 1);
+    }
+    else
+        return false;
+
+    return true;
+}
+
+/* ============================================================================================
+ */
+/*! \brief  writes the cases run by the benchmark client to stdout as CSV rows or JSON objects */
+class bench_writer
+{
+    bench_output_format      m_format;
+    std::vector<std::string> m_header;
+    bool                     m_first = true;
+
+    static bool is_number(const std::string& str)
+    {
+        if(str.empty())
+            return false;
+        char*  end;
+        double val = std::strtod(str.c_str(), &end);
+        return *end == '\0' && std::isfinite(val);
+    }
+
+    static std::string json_string(const std::string& str)
+    {
+        std::string out = "\"";
+        for(char c : str)
+        {
+            if(c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out + '"';
+    }
+
+    // fields other than numbers are quoted, with embedded quotes doubled (RFC 4180)
+    static std::string csv_field(const std::string& str)
+    {
+        if(is_number(str))
+            return str;
+
+        std::string out = "\"";
+        for(char c : str)
+        {
+            if(c == '"')
+                out += '"';
+            out += c;
+        }
+        return out + '"';
+    }
+
+    static void add_number(std::vector<std::pair<std::string, std::string>>& fields,
+                           const std::string&                                 name,
+                           double                                             value)
+    {
+        std::stringstream ss;
+        ss << value;
+        fields.emplace_back(name, ss.str());
+    }
+
+public:
+    explicit bench_writer(bench_output_format format)
+        : m_format(format)
+    {
+        rocsolver_bench_record::get().enabled = (format != bench_output_format::text);
+    }
+
+    // starts collecting the output of a new case
+    void begin_case()
+    {
+        rocsolver_bench_record::get().clear();
+        hipsolver_bench_timing::get().wall   = hipsolver_time_stats();
+        hipsolver_bench_timing::get().device = hipsolver_time_stats();
+    }
+
+    // writes the output of the case that has just finished
+    void end_case(const std::string& function, char precision, const roc::variables_map& vm)
+    {
+        if(m_format == bench_output_format::text)
+            return;
+
+        std::vector<std::pair<std::string, std::string>> fields;
+        fields.emplace_back("function", function);
+        fields.emplace_back("precision", std::string(1, precision));
+        for(auto& f : rocsolver_bench_record::get().fields())
+            fields.push_back(f);
+
+        // achieved rates, from the models of the function and the measured gpu time
+        bench_sizes sizes(rocsolver_bench_record::get().fields(), vm);
+        double      flops, elems;
+        double      gpu_time = sizes.get({"gpu_time"}, 0);
+        if(gpu_time > 0 && bench_model(function, sizes, flops, elems))
+        {
+            bool   complex = (precision == 'c' || precision == 'z');
+            double bytes   = (precision == 's' ? 4 : precision == 'z' ? 16 : 8);
+            double batch   = sizes.get({"batch_c", "batch_count"}, 1);
+
+            add_number(fields, "gflops", batch * flops * (complex ? 4 : 1) / (gpu_time * 1e3));
+            add_number(fields, "gbytes_per_s", batch * elems * bytes / (gpu_time * 1e3));
+        }
+
+        // statistics of the timed calls
+        hipsolver_bench_timing& timing = hipsolver_bench_timing::get();
+        if(timing.wall.samples > 0)
+        {
+            for(auto& t : {std::make_pair("wall", timing.wall),
+                           std::make_pair("device", timing.device)})
+            {
+                std::string prefix(t.first);
+                add_number(fields, prefix + "_mean", t.second.mean);
+                add_number(fields, prefix + "_min", t.second.min);
+                add_number(fields, prefix + "_median", t.second.median);
+                add_number(fields, prefix + "_p95", t.second.p95);
+                add_number(fields, prefix + "_p99", t.second.p99);
+                add_number(fields, prefix + "_stddev", t.second.stddev);
+            }
+            add_number(fields, "samples", timing.wall.samples);
+        }
+
+        if(m_format == bench_output_format::csv)
+        {
+            std::vector<std::string> header;
+            for(auto& f : fields)
+                header.push_back(f.first);
+            if(header != m_header)
+            {
+                m_header = header;
+                for(size_t i = 0; i < header.size(); i++)
+                    std::cout << (i ? "," : "") << csv_field(header[i]);
+                std::cout << std::endl;
+            }
+            for(size_t i = 0; i < fields.size(); i++)
+                std::cout << (i ? "," : "") << csv_field(fields[i].second);
+            std::cout << std::endl;
+        }
+        else
+        {
+            std::cout << (m_first ? "[\n" : ",\n") << "  {";
+            for(size_t i = 0; i < fields.size(); i++)
+            {
+                std::cout << (i ? ", " : "") << json_string(fields[i].first) << ": ";
+                if(is_number(fields[i].second))
+                    std::cout << fields[i].second;
+                else
+                    std::cout << json_string(fields[i].second);
+            }
+            std::cout << "}";
+        }
+        m_first = false;
+    }
+
+    // closes the output once all the cases have been written
+    void finish()
+    {
+        if(m_format == bench_output_format::json)
+            std::cout << (m_first ? "[]" : "\n]") << std::endl;
+    }
+};
@@ -0,0 +1,344 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../include/clientcommon.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!\file
+ * \brief size sweeps and test plans of the benchmark client.
+ */
+
+// Parses a comma-separated list of sizes and ranges start:end:step or start:end:xstep
+inline std::vector<rocblas_int> parse_size_sweep(const std::string& name, const std::string& spec)
+{
+    std::vector<rocblas_int> sizes;
+    std::stringstream        items(spec);
+    std::string              item;
+
+    while(std::getline(items, item, ','))
+    {
+        std::vector<std::string> fields;
+        std::stringstream        ss(item);
+        std::string              field;
+        while(std::getline(ss, field, ':'))
+            fields.push_back(field);
+
+        try
+        {
+            if(fields.size() == 1)
+            {
+                sizes.push_back(std::stoi(fields[0]));
+                continue;
+            }
+            if(fields.size() != 3)
+                throw std::invalid_argument(name);
+
+            rocblas_int start = std::stoi(fields[0]);
+            rocblas_int end   = std::stoi(fields[1]);
+            bool        mult  = !fields[2].empty() && fields[2][0] == 'x';
+            rocblas_int step  = std::stoi(mult ? fields[2].substr(1) : fields[2]);
+            if(start > end || (mult ? (start < 1 || step < 2) : step < 1))
+                throw std::invalid_argument(name);
+
+            for(int64_t v = start; v <= end; v = mult ? v * step : v + step)
+                sizes.push_back(rocblas_int(v));
+        }
+        catch(const std::logic_error&)
+        {
+            throw std::invalid_argument("Invalid value for --" + name + ": " + item);
+        }
+    }
+
+    if(sizes.empty())
+        throw std::invalid_argument("Invalid value for --" + name);
+    return sizes;
+}
+
+/* ============================================================================================
+ */
+/*! \brief  value read from a test plan. Plans are written in JSON, which is also valid YAML */
+struct plan_value
+{
+    enum kind_t
+    {
+        null,
+        boolean,
+        number,
+        string,
+        array,
+        object
+    };
+
+    kind_t                                          kind = null;
+    bool                                            flag = false;
+    double                                          num  = 0;
+    std::string                                     str;
+    std::vector<plan_value>                         items;
+    std::vector<std::pair<std::string, plan_value>> members;
+
+    // list of values, where a single value is taken as a list of one
+    std::vector<plan_value> as_list() const
+    {
+        return kind == array ? items : std::vector<plan_value>{*this};
+    }
+};
+
+class plan_parser
+{
+    const std::string& m_text;
+    size_t             m_pos = 0;
+
+    [[noreturn]] void fail(const std::string& what) const
+    {
+        size_t line = 1 + std::count(m_text.begin(), m_text.begin() + m_pos, '\n');
+        throw std::invalid_argument("Invalid test plan, line " + std::to_string(line) + ": "
+                                    + what);
+    }
+
+    char peek()
+    {
+        while(m_pos < m_text.size() && std::isspace((unsigned char)m_text[m_pos]))
+            m_pos++;
+        return m_pos < m_text.size() ? m_text[m_pos] : '\0';
+    }
+
+    void expect(char c)
+    {
+        if(peek() != c)
+            fail(std::string("expected '") + c + "'");
+        m_pos++;
+    }
+
+    std::string parse_string()
+    {
+        expect('"');
+        std::string str;
+        while(m_pos < m_text.size() && m_text[m_pos] != '"')
+        {
+            if(m_text[m_pos] == '\\' && m_pos + 1 < m_text.size())
+                m_pos++;
+            str += m_text[m_pos++];
+        }
+        expect('"');
+        return str;
+    }
+
+    plan_value parse_value()
+    {
+        plan_value val;
+        char       c = peek();
+
+        if(c == '{')
+        {
+            val.kind = plan_value::object;
+            m_pos++;
+            if(peek() == '}')
+                m_pos++;
+            else
+            {
+                do
+                {
+                    std::string key = parse_string();
+                    expect(':');
+                    val.members.emplace_back(key, parse_value());
+                } while(peek() == ',' && ++m_pos);
+                expect('}');
+            }
+        }
+        else if(c == '[')
+        {
+            val.kind = plan_value::array;
+            m_pos++;
+            if(peek() == ']')
+                m_pos++;
+            else
+            {
+                do
+                    val.items.push_back(parse_value());
+                while(peek() == ',' && ++m_pos);
+                expect(']');
+            }
+        }
+        else if(c == '"')
+        {
+            val.kind = plan_value::string;
+            val.str  = parse_string();
+        }
+        else if(m_text.compare(m_pos, 4, "true") == 0 || m_text.compare(m_pos, 5, "false") == 0)
+        {
+            val.kind = plan_value::boolean;
+            val.flag = (c == 't');
+            m_pos += val.flag ? 4 : 5;
+        }
+        else if(m_text.compare(m_pos, 4, "null") == 0)
+            m_pos += 4;
+        else
+        {
+            size_t len = 0;
+            try
+            {
+                val.num = std::stod(m_text.substr(m_pos), &len);
+            }
+            catch(const std::logic_error&)
+            {
+                fail("unexpected character");
+            }
+            val.kind = plan_value::number;
+            m_pos += len;
+        }
+
+        return val;
+    }
+
+public:
+    explicit plan_parser(const std::string& text)
+        : m_text(text)
+    {
+    }
+
+    plan_value parse()
+    {
+        plan_value val = parse_value();
+        if(peek() != '\0')
+            fail("unexpected data after the plan");
+        return val;
+    }
+};
+
+/* ============================================================================================
+ */
+/*! \brief  single case of a test plan */
+struct plan_case
+{
+    std::string function;
+    char        precision;
+    testAPI_t   api;
+
+    // arguments of the case, with their values as written in the plan
+    std::vector<std::pair<std::string, std::string>> args;
+};
+
+inline const char* api2string(testAPI_t api)
+{
+    return api == API_FORTRAN ? "fortran" : api == API_COMPAT ? "compat" : "normal";
+}
+
+// Reads a test plan. The plan is a list of entries (or an object with the list under "cases"),
+// each giving a function, and optionally precisions, API variants and arguments. Every field may
+// be a single value or a list, and sizes may also be given as ranges, as with --sizem. An entry
+// produces a case for every combination of its values.
+inline std::vector<plan_case> read_test_plan(const std::string& filename, char default_precision)
+{
+    std::ifstream file(filename);
+    if(!file)
+        throw std::invalid_argument("Cannot open test plan " + filename);
+    std::stringstream text;
+    text << file.rdbuf();
+
+    std::string str  = text.str();
+    plan_value  plan = plan_parser(str).parse();
+    if(plan.kind == plan_value::object)
+    {
+        plan_value entries;
+        for(auto& m : plan.members)
+            if(m.first == "cases")
+                entries = m.second;
+        plan = entries;
+    }
+    if(plan.kind != plan_value::array)
+        throw std::invalid_argument("Invalid test plan: expected a list of cases");
+
+    std::vector<plan_case> cases;
+    for(auto& entry : plan.items)
+    {
+        if(entry.kind != plan_value::object)
+            throw std::invalid_argument("Invalid test plan: each case must be an object");
+
+        // each field of the entry, with the list of values it takes
+        std::vector<std::pair<std::string, std::vector<std::string>>> fields;
+        bool has_function = false, has_precision = false;
+        for(auto& m : entry.members)
+        {
+            std::vector<std::string> values;
+            for(auto& v : m.second.as_list())
+            {
+                if(v.kind == plan_value::number)
+                    values.push_back(std::to_string(int64_t(v.num)));
+                else if(v.kind == plan_value::string && v.str.find(':') != std::string::npos)
+                {
+                    for(rocblas_int size : parse_size_sweep(m.first, v.str))
+                        values.push_back(std::to_string(size));
+                }
+                else if(v.kind == plan_value::string)
+                    values.push_back(v.str);
+                else
+                    throw std::invalid_argument("Invalid test plan: bad value for " + m.first);
+            }
+            if(values.empty())
+                throw std::invalid_argument("Invalid test plan: no values for " + m.first);
+
+            has_function  = has_function || m.first == "function";
+            has_precision = has_precision || m.first == "precision";
+            fields.emplace_back(m.first, values);
+        }
+        if(!has_function)
+            throw std::invalid_argument("Invalid test plan: case without function");
+        if(!has_precision)
+            fields.emplace_back("precision", std::vector<std::string>{{default_precision}});
+
+        // expand all the combinations, with the last field varying fastest
+        std::vector<size_t> idx(fields.size(), 0);
+        while(true)
+        {
+            plan_case pc;
+            pc.api = API_NORMAL;
+            for(size_t i = 0; i < fields.size(); i++)
+            {
+                const std::string& name = fields[i].first;
+                const std::string& val  = fields[i].second[idx[i]];
+                if(name == "function")
+                    pc.function = val;
+                else if(name == "precision")
+                {
+                    if(val.size() != 1)
+                        throw std::invalid_argument("Invalid test plan: bad precision " + val);
+                    pc.precision = val[0];
+                }
+                else if(name == "api")
+                {
+                    if(val == "normal")
+                        pc.api = API_NORMAL;
+                    else if(val == "fortran")
+                        pc.api = API_FORTRAN;
+                    else if(val == "compat")
+                        pc.api = API_COMPAT;
+                    else
+                        throw std::invalid_argument("Invalid test plan: bad api " + val);
+                }
+                else
+                    pc.args.emplace_back(name, val);
+            }
+            cases.push_back(pc);
+
+            size_t i = fields.size();
+            while(i > 0 && ++idx[i - 1] == fields[i - 1].second.size())
+                idx[--i] = 0;
+            if(i == 0)
+                break;
+        }
+    }
+
+    return cases;
+}
@@ -0,0 +1,274 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Multi-threaded benchmark of the request coalescer. Each thread owns a handle, a stream and a
+// matrix, and repeatedly factorizes its matrix and waits for the result, as a server answering
+// independent requests would. The same workload is run with the regular functions and with the
+// coalesced functions, and the throughput and latency of the requests are compared.
+
+#include "../include/clientcommon.hpp"
+#include "../include/hipsolver_datatype2string.hpp"
+#include "../rocblascommon/program_options.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace roc;
+
+// clang-format off
+const char* help_str = R"HELP_STR(
+hipSOLVER coalescer benchmark help.
+
+Usage: ./hipsolver-coalesce <options>
+
+Runs concurrent requests from several host threads, where each request is a single precision
+factorization of an n-by-n matrix followed by the synchronization of the stream of its thread.
+The requests are run first with the regular functions (direct), and then with the coalesced
+functions sharing one coalescer (coalesced). The number of requests per second and the median
+and 99th percentile latency of the requests are reported for both modes.
+
+Example: ./hipsolver-coalesce --function getrf --threads 32 --n 16 --window 100
+)HELP_STR";
+// clang-format on
+
+struct coalesce_result
+{
+    hipsolverStatus_t status     = HIPSOLVER_STATUS_SUCCESS;
+    double            throughput = 0;
+    double            median_us  = 0;
+    double            p99_us     = 0;
+};
+
+struct coalesce_thread
+{
+    hipsolverHandle_t handle;
+    hipStream_t       stream;
+    float*            A;
+    int*              ipiv;
+    int*              info;
+};
+
+using coalesce_call = std::function<hipsolverStatus_t(coalesce_thread&)>;
+
+static coalesce_result run_requests(std::vector<coalesce_thread>& threads,
+                                    int                           iterations,
+                                    const coalesce_call&          call)
+{
+    using clock = std::chrono::steady_clock;
+
+    int                              nthreads = threads.size();
+    std::vector<std::vector<double>> latencies(nthreads, std::vector<double>(iterations));
+    std::vector<hipsolverStatus_t>   statuses(nthreads, HIPSOLVER_STATUS_SUCCESS);
+    std::atomic<int>                 waiting(nthreads);
+
+    auto work = [&](int t) {
+        // start all threads together, so that their requests overlap from the first one
+        waiting--;
+        while(waiting > 0)
+            std::this_thread::yield();
+
+        for(int i = 0; i < iterations; i++)
+        {
+            auto              start  = clock::now();
+            hipsolverStatus_t status = call(threads[t]);
+            if(status == HIPSOLVER_STATUS_SUCCESS
+               && hipStreamSynchronize(threads[t].stream) != hipSuccess)
+                status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+            latencies[t][i]
+                = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+            {
+                statuses[t] = status;
+                return;
+            }
+        }
+    };
+
+    auto                     start = clock::now();
+    std::vector<std::thread> workers;
+    for(int t = 0; t < nthreads; t++)
+        workers.emplace_back(work, t);
+    for(std::thread& w : workers)
+        w.join();
+    double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+    coalesce_result result;
+    for(hipsolverStatus_t status : statuses)
+    {
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+        {
+            result.status = status;
+            return result;
+        }
+    }
+
+    std::vector<double> all;
+    for(const std::vector<double>& l : latencies)
+        all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+
+    result.throughput = all.size() / elapsed;
+    result.median_us  = all[all.size() / 2];
+    result.p99_us     = all[std::min(all.size() - 1, all.size() * 99 / 100)];
+    return result;
+}
+
+int main(int argc, char* argv[])
+try
+{
+    int         nthreads;
+    int         n;
+    int         iterations;
+    int         max_batch;
+    int         window;
+    std::string function;
+
+    // clang-format off
+    options_description desc(help_str);
+    desc.add_options()
+        ("help,h",
+         "Produces this help message.")
+
+        ("function",
+         value<std::string>(&function)->default_value("potrf"),
+            "Factorization run by the requests: potrf or getrf.")
+
+        ("threads",
+         value<int>(&nthreads)->default_value(16),
+            "Number of host threads submitting requests.")
+
+        ("n",
+         value<int>(&n)->default_value(16),
+            "Size of the matrices.")
+
+        ("iterations",
+         value<int>(&iterations)->default_value(1000),
+            "Number of requests submitted by each thread.")
+
+        ("max_batch",
+         value<int>(&max_batch)->default_value(64),
+            "Maximum number of requests dispatched together by the coalescer.")
+
+        ("window",
+         value<int>(&window)->default_value(50),
+            "Time, in microseconds, that the first request of a batch waits for others.");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(function != "potrf" && function != "getrf")
+        throw std::invalid_argument("Invalid value for --function");
+    if(nthreads < 1)
+        throw std::invalid_argument("Invalid value for --threads");
+    if(n < 1)
+        throw std::invalid_argument("Invalid value for --n");
+    if(iterations < 1)
+        throw std::invalid_argument("Invalid value for --iterations");
+    if(max_batch < 1)
+        throw std::invalid_argument("Invalid value for --max_batch");
+    if(window < 0)
+        throw std::invalid_argument("Invalid value for --window");
+
+    hipsolverCoalescer_t coalescer;
+    hipsolverStatus_t    status = hipsolverCoalescerCreate(&coalescer);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+    {
+        std::printf("Coalescer not available: %s\n", hipsolver2string_status(status));
+        return 0;
+    }
+    CHECK_ROCBLAS_ERROR(hipsolverCoalescerSetMaxBatch(coalescer, max_batch));
+    CHECK_ROCBLAS_ERROR(hipsolverCoalescerSetWindow(coalescer, window));
+
+    // the identity is left unchanged by both factorizations, so it is never reset
+    std::vector<float> hA(size_t(n) * n, 0);
+    for(int i = 0; i < n; i++)
+        hA[i + size_t(i) * n] = 1;
+
+    std::vector<coalesce_thread> threads(nthreads);
+    for(coalesce_thread& t : threads)
+    {
+        CHECK_HIP_ERROR(hipStreamCreate(&t.stream));
+        CHECK_ROCBLAS_ERROR(hipsolverCreate(&t.handle));
+        CHECK_ROCBLAS_ERROR(hipsolverSetStream(t.handle, t.stream));
+        CHECK_HIP_ERROR(hipMalloc(&t.A, sizeof(float) * hA.size()));
+        CHECK_HIP_ERROR(hipMalloc(&t.ipiv, sizeof(int) * n));
+        CHECK_HIP_ERROR(hipMalloc(&t.info, sizeof(int)));
+        CHECK_HIP_ERROR(
+            hipMemcpy(t.A, hA.data(), sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    }
+
+    const hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_UPPER;
+    bool                      lu   = (function == "getrf");
+
+    // the regular functions query and allocate their workspace once per handle, in a first call
+    auto direct = [&](coalesce_thread& t) {
+        return lu ? hipsolverSgetrf(t.handle, n, n, t.A, n, nullptr, 0, t.ipiv, t.info)
+                  : hipsolverSpotrf(t.handle, uplo, n, t.A, n, nullptr, 0, t.info);
+    };
+    auto coalesced = [&](coalesce_thread& t) {
+        return lu ? hipsolverSgetrfCoalesced(t.handle, coalescer, n, n, t.A, n, t.ipiv, t.info)
+                  : hipsolverSpotrfCoalesced(t.handle, coalescer, uplo, n, t.A, n, t.info);
+    };
+
+    const std::vector<std::pair<const char*, coalesce_call>> modes
+        = {{"direct", direct}, {"coalesced", coalesced}};
+
+    std::printf("%s, n = %d, %d threads, %d requests per thread, max_batch = %d, window = %d us\n",
+                function.c_str(),
+                n,
+                nthreads,
+                iterations,
+                max_batch,
+                window);
+    std::printf("%-10s %16s %12s %12s\n", "mode", "requests/s", "median us", "p99 us");
+
+    for(const auto& mode : modes)
+    {
+        // warm up the handles and the coalescer
+        coalesce_result result = run_requests(threads, 1, mode.second);
+        if(result.status == HIPSOLVER_STATUS_SUCCESS)
+            result = run_requests(threads, iterations, mode.second);
+
+        if(result.status != HIPSOLVER_STATUS_SUCCESS)
+            std::printf("%-10s %s\n", mode.first, hipsolver2string_status(result.status));
+        else
+            std::printf("%-10s %16.1f %12.1f %12.1f\n",
+                        mode.first,
+                        result.throughput,
+                        result.median_us,
+                        result.p99_us);
+    }
+
+    for(coalesce_thread& t : threads)
+    {
+        CHECK_HIP_ERROR(hipFree(t.A));
+        CHECK_HIP_ERROR(hipFree(t.ipiv));
+        CHECK_HIP_ERROR(hipFree(t.info));
+        CHECK_ROCBLAS_ERROR(hipsolverDestroy(t.handle));
+        CHECK_HIP_ERROR(hipStreamDestroy(t.stream));
+    }
+    CHECK_ROCBLAS_ERROR(hipsolverCoalescerDestroy(coalescer));
+    return 0;
+}
+
+catch(const std::invalid_argument& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    return -1;
+}
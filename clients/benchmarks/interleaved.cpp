@@ -0,0 +1,301 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Benchmark of the interleaved batched layout for batches of small matrices. The same batch is
+// solved with the interleaved functions, and the conversions between the interleaved and strided
+// layouts that they do internally are timed on their own; the difference is the time of the
+// strided batched computation. Where hipSOLVER has a batched function taking an array of
+// pointers, the batch is also solved with it, on matrices stored one after the other.
+
+#include "../include/clientcommon.hpp"
+#include "../include/hipsolver_datatype2string.hpp"
+#include "../rocblascommon/program_options.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace roc;
+
+// clang-format off
+const char* help_str = R"HELP_STR(
+hipSOLVER interleaved batch benchmark help.
+
+Usage: ./hipsolver-interleaved <options>
+
+Solves a batch of single precision n-by-n problems stored in the interleaved layout, where
+element (i,j) of all the problems is contiguous, and reports the median device time per call
+and the number of problems solved per second for:
+
+  interleaved    the interleaved function (hipsolverSpotrfInterleaved, ...),
+  conversions    the conversions of the matrices of the call from the interleaved layout to
+                 the strided layout and back, which the interleaved function includes,
+  strided        the strided batched computation, i.e. interleaved minus conversions,
+  pointer-array  the batched function taking an array of pointers (potrf and potrs only).
+
+Example: ./hipsolver-interleaved --function potrf --n 8 --batch_count 100000
+)HELP_STR";
+// clang-format on
+
+using interleaved_call = std::function<hipsolverStatus_t()>;
+
+// Runs reset (untimed) and call iterations times, and returns the median time of call in
+// microseconds, or a negative value if a call failed
+static double time_call(const interleaved_call& reset,
+                        const interleaved_call& call,
+                        hipStream_t             stream,
+                        int                     iterations)
+{
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+
+    std::vector<double> times;
+    for(int i = 0; i < iterations + 1; i++)
+    {
+        if(reset() != HIPSOLVER_STATUS_SUCCESS)
+            break;
+
+        CHECK_HIP_ERROR(hipEventRecord(start, stream));
+        if(call() != HIPSOLVER_STATUS_SUCCESS)
+            break;
+        CHECK_HIP_ERROR(hipEventRecord(stop, stream));
+        CHECK_HIP_ERROR(hipEventSynchronize(stop));
+
+        // the first call, which allocates the workspace of the handle, is not timed
+        float ms;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+        if(i > 0)
+            times.push_back(ms * 1000.0);
+    }
+
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+
+    if(times.size() < size_t(iterations))
+        return -1;
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+int main(int argc, char* argv[])
+try
+{
+    int         n;
+    int         nrhs;
+    int         bc;
+    int         iterations;
+    std::string function;
+
+    // clang-format off
+    options_description desc(help_str);
+    desc.add_options()
+        ("help,h",
+         "Produces this help message.")
+
+        ("function",
+         value<std::string>(&function)->default_value("potrf"),
+            "Function to run: potrf, potrs, getrf or getrs.")
+
+        ("n",
+         value<int>(&n)->default_value(8),
+            "Size of the matrices.")
+
+        ("nrhs",
+         value<int>(&nrhs)->default_value(1),
+            "Number of right-hand sides of potrs and getrs.")
+
+        ("batch_count",
+         value<int>(&bc)->default_value(10000),
+            "Number of problems in the batch.")
+
+        ("iterations",
+         value<int>(&iterations)->default_value(20),
+            "Number of timed calls of each variant.");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(function != "potrf" && function != "potrs" && function != "getrf" && function != "getrs")
+        throw std::invalid_argument("Invalid value for --function");
+    if(n < 1)
+        throw std::invalid_argument("Invalid value for --n");
+    if(nrhs < 1)
+        throw std::invalid_argument("Invalid value for --nrhs");
+    if(bc < 1)
+        throw std::invalid_argument("Invalid value for --batch_count");
+    if(iterations < 1)
+        throw std::invalid_argument("Invalid value for --iterations");
+
+    const bool                lu    = (function == "getrf" || function == "getrs");
+    const bool                solve = (function == "potrs" || function == "getrs");
+    const hipsolverFillMode_t uplo  = HIPSOLVER_FILL_MODE_UPPER;
+    const int                 k     = solve ? nrhs : 0;
+    const size_t              sizeA = size_t(n) * n;
+    const size_t              sizeB = size_t(n) * k;
+
+    // diagonally dominant symmetric matrices, which need no pivoting, and right-hand sides of
+    // ones; hA and hB are strided, hIA and hIB interleaved
+    std::vector<float> hA(sizeA * bc), hIA(sizeA * bc), hB(sizeB * bc, 1), hIB(sizeB * bc, 1);
+    for(int b = 0; b < bc; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+            {
+                float a = (i == j) ? float(2 * n) : 1.0f / (1 + std::abs(i - j) + b % 7);
+                hA[b * sizeA + i + j * n]         = a;
+                hIA[b + (i + size_t(j) * n) * bc] = a;
+            }
+
+    hipsolverHandle_t handle;
+    hipStream_t       stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(hipsolverCreate(&handle));
+    CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, stream));
+
+    std::vector<void*> allocations;
+    auto               device = [&](size_t bytes) {
+        void* ptr;
+        CHECK_HIP_ERROR(hipMalloc(&ptr, std::max<size_t>(bytes, 1)));
+        allocations.push_back(ptr);
+        return ptr;
+    };
+
+    float*  dA    = (float*)device(sizeof(float) * hA.size());
+    float*  dIA   = (float*)device(sizeof(float) * hA.size());
+    float*  dA0   = (float*)device(sizeof(float) * hA.size());
+    float*  dIA0  = (float*)device(sizeof(float) * hA.size());
+    float*  dWA   = (float*)device(sizeof(float) * hA.size());
+    float*  dB    = (float*)device(sizeof(float) * hB.size());
+    float*  dIB   = (float*)device(sizeof(float) * hB.size());
+    float*  dB0   = (float*)device(sizeof(float) * hB.size());
+    float*  dIB0  = (float*)device(sizeof(float) * hB.size());
+    float*  dWB   = (float*)device(sizeof(float) * hB.size());
+    float** dAp   = (float**)device(sizeof(float*) * bc);
+    float** dBp   = (float**)device(sizeof(float*) * bc);
+    int*    dipiv = (int*)device(sizeof(int) * n * bc);
+    int*    dinfo = (int*)device(sizeof(int) * bc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIA, hIA.data(), sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIB, hIB.data(), sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+
+    std::vector<float*> hAp(bc), hBp(bc);
+    for(int b = 0; b < bc; b++)
+    {
+        hAp[b] = dA + b * sizeA;
+        hBp[b] = dB + b * sizeB;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dAp, hAp.data(), sizeof(float*) * bc, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBp, hBp.data(), sizeof(float*) * bc, hipMemcpyHostToDevice));
+
+    // the solves use the factors of the matrices, which are computed once
+    if(solve)
+    {
+        CHECK_ROCBLAS_ERROR(
+            lu ? hipsolverSgetrfInterleaved(handle, n, n, dIA, n, nullptr, 0, dipiv, dinfo, bc)
+               : hipsolverSpotrfInterleaved(handle, uplo, n, dIA, n, nullptr, 0, dinfo, bc));
+        CHECK_ROCBLAS_ERROR(hipsolverSinterleavedToStrided(handle, n, n, dIA, n, dA, n, sizeA, bc));
+    }
+
+    // the factorizations overwrite A and the solves B, which are restored before each call
+    CHECK_HIP_ERROR(hipMemcpy(dA0, dA, sizeof(float) * hA.size(), hipMemcpyDeviceToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIA0, dIA, sizeof(float) * hA.size(), hipMemcpyDeviceToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB0, dB, sizeof(float) * hB.size(), hipMemcpyDeviceToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIB0, dIB, sizeof(float) * hB.size(), hipMemcpyDeviceToDevice));
+
+    auto restore = [&](float* dst, float* src, size_t count) {
+        return hipMemcpyAsync(dst, src, sizeof(float) * count, hipMemcpyDeviceToDevice, stream)
+                       == hipSuccess
+                   ? HIPSOLVER_STATUS_SUCCESS
+                   : HIPSOLVER_STATUS_INTERNAL_ERROR;
+    };
+    auto reset_interleaved = [&]() {
+        return solve ? restore(dIB, dIB0, hB.size()) : restore(dIA, dIA0, hA.size());
+    };
+    auto reset_strided = [&]() {
+        return solve ? restore(dB, dB0, hB.size()) : restore(dA, dA0, hA.size());
+    };
+    auto no_reset = [&]() { return HIPSOLVER_STATUS_SUCCESS; };
+
+    auto interleaved = [&]() {
+        if(function == "potrf")
+            return hipsolverSpotrfInterleaved(handle, uplo, n, dIA, n, nullptr, 0, dinfo, bc);
+        if(function == "getrf")
+            return hipsolverSgetrfInterleaved(handle, n, n, dIA, n, nullptr, 0, dipiv, dinfo, bc);
+        if(function == "potrs")
+            return hipsolverSpotrsInterleaved(
+                handle, uplo, n, nrhs, dIA, n, dIB, n, nullptr, 0, dinfo, bc);
+        return hipsolverSgetrsInterleaved(
+            handle, HIPSOLVER_OP_N, n, nrhs, dIA, n, dipiv, dIB, n, nullptr, 0, dinfo, bc);
+    };
+
+    // the interleaved functions convert A (and B) into the workspace, and convert back their
+    // results: A for the factorizations and B for the solves
+    auto conversions = [&]() {
+        hipsolverStatus_t status
+            = hipsolverSinterleavedToStrided(handle, n, n, dIA, n, dWA, n, sizeA, bc);
+        if(status == HIPSOLVER_STATUS_SUCCESS && solve)
+            status = hipsolverSinterleavedToStrided(handle, n, nrhs, dIB, n, dWB, n, sizeB, bc);
+        if(status == HIPSOLVER_STATUS_SUCCESS && solve)
+            return hipsolverSstridedToInterleaved(handle, n, nrhs, dWB, n, sizeB, dIB, n, bc);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            return hipsolverSstridedToInterleaved(handle, n, n, dWA, n, sizeA, dIA, n, bc);
+        return status;
+    };
+
+    auto pointer_array = [&]() {
+        if(function == "potrf")
+            return hipsolverSpotrfBatched(handle, uplo, n, dAp, n, nullptr, 0, dinfo, bc);
+        return hipsolverSpotrsBatched(
+            handle, uplo, n, nrhs, dAp, n, dBp, n, nullptr, 0, dinfo, bc);
+    };
+
+    double t_interleaved = time_call(reset_interleaved, interleaved, stream, iterations);
+    double t_conversions = time_call(no_reset, conversions, stream, iterations);
+    double t_pointers    = lu ? -1 : time_call(reset_strided, pointer_array, stream, iterations);
+
+    std::printf("%s, n = %d", function.c_str(), n);
+    if(solve)
+        std::printf(", nrhs = %d", nrhs);
+    std::printf(", batch_count = %d, %d iterations\n", bc, iterations);
+    std::printf("%-14s %14s %16s\n", "variant", "median us", "problems/s");
+
+    auto report = [&](const char* name, double us, const char* missing) {
+        if(us < 0)
+            std::printf("%-14s %14s\n", name, missing);
+        else
+            std::printf("%-14s %14.1f %16.1f\n", name, us, us > 0 ? bc / (us * 1e-6) : 0.0);
+    };
+    report("interleaved", t_interleaved, "failed");
+    report("conversions", t_conversions, "failed");
+    report("strided",
+           t_interleaved < 0 || t_conversions < 0 ? -1
+                                                  : std::max(t_interleaved - t_conversions, 0.0),
+           "failed");
+    report("pointer-array", t_pointers, lu ? "not available" : "failed");
+
+    for(void* ptr : allocations)
+        CHECK_HIP_ERROR(hipFree(ptr));
+    CHECK_ROCBLAS_ERROR(hipsolverDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return 0;
+}
+
+catch(const std::invalid_argument& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    return -1;
+}
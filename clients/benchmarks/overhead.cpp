@@ -0,0 +1,438 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Micro-benchmark of the host overhead of the hipSOLVER entry points: the time spent in the
+// wrapper layer (argument checks and translation, workspace management, and the Fortran and
+// compatibility marshalling) rather than in the solvers. Each routine is called with the
+// problem size given by --n, which defaults to the quick-return case n = 0. Larger sizes are
+// meaningful only with the stub backend (USE_STUB_BACKEND), which does no computation.
+//
+// The routines are a representative subset rather than the full list of the dispatcher, whose
+// entries run complete tests: one routine for each kind of wrapper path (workspace query,
+// automatic workspace, pivots, mixed-precision iterative refinement, Fortran-only routines and
+// routines with a parameters object), in every precision and API flavor.
+
+#include "../include/clientcommon.hpp"
+#include "../include/hipsolver_datatype2string.hpp"
+#include "../rocblascommon/program_options.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace roc;
+
+// clang-format off
+const char* help_str = R"HELP_STR(
+hipSOLVER host-overhead benchmark help.
+
+Usage: ./hipsolver-overhead <options>
+
+Measures the host time per call of the hipSOLVER entry points, for each routine, precision and
+API flavor (normal, Fortran, and the hipsolverDn compatibility API). No workspace is passed, so the
+compute functions include the workspace query and management done by the wrapper layer.
+Combinations that are not available are reported as not supported.
+
+The cost of creating and destroying a handle is reported as create_destroy, which can be
+compared with and without the handle pool of the rocSOLVER backend (option --handle_pool).
+
+Example: ./hipsolver-overhead --filter getrf --precision sd --repetitions 10
+)HELP_STR";
+// clang-format on
+
+struct overhead_case
+{
+    std::string name;
+    char        precision;
+
+    // number of available API flavors, in the order normal, Fortran and compat (the routines
+    // taking a FORTRAN flag instead of an API have no compatibility variant)
+    int flavors;
+
+    std::function<hipsolverStatus_t(testAPI_t)> call;
+};
+
+struct overhead_result
+{
+    size_t iterations = 0;
+    double median_ns  = 0;
+    double min_ns     = 0;
+};
+
+static const char* api2name(testAPI_t API)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return "normal";
+    case API_FORTRAN:
+        return "fortran";
+    case API_COMPAT:
+        return "compat";
+    default:
+        return "invalid";
+    }
+}
+
+// Times batches of calls. The number of calls per batch is doubled until a batch lasts at least
+// min_time seconds; then the requested number of batches is timed. The stream is synchronized
+// after each batch, outside of the timed region, so that any kernels launched by the quick
+// returns do not accumulate.
+static overhead_result time_case(const std::function<hipsolverStatus_t()>& call,
+                                 hipStream_t                               stream,
+                                 double                                    min_time,
+                                 int                                       repetitions)
+{
+    using clock = std::chrono::steady_clock;
+
+    auto run_batch = [&](size_t iterations) {
+        auto start = clock::now();
+        for(size_t i = 0; i < iterations; i++)
+            call();
+        double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        hipStreamSynchronize(stream);
+        return elapsed;
+    };
+
+    overhead_result result;
+    result.iterations = 1;
+    while(run_batch(result.iterations) < min_time && result.iterations < (size_t(1) << 30))
+        result.iterations *= 2;
+
+    std::vector<double> times(std::max(repetitions, 1));
+    for(double& t : times)
+        t = run_batch(result.iterations) * 1e9 / result.iterations;
+
+    std::sort(times.begin(), times.end());
+    result.median_ns = times[times.size() / 2];
+    result.min_ns    = times[0];
+    return result;
+}
+
+// Buffers and parameters shared by the routines. The arrays have room for the largest precision.
+struct overhead_args
+{
+    hipsolverHandle_t     handle;
+    int                   n;
+    int                   ld;
+    void*                 A;
+    int*                  ipiv;
+    int*                  info;
+    int*                  iters;
+    int*                  lwork;
+    hipsolverGesvdjInfo_t gesvdj_params;
+    hipsolverSyevjInfo_t  syevj_params;
+};
+
+// Appends the cases of the routines in the precision of T
+template <typename T>
+static void add_cases(std::vector<overhead_case>& cases, const overhead_args& args)
+{
+    using S = decltype(std::real(T{}));
+
+    const char                  p             = type2char<T>();
+    const hipsolverHandle_t     handle        = args.handle;
+    const int                   n             = args.n;
+    const int                   ld            = args.ld;
+    T* const                    A             = static_cast<T*>(args.A);
+    S* const                    R             = static_cast<S*>(args.A);
+    int* const                  ipiv          = args.ipiv;
+    int* const                  info          = args.info;
+    int* const                  iters         = args.iters;
+    int* const                  lwork         = args.lwork;
+    const hipsolverGesvdjInfo_t gesvdj_params = args.gesvdj_params;
+    const hipsolverSyevjInfo_t  syevj_params  = args.syevj_params;
+    const hipsolverFillMode_t   uplo          = HIPSOLVER_FILL_MODE_UPPER;
+    const hipsolverOperation_t  trans         = HIPSOLVER_OP_N;
+    const hipsolverEigMode_t    jobz          = HIPSOLVER_EIG_MODE_VECTOR;
+
+    // clang-format off
+    const overhead_case routines[] = {
+        {"potrf_bufferSize", p, 3, [=](testAPI_t api) {
+            return hipsolver_potrf_bufferSize(api, handle, uplo, n, A, ld, lwork, 1); }},
+        {"potrf", p, 3, [=](testAPI_t api) {
+            return hipsolver_potrf(api, handle, uplo, n, A, ld, 0, nullptr, 0, info, 1); }},
+        {"potrs", p, 3, [=](testAPI_t api) {
+            return hipsolver_potrs(api, handle, uplo, n, 1, A, ld, 0, A, ld, 0, nullptr, 0,
+                                   info, 1); }},
+        {"potri_bufferSize", p, 2, [=](testAPI_t api) {
+            return hipsolver_potri_bufferSize(api == API_FORTRAN, handle, uplo, n, A, ld,
+                                              lwork); }},
+        {"potri", p, 2, [=](testAPI_t api) {
+            return hipsolver_potri(api == API_FORTRAN, handle, uplo, n, A, ld, 0, nullptr, 0,
+                                   info, 1); }},
+        {"getrf_bufferSize", p, 3, [=](testAPI_t api) {
+            return hipsolver_getrf_bufferSize(api, handle, n, n, A, ld, lwork); }},
+        {"getrf", p, 3, [=](testAPI_t api) {
+            return hipsolver_getrf(api, false, handle, n, n, A, ld, 0, nullptr, 0, ipiv, 0,
+                                   info, 1); }},
+        {"getrs_bufferSize", p, 3, [=](testAPI_t api) {
+            return hipsolver_getrs_bufferSize(api, handle, trans, n, 1, A, ld, ipiv, A, ld,
+                                              lwork); }},
+        {"getrs", p, 3, [=](testAPI_t api) {
+            return hipsolver_getrs(api, handle, trans, n, 1, A, ld, 0, ipiv, 0, A, ld, 0,
+                                   nullptr, 0, info, 1); }},
+        {"gesv", p, 3, [=](testAPI_t api) {
+            return hipsolver_gesv(api, false, handle, n, 1, A, ld, 0, ipiv, 0, A, ld, 0, A, ld,
+                                  0, nullptr, size_t(0), iters, info, 1); }},
+        {"geqrf_bufferSize", p, 2, [=](testAPI_t api) {
+            return hipsolver_geqrf_bufferSize(api == API_FORTRAN, handle, n, n, A, ld,
+                                              lwork); }},
+        {"geqrf", p, 2, [=](testAPI_t api) {
+            return hipsolver_geqrf(api == API_FORTRAN, handle, n, n, A, ld, 0, A, 0, nullptr,
+                                   0, info, 1); }},
+        {"gels", p, 3, [=](testAPI_t api) {
+            return hipsolver_gels(api, false, handle, n, n, 1, A, ld, 0, A, ld, 0, A, ld, 0,
+                                  nullptr, size_t(0), iters, info, 1); }},
+        {"sytrf_bufferSize", p, 2, [=](testAPI_t api) {
+            return hipsolver_sytrf_bufferSize(api == API_FORTRAN, handle, n, A, ld, lwork); }},
+        {"sytrf", p, 2, [=](testAPI_t api) {
+            return hipsolver_sytrf(api == API_FORTRAN, handle, uplo, n, A, ld, 0, ipiv, 0,
+                                   nullptr, 0, info, 1); }},
+        {"gesvd_bufferSize", p, 3, [=](testAPI_t api) {
+            return hipsolver_gesvd_bufferSize(api, false, handle, 'N', 'N', n, n, A, ld, lwork,
+                                              1); }},
+        {"gesvd", p, 3, [=](testAPI_t api) {
+            return hipsolver_gesvd(api, false, false, handle, 'N', 'N', n, n, A, ld, 0, R, 0,
+                                   A, ld, 0, A, ld, 0, nullptr, 0, R, 0, info, 1); }},
+        {"gesvdj_bufferSize", p, 3, [=](testAPI_t api) {
+            return hipsolver_gesvdj_bufferSize(api, false, handle, jobz, 0, n, n, A, ld, R, A,
+                                               ld, A, ld, lwork, gesvdj_params, 1); }},
+        {"gesvdj", p, 3, [=](testAPI_t api) {
+            return hipsolver_gesvdj(api, false, handle, jobz, 0, n, n, A, ld, 0, R, 0, A, ld,
+                                    0, A, ld, 0, nullptr, 0, info, gesvdj_params, 1); }},
+        {"syevd_bufferSize", p, 2, [=](testAPI_t api) {
+            return hipsolver_syevd_heevd_bufferSize(api == API_FORTRAN, handle, jobz, uplo, n,
+                                                    A, ld, R, lwork); }},
+        {"syevd", p, 2, [=](testAPI_t api) {
+            return hipsolver_syevd_heevd(api == API_FORTRAN, handle, jobz, uplo, n, A, ld, 0,
+                                         R, 0, nullptr, 0, info, 1); }},
+        {"syevj_bufferSize", p, 3, [=](testAPI_t api) {
+            return hipsolver_syevj_heevj_bufferSize(api, false, handle, jobz, uplo, n, A, ld,
+                                                    R, lwork, syevj_params, 1); }},
+        {"syevj", p, 3, [=](testAPI_t api) {
+            return hipsolver_syevj_heevj(api, false, handle, jobz, uplo, n, A, ld, 0, R, 0,
+                                         nullptr, 0, info, syevj_params, 1); }},
+    };
+    // clang-format on
+
+    cases.insert(cases.end(), std::begin(routines), std::end(routines));
+}
+
+int main(int argc, char* argv[])
+try
+{
+    int         n;
+    int         pool;
+    int         repetitions;
+    double      min_time;
+    std::string filter;
+    std::string precisions;
+    std::string format;
+
+    // clang-format off
+    options_description desc(help_str);
+    desc.add_options()
+        ("help,h",
+         "Produces this help message.")
+
+        ("n",
+         value<int>(&n)->default_value(0),
+            "Problem size passed to the routines. Values other than 0 should only be used\n"
+            "                           with the stub backend.")
+
+        ("handle_pool",
+         value<int>(&pool)->default_value(0),
+            "Capacity of the handle pool, which affects the cost of create_destroy.")
+
+        ("filter",
+         value<std::string>(&filter)->default_value(""),
+            "Only runs the routines whose name contains this string.")
+
+        ("precision,r",
+         value<std::string>(&precisions)->default_value("sdcz"),
+            "Precisions of the routines, as any combination of s, d, c and z.")
+
+        ("min_time",
+         value<double>(&min_time)->default_value(0.01),
+            "Minimum duration, in seconds, of each timed batch of calls.")
+
+        ("repetitions",
+         value<int>(&repetitions)->default_value(5),
+            "Number of timed batches. The median and minimum time per call are reported.")
+
+        ("output-format",
+         value<std::string>(&format)->default_value("table"),
+            "Format of the results: table or csv.");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(n < 0)
+        throw std::invalid_argument("Invalid value for --n");
+    if(pool < 0)
+        throw std::invalid_argument("Invalid value for --handle_pool");
+    if(precisions.empty() || precisions.find_first_not_of("sdcz") != std::string::npos)
+        throw std::invalid_argument("Invalid value for --precision");
+    if(format != "table" && format != "csv")
+        throw std::invalid_argument("Invalid value for --output-format");
+
+    if(pool > 0)
+        CHECK_ROCBLAS_ERROR(hipsolverHandlePoolSetCapacity(pool));
+
+    hipsolverHandle_t handle;
+    hipStream_t       stream;
+    CHECK_ROCBLAS_ERROR(hipsolverCreate(&handle));
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+
+    hipsolverGesvdjInfo_t gesvdj_params;
+    hipsolverSyevjInfo_t  syevj_params;
+    CHECK_ROCBLAS_ERROR(hipsolverDnCreateGesvdjInfo(&gesvdj_params));
+    CHECK_ROCBLAS_ERROR(hipsolverDnCreateSyevjInfo(&syevj_params));
+
+    // the routines only read the matrices when n > 0, which requires the stub backend, so the
+    // arrays are never dereferenced on the device; info and niters are always written
+    int    ld          = std::max(n, 1);
+    int*   dInts       = nullptr;
+    void*  dA          = nullptr;
+    bool   host_memory = false;
+    size_t nelems      = size_t(ld) * ld;
+    if(hipMalloc(&dInts, sizeof(int) * (ld + 2)) != hipSuccess
+       || hipMalloc(&dA, sizeof(hipsolverDoubleComplex) * nelems) != hipSuccess)
+    {
+        // no device available, as with the stub backend
+        hipFree(dInts);
+        dInts       = static_cast<int*>(calloc(ld + 2, sizeof(int)));
+        dA          = calloc(nelems, sizeof(hipsolverDoubleComplex));
+        host_memory = true;
+    }
+    int lwork;
+
+    overhead_args args = {handle,
+                          n,
+                          ld,
+                          dA,
+                          dInts,
+                          dInts + ld,
+                          dInts + ld + 1,
+                          &lwork,
+                          gesvdj_params,
+                          syevj_params};
+
+    // clang-format off
+    std::vector<overhead_case> cases = {
+        {"create_destroy", '-', 1, [&](testAPI_t api) {
+            hipsolverHandle_t temp;
+            hipsolverStatus_t status = hipsolverCreate(&temp);
+            return status == HIPSOLVER_STATUS_SUCCESS ? hipsolverDestroy(temp) : status; }},
+    };
+    // clang-format on
+    for(char p : precisions)
+    {
+        if(p == 's')
+            add_cases<float>(cases, args);
+        else if(p == 'd')
+            add_cases<double>(cases, args);
+        else if(p == 'c')
+            add_cases<hipsolverComplex>(cases, args);
+        else
+            add_cases<hipsolverDoubleComplex>(cases, args);
+    }
+
+    const testAPI_t apis[] = {API_NORMAL, API_FORTRAN, API_COMPAT};
+
+    if(format == "csv")
+        std::printf("routine,precision,api,status,iterations,median_ns,min_ns\n");
+    else
+        std::printf("%-20s %-9s %-8s %12s %12s %12s\n",
+                    "routine",
+                    "precision",
+                    "api",
+                    "iterations",
+                    "median ns",
+                    "min ns");
+
+    for(const overhead_case& test : cases)
+    {
+        if(test.name.find(filter) == std::string::npos)
+            continue;
+
+        for(int f = 0; f < test.flavors; f++)
+        {
+            testAPI_t api = apis[f];
+
+            // a first call checks that the combination is available and warms up the handle
+            hipsolverStatus_t status = test.call(api);
+            hipStreamSynchronize(stream);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+            {
+                if(format == "csv")
+                    std::printf("%s,%c,%s,%s,,,\n",
+                                test.name.c_str(),
+                                test.precision,
+                                api2name(api),
+                                hipsolver2string_status(status));
+                else
+                    std::printf("%-20s %-9c %-8s %s\n",
+                                test.name.c_str(),
+                                test.precision,
+                                api2name(api),
+                                hipsolver2string_status(status));
+                continue;
+            }
+
+            overhead_result result
+                = time_case([&]() { return test.call(api); }, stream, min_time, repetitions);
+            if(format == "csv")
+                std::printf("%s,%c,%s,%s,%zu,%.1f,%.1f\n",
+                            test.name.c_str(),
+                            test.precision,
+                            api2name(api),
+                            hipsolver2string_status(status),
+                            result.iterations,
+                            result.median_ns,
+                            result.min_ns);
+            else
+                std::printf("%-20s %-9c %-8s %12zu %12.1f %12.1f\n",
+                            test.name.c_str(),
+                            test.precision,
+                            api2name(api),
+                            result.iterations,
+                            result.median_ns,
+                            result.min_ns);
+        }
+    }
+
+    if(host_memory)
+    {
+        free(dInts);
+        free(dA);
+    }
+    else
+    {
+        CHECK_HIP_ERROR(hipFree(dInts));
+        CHECK_HIP_ERROR(hipFree(dA));
+    }
+    CHECK_ROCBLAS_ERROR(hipsolverDnDestroySyevjInfo(syevj_params));
+    CHECK_ROCBLAS_ERROR(hipsolverDnDestroyGesvdjInfo(gesvdj_params));
+    CHECK_ROCBLAS_ERROR(hipsolverDestroy(handle));
+    return 0;
+}
+
+catch(const std::invalid_argument& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    return -1;
+}
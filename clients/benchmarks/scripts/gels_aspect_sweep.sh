@@ -0,0 +1,30 @@
+#!/bin/bash
+
+# Sweeps hipsolver-bench over the aspect ratio m/n of the gels problem, so that the
+# crossover point of the tall-skinny QR path can be located for a given device. Each
+# size is timed twice, with HIPSOLVER_GELS_TSQR forcing the regular path and the
+# tall-skinny path (sizes too small for the tall-skinny path run the regular path twice).
+#
+# Usage: ./gels_aspect_sweep.sh [path to hipsolver-bench] [precision] [n] [nrhs]
+# Output: one line per aspect ratio, with columns m, n, nrhs, and the gpu_time (us) of
+# the regular and tall-skinny paths
+
+BENCH=${1:-./hipsolver-bench}
+PRECISION=${2:-d}
+N=${3:-32}
+NRHS=${4:-1}
+RATIOS="1 2 4 8 16 32 64 128 256 512 1024"
+
+# hipsolver-bench prints its results to stderr; in perf mode the last line is the time
+run_gels() {
+  HIPSOLVER_GELS_TSQR=$1 ${BENCH} -f gels -r ${PRECISION} -m $2 -n ${N} --nrhs ${NRHS} \
+    --lda $2 --ldb $2 --ldx $2 --perf 1 2>&1 | tail -n 1 | tr -d '[:space:]'
+}
+
+echo "m,n,nrhs,regular_gpu_time_us,tsqr_gpu_time_us"
+for ratio in ${RATIOS}; do
+  m=$((ratio * N))
+  regular=$(run_gels off ${m})
+  tsqr=$(run_gels on ${m})
+  echo "${m},${N},${NRHS},${regular},${tsqr}"
+done
@@ -0,0 +1,602 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Tuning benchmark of the SVD and eigensolver methods. For each point of a grid of sizes and
+// batch counts, every method of the family is forced on the handle and timed, and the fastest
+// one is written to a tuning table, which hipsolverLoadTuningTable or the HIPSOLVER_TUNING_FILE
+// environment variable then use to select the method in the default AUTO mode.
+
+#include "../include/clientcommon.hpp"
+#include "../include/hipsolver_datatype2string.hpp"
+#include "../rocblascommon/program_options.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace roc;
+
+// clang-format off
+const char* help_str = R"HELP_STR(
+hipSOLVER tuning benchmark help.
+
+Usage: ./hipsolver-tune <options>
+
+Times the methods of the SVD and eigensolver families over a grid of sizes and batch counts,
+and writes the fastest method of each point to a tuning table:
+
+  gesvd    outofplace and inplace, timed with hipsolverXgesvd (batch_count = 1) and
+           hipsolverXgesvdStridedBatched; the same methods serve gesvdj,
+  syevd    dc (divide and conquer) and qr (QR iteration), timed with hipsolverXsyevd or
+           hipsolverXheevd (batch_count = 1) and hipsolverDnXsyevjBatched or
+           hipsolverDnXheevjBatched; the same methods serve syevj and heevj.
+
+On the rocSOLVER backend, gesvdj and syevj/heevj are computed by the same rocSOLVER functions
+as gesvd and syevd/heevd, so they have no methods of their own to tune.
+
+The table is loaded with hipsolverLoadTuningTable, or for all the handles of a process with
+the HIPSOLVER_TUNING_FILE environment variable. The methods are only selectable on the
+rocSOLVER backend.
+
+Example: ./hipsolver-tune --families gesvd,syevd --sizes 16,64,256 --batch_counts 1,64
+)HELP_STR";
+// clang-format on
+
+using tune_call = std::function<hipsolverStatus_t()>;
+
+// Runs reset (untimed) and call iterations times, and returns the median time of call in
+// microseconds, or a negative value if a call failed
+static double
+    time_call(const tune_call& reset, const tune_call& call, hipStream_t stream, int iterations)
+{
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+
+    std::vector<double> times;
+    for(int i = 0; i < iterations + 1; i++)
+    {
+        if(reset() != HIPSOLVER_STATUS_SUCCESS)
+            break;
+
+        CHECK_HIP_ERROR(hipEventRecord(start, stream));
+        if(call() != HIPSOLVER_STATUS_SUCCESS)
+            break;
+        CHECK_HIP_ERROR(hipEventRecord(stop, stream));
+        CHECK_HIP_ERROR(hipEventSynchronize(stop));
+
+        // the first call, which allocates the workspace of the handle, is not timed
+        float ms;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+        if(i > 0)
+            times.push_back(ms * 1000.0);
+    }
+
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+
+    if(times.size() < size_t(iterations))
+        return -1;
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+// Parses a comma-separated list of positive integers
+static std::vector<int> parse_list(const std::string& list, const char* option)
+{
+    std::vector<int>  values;
+    std::stringstream stream(list);
+    std::string       item;
+    while(std::getline(stream, item, ','))
+    {
+        int value = std::atoi(item.c_str());
+        if(value < 1)
+            throw std::invalid_argument(std::string("Invalid value for ") + option);
+        values.push_back(value);
+    }
+    if(values.empty())
+        throw std::invalid_argument(std::string("Invalid value for ") + option);
+    return values;
+}
+
+/******************** GESVD ********************/
+static hipsolverStatus_t gesvd(hipsolverHandle_t handle,
+                               int               m,
+                               int               n,
+                               float*            A,
+                               float*            S,
+                               float*            U,
+                               float*            V,
+                               int*              info,
+                               int               bc)
+{
+    int k = std::min(m, n);
+    if(bc == 1)
+        return hipsolverSgesvd(
+            handle, 'S', 'S', m, n, A, m, S, U, m, V, k, nullptr, 0, nullptr, info);
+    return hipsolverSgesvdStridedBatched(handle,
+                                         'S',
+                                         'S',
+                                         m,
+                                         n,
+                                         A,
+                                         m,
+                                         m * n,
+                                         S,
+                                         k,
+                                         U,
+                                         m,
+                                         m * k,
+                                         V,
+                                         k,
+                                         k * n,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         info,
+                                         bc);
+}
+
+static hipsolverStatus_t gesvd(hipsolverHandle_t handle,
+                               int               m,
+                               int               n,
+                               double*           A,
+                               double*           S,
+                               double*           U,
+                               double*           V,
+                               int*              info,
+                               int               bc)
+{
+    int k = std::min(m, n);
+    if(bc == 1)
+        return hipsolverDgesvd(
+            handle, 'S', 'S', m, n, A, m, S, U, m, V, k, nullptr, 0, nullptr, info);
+    return hipsolverDgesvdStridedBatched(handle,
+                                         'S',
+                                         'S',
+                                         m,
+                                         n,
+                                         A,
+                                         m,
+                                         m * n,
+                                         S,
+                                         k,
+                                         U,
+                                         m,
+                                         m * k,
+                                         V,
+                                         k,
+                                         k * n,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         info,
+                                         bc);
+}
+
+static hipsolverStatus_t gesvd(hipsolverHandle_t handle,
+                               int               m,
+                               int               n,
+                               hipsolverComplex* A,
+                               float*            S,
+                               hipsolverComplex* U,
+                               hipsolverComplex* V,
+                               int*              info,
+                               int               bc)
+{
+    int k = std::min(m, n);
+    if(bc == 1)
+        return hipsolverCgesvd(handle,
+                               'S',
+                               'S',
+                               m,
+                               n,
+                               (hipFloatComplex*)A,
+                               m,
+                               S,
+                               (hipFloatComplex*)U,
+                               m,
+                               (hipFloatComplex*)V,
+                               k,
+                               nullptr,
+                               0,
+                               nullptr,
+                               info);
+    return hipsolverCgesvdStridedBatched(handle,
+                                         'S',
+                                         'S',
+                                         m,
+                                         n,
+                                         (hipFloatComplex*)A,
+                                         m,
+                                         m * n,
+                                         S,
+                                         k,
+                                         (hipFloatComplex*)U,
+                                         m,
+                                         m * k,
+                                         (hipFloatComplex*)V,
+                                         k,
+                                         k * n,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         info,
+                                         bc);
+}
+
+static hipsolverStatus_t gesvd(hipsolverHandle_t       handle,
+                               int                     m,
+                               int                     n,
+                               hipsolverDoubleComplex* A,
+                               double*                 S,
+                               hipsolverDoubleComplex* U,
+                               hipsolverDoubleComplex* V,
+                               int*                    info,
+                               int                     bc)
+{
+    int k = std::min(m, n);
+    if(bc == 1)
+        return hipsolverZgesvd(handle,
+                               'S',
+                               'S',
+                               m,
+                               n,
+                               (hipDoubleComplex*)A,
+                               m,
+                               S,
+                               (hipDoubleComplex*)U,
+                               m,
+                               (hipDoubleComplex*)V,
+                               k,
+                               nullptr,
+                               0,
+                               nullptr,
+                               info);
+    return hipsolverZgesvdStridedBatched(handle,
+                                         'S',
+                                         'S',
+                                         m,
+                                         n,
+                                         (hipDoubleComplex*)A,
+                                         m,
+                                         m * n,
+                                         S,
+                                         k,
+                                         (hipDoubleComplex*)U,
+                                         m,
+                                         m * k,
+                                         (hipDoubleComplex*)V,
+                                         k,
+                                         k * n,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         info,
+                                         bc);
+}
+
+/******************** SYEVD ********************/
+static hipsolverStatus_t syevd(hipsolverHandle_t    handle,
+                               int                  n,
+                               float*               A,
+                               float*               D,
+                               int*                 info,
+                               hipsolverSyevjInfo_t params,
+                               int                  bc)
+{
+    const hipsolverEigMode_t  jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    const hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_UPPER;
+    if(bc == 1)
+        return hipsolverSsyevd(handle, jobz, uplo, n, A, n, D, nullptr, 0, info);
+    return hipsolverDnSsyevjBatched(handle, jobz, uplo, n, A, n, D, nullptr, 0, info, params, bc);
+}
+
+static hipsolverStatus_t syevd(hipsolverHandle_t    handle,
+                               int                  n,
+                               double*              A,
+                               double*              D,
+                               int*                 info,
+                               hipsolverSyevjInfo_t params,
+                               int                  bc)
+{
+    const hipsolverEigMode_t  jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    const hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_UPPER;
+    if(bc == 1)
+        return hipsolverDsyevd(handle, jobz, uplo, n, A, n, D, nullptr, 0, info);
+    return hipsolverDnDsyevjBatched(handle, jobz, uplo, n, A, n, D, nullptr, 0, info, params, bc);
+}
+
+static hipsolverStatus_t syevd(hipsolverHandle_t    handle,
+                               int                  n,
+                               hipsolverComplex*    A,
+                               float*               D,
+                               int*                 info,
+                               hipsolverSyevjInfo_t params,
+                               int                  bc)
+{
+    const hipsolverEigMode_t  jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    const hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_UPPER;
+    if(bc == 1)
+        return hipsolverCheevd(handle, jobz, uplo, n, (hipFloatComplex*)A, n, D, nullptr, 0, info);
+    return hipsolverDnCheevjBatched(
+        handle, jobz, uplo, n, (hipFloatComplex*)A, n, D, nullptr, 0, info, params, bc);
+}
+
+static hipsolverStatus_t syevd(hipsolverHandle_t       handle,
+                               int                     n,
+                               hipsolverDoubleComplex* A,
+                               double*                 D,
+                               int*                    info,
+                               hipsolverSyevjInfo_t    params,
+                               int                     bc)
+{
+    const hipsolverEigMode_t  jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    const hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_UPPER;
+    if(bc == 1)
+        return hipsolverZheevd(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, n, D, nullptr, 0, info);
+    return hipsolverDnZheevjBatched(
+        handle, jobz, uplo, n, (hipDoubleComplex*)A, n, D, nullptr, 0, info, params, bc);
+}
+
+/******************** TUNING ********************/
+struct tune_method
+{
+    const char* name;
+    int         alg;
+};
+
+static const tune_method gesvd_methods[]
+    = {{"outofplace", HIPSOLVER_SVD_ALG_OUTOFPLACE}, {"inplace", HIPSOLVER_SVD_ALG_INPLACE}};
+static const tune_method syevd_methods[]
+    = {{"dc", HIPSOLVER_EIG_ALG_DC}, {"qr", HIPSOLVER_EIG_ALG_QR}};
+
+// Times the methods of family on one point of the grid, and writes the fastest one to table
+template <typename T>
+static void tune_point(hipsolverHandle_t    handle,
+                       hipStream_t          stream,
+                       hipsolverSyevjInfo_t params,
+                       const std::string&   family,
+                       char                 precision,
+                       int                  m,
+                       int                  n,
+                       int                  bc,
+                       int                  iterations,
+                       std::ofstream&       table)
+{
+    using S = decltype(std::real(T{}));
+
+    const bool   svd   = (family == "gesvd");
+    const int    k     = std::min(m, n);
+    const size_t sizeA = size_t(m) * n;
+
+    // well-conditioned real matrices, symmetric (hence also Hermitian) for syevd
+    std::vector<T> hA(sizeA * bc);
+    for(int b = 0; b < bc; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                int off = svd ? (i + b) % 5 : b % 5;
+                hA[b * sizeA + i + size_t(j) * m]
+                    = (i == j) ? T(n) : T(S(1) / (1 + std::abs(i - j) + off));
+            }
+
+    std::vector<void*> allocations;
+    auto               device = [&](size_t bytes) {
+        void* ptr;
+        CHECK_HIP_ERROR(hipMalloc(&ptr, std::max<size_t>(bytes, 1)));
+        allocations.push_back(ptr);
+        return ptr;
+    };
+
+    T*   dA    = (T*)device(sizeof(T) * hA.size());
+    T*   dA0   = (T*)device(sizeof(T) * hA.size());
+    S*   dS    = (S*)device(sizeof(S) * k * bc);
+    T*   dU    = svd ? (T*)device(sizeof(T) * m * k * bc) : nullptr;
+    T*   dV    = svd ? (T*)device(sizeof(T) * k * n * bc) : nullptr;
+    int* dinfo = (int*)device(sizeof(int) * bc);
+    CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+
+    // the computations overwrite A, which is restored before each call
+    auto reset = [&]() {
+        return hipMemcpyAsync(dA, dA0, sizeof(T) * hA.size(), hipMemcpyDeviceToDevice, stream)
+                       == hipSuccess
+                   ? HIPSOLVER_STATUS_SUCCESS
+                   : HIPSOLVER_STATUS_INTERNAL_ERROR;
+    };
+    auto call = [&]() {
+        return svd ? gesvd(handle, m, n, dA, dS, dU, dV, dinfo, bc)
+                   : syevd(handle, n, dA, dS, dinfo, params, bc);
+    };
+
+    const tune_method* methods = svd ? gesvd_methods : syevd_methods;
+    const tune_method* best    = nullptr;
+    double             t_best  = 0;
+    std::string        comment;
+    for(int i = 0; i < 2; i++)
+    {
+        hipsolverStatus_t status
+            = svd ? hipsolverSetSvdAlg(handle, (hipsolverSvdAlg_t)methods[i].alg)
+                  : hipsolverSetEigAlg(handle, (hipsolverEigAlg_t)methods[i].alg);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            throw std::invalid_argument("The methods are not selectable on this backend");
+
+        double t = time_call(reset, call, stream, iterations);
+
+        char buffer[64];
+        if(t < 0)
+            std::snprintf(buffer, sizeof(buffer), " %s failed", methods[i].name);
+        else
+            std::snprintf(buffer, sizeof(buffer), " %s %.1f us", methods[i].name, t);
+        comment += buffer;
+
+        if(t >= 0 && (!best || t < t_best))
+        {
+            best   = &methods[i];
+            t_best = t;
+        }
+    }
+
+    // the handle is back in AUTO mode for the next point
+    CHECK_ROCBLAS_ERROR(svd ? hipsolverSetSvdAlg(handle, HIPSOLVER_SVD_ALG_AUTO)
+                            : hipsolverSetEigAlg(handle, HIPSOLVER_EIG_ALG_AUTO));
+
+    std::printf("%-6s %c %6d %6d %8d  %-10s #%s\n",
+                family.c_str(),
+                precision,
+                m,
+                n,
+                bc,
+                best ? best->name : "-",
+                comment.c_str());
+    if(best)
+        table << family << ' ' << precision << ' ' << m << ' ' << n << ' ' << bc << ' '
+              << best->name << " #" << comment << '\n';
+
+    for(void* ptr : allocations)
+        CHECK_HIP_ERROR(hipFree(ptr));
+}
+
+int main(int argc, char* argv[])
+try
+{
+    std::string families;
+    std::string precisions;
+    std::string sizes;
+    std::string batch_counts;
+    std::string output;
+    int         iterations;
+
+    // clang-format off
+    options_description desc(help_str);
+    desc.add_options()
+        ("help,h",
+         "Produces this help message.")
+
+        ("families",
+         value<std::string>(&families)->default_value("gesvd,syevd"),
+            "Comma-separated families to tune: gesvd and syevd.")
+
+        ("precisions",
+         value<std::string>(&precisions)->default_value("sdcz"),
+            "Precisions to tune: any of s, d, c and z.")
+
+        ("sizes",
+         value<std::string>(&sizes)->default_value("16,64,256,1024"),
+            "Comma-separated sizes. gesvd is tuned on all the pairs of sizes as m and n, and "
+            "syevd on the square matrices.")
+
+        ("batch_counts",
+         value<std::string>(&batch_counts)->default_value("1,64"),
+            "Comma-separated batch counts.")
+
+        ("output",
+         value<std::string>(&output)->default_value("hipsolver_tuning.txt"),
+            "Tuning table to write.")
+
+        ("iterations",
+         value<int>(&iterations)->default_value(5),
+            "Number of timed calls of each method.");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    std::vector<std::string> family_list;
+    {
+        std::stringstream stream(families);
+        std::string       item;
+        while(std::getline(stream, item, ','))
+        {
+            if(item != "gesvd" && item != "syevd")
+                throw std::invalid_argument("Invalid value for --families");
+            family_list.push_back(item);
+        }
+    }
+    if(family_list.empty())
+        throw std::invalid_argument("Invalid value for --families");
+    if(precisions.empty() || precisions.find_first_not_of("sdcz") != std::string::npos)
+        throw std::invalid_argument("Invalid value for --precisions");
+    std::vector<int> size_list  = parse_list(sizes, "--sizes");
+    std::vector<int> batch_list = parse_list(batch_counts, "--batch_counts");
+    if(iterations < 1)
+        throw std::invalid_argument("Invalid value for --iterations");
+
+    std::ofstream table(output);
+    if(!table)
+        throw std::invalid_argument("Cannot write --output");
+    table << "# hipSOLVER tuning table, written by hipsolver-tune\n"
+          << "# family precision m n batch_count method\n";
+
+    hipsolverHandle_t    handle;
+    hipStream_t          stream;
+    hipsolverSyevjInfo_t params;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(hipsolverCreate(&handle));
+    CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, stream));
+    CHECK_ROCBLAS_ERROR(hipsolverDnCreateSyevjInfo(&params));
+
+    // the methods are timed without any table attached to the handle
+    CHECK_ROCBLAS_ERROR(hipsolverLoadTuningTable(handle, nullptr));
+
+    std::printf("%-6s %c %6s %6s %8s  %-10s\n", "family", 'p', "m", "n", "batch", "method");
+    for(const std::string& family : family_list)
+        for(char precision : precisions)
+            for(int m : size_list)
+                for(int n : size_list)
+                    for(int bc : batch_list)
+                    {
+                        if(family == "syevd" && m != n)
+                            continue;
+
+                        auto tune = tune_point<float>;
+                        if(precision == 'd')
+                            tune = tune_point<double>;
+                        else if(precision == 'c')
+                            tune = tune_point<hipsolverComplex>;
+                        else if(precision == 'z')
+                            tune = tune_point<hipsolverDoubleComplex>;
+
+                        tune(handle,
+                             stream,
+                             params,
+                             family,
+                             precision,
+                             m,
+                             n,
+                             bc,
+                             iterations,
+                             table);
+                    }
+
+    std::printf("Tuning table written to %s\n", output.c_str());
+
+    CHECK_ROCBLAS_ERROR(hipsolverDnDestroySyevjInfo(params));
+    CHECK_ROCBLAS_ERROR(hipsolverDestroy(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return 0;
+}
+
+catch(const std::invalid_argument& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    return -1;
+}
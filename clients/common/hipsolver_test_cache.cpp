@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "../include/hipsolver_test_cache.hpp"
+#include "hipsolver.h"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Layout of the entries: a header followed by the outputs, in the order they were added
+struct hipsolver_test_cache_header
+{
+    char     magic[8];
+    uint64_t key;
+    uint64_t bytes;
+    uint64_t hash;
+};
+
+static const char     cache_magic[8] = {'H', 'I', 'P', 'S', 'O', 'L', 'C', '1'};
+static const uint64_t fnv_offset     = 0xcbf29ce484222325ull;
+static const uint64_t fnv_prime      = 0x100000001b3ull;
+
+const char* hipsolver_test_cache::directory()
+{
+#ifdef _WIN32
+    // the cache is only supported on Linux
+    return nullptr;
+#else
+    static const char* dir = [] {
+        const char* env = getenv("HIPSOLVER_TEST_CACHE");
+        return env && *env ? env : nullptr;
+    }();
+    return dir;
+#endif
+}
+
+// FNV-1a over 64-bit words, followed by the remaining bytes
+uint64_t hipsolver_test_cache::hash(uint64_t seed, const void* data, size_t bytes)
+{
+    const char* p = static_cast<const char*>(data);
+    uint64_t    h = seed;
+
+    size_t words = bytes / sizeof(uint64_t);
+    for(size_t i = 0; i < words; i++)
+    {
+        uint64_t w;
+        memcpy(&w, p + i * sizeof(uint64_t), sizeof(uint64_t));
+        h = (h ^ w) * fnv_prime;
+    }
+    for(size_t i = words * sizeof(uint64_t); i < bytes; i++)
+        h = (h ^ uint8_t(p[i])) * fnv_prime;
+
+    return h;
+}
+
+hipsolver_test_cache::hipsolver_test_cache(const std::string& routine)
+    : m_routine(routine)
+    , m_key(fnv_offset)
+{
+    // the library version is part of the key, so the entries of other versions are never used
+    int version[] = {hipsolverVersionMajor, hipsolverVersionMinor, hipsolverVersionPatch};
+    hash(cache_magic, sizeof(cache_magic));
+    hash(version, sizeof(version));
+    hash(routine.data(), routine.size());
+}
+
+void hipsolver_test_cache::hash(const void* data, size_t bytes)
+{
+    if(directory())
+        m_key = hash(m_key, data, bytes);
+}
+
+void hipsolver_test_cache::add_output(void* data, size_t bytes)
+{
+    m_outputs.push_back({data, bytes});
+}
+
+std::string hipsolver_test_cache::path() const
+{
+    std::stringstream ss;
+    ss << directory() << '/' << m_routine << '-' << std::hex << m_key << ".bin";
+    return ss.str();
+}
+
+bool hipsolver_test_cache::load()
+{
+#ifndef _WIN32
+    if(!directory())
+        return false;
+
+    int fd = open(path().c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+
+    size_t total = 0;
+    for(auto& out : m_outputs)
+        total += out.bytes;
+
+    struct stat st;
+    bool        valid = fstat(fd, &st) == 0
+                 && size_t(st.st_size) == sizeof(hipsolver_test_cache_header) + total;
+    void* map = valid ? mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if(map == MAP_FAILED)
+        return false;
+
+    // the entry is only used if it matches the key and the hash of its contents
+    hipsolver_test_cache_header header;
+    const char*                 data = static_cast<const char*>(map) + sizeof(header);
+    uint64_t                    h    = fnv_offset;
+    memcpy(&header, map, sizeof(header));
+    for(size_t offset = 0, i = 0; i < m_outputs.size(); offset += m_outputs[i++].bytes)
+        h = hash(h, data + offset, m_outputs[i].bytes);
+    valid = memcmp(header.magic, cache_magic, sizeof(cache_magic)) == 0 && header.key == m_key
+            && header.bytes == total && header.hash == h;
+
+    if(valid)
+    {
+        for(auto& out : m_outputs)
+        {
+            memcpy(out.data, data, out.bytes);
+            data += out.bytes;
+        }
+    }
+
+    munmap(map, st.st_size);
+    return valid;
+#else
+    return false;
+#endif
+}
+
+void hipsolver_test_cache::store()
+{
+#ifndef _WIN32
+    if(!directory())
+        return;
+
+    hipsolver_test_cache_header header;
+    memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.key   = m_key;
+    header.bytes = 0;
+    header.hash  = fnv_offset;
+    for(auto& out : m_outputs)
+    {
+        header.bytes += out.bytes;
+        header.hash = hash(header.hash, out.data, out.bytes);
+    }
+
+    // the entry is written to a temporary file and then renamed, so that concurrent test
+    // processes never see a partial entry
+    std::string path     = this->path();
+    std::string tmp_path = path + ".tmp" + std::to_string(getpid());
+    FILE*       file     = fopen(tmp_path.c_str(), "wb");
+    if(!file)
+        return;
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    for(auto& out : m_outputs)
+        ok = ok && (out.bytes == 0 || fwrite(out.data, out.bytes, 1, file) == 1);
+    ok = (fclose(file) == 0) && ok;
+
+    if(!ok || rename(tmp_path.c_str(), path.c_str()) != 0)
+        remove(tmp_path.c_str());
+#endif
+}
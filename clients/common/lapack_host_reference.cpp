@@ -3,6 +3,7 @@
  * ************************************************************************/
 
 #include "../include/lapack_host_reference.hpp"
+#include "../include/utility.hpp"
 #include "cblas.h"
 #include "hipsolver.h"
 
@@ -11,6 +12,14 @@
  * only used for testing, not part of the GPU library
  */
 
+/*************************************************************************/
+// Batches
+
+void cblas_batched(int bc, const std::function<void(int)>& func)
+{
+    hipsolver_parallel_for(bc, [&](size_t b) { func(int(b)); });
+}
+
 /*************************************************************************/
 // These are C wrapper calls to CBLAS and fortran LAPACK
 
@@ -548,6 +557,53 @@ void zgetrs_(char*                   trans,
              int*                    ldb,
              int*                    info);
 
+void sgtsv_(int* n, int* nrhs, float* dl, float* d, float* du, float* B, int* ldb, int* info);
+void dgtsv_(int* n, int* nrhs, double* dl, double* d, double* du, double* B, int* ldb, int* info);
+void cgtsv_(int*              n,
+            int*              nrhs,
+            hipsolverComplex* dl,
+            hipsolverComplex* d,
+            hipsolverComplex* du,
+            hipsolverComplex* B,
+            int*              ldb,
+            int*              info);
+void zgtsv_(int*                    n,
+            int*                    nrhs,
+            hipsolverDoubleComplex* dl,
+            hipsolverDoubleComplex* d,
+            hipsolverDoubleComplex* du,
+            hipsolverDoubleComplex* B,
+            int*                    ldb,
+            int*                    info);
+
+void spbtrf_(char* uplo, int* n, int* kd, float* AB, int* ldab, int* info);
+void dpbtrf_(char* uplo, int* n, int* kd, double* AB, int* ldab, int* info);
+void cpbtrf_(char* uplo, int* n, int* kd, hipsolverComplex* AB, int* ldab, int* info);
+void zpbtrf_(char* uplo, int* n, int* kd, hipsolverDoubleComplex* AB, int* ldab, int* info);
+
+void spbtrs_(
+    char* uplo, int* n, int* kd, int* nrhs, float* AB, int* ldab, float* B, int* ldb, int* info);
+void dpbtrs_(
+    char* uplo, int* n, int* kd, int* nrhs, double* AB, int* ldab, double* B, int* ldb, int* info);
+void cpbtrs_(char*             uplo,
+             int*              n,
+             int*              kd,
+             int*              nrhs,
+             hipsolverComplex* AB,
+             int*              ldab,
+             hipsolverComplex* B,
+             int*              ldb,
+             int*              info);
+void zpbtrs_(char*                   uplo,
+             int*                    n,
+             int*                    kd,
+             int*                    nrhs,
+             hipsolverDoubleComplex* AB,
+             int*                    ldab,
+             hipsolverDoubleComplex* B,
+             int*                    ldb,
+             int*                    info);
+
 void spotrf_(char* uplo, int* m, float* A, int* lda, int* info);
 void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipsolverComplex* A, int* lda, int* info);
@@ -1818,6 +1874,127 @@ void cblas_getrs<hipsolverDoubleComplex>(hipsolverOperation_t    trans,
     zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
 }
 
+// gtsv
+template <>
+void cblas_gtsv<float>(
+    int n, int nrhs, float* dl, float* d, float* du, float* B, int ldb, int* info)
+{
+    sgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cblas_gtsv<double>(
+    int n, int nrhs, double* dl, double* d, double* du, double* B, int ldb, int* info)
+{
+    dgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cblas_gtsv<hipsolverComplex>(int               n,
+                                  int               nrhs,
+                                  hipsolverComplex* dl,
+                                  hipsolverComplex* d,
+                                  hipsolverComplex* du,
+                                  hipsolverComplex* B,
+                                  int               ldb,
+                                  int*              info)
+{
+    cgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cblas_gtsv<hipsolverDoubleComplex>(int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* dl,
+                                        hipsolverDoubleComplex* d,
+                                        hipsolverDoubleComplex* du,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int*                    info)
+{
+    zgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+// pbtrf
+template <>
+void cblas_pbtrf<float>(hipsolverFillMode_t uplo, int n, int kd, float* AB, int ldab, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    spbtrf_(&uploC, &n, &kd, AB, &ldab, info);
+}
+
+template <>
+void cblas_pbtrf<double>(hipsolverFillMode_t uplo, int n, int kd, double* AB, int ldab, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    dpbtrf_(&uploC, &n, &kd, AB, &ldab, info);
+}
+
+template <>
+void cblas_pbtrf<hipsolverComplex>(
+    hipsolverFillMode_t uplo, int n, int kd, hipsolverComplex* AB, int ldab, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    cpbtrf_(&uploC, &n, &kd, AB, &ldab, info);
+}
+
+template <>
+void cblas_pbtrf<hipsolverDoubleComplex>(
+    hipsolverFillMode_t uplo, int n, int kd, hipsolverDoubleComplex* AB, int ldab, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    zpbtrf_(&uploC, &n, &kd, AB, &ldab, info);
+}
+
+// pbtrs
+template <>
+void cblas_pbtrs<float>(
+    hipsolverFillMode_t uplo, int n, int kd, int nrhs, float* AB, int ldab, float* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    spbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
+template <>
+void cblas_pbtrs<double>(
+    hipsolverFillMode_t uplo, int n, int kd, int nrhs, double* AB, int ldab, double* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    dpbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
+template <>
+void cblas_pbtrs<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   int                 kd,
+                                   int                 nrhs,
+                                   hipsolverComplex*   AB,
+                                   int                 ldab,
+                                   hipsolverComplex*   B,
+                                   int                 ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    cpbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
+template <>
+void cblas_pbtrs<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     kd,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* AB,
+                                         int                     ldab,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    zpbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
 // potrf
 template <>
 void cblas_potrf<float>(hipsolverFillMode_t uplo, int n, float* A, int lda, int* info)
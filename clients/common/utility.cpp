@@ -1,14 +1,22 @@
 /* ************************************************************************
- * Copyright 2020-2021 Advanced Micro Devices, Inc.
+ * Copyright 2020-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
 
 #include "hipsolver.h"
 #include "utility.hpp"
 
 hipsolver_rng_t hipsolver_rng(69069);
 hipsolver_rng_t hipsolver_seed(hipsolver_rng);
+uint64_t        hipsolver_random_key = 0;
 
 template <>
 char type2char<float>()
@@ -152,3 +160,207 @@ void set_device(int device_id)
 #ifdef __cplusplus
 }
 #endif
+
+/* ============================================================================================ */
+/*  timing statistics */
+
+hipsolver_time_stats::hipsolver_time_stats(std::vector<double> times)
+{
+    samples = times.size();
+    if(samples == 0)
+        return;
+
+    std::sort(times.begin(), times.end());
+
+    // percentiles use the nearest-rank method
+    auto percentile = [&](double p) {
+        size_t rank = size_t(std::ceil(p / 100 * samples));
+        return times[std::max(rank, size_t(1)) - 1];
+    };
+
+    double sum = 0, sum_sq = 0;
+    for(double t : times)
+        sum += t;
+    mean = sum / samples;
+    for(double t : times)
+        sum_sq += (t - mean) * (t - mean);
+
+    min    = times.front();
+    median = percentile(50);
+    p95    = percentile(95);
+    p99    = percentile(99);
+    stddev = samples > 1 ? std::sqrt(sum_sq / (samples - 1)) : 0;
+}
+
+hipsolver_perf_timer::hipsolver_perf_timer(hipStream_t stream)
+    : m_stream(stream)
+{
+    hipEventCreate(&m_start);
+    hipEventCreate(&m_stop);
+}
+
+hipsolver_perf_timer::~hipsolver_perf_timer()
+{
+    hipEventDestroy(m_start);
+    hipEventDestroy(m_stop);
+}
+
+bool hipsolver_perf_timer::more(int iter, int hot_calls) const
+{
+    double budget = hipsolver_bench_timing::get().time_budget;
+    if(budget > 0)
+        return iter == 0 || m_elapsed < budget * 1000;
+    else
+        return iter < hot_calls;
+}
+
+void hipsolver_perf_timer::start()
+{
+    m_wall_start = get_time_us_sync(m_stream);
+    hipEventRecord(m_start, m_stream);
+}
+
+void hipsolver_perf_timer::stop()
+{
+    float device_ms = 0;
+    hipEventRecord(m_stop, m_stream);
+    double wall = get_time_us_sync(m_stream) - m_wall_start;
+    hipEventSynchronize(m_stop);
+    hipEventElapsedTime(&device_ms, m_start, m_stop);
+
+    m_wall.push_back(wall);
+    m_device.push_back(device_ms * 1000.0);
+    m_elapsed += wall;
+}
+
+double hipsolver_perf_timer::finish()
+{
+    hipsolver_bench_timing& timing = hipsolver_bench_timing::get();
+    timing.wall                    = hipsolver_time_stats(m_wall);
+    timing.device                  = hipsolver_time_stats(m_device);
+    return timing.wall.mean;
+}
+
+/* ============================================================================================ */
+/*  host threads */
+
+int& hipsolver_host_threads()
+{
+    static int threads = [] {
+        const char* env = getenv("HIPSOLVER_CPU_THREADS");
+        int         n   = env ? atoi(env) : 0;
+        return n > 0 ? n : std::max(1, int(std::thread::hardware_concurrency()));
+    }();
+    return threads;
+}
+
+namespace
+{
+    // set on the threads that are running a loop of hipsolver_parallel_for, so that nested loops
+    // run serially instead of waiting for the workers they are running on
+    thread_local bool in_parallel_for = false;
+
+    // Worker threads kept between the calls to hipsolver_parallel_for. Each loop is a job; the
+    // first `wanted` workers take part in it together with the calling thread, and every thread
+    // takes the next index as soon as it is free.
+    class hipsolver_thread_pool
+    {
+        std::mutex                         m_call;
+        std::mutex                         m_mutex;
+        std::condition_variable            m_wake;
+        std::condition_variable            m_idle;
+        std::vector<std::thread>           m_workers;
+        const std::function<void(size_t)>* m_func = nullptr;
+        size_t                             m_n    = 0;
+        std::atomic<size_t>                m_next{0};
+        size_t                             m_wanted  = 0;
+        size_t                             m_running = 0;
+        uint64_t                           m_job     = 0;
+        bool                               m_stop    = false;
+
+        void run()
+        {
+            for(size_t i = m_next++; i < m_n; i = m_next++)
+                (*m_func)(i);
+        }
+
+        void work(size_t id, uint64_t job)
+        {
+            in_parallel_for = true;
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(true)
+            {
+                m_wake.wait(lock, [&] { return m_stop || m_job != job; });
+                if(m_stop)
+                    return;
+                job = m_job;
+                if(id >= m_wanted)
+                    continue;
+
+                lock.unlock();
+                run();
+                lock.lock();
+                if(--m_running == 0)
+                    m_idle.notify_one();
+            }
+        }
+
+    public:
+        ~hipsolver_thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for(auto& w : m_workers)
+                w.join();
+        }
+
+        void parallel_for(size_t threads, size_t n, const std::function<void(size_t)>& func)
+        {
+            std::lock_guard<std::mutex> call(m_call);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                while(m_workers.size() < threads - 1)
+                    m_workers.emplace_back(
+                        &hipsolver_thread_pool::work, this, m_workers.size(), m_job);
+
+                m_func    = &func;
+                m_n       = n;
+                m_next    = 0;
+                m_wanted  = threads - 1;
+                m_running = m_wanted;
+                m_job++;
+            }
+            m_wake.notify_all();
+
+            in_parallel_for = true;
+            run();
+            in_parallel_for = false;
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idle.wait(lock, [&] { return m_running == 0; });
+        }
+    };
+
+    hipsolver_thread_pool& thread_pool()
+    {
+        static hipsolver_thread_pool pool;
+        return pool;
+    }
+}
+
+void hipsolver_parallel_for(size_t n, const std::function<void(size_t)>& func)
+{
+    size_t threads = std::min(size_t(hipsolver_host_threads()), n);
+    if(threads <= 1 || in_parallel_for)
+    {
+        for(size_t i = 0; i < n; ++i)
+            func(i);
+        return;
+    }
+
+    thread_pool().parallel_for(threads, n, func);
+}
@@ -33,6 +33,9 @@ const vector<gels_params_A> matrix_sizeA_range = {
     {20, 20, 20, 20},
     {30, 20, 40, 30},
     {40, 20, 40, 40},
+    // tall-skinny samples
+    {2048, 16, 2048, 2048},
+    {2100, 12, 2100, 2100},
 };
 const vector<int> matrix_sizeB_range = {
     // invalid
@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqrf_vbatched.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> geqrf_vbatched_tuple;
+
+// each matrix_size_range vector is a {m, lda}
+// the sizes are the largest of the batch; the other problems are smaller
+
+// case when m = -1 and n = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {32, 32},
+    {50, 50},
+    {70, 100},
+};
+
+const vector<int> n_size_range = {
+    // invalid
+    -1,
+    // normal (valid) samples
+    16,
+    20,
+    40,
+    100,
+};
+
+Arguments geqrf_vbatched_setup_arguments(geqrf_vbatched_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int         n_size      = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<int>("m", matrix_size[0]);
+    arg.set<int>("lda", matrix_size[1]);
+
+    arg.set<int>("n", n_size);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class GEQRF_VBATCHED_BASE : public ::TestWithParam<geqrf_vbatched_tuple>
+{
+protected:
+    GEQRF_VBATCHED_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = geqrf_vbatched_setup_arguments(GetParam());
+
+        if(arg.peek<int>("m") == -1 && arg.peek<int>("n") == -1)
+            testing_geqrf_vbatched_bad_arg<API, T>();
+
+        arg.batch_count = 5;
+        testing_geqrf_vbatched<API, T>(arg);
+    }
+};
+
+class GEQRF_VBATCHED : public GEQRF_VBATCHED_BASE<API_NORMAL>
+{
+};
+
+class GEQRF_VBATCHED_FORTRAN : public GEQRF_VBATCHED_BASE<API_FORTRAN>
+{
+};
+
+// the vbatched functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(GEQRF_VBATCHED, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQRF_VBATCHED, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQRF_VBATCHED, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(GEQRF_VBATCHED, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+TEST_P(GEQRF_VBATCHED_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQRF_VBATCHED_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQRF_VBATCHED_FORTRAN, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(GEQRF_VBATCHED_FORTRAN, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_VBATCHED_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+#endif
@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrf_vbatched.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> getrf_vbatched_tuple;
+
+// each matrix_size_range vector is a {m, lda}
+// the sizes are the largest of the batch; the other problems are smaller
+
+// case when m = -1 and n = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {32, 32},
+    {50, 50},
+    {70, 100},
+};
+
+const vector<int> n_size_range = {
+    // invalid
+    -1,
+    // normal (valid) samples
+    16,
+    20,
+    40,
+    100,
+};
+
+Arguments getrf_vbatched_setup_arguments(getrf_vbatched_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int         n_size      = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<int>("m", matrix_size[0]);
+    arg.set<int>("lda", matrix_size[1]);
+
+    arg.set<int>("n", n_size);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API, bool NPVT>
+class GETRF_VBATCHED_BASE : public ::TestWithParam<getrf_vbatched_tuple>
+{
+protected:
+    GETRF_VBATCHED_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_vbatched_setup_arguments(GetParam());
+
+        if(arg.peek<int>("m") == -1 && arg.peek<int>("n") == -1)
+            testing_getrf_vbatched_bad_arg<API, T>();
+
+        arg.batch_count = 5;
+        testing_getrf_vbatched<API, NPVT, T>(arg);
+    }
+};
+
+class GETRF_VBATCHED : public GETRF_VBATCHED_BASE<API_NORMAL, false>
+{
+};
+
+class GETRF_VBATCHED_FORTRAN : public GETRF_VBATCHED_BASE<API_FORTRAN, false>
+{
+};
+
+class GETRF_NPVT_VBATCHED : public GETRF_VBATCHED_BASE<API_NORMAL, true>
+{
+};
+
+// the vbatched functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(GETRF_VBATCHED, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_VBATCHED, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_VBATCHED, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(GETRF_VBATCHED, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_VBATCHED_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_VBATCHED_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_VBATCHED_FORTRAN, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(GETRF_VBATCHED_FORTRAN, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_NPVT_VBATCHED, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_NPVT_VBATCHED, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_NPVT_VBATCHED, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(GETRF_NPVT_VBATCHED, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_VBATCHED_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NPVT_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+#endif
@@ -0,0 +1,303 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gtsv.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gtsv_tuple;
+
+// each matrix_size vector is a {n, ldb}
+
+// each rhs_size vector is a {nrhs}
+
+// case when n = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {1, 1},
+    {2, 2},
+    {20, 20},
+    {50, 60},
+    {130, 130}};
+
+const vector<vector<int>> rhs_size_range = {
+    // quick return
+    {0},
+    // invalid
+    {-1},
+    // normal (valid) samples
+    {1},
+    {10}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {{300, 300}, {1000, 1024}};
+
+Arguments gtsv_setup_arguments(gtsv_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> rhs_size    = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("ldb", matrix_size[1]);
+    arg.set<rocblas_int>("nrhs", rhs_size[0]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API, bool NOPIVOT>
+class GTSV_BASE : public ::TestWithParam<gtsv_tuple>
+{
+protected:
+    GTSV_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gtsv_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == 1)
+            testing_gtsv_bad_arg<API, BATCHED, STRIDED, NOPIVOT, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gtsv<API, BATCHED, STRIDED, NOPIVOT, T>(arg);
+    }
+};
+
+class GTSV : public GTSV_BASE<API_NORMAL, false>
+{
+};
+
+class GTSV_FORTRAN : public GTSV_BASE<API_FORTRAN, false>
+{
+};
+
+class GTSV_NOPIVOT : public GTSV_BASE<API_NORMAL, true>
+{
+};
+
+class GTSV_NOPIVOT_FORTRAN : public GTSV_BASE<API_FORTRAN, true>
+{
+};
+
+// the tridiagonal solvers are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+// non-batch tests
+
+TEST_P(GTSV, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GTSV, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GTSV, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GTSV, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GTSV_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GTSV_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GTSV_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GTSV_NOPIVOT, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GTSV_NOPIVOT, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GTSV, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GTSV, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GTSV, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GTSV, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GTSV_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GTSV_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GTSV_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GTSV_NOPIVOT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GTSV_NOPIVOT, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GTSV,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GTSV,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GTSV_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GTSV_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GTSV_NOPIVOT,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GTSV_NOPIVOT,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GTSV_NOPIVOT_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GTSV_NOPIVOT_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+#endif
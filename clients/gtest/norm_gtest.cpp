@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+// Tests of the host error norms used by the checks of the other tests
+
+#include "clientcommon.hpp"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+template <typename T>
+static void norm_error_nan(char norm_type, rocblas_int m, rocblas_int n)
+{
+    vector<T> gold(m * n), comp(m * n);
+    for(rocblas_int k = 0; k < m * n; k++)
+        gold[k] = comp[k] = T(k % 7 + 1);
+    EXPECT_EQ(norm_error(norm_type, m, n, m, gold.data(), comp.data()), 0.0);
+
+    // a NaN anywhere in the result must fail the check, whichever block holds it
+    for(rocblas_int k : {0, (m * n) / 2, m * n - 1})
+    {
+        comp[k] = T(std::numeric_limits<float>::quiet_NaN());
+        EXPECT_TRUE(std::isnan(norm_error(norm_type, m, n, m, gold.data(), comp.data())))
+            << "norm " << norm_type << ", element " << k;
+        comp[k] = gold[k];
+    }
+}
+
+TEST(NORM_ERROR, nan_propagates)
+{
+    // 3 x 40000 spans several column blocks
+    for(char type : {'O', 'I', 'F'})
+    {
+        norm_error_nan<float>(type, 5, 4);
+        norm_error_nan<double>(type, 3, 40000);
+        norm_error_nan<rocblas_double_complex>(type, 3, 40000);
+    }
+}
+
+TEST(NORM_ERROR, invalid_type)
+{
+    double gold[4] = {1, 2, 3, 4}, comp[4] = {1, 2, 3, 4};
+    EXPECT_THROW(norm_error('M', 2, 2, 2, gold, comp), std::invalid_argument);
+    EXPECT_THROW(norm_error('x', 2, 2, 2, gold, comp), std::invalid_argument);
+}
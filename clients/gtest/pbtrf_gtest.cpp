@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pbtrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> pbtrf_tuple;
+
+// each matrix_size vector is a {n, ldab - kd - 1, singular}
+// if singular = 1, then some of the matrices in the batch are not positive definite
+
+// each band_size vector is a {kd, uplo}
+// if uplo = 0 then upper
+// if uplo = 1 then lower
+
+// case when n = -1 and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 0},
+    // invalid
+    {-1, 0, 0},
+    {20, -1, 0},
+    // normal (valid) samples
+    {10, 0, 0},
+    {50, 2, 1},
+    {70, 0, 0},
+    {130, 1, 1}};
+
+const vector<vector<int>> band_size_range = {
+    // normal (valid) samples
+    {0, 0},
+    {1, 1},
+    {5, 0},
+    {5, 1},
+    {35, 0},
+    {35, 1}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {{500, 0, 0}, {1000, 5, 1}};
+
+Arguments pbtrf_setup_arguments(pbtrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> band_size   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("ldab", band_size[0] + 1 + matrix_size[1]);
+    arg.set<rocblas_int>("singular", matrix_size[2]);
+
+    arg.set<rocblas_int>("kd", band_size[0]);
+    arg.set<char>("uplo", band_size[1] == 0 ? 'U' : 'L');
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class PBTRF_BASE : public ::TestWithParam<pbtrf_tuple>
+{
+protected:
+    PBTRF_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = pbtrf_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
+            testing_pbtrf_bad_arg<API, BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_pbtrf<API, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class PBTRF : public PBTRF_BASE<API_NORMAL>
+{
+};
+
+class PBTRF_FORTRAN : public PBTRF_BASE<API_FORTRAN>
+{
+};
+
+// the banded Cholesky functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+// non-batch tests
+
+TEST_P(PBTRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PBTRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PBTRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PBTRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(PBTRF_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PBTRF_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PBTRF_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PBTRF_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(PBTRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PBTRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PBTRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PBTRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(PBTRF_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PBTRF_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PBTRF_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PBTRF_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PBTRF,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(band_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PBTRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(band_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PBTRF_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(band_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PBTRF_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(band_size_range)));
+
+#endif
@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pbtrs.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> pbtrs_tuple;
+
+// each matrix_size vector is a {n, kd, ldb}
+
+// each rhs_size vector is a {nrhs, uplo}
+// if uplo = 0 then upper
+// if uplo = 1 then lower
+
+// case when n = nrhs = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1},
+    {10, 2, 2},
+    // normal (valid) samples
+    {10, 0, 10},
+    {20, 3, 20},
+    {30, 10, 50},
+    {50, 40, 60}};
+
+const vector<vector<int>> rhs_size_range = {
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {1, 0},
+    {1, 1},
+    {10, 0},
+    {10, 1}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {{500, 64, 500}, {1000, 128, 1000}};
+
+Arguments pbtrs_setup_arguments(pbtrs_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> rhs_size    = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("kd", matrix_size[1]);
+    arg.set<rocblas_int>("ldb", matrix_size[2]);
+
+    arg.set<rocblas_int>("nrhs", rhs_size[0]);
+    arg.set<char>("uplo", rhs_size[1] == 0 ? 'U' : 'L');
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class PBTRS_BASE : public ::TestWithParam<pbtrs_tuple>
+{
+protected:
+    PBTRS_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = pbtrs_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
+            testing_pbtrs_bad_arg<API, BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_pbtrs<API, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class PBTRS : public PBTRS_BASE<API_NORMAL>
+{
+};
+
+class PBTRS_FORTRAN : public PBTRS_BASE<API_FORTRAN>
+{
+};
+
+// the banded Cholesky functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+// non-batch tests
+
+TEST_P(PBTRS, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PBTRS, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PBTRS, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PBTRS, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(PBTRS_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PBTRS_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PBTRS_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PBTRS_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(PBTRS, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PBTRS, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PBTRS, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PBTRS, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(PBTRS_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PBTRS_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PBTRS_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PBTRS_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PBTRS,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PBTRS,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PBTRS_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PBTRS_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+#endif
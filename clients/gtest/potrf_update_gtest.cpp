@@ -0,0 +1,393 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_potrf_update.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> potrf_update_tuple;
+
+// each size_range vector is a {N, lda, ldv, singular}
+// if singular = 1, then the downdated matrix is not positive definite
+
+// each update_range vector is a {k, uplo}
+// (uplo = 0 for lower, 1 for upper)
+
+// case when n = -1 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1, 0},
+    {10, 2, 10, 0},
+    {10, 10, 2, 0},
+    // normal (valid) samples
+    {10, 10, 10, 0},
+    {20, 30, 20, 0},
+    {50, 50, 60, 1},
+    {70, 80, 70, 0}};
+
+const vector<vector<int>> update_range = {
+    // quick return
+    {0, 0},
+    // normal (valid) samples
+    {1, 0},
+    {1, 1},
+    {4, 0},
+    {4, 1}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {192, 192, 192, 0},
+//     {640, 960, 640, 1},
+//     {1000, 1000, 1000, 0},
+// };
+
+Arguments potrf_update_setup_arguments(potrf_update_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> update      = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+    arg.set<rocblas_int>("ldv", matrix_size[2]);
+    arg.set<rocblas_int>("singular", matrix_size[3]);
+
+    arg.set<rocblas_int>("k", update[0]);
+    arg.set<char>("uplo", update[1] == 1 ? 'U' : 'L');
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API, bool DOWNDATE>
+class POTRF_UPDATE_BASE : public ::TestWithParam<potrf_update_tuple>
+{
+protected:
+    POTRF_UPDATE_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_update_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<int>("n") == -1)
+            testing_potrf_update_downdate_bad_arg<API, BATCHED, STRIDED, DOWNDATE, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_potrf_update_downdate<API, BATCHED, STRIDED, DOWNDATE, T>(arg);
+    }
+};
+
+class POTRF_UPDATE : public POTRF_UPDATE_BASE<API_NORMAL, false>
+{
+};
+
+class POTRF_UPDATE_FORTRAN : public POTRF_UPDATE_BASE<API_FORTRAN, false>
+{
+};
+
+class POTRF_DOWNDATE : public POTRF_UPDATE_BASE<API_NORMAL, true>
+{
+};
+
+class POTRF_DOWNDATE_FORTRAN : public POTRF_UPDATE_BASE<API_FORTRAN, true>
+{
+};
+
+// the update and downdate functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+// non-batch tests
+
+TEST_P(POTRF_UPDATE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_UPDATE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_UPDATE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_DOWNDATE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_DOWNDATE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(POTRF_UPDATE, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(POTRF_UPDATE, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(POTRF_UPDATE, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(POTRF_UPDATE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_UPDATE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_UPDATE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          POTRF_UPDATE,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(update_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_UPDATE,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(update_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          POTRF_UPDATE_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(update_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_UPDATE_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(update_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          POTRF_DOWNDATE,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(update_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_DOWNDATE,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(update_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          POTRF_DOWNDATE_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(update_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_DOWNDATE_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(update_range)));
+
+#endif
@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_potrf_vbatched.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> potrf_vbatched_tuple;
+
+// each matrix_size_range vector is a {n, lda}
+// the sizes are the largest of the batch; the other problems are smaller
+
+// case when n = -1 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {10, 2},
+    // normal (valid) samples
+    {10, 10},
+    {20, 30},
+    {50, 50},
+    {70, 80},
+};
+
+Arguments potrf_vbatched_setup_arguments(potrf_vbatched_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        uplo        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<int>("n", matrix_size[0]);
+    arg.set<int>("lda", matrix_size[1]);
+
+    arg.set<char>("uplo", uplo);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class POTRF_VBATCHED_BASE : public ::TestWithParam<potrf_vbatched_tuple>
+{
+protected:
+    POTRF_VBATCHED_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_vbatched_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<int>("n") == -1)
+            testing_potrf_vbatched_bad_arg<API, T>();
+
+        arg.batch_count = 5;
+        testing_potrf_vbatched<API, T>(arg);
+    }
+};
+
+class POTRF_VBATCHED : public POTRF_VBATCHED_BASE<API_NORMAL>
+{
+};
+
+class POTRF_VBATCHED_FORTRAN : public POTRF_VBATCHED_BASE<API_FORTRAN>
+{
+};
+
+// the vbatched functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(POTRF_VBATCHED, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_VBATCHED, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_VBATCHED, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(POTRF_VBATCHED, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+TEST_P(POTRF_VBATCHED_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_VBATCHED_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_VBATCHED_FORTRAN, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(POTRF_VBATCHED_FORTRAN, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_VBATCHED_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+#endif
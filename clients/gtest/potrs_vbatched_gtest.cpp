@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_potrs_vbatched.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> potrs_vbatched_tuple;
+
+// each matrix_size_range vector is a {n, lda, ldb}
+// each rhs_range vector is a {nrhs, uplo}
+// (uplo = 0 for lower, 1 for upper)
+// the sizes are the largest of the batch; the other problems are smaller
+
+// case when n = -1 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1},
+    {10, 2, 10},
+    {10, 10, 2},
+    // normal (valid) samples
+    {20, 20, 20},
+    {30, 50, 30},
+    {30, 30, 50},
+    {50, 60, 60},
+};
+
+const vector<vector<int>> rhs_range = {
+    // normal (valid) samples
+    {1, 0},
+    {10, 1},
+    {20, 0},
+    {30, 1},
+};
+
+Arguments potrs_vbatched_setup_arguments(potrs_vbatched_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> rhs         = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<int>("n", matrix_size[0]);
+    arg.set<int>("lda", matrix_size[1]);
+    arg.set<int>("ldb", matrix_size[2]);
+
+    arg.set<int>("nrhs", rhs[0]);
+    arg.set<char>("uplo", rhs[1] == 1 ? 'U' : 'L');
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class POTRS_VBATCHED_BASE : public ::TestWithParam<potrs_vbatched_tuple>
+{
+protected:
+    POTRS_VBATCHED_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrs_vbatched_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<int>("n") == -1)
+            testing_potrs_vbatched_bad_arg<API, T>();
+
+        arg.batch_count = 5;
+        testing_potrs_vbatched<API, T>(arg);
+    }
+};
+
+class POTRS_VBATCHED : public POTRS_VBATCHED_BASE<API_NORMAL>
+{
+};
+
+class POTRS_VBATCHED_FORTRAN : public POTRS_VBATCHED_BASE<API_FORTRAN>
+{
+};
+
+// the vbatched functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(POTRS_VBATCHED, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRS_VBATCHED, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRS_VBATCHED, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(POTRS_VBATCHED, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+TEST_P(POTRS_VBATCHED_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRS_VBATCHED_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRS_VBATCHED_FORTRAN, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(POTRS_VBATCHED_FORTRAN, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_VBATCHED_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_range)));
+
+#endif
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pptrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> pptrf_tuple;
+
+// each matrix_size vector is a {n, singular}
+// if singular = 1, then the matrix is not positive definite
+
+// each uplo_range value is 0 for upper or 1 for lower
+
+// case when n = -1 and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<int> uplo_range = {0, 1};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {10, 0},
+    {20, 1},
+    {50, 0},
+    {100, 1},
+    {150, 0}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {{500, 0}, {1000, 1}, {2000, 0}};
+
+Arguments pptrf_setup_arguments(pptrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int         uplo        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("singular", matrix_size[1]);
+    arg.set<char>("uplo", uplo == 0 ? 'U' : 'L');
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class PPTRF_BASE : public ::TestWithParam<pptrf_tuple>
+{
+protected:
+    PPTRF_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = pptrf_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
+            testing_pptrf_bad_arg<API, T>();
+
+        testing_pptrf<API, T>(arg);
+    }
+};
+
+class PPTRF : public PPTRF_BASE<API_NORMAL>
+{
+};
+
+class PPTRF_FORTRAN : public PPTRF_BASE<API_FORTRAN>
+{
+};
+
+// the packed storage functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(PPTRF, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(PPTRF, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(PPTRF, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(PPTRF, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(PPTRF_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(PPTRF_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(PPTRF_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(PPTRF_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PPTRF,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PPTRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PPTRF_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PPTRF_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+#endif
@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pptrs.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> pptrs_tuple;
+
+// each matrix_size vector is a {n, ldb}
+
+// each rhs_size vector is a {nrhs, uplo}
+// if uplo = 0 then upper
+// if uplo = 1 then lower
+
+// case when n = nrhs = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {10, 2},
+    // normal (valid) samples
+    {10, 10},
+    {20, 20},
+    {30, 50},
+    {70, 80}};
+
+const vector<vector<int>> rhs_size_range = {
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {1, 0},
+    {1, 1},
+    {10, 0},
+    {10, 1}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {{500, 500}, {1000, 1000}};
+
+Arguments pptrs_setup_arguments(pptrs_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> rhs_size    = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("ldb", matrix_size[1]);
+
+    arg.set<rocblas_int>("nrhs", rhs_size[0]);
+    arg.set<char>("uplo", rhs_size[1] == 0 ? 'U' : 'L');
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class PPTRS_BASE : public ::TestWithParam<pptrs_tuple>
+{
+protected:
+    PPTRS_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = pptrs_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
+            testing_pptrs_bad_arg<API, T>();
+
+        testing_pptrs<API, T>(arg);
+    }
+};
+
+class PPTRS : public PPTRS_BASE<API_NORMAL>
+{
+};
+
+class PPTRS_FORTRAN : public PPTRS_BASE<API_FORTRAN>
+{
+};
+
+// the packed storage functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(PPTRS, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(PPTRS, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(PPTRS, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(PPTRS, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(PPTRS_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(PPTRS_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(PPTRS_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(PPTRS_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PPTRS,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PPTRS,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          PPTRS_FORTRAN,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(rhs_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PPTRS_FORTRAN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(rhs_size_range)));
+
+#endif
@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_spevd_hpevd.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>> spevd_hpevd_tuple;
+
+// each size_range vector is a {n, ldz}
+
+// each op_range vector is a {jobz, uplo}
+
+// case when n == -1, jobz == N, and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<char>> op_range = {{'N', 'L'}, {'N', 'U'}, {'V', 'L'}, {'V', 'U'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // invalid
+    {-1, 1},
+    {10, 5},
+    // normal (valid) samples
+    {1, 1},
+    {12, 12},
+    {20, 30},
+    {35, 35},
+    {50, 60}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_size_range = {{192, 192}, {256, 270}, {300, 300}};
+
+Arguments spevd_hpevd_setup_arguments(spevd_hpevd_tuple tup)
+{
+    vector<int>  size = std::get<0>(tup);
+    vector<char> op   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("ldz", size[1]);
+
+    arg.set<char>("jobz", op[0]);
+    arg.set<char>("uplo", op[1]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class SPEVD_HPEVD : public ::TestWithParam<spevd_hpevd_tuple>
+{
+protected:
+    SPEVD_HPEVD() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = spevd_hpevd_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("jobz") == 'N'
+           && arg.peek<char>("uplo") == 'L')
+            testing_spevd_hpevd_bad_arg<API, T>();
+
+        testing_spevd_hpevd<API, T>(arg);
+    }
+};
+
+class SPEVD : public SPEVD_HPEVD<API_NORMAL>
+{
+};
+
+class HPEVD : public SPEVD_HPEVD<API_NORMAL>
+{
+};
+
+class SPEVD_FORTRAN : public SPEVD_HPEVD<API_FORTRAN>
+{
+};
+
+class HPEVD_FORTRAN : public SPEVD_HPEVD<API_FORTRAN>
+{
+};
+
+// the packed storage functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(SPEVD, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(SPEVD, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(HPEVD, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(HPEVD, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(SPEVD_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(SPEVD_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(HPEVD_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(HPEVD_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SPEVD,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SPEVD,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          HPEVD,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HPEVD,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SPEVD_FORTRAN,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SPEVD_FORTRAN,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          HPEVD_FORTRAN,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HPEVD_FORTRAN,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+#endif
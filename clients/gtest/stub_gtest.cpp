@@ -0,0 +1,482 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+// Tests of the wrapper layer of the rocSOLVER backend, run against the stub backend
+// (USE_STUB_BACKEND). Only rocBLAS and rocSOLVER are replaced, so the paths that call the HIP
+// runtime directly (coalescer, pipelines, banded and packed routines, potrf update, posv solve)
+// are not covered here. The remaining tests do not need a GPU: the handle pool tolerates a failing
+// hipGetDevice.
+
+#include "hipsolver.h"
+#include "hipsolver_stub.h"
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+class STUB : public ::testing::Test
+{
+protected:
+    hipsolverHandle_t handle = nullptr;
+
+    void SetUp() override
+    {
+        hipsolver_stub_reset();
+        ASSERT_EQ(hipsolverCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(hipsolverDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+    }
+};
+
+TEST_F(STUB, stream)
+{
+    hipStream_t stream = nullptr;
+    EXPECT_EQ(hipsolverSetStream(handle, (hipStream_t)0x1234), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetStream(handle, &stream), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stream, (hipStream_t)0x1234);
+}
+
+TEST_F(STUB, control)
+{
+    EXPECT_EQ(hipsolver_stub_set_status("rocsolver_unknown", rocblas_status_success),
+              rocblas_status_invalid_value);
+    EXPECT_EQ(hipsolver_stub_set_workspace_size("rocsolver_sgetrf", 0), rocblas_status_success);
+    EXPECT_EQ(hipsolver_stub_call_count(nullptr), 0u);
+    EXPECT_EQ(hipsolver_stub_last_call(), nullptr);
+}
+
+TEST_F(STUB, buffer_size)
+{
+    // getrf reports the workspace of both the pivoting and non-pivoting factorizations
+    int lwork = 0;
+    hipsolver_stub_set_workspace_size("rocsolver_sgetrf", 1000);
+    hipsolver_stub_set_workspace_size("rocsolver_sgetrf_npvt", 1500);
+    EXPECT_EQ(hipsolverSgetrf_bufferSize(handle, 10, 10, nullptr, 10, &lwork),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, 1500);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf"), 1u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf_npvt"), 1u);
+
+    EXPECT_EQ(hipsolverSgetrf_bufferSize(handle, 10, 10, nullptr, 10, nullptr),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSgetrf_bufferSize(nullptr, 10, 10, nullptr, 10, &lwork),
+              HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(STUB, buffer_size_gesvdj)
+{
+    // the workspace of gesvdj adds the E and V_copy arrays to the workspace of gesvd
+    int                   m = 4, n = 3, lwork = 0;
+    hipsolverGesvdjInfo_t params;
+    ASSERT_EQ(hipsolverDnCreateGesvdjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+
+    hipsolver_stub_set_workspace_size("rocsolver_sgesvd", 1000);
+    EXPECT_EQ(hipsolverDnSgesvdj_bufferSize(handle,
+                                            HIPSOLVER_EIG_MODE_VECTOR,
+                                            0,
+                                            m,
+                                            n,
+                                            nullptr,
+                                            m,
+                                            nullptr,
+                                            nullptr,
+                                            m,
+                                            nullptr,
+                                            n,
+                                            &lwork,
+                                            params),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, int(1000 + sizeof(float) * n + sizeof(float) * n * n));
+
+    EXPECT_EQ(hipsolverDnDestroyGesvdjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(STUB, buffer_size_gesvd_strided_batched)
+{
+    // the workspace of gesvdStridedBatched adds the E arrays of all the problems
+    int m = 4, n = 3, bc = 2, lwork = 0;
+
+    hipsolver_stub_set_workspace_size("rocsolver_sgesvd_strided_batched", 1000);
+    EXPECT_EQ(hipsolverSgesvdStridedBatched_bufferSize(handle, 'A', 'A', m, n, &lwork, bc),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, int(1000 + sizeof(float) * n * bc));
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgesvd_strided_batched"), 1u);
+}
+
+TEST_F(STUB, status_translation)
+{
+    const std::pair<rocblas_status, hipsolverStatus_t> cases[]
+        = {{rocblas_status_success, HIPSOLVER_STATUS_SUCCESS},
+           {rocblas_status_invalid_handle, HIPSOLVER_STATUS_NOT_INITIALIZED},
+           {rocblas_status_not_implemented, HIPSOLVER_STATUS_NOT_SUPPORTED},
+           {rocblas_status_invalid_pointer, HIPSOLVER_STATUS_INVALID_VALUE},
+           {rocblas_status_invalid_size, HIPSOLVER_STATUS_INVALID_VALUE},
+           {rocblas_status_memory_error, HIPSOLVER_STATUS_ALLOC_FAILED},
+           {rocblas_status_internal_error, HIPSOLVER_STATUS_INTERNAL_ERROR}};
+
+    for(auto& c : cases)
+    {
+        hipsolver_stub_set_status("rocsolver_spotrf", c.first);
+        hipsolverStatus_t status = hipsolverSpotrf(
+            handle, HIPSOLVER_FILL_MODE_LOWER, 10, nullptr, 10, nullptr, 0, nullptr);
+        EXPECT_EQ(status, c.second);
+    }
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_spotrf");
+}
+
+TEST_F(STUB, manage_workspace)
+{
+    // without a user workspace, the functions query the workspace size and then compute
+    hipsolver_stub_set_workspace_size("rocsolver_sgetrf", 1000);
+    EXPECT_EQ(hipsolverSgetrf(handle, 10, 10, nullptr, 10, nullptr, 0, nullptr, nullptr),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf"), 1u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf_npvt"), 2u);
+
+    // with a user workspace, they compute directly
+    float work[1];
+    int   ipiv[1];
+    EXPECT_EQ(hipsolverSgetrf(handle, 10, 10, nullptr, 10, work, 1, ipiv, nullptr),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf"), 2u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf_npvt"), 2u);
+}
+
+TEST_F(STUB, handle_pool)
+{
+    int capacity = -1;
+    EXPECT_EQ(hipsolverHandlePoolGetCapacity(&capacity), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, 0);
+    EXPECT_EQ(hipsolverHandlePoolSetCapacity(-1), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverHandlePoolGetCapacity(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // a destroyed handle is kept, reset, and given back by the next create
+    ASSERT_EQ(hipsolverHandlePoolSetCapacity(1), HIPSOLVER_STATUS_SUCCESS);
+    hipsolverHandle_t pooled, reused, other;
+    hipStream_t       stream = (hipStream_t)0x1234;
+    ASSERT_EQ(hipsolverCreate(&pooled), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverSetStream(pooled, stream), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverDestroy(pooled), HIPSOLVER_STATUS_SUCCESS);
+
+    ASSERT_EQ(hipsolverCreate(&reused), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(reused, pooled);
+    EXPECT_EQ(hipsolverGetStream(reused, &stream), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stream, (hipStream_t)0);
+
+    // the pool is empty until the handle is destroyed again
+    ASSERT_EQ(hipsolverCreate(&other), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_NE(other, reused);
+    EXPECT_EQ(hipsolverDestroy(other), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverDestroy(reused), HIPSOLVER_STATUS_SUCCESS);
+
+    // reserve fills the pool up to its capacity
+    EXPECT_EQ(hipsolverHandlePoolClear(), HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverHandlePoolSetCapacity(2), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverHandlePoolReserve(4), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverHandlePoolReserve(-1), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipsolverHandlePoolSetCapacity(0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverDestroy(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(STUB, coalescer)
+{
+    EXPECT_EQ(hipsolverCoalescerCreate(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverCoalescerDestroy(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverCoalescerSetMaxBatch(nullptr, 8), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverCoalescerSetWindow(nullptr, 10), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // without a coalescer, the coalesced functions run the regular factorizations
+    float A[1];
+    int   ipiv[1], info[1];
+    EXPECT_EQ(hipsolverSpotrfCoalesced(handle, nullptr, HIPSOLVER_FILL_MODE_UPPER, 1, A, 1, info),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_spotrf");
+    EXPECT_EQ(hipsolverSgetrfCoalesced(handle, nullptr, 1, 1, A, 1, ipiv, info),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_sgetrf");
+    EXPECT_EQ(hipsolverSgetrfCoalesced(handle, nullptr, 1, 1, A, 1, nullptr, info),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_sgetrf_npvt");
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_spotrf_batched"), 0u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf_batched"), 0u);
+}
+
+TEST_F(STUB, pipelined)
+{
+    float A[4], B[2], W[2];
+    int   info[2] = {-1, -1};
+    EXPECT_EQ(hipsolverSpotrfPipelined(
+                  nullptr, HIPSOLVER_FILL_MODE_UPPER, 1, 1, A, 1, B, 1, info, 2, 1),
+              HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(
+        hipsolverSpotrfPipelined(handle, HIPSOLVER_FILL_MODE_UPPER, 1, 1, A, 1, B, 1, info, 2, 0),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSpotrfPipelined(
+                  handle, HIPSOLVER_FILL_MODE_UPPER, 1, 1, A, 1, B, 1, nullptr, 2, 1),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSsyevjPipelined(handle,
+                                       HIPSOLVER_EIG_MODE_VECTOR,
+                                       HIPSOLVER_FILL_MODE_UPPER,
+                                       2,
+                                       A,
+                                       1,
+                                       W,
+                                       info,
+                                       nullptr,
+                                       2,
+                                       1),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // empty problems only set the infos
+    EXPECT_EQ(
+        hipsolverSpotrfPipelined(handle, HIPSOLVER_FILL_MODE_UPPER, 0, 1, A, 1, B, 1, info, 2, 1),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info[0], 0);
+    EXPECT_EQ(info[1], 0);
+    EXPECT_EQ(hipsolver_stub_last_call(), nullptr);
+}
+
+TEST_F(STUB, row_major)
+{
+    hipsolverLayout_t layout;
+    EXPECT_EQ(hipsolverGetMatrixLayout(handle, &layout), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(layout, HIPSOLVER_LAYOUT_COLUMN_MAJOR);
+    EXPECT_EQ(hipsolverGetMatrixLayout(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSetMatrixLayout(nullptr, HIPSOLVER_LAYOUT_ROW_MAJOR),
+              HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverSetMatrixLayout(handle, (hipsolverLayout_t)0),
+              HIPSOLVER_STATUS_INVALID_ENUM);
+
+    ASSERT_EQ(hipsolverSetMatrixLayout(handle, HIPSOLVER_LAYOUT_ROW_MAJOR),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetMatrixLayout(handle, &layout), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(layout, HIPSOLVER_LAYOUT_ROW_MAJOR);
+
+    // potrs solves from the right with the factor, on the row-major B
+    float A[4], B[6], work[16];
+    int   ipiv[2], info[1], lwork = 0;
+    hipsolver_stub_set_workspace_size("rocblas_strsm", 64);
+    EXPECT_EQ(
+        hipsolverSpotrs_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, 2, 3, A, 2, B, 3, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, 64);
+
+    hipsolver_stub_reset();
+    EXPECT_EQ(hipsolverSpotrs(
+                  handle, HIPSOLVER_FILL_MODE_UPPER, 2, 3, A, 2, B, 3, work, lwork, info),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_stub_call_count("rocblas_strsm"), 2u);
+    EXPECT_EQ(hipsolver_stub_call_count(nullptr), 2u);
+    EXPECT_EQ(hipsolverSpotrs(
+                  handle, HIPSOLVER_FILL_MODE_UPPER, 2, 3, A, 2, B, 2, work, lwork, info),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // getrs solves with the factors of the transpose, on a column-major copy of B
+    EXPECT_EQ(
+        hipsolverSgetrs_bufferSize(handle, HIPSOLVER_OP_N, 2, 3, A, 2, ipiv, B, 3, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, int(sizeof(float) * 6));
+
+    hipsolver_stub_reset();
+    EXPECT_EQ(hipsolverSgetrs(
+                  handle, HIPSOLVER_OP_N, 2, 3, A, 2, ipiv, B, 3, work, lwork, info),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrs"), 1u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocblas_sgeam"), 2u);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocblas_sgeam");
+
+    // a new handle is column-major
+    EXPECT_EQ(hipsolverDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetMatrixLayout(handle, &layout), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(layout, HIPSOLVER_LAYOUT_COLUMN_MAJOR);
+}
+
+TEST_F(STUB, interleaved)
+{
+    // a batch of 3 matrices of size 2, and its strided copy
+    float A[12], B[12], work[32];
+    int   ipiv[6], info[3], lwork = 0;
+
+    EXPECT_EQ(hipsolverSinterleavedToStrided(handle, 2, 2, A, 2, B, 2, 4, 3),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverSstridedToInterleaved(handle, 2, 2, B, 2, 4, A, 2, 3),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_stub_call_count("rocblas_sgeam_strided_batched"), 2u);
+    EXPECT_EQ(hipsolverSinterleavedToStrided(handle, 2, 2, A, 2, B, 2, 3, 3),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSstridedToInterleaved(handle, 2, 2, B, 2, 4, A, 1, 3),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the workspace holds the strided copy of the batch
+    hipsolver_stub_set_workspace_size("rocsolver_sgetrf_strided_batched", 16);
+    EXPECT_EQ(hipsolverSgetrfInterleaved_bufferSize(handle, 2, 2, A, 2, &lwork, 3),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, int(16 + sizeof(float) * 12));
+
+    // the factorization runs between the conversions into and out of the workspace
+    hipsolver_stub_reset();
+    EXPECT_EQ(hipsolverSgetrfInterleaved(handle, 2, 2, A, 2, work, lwork, ipiv, info, 3),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_sgetrf_strided_batched"), 1u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocblas_sgeam_strided_batched"), 2u);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocblas_sgeam_strided_batched");
+    EXPECT_EQ(hipsolverSgetrfInterleaved(handle, 2, 2, A, 1, work, lwork, ipiv, info, 3),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the solves convert A and B, and convert back B
+    EXPECT_EQ(hipsolverSpotrsInterleaved_bufferSize(
+                  handle, HIPSOLVER_FILL_MODE_UPPER, 2, 2, A, 2, B, 2, &lwork, 3),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, int(sizeof(float) * 24));
+
+    hipsolver_stub_reset();
+    EXPECT_EQ(hipsolverSpotrsInterleaved(
+                  handle, HIPSOLVER_FILL_MODE_UPPER, 2, 2, A, 2, B, 2, work, lwork, info, 3),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_spotrs_strided_batched"), 1u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocblas_sgeam_strided_batched"), 3u);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocblas_sgeam_strided_batched");
+}
+
+TEST_F(STUB, posv)
+{
+    float A[8], B[8], work[16];
+    int   info[2], lwork = 0;
+
+    // a single query covers the factorization and the solve
+    hipsolver_stub_set_workspace_size("rocsolver_spotrf_strided_batched", 24);
+    hipsolver_stub_set_workspace_size("rocsolver_spotrs_strided_batched", 40);
+    EXPECT_EQ(
+        hipsolverSposv_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, 2, 2, A, 2, B, 2, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, 40);
+
+    // the solve waits for the infos of the factorization, which are read with the HIP runtime,
+    // so only the argument checks are tested here
+
+    // the arguments of the solve are checked before A is factorized
+    hipsolver_stub_reset();
+    EXPECT_EQ(hipsolverSposv(
+                  handle, HIPSOLVER_FILL_MODE_UPPER, 2, 2, A, 2, B, 1, work, lwork, info),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSposvStridedBatched(handle,
+                                           HIPSOLVER_FILL_MODE_UPPER,
+                                           2,
+                                           2,
+                                           A,
+                                           2,
+                                           4,
+                                           nullptr,
+                                           2,
+                                           4,
+                                           work,
+                                           lwork,
+                                           info,
+                                           2),
+              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolver_stub_call_count(nullptr), 0u);
+}
+
+TEST_F(STUB, tuning)
+{
+    hipsolverSvdAlg_t svd_alg;
+    hipsolverEigAlg_t eig_alg;
+    EXPECT_EQ(hipsolverGetSvdAlg(handle, &svd_alg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(svd_alg, HIPSOLVER_SVD_ALG_AUTO);
+    EXPECT_EQ(hipsolverGetEigAlg(handle, &eig_alg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(eig_alg, HIPSOLVER_EIG_ALG_AUTO);
+    EXPECT_EQ(hipsolverGetEigAlg(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverSetEigAlg(nullptr, HIPSOLVER_EIG_ALG_QR), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipsolverSetSvdAlg(handle, (hipsolverSvdAlg_t)0), HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipsolverSetEigAlg(handle, (hipsolverEigAlg_t)0), HIPSOLVER_STATUS_INVALID_ENUM);
+
+    ASSERT_EQ(hipsolverSetSvdAlg(handle, HIPSOLVER_SVD_ALG_INPLACE), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetSvdAlg(handle, &svd_alg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(svd_alg, HIPSOLVER_SVD_ALG_INPLACE);
+
+    // the QR iteration replaces the divide-and-conquer eigensolver
+    int lwork = 0;
+    hipsolver_stub_set_workspace_size("rocsolver_ssyev", 100);
+    ASSERT_EQ(hipsolverSetEigAlg(handle, HIPSOLVER_EIG_ALG_QR), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverSsyevd_bufferSize(handle,
+                                         HIPSOLVER_EIG_MODE_VECTOR,
+                                         HIPSOLVER_FILL_MODE_UPPER,
+                                         4,
+                                         nullptr,
+                                         4,
+                                         nullptr,
+                                         &lwork),
+              HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork, int(100 + sizeof(float) * 4));
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_ssyev"), 1u);
+    EXPECT_EQ(hipsolver_stub_call_count("rocsolver_ssyevd"), 0u);
+
+    // in AUTO mode, the nearest entry of the tuning table is used
+    const char* path = "hipsolver_stub_tuning.txt";
+    std::ofstream(path) << "# family precision m n batch_count method\n"
+                           "syevd s 16 16 1 qr\n"
+                           "syevd s 1024 1024 1 dc\n"
+                           "gesvd s 64 64 1 inplace\n";
+    ASSERT_EQ(hipsolverSetEigAlg(handle, HIPSOLVER_EIG_ALG_AUTO), HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverLoadTuningTable(handle, path), HIPSOLVER_STATUS_SUCCESS);
+
+    hipsolver_stub_reset();
+    hipsolverSsyevd_bufferSize(handle,
+                               HIPSOLVER_EIG_MODE_VECTOR,
+                               HIPSOLVER_FILL_MODE_UPPER,
+                               8,
+                               nullptr,
+                               8,
+                               nullptr,
+                               &lwork);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_ssyev");
+    hipsolverSsyevd_bufferSize(handle,
+                               HIPSOLVER_EIG_MODE_VECTOR,
+                               HIPSOLVER_FILL_MODE_UPPER,
+                               2000,
+                               nullptr,
+                               2000,
+                               nullptr,
+                               &lwork);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_ssyevd");
+    hipsolverDsyevd_bufferSize(handle,
+                               HIPSOLVER_EIG_MODE_VECTOR,
+                               HIPSOLVER_FILL_MODE_UPPER,
+                               8,
+                               nullptr,
+                               8,
+                               nullptr,
+                               &lwork);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_dsyevd");
+
+    // a malformed or missing file is rejected, and a null path detaches the table
+    std::ofstream(path) << "syevd s 16 16 1 jacobi\n";
+    EXPECT_EQ(hipsolverLoadTuningTable(handle, path), HIPSOLVER_STATUS_INVALID_VALUE);
+    std::remove(path);
+    EXPECT_EQ(hipsolverLoadTuningTable(handle, path), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipsolverLoadTuningTable(handle, nullptr), HIPSOLVER_STATUS_SUCCESS);
+
+    hipsolver_stub_reset();
+    hipsolverSsyevd_bufferSize(handle,
+                               HIPSOLVER_EIG_MODE_VECTOR,
+                               HIPSOLVER_FILL_MODE_UPPER,
+                               8,
+                               nullptr,
+                               8,
+                               nullptr,
+                               &lwork);
+    EXPECT_STREQ(hipsolver_stub_last_call(), "rocsolver_ssyevd");
+
+    // a new handle is in AUTO mode
+    EXPECT_EQ(hipsolverDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+    ASSERT_EQ(hipsolverCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hipsolverGetSvdAlg(handle, &svd_alg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(svd_alg, HIPSOLVER_SVD_ALG_AUTO);
+}
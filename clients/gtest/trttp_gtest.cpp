@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_trttp.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> trttp_tuple;
+
+// each size_range vector is a {n, lda}
+
+// each uplo_range value is 0 for upper or 1 for lower
+
+// case when n = -1 and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<int> uplo_range = {0, 1};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {10, 5},
+    // normal (valid) samples
+    {1, 1},
+    {20, 20},
+    {50, 60},
+    {100, 100}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_size_range = {{1000, 1000}, {2000, 2048}};
+
+Arguments trttp_setup_arguments(trttp_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    int         uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+    arg.set<char>("uplo", uplo == 0 ? 'U' : 'L');
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class TRTTP_BASE : public ::TestWithParam<trttp_tuple>
+{
+protected:
+    TRTTP_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = trttp_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
+            testing_trttp_bad_arg<API, T>();
+
+        testing_trttp<API, T>(arg);
+    }
+};
+
+class TRTTP : public TRTTP_BASE<API_NORMAL>
+{
+};
+
+class TRTTP_FORTRAN : public TRTTP_BASE<API_FORTRAN>
+{
+};
+
+// the packed storage functions are only available with the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+
+TEST_P(TRTTP, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(TRTTP, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(TRTTP, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(TRTTP, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(TRTTP_FORTRAN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(TRTTP_FORTRAN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(TRTTP_FORTRAN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(TRTTP_FORTRAN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          TRTTP,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         TRTTP,
+                         Combine(ValuesIn(size_range), ValuesIn(uplo_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          TRTTP_FORTRAN,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         TRTTP_FORTRAN,
+                         Combine(ValuesIn(size_range), ValuesIn(uplo_range)));
+
+#endif
@@ -10,6 +10,7 @@
 #include "../rocsolvercommon/rocsolver_test.hpp"
 
 #include "hipsolver.hpp"
+#include "hipsolver_test_cache.hpp"
 #include "lapack_host_reference.hpp"
 
 using namespace std;
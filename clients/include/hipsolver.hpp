@@ -68,6 +68,30 @@ inline testMarshal_t api2marshal(testAPI_t API, bool ALT)
     }
 }
 
+inline testMarshal_t api2marshal(testAPI_t API, bool ALT, bool STRIDED)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        if(!STRIDED)
+            return ALT ? C_NORMAL_ALT : C_NORMAL;
+        else
+            return ALT ? C_STRIDED_ALT : C_STRIDED;
+    case API_FORTRAN:
+        if(!STRIDED)
+            return ALT ? FORTRAN_NORMAL_ALT : FORTRAN_NORMAL;
+        else
+            return ALT ? FORTRAN_STRIDED_ALT : FORTRAN_STRIDED;
+    case API_COMPAT:
+        if(!STRIDED)
+            return ALT ? COMPAT_NORMAL_ALT : COMPAT_NORMAL;
+        else
+            return ALT ? COMPAT_STRIDED_ALT : COMPAT_STRIDED;
+    default:
+        return INVALID_API_SPEC;
+    }
+}
+
 /******************** ORGBR/UNGBR ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FORTRAN,
@@ -1931,6 +1955,228 @@ inline hipsolverStatus_t hipsolver_geqrf(bool                    FORTRAN,
 }
 /********************************************************/
 
+/******************** GEQRF_VBATCHED ********************/
+inline hipsolverStatus_t hipsolver_geqrf_vbatched_bufferSize(testAPI_t         API,
+                                                             hipsolverHandle_t handle,
+                                                             const int*        m,
+                                                             const int*        n,
+                                                             float*            A[],
+                                                             const int*        lda,
+                                                             int*              lwork,
+                                                             int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSgeqrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_vbatched_bufferSize(testAPI_t         API,
+                                                             hipsolverHandle_t handle,
+                                                             const int*        m,
+                                                             const int*        n,
+                                                             double*           A[],
+                                                             const int*        lda,
+                                                             int*              lwork,
+                                                             int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDgeqrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_vbatched_bufferSize(testAPI_t         API,
+                                                             hipsolverHandle_t handle,
+                                                             const int*        m,
+                                                             const int*        n,
+                                                             hipsolverComplex* A[],
+                                                             const int*        lda,
+                                                             int*              lwork,
+                                                             int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCgeqrfVbatched_bufferSize(
+            handle, m, n, (hipFloatComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCgeqrfVbatched_bufferSizeFortran(
+            handle, m, n, (hipFloatComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_vbatched_bufferSize(testAPI_t               API,
+                                                             hipsolverHandle_t       handle,
+                                                             const int*              m,
+                                                             const int*              n,
+                                                             hipsolverDoubleComplex* A[],
+                                                             const int*              lda,
+                                                             int*                    lwork,
+                                                             int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZgeqrfVbatched_bufferSize(
+            handle, m, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverZgeqrfVbatched_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_vbatched(testAPI_t         API,
+                                                  hipsolverHandle_t handle,
+                                                  const int*        m,
+                                                  const int*        n,
+                                                  float*            A[],
+                                                  const int*        lda,
+                                                  float*            tau,
+                                                  float*            work,
+                                                  int               lwork,
+                                                  int*              info,
+                                                  int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSgeqrfVbatched(
+            handle, m, n, A, lda, tau, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSgeqrfVbatchedFortran(
+            handle, m, n, A, lda, tau, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_vbatched(testAPI_t         API,
+                                                  hipsolverHandle_t handle,
+                                                  const int*        m,
+                                                  const int*        n,
+                                                  double*           A[],
+                                                  const int*        lda,
+                                                  double*           tau,
+                                                  double*           work,
+                                                  int               lwork,
+                                                  int*              info,
+                                                  int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDgeqrfVbatched(
+            handle, m, n, A, lda, tau, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDgeqrfVbatchedFortran(
+            handle, m, n, A, lda, tau, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_vbatched(testAPI_t         API,
+                                                  hipsolverHandle_t handle,
+                                                  const int*        m,
+                                                  const int*        n,
+                                                  hipsolverComplex* A[],
+                                                  const int*        lda,
+                                                  hipsolverComplex* tau,
+                                                  hipsolverComplex* work,
+                                                  int               lwork,
+                                                  int*              info,
+                                                  int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCgeqrfVbatched(handle,
+                                       m,
+                                       n,
+                                       (hipFloatComplex**)A,
+                                       lda,
+                                       (hipFloatComplex*)tau,
+                                       (hipFloatComplex*)work,
+                                       lwork,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverCgeqrfVbatchedFortran(handle,
+                                              m,
+                                              n,
+                                              (hipFloatComplex**)A,
+                                              lda,
+                                              (hipFloatComplex*)tau,
+                                              (hipFloatComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_vbatched(testAPI_t               API,
+                                                  hipsolverHandle_t       handle,
+                                                  const int*              m,
+                                                  const int*              n,
+                                                  hipsolverDoubleComplex* A[],
+                                                  const int*              lda,
+                                                  hipsolverDoubleComplex* tau,
+                                                  hipsolverDoubleComplex* work,
+                                                  int                     lwork,
+                                                  int*                    info,
+                                                  int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZgeqrfVbatched(handle,
+                                       m,
+                                       n,
+                                       (hipDoubleComplex**)A,
+                                       lda,
+                                       (hipDoubleComplex*)tau,
+                                       (hipDoubleComplex*)work,
+                                       lwork,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverZgeqrfVbatchedFortran(handle,
+                                              m,
+                                              n,
+                                              (hipDoubleComplex**)A,
+                                              lda,
+                                              (hipDoubleComplex*)tau,
+                                              (hipDoubleComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
 /******************** GESV ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
@@ -2371,6 +2617,7 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t               API,
 /******************** GESVD ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
+                                                    bool              STRIDED,
                                                     hipsolverHandle_t handle,
                                                     signed char       jobu,
                                                     signed char       jobv,
@@ -2378,16 +2625,23 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
                                                     int               n,
                                                     float*            A,
                                                     int               lda,
-                                                    int*              lwork)
+                                                    int*              lwork,
+                                                    int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
+    case C_STRIDED:
+        return hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
         return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-    case API_COMPAT:
+    case FORTRAN_STRIDED:
+        return hipsolverSgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    case COMPAT_NORMAL:
         return hipsolverDnSgesvd_bufferSize(handle, m, n, lwork);
+    case COMPAT_STRIDED:
+        return hipsolverDnSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
@@ -2395,6 +2649,7 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
+                                                    bool              STRIDED,
                                                     hipsolverHandle_t handle,
                                                     signed char       jobu,
                                                     signed char       jobv,
@@ -2402,16 +2657,23 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
                                                     int               n,
                                                     double*           A,
                                                     int               lda,
-                                                    int*              lwork)
+                                                    int*              lwork,
+                                                    int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
+    case C_STRIDED:
+        return hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
         return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-    case API_COMPAT:
+    case FORTRAN_STRIDED:
+        return hipsolverDgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    case COMPAT_NORMAL:
         return hipsolverDnDgesvd_bufferSize(handle, m, n, lwork);
+    case COMPAT_STRIDED:
+        return hipsolverDnDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
@@ -2419,6 +2681,7 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
+                                                    bool              STRIDED,
                                                     hipsolverHandle_t handle,
                                                     signed char       jobu,
                                                     signed char       jobv,
@@ -2426,16 +2689,23 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
                                                     int               n,
                                                     hipsolverComplex* A,
                                                     int               lda,
-                                                    int*              lwork)
+                                                    int*              lwork,
+                                                    int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
+    case C_STRIDED:
+        return hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
         return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-    case API_COMPAT:
+    case FORTRAN_STRIDED:
+        return hipsolverCgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    case COMPAT_NORMAL:
         return hipsolverDnCgesvd_bufferSize(handle, m, n, lwork);
+    case COMPAT_STRIDED:
+        return hipsolverDnCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
@@ -2443,6 +2713,7 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     signed char             jobu,
                                                     signed char             jobv,
@@ -2450,16 +2721,23 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
-                                                    int*                    lwork)
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
+    case C_NORMAL:
         return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    case API_FORTRAN:
+    case C_STRIDED:
+        return hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_NORMAL:
         return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-    case API_COMPAT:
+    case FORTRAN_STRIDED:
+        return hipsolverZgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    case COMPAT_NORMAL:
         return hipsolverDnZgesvd_bufferSize(handle, m, n, lwork);
+    case COMPAT_STRIDED:
+        return hipsolverDnZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
@@ -2467,6 +2745,7 @@ inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
 }
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
+                                         bool              STRIDED,
                                          bool              NRWK,
                                          hipsolverHandle_t handle,
                                          signed char       jobu,
@@ -2491,7 +2770,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          int*              info,
                                          int               bc)
 {
-    switch(api2marshal(API, NRWK))
+    switch(api2marshal(API, NRWK, STRIDED))
     {
     case C_NORMAL:
         return hipsolverSgesvd(
@@ -2499,18 +2778,111 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
     case C_NORMAL_ALT:
         return hipsolverSgesvd(
             handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, nullptr, info);
+    case C_STRIDED:
+        return hipsolverSgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case C_STRIDED_ALT:
+        return hipsolverSgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             nullptr,
+                                             stRW,
+                                             info,
+                                             bc);
     case FORTRAN_NORMAL:
         return hipsolverSgesvdFortran(
             handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverSgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    U,
+                                                    ldu,
+                                                    stU,
+                                                    V,
+                                                    ldv,
+                                                    stV,
+                                                    work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
     case COMPAT_NORMAL:
         return hipsolverDnSgesvd(
             handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case COMPAT_STRIDED:
+        return hipsolverDnSgesvdStridedBatched(handle,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               A,
+                                               lda,
+                                               stA,
+                                               S,
+                                               stS,
+                                               U,
+                                               ldu,
+                                               stU,
+                                               V,
+                                               ldv,
+                                               stV,
+                                               work,
+                                               lwork,
+                                               rwork,
+                                               stRW,
+                                               info,
+                                               bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
+                                         bool              STRIDED,
                                          bool              NRWK,
                                          hipsolverHandle_t handle,
                                          signed char       jobu,
@@ -2535,7 +2907,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          int*              info,
                                          int               bc)
 {
-    switch(api2marshal(API, NRWK))
+    switch(api2marshal(API, NRWK, STRIDED))
     {
     case C_NORMAL:
         return hipsolverDgesvd(
@@ -2543,18 +2915,111 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
     case C_NORMAL_ALT:
         return hipsolverDgesvd(
             handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, nullptr, info);
+    case C_STRIDED:
+        return hipsolverDgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case C_STRIDED_ALT:
+        return hipsolverDgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             nullptr,
+                                             stRW,
+                                             info,
+                                             bc);
     case FORTRAN_NORMAL:
         return hipsolverDgesvdFortran(
             handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverDgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    U,
+                                                    ldu,
+                                                    stU,
+                                                    V,
+                                                    ldv,
+                                                    stV,
+                                                    work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
     case COMPAT_NORMAL:
         return hipsolverDnDgesvd(
             handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case COMPAT_STRIDED:
+        return hipsolverDnDgesvdStridedBatched(handle,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               A,
+                                               lda,
+                                               stA,
+                                               S,
+                                               stS,
+                                               U,
+                                               ldu,
+                                               stU,
+                                               V,
+                                               ldv,
+                                               stV,
+                                               work,
+                                               lwork,
+                                               rwork,
+                                               stRW,
+                                               info,
+                                               bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
+                                         bool              STRIDED,
                                          bool              NRWK,
                                          hipsolverHandle_t handle,
                                          signed char       jobu,
@@ -2579,7 +3044,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                          int*              info,
                                          int               bc)
 {
-    switch(api2marshal(API, NRWK))
+    switch(api2marshal(API, NRWK, STRIDED))
     {
     case C_NORMAL:
         return hipsolverCgesvd(handle,
@@ -2615,6 +3080,52 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                lwork,
                                nullptr,
                                info);
+    case C_STRIDED:
+        return hipsolverCgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             (hipFloatComplex*)U,
+                                             ldu,
+                                             stU,
+                                             (hipFloatComplex*)V,
+                                             ldv,
+                                             stV,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case C_STRIDED_ALT:
+        return hipsolverCgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             (hipFloatComplex*)U,
+                                             ldu,
+                                             stU,
+                                             (hipFloatComplex*)V,
+                                             ldv,
+                                             stV,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             nullptr,
+                                             stRW,
+                                             info,
+                                             bc);
     case FORTRAN_NORMAL:
         return hipsolverCgesvdFortran(handle,
                                       jobu,
@@ -2632,6 +3143,29 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                       lwork,
                                       rwork,
                                       info);
+    case FORTRAN_STRIDED:
+        return hipsolverCgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    (hipFloatComplex*)A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    (hipFloatComplex*)U,
+                                                    ldu,
+                                                    stU,
+                                                    (hipFloatComplex*)V,
+                                                    ldv,
+                                                    stV,
+                                                    (hipFloatComplex*)work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
     case COMPAT_NORMAL:
         return hipsolverDnCgesvd(handle,
                                  jobu,
@@ -2649,12 +3183,36 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
                                  lwork,
                                  rwork,
                                  info);
+    case COMPAT_STRIDED:
+        return hipsolverDnCgesvdStridedBatched(handle,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               (hipFloatComplex*)A,
+                                               lda,
+                                               stA,
+                                               S,
+                                               stS,
+                                               (hipFloatComplex*)U,
+                                               ldu,
+                                               stU,
+                                               (hipFloatComplex*)V,
+                                               ldv,
+                                               stV,
+                                               (hipFloatComplex*)work,
+                                               lwork,
+                                               rwork,
+                                               stRW,
+                                               info,
+                                               bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
+                                         bool                    STRIDED,
                                          bool                    NRWK,
                                          hipsolverHandle_t       handle,
                                          signed char             jobu,
@@ -2679,7 +3237,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(api2marshal(API, NRWK))
+    switch(api2marshal(API, NRWK, STRIDED))
     {
     case C_NORMAL:
         return hipsolverZgesvd(handle,
@@ -2715,6 +3273,52 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                lwork,
                                nullptr,
                                info);
+    case C_STRIDED:
+        return hipsolverZgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             (hipDoubleComplex*)U,
+                                             ldu,
+                                             stU,
+                                             (hipDoubleComplex*)V,
+                                             ldv,
+                                             stV,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case C_STRIDED_ALT:
+        return hipsolverZgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             (hipDoubleComplex*)U,
+                                             ldu,
+                                             stU,
+                                             (hipDoubleComplex*)V,
+                                             ldv,
+                                             stV,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             nullptr,
+                                             stRW,
+                                             info,
+                                             bc);
     case FORTRAN_NORMAL:
         return hipsolverZgesvdFortran(handle,
                                       jobu,
@@ -2732,6 +3336,29 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                       lwork,
                                       rwork,
                                       info);
+    case FORTRAN_STRIDED:
+        return hipsolverZgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    (hipDoubleComplex*)A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    (hipDoubleComplex*)U,
+                                                    ldu,
+                                                    stU,
+                                                    (hipDoubleComplex*)V,
+                                                    ldv,
+                                                    stV,
+                                                    (hipDoubleComplex*)work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
     case COMPAT_NORMAL:
         return hipsolverDnZgesvd(handle,
                                  jobu,
@@ -2749,6 +3376,29 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                  lwork,
                                  rwork,
                                  info);
+    case COMPAT_STRIDED:
+        return hipsolverDnZgesvdStridedBatched(handle,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               (hipDoubleComplex*)A,
+                                               lda,
+                                               stA,
+                                               S,
+                                               stS,
+                                               (hipDoubleComplex*)U,
+                                               ldu,
+                                               stU,
+                                               (hipDoubleComplex*)V,
+                                               ldv,
+                                               stV,
+                                               (hipDoubleComplex*)work,
+                                               lwork,
+                                               rwork,
+                                               stRW,
+                                               info,
+                                               bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
@@ -3337,6 +3987,228 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
 }
 /********************************************************/
 
+/******************** GETRF_VBATCHED ********************/
+inline hipsolverStatus_t hipsolver_getrf_vbatched_bufferSize(testAPI_t         API,
+                                                             hipsolverHandle_t handle,
+                                                             const int*        m,
+                                                             const int*        n,
+                                                             float*            A[],
+                                                             const int*        lda,
+                                                             int*              lwork,
+                                                             int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSgetrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_vbatched_bufferSize(testAPI_t         API,
+                                                             hipsolverHandle_t handle,
+                                                             const int*        m,
+                                                             const int*        n,
+                                                             double*           A[],
+                                                             const int*        lda,
+                                                             int*              lwork,
+                                                             int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDgetrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_vbatched_bufferSize(testAPI_t         API,
+                                                             hipsolverHandle_t handle,
+                                                             const int*        m,
+                                                             const int*        n,
+                                                             hipsolverComplex* A[],
+                                                             const int*        lda,
+                                                             int*              lwork,
+                                                             int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCgetrfVbatched_bufferSize(
+            handle, m, n, (hipFloatComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCgetrfVbatched_bufferSizeFortran(
+            handle, m, n, (hipFloatComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_vbatched_bufferSize(testAPI_t               API,
+                                                             hipsolverHandle_t       handle,
+                                                             const int*              m,
+                                                             const int*              n,
+                                                             hipsolverDoubleComplex* A[],
+                                                             const int*              lda,
+                                                             int*                    lwork,
+                                                             int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZgetrfVbatched_bufferSize(
+            handle, m, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverZgetrfVbatched_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_vbatched(testAPI_t         API,
+                                                  hipsolverHandle_t handle,
+                                                  const int*        m,
+                                                  const int*        n,
+                                                  float*            A[],
+                                                  const int*        lda,
+                                                  float*            work,
+                                                  int               lwork,
+                                                  int*              ipiv,
+                                                  int*              info,
+                                                  int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSgetrfVbatched(
+            handle, m, n, A, lda, work, lwork, ipiv, info, bc);
+    case API_FORTRAN:
+        return hipsolverSgetrfVbatchedFortran(
+            handle, m, n, A, lda, work, lwork, ipiv, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_vbatched(testAPI_t         API,
+                                                  hipsolverHandle_t handle,
+                                                  const int*        m,
+                                                  const int*        n,
+                                                  double*           A[],
+                                                  const int*        lda,
+                                                  double*           work,
+                                                  int               lwork,
+                                                  int*              ipiv,
+                                                  int*              info,
+                                                  int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDgetrfVbatched(
+            handle, m, n, A, lda, work, lwork, ipiv, info, bc);
+    case API_FORTRAN:
+        return hipsolverDgetrfVbatchedFortran(
+            handle, m, n, A, lda, work, lwork, ipiv, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_vbatched(testAPI_t         API,
+                                                  hipsolverHandle_t handle,
+                                                  const int*        m,
+                                                  const int*        n,
+                                                  hipsolverComplex* A[],
+                                                  const int*        lda,
+                                                  hipsolverComplex* work,
+                                                  int               lwork,
+                                                  int*              ipiv,
+                                                  int*              info,
+                                                  int               bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCgetrfVbatched(handle,
+                                       m,
+                                       n,
+                                       (hipFloatComplex**)A,
+                                       lda,
+                                       (hipFloatComplex*)work,
+                                       lwork,
+                                       ipiv,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverCgetrfVbatchedFortran(handle,
+                                              m,
+                                              n,
+                                              (hipFloatComplex**)A,
+                                              lda,
+                                              (hipFloatComplex*)work,
+                                              lwork,
+                                              ipiv,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_vbatched(testAPI_t               API,
+                                                  hipsolverHandle_t       handle,
+                                                  const int*              m,
+                                                  const int*              n,
+                                                  hipsolverDoubleComplex* A[],
+                                                  const int*              lda,
+                                                  hipsolverDoubleComplex* work,
+                                                  int                     lwork,
+                                                  int*                    ipiv,
+                                                  int*                    info,
+                                                  int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZgetrfVbatched(handle,
+                                       m,
+                                       n,
+                                       (hipDoubleComplex**)A,
+                                       lda,
+                                       (hipDoubleComplex*)work,
+                                       lwork,
+                                       ipiv,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverZgetrfVbatchedFortran(handle,
+                                              m,
+                                              n,
+                                              (hipDoubleComplex**)A,
+                                              lda,
+                                              (hipDoubleComplex*)work,
+                                              lwork,
+                                              ipiv,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
 /******************** GETRS ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
@@ -3654,644 +4526,1184 @@ inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
 }
 /********************************************************/
 
-/******************** POTRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+/******************** GTSV ********************/
+inline hipsolverStatus_t hipsolver_gtsv_bufferSize(testAPI_t         API,
+                                                   bool              NOPIVOT,
+                                                   bool              STRIDED,
+                                                   hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            dl,
+                                                   float*            d,
+                                                   float*            du,
+                                                   int               stD,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   int               stB,
+                                                   int*              lwork,
+                                                   int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, NOPIVOT, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverSgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverSgtsvStridedBatched_bufferSize(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
+    case C_STRIDED_ALT:
+        return hipsolverSgtsvNopivotStridedBatched_bufferSize(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgtsv_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSgtsvNopivot_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverSgtsvStridedBatched_bufferSizeFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverSgtsvNopivotStridedBatched_bufferSizeFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_gtsv_bufferSize(testAPI_t         API,
+                                                   bool              NOPIVOT,
+                                                   bool              STRIDED,
+                                                   hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           dl,
+                                                   double*           d,
+                                                   double*           du,
+                                                   int               stD,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   int               stB,
+                                                   int*              lwork,
+                                                   int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, NOPIVOT, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverDgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverDgtsvStridedBatched_bufferSize(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
+    case C_STRIDED_ALT:
+        return hipsolverDgtsvNopivotStridedBatched_bufferSize(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgtsv_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDgtsvNopivot_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverDgtsvStridedBatched_bufferSizeFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverDgtsvNopivotStridedBatched_bufferSizeFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_gtsv_bufferSize(testAPI_t         API,
+                                                   bool              NOPIVOT,
+                                                   bool              STRIDED,
+                                                   hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipsolverComplex* dl,
+                                                   hipsolverComplex* d,
+                                                   hipsolverComplex* du,
+                                                   int               stD,
+                                                   hipsolverComplex* B,
+                                                   int               ldb,
+                                                   int               stB,
+                                                   int*              lwork,
+                                                   int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, NOPIVOT, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverCgtsv_bufferSize(handle,
+                                         n,
+                                         nrhs,
+                                         (hipFloatComplex*)dl,
+                                         (hipFloatComplex*)d,
+                                         (hipFloatComplex*)du,
+                                         (hipFloatComplex*)B,
+                                         ldb,
+                                         lwork);
+    case C_NORMAL_ALT:
+        return hipsolverCgtsvNopivot_bufferSize(handle,
+                                                n,
+                                                nrhs,
+                                                (hipFloatComplex*)dl,
+                                                (hipFloatComplex*)d,
+                                                (hipFloatComplex*)du,
+                                                (hipFloatComplex*)B,
+                                                ldb,
+                                                lwork);
+    case C_STRIDED:
+        return hipsolverCgtsvStridedBatched_bufferSize(handle,
+                                                       n,
+                                                       nrhs,
+                                                       (hipFloatComplex*)dl,
+                                                       (hipFloatComplex*)d,
+                                                       (hipFloatComplex*)du,
+                                                       stD,
+                                                       (hipFloatComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
+    case C_STRIDED_ALT:
+        return hipsolverCgtsvNopivotStridedBatched_bufferSize(handle,
+                                                              n,
+                                                              nrhs,
+                                                              (hipFloatComplex*)dl,
+                                                              (hipFloatComplex*)d,
+                                                              (hipFloatComplex*)du,
+                                                              stD,
+                                                              (hipFloatComplex*)B,
+                                                              ldb,
+                                                              stB,
+                                                              lwork,
+                                                              bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgtsv_bufferSizeFortran(handle,
+                                                n,
+                                                nrhs,
+                                                (hipFloatComplex*)dl,
+                                                (hipFloatComplex*)d,
+                                                (hipFloatComplex*)du,
+                                                (hipFloatComplex*)B,
+                                                ldb,
+                                                lwork);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCgtsvNopivot_bufferSizeFortran(handle,
+                                                       n,
+                                                       nrhs,
+                                                       (hipFloatComplex*)dl,
+                                                       (hipFloatComplex*)d,
+                                                       (hipFloatComplex*)du,
+                                                       (hipFloatComplex*)B,
+                                                       ldb,
+                                                       lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverCgtsvStridedBatched_bufferSizeFortran(handle,
+                                                              n,
+                                                              nrhs,
+                                                              (hipFloatComplex*)dl,
+                                                              (hipFloatComplex*)d,
+                                                              (hipFloatComplex*)du,
+                                                              stD,
+                                                              (hipFloatComplex*)B,
+                                                              ldb,
+                                                              stB,
+                                                              lwork,
+                                                              bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverCgtsvNopivotStridedBatched_bufferSizeFortran(handle,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (hipFloatComplex*)dl,
+                                                                     (hipFloatComplex*)d,
+                                                                     (hipFloatComplex*)du,
+                                                                     stD,
+                                                                     (hipFloatComplex*)B,
+                                                                     ldb,
+                                                                     stB,
+                                                                     lwork,
+                                                                     bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork,
-                                                    int                     bc)
+inline hipsolverStatus_t hipsolver_gtsv_bufferSize(testAPI_t               API,
+                                                   bool                    NOPIVOT,
+                                                   bool                    STRIDED,
+                                                   hipsolverHandle_t       handle,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* dl,
+                                                   hipsolverDoubleComplex* d,
+                                                   hipsolverDoubleComplex* du,
+                                                   int                     stD,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   int                     stB,
+                                                   int*                    lwork,
+                                                   int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, NOPIVOT, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverZgtsv_bufferSize(handle,
+                                         n,
+                                         nrhs,
+                                         (hipDoubleComplex*)dl,
+                                         (hipDoubleComplex*)d,
+                                         (hipDoubleComplex*)du,
+                                         (hipDoubleComplex*)B,
+                                         ldb,
+                                         lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZgtsvNopivot_bufferSize(handle,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex*)dl,
+                                                (hipDoubleComplex*)d,
+                                                (hipDoubleComplex*)du,
+                                                (hipDoubleComplex*)B,
+                                                ldb,
+                                                lwork);
+    case C_STRIDED:
+        return hipsolverZgtsvStridedBatched_bufferSize(handle,
+                                                       n,
+                                                       nrhs,
+                                                       (hipDoubleComplex*)dl,
+                                                       (hipDoubleComplex*)d,
+                                                       (hipDoubleComplex*)du,
+                                                       stD,
+                                                       (hipDoubleComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
+    case C_STRIDED_ALT:
+        return hipsolverZgtsvNopivotStridedBatched_bufferSize(handle,
+                                                              n,
+                                                              nrhs,
+                                                              (hipDoubleComplex*)dl,
+                                                              (hipDoubleComplex*)d,
+                                                              (hipDoubleComplex*)du,
+                                                              stD,
+                                                              (hipDoubleComplex*)B,
+                                                              ldb,
+                                                              stB,
+                                                              lwork,
+                                                              bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgtsv_bufferSizeFortran(handle,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex*)dl,
+                                                (hipDoubleComplex*)d,
+                                                (hipDoubleComplex*)du,
+                                                (hipDoubleComplex*)B,
+                                                ldb,
+                                                lwork);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZgtsvNopivot_bufferSizeFortran(handle,
+                                                       n,
+                                                       nrhs,
+                                                       (hipDoubleComplex*)dl,
+                                                       (hipDoubleComplex*)d,
+                                                       (hipDoubleComplex*)du,
+                                                       (hipDoubleComplex*)B,
+                                                       ldb,
+                                                       lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverZgtsvStridedBatched_bufferSizeFortran(handle,
+                                                              n,
+                                                              nrhs,
+                                                              (hipDoubleComplex*)dl,
+                                                              (hipDoubleComplex*)d,
+                                                              (hipDoubleComplex*)du,
+                                                              stD,
+                                                              (hipDoubleComplex*)B,
+                                                              ldb,
+                                                              stB,
+                                                              lwork,
+                                                              bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverZgtsvNopivotStridedBatched_bufferSizeFortran(handle,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (hipDoubleComplex*)dl,
+                                                                     (hipDoubleComplex*)d,
+                                                                     (hipDoubleComplex*)du,
+                                                                     stD,
+                                                                     (hipDoubleComplex*)B,
+                                                                     ldb,
+                                                                     stB,
+                                                                     lwork,
+                                                                     bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gtsv(testAPI_t         API,
+                                        bool              NOPIVOT,
+                                        bool              STRIDED,
+                                        hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        float*            dl,
+                                        float*            d,
+                                        float*            du,
+                                        int               stD,
+                                        float*            B,
+                                        int               ldb,
+                                        int               stB,
+                                        float*            work,
+                                        int               lwork,
+                                        int*              info,
+                                        int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, NOPIVOT, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    case C_NORMAL:
+        return hipsolverSgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSgtsvStridedBatched(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverSgtsvNopivotStridedBatched(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgtsvFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSgtsvNopivotFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverSgtsvStridedBatchedFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverSgtsvNopivotStridedBatchedFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gtsv(testAPI_t         API,
+                                        bool              NOPIVOT,
+                                        bool              STRIDED,
+                                        hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           dl,
+                                        double*           d,
+                                        double*           du,
+                                        int               stD,
+                                        double*           B,
+                                        int               ldb,
+                                        int               stB,
+                                        double*           work,
+                                        int               lwork,
+                                        int*              info,
+                                        int               bc)
 {
-    switch(API)
+    switch(api2marshal(API, NOPIVOT, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    case C_NORMAL:
+        return hipsolverDgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDgtsvStridedBatched(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverDgtsvNopivotStridedBatched(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgtsvFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDgtsvNopivotFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverDgtsvStridedBatchedFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverDgtsvNopivotStridedBatchedFortran(
+            handle, n, nrhs, dl, d, du, stD, B, ldb, stB, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverCpotrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverCpotrfFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnCpotrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+inline hipsolverStatus_t hipsolver_gtsv(testAPI_t         API,
+                                        bool              NOPIVOT,
+                                        bool              STRIDED,
+                                        hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        hipsolverComplex* dl,
+                                        hipsolverComplex* d,
+                                        hipsolverComplex* du,
+                                        int               stD,
+                                        hipsolverComplex* B,
+                                        int               ldb,
+                                        int               stB,
+                                        hipsolverComplex* work,
+                                        int               lwork,
+                                        int*              info,
+                                        int               bc)
+{
+    switch(api2marshal(API, NOPIVOT, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCgtsv(handle,
+                              n,
+                              nrhs,
+                              (hipFloatComplex*)dl,
+                              (hipFloatComplex*)d,
+                              (hipFloatComplex*)du,
+                              (hipFloatComplex*)B,
+                              ldb,
+                              (hipFloatComplex*)work,
+                              lwork,
+                              info);
+    case C_NORMAL_ALT:
+        return hipsolverCgtsvNopivot(handle,
+                                     n,
+                                     nrhs,
+                                     (hipFloatComplex*)dl,
+                                     (hipFloatComplex*)d,
+                                     (hipFloatComplex*)du,
+                                     (hipFloatComplex*)B,
+                                     ldb,
+                                     (hipFloatComplex*)work,
+                                     lwork,
+                                     info);
+    case C_STRIDED:
+        return hipsolverCgtsvStridedBatched(handle,
+                                            n,
+                                            nrhs,
+                                            (hipFloatComplex*)dl,
+                                            (hipFloatComplex*)d,
+                                            (hipFloatComplex*)du,
+                                            stD,
+                                            (hipFloatComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    case C_STRIDED_ALT:
+        return hipsolverCgtsvNopivotStridedBatched(handle,
+                                                   n,
+                                                   nrhs,
+                                                   (hipFloatComplex*)dl,
+                                                   (hipFloatComplex*)d,
+                                                   (hipFloatComplex*)du,
+                                                   stD,
+                                                   (hipFloatComplex*)B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipFloatComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgtsvFortran(handle,
+                                     n,
+                                     nrhs,
+                                     (hipFloatComplex*)dl,
+                                     (hipFloatComplex*)d,
+                                     (hipFloatComplex*)du,
+                                     (hipFloatComplex*)B,
+                                     ldb,
+                                     (hipFloatComplex*)work,
+                                     lwork,
+                                     info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCgtsvNopivotFortran(handle,
+                                            n,
+                                            nrhs,
+                                            (hipFloatComplex*)dl,
+                                            (hipFloatComplex*)d,
+                                            (hipFloatComplex*)du,
+                                            (hipFloatComplex*)B,
+                                            ldb,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info);
+    case FORTRAN_STRIDED:
+        return hipsolverCgtsvStridedBatchedFortran(handle,
+                                                   n,
+                                                   nrhs,
+                                                   (hipFloatComplex*)dl,
+                                                   (hipFloatComplex*)d,
+                                                   (hipFloatComplex*)du,
+                                                   stD,
+                                                   (hipFloatComplex*)B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipFloatComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverCgtsvNopivotStridedBatchedFortran(handle,
+                                                          n,
+                                                          nrhs,
+                                                          (hipFloatComplex*)dl,
+                                                          (hipFloatComplex*)d,
+                                                          (hipFloatComplex*)du,
+                                                          stD,
+                                                          (hipFloatComplex*)B,
+                                                          ldb,
+                                                          stB,
+                                                          (hipFloatComplex*)work,
+                                                          lwork,
+                                                          info,
+                                                          bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_gtsv(testAPI_t               API,
+                                        bool                    NOPIVOT,
+                                        bool                    STRIDED,
+                                        hipsolverHandle_t       handle,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* dl,
+                                        hipsolverDoubleComplex* d,
+                                        hipsolverDoubleComplex* du,
+                                        int                     stD,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info,
+                                        int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, NOPIVOT, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverZpotrfFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnZpotrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    case C_NORMAL:
+        return hipsolverZgtsv(handle,
+                              n,
+                              nrhs,
+                              (hipDoubleComplex*)dl,
+                              (hipDoubleComplex*)d,
+                              (hipDoubleComplex*)du,
+                              (hipDoubleComplex*)B,
+                              ldb,
+                              (hipDoubleComplex*)work,
+                              lwork,
+                              info);
+    case C_NORMAL_ALT:
+        return hipsolverZgtsvNopivot(handle,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex*)dl,
+                                     (hipDoubleComplex*)d,
+                                     (hipDoubleComplex*)du,
+                                     (hipDoubleComplex*)B,
+                                     ldb,
+                                     (hipDoubleComplex*)work,
+                                     lwork,
+                                     info);
+    case C_STRIDED:
+        return hipsolverZgtsvStridedBatched(handle,
+                                            n,
+                                            nrhs,
+                                            (hipDoubleComplex*)dl,
+                                            (hipDoubleComplex*)d,
+                                            (hipDoubleComplex*)du,
+                                            stD,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    case C_STRIDED_ALT:
+        return hipsolverZgtsvNopivotStridedBatched(handle,
+                                                   n,
+                                                   nrhs,
+                                                   (hipDoubleComplex*)dl,
+                                                   (hipDoubleComplex*)d,
+                                                   (hipDoubleComplex*)du,
+                                                   stD,
+                                                   (hipDoubleComplex*)B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipDoubleComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgtsvFortran(handle,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex*)dl,
+                                     (hipDoubleComplex*)d,
+                                     (hipDoubleComplex*)du,
+                                     (hipDoubleComplex*)B,
+                                     ldb,
+                                     (hipDoubleComplex*)work,
+                                     lwork,
+                                     info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZgtsvNopivotFortran(handle,
+                                            n,
+                                            nrhs,
+                                            (hipDoubleComplex*)dl,
+                                            (hipDoubleComplex*)d,
+                                            (hipDoubleComplex*)du,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info);
+    case FORTRAN_STRIDED:
+        return hipsolverZgtsvStridedBatchedFortran(handle,
+                                                   n,
+                                                   nrhs,
+                                                   (hipDoubleComplex*)dl,
+                                                   (hipDoubleComplex*)d,
+                                                   (hipDoubleComplex*)du,
+                                                   stD,
+                                                   (hipDoubleComplex*)B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipDoubleComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverZgtsvNopivotStridedBatchedFortran(handle,
+                                                          n,
+                                                          nrhs,
+                                                          (hipDoubleComplex*)dl,
+                                                          (hipDoubleComplex*)d,
+                                                          (hipDoubleComplex*)du,
+                                                          stD,
+                                                          (hipDoubleComplex*)B,
+                                                          ldb,
+                                                          stB,
+                                                          (hipDoubleComplex*)work,
+                                                          lwork,
+                                                          info,
+                                                          bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+/********************************************************/
 
-// batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+/******************** PBTRF ********************/
+inline hipsolverStatus_t hipsolver_pbtrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
+                                                    int                 kd,
+                                                    float*              AB,
+                                                    int                 ldab,
+                                                    int                 stA,
                                                     int*                lwork,
                                                     int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverSpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork);
+    case C_STRIDED:
+        return hipsolverSpbtrfStridedBatched_bufferSize(
+            handle, uplo, n, kd, AB, ldab, stA, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpbtrf_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverSpbtrfStridedBatched_bufferSizeFortran(
+            handle, uplo, n, kd, AB, ldab, stA, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
+                                                    int                 kd,
+                                                    double*             AB,
+                                                    int                 ldab,
+                                                    int                 stA,
                                                     int*                lwork,
                                                     int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverDpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork);
+    case C_STRIDED:
+        return hipsolverDpbtrfStridedBatched_bufferSize(
+            handle, uplo, n, kd, AB, ldab, stA, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpbtrf_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverDpbtrfStridedBatched_bufferSizeFortran(
+            handle, uplo, n, kd, AB, ldab, stA, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    hipsolverComplex*   A[],
-                                                    int                 lda,
+                                                    int                 kd,
+                                                    hipsolverComplex*   AB,
+                                                    int                 ldab,
+                                                    int                 stA,
                                                     int*                lwork,
                                                     int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrfBatched_bufferSize(
-            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverCpotrfBatched_bufferSizeFortran(
-            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverCpbtrf_bufferSize(handle, uplo, n, kd, (hipFloatComplex*)AB, ldab, lwork);
+    case C_STRIDED:
+        return hipsolverCpbtrfStridedBatched_bufferSize(
+            handle, uplo, n, kd, (hipFloatComplex*)AB, ldab, stA, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpbtrf_bufferSizeFortran(
+            handle, uplo, n, kd, (hipFloatComplex*)AB, ldab, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverCpbtrfStridedBatched_bufferSizeFortran(
+            handle, uplo, n, kd, (hipFloatComplex*)AB, ldab, stA, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_pbtrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverFillMode_t     uplo,
                                                     int                     n,
-                                                    hipsolverDoubleComplex* A[],
-                                                    int                     lda,
+                                                    int                     kd,
+                                                    hipsolverDoubleComplex* AB,
+                                                    int                     ldab,
+                                                    int                     stA,
                                                     int*                    lwork,
                                                     int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrfBatched_bufferSize(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverZpotrfBatched_bufferSizeFortran(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    case C_NORMAL:
+        return hipsolverZpbtrf_bufferSize(handle, uplo, n, kd, (hipDoubleComplex*)AB, ldab, lwork);
+    case C_STRIDED:
+        return hipsolverZpbtrfStridedBatched_bufferSize(
+            handle, uplo, n, kd, (hipDoubleComplex*)AB, ldab, stA, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpbtrf_bufferSizeFortran(
+            handle, uplo, n, kd, (hipDoubleComplex*)AB, ldab, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverZpbtrfStridedBatched_bufferSizeFortran(
+            handle, uplo, n, kd, (hipDoubleComplex*)AB, ldab, stA, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         float*              A[],
-                                         int                 lda,
+                                         int                 kd,
+                                         float*              AB,
+                                         int                 ldab,
                                          int                 stA,
                                          float*              work,
                                          int                 lwork,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnSpotrfBatched(handle, uplo, n, A, lda, info, bc);
+    case C_NORMAL:
+        return hipsolverSpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSpbtrfStridedBatched(
+            handle, uplo, n, kd, AB, ldab, stA, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpbtrfFortran(handle, uplo, n, kd, AB, ldab, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverSpbtrfStridedBatchedFortran(
+            handle, uplo, n, kd, AB, ldab, stA, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         double*             A[],
-                                         int                 lda,
+                                         int                 kd,
+                                         double*             AB,
+                                         int                 ldab,
                                          int                 stA,
                                          double*             work,
                                          int                 lwork,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnDpotrfBatched(handle, uplo, n, A, lda, info, bc);
+    case C_NORMAL:
+        return hipsolverDpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDpbtrfStridedBatched(
+            handle, uplo, n, kd, AB, ldab, stA, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpbtrfFortran(handle, uplo, n, kd, AB, ldab, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverDpbtrfStridedBatchedFortran(
+            handle, uplo, n, kd, AB, ldab, stA, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrf(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         hipsolverComplex*   A[],
-                                         int                 lda,
+                                         int                 kd,
+                                         hipsolverComplex*   AB,
+                                         int                 ldab,
                                          int                 stA,
                                          hipsolverComplex*   work,
                                          int                 lwork,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrfBatched(
-            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverCpotrfBatchedFortran(
-            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnCpotrfBatched(handle, uplo, n, (hipFloatComplex**)A, lda, info, bc);
+    case C_NORMAL:
+        return hipsolverCpbtrf(
+            handle, uplo, n, kd, (hipFloatComplex*)AB, ldab, (hipFloatComplex*)work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCpbtrfStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             kd,
+                                             (hipFloatComplex*)AB,
+                                             ldab,
+                                             stA,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpbtrfFortran(
+            handle, uplo, n, kd, (hipFloatComplex*)AB, ldab, (hipFloatComplex*)work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverCpbtrfStridedBatchedFortran(handle,
+                                                    uplo,
+                                                    n,
+                                                    kd,
+                                                    (hipFloatComplex*)AB,
+                                                    ldab,
+                                                    stA,
+                                                    (hipFloatComplex*)work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_pbtrf(testAPI_t               API,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverFillMode_t     uplo,
                                          int                     n,
-                                         hipsolverDoubleComplex* A[],
-                                         int                     lda,
+                                         int                     kd,
+                                         hipsolverDoubleComplex* AB,
+                                         int                     ldab,
                                          int                     stA,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrfBatched(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverZpotrfBatchedFortran(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnZpotrfBatched(handle, uplo, n, (hipDoubleComplex**)A, lda, info, bc);
+    case C_NORMAL:
+        return hipsolverZpbtrf(
+            handle, uplo, n, kd, (hipDoubleComplex*)AB, ldab, (hipDoubleComplex*)work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZpbtrfStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             kd,
+                                             (hipDoubleComplex*)AB,
+                                             ldab,
+                                             stA,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpbtrfFortran(
+            handle, uplo, n, kd, (hipDoubleComplex*)AB, ldab, (hipDoubleComplex*)work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverZpbtrfStridedBatchedFortran(handle,
+                                                    uplo,
+                                                    n,
+                                                    kd,
+                                                    (hipDoubleComplex*)AB,
+                                                    ldab,
+                                                    stA,
+                                                    (hipDoubleComplex*)work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** POTRI ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+/******************** PBTRS ********************/
+inline hipsolverStatus_t hipsolver_pbtrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lwork)
+                                                    int                 kd,
+                                                    int                 nrhs,
+                                                    float*              AB,
+                                                    int                 ldab,
+                                                    int                 stA,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork);
-    else
-        return hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverSpbtrsStridedBatched_bufferSize(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpbtrs_bufferSizeFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverSpbtrsStridedBatched_bufferSizeFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_pbtrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lwork)
+                                                    int                 kd,
+                                                    int                 nrhs,
+                                                    double*             AB,
+                                                    int                 ldab,
+                                                    int                 stA,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork);
-    else
-        return hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverDpbtrsStridedBatched_bufferSize(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpbtrs_bufferSizeFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverDpbtrsStridedBatched_bufferSizeFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_pbtrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
                                                     hipsolverHandle_t   handle,
                                                     hipsolverFillMode_t uplo,
                                                     int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lwork)
-{
-    if(!FORTRAN)
-        return hipsolverCpotri_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    else
-        return hipsolverCpotri_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork)
+                                                    int                 kd,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   AB,
+                                                    int                 ldab,
+                                                    int                 stA,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverZpotri_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    else
-        return hipsolverZpotri_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    if(!FORTRAN)
-        return hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info);
-    else
-        return hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
-}
-
-inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    if(!FORTRAN)
-        return hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info);
-    else
-        return hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
-}
-
-inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    if(!FORTRAN)
-        return hipsolverCpotri(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    else
-        return hipsolverCpotriFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-}
-
-inline hipsolverStatus_t hipsolver_potri(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
-{
-    if(!FORTRAN)
-        return hipsolverZpotri(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    else
-        return hipsolverZpotriFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-}
-/********************************************************/
-
-/******************** POTRS ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    float*              B,
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
-    default:
-        *lwork = 0;
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
-
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    double*             B,
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
-    default:
-        *lwork = 0;
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
-
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    hipsolverComplex*   B,
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
-{
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrs_bufferSize(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverCpotrs_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    case C_NORMAL:
+        return hipsolverCpbtrs_bufferSize(
+            handle, uplo, n, kd, nrhs, (hipFloatComplex*)AB, ldab, (hipFloatComplex*)B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverCpbtrsStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        kd,
+                                                        nrhs,
+                                                        (hipFloatComplex*)AB,
+                                                        ldab,
+                                                        stA,
+                                                        (hipFloatComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpbtrs_bufferSizeFortran(
+            handle, uplo, n, kd, nrhs, (hipFloatComplex*)AB, ldab, (hipFloatComplex*)B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverCpbtrsStridedBatched_bufferSizeFortran(handle,
+                                                               uplo,
+                                                               n,
+                                                               kd,
+                                                               nrhs,
+                                                               (hipFloatComplex*)AB,
+                                                               ldab,
+                                                               stA,
+                                                               (hipFloatComplex*)B,
+                                                               ldb,
+                                                               stB,
+                                                               lwork,
+                                                               bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_pbtrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverFillMode_t     uplo,
                                                     int                     n,
+                                                    int                     kd,
                                                     int                     nrhs,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
+                                                    hipsolverDoubleComplex* AB,
+                                                    int                     ldab,
+                                                    int                     stA,
                                                     hipsolverDoubleComplex* B,
                                                     int                     ldb,
+                                                    int                     stB,
                                                     int*                    lwork,
                                                     int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrs_bufferSize(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverZpotrs_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    case C_NORMAL:
+        return hipsolverZpbtrs_bufferSize(handle,
+                                          uplo,
+                                          n,
+                                          kd,
+                                          nrhs,
+                                          (hipDoubleComplex*)AB,
+                                          ldab,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          lwork);
+    case C_STRIDED:
+        return hipsolverZpbtrsStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        kd,
+                                                        nrhs,
+                                                        (hipDoubleComplex*)AB,
+                                                        ldab,
+                                                        stA,
+                                                        (hipDoubleComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpbtrs_bufferSizeFortran(handle,
+                                                 uplo,
+                                                 n,
+                                                 kd,
+                                                 nrhs,
+                                                 (hipDoubleComplex*)AB,
+                                                 ldab,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverZpbtrsStridedBatched_bufferSizeFortran(handle,
+                                                               uplo,
+                                                               n,
+                                                               kd,
+                                                               nrhs,
+                                                               (hipDoubleComplex*)AB,
+                                                               ldab,
+                                                               stA,
+                                                               (hipDoubleComplex*)B,
+                                                               ldb,
+                                                               stB,
+                                                               lwork,
+                                                               bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrs(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
+                                         int                 kd,
                                          int                 nrhs,
-                                         float*              A,
-                                         int                 lda,
+                                         float*              AB,
+                                         int                 ldab,
                                          int                 stA,
                                          float*              B,
                                          int                 ldb,
@@ -4301,26 +5713,33 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+    case C_NORMAL:
+        return hipsolverSpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSpbtrsStridedBatched(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpbtrsFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverSpbtrsStridedBatchedFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrs(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
+                                         int                 kd,
                                          int                 nrhs,
-                                         double*             A,
-                                         int                 lda,
+                                         double*             AB,
+                                         int                 ldab,
                                          int                 stA,
                                          double*             B,
                                          int                 ldb,
@@ -4330,26 +5749,33 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+    case C_NORMAL:
+        return hipsolverDpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDpbtrsStridedBatched(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpbtrsFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverDpbtrsStridedBatchedFortran(
+            handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb, stB, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_pbtrs(testAPI_t           API,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
+                                         int                 kd,
                                          int                 nrhs,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
+                                         hipsolverComplex*   AB,
+                                         int                 ldab,
                                          int                 stA,
                                          hipsolverComplex*   B,
                                          int                 ldb,
@@ -4359,47 +5785,80 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
                                          int*                info,
                                          int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrs(handle,
+    case C_NORMAL:
+        return hipsolverCpbtrs(handle,
                                uplo,
                                n,
+                               kd,
                                nrhs,
-                               (hipFloatComplex*)A,
-                               lda,
+                               (hipFloatComplex*)AB,
+                               ldab,
                                (hipFloatComplex*)B,
                                ldb,
                                (hipFloatComplex*)work,
                                lwork,
                                info);
-    case API_FORTRAN:
-        return hipsolverCpotrsFortran(handle,
+    case C_STRIDED:
+        return hipsolverCpbtrsStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             kd,
+                                             nrhs,
+                                             (hipFloatComplex*)AB,
+                                             ldab,
+                                             stA,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpbtrsFortran(handle,
                                       uplo,
                                       n,
+                                      kd,
                                       nrhs,
-                                      (hipFloatComplex*)A,
-                                      lda,
+                                      (hipFloatComplex*)AB,
+                                      ldab,
                                       (hipFloatComplex*)B,
                                       ldb,
                                       (hipFloatComplex*)work,
                                       lwork,
                                       info);
-    case API_COMPAT:
-        return hipsolverDnCpotrs(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, info);
+    case FORTRAN_STRIDED:
+        return hipsolverCpbtrsStridedBatchedFortran(handle,
+                                                    uplo,
+                                                    n,
+                                                    kd,
+                                                    nrhs,
+                                                    (hipFloatComplex*)AB,
+                                                    ldab,
+                                                    stA,
+                                                    (hipFloatComplex*)B,
+                                                    ldb,
+                                                    stB,
+                                                    (hipFloatComplex*)work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_pbtrs(testAPI_t               API,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverFillMode_t     uplo,
                                          int                     n,
+                                         int                     kd,
                                          int                     nrhs,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
+                                         hipsolverDoubleComplex* AB,
+                                         int                     ldab,
                                          int                     stA,
                                          hipsolverDoubleComplex* B,
                                          int                     ldb,
@@ -4409,25 +5868,3114 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, false, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrs(handle,
+    case C_NORMAL:
+        return hipsolverZpbtrs(handle,
                                uplo,
                                n,
+                               kd,
                                nrhs,
-                               (hipDoubleComplex*)A,
-                               lda,
+                               (hipDoubleComplex*)AB,
+                               ldab,
                                (hipDoubleComplex*)B,
                                ldb,
                                (hipDoubleComplex*)work,
                                lwork,
                                info);
-    case API_FORTRAN:
-        return hipsolverZpotrsFortran(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
+    case C_STRIDED:
+        return hipsolverZpbtrsStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             kd,
+                                             nrhs,
+                                             (hipDoubleComplex*)AB,
+                                             ldab,
+                                             stA,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpbtrsFortran(handle,
+                                      uplo,
+                                      n,
+                                      kd,
+                                      nrhs,
+                                      (hipDoubleComplex*)AB,
+                                      ldab,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    case FORTRAN_STRIDED:
+        return hipsolverZpbtrsStridedBatchedFortran(handle,
+                                                    uplo,
+                                                    n,
+                                                    kd,
+                                                    nrhs,
+                                                    (hipDoubleComplex*)AB,
+                                                    ldab,
+                                                    stA,
+                                                    (hipDoubleComplex*)B,
+                                                    ldb,
+                                                    stB,
+                                                    (hipDoubleComplex*)work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POSV ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverSposvStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSposv_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverSposvStridedBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverDposvStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDposv_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverDposvStridedBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   hipsolverComplex*   B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCposv_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverCposvStridedBatched_bufferSize(handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       (hipFloatComplex*)A,
+                                                       lda,
+                                                       stA,
+                                                       (hipFloatComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCposv_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverCposvStridedBatched_bufferSizeFortran(handle,
+                                                              uplo,
+                                                              n,
+                                                              nrhs,
+                                                              (hipFloatComplex*)A,
+                                                              lda,
+                                                              stA,
+                                                              (hipFloatComplex*)B,
+                                                              ldb,
+                                                              stB,
+                                                              lwork,
+                                                              bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t               API,
+                                                   bool                    STRIDED,
+                                                   hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int                     stA,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   int                     stB,
+                                                   int*                    lwork,
+                                                   int                     bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZposv_bufferSize(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverZposvStridedBatched_bufferSize(handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       (hipDoubleComplex*)A,
+                                                       lda,
+                                                       stA,
+                                                       (hipDoubleComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZposv_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverZposvStridedBatched_bufferSizeFortran(handle,
+                                                              uplo,
+                                                              n,
+                                                              nrhs,
+                                                              (hipDoubleComplex*)A,
+                                                              lda,
+                                                              stA,
+                                                              (hipDoubleComplex*)B,
+                                                              ldb,
+                                                              stB,
+                                                              lwork,
+                                                              bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A,
+                                        int                 lda,
+                                        int                 stA,
+                                        float*              B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSposvStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSposvFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverSposvStridedBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A,
+                                        int                 lda,
+                                        int                 stA,
+                                        double*             B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDposvStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDposvFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverDposvStridedBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipsolverComplex*   A,
+                                        int                 lda,
+                                        int                 stA,
+                                        hipsolverComplex*   B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        hipsolverComplex*   work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCposv(handle,
+                              uplo,
+                              n,
+                              nrhs,
+                              (hipFloatComplex*)A,
+                              lda,
+                              (hipFloatComplex*)B,
+                              ldb,
+                              (hipFloatComplex*)work,
+                              lwork,
+                              info);
+    case C_STRIDED:
+        return hipsolverCposvStridedBatched(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipFloatComplex*)A,
+                                            lda,
+                                            stA,
+                                            (hipFloatComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCposvFortran(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     (hipFloatComplex*)A,
+                                     lda,
+                                     (hipFloatComplex*)B,
+                                     ldb,
+                                     (hipFloatComplex*)work,
+                                     lwork,
+                                     info);
+    case FORTRAN_STRIDED:
+        return hipsolverCposvStridedBatchedFortran(handle,
+                                                   uplo,
+                                                   n,
+                                                   nrhs,
+                                                   (hipFloatComplex*)A,
+                                                   lda,
+                                                   stA,
+                                                   (hipFloatComplex*)B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipFloatComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t               API,
+                                        bool                    STRIDED,
+                                        hipsolverHandle_t       handle,
+                                        hipsolverFillMode_t     uplo,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        int                     stA,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info,
+                                        int                     bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZposv(handle,
+                              uplo,
+                              n,
+                              nrhs,
+                              (hipDoubleComplex*)A,
+                              lda,
+                              (hipDoubleComplex*)B,
+                              ldb,
+                              (hipDoubleComplex*)work,
+                              lwork,
+                              info);
+    case C_STRIDED:
+        return hipsolverZposvStridedBatched(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipDoubleComplex*)A,
+                                            lda,
+                                            stA,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZposvFortran(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex*)A,
+                                     lda,
+                                     (hipDoubleComplex*)B,
+                                     ldb,
+                                     (hipDoubleComplex*)work,
+                                     lwork,
+                                     info);
+    case FORTRAN_STRIDED:
+        return hipsolverZposvStridedBatchedFortran(handle,
+                                                   uplo,
+                                                   n,
+                                                   nrhs,
+                                                   (hipDoubleComplex*)A,
+                                                   lda,
+                                                   stA,
+                                                   (hipDoubleComplex*)B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipDoubleComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A[],
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   float*              B[],
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverSposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSposvBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A[],
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   double*             B[],
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverDposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDposvBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   A[],
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   hipsolverComplex*   B[],
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverCposvBatched_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCposvBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t               API,
+                                                   bool                    STRIDED,
+                                                   hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A[],
+                                                   int                     lda,
+                                                   int                     stA,
+                                                   hipsolverDoubleComplex* B[],
+                                                   int                     ldb,
+                                                   int                     stB,
+                                                   int*                    lwork,
+                                                   int                     bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverZposvBatched_bufferSize(handle,
+                                                uplo,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex**)A,
+                                                lda,
+                                                (hipDoubleComplex**)B,
+                                                ldb,
+                                                lwork,
+                                                bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZposvBatched_bufferSizeFortran(handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       (hipDoubleComplex**)A,
+                                                       lda,
+                                                       (hipDoubleComplex**)B,
+                                                       ldb,
+                                                       lwork,
+                                                       bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A[],
+                                        int                 lda,
+                                        int                 stA,
+                                        float*              B[],
+                                        int                 ldb,
+                                        int                 stB,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverSposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSposvBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A[],
+                                        int                 lda,
+                                        int                 stA,
+                                        double*             B[],
+                                        int                 ldb,
+                                        int                 stB,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverDposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDposvBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipsolverComplex*   A[],
+                                        int                 lda,
+                                        int                 stA,
+                                        hipsolverComplex*   B[],
+                                        int                 ldb,
+                                        int                 stB,
+                                        hipsolverComplex*   work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverCposvBatched(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     (hipFloatComplex**)A,
+                                     lda,
+                                     (hipFloatComplex**)B,
+                                     ldb,
+                                     (hipFloatComplex*)work,
+                                     lwork,
+                                     info,
+                                     bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCposvBatchedFortran(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipFloatComplex**)A,
+                                            lda,
+                                            (hipFloatComplex**)B,
+                                            ldb,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_posv(testAPI_t               API,
+                                        bool                    STRIDED,
+                                        hipsolverHandle_t       handle,
+                                        hipsolverFillMode_t     uplo,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A[],
+                                        int                     lda,
+                                        int                     stA,
+                                        hipsolverDoubleComplex* B[],
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info,
+                                        int                     bc)
+{
+    switch(api2marshal(API, false))
+    {
+    case C_NORMAL:
+        return hipsolverZposvBatched(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex**)A,
+                                     lda,
+                                     (hipDoubleComplex**)B,
+                                     ldb,
+                                     (hipDoubleComplex*)work,
+                                     lwork,
+                                     info,
+                                     bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZposvBatchedFortran(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipDoubleComplex**)A,
+                                            lda,
+                                            (hipDoubleComplex**)B,
+                                            ldb,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnSpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnDpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrf(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverCpotrfFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnCpotrf(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrf(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverZpotrfFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnZpotrf(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfBatched_bufferSize(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfBatched_bufferSizeFortran(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfBatched_bufferSize(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfBatched_bufferSizeFortran(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnSpotrfBatched(handle, uplo, n, A, lda, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnDpotrfBatched(handle, uplo, n, A, lda, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfBatched(
+            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfBatchedFortran(
+            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnCpotrfBatched(handle, uplo, n, (hipFloatComplex**)A, lda, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfBatched(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfBatchedFortran(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnZpotrfBatched(handle, uplo, n, (hipDoubleComplex**)A, lda, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRF_VBATCHED ********************/
+inline hipsolverStatus_t hipsolver_potrf_vbatched_bufferSize(testAPI_t           API,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             const int*          n,
+                                                             float*              A[],
+                                                             const int*          lda,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfVbatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_vbatched_bufferSize(testAPI_t           API,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             const int*          n,
+                                                             double*             A[],
+                                                             const int*          lda,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfVbatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_vbatched_bufferSize(testAPI_t           API,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             const int*          n,
+                                                             hipsolverComplex*   A[],
+                                                             const int*          lda,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfVbatched_bufferSize(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfVbatched_bufferSizeFortran(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_vbatched_bufferSize(testAPI_t               API,
+                                                             hipsolverHandle_t       handle,
+                                                             hipsolverFillMode_t     uplo,
+                                                             const int*              n,
+                                                             hipsolverDoubleComplex* A[],
+                                                             const int*              lda,
+                                                             int*                    lwork,
+                                                             int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfVbatched_bufferSize(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfVbatched_bufferSizeFortran(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_vbatched(testAPI_t           API,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  const int*          n,
+                                                  float*              A[],
+                                                  const int*          lda,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfVbatchedFortran(
+            handle, uplo, n, A, lda, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_vbatched(testAPI_t           API,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  const int*          n,
+                                                  double*             A[],
+                                                  const int*          lda,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfVbatchedFortran(
+            handle, uplo, n, A, lda, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_vbatched(testAPI_t           API,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  const int*          n,
+                                                  hipsolverComplex*   A[],
+                                                  const int*          lda,
+                                                  hipsolverComplex*   work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfVbatched(handle,
+                                       uplo,
+                                       n,
+                                       (hipFloatComplex**)A,
+                                       lda,
+                                       (hipFloatComplex*)work,
+                                       lwork,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfVbatchedFortran(handle,
+                                              uplo,
+                                              n,
+                                              (hipFloatComplex**)A,
+                                              lda,
+                                              (hipFloatComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_vbatched(testAPI_t               API,
+                                                  hipsolverHandle_t       handle,
+                                                  hipsolverFillMode_t     uplo,
+                                                  const int*              n,
+                                                  hipsolverDoubleComplex* A[],
+                                                  const int*              lda,
+                                                  hipsolverDoubleComplex* work,
+                                                  int                     lwork,
+                                                  int*                    info,
+                                                  int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfVbatched(handle,
+                                       uplo,
+                                       n,
+                                       (hipDoubleComplex**)A,
+                                       lda,
+                                       (hipDoubleComplex*)work,
+                                       lwork,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfVbatchedFortran(handle,
+                                              uplo,
+                                              n,
+                                              (hipDoubleComplex**)A,
+                                              lda,
+                                              (hipDoubleComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRF_UPDATE ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t           API,
+                                                           bool                STRIDED,
+                                                           hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           float*              A,
+                                                           int                 lda,
+                                                           int                 stA,
+                                                           float*              V,
+                                                           int                 ldv,
+                                                           int                 stV,
+                                                           int*                lwork,
+                                                           int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverSpotrfUpdateStridedBatched_bufferSize(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpotrfUpdate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverSpotrfUpdateStridedBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t           API,
+                                                           bool                STRIDED,
+                                                           hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           double*             A,
+                                                           int                 lda,
+                                                           int                 stA,
+                                                           double*             V,
+                                                           int                 ldv,
+                                                           int                 stV,
+                                                           int*                lwork,
+                                                           int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverDpotrfUpdateStridedBatched_bufferSize(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpotrfUpdate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverDpotrfUpdateStridedBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t           API,
+                                                           bool                STRIDED,
+                                                           hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           hipsolverComplex*   A,
+                                                           int                 lda,
+                                                           int                 stA,
+                                                           hipsolverComplex*   V,
+                                                           int                 ldv,
+                                                           int                 stV,
+                                                           int*                lwork,
+                                                           int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrfUpdate_bufferSize(
+            handle, uplo, n, k, (hipFloatComplex*)A, lda, (hipFloatComplex*)V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverCpotrfUpdateStridedBatched_bufferSize(handle,
+                                                              uplo,
+                                                              n,
+                                                              k,
+                                                              (hipFloatComplex*)A,
+                                                              lda,
+                                                              stA,
+                                                              (hipFloatComplex*)V,
+                                                              ldv,
+                                                              stV,
+                                                              lwork,
+                                                              bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpotrfUpdate_bufferSizeFortran(
+            handle, uplo, n, k, (hipFloatComplex*)A, lda, (hipFloatComplex*)V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverCpotrfUpdateStridedBatched_bufferSizeFortran(handle,
+                                                                     uplo,
+                                                                     n,
+                                                                     k,
+                                                                     (hipFloatComplex*)A,
+                                                                     lda,
+                                                                     stA,
+                                                                     (hipFloatComplex*)V,
+                                                                     ldv,
+                                                                     stV,
+                                                                     lwork,
+                                                                     bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t               API,
+                                                           bool                    STRIDED,
+                                                           hipsolverHandle_t       handle,
+                                                           hipsolverFillMode_t     uplo,
+                                                           int                     n,
+                                                           int                     k,
+                                                           hipsolverDoubleComplex* A,
+                                                           int                     lda,
+                                                           int                     stA,
+                                                           hipsolverDoubleComplex* V,
+                                                           int                     ldv,
+                                                           int                     stV,
+                                                           int*                    lwork,
+                                                           int                     bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrfUpdate_bufferSize(
+            handle, uplo, n, k, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverZpotrfUpdateStridedBatched_bufferSize(handle,
+                                                              uplo,
+                                                              n,
+                                                              k,
+                                                              (hipDoubleComplex*)A,
+                                                              lda,
+                                                              stA,
+                                                              (hipDoubleComplex*)V,
+                                                              ldv,
+                                                              stV,
+                                                              lwork,
+                                                              bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpotrfUpdate_bufferSizeFortran(
+            handle, uplo, n, k, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverZpotrfUpdateStridedBatched_bufferSizeFortran(handle,
+                                                                     uplo,
+                                                                     n,
+                                                                     k,
+                                                                     (hipDoubleComplex*)A,
+                                                                     lda,
+                                                                     stA,
+                                                                     (hipDoubleComplex*)V,
+                                                                     ldv,
+                                                                     stV,
+                                                                     lwork,
+                                                                     bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t           API,
+                                                bool                STRIDED,
+                                                hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 k,
+                                                float*              A,
+                                                int                 lda,
+                                                int                 stA,
+                                                float*              V,
+                                                int                 ldv,
+                                                int                 stV,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                info,
+                                                int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSpotrfUpdateStridedBatched(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpotrfUpdateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverSpotrfUpdateStridedBatchedFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t           API,
+                                                bool                STRIDED,
+                                                hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 k,
+                                                double*             A,
+                                                int                 lda,
+                                                int                 stA,
+                                                double*             V,
+                                                int                 ldv,
+                                                int                 stV,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                info,
+                                                int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDpotrfUpdateStridedBatched(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpotrfUpdateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverDpotrfUpdateStridedBatchedFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t           API,
+                                                bool                STRIDED,
+                                                hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 k,
+                                                hipsolverComplex*   A,
+                                                int                 lda,
+                                                int                 stA,
+                                                hipsolverComplex*   V,
+                                                int                 ldv,
+                                                int                 stV,
+                                                hipsolverComplex*   work,
+                                                int                 lwork,
+                                                int*                info,
+                                                int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrfUpdate(handle,
+                                     uplo,
+                                     n,
+                                     k,
+                                     (hipFloatComplex*)A,
+                                     lda,
+                                     (hipFloatComplex*)V,
+                                     ldv,
+                                     (hipFloatComplex*)work,
+                                     lwork,
+                                     info);
+    case C_STRIDED:
+        return hipsolverCpotrfUpdateStridedBatched(handle,
+                                                   uplo,
+                                                   n,
+                                                   k,
+                                                   (hipFloatComplex*)A,
+                                                   lda,
+                                                   stA,
+                                                   (hipFloatComplex*)V,
+                                                   ldv,
+                                                   stV,
+                                                   (hipFloatComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpotrfUpdateFortran(handle,
+                                            uplo,
+                                            n,
+                                            k,
+                                            (hipFloatComplex*)A,
+                                            lda,
+                                            (hipFloatComplex*)V,
+                                            ldv,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info);
+    case FORTRAN_STRIDED:
+        return hipsolverCpotrfUpdateStridedBatchedFortran(handle,
+                                                          uplo,
+                                                          n,
+                                                          k,
+                                                          (hipFloatComplex*)A,
+                                                          lda,
+                                                          stA,
+                                                          (hipFloatComplex*)V,
+                                                          ldv,
+                                                          stV,
+                                                          (hipFloatComplex*)work,
+                                                          lwork,
+                                                          info,
+                                                          bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t               API,
+                                                bool                    STRIDED,
+                                                hipsolverHandle_t       handle,
+                                                hipsolverFillMode_t     uplo,
+                                                int                     n,
+                                                int                     k,
+                                                hipsolverDoubleComplex* A,
+                                                int                     lda,
+                                                int                     stA,
+                                                hipsolverDoubleComplex* V,
+                                                int                     ldv,
+                                                int                     stV,
+                                                hipsolverDoubleComplex* work,
+                                                int                     lwork,
+                                                int*                    info,
+                                                int                     bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrfUpdate(handle,
+                                     uplo,
+                                     n,
+                                     k,
+                                     (hipDoubleComplex*)A,
+                                     lda,
+                                     (hipDoubleComplex*)V,
+                                     ldv,
+                                     (hipDoubleComplex*)work,
+                                     lwork,
+                                     info);
+    case C_STRIDED:
+        return hipsolverZpotrfUpdateStridedBatched(handle,
+                                                   uplo,
+                                                   n,
+                                                   k,
+                                                   (hipDoubleComplex*)A,
+                                                   lda,
+                                                   stA,
+                                                   (hipDoubleComplex*)V,
+                                                   ldv,
+                                                   stV,
+                                                   (hipDoubleComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpotrfUpdateFortran(handle,
+                                            uplo,
+                                            n,
+                                            k,
+                                            (hipDoubleComplex*)A,
+                                            lda,
+                                            (hipDoubleComplex*)V,
+                                            ldv,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info);
+    case FORTRAN_STRIDED:
+        return hipsolverZpotrfUpdateStridedBatchedFortran(handle,
+                                                          uplo,
+                                                          n,
+                                                          k,
+                                                          (hipDoubleComplex*)A,
+                                                          lda,
+                                                          stA,
+                                                          (hipDoubleComplex*)V,
+                                                          ldv,
+                                                          stV,
+                                                          (hipDoubleComplex*)work,
+                                                          lwork,
+                                                          info,
+                                                          bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t           API,
+                                                           bool                STRIDED,
+                                                           hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           float*              A[],
+                                                           int                 lda,
+                                                           int                 stA,
+                                                           float*              V[],
+                                                           int                 ldv,
+                                                           int                 stV,
+                                                           int*                lwork,
+                                                           int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfUpdateBatched_bufferSize(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfUpdateBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t           API,
+                                                           bool                STRIDED,
+                                                           hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           double*             A[],
+                                                           int                 lda,
+                                                           int                 stA,
+                                                           double*             V[],
+                                                           int                 ldv,
+                                                           int                 stV,
+                                                           int*                lwork,
+                                                           int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfUpdateBatched_bufferSize(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfUpdateBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t           API,
+                                                           bool                STRIDED,
+                                                           hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           hipsolverComplex*   A[],
+                                                           int                 lda,
+                                                           int                 stA,
+                                                           hipsolverComplex*   V[],
+                                                           int                 ldv,
+                                                           int                 stV,
+                                                           int*                lwork,
+                                                           int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfUpdateBatched_bufferSize(
+            handle, uplo, n, k, (hipFloatComplex**)A, lda, (hipFloatComplex**)V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfUpdateBatched_bufferSizeFortran(
+            handle, uplo, n, k, (hipFloatComplex**)A, lda, (hipFloatComplex**)V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update_bufferSize(testAPI_t               API,
+                                                           bool                    STRIDED,
+                                                           hipsolverHandle_t       handle,
+                                                           hipsolverFillMode_t     uplo,
+                                                           int                     n,
+                                                           int                     k,
+                                                           hipsolverDoubleComplex* A[],
+                                                           int                     lda,
+                                                           int                     stA,
+                                                           hipsolverDoubleComplex* V[],
+                                                           int                     ldv,
+                                                           int                     stV,
+                                                           int*                    lwork,
+                                                           int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfUpdateBatched_bufferSize(
+            handle, uplo, n, k, (hipDoubleComplex**)A, lda, (hipDoubleComplex**)V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfUpdateBatched_bufferSizeFortran(
+            handle, uplo, n, k, (hipDoubleComplex**)A, lda, (hipDoubleComplex**)V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t           API,
+                                                bool                STRIDED,
+                                                hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 k,
+                                                float*              A[],
+                                                int                 lda,
+                                                int                 stA,
+                                                float*              V[],
+                                                int                 ldv,
+                                                int                 stV,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                info,
+                                                int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfUpdateBatched(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfUpdateBatchedFortran(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t           API,
+                                                bool                STRIDED,
+                                                hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 k,
+                                                double*             A[],
+                                                int                 lda,
+                                                int                 stA,
+                                                double*             V[],
+                                                int                 ldv,
+                                                int                 stV,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                info,
+                                                int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfUpdateBatched(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfUpdateBatchedFortran(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t           API,
+                                                bool                STRIDED,
+                                                hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 k,
+                                                hipsolverComplex*   A[],
+                                                int                 lda,
+                                                int                 stA,
+                                                hipsolverComplex*   V[],
+                                                int                 ldv,
+                                                int                 stV,
+                                                hipsolverComplex*   work,
+                                                int                 lwork,
+                                                int*                info,
+                                                int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfUpdateBatched(handle,
+                                            uplo,
+                                            n,
+                                            k,
+                                            (hipFloatComplex**)A,
+                                            lda,
+                                            (hipFloatComplex**)V,
+                                            ldv,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfUpdateBatchedFortran(handle,
+                                                   uplo,
+                                                   n,
+                                                   k,
+                                                   (hipFloatComplex**)A,
+                                                   lda,
+                                                   (hipFloatComplex**)V,
+                                                   ldv,
+                                                   (hipFloatComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_update(testAPI_t               API,
+                                                bool                    STRIDED,
+                                                hipsolverHandle_t       handle,
+                                                hipsolverFillMode_t     uplo,
+                                                int                     n,
+                                                int                     k,
+                                                hipsolverDoubleComplex* A[],
+                                                int                     lda,
+                                                int                     stA,
+                                                hipsolverDoubleComplex* V[],
+                                                int                     ldv,
+                                                int                     stV,
+                                                hipsolverDoubleComplex* work,
+                                                int                     lwork,
+                                                int*                    info,
+                                                int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfUpdateBatched(handle,
+                                            uplo,
+                                            n,
+                                            k,
+                                            (hipDoubleComplex**)A,
+                                            lda,
+                                            (hipDoubleComplex**)V,
+                                            ldv,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfUpdateBatchedFortran(handle,
+                                                   uplo,
+                                                   n,
+                                                   k,
+                                                   (hipDoubleComplex**)A,
+                                                   lda,
+                                                   (hipDoubleComplex**)V,
+                                                   ldv,
+                                                   (hipDoubleComplex*)work,
+                                                   lwork,
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRF_DOWNDATE ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t           API,
+                                                             bool                STRIDED,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 k,
+                                                             float*              A,
+                                                             int                 lda,
+                                                             int                 stA,
+                                                             float*              V,
+                                                             int                 ldv,
+                                                             int                 stV,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverSpotrfDowndateStridedBatched_bufferSize(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpotrfDowndate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverSpotrfDowndateStridedBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t           API,
+                                                             bool                STRIDED,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 k,
+                                                             double*             A,
+                                                             int                 lda,
+                                                             int                 stA,
+                                                             double*             V,
+                                                             int                 ldv,
+                                                             int                 stV,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverDpotrfDowndateStridedBatched_bufferSize(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpotrfDowndate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverDpotrfDowndateStridedBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t           API,
+                                                             bool                STRIDED,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 k,
+                                                             hipsolverComplex*   A,
+                                                             int                 lda,
+                                                             int                 stA,
+                                                             hipsolverComplex*   V,
+                                                             int                 ldv,
+                                                             int                 stV,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrfDowndate_bufferSize(
+            handle, uplo, n, k, (hipFloatComplex*)A, lda, (hipFloatComplex*)V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverCpotrfDowndateStridedBatched_bufferSize(handle,
+                                                                uplo,
+                                                                n,
+                                                                k,
+                                                                (hipFloatComplex*)A,
+                                                                lda,
+                                                                stA,
+                                                                (hipFloatComplex*)V,
+                                                                ldv,
+                                                                stV,
+                                                                lwork,
+                                                                bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpotrfDowndate_bufferSizeFortran(
+            handle, uplo, n, k, (hipFloatComplex*)A, lda, (hipFloatComplex*)V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverCpotrfDowndateStridedBatched_bufferSizeFortran(handle,
+                                                                       uplo,
+                                                                       n,
+                                                                       k,
+                                                                       (hipFloatComplex*)A,
+                                                                       lda,
+                                                                       stA,
+                                                                       (hipFloatComplex*)V,
+                                                                       ldv,
+                                                                       stV,
+                                                                       lwork,
+                                                                       bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t               API,
+                                                             bool                    STRIDED,
+                                                             hipsolverHandle_t       handle,
+                                                             hipsolverFillMode_t     uplo,
+                                                             int                     n,
+                                                             int                     k,
+                                                             hipsolverDoubleComplex* A,
+                                                             int                     lda,
+                                                             int                     stA,
+                                                             hipsolverDoubleComplex* V,
+                                                             int                     ldv,
+                                                             int                     stV,
+                                                             int*                    lwork,
+                                                             int                     bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrfDowndate_bufferSize(
+            handle, uplo, n, k, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)V, ldv, lwork);
+    case C_STRIDED:
+        return hipsolverZpotrfDowndateStridedBatched_bufferSize(handle,
+                                                                uplo,
+                                                                n,
+                                                                k,
+                                                                (hipDoubleComplex*)A,
+                                                                lda,
+                                                                stA,
+                                                                (hipDoubleComplex*)V,
+                                                                ldv,
+                                                                stV,
+                                                                lwork,
+                                                                bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpotrfDowndate_bufferSizeFortran(
+            handle, uplo, n, k, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)V, ldv, lwork);
+    case FORTRAN_STRIDED:
+        return hipsolverZpotrfDowndateStridedBatched_bufferSizeFortran(handle,
+                                                                       uplo,
+                                                                       n,
+                                                                       k,
+                                                                       (hipDoubleComplex*)A,
+                                                                       lda,
+                                                                       stA,
+                                                                       (hipDoubleComplex*)V,
+                                                                       ldv,
+                                                                       stV,
+                                                                       lwork,
+                                                                       bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t           API,
+                                                  bool                STRIDED,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 k,
+                                                  float*              A,
+                                                  int                 lda,
+                                                  int                 stA,
+                                                  float*              V,
+                                                  int                 ldv,
+                                                  int                 stV,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSpotrfDowndateStridedBatched(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpotrfDowndateFortran(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverSpotrfDowndateStridedBatchedFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t           API,
+                                                  bool                STRIDED,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 k,
+                                                  double*             A,
+                                                  int                 lda,
+                                                  int                 stA,
+                                                  double*             V,
+                                                  int                 ldv,
+                                                  int                 stV,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDpotrfDowndateStridedBatched(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpotrfDowndateFortran(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info);
+    case FORTRAN_STRIDED:
+        return hipsolverDpotrfDowndateStridedBatchedFortran(
+            handle, uplo, n, k, A, lda, stA, V, ldv, stV, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t           API,
+                                                  bool                STRIDED,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 k,
+                                                  hipsolverComplex*   A,
+                                                  int                 lda,
+                                                  int                 stA,
+                                                  hipsolverComplex*   V,
+                                                  int                 ldv,
+                                                  int                 stV,
+                                                  hipsolverComplex*   work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrfDowndate(handle,
+                                       uplo,
+                                       n,
+                                       k,
+                                       (hipFloatComplex*)A,
+                                       lda,
+                                       (hipFloatComplex*)V,
+                                       ldv,
+                                       (hipFloatComplex*)work,
+                                       lwork,
+                                       info);
+    case C_STRIDED:
+        return hipsolverCpotrfDowndateStridedBatched(handle,
+                                                     uplo,
+                                                     n,
+                                                     k,
+                                                     (hipFloatComplex*)A,
+                                                     lda,
+                                                     stA,
+                                                     (hipFloatComplex*)V,
+                                                     ldv,
+                                                     stV,
+                                                     (hipFloatComplex*)work,
+                                                     lwork,
+                                                     info,
+                                                     bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpotrfDowndateFortran(handle,
+                                              uplo,
+                                              n,
+                                              k,
+                                              (hipFloatComplex*)A,
+                                              lda,
+                                              (hipFloatComplex*)V,
+                                              ldv,
+                                              (hipFloatComplex*)work,
+                                              lwork,
+                                              info);
+    case FORTRAN_STRIDED:
+        return hipsolverCpotrfDowndateStridedBatchedFortran(handle,
+                                                            uplo,
+                                                            n,
+                                                            k,
+                                                            (hipFloatComplex*)A,
+                                                            lda,
+                                                            stA,
+                                                            (hipFloatComplex*)V,
+                                                            ldv,
+                                                            stV,
+                                                            (hipFloatComplex*)work,
+                                                            lwork,
+                                                            info,
+                                                            bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t               API,
+                                                  bool                    STRIDED,
+                                                  hipsolverHandle_t       handle,
+                                                  hipsolverFillMode_t     uplo,
+                                                  int                     n,
+                                                  int                     k,
+                                                  hipsolverDoubleComplex* A,
+                                                  int                     lda,
+                                                  int                     stA,
+                                                  hipsolverDoubleComplex* V,
+                                                  int                     ldv,
+                                                  int                     stV,
+                                                  hipsolverDoubleComplex* work,
+                                                  int                     lwork,
+                                                  int*                    info,
+                                                  int                     bc)
+{
+    switch(api2marshal(API, false, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrfDowndate(handle,
+                                       uplo,
+                                       n,
+                                       k,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       (hipDoubleComplex*)V,
+                                       ldv,
+                                       (hipDoubleComplex*)work,
+                                       lwork,
+                                       info);
+    case C_STRIDED:
+        return hipsolverZpotrfDowndateStridedBatched(handle,
+                                                     uplo,
+                                                     n,
+                                                     k,
+                                                     (hipDoubleComplex*)A,
+                                                     lda,
+                                                     stA,
+                                                     (hipDoubleComplex*)V,
+                                                     ldv,
+                                                     stV,
+                                                     (hipDoubleComplex*)work,
+                                                     lwork,
+                                                     info,
+                                                     bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpotrfDowndateFortran(handle,
+                                              uplo,
+                                              n,
+                                              k,
+                                              (hipDoubleComplex*)A,
+                                              lda,
+                                              (hipDoubleComplex*)V,
+                                              ldv,
+                                              (hipDoubleComplex*)work,
+                                              lwork,
+                                              info);
+    case FORTRAN_STRIDED:
+        return hipsolverZpotrfDowndateStridedBatchedFortran(handle,
+                                                            uplo,
+                                                            n,
+                                                            k,
+                                                            (hipDoubleComplex*)A,
+                                                            lda,
+                                                            stA,
+                                                            (hipDoubleComplex*)V,
+                                                            ldv,
+                                                            stV,
+                                                            (hipDoubleComplex*)work,
+                                                            lwork,
+                                                            info,
+                                                            bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t           API,
+                                                             bool                STRIDED,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 k,
+                                                             float*              A[],
+                                                             int                 lda,
+                                                             int                 stA,
+                                                             float*              V[],
+                                                             int                 ldv,
+                                                             int                 stV,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfDowndateBatched_bufferSize(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfDowndateBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t           API,
+                                                             bool                STRIDED,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 k,
+                                                             double*             A[],
+                                                             int                 lda,
+                                                             int                 stA,
+                                                             double*             V[],
+                                                             int                 ldv,
+                                                             int                 stV,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfDowndateBatched_bufferSize(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfDowndateBatched_bufferSizeFortran(
+            handle, uplo, n, k, A, lda, V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t           API,
+                                                             bool                STRIDED,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 k,
+                                                             hipsolverComplex*   A[],
+                                                             int                 lda,
+                                                             int                 stA,
+                                                             hipsolverComplex*   V[],
+                                                             int                 ldv,
+                                                             int                 stV,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfDowndateBatched_bufferSize(
+            handle, uplo, n, k, (hipFloatComplex**)A, lda, (hipFloatComplex**)V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfDowndateBatched_bufferSizeFortran(
+            handle, uplo, n, k, (hipFloatComplex**)A, lda, (hipFloatComplex**)V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate_bufferSize(testAPI_t               API,
+                                                             bool                    STRIDED,
+                                                             hipsolverHandle_t       handle,
+                                                             hipsolverFillMode_t     uplo,
+                                                             int                     n,
+                                                             int                     k,
+                                                             hipsolverDoubleComplex* A[],
+                                                             int                     lda,
+                                                             int                     stA,
+                                                             hipsolverDoubleComplex* V[],
+                                                             int                     ldv,
+                                                             int                     stV,
+                                                             int*                    lwork,
+                                                             int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfDowndateBatched_bufferSize(
+            handle, uplo, n, k, (hipDoubleComplex**)A, lda, (hipDoubleComplex**)V, ldv, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfDowndateBatched_bufferSizeFortran(
+            handle, uplo, n, k, (hipDoubleComplex**)A, lda, (hipDoubleComplex**)V, ldv, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t           API,
+                                                  bool                STRIDED,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 k,
+                                                  float*              A[],
+                                                  int                 lda,
+                                                  int                 stA,
+                                                  float*              V[],
+                                                  int                 ldv,
+                                                  int                 stV,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrfDowndateBatched(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfDowndateBatchedFortran(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t           API,
+                                                  bool                STRIDED,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 k,
+                                                  double*             A[],
+                                                  int                 lda,
+                                                  int                 stA,
+                                                  double*             V[],
+                                                  int                 ldv,
+                                                  int                 stV,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrfDowndateBatched(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfDowndateBatchedFortran(
+            handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t           API,
+                                                  bool                STRIDED,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 k,
+                                                  hipsolverComplex*   A[],
+                                                  int                 lda,
+                                                  int                 stA,
+                                                  hipsolverComplex*   V[],
+                                                  int                 ldv,
+                                                  int                 stV,
+                                                  hipsolverComplex*   work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrfDowndateBatched(handle,
+                                              uplo,
+                                              n,
+                                              k,
+                                              (hipFloatComplex**)A,
+                                              lda,
+                                              (hipFloatComplex**)V,
+                                              ldv,
+                                              (hipFloatComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfDowndateBatchedFortran(handle,
+                                                     uplo,
+                                                     n,
+                                                     k,
+                                                     (hipFloatComplex**)A,
+                                                     lda,
+                                                     (hipFloatComplex**)V,
+                                                     ldv,
+                                                     (hipFloatComplex*)work,
+                                                     lwork,
+                                                     info,
+                                                     bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrf_downdate(testAPI_t               API,
+                                                  bool                    STRIDED,
+                                                  hipsolverHandle_t       handle,
+                                                  hipsolverFillMode_t     uplo,
+                                                  int                     n,
+                                                  int                     k,
+                                                  hipsolverDoubleComplex* A[],
+                                                  int                     lda,
+                                                  int                     stA,
+                                                  hipsolverDoubleComplex* V[],
+                                                  int                     ldv,
+                                                  int                     stV,
+                                                  hipsolverDoubleComplex* work,
+                                                  int                     lwork,
+                                                  int*                    info,
+                                                  int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrfDowndateBatched(handle,
+                                              uplo,
+                                              n,
+                                              k,
+                                              (hipDoubleComplex**)A,
+                                              lda,
+                                              (hipDoubleComplex**)V,
+                                              ldv,
+                                              (hipDoubleComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfDowndateBatchedFortran(handle,
+                                                     uplo,
+                                                     n,
+                                                     k,
+                                                     (hipDoubleComplex**)A,
+                                                     lda,
+                                                     (hipDoubleComplex**)V,
+                                                     ldv,
+                                                     (hipDoubleComplex*)work,
+                                                     lwork,
+                                                     info,
+                                                     bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRI ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                lwork)
+{
+    if(!FORTRAN)
+        return hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+    else
+        return hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                lwork)
+{
+    if(!FORTRAN)
+        return hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+    else
+        return hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                lwork)
+{
+    if(!FORTRAN)
+        return hipsolverCpotri_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    else
+        return hipsolverCpotri_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork)
+{
+    if(!FORTRAN)
+        return hipsolverZpotri_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    else
+        return hipsolverZpotri_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info);
+    else
+        return hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info);
+    else
+        return hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverCpotri(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+    else
+        return hipsolverCpotriFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZpotri(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    else
+        return hipsolverZpotriFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+}
+/********************************************************/
+
+/******************** POTRS ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrs_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverCpotrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrs_bufferSize(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverZpotrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverCpotrsFortran(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    case API_COMPAT:
+        return hipsolverDnCpotrs(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverZpotrsFortran(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
                                       (hipDoubleComplex*)A,
                                       lda,
                                       (hipDoubleComplex*)B,
@@ -4435,300 +8983,1360 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
                                       (hipDoubleComplex*)work,
                                       lwork,
                                       info);
-    case API_COMPAT:
-        return hipsolverDnZpotrs(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+    case API_COMPAT:
+        return hipsolverDnZpotrs(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    hipsolverComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrsBatched_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrsBatched_bufferSize(handle,
+                                                 uplo,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex**)A,
+                                                 lda,
+                                                 (hipDoubleComplex**)B,
+                                                 ldb,
+                                                 lwork,
+                                                 bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsBatched_bufferSizeFortran(handle,
+                                                        uplo,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex**)A,
+                                                        lda,
+                                                        (hipDoubleComplex**)B,
+                                                        ldb,
+                                                        lwork,
+                                                        bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      (hipFloatComplex**)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsBatchedFortran(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex**)A,
+                                             lda,
+                                             (hipFloatComplex**)B,
+                                             ldb,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case API_COMPAT:
+        return hipsolverDnCpotrsBatched(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* B[],
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      (hipDoubleComplex**)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsBatchedFortran(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex**)A,
+                                             lda,
+                                             (hipDoubleComplex**)B,
+                                             ldb,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case API_COMPAT:
+        return hipsolverDnZpotrsBatched(handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        (hipDoubleComplex**)A,
+                                        lda,
+                                        (hipDoubleComplex**)B,
+                                        ldb,
+                                        info,
+                                        bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRS_VBATCHED ********************/
+inline hipsolverStatus_t hipsolver_potrs_vbatched_bufferSize(testAPI_t           API,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             const int*          n,
+                                                             const int*          nrhs,
+                                                             float*              A[],
+                                                             const int*          lda,
+                                                             float*              B[],
+                                                             const int*          ldb,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrsVbatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsVbatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_vbatched_bufferSize(testAPI_t           API,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             const int*          n,
+                                                             const int*          nrhs,
+                                                             double*             A[],
+                                                             const int*          lda,
+                                                             double*             B[],
+                                                             const int*          ldb,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrsVbatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsVbatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_vbatched_bufferSize(testAPI_t           API,
+                                                             hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             const int*          n,
+                                                             const int*          nrhs,
+                                                             hipsolverComplex*   A[],
+                                                             const int*          lda,
+                                                             hipsolverComplex*   B[],
+                                                             const int*          ldb,
+                                                             int*                lwork,
+                                                             int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrsVbatched_bufferSize(handle,
+                                                  uplo,
+                                                  n,
+                                                  nrhs,
+                                                  (hipFloatComplex**)A,
+                                                  lda,
+                                                  (hipFloatComplex**)B,
+                                                  ldb,
+                                                  lwork,
+                                                  bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsVbatched_bufferSizeFortran(handle,
+                                                         uplo,
+                                                         n,
+                                                         nrhs,
+                                                         (hipFloatComplex**)A,
+                                                         lda,
+                                                         (hipFloatComplex**)B,
+                                                         ldb,
+                                                         lwork,
+                                                         bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_vbatched_bufferSize(testAPI_t               API,
+                                                             hipsolverHandle_t       handle,
+                                                             hipsolverFillMode_t     uplo,
+                                                             const int*              n,
+                                                             const int*              nrhs,
+                                                             hipsolverDoubleComplex* A[],
+                                                             const int*              lda,
+                                                             hipsolverDoubleComplex* B[],
+                                                             const int*              ldb,
+                                                             int*                    lwork,
+                                                             int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrsVbatched_bufferSize(handle,
+                                                  uplo,
+                                                  n,
+                                                  nrhs,
+                                                  (hipDoubleComplex**)A,
+                                                  lda,
+                                                  (hipDoubleComplex**)B,
+                                                  ldb,
+                                                  lwork,
+                                                  bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsVbatched_bufferSizeFortran(handle,
+                                                         uplo,
+                                                         n,
+                                                         nrhs,
+                                                         (hipDoubleComplex**)A,
+                                                         lda,
+                                                         (hipDoubleComplex**)B,
+                                                         ldb,
+                                                         lwork,
+                                                         bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_vbatched(testAPI_t           API,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  const int*          n,
+                                                  const int*          nrhs,
+                                                  float*              A[],
+                                                  const int*          lda,
+                                                  float*              B[],
+                                                  const int*          ldb,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrsVbatched(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsVbatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_vbatched(testAPI_t           API,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  const int*          n,
+                                                  const int*          nrhs,
+                                                  double*             A[],
+                                                  const int*          lda,
+                                                  double*             B[],
+                                                  const int*          ldb,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrsVbatched(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsVbatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_vbatched(testAPI_t           API,
+                                                  hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  const int*          n,
+                                                  const int*          nrhs,
+                                                  hipsolverComplex*   A[],
+                                                  const int*          lda,
+                                                  hipsolverComplex*   B[],
+                                                  const int*          ldb,
+                                                  hipsolverComplex*   work,
+                                                  int                 lwork,
+                                                  int*                info,
+                                                  int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrsVbatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipFloatComplex**)A,
+                                       lda,
+                                       (hipFloatComplex**)B,
+                                       ldb,
+                                       (hipFloatComplex*)work,
+                                       lwork,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsVbatchedFortran(handle,
+                                              uplo,
+                                              n,
+                                              nrhs,
+                                              (hipFloatComplex**)A,
+                                              lda,
+                                              (hipFloatComplex**)B,
+                                              ldb,
+                                              (hipFloatComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_vbatched(testAPI_t               API,
+                                                  hipsolverHandle_t       handle,
+                                                  hipsolverFillMode_t     uplo,
+                                                  const int*              n,
+                                                  const int*              nrhs,
+                                                  hipsolverDoubleComplex* A[],
+                                                  const int*              lda,
+                                                  hipsolverDoubleComplex* B[],
+                                                  const int*              ldb,
+                                                  hipsolverDoubleComplex* work,
+                                                  int                     lwork,
+                                                  int*                    info,
+                                                  int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrsVbatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipDoubleComplex**)A,
+                                       lda,
+                                       (hipDoubleComplex**)B,
+                                       ldb,
+                                       (hipDoubleComplex*)work,
+                                       lwork,
+                                       info,
+                                       bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsVbatchedFortran(handle,
+                                              uplo,
+                                              n,
+                                              nrhs,
+                                              (hipDoubleComplex**)A,
+                                              lda,
+                                              (hipDoubleComplex**)B,
+                                              ldb,
+                                              (hipDoubleComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** PPTRF ********************/
+inline hipsolverStatus_t hipsolver_pptrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpptrf_bufferSize(handle, uplo, n, AP, lwork);
+    case API_FORTRAN:
+        return hipsolverSpptrf_bufferSizeFortran(handle, uplo, n, AP, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             AP,
+                                                    int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpptrf_bufferSize(handle, uplo, n, AP, lwork);
+    case API_FORTRAN:
+        return hipsolverDpptrf_bufferSizeFortran(handle, uplo, n, AP, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   AP,
+                                                    int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpptrf_bufferSize(handle, uplo, n, (hipFloatComplex*)AP, lwork);
+    case API_FORTRAN:
+        return hipsolverCpptrf_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)AP, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrf_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* AP,
+                                                    int*                    lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpptrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)AP, lwork);
+    case API_FORTRAN:
+        return hipsolverZpptrf_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)AP, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              AP,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpptrf(handle, uplo, n, AP, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSpptrfFortran(handle, uplo, n, AP, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             AP,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpptrf(handle, uplo, n, AP, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDpptrfFortran(handle, uplo, n, AP, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   AP,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpptrf(
+            handle, uplo, n, (hipFloatComplex*)AP, (hipFloatComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverCpptrfFortran(
+            handle, uplo, n, (hipFloatComplex*)AP, (hipFloatComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrf(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* AP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpptrf(
+            handle, uplo, n, (hipDoubleComplex*)AP, (hipDoubleComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverZpptrfFortran(
+            handle, uplo, n, (hipDoubleComplex*)AP, (hipDoubleComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** PPTRS ********************/
+inline hipsolverStatus_t hipsolver_pptrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              AP,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverSpptrs_bufferSizeFortran(handle, uplo, n, nrhs, AP, B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             AP,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverDpptrs_bufferSizeFortran(handle, uplo, n, nrhs, AP, B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   AP,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpptrs_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)AP, (hipFloatComplex*)B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverCpptrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex*)AP, (hipFloatComplex*)B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrs_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* AP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpptrs_bufferSize(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)AP, (hipDoubleComplex*)B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverZpptrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)AP, (hipDoubleComplex*)B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              AP,
+                                         float*              B,
+                                         int                 ldb,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSpptrsFortran(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             AP,
+                                         double*             B,
+                                         int                 ldb,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDpptrsFortran(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   AP,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpptrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)AP,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverCpptrsFortran(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex*)AP,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_pptrs(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* AP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpptrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)AP,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverZpptrsFortran(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex*)AP,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SPEVD/HPEVD ********************/
+inline hipsolverStatus_t hipsolver_spevd_hpevd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              AP,
+                                                          float*              D,
+                                                          float*              Z,
+                                                          int                 ldz,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSspevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork);
+    case API_FORTRAN:
+        return hipsolverSspevd_bufferSizeFortran(handle, jobz, uplo, n, AP, D, Z, ldz, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_spevd_hpevd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             AP,
+                                                          double*             D,
+                                                          double*             Z,
+                                                          int                 ldz,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDspevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork);
+    case API_FORTRAN:
+        return hipsolverDspevd_bufferSizeFortran(handle, jobz, uplo, n, AP, D, Z, ldz, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_spevd_hpevd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   AP,
+                                                          float*              D,
+                                                          hipsolverComplex*   Z,
+                                                          int                 ldz,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChpevd_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)AP, D, (hipFloatComplex*)Z, ldz, lwork);
+    case API_FORTRAN:
+        return hipsolverChpevd_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipFloatComplex*)AP, D, (hipFloatComplex*)Z, ldz, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_spevd_hpevd_bufferSize(testAPI_t               API,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* AP,
+                                                          double*                 D,
+                                                          hipsolverDoubleComplex* Z,
+                                                          int                     ldz,
+                                                          int*                    lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhpevd_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)AP, D, (hipDoubleComplex*)Z, ldz, lwork);
+    case API_FORTRAN:
+        return hipsolverZhpevd_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipDoubleComplex*)AP, D, (hipDoubleComplex*)Z, ldz, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_spevd_hpevd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              AP,
+                                               float*              D,
+                                               float*              Z,
+                                               int                 ldz,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSspevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSspevdFortran(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_spevd_hpevd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             AP,
+                                               double*             D,
+                                               double*             Z,
+                                               int                 ldz,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDspevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDspevdFortran(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_spevd_hpevd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   AP,
+                                               float*              D,
+                                               hipsolverComplex*   Z,
+                                               int                 ldz,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChpevd(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)AP,
+                               D,
+                               (hipFloatComplex*)Z,
+                               ldz,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverChpevdFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)AP,
+                                      D,
+                                      (hipFloatComplex*)Z,
+                                      ldz,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_spevd_hpevd(testAPI_t               API,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* AP,
+                                               double*                 D,
+                                               hipsolverDoubleComplex* Z,
+                                               int                     ldz,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhpevd(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)AP,
+                               D,
+                               (hipDoubleComplex*)Z,
+                               ldz,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverZhpevdFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)AP,
+                                      D,
+                                      (hipDoubleComplex*)Z,
+                                      ldz,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+/********************************************************/
 
-// batched
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    float*              B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+/******************** TRTTP ********************/
+inline hipsolverStatus_t hipsolver_trttp(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         float*              AP)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverStrttp(handle, uplo, n, A, lda, AP);
     case API_FORTRAN:
-        return hipsolverSpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverStrttpFortran(handle, uplo, n, A, lda, AP);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    double*             B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_trttp(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         double*             AP)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverDtrttp(handle, uplo, n, A, lda, AP);
     case API_FORTRAN:
-        return hipsolverDpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+        return hipsolverDtrttpFortran(handle, uplo, n, A, lda, AP);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipsolverComplex*   A[],
-                                                    int                 lda,
-                                                    hipsolverComplex*   B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_trttp(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         hipsolverComplex*   AP)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrsBatched_bufferSize(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+        return hipsolverCtrttp(handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)AP);
     case API_FORTRAN:
-        return hipsolverCpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+        return hipsolverCtrttpFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)AP);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
-                                                    int                     n,
-                                                    int                     nrhs,
-                                                    hipsolverDoubleComplex* A[],
-                                                    int                     lda,
-                                                    hipsolverDoubleComplex* B[],
-                                                    int                     ldb,
-                                                    int*                    lwork,
-                                                    int                     bc)
+inline hipsolverStatus_t hipsolver_trttp(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         hipsolverDoubleComplex* AP)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrsBatched_bufferSize(handle,
-                                                 uplo,
-                                                 n,
-                                                 nrhs,
-                                                 (hipDoubleComplex**)A,
-                                                 lda,
-                                                 (hipDoubleComplex**)B,
-                                                 ldb,
-                                                 lwork,
-                                                 bc);
+        return hipsolverZtrttp(handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)AP);
     case API_FORTRAN:
-        return hipsolverZpotrsBatched_bufferSizeFortran(handle,
-                                                        uplo,
-                                                        n,
-                                                        nrhs,
-                                                        (hipDoubleComplex**)A,
-                                                        lda,
-                                                        (hipDoubleComplex**)B,
-                                                        ldb,
-                                                        lwork,
-                                                        bc);
+        return hipsolverZtrttpFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)AP);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+/********************************************************/
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+/******************** TPTTR ********************/
+inline hipsolverStatus_t hipsolver_tpttr(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         float*              A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              B[],
-                                         int                 ldb,
-                                         int                 stB,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+                                         float*              AP,
+                                         float*              A,
+                                         int                 lda)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+        return hipsolverStpttr(handle, uplo, n, AP, A, lda);
     case API_FORTRAN:
-        return hipsolverSpotrsBatchedFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+        return hipsolverStpttrFortran(handle, uplo, n, AP, A, lda);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_tpttr(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         double*             A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             B[],
-                                         int                 ldb,
-                                         int                 stB,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+                                         double*             AP,
+                                         double*             A,
+                                         int                 lda)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+        return hipsolverDtpttr(handle, uplo, n, AP, A, lda);
     case API_FORTRAN:
-        return hipsolverDpotrsBatchedFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+        return hipsolverDtpttrFortran(handle, uplo, n, AP, A, lda);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+inline hipsolverStatus_t hipsolver_tpttr(testAPI_t           API,
                                          hipsolverHandle_t   handle,
                                          hipsolverFillMode_t uplo,
                                          int                 n,
-                                         int                 nrhs,
-                                         hipsolverComplex*   A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   B[],
-                                         int                 ldb,
-                                         int                 stB,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+                                         hipsolverComplex*   AP,
+                                         hipsolverComplex*   A,
+                                         int                 lda)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrsBatched(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipFloatComplex**)A,
-                                      lda,
-                                      (hipFloatComplex**)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      bc);
+        return hipsolverCtpttr(handle, uplo, n, (hipFloatComplex*)AP, (hipFloatComplex*)A, lda);
     case API_FORTRAN:
-        return hipsolverCpotrsBatchedFortran(handle,
-                                             uplo,
-                                             n,
-                                             nrhs,
-                                             (hipFloatComplex**)A,
-                                             lda,
-                                             (hipFloatComplex**)B,
-                                             ldb,
-                                             (hipFloatComplex*)work,
-                                             lwork,
-                                             info,
-                                             bc);
-    case API_COMPAT:
-        return hipsolverDnCpotrsBatched(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, info, bc);
+        return hipsolverCtpttrFortran(
+            handle, uplo, n, (hipFloatComplex*)AP, (hipFloatComplex*)A, lda);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_tpttr(testAPI_t               API,
                                          hipsolverHandle_t       handle,
                                          hipsolverFillMode_t     uplo,
                                          int                     n,
-                                         int                     nrhs,
-                                         hipsolverDoubleComplex* A[],
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* B[],
-                                         int                     ldb,
-                                         int                     stB,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+                                         hipsolverDoubleComplex* AP,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrsBatched(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipDoubleComplex**)A,
-                                      lda,
-                                      (hipDoubleComplex**)B,
-                                      ldb,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      bc);
+        return hipsolverZtpttr(handle, uplo, n, (hipDoubleComplex*)AP, (hipDoubleComplex*)A, lda);
     case API_FORTRAN:
-        return hipsolverZpotrsBatchedFortran(handle,
-                                             uplo,
-                                             n,
-                                             nrhs,
-                                             (hipDoubleComplex**)A,
-                                             lda,
-                                             (hipDoubleComplex**)B,
-                                             ldb,
-                                             (hipDoubleComplex*)work,
-                                             lwork,
-                                             info,
-                                             bc);
-    case API_COMPAT:
-        return hipsolverDnZpotrsBatched(handle,
-                                        uplo,
-                                        n,
-                                        nrhs,
-                                        (hipDoubleComplex**)A,
-                                        lda,
-                                        (hipDoubleComplex**)B,
-                                        ldb,
-                                        info,
-                                        bc);
+        return hipsolverZtpttrFortran(
+            handle, uplo, n, (hipDoubleComplex*)AP, (hipDoubleComplex*)A, lda);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
@@ -11,25 +11,38 @@
 #include "testing_gebrd.hpp"
 #include "testing_gels.hpp"
 #include "testing_geqrf.hpp"
+#include "testing_geqrf_vbatched.hpp"
 #include "testing_gesv.hpp"
 #include "testing_gesvd.hpp"
 #include "testing_gesvdj.hpp"
 #include "testing_getrf.hpp"
+#include "testing_getrf_vbatched.hpp"
 #include "testing_getrs.hpp"
+#include "testing_gtsv.hpp"
 #include "testing_orgbr_ungbr.hpp"
 #include "testing_orgqr_ungqr.hpp"
 #include "testing_orgtr_ungtr.hpp"
 #include "testing_ormqr_unmqr.hpp"
 #include "testing_ormtr_unmtr.hpp"
+#include "testing_pbtrf.hpp"
+#include "testing_pbtrs.hpp"
+#include "testing_posv.hpp"
 #include "testing_potrf.hpp"
+#include "testing_potrf_update.hpp"
+#include "testing_potrf_vbatched.hpp"
 #include "testing_potri.hpp"
 #include "testing_potrs.hpp"
+#include "testing_potrs_vbatched.hpp"
+#include "testing_pptrf.hpp"
+#include "testing_pptrs.hpp"
+#include "testing_spevd_hpevd.hpp"
 #include "testing_syevd_heevd.hpp"
 #include "testing_syevj_heevj.hpp"
 #include "testing_sygvd_hegvd.hpp"
 #include "testing_sygvj_hegvj.hpp"
 #include "testing_sytrd_hetrd.hpp"
 #include "testing_sytrf.hpp"
+#include "testing_trttp.hpp"
 
 struct str_less
 {
@@ -45,26 +58,52 @@ using func_map = std::map<const char*, void (*)(Arguments&), str_less>;
 // Function dispatcher for hipSOLVER tests
 class hipsolver_dispatcher
 {
-    template <typename T>
+    template <testAPI_t API, typename T>
     static hipsolverStatus_t run_function(const char* name, Arguments& argus)
     {
         // Map for functions that support all precisions
         static const func_map map = {
-            {"gebrd", testing_gebrd<false, false, false, T>},
-            {"gels", testing_gels<API_NORMAL, false, false, false, T>},
-            {"geqrf", testing_geqrf<false, false, false, T>},
-            {"gesv", testing_gesv<API_NORMAL, false, false, false, T>},
-            {"gesvd", testing_gesvd<API_NORMAL, false, false, false, T>},
+            {"gebrd", testing_gebrd<API == API_FORTRAN, false, false, T>},
+            {"gels", testing_gels<API, false, false, false, T>},
+            {"geqrf", testing_geqrf<API == API_FORTRAN, false, false, T>},
+            {"geqrf_vbatched", testing_geqrf_vbatched<API, T>},
+            {"gesv", testing_gesv<API, false, false, false, T>},
+            {"gesvd", testing_gesvd<API, false, false, false, T>},
+            {"gesvd_strided_batched", testing_gesvd<API, false, true, false, T>},
             {"gesvdj", testing_gesvdj<API_COMPAT, false, false, T>},
             {"gesvdj_batched", testing_gesvdj<API_COMPAT, false, true, T>},
-            {"getrf", testing_getrf<API_NORMAL, false, false, false, T>},
-            {"getrs", testing_getrs<API_NORMAL, false, false, T>},
-            {"potrf", testing_potrf<API_NORMAL, false, false, T>},
-            {"potrf_batched", testing_potrf<API_NORMAL, true, false, T>},
-            {"potri", testing_potri<false, false, false, T>},
-            {"potrs", testing_potrs<API_NORMAL, false, false, T>},
-            {"potrs_batched", testing_potrs<API_NORMAL, true, false, T>},
-            {"sytrf", testing_sytrf<false, false, false, T>},
+            {"getrf", testing_getrf<API, false, false, false, T>},
+            {"getrf_npvt_vbatched", testing_getrf_vbatched<API, true, T>},
+            {"getrf_vbatched", testing_getrf_vbatched<API, false, T>},
+            {"getrs", testing_getrs<API, false, false, T>},
+            {"gtsv", testing_gtsv<API, false, false, false, T>},
+            {"gtsv_strided_batched", testing_gtsv<API, false, true, false, T>},
+            {"gtsv_nopivot", testing_gtsv<API, false, false, true, T>},
+            {"gtsv_nopivot_strided_batched", testing_gtsv<API, false, true, true, T>},
+            {"pbtrf", testing_pbtrf<API, false, false, T>},
+            {"pbtrf_strided_batched", testing_pbtrf<API, false, true, T>},
+            {"pbtrs", testing_pbtrs<API, false, false, T>},
+            {"pbtrs_strided_batched", testing_pbtrs<API, false, true, T>},
+            {"posv", testing_posv<API, false, false, T>},
+            {"posv_batched", testing_posv<API, true, false, T>},
+            {"posv_strided_batched", testing_posv<API, false, true, T>},
+            {"potrf", testing_potrf<API, false, false, T>},
+            {"potrf_batched", testing_potrf<API, true, false, T>},
+            {"potrf_downdate", testing_potrf_downdate<API, false, false, T>},
+            {"potrf_downdate_batched", testing_potrf_downdate<API, true, false, T>},
+            {"potrf_downdate_strided_batched", testing_potrf_downdate<API, false, true, T>},
+            {"potrf_update", testing_potrf_update<API, false, false, T>},
+            {"potrf_update_batched", testing_potrf_update<API, true, false, T>},
+            {"potrf_update_strided_batched", testing_potrf_update<API, false, true, T>},
+            {"potrf_vbatched", testing_potrf_vbatched<API, T>},
+            {"potri", testing_potri<API == API_FORTRAN, false, false, T>},
+            {"potrs", testing_potrs<API, false, false, T>},
+            {"potrs_batched", testing_potrs<API, true, false, T>},
+            {"potrs_vbatched", testing_potrs_vbatched<API, T>},
+            {"pptrf", testing_pptrf<API, T>},
+            {"pptrs", testing_pptrs<API, T>},
+            {"sytrf", testing_sytrf<API == API_FORTRAN, false, false, T>},
+            {"trttp", testing_trttp<API, T>},
         };
 
         // Grab function from the map and execute
@@ -78,22 +117,23 @@ class hipsolver_dispatcher
             return HIPSOLVER_STATUS_INVALID_VALUE;
     }
 
-    template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+    template <testAPI_t API, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
     static hipsolverStatus_t run_function_limited_precision(const char* name, Arguments& argus)
     {
         // Map for functions that support single and double precisions
         static const func_map map_real = {
-            {"orgbr", testing_orgbr_ungbr<false, T>},
-            {"orgqr", testing_orgqr_ungqr<false, T>},
-            {"orgtr", testing_orgtr_ungtr<false, T>},
-            {"ormqr", testing_ormqr_unmqr<false, T>},
-            {"ormtr", testing_ormtr_unmtr<false, T>},
-            {"syevd", testing_syevd_heevd<false, false, false, T>},
+            {"orgbr", testing_orgbr_ungbr<API == API_FORTRAN, T>},
+            {"orgqr", testing_orgqr_ungqr<API == API_FORTRAN, T>},
+            {"orgtr", testing_orgtr_ungtr<API == API_FORTRAN, T>},
+            {"ormqr", testing_ormqr_unmqr<API == API_FORTRAN, T>},
+            {"ormtr", testing_ormtr_unmtr<API == API_FORTRAN, T>},
+            {"spevd", testing_spevd_hpevd<API, T>},
+            {"syevd", testing_syevd_heevd<API == API_FORTRAN, false, false, T>},
             {"syevj", testing_syevj_heevj<API_COMPAT, false, false, T>},
             {"syevj_batched", testing_syevj_heevj<API_COMPAT, false, true, T>},
             {"sygvj", testing_sygvj_hegvj<API_COMPAT, false, false, T>},
-            {"sygvd", testing_sygvd_hegvd<false, false, false, T>},
-            {"sytrd", testing_sytrd_hetrd<false, false, false, T>},
+            {"sygvd", testing_sygvd_hegvd<API == API_FORTRAN, false, false, T>},
+            {"sytrd", testing_sytrd_hetrd<API == API_FORTRAN, false, false, T>},
         };
 
         // Grab function from the map and execute
@@ -107,22 +147,23 @@ class hipsolver_dispatcher
             return HIPSOLVER_STATUS_INVALID_VALUE;
     }
 
-    template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+    template <testAPI_t API, typename T, std::enable_if_t<is_complex<T>, int> = 0>
     static hipsolverStatus_t run_function_limited_precision(const char* name, Arguments& argus)
     {
         // Map for functions that support single complex and double complex precisions
         static const func_map map_complex = {
-            {"ungbr", testing_orgbr_ungbr<false, T>},
-            {"ungqr", testing_orgqr_ungqr<false, T>},
-            {"ungtr", testing_orgtr_ungtr<false, T>},
-            {"unmqr", testing_ormqr_unmqr<false, T>},
-            {"unmtr", testing_ormtr_unmtr<false, T>},
-            {"heevd", testing_syevd_heevd<false, false, false, T>},
+            {"ungbr", testing_orgbr_ungbr<API == API_FORTRAN, T>},
+            {"ungqr", testing_orgqr_ungqr<API == API_FORTRAN, T>},
+            {"ungtr", testing_orgtr_ungtr<API == API_FORTRAN, T>},
+            {"unmqr", testing_ormqr_unmqr<API == API_FORTRAN, T>},
+            {"unmtr", testing_ormtr_unmtr<API == API_FORTRAN, T>},
+            {"heevd", testing_syevd_heevd<API == API_FORTRAN, false, false, T>},
+            {"hpevd", testing_spevd_hpevd<API, T>},
             {"heevj", testing_syevj_heevj<API_COMPAT, false, false, T>},
             {"heevj_batched", testing_syevj_heevj<API_COMPAT, false, true, T>},
             {"hegvj", testing_sygvj_hegvj<API_COMPAT, false, false, T>},
-            {"hegvd", testing_sygvd_hegvd<false, false, false, T>},
-            {"hetrd", testing_sytrd_hetrd<false, false, false, T>},
+            {"hegvd", testing_sygvd_hegvd<API == API_FORTRAN, false, false, T>},
+            {"hetrd", testing_sytrd_hetrd<API == API_FORTRAN, false, false, T>},
         };
 
         // Grab function from the map and execute
@@ -136,33 +177,33 @@ class hipsolver_dispatcher
             return HIPSOLVER_STATUS_INVALID_VALUE;
     }
 
-public:
-    static void invoke(const std::string& name, char precision, Arguments& argus)
+    template <testAPI_t API>
+    static void invoke_api(const std::string& name, char precision, Arguments& argus)
     {
         hipsolverStatus_t status;
 
         if(precision == 's')
-            status = run_function<float>(name.c_str(), argus);
+            status = run_function<API, float>(name.c_str(), argus);
         else if(precision == 'd')
-            status = run_function<double>(name.c_str(), argus);
+            status = run_function<API, double>(name.c_str(), argus);
         else if(precision == 'c')
-            status = run_function<hipsolverComplex>(name.c_str(), argus);
+            status = run_function<API, hipsolverComplex>(name.c_str(), argus);
         else if(precision == 'z')
-            status = run_function<hipsolverDoubleComplex>(name.c_str(), argus);
+            status = run_function<API, hipsolverDoubleComplex>(name.c_str(), argus);
         else
             throw std::invalid_argument("Invalid value for --precision");
 
         if(status == HIPSOLVER_STATUS_INVALID_VALUE)
         {
             if(precision == 's')
-                status = run_function_limited_precision<float>(name.c_str(), argus);
+                status = run_function_limited_precision<API, float>(name.c_str(), argus);
             else if(precision == 'd')
-                status = run_function_limited_precision<double>(name.c_str(), argus);
+                status = run_function_limited_precision<API, double>(name.c_str(), argus);
             else if(precision == 'c')
-                status = run_function_limited_precision<hipsolverComplex>(name.c_str(), argus);
+                status = run_function_limited_precision<API, hipsolverComplex>(name.c_str(), argus);
             else if(precision == 'z')
-                status
-                    = run_function_limited_precision<hipsolverDoubleComplex>(name.c_str(), argus);
+                status = run_function_limited_precision<API, hipsolverDoubleComplex>(name.c_str(),
+                                                                                     argus);
         }
 
         if(status == HIPSOLVER_STATUS_INVALID_VALUE)
@@ -174,4 +215,20 @@ public:
             throw std::invalid_argument(msg);
         }
     }
+
+public:
+    // Functions whose tests only distinguish the Fortran API from the regular one run the
+    // regular API when API_COMPAT is requested; the Jacobi functions always use API_COMPAT
+    static void invoke(const std::string& name,
+                       char               precision,
+                       Arguments&         argus,
+                       testAPI_t          api = API_NORMAL)
+    {
+        if(api == API_FORTRAN)
+            invoke_api<API_FORTRAN>(name, precision, argus);
+        else if(api == API_COMPAT)
+            invoke_api<API_COMPAT>(name, precision, argus);
+        else
+            invoke_api<API_NORMAL>(name, precision, argus);
+    }
 };
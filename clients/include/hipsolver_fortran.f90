@@ -1308,6 +1308,159 @@ module hipsolver_interface
         res = hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
     end function hipsolverZgeqrfFortran
     
+    ! ******************** GEQRF_VBATCHED ********************
+    function hipsolverSgeqrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverSgeqrfVbatched_bufferSizeFortran
+    
+    function hipsolverDgeqrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverDgeqrfVbatched_bufferSizeFortran
+    
+    function hipsolverCgeqrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverCgeqrfVbatched_bufferSizeFortran
+    
+    function hipsolverZgeqrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverZgeqrfVbatched_bufferSizeFortran
+    
+    function hipsolverSgeqrfVbatchedFortran(handle, m, n, A, lda, tau, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, batch_count)
+    end function hipsolverSgeqrfVbatchedFortran
+    
+    function hipsolverDgeqrfVbatchedFortran(handle, m, n, A, lda, tau, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, batch_count)
+    end function hipsolverDgeqrfVbatchedFortran
+    
+    function hipsolverCgeqrfVbatchedFortran(handle, m, n, A, lda, tau, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, batch_count)
+    end function hipsolverCgeqrfVbatchedFortran
+    
+    function hipsolverZgeqrfVbatchedFortran(handle, m, n, A, lda, tau, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, batch_count)
+    end function hipsolverZgeqrfVbatchedFortran
+    
     ! ******************** GESV ********************
     function hipsolverSSgesv_bufferSizeFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork) &
             result(res) &
@@ -1658,6 +1811,227 @@ module hipsolver_interface
         res = hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
     end function hipsolverZgesvdFortran
 
+    ! ******************** GESVD_STRIDED_BATCHED ********************
+    function hipsolverSgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count)
+    end function hipsolverSgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count)
+    end function hipsolverDgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count)
+    end function hipsolverCgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count)
+    end function hipsolverZgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+        strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count)
+    end function hipsolverSgesvdStridedBatchedFortran
+    
+    function hipsolverDgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+        strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count)
+    end function hipsolverDgesvdStridedBatchedFortran
+    
+    function hipsolverCgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+        strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count)
+    end function hipsolverCgesvdStridedBatchedFortran
+    
+    function hipsolverZgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+        strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count)
+    end function hipsolverZgesvdStridedBatchedFortran
+
     ! ******************** GETRF ********************
     function hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
             result(res) &
@@ -1799,40 +2173,197 @@ module hipsolver_interface
         res = hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
     end function hipsolverZgetrfFortran
     
-    ! ******************** GETRS ********************
-    function hipsolverSgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+    ! ******************** GETRF_VBATCHED ********************
+    function hipsolverSgetrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgetrfVbatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
-        integer(c_int), value :: n
-        integer(c_int), value :: nrhs
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
         type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: lda
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverSgetrs_bufferSizeFortran
+        res = hipsolverSgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverSgetrfVbatched_bufferSizeFortran
     
-    function hipsolverDgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+    function hipsolverDgetrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgetrfVbatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
-        integer(c_int), value :: n
-        integer(c_int), value :: nrhs
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
         type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverDgetrfVbatched_bufferSizeFortran
+    
+    function hipsolverCgetrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverCgetrfVbatched_bufferSizeFortran
+    
+    function hipsolverZgetrfVbatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverZgetrfVbatched_bufferSizeFortran
+    
+    function hipsolverSgetrfVbatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count)
+    end function hipsolverSgetrfVbatchedFortran
+    
+    function hipsolverDgetrfVbatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count)
+    end function hipsolverDgetrfVbatchedFortran
+    
+    function hipsolverCgetrfVbatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count)
+    end function hipsolverCgetrfVbatchedFortran
+    
+    function hipsolverZgetrfVbatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count)
+    end function hipsolverZgetrfVbatchedFortran
+    
+    ! ******************** GETRS ********************
+    function hipsolverSgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverSgetrs_bufferSizeFortran
+    
+    function hipsolverDgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
@@ -1968,754 +2499,4706 @@ module hipsolver_interface
         res = hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
     end function hipsolverZgetrsFortran
 
-    ! ******************** POTRF ********************
-    function hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    ! ******************** GTSV ********************
+    function hipsolverSgtsv_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgtsv_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverSpotrf_bufferSizeFortran
+        res = hipsolverSgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverSgtsv_bufferSizeFortran
     
-    function hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverDgtsv_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgtsv_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverDpotrf_bufferSizeFortran
+        res = hipsolverDgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverDgtsv_bufferSizeFortran
     
-    function hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverCgtsv_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverCgtsv_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverCpotrf_bufferSizeFortran
+        res = hipsolverCgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverCgtsv_bufferSizeFortran
     
-    function hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverZgtsv_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverZgtsv_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverZpotrf_bufferSizeFortran
-
-    function hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverZgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverZgtsv_bufferSizeFortran
+    
+    function hipsolverSgtsvFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfFortran')
+            bind(c, name = 'hipsolverSgtsvFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverSpotrfFortran
-
-    function hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverSgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverSgtsvFortran
+    
+    function hipsolverDgtsvFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfFortran')
+            bind(c, name = 'hipsolverDgtsvFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverDpotrfFortran
-
-    function hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverDgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverDgtsvFortran
+    
+    function hipsolverCgtsvFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfFortran')
+            bind(c, name = 'hipsolverCgtsvFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverCpotrfFortran
-
-    function hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverCgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverCgtsvFortran
+    
+    function hipsolverZgtsvFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfFortran')
+            bind(c, name = 'hipsolverZgtsvFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverZpotrfFortran
+        res = hipsolverZgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverZgtsvFortran
     
-    ! ******************** POTRF_BATCHED ********************
-    function hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+    ! ******************** GTSV_STRIDED_BATCHED ********************
+    function hipsolverSgtsvStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, strideD, &
+        B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgtsvStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverSpotrfBatched_bufferSizeFortran
+        res = hipsolverSgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, lwork, batch_count)
+    end function hipsolverSgtsvStridedBatched_bufferSizeFortran
     
-    function hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+    function hipsolverDgtsvStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, strideD, &
+        B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgtsvStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverDpotrfBatched_bufferSizeFortran
+        res = hipsolverDgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, lwork, batch_count)
+    end function hipsolverDgtsvStridedBatched_bufferSizeFortran
     
-    function hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+    function hipsolverCgtsvStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, strideD, &
+        B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverCgtsvStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverCpotrfBatched_bufferSizeFortran
+        res = hipsolverCgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, lwork, batch_count)
+    end function hipsolverCgtsvStridedBatched_bufferSizeFortran
     
-    function hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+    function hipsolverZgtsvStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, strideD, &
+        B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverZgtsvStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverZpotrfBatched_bufferSizeFortran
-
-    function hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        res = hipsolverZgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, lwork, batch_count)
+    end function hipsolverZgtsvStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgtsvStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfBatchedFortran')
+            bind(c, name = 'hipsolverSgtsvStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverSpotrfBatchedFortran
+        res = hipsolverSgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, &
+            work, lwork, info, batch_count)
+    end function hipsolverSgtsvStridedBatchedFortran
     
-    function hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+    function hipsolverDgtsvStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfBatchedFortran')
+            bind(c, name = 'hipsolverDgtsvStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverDpotrfBatchedFortran
+        res = hipsolverDgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, &
+            work, lwork, info, batch_count)
+    end function hipsolverDgtsvStridedBatchedFortran
     
-    function hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+    function hipsolverCgtsvStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfBatchedFortran')
+            bind(c, name = 'hipsolverCgtsvStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverCpotrfBatchedFortran
+        res = hipsolverCgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, &
+            work, lwork, info, batch_count)
+    end function hipsolverCgtsvStridedBatchedFortran
     
-    function hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+    function hipsolverZgtsvStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfBatchedFortran')
+            bind(c, name = 'hipsolverZgtsvStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverZpotrfBatchedFortran
-
-    ! ******************** POTRI ********************
-    function hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+        res = hipsolverZgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, &
+            work, lwork, info, batch_count)
+    end function hipsolverZgtsvStridedBatchedFortran
+    
+    ! ******************** GTSV_NOPIVOT ********************
+    function hipsolverSgtsvNopivot_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSpotri_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgtsvNopivot_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverSpotri_bufferSizeFortran
+        res = hipsolverSgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverSgtsvNopivot_bufferSizeFortran
     
-    function hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverDgtsvNopivot_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDpotri_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgtsvNopivot_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverDpotri_bufferSizeFortran
+        res = hipsolverDgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverDgtsvNopivot_bufferSizeFortran
     
-    function hipsolverCpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverCgtsvNopivot_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCpotri_bufferSizeFortran')
+            bind(c, name = 'hipsolverCgtsvNopivot_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCpotri_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverCpotri_bufferSizeFortran
+        res = hipsolverCgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverCgtsvNopivot_bufferSizeFortran
     
-    function hipsolverZpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverZgtsvNopivot_bufferSizeFortran(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZpotri_bufferSizeFortran')
+            bind(c, name = 'hipsolverZgtsvNopivot_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZpotri_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverZpotri_bufferSizeFortran
-
-    function hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverZgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork)
+    end function hipsolverZgtsvNopivot_bufferSizeFortran
+    
+    function hipsolverSgtsvNopivotFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, &
+        info) &
             result(res) &
-            bind(c, name = 'hipsolverSpotriFortran')
+            bind(c, name = 'hipsolverSgtsvNopivotFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverSpotriFortran
-
-    function hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverSgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverSgtsvNopivotFortran
+    
+    function hipsolverDgtsvNopivotFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, &
+        info) &
             result(res) &
-            bind(c, name = 'hipsolverDpotriFortran')
+            bind(c, name = 'hipsolverDgtsvNopivotFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverDpotriFortran
-
-    function hipsolverCpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverDgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverDgtsvNopivotFortran
+    
+    function hipsolverCgtsvNopivotFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, &
+        info) &
             result(res) &
-            bind(c, name = 'hipsolverCpotriFortran')
+            bind(c, name = 'hipsolverCgtsvNopivotFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCpotri(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverCpotriFortran
-
-    function hipsolverZpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverCgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverCgtsvNopivotFortran
+    
+    function hipsolverZgtsvNopivotFortran(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, &
+        info) &
             result(res) &
-            bind(c, name = 'hipsolverZpotriFortran')
+            bind(c, name = 'hipsolverZgtsvNopivotFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZpotri(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverZpotriFortran
-
-    ! ******************** POTRS ********************
-    function hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+        res = hipsolverZgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info)
+    end function hipsolverZgtsvNopivotFortran
+    
+    ! ******************** GTSV_NOPIVOT_STRIDED_BATCHED ********************
+    function hipsolverSgtsvNopivotStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, &
+        strideD, B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverSgtsvNopivotStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
-    end function hipsolverSpotrs_bufferSizeFortran
+        res = hipsolverSgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, &
+            B, ldb, strideB, lwork, batch_count)
+    end function hipsolverSgtsvNopivotStridedBatched_bufferSizeFortran
     
-    function hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+    function hipsolverDgtsvNopivotStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, &
+        strideD, B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverDgtsvNopivotStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
-    end function hipsolverDpotrs_bufferSizeFortran
+        res = hipsolverDgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, &
+            B, ldb, strideB, lwork, batch_count)
+    end function hipsolverDgtsvNopivotStridedBatched_bufferSizeFortran
     
-    function hipsolverCpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+    function hipsolverCgtsvNopivotStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, &
+        strideD, B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverCgtsvNopivotStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
-    end function hipsolverCpotrs_bufferSizeFortran
+        res = hipsolverCgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, &
+            B, ldb, strideB, lwork, batch_count)
+    end function hipsolverCgtsvNopivotStridedBatched_bufferSizeFortran
     
-    function hipsolverZpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+    function hipsolverZgtsvNopivotStridedBatched_bufferSizeFortran(handle, n, nrhs, dl, d, du, &
+        strideD, B, ldb, strideB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverZgtsvNopivotStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
-    end function hipsolverZpotrs_bufferSizeFortran
-
-    function hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        res = hipsolverZgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, &
+            B, ldb, strideB, lwork, batch_count)
+    end function hipsolverZgtsvNopivotStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgtsvNopivotStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, &
+        ldb, strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrsFortran')
+            bind(c, name = 'hipsolverSgtsvNopivotStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
-    end function hipsolverSpotrsFortran
-
-    function hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        res = hipsolverSgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverSgtsvNopivotStridedBatchedFortran
+    
+    function hipsolverDgtsvNopivotStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, &
+        ldb, strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrsFortran')
+            bind(c, name = 'hipsolverDgtsvNopivotStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
-    end function hipsolverDpotrsFortran
-
-    function hipsolverCpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        res = hipsolverDgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverDgtsvNopivotStridedBatchedFortran
+    
+    function hipsolverCgtsvNopivotStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, &
+        ldb, strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrsFortran')
+            bind(c, name = 'hipsolverCgtsvNopivotStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
-    end function hipsolverCpotrsFortran
-
-    function hipsolverZpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        res = hipsolverCgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverCgtsvNopivotStridedBatchedFortran
+    
+    function hipsolverZgtsvNopivotStridedBatchedFortran(handle, n, nrhs, dl, d, du, strideD, B, &
+        ldb, strideB, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrsFortran')
+            bind(c, name = 'hipsolverZgtsvNopivotStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: dl
+        type(c_ptr), value :: d
+        type(c_ptr), value :: du
+        integer(c_int), value :: strideD
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
-    end function hipsolverZpotrsFortran
-
-    ! ******************** POTRS_BATCHED ********************
-    function hipsolverSpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+        res = hipsolverZgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverZgtsvNopivotStridedBatchedFortran
+    
+    ! ******************** PBTRF ********************
+    function hipsolverSpbtrf_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrsBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverSpbtrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
-    end function hipsolverSpotrsBatched_bufferSizeFortran
+        res = hipsolverSpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork)
+    end function hipsolverSpbtrf_bufferSizeFortran
     
-    function hipsolverDpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+    function hipsolverDpbtrf_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrsBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverDpbtrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
-    end function hipsolverDpotrsBatched_bufferSizeFortran
+        res = hipsolverDpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork)
+    end function hipsolverDpbtrf_bufferSizeFortran
     
-    function hipsolverCpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+    function hipsolverCpbtrf_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrsBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverCpbtrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
-    end function hipsolverCpotrsBatched_bufferSizeFortran
+        res = hipsolverCpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork)
+    end function hipsolverCpbtrf_bufferSizeFortran
     
-    function hipsolverZpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+    function hipsolverZpbtrf_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrsBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverZpbtrf_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: lwork
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
-    end function hipsolverZpotrsBatched_bufferSizeFortran
-
-    function hipsolverSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        res = hipsolverZpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork)
+    end function hipsolverZpbtrf_bufferSizeFortran
+    
+    function hipsolverSpbtrfFortran(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrsBatchedFortran')
+            bind(c, name = 'hipsolverSpbtrfFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
-    end function hipsolverSpotrsBatchedFortran
-
-    function hipsolverDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        res = hipsolverSpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info)
+    end function hipsolverSpbtrfFortran
+    
+    function hipsolverDpbtrfFortran(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrsBatchedFortran')
+            bind(c, name = 'hipsolverDpbtrfFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info)
+    end function hipsolverDpbtrfFortran
+    
+    function hipsolverCpbtrfFortran(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpbtrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info)
+    end function hipsolverCpbtrfFortran
+    
+    function hipsolverZpbtrfFortran(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpbtrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info)
+    end function hipsolverZpbtrfFortran
+    
+    ! ******************** PBTRF_STRIDED_BATCHED ********************
+    function hipsolverSpbtrfStridedBatched_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, &
+        strideAB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpbtrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
-    end function hipsolverDpotrsBatchedFortran
-
-    function hipsolverCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        res = hipsolverSpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count)
+    end function hipsolverSpbtrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverDpbtrfStridedBatched_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, &
+        strideAB, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrsBatchedFortran')
+            bind(c, name = 'hipsolverDpbtrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count)
+    end function hipsolverDpbtrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverCpbtrfStridedBatched_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, &
+        strideAB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpbtrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count)
+    end function hipsolverCpbtrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverZpbtrfStridedBatched_bufferSizeFortran(handle, uplo, n, kd, AB, ldab, &
+        strideAB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpbtrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count)
+    end function hipsolverZpbtrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverSpbtrfStridedBatchedFortran(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+        lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpbtrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, lwork, &
+            info, batch_count)
+    end function hipsolverSpbtrfStridedBatchedFortran
+    
+    function hipsolverDpbtrfStridedBatchedFortran(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+        lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpbtrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, lwork, &
+            info, batch_count)
+    end function hipsolverDpbtrfStridedBatchedFortran
+    
+    function hipsolverCpbtrfStridedBatchedFortran(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+        lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpbtrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, lwork, &
+            info, batch_count)
+    end function hipsolverCpbtrfStridedBatchedFortran
+    
+    function hipsolverZpbtrfStridedBatchedFortran(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+        lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpbtrfStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: kd
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, lwork, &
+            info, batch_count)
+    end function hipsolverZpbtrfStridedBatchedFortran
+    
+    ! ******************** PBTRS ********************
+    function hipsolverSpbtrs_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpbtrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork)
+    end function hipsolverSpbtrs_bufferSizeFortran
+    
+    function hipsolverDpbtrs_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpbtrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork)
+    end function hipsolverDpbtrs_bufferSizeFortran
+    
+    function hipsolverCpbtrs_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpbtrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork)
+    end function hipsolverCpbtrs_bufferSizeFortran
+    
+    function hipsolverZpbtrs_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpbtrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork)
+    end function hipsolverZpbtrs_bufferSizeFortran
+    
+    function hipsolverSpbtrsFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+        info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpbtrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
-        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
-    end function hipsolverCpotrsBatchedFortran
-
-    function hipsolverZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        res = hipsolverSpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info)
+    end function hipsolverSpbtrsFortran
+    
+    function hipsolverDpbtrsFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+        info) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrsBatchedFortran')
+            bind(c, name = 'hipsolverDpbtrsFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        integer(c_int), value :: kd
         integer(c_int), value :: nrhs
-        type(c_ptr), value :: A
-        integer(c_int), value :: lda
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info)
+    end function hipsolverDpbtrsFortran
+    
+    function hipsolverCpbtrsFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+        info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpbtrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info)
+    end function hipsolverCpbtrsFortran
+    
+    function hipsolverZpbtrsFortran(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+        info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpbtrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, info)
+    end function hipsolverZpbtrsFortran
+    
+    ! ******************** PBTRS_STRIDED_BATCHED ********************
+    function hipsolverSpbtrsStridedBatched_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, &
+        strideAB, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpbtrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
-    end function hipsolverZpotrsBatchedFortran
+        res = hipsolverSpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count)
+    end function hipsolverSpbtrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverDpbtrsStridedBatched_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, &
+        strideAB, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpbtrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count)
+    end function hipsolverDpbtrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverCpbtrsStridedBatched_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, &
+        strideAB, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpbtrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count)
+    end function hipsolverCpbtrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverZpbtrsStridedBatched_bufferSizeFortran(handle, uplo, n, kd, nrhs, AB, ldab, &
+        strideAB, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpbtrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count)
+    end function hipsolverZpbtrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverSpbtrsStridedBatchedFortran(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, &
+        B, ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpbtrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverSpbtrsStridedBatchedFortran
+    
+    function hipsolverDpbtrsStridedBatchedFortran(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, &
+        B, ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpbtrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverDpbtrsStridedBatchedFortran
+    
+    function hipsolverCpbtrsStridedBatchedFortran(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, &
+        B, ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpbtrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverCpbtrsStridedBatchedFortran
+    
+    function hipsolverZpbtrsStridedBatchedFortran(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, &
+        B, ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpbtrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: kd
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AB
+        integer(c_int), value :: ldab
+        integer(c_int), value :: strideAB
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverZpbtrsStridedBatchedFortran
+    
+    ! ******************** POSV ********************
+    function hipsolverSposv_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSposv_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverSposv_bufferSizeFortran
+    
+    function hipsolverDposv_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDposv_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverDposv_bufferSizeFortran
+    
+    function hipsolverCposv_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCposv_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverCposv_bufferSizeFortran
+    
+    function hipsolverZposv_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZposv_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverZposv_bufferSizeFortran
+    
+    function hipsolverSposvFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSposvFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverSposvFortran
+    
+    function hipsolverDposvFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDposvFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverDposvFortran
+    
+    function hipsolverCposvFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCposvFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverCposvFortran
+    
+    function hipsolverZposvFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZposvFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverZposvFortran
+
+    ! ******************** POSV_BATCHED ********************
+    function hipsolverSposvBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSposvBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverSposvBatched_bufferSizeFortran
+    
+    function hipsolverDposvBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDposvBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverDposvBatched_bufferSizeFortran
+    
+    function hipsolverCposvBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCposvBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverCposvBatched_bufferSizeFortran
+    
+    function hipsolverZposvBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZposvBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverZposvBatched_bufferSizeFortran
+    
+    function hipsolverSposvBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSposvBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverSposvBatchedFortran
+    
+    function hipsolverDposvBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDposvBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverDposvBatchedFortran
+    
+    function hipsolverCposvBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCposvBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverCposvBatchedFortran
+    
+    function hipsolverZposvBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZposvBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverZposvBatchedFortran
+
+    ! ******************** POSV_STRIDED_BATCHED ********************
+    function hipsolverSposvStridedBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, &
+        strideA, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSposvStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, B, &
+            ldb, strideB, lwork, batch_count)
+    end function hipsolverSposvStridedBatched_bufferSizeFortran
+    
+    function hipsolverDposvStridedBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, &
+        strideA, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDposvStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, B, &
+            ldb, strideB, lwork, batch_count)
+    end function hipsolverDposvStridedBatched_bufferSizeFortran
+    
+    function hipsolverCposvStridedBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, &
+        strideA, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCposvStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, B, &
+            ldb, strideB, lwork, batch_count)
+    end function hipsolverCposvStridedBatched_bufferSizeFortran
+    
+    function hipsolverZposvStridedBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, &
+        strideA, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZposvStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, strideA, B, &
+            ldb, strideB, lwork, batch_count)
+    end function hipsolverZposvStridedBatched_bufferSizeFortran
+    
+    function hipsolverSposvStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSposvStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverSposvStridedBatchedFortran
+    
+    function hipsolverDposvStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDposvStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverDposvStridedBatchedFortran
+    
+    function hipsolverCposvStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCposvStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverCposvStridedBatchedFortran
+    
+    function hipsolverZposvStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+        strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZposvStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count)
+    end function hipsolverZposvStridedBatchedFortran
+
+    ! ******************** POTRF ********************
+    function hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverSpotrf_bufferSizeFortran
+    
+    function hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverDpotrf_bufferSizeFortran
+    
+    function hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverCpotrf_bufferSizeFortran
+    
+    function hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverZpotrf_bufferSizeFortran
+
+    function hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverSpotrfFortran
+
+    function hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverDpotrfFortran
+
+    function hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverCpotrfFortran
+
+    function hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverZpotrfFortran
+    
+    ! ******************** POTRF_BATCHED ********************
+    function hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverSpotrfBatched_bufferSizeFortran
+    
+    function hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverDpotrfBatched_bufferSizeFortran
+    
+    function hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverCpotrfBatched_bufferSizeFortran
+    
+    function hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverZpotrfBatched_bufferSizeFortran
+
+    function hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverSpotrfBatchedFortran
+    
+    function hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverDpotrfBatchedFortran
+    
+    function hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverCpotrfBatchedFortran
+    
+    function hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverZpotrfBatchedFortran
+
+    ! ******************** POTRF_VBATCHED ********************
+    function hipsolverSpotrfVbatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverSpotrfVbatched_bufferSizeFortran
+    
+    function hipsolverDpotrfVbatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverDpotrfVbatched_bufferSizeFortran
+    
+    function hipsolverCpotrfVbatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverCpotrfVbatched_bufferSizeFortran
+    
+    function hipsolverZpotrfVbatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverZpotrfVbatched_bufferSizeFortran
+    
+    function hipsolverSpotrfVbatchedFortran(handle, uplo, n, A, lda, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverSpotrfVbatchedFortran
+    
+    function hipsolverDpotrfVbatchedFortran(handle, uplo, n, A, lda, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverDpotrfVbatchedFortran
+    
+    function hipsolverCpotrfVbatchedFortran(handle, uplo, n, A, lda, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverCpotrfVbatchedFortran
+    
+    function hipsolverZpotrfVbatchedFortran(handle, uplo, n, A, lda, work, lwork, info, &
+        batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverZpotrfVbatchedFortran
+
+    ! ******************** POTRF_UPDATE ********************
+    function hipsolverSpotrfUpdate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfUpdate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverSpotrfUpdate_bufferSizeFortran
+    
+    function hipsolverDpotrfUpdate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfUpdate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverDpotrfUpdate_bufferSizeFortran
+    
+    function hipsolverCpotrfUpdate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfUpdate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverCpotrfUpdate_bufferSizeFortran
+    
+    function hipsolverZpotrfUpdate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfUpdate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverZpotrfUpdate_bufferSizeFortran
+    
+    function hipsolverSpotrfUpdateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfUpdateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverSpotrfUpdateFortran
+    
+    function hipsolverDpotrfUpdateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfUpdateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverDpotrfUpdateFortran
+    
+    function hipsolverCpotrfUpdateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfUpdateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverCpotrfUpdateFortran
+    
+    function hipsolverZpotrfUpdateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfUpdateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverZpotrfUpdateFortran
+    
+    ! ******************** POTRF_UPDATE_BATCHED ********************
+    function hipsolverSpotrfUpdateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfUpdateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverSpotrfUpdateBatched_bufferSizeFortran
+    
+    function hipsolverDpotrfUpdateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfUpdateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverDpotrfUpdateBatched_bufferSizeFortran
+    
+    function hipsolverCpotrfUpdateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfUpdateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverCpotrfUpdateBatched_bufferSizeFortran
+    
+    function hipsolverZpotrfUpdateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfUpdateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverZpotrfUpdateBatched_bufferSizeFortran
+    
+    function hipsolverSpotrfUpdateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfUpdateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverSpotrfUpdateBatchedFortran
+    
+    function hipsolverDpotrfUpdateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfUpdateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverDpotrfUpdateBatchedFortran
+    
+    function hipsolverCpotrfUpdateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfUpdateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverCpotrfUpdateBatchedFortran
+    
+    function hipsolverZpotrfUpdateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfUpdateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverZpotrfUpdateBatchedFortran
+    
+    ! ******************** POTRF_UPDATE_STRIDED_BATCHED ********************
+    function hipsolverSpotrfUpdateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfUpdateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverSpotrfUpdateStridedBatched_bufferSizeFortran
+    
+    function hipsolverDpotrfUpdateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfUpdateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverDpotrfUpdateStridedBatched_bufferSizeFortran
+    
+    function hipsolverCpotrfUpdateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfUpdateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverCpotrfUpdateStridedBatched_bufferSizeFortran
+    
+    function hipsolverZpotrfUpdateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfUpdateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverZpotrfUpdateStridedBatched_bufferSizeFortran
+    
+    function hipsolverSpotrfUpdateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfUpdateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverSpotrfUpdateStridedBatchedFortran
+    
+    function hipsolverDpotrfUpdateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfUpdateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverDpotrfUpdateStridedBatchedFortran
+    
+    function hipsolverCpotrfUpdateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfUpdateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverCpotrfUpdateStridedBatchedFortran
+    
+    function hipsolverZpotrfUpdateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfUpdateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverZpotrfUpdateStridedBatchedFortran
+    
+    ! ******************** POTRF_DOWNDATE ********************
+    function hipsolverSpotrfDowndate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfDowndate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverSpotrfDowndate_bufferSizeFortran
+    
+    function hipsolverDpotrfDowndate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfDowndate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverDpotrfDowndate_bufferSizeFortran
+    
+    function hipsolverCpotrfDowndate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfDowndate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverCpotrfDowndate_bufferSizeFortran
+    
+    function hipsolverZpotrfDowndate_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfDowndate_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork)
+    end function hipsolverZpotrfDowndate_bufferSizeFortran
+    
+    function hipsolverSpotrfDowndateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfDowndateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverSpotrfDowndateFortran
+    
+    function hipsolverDpotrfDowndateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfDowndateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverDpotrfDowndateFortran
+    
+    function hipsolverCpotrfDowndateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfDowndateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverCpotrfDowndateFortran
+    
+    function hipsolverZpotrfDowndateFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfDowndateFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info)
+    end function hipsolverZpotrfDowndateFortran
+    
+    ! ******************** POTRF_DOWNDATE_BATCHED ********************
+    function hipsolverSpotrfDowndateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfDowndateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverSpotrfDowndateBatched_bufferSizeFortran
+    
+    function hipsolverDpotrfDowndateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfDowndateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverDpotrfDowndateBatched_bufferSizeFortran
+    
+    function hipsolverCpotrfDowndateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfDowndateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverCpotrfDowndateBatched_bufferSizeFortran
+    
+    function hipsolverZpotrfDowndateBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfDowndateBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count)
+    end function hipsolverZpotrfDowndateBatched_bufferSizeFortran
+    
+    function hipsolverSpotrfDowndateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfDowndateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverSpotrfDowndateBatchedFortran
+    
+    function hipsolverDpotrfDowndateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfDowndateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverDpotrfDowndateBatchedFortran
+    
+    function hipsolverCpotrfDowndateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfDowndateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverCpotrfDowndateBatchedFortran
+    
+    function hipsolverZpotrfDowndateBatchedFortran(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfDowndateBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count)
+    end function hipsolverZpotrfDowndateBatchedFortran
+    
+    ! ******************** POTRF_DOWNDATE_STRIDED_BATCHED ********************
+    function hipsolverSpotrfDowndateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfDowndateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverSpotrfDowndateStridedBatched_bufferSizeFortran
+    
+    function hipsolverDpotrfDowndateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfDowndateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverDpotrfDowndateStridedBatched_bufferSizeFortran
+    
+    function hipsolverCpotrfDowndateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfDowndateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverCpotrfDowndateStridedBatched_bufferSizeFortran
+    
+    function hipsolverZpotrfDowndateStridedBatched_bufferSizeFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfDowndateStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count)
+    end function hipsolverZpotrfDowndateStridedBatched_bufferSizeFortran
+    
+    function hipsolverSpotrfDowndateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfDowndateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverSpotrfDowndateStridedBatchedFortran
+    
+    function hipsolverDpotrfDowndateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfDowndateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverDpotrfDowndateStridedBatchedFortran
+    
+    function hipsolverCpotrfDowndateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfDowndateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverCpotrfDowndateStridedBatchedFortran
+    
+    function hipsolverZpotrfDowndateStridedBatchedFortran(handle, uplo, n, k, A, lda, strideA, &
+        V, ldv, strideV, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfDowndateStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count)
+    end function hipsolverZpotrfDowndateStridedBatchedFortran
+    
+    ! ******************** POTRI ********************
+    function hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotri_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverSpotri_bufferSizeFortran
+    
+    function hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotri_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverDpotri_bufferSizeFortran
+    
+    function hipsolverCpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotri_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpotri_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverCpotri_bufferSizeFortran
+    
+    function hipsolverZpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotri_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpotri_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverZpotri_bufferSizeFortran
+
+    function hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotriFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverSpotriFortran
+
+    function hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotriFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverDpotriFortran
+
+    function hipsolverCpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotriFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotri(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverCpotriFortran
+
+    function hipsolverZpotriFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotriFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotri(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverZpotriFortran
+
+    ! ******************** POTRS ********************
+    function hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverSpotrs_bufferSizeFortran
+    
+    function hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverDpotrs_bufferSizeFortran
+    
+    function hipsolverCpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverCpotrs_bufferSizeFortran
+    
+    function hipsolverZpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork)
+    end function hipsolverZpotrs_bufferSizeFortran
+
+    function hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverSpotrsFortran
+
+    function hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverDpotrsFortran
+
+    function hipsolverCpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverCpotrsFortran
+
+    function hipsolverZpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info)
+    end function hipsolverZpotrsFortran
+
+    ! ******************** POTRS_BATCHED ********************
+    function hipsolverSpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverSpotrsBatched_bufferSizeFortran
+    
+    function hipsolverDpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverDpotrsBatched_bufferSizeFortran
+    
+    function hipsolverCpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverCpotrsBatched_bufferSizeFortran
+    
+    function hipsolverZpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverZpotrsBatched_bufferSizeFortran
+
+    function hipsolverSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverSpotrsBatchedFortran
+
+    function hipsolverDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverDpotrsBatchedFortran
+
+    function hipsolverCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverCpotrsBatchedFortran
+
+    function hipsolverZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverZpotrsBatchedFortran
+
+    ! ******************** POTRS_VBATCHED ********************
+    function hipsolverSpotrsVbatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverSpotrsVbatched_bufferSizeFortran
+    
+    function hipsolverDpotrsVbatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverDpotrsVbatched_bufferSizeFortran
+    
+    function hipsolverCpotrsVbatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverCpotrsVbatched_bufferSizeFortran
+    
+    function hipsolverZpotrsVbatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, &
+        lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsVbatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count)
+    end function hipsolverZpotrsVbatched_bufferSizeFortran
+    
+    function hipsolverSpotrsVbatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverSpotrsVbatchedFortran
+    
+    function hipsolverDpotrsVbatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverDpotrsVbatchedFortran
+    
+    function hipsolverCpotrsVbatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverCpotrsVbatchedFortran
+    
+    function hipsolverZpotrsVbatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+        info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsVbatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        type(c_ptr), value :: n
+        type(c_ptr), value :: nrhs
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count)
+    end function hipsolverZpotrsVbatchedFortran
+
+    ! ******************** PPTRF ********************
+    function hipsolverSpptrf_bufferSizeFortran(handle, uplo, n, AP, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpptrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpptrf_bufferSize(handle, uplo, n, AP, lwork)
+    end function hipsolverSpptrf_bufferSizeFortran
+    
+    function hipsolverDpptrf_bufferSizeFortran(handle, uplo, n, AP, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpptrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpptrf_bufferSize(handle, uplo, n, AP, lwork)
+    end function hipsolverDpptrf_bufferSizeFortran
+    
+    function hipsolverCpptrf_bufferSizeFortran(handle, uplo, n, AP, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpptrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpptrf_bufferSize(handle, uplo, n, AP, lwork)
+    end function hipsolverCpptrf_bufferSizeFortran
+    
+    function hipsolverZpptrf_bufferSizeFortran(handle, uplo, n, AP, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpptrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpptrf_bufferSize(handle, uplo, n, AP, lwork)
+    end function hipsolverZpptrf_bufferSizeFortran
+    
+    function hipsolverSpptrfFortran(handle, uplo, n, AP, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpptrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpptrf(handle, uplo, n, AP, work, lwork, info)
+    end function hipsolverSpptrfFortran
+    
+    function hipsolverDpptrfFortran(handle, uplo, n, AP, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpptrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpptrf(handle, uplo, n, AP, work, lwork, info)
+    end function hipsolverDpptrfFortran
+    
+    function hipsolverCpptrfFortran(handle, uplo, n, AP, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpptrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpptrf(handle, uplo, n, AP, work, lwork, info)
+    end function hipsolverCpptrfFortran
+    
+    function hipsolverZpptrfFortran(handle, uplo, n, AP, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpptrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpptrf(handle, uplo, n, AP, work, lwork, info)
+    end function hipsolverZpptrfFortran
+    
+    ! ******************** PPTRS ********************
+    function hipsolverSpptrs_bufferSizeFortran(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpptrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork)
+    end function hipsolverSpptrs_bufferSizeFortran
+    
+    function hipsolverDpptrs_bufferSizeFortran(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpptrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork)
+    end function hipsolverDpptrs_bufferSizeFortran
+    
+    function hipsolverCpptrs_bufferSizeFortran(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpptrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork)
+    end function hipsolverCpptrs_bufferSizeFortran
+    
+    function hipsolverZpptrs_bufferSizeFortran(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpptrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork)
+    end function hipsolverZpptrs_bufferSizeFortran
+    
+    function hipsolverSpptrsFortran(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpptrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info)
+    end function hipsolverSpptrsFortran
+    
+    function hipsolverDpptrsFortran(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpptrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info)
+    end function hipsolverDpptrsFortran
+    
+    function hipsolverCpptrsFortran(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpptrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info)
+    end function hipsolverCpptrsFortran
+    
+    function hipsolverZpptrsFortran(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpptrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info)
+    end function hipsolverZpptrsFortran
+    
+    ! ******************** SPEVD/HPEVD ********************
+    function hipsolverSspevd_bufferSizeFortran(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSspevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSspevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork)
+    end function hipsolverSspevd_bufferSizeFortran
+    
+    function hipsolverDspevd_bufferSizeFortran(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDspevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDspevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork)
+    end function hipsolverDspevd_bufferSizeFortran
+    
+    function hipsolverChpevd_bufferSizeFortran(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverChpevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverChpevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork)
+    end function hipsolverChpevd_bufferSizeFortran
+    
+    function hipsolverZhpevd_bufferSizeFortran(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZhpevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZhpevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork)
+    end function hipsolverZhpevd_bufferSizeFortran
+    
+    function hipsolverSspevdFortran(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSspevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSspevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info)
+    end function hipsolverSspevdFortran
+    
+    function hipsolverDspevdFortran(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDspevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDspevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info)
+    end function hipsolverDspevdFortran
+    
+    function hipsolverChpevdFortran(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverChpevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverChpevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info)
+    end function hipsolverChpevdFortran
+    
+    function hipsolverZhpevdFortran(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZhpevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: D
+        type(c_ptr), value :: Z
+        integer(c_int), value :: ldz
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZhpevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info)
+    end function hipsolverZhpevdFortran
+    
+    ! ******************** TRTTP ********************
+    function hipsolverStrttpFortran(handle, uplo, n, A, lda, AP) &
+            result(res) &
+            bind(c, name = 'hipsolverStrttpFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: AP
+        integer(c_int) :: res
+        res = hipsolverStrttp(handle, uplo, n, A, lda, AP)
+    end function hipsolverStrttpFortran
+    
+    function hipsolverDtrttpFortran(handle, uplo, n, A, lda, AP) &
+            result(res) &
+            bind(c, name = 'hipsolverDtrttpFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: AP
+        integer(c_int) :: res
+        res = hipsolverDtrttp(handle, uplo, n, A, lda, AP)
+    end function hipsolverDtrttpFortran
+    
+    function hipsolverCtrttpFortran(handle, uplo, n, A, lda, AP) &
+            result(res) &
+            bind(c, name = 'hipsolverCtrttpFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: AP
+        integer(c_int) :: res
+        res = hipsolverCtrttp(handle, uplo, n, A, lda, AP)
+    end function hipsolverCtrttpFortran
+    
+    function hipsolverZtrttpFortran(handle, uplo, n, A, lda, AP) &
+            result(res) &
+            bind(c, name = 'hipsolverZtrttpFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: AP
+        integer(c_int) :: res
+        res = hipsolverZtrttp(handle, uplo, n, A, lda, AP)
+    end function hipsolverZtrttpFortran
+    
+    ! ******************** TPTTR ********************
+    function hipsolverStpttrFortran(handle, uplo, n, AP, A, lda) &
+            result(res) &
+            bind(c, name = 'hipsolverStpttrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = hipsolverStpttr(handle, uplo, n, AP, A, lda)
+    end function hipsolverStpttrFortran
+    
+    function hipsolverDtpttrFortran(handle, uplo, n, AP, A, lda) &
+            result(res) &
+            bind(c, name = 'hipsolverDtpttrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = hipsolverDtpttr(handle, uplo, n, AP, A, lda)
+    end function hipsolverDtpttrFortran
+    
+    function hipsolverCtpttrFortran(handle, uplo, n, AP, A, lda) &
+            result(res) &
+            bind(c, name = 'hipsolverCtpttrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = hipsolverCtpttr(handle, uplo, n, AP, A, lda)
+    end function hipsolverCtpttrFortran
+    
+    function hipsolverZtpttrFortran(handle, uplo, n, AP, A, lda) &
+            result(res) &
+            bind(c, name = 'hipsolverZtpttrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: AP
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = hipsolverZtpttr(handle, uplo, n, AP, A, lda)
+    end function hipsolverZtpttrFortran
 
     ! ******************** SYEVD/HEEVD ********************
     function hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
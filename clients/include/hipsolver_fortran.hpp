@@ -714,6 +714,87 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfFortran(hipsolverHandle_t hand
                                                           int               lwork,
                                                           int*              devInfo);
 
+// geqrf_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeqrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              float*            A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeqrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              double*           A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeqrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              hipFloatComplex*  A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              hipDoubleComplex* A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  float*            A[],
+                                                                  const int*        lda,
+                                                                  float*            tau,
+                                                                  float*            work,
+                                                                  int               lwork,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  double*           A[],
+                                                                  const int*        lda,
+                                                                  double*           tau,
+                                                                  double*           work,
+                                                                  int               lwork,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  hipFloatComplex*  A[],
+                                                                  const int*        lda,
+                                                                  hipFloatComplex*  tau,
+                                                                  hipFloatComplex*  work,
+                                                                  int               lwork,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  hipDoubleComplex* A[],
+                                                                  const int*        lda,
+                                                                  hipDoubleComplex* tau,
+                                                                  hipDoubleComplex* work,
+                                                                  int               lwork,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
 // gesv
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSizeFortran(hipsolverHandle_t handle,
                                                                      int               n,
@@ -904,6 +985,135 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdFortran(hipsolverHandle_t hand
                                                           double*           rwork,
                                                           int*              devInfo);
 
+// gesvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                        signed char       jobu,
+                                                                        signed char       jobv,
+                                                                        int               m,
+                                                                        int               n,
+                                                                        float*            A,
+                                                                        int               lda,
+                                                                        int               strideA,
+                                                                        float*            S,
+                                                                        int               strideS,
+                                                                        float*            U,
+                                                                        int               ldu,
+                                                                        int               strideU,
+                                                                        float*            V,
+                                                                        int               ldv,
+                                                                        int               strideV,
+                                                                        float*            work,
+                                                                        int               lwork,
+                                                                        float*            rwork,
+                                                                        int strideRwork,
+                                                                        int*              devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                        signed char       jobu,
+                                                                        signed char       jobv,
+                                                                        int               m,
+                                                                        int               n,
+                                                                        double*           A,
+                                                                        int               lda,
+                                                                        int               strideA,
+                                                                        double*           S,
+                                                                        int               strideS,
+                                                                        double*           U,
+                                                                        int               ldu,
+                                                                        int               strideU,
+                                                                        double*           V,
+                                                                        int               ldv,
+                                                                        int               strideV,
+                                                                        double*           work,
+                                                                        int               lwork,
+                                                                        double*           rwork,
+                                                                        int strideRwork,
+                                                                        int*              devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                        signed char       jobu,
+                                                                        signed char       jobv,
+                                                                        int               m,
+                                                                        int               n,
+                                                                        hipFloatComplex*  A,
+                                                                        int               lda,
+                                                                        int               strideA,
+                                                                        float*            S,
+                                                                        int               strideS,
+                                                                        hipFloatComplex*  U,
+                                                                        int               ldu,
+                                                                        int               strideU,
+                                                                        hipFloatComplex*  V,
+                                                                        int               ldv,
+                                                                        int               strideV,
+                                                                        hipFloatComplex*  work,
+                                                                        int               lwork,
+                                                                        float*            rwork,
+                                                                        int strideRwork,
+                                                                        int*              devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                        signed char       jobu,
+                                                                        signed char       jobv,
+                                                                        int               m,
+                                                                        int               n,
+                                                                        hipDoubleComplex* A,
+                                                                        int               lda,
+                                                                        int               strideA,
+                                                                        double*           S,
+                                                                        int               strideS,
+                                                                        hipDoubleComplex* U,
+                                                                        int               ldu,
+                                                                        int               strideU,
+                                                                        hipDoubleComplex* V,
+                                                                        int               ldv,
+                                                                        int               strideV,
+                                                                        hipDoubleComplex* work,
+                                                                        int               lwork,
+                                                                        double*           rwork,
+                                                                        int strideRwork,
+                                                                        int*              devInfo,
+                                                                        int batch_count);
+
 // getrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_bufferSizeFortran(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -957,6 +1167,87 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfFortran(hipsolverHandle_t hand
                                                           int*              devIpiv,
                                                           int*              devInfo);
 
+// getrf_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              float*            A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              double*           A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              hipFloatComplex*  A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfVbatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                              const int*        m,
+                                              const int*        n,
+                                              hipDoubleComplex* A[],
+                                              const int*        lda,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  float*            A[],
+                                                                  const int*        lda,
+                                                                  float*            work,
+                                                                  int               lwork,
+                                                                  int*              devIpiv,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  double*           A[],
+                                                                  const int*        lda,
+                                                                  double*           work,
+                                                                  int               lwork,
+                                                                  int*              devIpiv,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  hipFloatComplex*  A[],
+                                                                  const int*        lda,
+                                                                  hipFloatComplex*  work,
+                                                                  int               lwork,
+                                                                  int*              devIpiv,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfVbatchedFortran(hipsolverHandle_t handle,
+                                                                  const int*        m,
+                                                                  const int*        n,
+                                                                  hipDoubleComplex* A[],
+                                                                  const int*        lda,
+                                                                  hipDoubleComplex* work,
+                                                                  int               lwork,
+                                                                  int*              devIpiv,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
 // getrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrs_bufferSizeFortran(hipsolverHandle_t    handle,
                                                                      hipsolverOperation_t trans,
@@ -1054,6 +1345,1117 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsFortran(hipsolverHandle_t    h
                                                           int                  lwork,
                                                           int*                 devInfo);
 
+// gtsv
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsv_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    float*            dl,
+                                                                    float*            d,
+                                                                    float*            du,
+                                                                    float*            B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsv_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    double*           dl,
+                                                                    double*           d,
+                                                                    double*           du,
+                                                                    double*           B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsv_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    hipFloatComplex*  dl,
+                                                                    hipFloatComplex*  d,
+                                                                    hipFloatComplex*  du,
+                                                                    hipFloatComplex*  B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsv_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    hipDoubleComplex* dl,
+                                                                    hipDoubleComplex* d,
+                                                                    hipDoubleComplex* du,
+                                                                    hipDoubleComplex* B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvFortran(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         float*            dl,
+                                                         float*            d,
+                                                         float*            du,
+                                                         float*            B,
+                                                         int               ldb,
+                                                         float*            work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvFortran(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         double*           dl,
+                                                         double*           d,
+                                                         double*           du,
+                                                         double*           B,
+                                                         int               ldb,
+                                                         double*           work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvFortran(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         hipFloatComplex*  dl,
+                                                         hipFloatComplex*  d,
+                                                         hipFloatComplex*  du,
+                                                         hipFloatComplex*  B,
+                                                         int               ldb,
+                                                         hipFloatComplex*  work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvFortran(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         hipDoubleComplex* dl,
+                                                         hipDoubleComplex* d,
+                                                         hipDoubleComplex* du,
+                                                         hipDoubleComplex* B,
+                                                         int               ldb,
+                                                         hipDoubleComplex* work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+// gtsv_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgtsvStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            dl,
+                                                   float*            d,
+                                                   float*            du,
+                                                   int               strideD,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgtsvStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           dl,
+                                                   double*           d,
+                                                   double*           du,
+                                                   int               strideD,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgtsvStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipFloatComplex*  dl,
+                                                   hipFloatComplex*  d,
+                                                   hipFloatComplex*  du,
+                                                   int               strideD,
+                                                   hipFloatComplex*  B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgtsvStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* dl,
+                                                   hipDoubleComplex* d,
+                                                   hipDoubleComplex* du,
+                                                   int               strideD,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       float*            dl,
+                                                                       float*            d,
+                                                                       float*            du,
+                                                                       int               strideD,
+                                                                       float*            B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       float*            work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       double*           dl,
+                                                                       double*           d,
+                                                                       double*           du,
+                                                                       int               strideD,
+                                                                       double*           B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       double*           work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       hipFloatComplex*  dl,
+                                                                       hipFloatComplex*  d,
+                                                                       hipFloatComplex*  du,
+                                                                       int               strideD,
+                                                                       hipFloatComplex*  B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       hipFloatComplex*  work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvStridedBatchedFortran(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       hipDoubleComplex* dl,
+                                                                       hipDoubleComplex* d,
+                                                                       hipDoubleComplex* du,
+                                                                       int               strideD,
+                                                                       hipDoubleComplex* B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       hipDoubleComplex* work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+// gtsv_nopivot
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvNopivot_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           float*            dl,
+                                                                           float*            d,
+                                                                           float*            du,
+                                                                           float*            B,
+                                                                           int               ldb,
+                                                                           int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvNopivot_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           double*           dl,
+                                                                           double*           d,
+                                                                           double*           du,
+                                                                           double*           B,
+                                                                           int               ldb,
+                                                                           int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvNopivot_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           hipFloatComplex*  dl,
+                                                                           hipFloatComplex*  d,
+                                                                           hipFloatComplex*  du,
+                                                                           hipFloatComplex*  B,
+                                                                           int               ldb,
+                                                                           int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvNopivot_bufferSizeFortran(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           hipDoubleComplex* dl,
+                                                                           hipDoubleComplex* d,
+                                                                           hipDoubleComplex* du,
+                                                                           hipDoubleComplex* B,
+                                                                           int               ldb,
+                                                                           int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvNopivotFortran(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                float*            dl,
+                                                                float*            d,
+                                                                float*            du,
+                                                                float*            B,
+                                                                int               ldb,
+                                                                float*            work,
+                                                                int               lwork,
+                                                                int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvNopivotFortran(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           dl,
+                                                                double*           d,
+                                                                double*           du,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           work,
+                                                                int               lwork,
+                                                                int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvNopivotFortran(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipFloatComplex*  dl,
+                                                                hipFloatComplex*  d,
+                                                                hipFloatComplex*  du,
+                                                                hipFloatComplex*  B,
+                                                                int               ldb,
+                                                                hipFloatComplex*  work,
+                                                                int               lwork,
+                                                                int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvNopivotFortran(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* dl,
+                                                                hipDoubleComplex* d,
+                                                                hipDoubleComplex* du,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* work,
+                                                                int               lwork,
+                                                                int*              devInfo);
+
+// gtsv_nopivot_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgtsvNopivotStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          float*            dl,
+                                                          float*            d,
+                                                          float*            du,
+                                                          int               strideD,
+                                                          float*            B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgtsvNopivotStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          double*           dl,
+                                                          double*           d,
+                                                          double*           du,
+                                                          int               strideD,
+                                                          double*           B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgtsvNopivotStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipFloatComplex*  dl,
+                                                          hipFloatComplex*  d,
+                                                          hipFloatComplex*  du,
+                                                          int               strideD,
+                                                          hipFloatComplex*  B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgtsvNopivotStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipDoubleComplex* dl,
+                                                          hipDoubleComplex* d,
+                                                          hipDoubleComplex* du,
+                                                          int               strideD,
+                                                          hipDoubleComplex* B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgtsvNopivotStridedBatchedFortran(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               float*            dl,
+                                               float*            d,
+                                               float*            du,
+                                               int               strideD,
+                                               float*            B,
+                                               int               ldb,
+                                               int               strideB,
+                                               float*            work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgtsvNopivotStridedBatchedFortran(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               double*           dl,
+                                               double*           d,
+                                               double*           du,
+                                               int               strideD,
+                                               double*           B,
+                                               int               ldb,
+                                               int               strideB,
+                                               double*           work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgtsvNopivotStridedBatchedFortran(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipFloatComplex*  dl,
+                                               hipFloatComplex*  d,
+                                               hipFloatComplex*  du,
+                                               int               strideD,
+                                               hipFloatComplex*  B,
+                                               int               ldb,
+                                               int               strideB,
+                                               hipFloatComplex*  work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgtsvNopivotStridedBatchedFortran(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipDoubleComplex* dl,
+                                               hipDoubleComplex* d,
+                                               hipDoubleComplex* du,
+                                               int               strideD,
+                                               hipDoubleComplex* B,
+                                               int               ldb,
+                                               int               strideB,
+                                               hipDoubleComplex* work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count);
+
+// pbtrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrf_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     float*              AB,
+                                                                     int                 ldab,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrf_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     double*             AB,
+                                                                     int                 ldab,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrf_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     hipFloatComplex*    AB,
+                                                                     int                 ldab,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrf_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     hipDoubleComplex*   AB,
+                                                                     int                 ldab,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          float*              AB,
+                                                          int                 ldab,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          double*             AB,
+                                                          int                 ldab,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          hipFloatComplex*    AB,
+                                                          int                 ldab,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          hipDoubleComplex*   AB,
+                                                          int                 ldab,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+// pbtrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpbtrfStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    float*              AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpbtrfStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    double*             AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpbtrfStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    hipFloatComplex*    AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrfStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    hipDoubleComplex*   AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrfStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        float*              AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        float*              work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrfStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        double*             AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        double*             work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrfStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        hipFloatComplex*    AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        hipFloatComplex*    work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrfStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        hipDoubleComplex*   AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        hipDoubleComplex*   work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+// pbtrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     int                 nrhs,
+                                                                     float*              AB,
+                                                                     int                 ldab,
+                                                                     float*              B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     int                 nrhs,
+                                                                     double*             AB,
+                                                                     int                 ldab,
+                                                                     double*             B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     int                 nrhs,
+                                                                     hipFloatComplex*    AB,
+                                                                     int                 ldab,
+                                                                     hipFloatComplex*    B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 kd,
+                                                                     int                 nrhs,
+                                                                     hipDoubleComplex*   AB,
+                                                                     int                 ldab,
+                                                                     hipDoubleComplex*   B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          int                 nrhs,
+                                                          float*              AB,
+                                                          int                 ldab,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          int                 nrhs,
+                                                          double*             AB,
+                                                          int                 ldab,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          int                 nrhs,
+                                                          hipFloatComplex*    AB,
+                                                          int                 ldab,
+                                                          hipFloatComplex*    B,
+                                                          int                 ldb,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 kd,
+                                                          int                 nrhs,
+                                                          hipDoubleComplex*   AB,
+                                                          int                 ldab,
+                                                          hipDoubleComplex*   B,
+                                                          int                 ldb,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+// pbtrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpbtrsStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    int                 nrhs,
+                                                    float*              AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int                 strideB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpbtrsStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    int                 nrhs,
+                                                    double*             AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int                 strideB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpbtrsStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    int                 nrhs,
+                                                    hipFloatComplex*    AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    hipFloatComplex*    B,
+                                                    int                 ldb,
+                                                    int                 strideB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrsStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 kd,
+                                                    int                 nrhs,
+                                                    hipDoubleComplex*   AB,
+                                                    int                 ldab,
+                                                    int                 strideAB,
+                                                    hipDoubleComplex*   B,
+                                                    int                 ldb,
+                                                    int                 strideB,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrsStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        int                 nrhs,
+                                                                        float*              AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        float*              B,
+                                                                        int                 ldb,
+                                                                        int strideB,
+                                                                        float*              work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrsStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        int                 nrhs,
+                                                                        double*             AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        double*             B,
+                                                                        int                 ldb,
+                                                                        int strideB,
+                                                                        double*             work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrsStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        int                 nrhs,
+                                                                        hipFloatComplex*    AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        hipFloatComplex*    B,
+                                                                        int                 ldb,
+                                                                        int strideB,
+                                                                        hipFloatComplex*    work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrsStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                        hipsolverFillMode_t uplo,
+                                                                        int                 n,
+                                                                        int                 kd,
+                                                                        int                 nrhs,
+                                                                        hipDoubleComplex*   AB,
+                                                                        int                 ldab,
+                                                                        int strideAB,
+                                                                        hipDoubleComplex*   B,
+                                                                        int                 ldb,
+                                                                        int strideB,
+                                                                        hipDoubleComplex*   work,
+                                                                        int                 lwork,
+                                                                        int* devInfo,
+                                                                        int batch_count);
+
+// posv
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposv_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    float*              A,
+                                                                    int                 lda,
+                                                                    float*              B,
+                                                                    int                 ldb,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposv_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    double*             A,
+                                                                    int                 lda,
+                                                                    double*             B,
+                                                                    int                 ldb,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposv_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    hipFloatComplex*    A,
+                                                                    int                 lda,
+                                                                    hipFloatComplex*    B,
+                                                                    int                 ldb,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposv_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    hipDoubleComplex*   A,
+                                                                    int                 lda,
+                                                                    hipDoubleComplex*   B,
+                                                                    int                 ldb,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvFortran(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         float*              A,
+                                                         int                 lda,
+                                                         float*              B,
+                                                         int                 ldb,
+                                                         float*              work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvFortran(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         double*             A,
+                                                         int                 lda,
+                                                         double*             B,
+                                                         int                 ldb,
+                                                         double*             work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvFortran(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         hipFloatComplex*    A,
+                                                         int                 lda,
+                                                         hipFloatComplex*    B,
+                                                         int                 ldb,
+                                                         hipFloatComplex*    work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvFortran(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         hipDoubleComplex*   A,
+                                                         int                 lda,
+                                                         hipDoubleComplex*   B,
+                                                         int                 ldb,
+                                                         hipDoubleComplex*   work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+// posv_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSposvBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            float*              A[],
+                                            int                 lda,
+                                            float*              B[],
+                                            int                 ldb,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDposvBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            double*             A[],
+                                            int                 lda,
+                                            double*             B[],
+                                            int                 ldb,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCposvBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipFloatComplex*    A[],
+                                            int                 lda,
+                                            hipFloatComplex*    B[],
+                                            int                 ldb,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposvBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipDoubleComplex*   A[],
+                                            int                 lda,
+                                            hipDoubleComplex*   B[],
+                                            int                 ldb,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvBatchedFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                float*              A[],
+                                                                int                 lda,
+                                                                float*              B[],
+                                                                int                 ldb,
+                                                                float*              work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvBatchedFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                double*             A[],
+                                                                int                 lda,
+                                                                double*             B[],
+                                                                int                 ldb,
+                                                                double*             work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvBatchedFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipFloatComplex*    A[],
+                                                                int                 lda,
+                                                                hipFloatComplex*    B[],
+                                                                int                 ldb,
+                                                                hipFloatComplex*    work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvBatchedFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipDoubleComplex*   A[],
+                                                                int                 lda,
+                                                                hipDoubleComplex*   B[],
+                                                                int                 ldb,
+                                                                hipDoubleComplex*   work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+// posv_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSposvStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   int                 strideB,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDposvStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   int                 strideB,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCposvStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   int                 strideB,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposvStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   int                 strideB,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 nrhs,
+                                                                       float*              A,
+                                                                       int                 lda,
+                                                                       int                 strideA,
+                                                                       float*              B,
+                                                                       int                 ldb,
+                                                                       int                 strideB,
+                                                                       float*              work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 nrhs,
+                                                                       double*             A,
+                                                                       int                 lda,
+                                                                       int                 strideA,
+                                                                       double*             B,
+                                                                       int                 ldb,
+                                                                       int                 strideB,
+                                                                       double*             work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 nrhs,
+                                                                       hipFloatComplex*    A,
+                                                                       int                 lda,
+                                                                       int                 strideA,
+                                                                       hipFloatComplex*    B,
+                                                                       int                 ldb,
+                                                                       int                 strideB,
+                                                                       hipFloatComplex*    work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 nrhs,
+                                                                       hipDoubleComplex*   A,
+                                                                       int                 lda,
+                                                                       int                 strideA,
+                                                                       hipDoubleComplex*   B,
+                                                                       int                 ldb,
+                                                                       int                 strideB,
+                                                                       hipDoubleComplex*   work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
 // potrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSizeFortran(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1188,6 +2590,713 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatchedFortran(hipsolverHandle
                                                                  int*                devInfo,
                                                                  int                 batch_count);
 
+// potrf_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              float*              A[],
+                                              const int*          lda,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              double*             A[],
+                                              const int*          lda,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              hipFloatComplex*    A[],
+                                              const int*          lda,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              hipDoubleComplex*   A[],
+                                              const int*          lda,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  float*              A[],
+                                                                  const int*          lda,
+                                                                  float*              work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  double*             A[],
+                                                                  const int*          lda,
+                                                                  double*             work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  hipFloatComplex*    A[],
+                                                                  const int*          lda,
+                                                                  hipFloatComplex*    work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  hipDoubleComplex*   A[],
+                                                                  const int*          lda,
+                                                                  hipDoubleComplex*   work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+// potrf_update
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            float*              A,
+                                            int                 lda,
+                                            float*              V,
+                                            int                 ldv,
+                                            int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            double*             A,
+                                            int                 lda,
+                                            double*             V,
+                                            int                 ldv,
+                                            int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            hipFloatComplex*    A,
+                                            int                 lda,
+                                            hipFloatComplex*    V,
+                                            int                 ldv,
+                                            int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            hipDoubleComplex*   A,
+                                            int                 lda,
+                                            hipDoubleComplex*   V,
+                                            int                 ldv,
+                                            int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdateFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                float*              A,
+                                                                int                 lda,
+                                                                float*              V,
+                                                                int                 ldv,
+                                                                float*              work,
+                                                                int                 lwork,
+                                                                int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdateFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                double*             A,
+                                                                int                 lda,
+                                                                double*             V,
+                                                                int                 ldv,
+                                                                double*             work,
+                                                                int                 lwork,
+                                                                int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdateFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                hipFloatComplex*    A,
+                                                                int                 lda,
+                                                                hipFloatComplex*    V,
+                                                                int                 ldv,
+                                                                hipFloatComplex*    work,
+                                                                int                 lwork,
+                                                                int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfUpdateFortran(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                hipDoubleComplex*   A,
+                                                                int                 lda,
+                                                                hipDoubleComplex*   V,
+                                                                int                 ldv,
+                                                                hipDoubleComplex*   work,
+                                                                int                 lwork,
+                                                                int*                devInfo);
+
+// potrf_update_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   float*              A[],
+                                                   int                 lda,
+                                                   float*              V[],
+                                                   int                 ldv,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   double*             A[],
+                                                   int                 lda,
+                                                   double*             V[],
+                                                   int                 ldv,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipFloatComplex*    A[],
+                                                   int                 lda,
+                                                   hipFloatComplex*    V[],
+                                                   int                 ldv,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipDoubleComplex*   A[],
+                                                   int                 lda,
+                                                   hipDoubleComplex*   V[],
+                                                   int                 ldv,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdateBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 k,
+                                                                       float*              A[],
+                                                                       int                 lda,
+                                                                       float*              V[],
+                                                                       int                 ldv,
+                                                                       float*              work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdateBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 k,
+                                                                       double*             A[],
+                                                                       int                 lda,
+                                                                       double*             V[],
+                                                                       int                 ldv,
+                                                                       double*             work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdateBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 k,
+                                                                       hipFloatComplex*    A[],
+                                                                       int                 lda,
+                                                                       hipFloatComplex*    V[],
+                                                                       int                 ldv,
+                                                                       hipFloatComplex*    work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfUpdateBatchedFortran(hipsolverHandle_t   handle,
+                                                                       hipsolverFillMode_t uplo,
+                                                                       int                 n,
+                                                                       int                 k,
+                                                                       hipDoubleComplex*   A[],
+                                                                       int                 lda,
+                                                                       hipDoubleComplex*   V[],
+                                                                       int                 ldv,
+                                                                       hipDoubleComplex*   work,
+                                                                       int                 lwork,
+                                                                       int*                devInfo,
+                                                                       int batch_count);
+
+// potrf_update_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          float*              V,
+                                                          int                 ldv,
+                                                          int                 strideV,
+                                                          int*                lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          double*             V,
+                                                          int                 ldv,
+                                                          int                 strideV,
+                                                          int*                lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipFloatComplex*    A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          hipFloatComplex*    V,
+                                                          int                 ldv,
+                                                          int                 strideV,
+                                                          int*                lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipDoubleComplex*   A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          hipDoubleComplex*   V,
+                                                          int                 ldv,
+                                                          int                 strideV,
+                                                          int*                lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               float*              V,
+                                               int                 ldv,
+                                               int                 strideV,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               double*             V,
+                                               int                 ldv,
+                                               int                 strideV,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               hipFloatComplex*    A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipFloatComplex*    V,
+                                               int                 ldv,
+                                               int                 strideV,
+                                               hipFloatComplex*    work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               hipDoubleComplex*   A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipDoubleComplex*   V,
+                                               int                 ldv,
+                                               int                 strideV,
+                                               hipDoubleComplex*   work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count);
+
+// potrf_downdate
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfDowndate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              float*              A,
+                                              int                 lda,
+                                              float*              V,
+                                              int                 ldv,
+                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfDowndate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              double*             A,
+                                              int                 lda,
+                                              double*             V,
+                                              int                 ldv,
+                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfDowndate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              hipFloatComplex*    A,
+                                              int                 lda,
+                                              hipFloatComplex*    V,
+                                              int                 ldv,
+                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndate_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              hipDoubleComplex*   A,
+                                              int                 lda,
+                                              hipDoubleComplex*   V,
+                                              int                 ldv,
+                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfDowndateFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  float*              A,
+                                                                  int                 lda,
+                                                                  float*              V,
+                                                                  int                 ldv,
+                                                                  float*              work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfDowndateFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  double*             A,
+                                                                  int                 lda,
+                                                                  double*             V,
+                                                                  int                 ldv,
+                                                                  double*             work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfDowndateFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  hipFloatComplex*    A,
+                                                                  int                 lda,
+                                                                  hipFloatComplex*    V,
+                                                                  int                 ldv,
+                                                                  hipFloatComplex*    work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfDowndateFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  hipDoubleComplex*   A,
+                                                                  int                 lda,
+                                                                  hipDoubleComplex*   V,
+                                                                  int                 ldv,
+                                                                  hipDoubleComplex*   work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo);
+
+// potrf_downdate_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfDowndateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     float*              A[],
+                                                     int                 lda,
+                                                     float*              V[],
+                                                     int                 ldv,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfDowndateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     double*             A[],
+                                                     int                 lda,
+                                                     double*             V[],
+                                                     int                 ldv,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfDowndateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipFloatComplex*    A[],
+                                                     int                 lda,
+                                                     hipFloatComplex*    V[],
+                                                     int                 ldv,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndateBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipDoubleComplex*   A[],
+                                                     int                 lda,
+                                                     hipDoubleComplex*   V[],
+                                                     int                 ldv,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfDowndateBatchedFortran(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 k,
+                                                                         float*              A[],
+                                                                         int                 lda,
+                                                                         float*              V[],
+                                                                         int                 ldv,
+                                                                         float*              work,
+                                                                         int                 lwork,
+                                                                         int* devInfo,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfDowndateBatchedFortran(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 k,
+                                                                         double*             A[],
+                                                                         int                 lda,
+                                                                         double*             V[],
+                                                                         int                 ldv,
+                                                                         double*             work,
+                                                                         int                 lwork,
+                                                                         int* devInfo,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfDowndateBatchedFortran(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 k,
+                                                                         hipFloatComplex*    A[],
+                                                                         int                 lda,
+                                                                         hipFloatComplex*    V[],
+                                                                         int                 ldv,
+                                                                         hipFloatComplex*    work,
+                                                                         int                 lwork,
+                                                                         int* devInfo,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfDowndateBatchedFortran(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 k,
+                                                                         hipDoubleComplex*   A[],
+                                                                         int                 lda,
+                                                                         hipDoubleComplex*   V[],
+                                                                         int                 ldv,
+                                                                         hipDoubleComplex*   work,
+                                                                         int                 lwork,
+                                                                         int* devInfo,
+                                                                         int batch_count);
+
+// potrf_downdate_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfDowndateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            int                 strideA,
+                                                            float*              V,
+                                                            int                 ldv,
+                                                            int                 strideV,
+                                                            int*                lwork,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfDowndateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            int                 strideA,
+                                                            double*             V,
+                                                            int                 ldv,
+                                                            int                 strideV,
+                                                            int*                lwork,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfDowndateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            hipFloatComplex*    A,
+                                                            int                 lda,
+                                                            int                 strideA,
+                                                            hipFloatComplex*    V,
+                                                            int                 ldv,
+                                                            int                 strideV,
+                                                            int*                lwork,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndateStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            hipDoubleComplex*   A,
+                                                            int                 lda,
+                                                            int                 strideA,
+                                                            hipDoubleComplex*   V,
+                                                            int                 ldv,
+                                                            int                 strideV,
+                                                            int*                lwork,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfDowndateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 float*              V,
+                                                 int                 ldv,
+                                                 int                 strideV,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfDowndateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 double*             V,
+                                                 int                 ldv,
+                                                 int                 strideV,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfDowndateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 hipFloatComplex*    A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 hipFloatComplex*    V,
+                                                 int                 ldv,
+                                                 int                 strideV,
+                                                 hipFloatComplex*    work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndateStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 hipDoubleComplex*   A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 hipDoubleComplex*   V,
+                                                 int                 ldv,
+                                                 int                 strideV,
+                                                 hipDoubleComplex*   work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count);
+
 // potri
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotri_bufferSizeFortran(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1435,6 +3544,364 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsBatchedFortran(hipsolverHandle
                                                                  int*                devInfo,
                                                                  int                 batch_count);
 
+// potrs_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrsVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              const int*          nrhs,
+                                              float*              A[],
+                                              const int*          lda,
+                                              float*              B[],
+                                              const int*          ldb,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrsVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              const int*          nrhs,
+                                              double*             A[],
+                                              const int*          lda,
+                                              double*             B[],
+                                              const int*          ldb,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrsVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              const int*          nrhs,
+                                              hipFloatComplex*    A[],
+                                              const int*          lda,
+                                              hipFloatComplex*    B[],
+                                              const int*          ldb,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrsVbatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              const int*          n,
+                                              const int*          nrhs,
+                                              hipDoubleComplex*   A[],
+                                              const int*          lda,
+                                              hipDoubleComplex*   B[],
+                                              const int*          ldb,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  const int*          nrhs,
+                                                                  float*              A[],
+                                                                  const int*          lda,
+                                                                  float*              B[],
+                                                                  const int*          ldb,
+                                                                  float*              work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  const int*          nrhs,
+                                                                  double*             A[],
+                                                                  const int*          lda,
+                                                                  double*             B[],
+                                                                  const int*          ldb,
+                                                                  double*             work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  const int*          nrhs,
+                                                                  hipFloatComplex*    A[],
+                                                                  const int*          lda,
+                                                                  hipFloatComplex*    B[],
+                                                                  const int*          ldb,
+                                                                  hipFloatComplex*    work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsVbatchedFortran(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  const int*          n,
+                                                                  const int*          nrhs,
+                                                                  hipDoubleComplex*   A[],
+                                                                  const int*          lda,
+                                                                  hipDoubleComplex*   B[],
+                                                                  const int*          ldb,
+                                                                  hipDoubleComplex*   work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+// pptrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrf_bufferSizeFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrf_bufferSizeFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrf_bufferSizeFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipFloatComplex* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrf_bufferSizeFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipDoubleComplex* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              AP,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             AP,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipFloatComplex*    AP,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrfFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipDoubleComplex*   AP,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+// pptrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     float*              AP,
+                                                                     float*              B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     double*             AP,
+                                                                     double*             B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     hipFloatComplex*    AP,
+                                                                     hipFloatComplex*    B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrs_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     int                 nrhs,
+                                                                     hipDoubleComplex*   AP,
+                                                                     hipDoubleComplex*   B,
+                                                                     int                 ldb,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          float*              AP,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          double*             AP,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipFloatComplex*    AP,
+                                                          hipFloatComplex*    B,
+                                                          int                 ldb,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrsFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipDoubleComplex*   AP,
+                                                          hipDoubleComplex*   B,
+                                                          int                 ldb,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+// spevd/hpevd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSspevd_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverEigMode_t  jobz,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     float*              AP,
+                                                                     float*              D,
+                                                                     float*              Z,
+                                                                     int                 ldz,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDspevd_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverEigMode_t  jobz,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     double*             AP,
+                                                                     double*             D,
+                                                                     double*             Z,
+                                                                     int                 ldz,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChpevd_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverEigMode_t  jobz,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     hipFloatComplex*    AP,
+                                                                     float*              D,
+                                                                     hipFloatComplex*    Z,
+                                                                     int                 ldz,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhpevd_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                                     hipsolverEigMode_t  jobz,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     hipDoubleComplex*   AP,
+                                                                     double*             D,
+                                                                     hipDoubleComplex*   Z,
+                                                                     int                 ldz,
+                                                                     int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSspevdFortran(hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              AP,
+                                                          float*              D,
+                                                          float*              Z,
+                                                          int                 ldz,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDspevdFortran(hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             AP,
+                                                          double*             D,
+                                                          double*             Z,
+                                                          int                 ldz,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChpevdFortran(hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipFloatComplex*    AP,
+                                                          float*              D,
+                                                          hipFloatComplex*    Z,
+                                                          int                 ldz,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhpevdFortran(hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipDoubleComplex*   AP,
+                                                          double*             D,
+                                                          hipDoubleComplex*   Z,
+                                                          int                 ldz,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo);
+
+// trttp
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverStrttpFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, float* AP);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDtrttpFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, double* AP);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCtrttpFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipFloatComplex*    A,
+                                                          int                 lda,
+                                                          hipFloatComplex*    AP);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZtrttpFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipDoubleComplex*   A,
+                                                          int                 lda,
+                                                          hipDoubleComplex*   AP);
+
+// tpttr
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverStpttrFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, float* A, int lda);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDtpttrFortran(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, double* A, int lda);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCtpttrFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipFloatComplex*    AP,
+                                                          hipFloatComplex*    A,
+                                                          int                 lda);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZtpttrFortran(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipDoubleComplex*   AP,
+                                                          hipDoubleComplex*   A,
+                                                          int                 lda);
+
 // syevd/heevd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_bufferSizeFortran(hipsolverHandle_t   handle,
                                                                      hipsolverEigMode_t  jobz,
@@ -82,6 +82,15 @@
 #define hipsolverDgeqrfFortran hipsolverDgeqrf
 #define hipsolverCgeqrfFortran hipsolverCgeqrf
 #define hipsolverZgeqrfFortran hipsolverZgeqrf
+// geqrf_vbatched
+#define hipsolverSgeqrfVbatched_bufferSizeFortran hipsolverSgeqrfVbatched_bufferSize
+#define hipsolverDgeqrfVbatched_bufferSizeFortran hipsolverDgeqrfVbatched_bufferSize
+#define hipsolverCgeqrfVbatched_bufferSizeFortran hipsolverCgeqrfVbatched_bufferSize
+#define hipsolverZgeqrfVbatched_bufferSizeFortran hipsolverZgeqrfVbatched_bufferSize
+#define hipsolverSgeqrfVbatchedFortran hipsolverSgeqrfVbatched
+#define hipsolverDgeqrfVbatchedFortran hipsolverDgeqrfVbatched
+#define hipsolverCgeqrfVbatchedFortran hipsolverCgeqrfVbatched
+#define hipsolverZgeqrfVbatchedFortran hipsolverZgeqrfVbatched
 // gesv
 #define hipsolverSSgesv_bufferSizeFortran hipsolverSSgesv_bufferSize
 #define hipsolverDDgesv_bufferSizeFortran hipsolverDDgesv_bufferSize
@@ -100,6 +109,15 @@
 #define hipsolverDgesvdFortran hipsolverDgesvd
 #define hipsolverCgesvdFortran hipsolverCgesvd
 #define hipsolverZgesvdFortran hipsolverZgesvd
+// gesvd_strided_batched
+#define hipsolverSgesvdStridedBatched_bufferSizeFortran hipsolverSgesvdStridedBatched_bufferSize
+#define hipsolverDgesvdStridedBatched_bufferSizeFortran hipsolverDgesvdStridedBatched_bufferSize
+#define hipsolverCgesvdStridedBatched_bufferSizeFortran hipsolverCgesvdStridedBatched_bufferSize
+#define hipsolverZgesvdStridedBatched_bufferSizeFortran hipsolverZgesvdStridedBatched_bufferSize
+#define hipsolverSgesvdStridedBatchedFortran hipsolverSgesvdStridedBatched
+#define hipsolverDgesvdStridedBatchedFortran hipsolverDgesvdStridedBatched
+#define hipsolverCgesvdStridedBatchedFortran hipsolverCgesvdStridedBatched
+#define hipsolverZgesvdStridedBatchedFortran hipsolverZgesvdStridedBatched
 // getrf
 #define hipsolverSgetrf_bufferSizeFortran hipsolverSgetrf_bufferSize
 #define hipsolverDgetrf_bufferSizeFortran hipsolverDgetrf_bufferSize
@@ -109,6 +127,15 @@
 #define hipsolverDgetrfFortran hipsolverDgetrf
 #define hipsolverCgetrfFortran hipsolverCgetrf
 #define hipsolverZgetrfFortran hipsolverZgetrf
+// getrf_vbatched
+#define hipsolverSgetrfVbatched_bufferSizeFortran hipsolverSgetrfVbatched_bufferSize
+#define hipsolverDgetrfVbatched_bufferSizeFortran hipsolverDgetrfVbatched_bufferSize
+#define hipsolverCgetrfVbatched_bufferSizeFortran hipsolverCgetrfVbatched_bufferSize
+#define hipsolverZgetrfVbatched_bufferSizeFortran hipsolverZgetrfVbatched_bufferSize
+#define hipsolverSgetrfVbatchedFortran hipsolverSgetrfVbatched
+#define hipsolverDgetrfVbatchedFortran hipsolverDgetrfVbatched
+#define hipsolverCgetrfVbatchedFortran hipsolverCgetrfVbatched
+#define hipsolverZgetrfVbatchedFortran hipsolverZgetrfVbatched
 // getrs
 #define hipsolverSgetrs_bufferSizeFortran hipsolverSgetrs_bufferSize
 #define hipsolverDgetrs_bufferSizeFortran hipsolverDgetrs_bufferSize
@@ -118,6 +145,105 @@
 #define hipsolverDgetrsFortran hipsolverDgetrs
 #define hipsolverCgetrsFortran hipsolverCgetrs
 #define hipsolverZgetrsFortran hipsolverZgetrs
+// gtsv
+#define hipsolverSgtsv_bufferSizeFortran hipsolverSgtsv_bufferSize
+#define hipsolverDgtsv_bufferSizeFortran hipsolverDgtsv_bufferSize
+#define hipsolverCgtsv_bufferSizeFortran hipsolverCgtsv_bufferSize
+#define hipsolverZgtsv_bufferSizeFortran hipsolverZgtsv_bufferSize
+#define hipsolverSgtsvFortran hipsolverSgtsv
+#define hipsolverDgtsvFortran hipsolverDgtsv
+#define hipsolverCgtsvFortran hipsolverCgtsv
+#define hipsolverZgtsvFortran hipsolverZgtsv
+// gtsv_strided_batched
+#define hipsolverSgtsvStridedBatched_bufferSizeFortran hipsolverSgtsvStridedBatched_bufferSize
+#define hipsolverDgtsvStridedBatched_bufferSizeFortran hipsolverDgtsvStridedBatched_bufferSize
+#define hipsolverCgtsvStridedBatched_bufferSizeFortran hipsolverCgtsvStridedBatched_bufferSize
+#define hipsolverZgtsvStridedBatched_bufferSizeFortran hipsolverZgtsvStridedBatched_bufferSize
+#define hipsolverSgtsvStridedBatchedFortran hipsolverSgtsvStridedBatched
+#define hipsolverDgtsvStridedBatchedFortran hipsolverDgtsvStridedBatched
+#define hipsolverCgtsvStridedBatchedFortran hipsolverCgtsvStridedBatched
+#define hipsolverZgtsvStridedBatchedFortran hipsolverZgtsvStridedBatched
+// gtsv_nopivot
+#define hipsolverSgtsvNopivot_bufferSizeFortran hipsolverSgtsvNopivot_bufferSize
+#define hipsolverDgtsvNopivot_bufferSizeFortran hipsolverDgtsvNopivot_bufferSize
+#define hipsolverCgtsvNopivot_bufferSizeFortran hipsolverCgtsvNopivot_bufferSize
+#define hipsolverZgtsvNopivot_bufferSizeFortran hipsolverZgtsvNopivot_bufferSize
+#define hipsolverSgtsvNopivotFortran hipsolverSgtsvNopivot
+#define hipsolverDgtsvNopivotFortran hipsolverDgtsvNopivot
+#define hipsolverCgtsvNopivotFortran hipsolverCgtsvNopivot
+#define hipsolverZgtsvNopivotFortran hipsolverZgtsvNopivot
+// gtsv_nopivot_strided_batched
+#define hipsolverSgtsvNopivotStridedBatched_bufferSizeFortran hipsolverSgtsvNopivotStridedBatched_bufferSize
+#define hipsolverDgtsvNopivotStridedBatched_bufferSizeFortran hipsolverDgtsvNopivotStridedBatched_bufferSize
+#define hipsolverCgtsvNopivotStridedBatched_bufferSizeFortran hipsolverCgtsvNopivotStridedBatched_bufferSize
+#define hipsolverZgtsvNopivotStridedBatched_bufferSizeFortran hipsolverZgtsvNopivotStridedBatched_bufferSize
+#define hipsolverSgtsvNopivotStridedBatchedFortran hipsolverSgtsvNopivotStridedBatched
+#define hipsolverDgtsvNopivotStridedBatchedFortran hipsolverDgtsvNopivotStridedBatched
+#define hipsolverCgtsvNopivotStridedBatchedFortran hipsolverCgtsvNopivotStridedBatched
+#define hipsolverZgtsvNopivotStridedBatchedFortran hipsolverZgtsvNopivotStridedBatched
+// pbtrf
+#define hipsolverSpbtrf_bufferSizeFortran hipsolverSpbtrf_bufferSize
+#define hipsolverDpbtrf_bufferSizeFortran hipsolverDpbtrf_bufferSize
+#define hipsolverCpbtrf_bufferSizeFortran hipsolverCpbtrf_bufferSize
+#define hipsolverZpbtrf_bufferSizeFortran hipsolverZpbtrf_bufferSize
+#define hipsolverSpbtrfFortran hipsolverSpbtrf
+#define hipsolverDpbtrfFortran hipsolverDpbtrf
+#define hipsolverCpbtrfFortran hipsolverCpbtrf
+#define hipsolverZpbtrfFortran hipsolverZpbtrf
+// pbtrf_strided_batched
+#define hipsolverSpbtrfStridedBatched_bufferSizeFortran hipsolverSpbtrfStridedBatched_bufferSize
+#define hipsolverDpbtrfStridedBatched_bufferSizeFortran hipsolverDpbtrfStridedBatched_bufferSize
+#define hipsolverCpbtrfStridedBatched_bufferSizeFortran hipsolverCpbtrfStridedBatched_bufferSize
+#define hipsolverZpbtrfStridedBatched_bufferSizeFortran hipsolverZpbtrfStridedBatched_bufferSize
+#define hipsolverSpbtrfStridedBatchedFortran hipsolverSpbtrfStridedBatched
+#define hipsolverDpbtrfStridedBatchedFortran hipsolverDpbtrfStridedBatched
+#define hipsolverCpbtrfStridedBatchedFortran hipsolverCpbtrfStridedBatched
+#define hipsolverZpbtrfStridedBatchedFortran hipsolverZpbtrfStridedBatched
+// pbtrs
+#define hipsolverSpbtrs_bufferSizeFortran hipsolverSpbtrs_bufferSize
+#define hipsolverDpbtrs_bufferSizeFortran hipsolverDpbtrs_bufferSize
+#define hipsolverCpbtrs_bufferSizeFortran hipsolverCpbtrs_bufferSize
+#define hipsolverZpbtrs_bufferSizeFortran hipsolverZpbtrs_bufferSize
+#define hipsolverSpbtrsFortran hipsolverSpbtrs
+#define hipsolverDpbtrsFortran hipsolverDpbtrs
+#define hipsolverCpbtrsFortran hipsolverCpbtrs
+#define hipsolverZpbtrsFortran hipsolverZpbtrs
+// pbtrs_strided_batched
+#define hipsolverSpbtrsStridedBatched_bufferSizeFortran hipsolverSpbtrsStridedBatched_bufferSize
+#define hipsolverDpbtrsStridedBatched_bufferSizeFortran hipsolverDpbtrsStridedBatched_bufferSize
+#define hipsolverCpbtrsStridedBatched_bufferSizeFortran hipsolverCpbtrsStridedBatched_bufferSize
+#define hipsolverZpbtrsStridedBatched_bufferSizeFortran hipsolverZpbtrsStridedBatched_bufferSize
+#define hipsolverSpbtrsStridedBatchedFortran hipsolverSpbtrsStridedBatched
+#define hipsolverDpbtrsStridedBatchedFortran hipsolverDpbtrsStridedBatched
+#define hipsolverCpbtrsStridedBatchedFortran hipsolverCpbtrsStridedBatched
+#define hipsolverZpbtrsStridedBatchedFortran hipsolverZpbtrsStridedBatched
+// posv
+#define hipsolverSposv_bufferSizeFortran hipsolverSposv_bufferSize
+#define hipsolverDposv_bufferSizeFortran hipsolverDposv_bufferSize
+#define hipsolverCposv_bufferSizeFortran hipsolverCposv_bufferSize
+#define hipsolverZposv_bufferSizeFortran hipsolverZposv_bufferSize
+#define hipsolverSposvFortran hipsolverSposv
+#define hipsolverDposvFortran hipsolverDposv
+#define hipsolverCposvFortran hipsolverCposv
+#define hipsolverZposvFortran hipsolverZposv
+// posv_batched
+#define hipsolverSposvBatched_bufferSizeFortran hipsolverSposvBatched_bufferSize
+#define hipsolverDposvBatched_bufferSizeFortran hipsolverDposvBatched_bufferSize
+#define hipsolverCposvBatched_bufferSizeFortran hipsolverCposvBatched_bufferSize
+#define hipsolverZposvBatched_bufferSizeFortran hipsolverZposvBatched_bufferSize
+#define hipsolverSposvBatchedFortran hipsolverSposvBatched
+#define hipsolverDposvBatchedFortran hipsolverDposvBatched
+#define hipsolverCposvBatchedFortran hipsolverCposvBatched
+#define hipsolverZposvBatchedFortran hipsolverZposvBatched
+// posv_strided_batched
+#define hipsolverSposvStridedBatched_bufferSizeFortran hipsolverSposvStridedBatched_bufferSize
+#define hipsolverDposvStridedBatched_bufferSizeFortran hipsolverDposvStridedBatched_bufferSize
+#define hipsolverCposvStridedBatched_bufferSizeFortran hipsolverCposvStridedBatched_bufferSize
+#define hipsolverZposvStridedBatched_bufferSizeFortran hipsolverZposvStridedBatched_bufferSize
+#define hipsolverSposvStridedBatchedFortran hipsolverSposvStridedBatched
+#define hipsolverDposvStridedBatchedFortran hipsolverDposvStridedBatched
+#define hipsolverCposvStridedBatchedFortran hipsolverCposvStridedBatched
+#define hipsolverZposvStridedBatchedFortran hipsolverZposvStridedBatched
 // potrf
 #define hipsolverSpotrf_bufferSizeFortran hipsolverSpotrf_bufferSize
 #define hipsolverDpotrf_bufferSizeFortran hipsolverDpotrf_bufferSize
@@ -136,6 +262,69 @@
 #define hipsolverDpotrfBatchedFortran hipsolverDpotrfBatched
 #define hipsolverCpotrfBatchedFortran hipsolverCpotrfBatched
 #define hipsolverZpotrfBatchedFortran hipsolverZpotrfBatched
+// potrf_vbatched
+#define hipsolverSpotrfVbatched_bufferSizeFortran hipsolverSpotrfVbatched_bufferSize
+#define hipsolverDpotrfVbatched_bufferSizeFortran hipsolverDpotrfVbatched_bufferSize
+#define hipsolverCpotrfVbatched_bufferSizeFortran hipsolverCpotrfVbatched_bufferSize
+#define hipsolverZpotrfVbatched_bufferSizeFortran hipsolverZpotrfVbatched_bufferSize
+#define hipsolverSpotrfVbatchedFortran hipsolverSpotrfVbatched
+#define hipsolverDpotrfVbatchedFortran hipsolverDpotrfVbatched
+#define hipsolverCpotrfVbatchedFortran hipsolverCpotrfVbatched
+#define hipsolverZpotrfVbatchedFortran hipsolverZpotrfVbatched
+// potrf_update
+#define hipsolverSpotrfUpdate_bufferSizeFortran hipsolverSpotrfUpdate_bufferSize
+#define hipsolverDpotrfUpdate_bufferSizeFortran hipsolverDpotrfUpdate_bufferSize
+#define hipsolverCpotrfUpdate_bufferSizeFortran hipsolverCpotrfUpdate_bufferSize
+#define hipsolverZpotrfUpdate_bufferSizeFortran hipsolverZpotrfUpdate_bufferSize
+#define hipsolverSpotrfUpdateFortran hipsolverSpotrfUpdate
+#define hipsolverDpotrfUpdateFortran hipsolverDpotrfUpdate
+#define hipsolverCpotrfUpdateFortran hipsolverCpotrfUpdate
+#define hipsolverZpotrfUpdateFortran hipsolverZpotrfUpdate
+// potrf_update_batched
+#define hipsolverSpotrfUpdateBatched_bufferSizeFortran hipsolverSpotrfUpdateBatched_bufferSize
+#define hipsolverDpotrfUpdateBatched_bufferSizeFortran hipsolverDpotrfUpdateBatched_bufferSize
+#define hipsolverCpotrfUpdateBatched_bufferSizeFortran hipsolverCpotrfUpdateBatched_bufferSize
+#define hipsolverZpotrfUpdateBatched_bufferSizeFortran hipsolverZpotrfUpdateBatched_bufferSize
+#define hipsolverSpotrfUpdateBatchedFortran hipsolverSpotrfUpdateBatched
+#define hipsolverDpotrfUpdateBatchedFortran hipsolverDpotrfUpdateBatched
+#define hipsolverCpotrfUpdateBatchedFortran hipsolverCpotrfUpdateBatched
+#define hipsolverZpotrfUpdateBatchedFortran hipsolverZpotrfUpdateBatched
+// potrf_update_strided_batched
+#define hipsolverSpotrfUpdateStridedBatched_bufferSizeFortran hipsolverSpotrfUpdateStridedBatched_bufferSize
+#define hipsolverDpotrfUpdateStridedBatched_bufferSizeFortran hipsolverDpotrfUpdateStridedBatched_bufferSize
+#define hipsolverCpotrfUpdateStridedBatched_bufferSizeFortran hipsolverCpotrfUpdateStridedBatched_bufferSize
+#define hipsolverZpotrfUpdateStridedBatched_bufferSizeFortran hipsolverZpotrfUpdateStridedBatched_bufferSize
+#define hipsolverSpotrfUpdateStridedBatchedFortran hipsolverSpotrfUpdateStridedBatched
+#define hipsolverDpotrfUpdateStridedBatchedFortran hipsolverDpotrfUpdateStridedBatched
+#define hipsolverCpotrfUpdateStridedBatchedFortran hipsolverCpotrfUpdateStridedBatched
+#define hipsolverZpotrfUpdateStridedBatchedFortran hipsolverZpotrfUpdateStridedBatched
+// potrf_downdate
+#define hipsolverSpotrfDowndate_bufferSizeFortran hipsolverSpotrfDowndate_bufferSize
+#define hipsolverDpotrfDowndate_bufferSizeFortran hipsolverDpotrfDowndate_bufferSize
+#define hipsolverCpotrfDowndate_bufferSizeFortran hipsolverCpotrfDowndate_bufferSize
+#define hipsolverZpotrfDowndate_bufferSizeFortran hipsolverZpotrfDowndate_bufferSize
+#define hipsolverSpotrfDowndateFortran hipsolverSpotrfDowndate
+#define hipsolverDpotrfDowndateFortran hipsolverDpotrfDowndate
+#define hipsolverCpotrfDowndateFortran hipsolverCpotrfDowndate
+#define hipsolverZpotrfDowndateFortran hipsolverZpotrfDowndate
+// potrf_downdate_batched
+#define hipsolverSpotrfDowndateBatched_bufferSizeFortran hipsolverSpotrfDowndateBatched_bufferSize
+#define hipsolverDpotrfDowndateBatched_bufferSizeFortran hipsolverDpotrfDowndateBatched_bufferSize
+#define hipsolverCpotrfDowndateBatched_bufferSizeFortran hipsolverCpotrfDowndateBatched_bufferSize
+#define hipsolverZpotrfDowndateBatched_bufferSizeFortran hipsolverZpotrfDowndateBatched_bufferSize
+#define hipsolverSpotrfDowndateBatchedFortran hipsolverSpotrfDowndateBatched
+#define hipsolverDpotrfDowndateBatchedFortran hipsolverDpotrfDowndateBatched
+#define hipsolverCpotrfDowndateBatchedFortran hipsolverCpotrfDowndateBatched
+#define hipsolverZpotrfDowndateBatchedFortran hipsolverZpotrfDowndateBatched
+// potrf_downdate_strided_batched
+#define hipsolverSpotrfDowndateStridedBatched_bufferSizeFortran hipsolverSpotrfDowndateStridedBatched_bufferSize
+#define hipsolverDpotrfDowndateStridedBatched_bufferSizeFortran hipsolverDpotrfDowndateStridedBatched_bufferSize
+#define hipsolverCpotrfDowndateStridedBatched_bufferSizeFortran hipsolverCpotrfDowndateStridedBatched_bufferSize
+#define hipsolverZpotrfDowndateStridedBatched_bufferSizeFortran hipsolverZpotrfDowndateStridedBatched_bufferSize
+#define hipsolverSpotrfDowndateStridedBatchedFortran hipsolverSpotrfDowndateStridedBatched
+#define hipsolverDpotrfDowndateStridedBatchedFortran hipsolverDpotrfDowndateStridedBatched
+#define hipsolverCpotrfDowndateStridedBatchedFortran hipsolverCpotrfDowndateStridedBatched
+#define hipsolverZpotrfDowndateStridedBatchedFortran hipsolverZpotrfDowndateStridedBatched
 // potri
 #define hipsolverSpotri_bufferSizeFortran hipsolverSpotri_bufferSize
 #define hipsolverDpotri_bufferSizeFortran hipsolverDpotri_bufferSize
@@ -163,6 +352,52 @@
 #define hipsolverDpotrsBatchedFortran hipsolverDpotrsBatched
 #define hipsolverCpotrsBatchedFortran hipsolverCpotrsBatched
 #define hipsolverZpotrsBatchedFortran hipsolverZpotrsBatched
+// potrs_vbatched
+#define hipsolverSpotrsVbatched_bufferSizeFortran hipsolverSpotrsVbatched_bufferSize
+#define hipsolverDpotrsVbatched_bufferSizeFortran hipsolverDpotrsVbatched_bufferSize
+#define hipsolverCpotrsVbatched_bufferSizeFortran hipsolverCpotrsVbatched_bufferSize
+#define hipsolverZpotrsVbatched_bufferSizeFortran hipsolverZpotrsVbatched_bufferSize
+#define hipsolverSpotrsVbatchedFortran hipsolverSpotrsVbatched
+#define hipsolverDpotrsVbatchedFortran hipsolverDpotrsVbatched
+#define hipsolverCpotrsVbatchedFortran hipsolverCpotrsVbatched
+#define hipsolverZpotrsVbatchedFortran hipsolverZpotrsVbatched
+// pptrf
+#define hipsolverSpptrf_bufferSizeFortran hipsolverSpptrf_bufferSize
+#define hipsolverDpptrf_bufferSizeFortran hipsolverDpptrf_bufferSize
+#define hipsolverCpptrf_bufferSizeFortran hipsolverCpptrf_bufferSize
+#define hipsolverZpptrf_bufferSizeFortran hipsolverZpptrf_bufferSize
+#define hipsolverSpptrfFortran hipsolverSpptrf
+#define hipsolverDpptrfFortran hipsolverDpptrf
+#define hipsolverCpptrfFortran hipsolverCpptrf
+#define hipsolverZpptrfFortran hipsolverZpptrf
+// pptrs
+#define hipsolverSpptrs_bufferSizeFortran hipsolverSpptrs_bufferSize
+#define hipsolverDpptrs_bufferSizeFortran hipsolverDpptrs_bufferSize
+#define hipsolverCpptrs_bufferSizeFortran hipsolverCpptrs_bufferSize
+#define hipsolverZpptrs_bufferSizeFortran hipsolverZpptrs_bufferSize
+#define hipsolverSpptrsFortran hipsolverSpptrs
+#define hipsolverDpptrsFortran hipsolverDpptrs
+#define hipsolverCpptrsFortran hipsolverCpptrs
+#define hipsolverZpptrsFortran hipsolverZpptrs
+// spevd/hpevd
+#define hipsolverSspevd_bufferSizeFortran hipsolverSspevd_bufferSize
+#define hipsolverDspevd_bufferSizeFortran hipsolverDspevd_bufferSize
+#define hipsolverChpevd_bufferSizeFortran hipsolverChpevd_bufferSize
+#define hipsolverZhpevd_bufferSizeFortran hipsolverZhpevd_bufferSize
+#define hipsolverSspevdFortran hipsolverSspevd
+#define hipsolverDspevdFortran hipsolverDspevd
+#define hipsolverChpevdFortran hipsolverChpevd
+#define hipsolverZhpevdFortran hipsolverZhpevd
+// trttp
+#define hipsolverStrttpFortran hipsolverStrttp
+#define hipsolverDtrttpFortran hipsolverDtrttp
+#define hipsolverCtrttpFortran hipsolverCtrttp
+#define hipsolverZtrttpFortran hipsolverZtrttp
+// tpttr
+#define hipsolverStpttrFortran hipsolverStpttr
+#define hipsolverDtpttrFortran hipsolverDtpttr
+#define hipsolverCtpttrFortran hipsolverCtpttr
+#define hipsolverZtpttrFortran hipsolverZtpttr
 // syevd/heevd
 #define hipsolverSsyevd_bufferSizeFortran hipsolverSsyevd_bufferSize
 #define hipsolverDsyevd_bufferSizeFortran hipsolverDsyevd_bufferSize
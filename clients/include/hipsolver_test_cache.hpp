@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*!\file
+ * \brief optional on-disk cache of the results of the reference LAPACK computations of the tests.
+ */
+
+/* ============================================================================================
+ */
+/*! \brief  Cache of the outputs of a reference computation. The cache is enabled by setting the
+ * environment variable HIPSOLVER_TEST_CACHE to a directory. Each entry is addressed by a hash of
+ * the routine, its arguments, the contents of its inputs and the hipSOLVER version, and it stores
+ * the outputs together with their hash, which is verified whenever the entry is loaded. */
+class hipsolver_test_cache
+{
+    struct buffer
+    {
+        void*  data;
+        size_t bytes;
+    };
+
+    std::string         m_routine;
+    uint64_t            m_key;
+    std::vector<buffer> m_outputs;
+
+    void hash(const void* data, size_t bytes);
+    void add_output(void* data, size_t bytes);
+    std::string path() const;
+
+public:
+    // Directory of the cache, or nullptr if the cache is disabled
+    static const char* directory();
+
+    static uint64_t hash(uint64_t seed, const void* data, size_t bytes);
+
+    explicit hipsolver_test_cache(const std::string& routine);
+
+    // Adds a scalar argument to the key of the entry
+    template <typename T, std::enable_if_t<std::is_arithmetic<T>{}, int> = 0>
+    hipsolver_test_cache& arg(T val)
+    {
+        hash(&val, sizeof(T));
+        return *this;
+    }
+
+    // Adds the contents of an input array (a host batch or strided batch vector) to the key of
+    // the entry
+    template <typename V>
+    hipsolver_test_cache& input(const V& v)
+    {
+        for(int b = 0; b < v.batch_count(); b++)
+            hash(v[b], sizeof(v[b][0]) * v.n() * std::abs(v.inc()));
+        return *this;
+    }
+
+    template <typename T>
+    hipsolver_test_cache& input(const std::vector<T>& v)
+    {
+        hash(v.data(), sizeof(T) * v.size());
+        return *this;
+    }
+
+    // Adds an array (a host batch or strided batch vector) written by the reference computation
+    template <typename V>
+    hipsolver_test_cache& output(V& v)
+    {
+        for(int b = 0; b < v.batch_count(); b++)
+            add_output(v[b], sizeof(v[b][0]) * v.n() * std::abs(v.inc()));
+        return *this;
+    }
+
+    // Restores the outputs from the cache. Returns false if the cache is disabled or has no valid
+    // entry, in which case the reference must be computed and then stored
+    bool load();
+
+    // Stores the outputs in the cache
+    void store();
+};
@@ -7,6 +7,15 @@
 #include "hipsolver.h"
 #include "hipsolver_datatype2string.hpp"
 
+#include <functional>
+
+// Batches
+
+// Runs func(b) for every problem b = 0, ..., bc - 1 of a batch, spreading the problems among the
+// host threads (see hipsolver_host_threads). The calls for different problems must not share any
+// output or workspace.
+void cblas_batched(int bc, const std::function<void(int)>& func);
+
 // BLAS
 
 template <typename T>
@@ -144,6 +153,15 @@ template <typename T>
 void cblas_getrs(
     hipsolverOperation_t trans, int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb);
 
+template <typename T>
+void cblas_gtsv(int n, int nrhs, T* dl, T* d, T* du, T* B, int ldb, int* info);
+
+template <typename T>
+void cblas_pbtrf(hipsolverFillMode_t uplo, int n, int kd, T* AB, int ldab, int* info);
+
+template <typename T>
+void cblas_pbtrs(hipsolverFillMode_t uplo, int n, int kd, int nrhs, T* AB, int ldab, T* B, int ldb);
+
 template <typename T>
 void cblas_potrf(hipsolverFillMode_t uplo, int n, T* A, int lda, int* info);
 
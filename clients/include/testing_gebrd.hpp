@@ -597,6 +597,7 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
                                        hTaup);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
             cblas_gebrd<T>(
@@ -626,7 +627,7 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
                                    hTaup);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         gebrd_initData<false, true, T>(handle,
                                        m,
@@ -673,9 +674,9 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         gebrd_initData<false, true, T>(handle,
                                        m,
@@ -698,7 +699,7 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
                                        hTauq,
                                        hTaup);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_gebrd(FORTRAN,
                         handle,
                         m,
@@ -718,9 +719,9 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
                         lwork,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
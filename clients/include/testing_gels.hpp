@@ -451,6 +451,7 @@ void gels_getPerfData(const hipsolverHandle_t handle,
             handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dInfo, bc, hA, hB, hX, hInfo);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
         {
@@ -473,7 +474,7 @@ void gels_getPerfData(const hipsolverHandle_t handle,
         handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dInfo, bc, hA, hB, hX, hInfo);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         gels_initData<false, true, T>(
             handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dInfo, bc, hA, hB, hX, hInfo);
@@ -503,14 +504,14 @@ void gels_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         gels_initData<false, true, T>(
             handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dInfo, bc, hA, hB, hX, hInfo);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_gels(API,
                        INPLACE,
                        handle,
@@ -531,9 +532,9 @@ void gels_getPerfData(const hipsolverHandle_t handle,
                        hNIters.data(),
                        dInfo.data(),
                        bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API,
@@ -255,6 +255,7 @@ void geqrf_getPerfData(const hipsolverHandle_t handle,
         geqrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
             cblas_geqrf<T>(m, n, hA[b], lda, hIpiv[b], hW.data(), n);
@@ -264,7 +265,7 @@ void geqrf_getPerfData(const hipsolverHandle_t handle,
     geqrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         geqrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
@@ -286,13 +287,13 @@ void geqrf_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         geqrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_geqrf(FORTRAN,
                         handle,
                         m,
@@ -306,9 +307,9 @@ void geqrf_getPerfData(const hipsolverHandle_t handle,
                         lwork,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
@@ -0,0 +1,535 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_getrf_vbatched.hpp"
+
+template <testAPI_t API, typename T, typename U, typename V>
+void geqrf_vbatched_checkBadArgs(const hipsolverHandle_t handle,
+                                 V                       dM,
+                                 V                       dN,
+                                 T                       dA,
+                                 V                       dLda,
+                                 U                       dTau,
+                                 U                       dWork,
+                                 const int               lwork,
+                                 V                       dInfo,
+                                 const int               bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_geqrf_vbatched(API, nullptr, dM, dN, dA, dLda, dTau, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // sizes
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_geqrf_vbatched(API, handle, dM, dN, dA, dLda, dTau, dWork, lwork, dInfo, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_geqrf_vbatched(
+            API, handle, (V) nullptr, dN, dA, dLda, dTau, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_geqrf_vbatched(
+            API, handle, dM, (V) nullptr, dA, dLda, dTau, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_geqrf_vbatched(
+            API, handle, dM, dN, (T) nullptr, dLda, dTau, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_geqrf_vbatched(
+            API, handle, dM, dN, dA, (V) nullptr, dTau, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_geqrf_vbatched(
+            API, handle, dM, dN, dA, dLda, (U) nullptr, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_geqrf_vbatched_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    bc = 1;
+
+    // memory allocations
+    host_strided_batch_vector<int>   hOne(1, 1, 1, 1);
+    device_strided_batch_vector<int> dM(1, 1, 1, 1);
+    device_strided_batch_vector<int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<int> dLda(1, 1, 1, 1);
+    device_batch_vector<T>           dA(1, 1, 1);
+    device_strided_batch_vector<T>   dTau(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dM.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    hOne[0][0] = 1;
+    CHECK_HIP_ERROR(dM.transfer_from(hOne));
+    CHECK_HIP_ERROR(dN.transfer_from(hOne));
+    CHECK_HIP_ERROR(dLda.transfer_from(hOne));
+
+    int size_W;
+    hipsolver_geqrf_vbatched_bufferSize(
+        API, handle, dM.data(), dN.data(), dA.data(), dLda.data(), &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    geqrf_vbatched_checkBadArgs<API>(handle,
+                                     dM.data(),
+                                     dN.data(),
+                                     dA.data(),
+                                     dLda.data(),
+                                     dTau.data(),
+                                     dWork.data(),
+                                     size_W,
+                                     dInfo.data(),
+                                     bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geqrf_vbatched_initData(const hipsolverHandle_t handle,
+                             const int               m,
+                             const int               n,
+                             Td&                     dA,
+                             const int               lda,
+                             const int               bc,
+                             Th&                     hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(int b = 0; b < bc; ++b)
+        {
+            for(int i = 0; i < vbatched_dim(m, b); i++)
+            {
+                for(int j = 0; j < vbatched_dim(n, b); j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
+void geqrf_vbatched_getError(const hipsolverHandle_t handle,
+                             const int               m,
+                             const int               n,
+                             Ud&                     dM,
+                             Ud&                     dN,
+                             Td&                     dA,
+                             const int               lda,
+                             Ud&                     dLda,
+                             Vd&                     dTau,
+                             Vd&                     dWork,
+                             const int               lwork,
+                             Ud&                     dInfo,
+                             const int               bc,
+                             Th&                     hA,
+                             Th&                     hARes,
+                             Vh&                     hTau,
+                             Vh&                     hTauRes,
+                             Uh&                     hInfoRes,
+                             double*                 max_err)
+{
+    std::vector<T> hW(n);
+
+    // input data initialization
+    geqrf_vbatched_initData<true, true, T>(handle, m, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_geqrf_vbatched(API,
+                                                 handle,
+                                                 dM.data(),
+                                                 dN.data(),
+                                                 dA.data(),
+                                                 dLda.data(),
+                                                 dTau.data(),
+                                                 dWork.data(),
+                                                 lwork,
+                                                 dInfo.data(),
+                                                 bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hTauRes.transfer_from(dTau));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // the Householder scalars of all the problems are stored one after the other
+    int offset = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        int mb = vbatched_dim(m, b);
+        int nb = vbatched_dim(n, b);
+        cblas_geqrf<T>(mb, nb, hA[b], lda, hTau[0] + offset, hW.data(), n);
+        offset += min(mb, nb);
+    }
+
+    // error is ||hA - hARes|| / ||hA|| (ideally ||QR - Qres Rres|| / ||QR||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('F', vbatched_dim(m, b), vbatched_dim(n, b), lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check the Householder scalars
+    if(offset)
+    {
+        err      = norm_error('F', offset, 1, offset, hTau[0], hTauRes[0]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // the factorization cannot fail, so info must be zero
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfoRes[b][0] != 0)
+            err++;
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Vh>
+void geqrf_vbatched_getPerfData(const hipsolverHandle_t handle,
+                                const int               m,
+                                const int               n,
+                                Ud&                     dM,
+                                Ud&                     dN,
+                                Td&                     dA,
+                                const int               lda,
+                                Ud&                     dLda,
+                                Vd&                     dTau,
+                                Vd&                     dWork,
+                                const int               lwork,
+                                Ud&                     dInfo,
+                                const int               bc,
+                                Th&                     hA,
+                                Vh&                     hTau,
+                                double*                 gpu_time_used,
+                                double*                 cpu_time_used,
+                                const int               hot_calls,
+                                const bool              perf)
+{
+    std::vector<T> hW(n);
+
+    if(!perf)
+    {
+        geqrf_vbatched_initData<true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        int offset     = 0;
+        for(int b = 0; b < bc; ++b)
+        {
+            int mb = vbatched_dim(m, b);
+            int nb = vbatched_dim(n, b);
+            cblas_geqrf<T>(mb, nb, hA[b], lda, hTau[0] + offset, hW.data(), n);
+            offset += min(mb, nb);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqrf_vbatched_initData<true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        geqrf_vbatched_initData<false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_geqrf_vbatched(API,
+                                                     handle,
+                                                     dM.data(),
+                                                     dN.data(),
+                                                     dA.data(),
+                                                     dLda.data(),
+                                                     dTau.data(),
+                                                     dWork.data(),
+                                                     lwork,
+                                                     dInfo.data(),
+                                                     bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        geqrf_vbatched_initData<false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        timer.start();
+        hipsolver_geqrf_vbatched(API,
+                                 handle,
+                                 dM.data(),
+                                 dN.data(),
+                                 dA.data(),
+                                 dLda.data(),
+                                 dTau.data(),
+                                 dWork.data(),
+                                 lwork,
+                                 dInfo.data(),
+                                 bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, typename T>
+void testing_geqrf_vbatched(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    m   = argus.get<int>("m");
+    int                    n   = argus.get<int>("n", m);
+    int                    lda = argus.get<int>("lda", m);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // m, n and lda are the largest dimensions of the batch
+    size_t size_A    = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || lda < 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(bc >= 0)
+        {
+            host_strided_batch_vector<int>   hM(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+            device_strided_batch_vector<int> dM(1, 1, 1, bc);
+            device_strided_batch_vector<int> dN(1, 1, 1, bc);
+            device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+            device_batch_vector<T>           dA(1, 1, bc);
+            vbatched_dims(m, bc, hM);
+            vbatched_dims(n, bc, hN);
+            vbatched_dims(lda, bc, hLda);
+            CHECK_HIP_ERROR(dM.transfer_from(hM));
+            CHECK_HIP_ERROR(dN.transfer_from(hN));
+            CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+            EXPECT_ROCBLAS_STATUS(hipsolver_geqrf_vbatched(API,
+                                                           handle,
+                                                           dM.data(),
+                                                           dN.data(),
+                                                           dA.data(),
+                                                           dLda.data(),
+                                                           (T*)nullptr,
+                                                           (T*)nullptr,
+                                                           0,
+                                                           (int*)nullptr,
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_geqrf_vbatched(API,
+                                                           handle,
+                                                           (int*)nullptr,
+                                                           (int*)nullptr,
+                                                           (T**)nullptr,
+                                                           (int*)nullptr,
+                                                           (T*)nullptr,
+                                                           (T*)nullptr,
+                                                           0,
+                                                           (int*)nullptr,
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // the Householder scalars of all the problems are stored one after the other
+    size_t size_P = 0;
+    for(int b = 0; b < bc; b++)
+        size_P += min(vbatched_dim(m, b), vbatched_dim(n, b));
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // memory allocations
+    host_strided_batch_vector<int>   hM(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+    host_batch_vector<T>             hA(size_A, 1, bc);
+    host_batch_vector<T>             hARes(size_ARes, 1, bc);
+    host_strided_batch_vector<T>     hTau(size_P, 1, size_P, 1);
+    host_strided_batch_vector<T>     hTauRes(size_PRes, 1, size_PRes, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<int> dM(1, 1, 1, bc);
+    device_strided_batch_vector<int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+    device_batch_vector<T>           dA(size_A, 1, bc);
+    device_strided_batch_vector<T>   dTau(size_P, 1, size_P, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(bc)
+    {
+        CHECK_HIP_ERROR(dM.memcheck());
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+    }
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dTau.memcheck());
+
+    // all the problems share lda, which is valid for the largest one
+    vbatched_dims(m, bc, hM);
+    vbatched_dims(n, bc, hN);
+    for(int b = 0; b < bc; b++)
+        hLda[b][0] = lda;
+    CHECK_HIP_ERROR(dM.transfer_from(hM));
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+    int size_W;
+    hipsolver_geqrf_vbatched_bufferSize(
+        API, handle, dM.data(), dN.data(), dA.data(), dLda.data(), &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        geqrf_vbatched_getError<API, T>(handle,
+                                        m,
+                                        n,
+                                        dM,
+                                        dN,
+                                        dA,
+                                        lda,
+                                        dLda,
+                                        dTau,
+                                        dWork,
+                                        size_W,
+                                        dInfo,
+                                        bc,
+                                        hA,
+                                        hARes,
+                                        hTau,
+                                        hTauRes,
+                                        hInfoRes,
+                                        &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        geqrf_vbatched_getPerfData<API, T>(handle,
+                                           m,
+                                           n,
+                                           dM,
+                                           dN,
+                                           dA,
+                                           lda,
+                                           dLda,
+                                           dTau,
+                                           dWork,
+                                           size_W,
+                                           dInfo,
+                                           bc,
+                                           hA,
+                                           hTau,
+                                           &gpu_time_used,
+                                           &cpu_time_used,
+                                           hot_calls,
+                                           argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("max_m", "max_n", "lda", "batch_c");
+            rocsolver_bench_output(m, n, lda, bc);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
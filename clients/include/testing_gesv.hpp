@@ -408,10 +408,9 @@ void gesv_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-    {
+    cblas_batched(bc, [&](int b) {
         cblas_gesv<T>(n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb, hInfo[b]);
-    }
+    });
 
     // error is ||hB - hBRes|| / ||hB||
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
@@ -477,11 +476,11 @@ void gesv_getPerfData(const hipsolverHandle_t handle,
             handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < bc; ++b)
-        {
+        cblas_batched(bc, [&](int b) {
             cblas_gesv<T>(n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb, hInfo[b]);
-        }
+        });
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
@@ -489,7 +488,7 @@ void gesv_getPerfData(const hipsolverHandle_t handle,
         handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         gesv_initData<false, true, T>(
             handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
@@ -520,14 +519,14 @@ void gesv_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         gesv_initData<false, true, T>(
             handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_gesv(API,
                        INPLACE,
                        handle,
@@ -549,9 +548,9 @@ void gesv_getPerfData(const hipsolverHandle_t handle,
                        hNiters.data(),
                        dInfo.data(),
                        bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, bool INPLACE, typename T>
@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename TT, typename W, typename U>
+template <testAPI_t API, bool STRIDED, typename T, typename TT, typename W, typename U>
 void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                         const char              left_svect,
                         const char              right_svect,
@@ -32,6 +32,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           nullptr,
                                           left_svect,
@@ -59,6 +60,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           '\0',
@@ -84,6 +86,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           left_svect,
@@ -109,6 +112,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           'O',
@@ -137,6 +141,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           left_svect,
@@ -162,6 +167,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           left_svect,
@@ -187,6 +193,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           left_svect,
@@ -212,6 +219,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           left_svect,
@@ -237,6 +245,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                          STRIDED,
                                           false,
                                           handle,
                                           left_svect,
@@ -302,15 +311,15 @@ void testing_gesvd_bad_arg()
         // CHECK_HIP_ERROR(dinfo.memcheck());
 
         // int size_W;
-        // hipsolver_gesvd_bufferSize(API, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W);
+        // hipsolver_gesvd_bufferSize(API, STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W, bc);
         // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         // if(size_W)
         //     CHECK_HIP_ERROR(dWork.memcheck());
 
         // // check bad arguments
-        // gesvd_checkBadArgs<API>(handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
-        //                         dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
-        //                         dWork.data(), size_W, dE.data(), stE, dinfo.data(), bc);
+        // gesvd_checkBadArgs<API, STRIDED>(handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
+        //                                  dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
+        //                                  dWork.data(), size_W, dE.data(), stE, dinfo.data(), bc);
     }
     else
     {
@@ -330,34 +339,34 @@ void testing_gesvd_bad_arg()
 
         int size_W;
         hipsolver_gesvd_bufferSize(
-            API, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W);
+            API, STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        gesvd_checkBadArgs<API>(handle,
-                                left_svect,
-                                right_svect,
-                                m,
-                                n,
-                                dA.data(),
-                                lda,
-                                stA,
-                                dS.data(),
-                                stS,
-                                dU.data(),
-                                ldu,
-                                stU,
-                                dV.data(),
-                                ldv,
-                                stV,
-                                dWork.data(),
-                                size_W,
-                                dE.data(),
-                                stE,
-                                dinfo.data(),
-                                bc);
+        gesvd_checkBadArgs<API, STRIDED>(handle,
+                                         left_svect,
+                                         right_svect,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dS.data(),
+                                         stS,
+                                         dU.data(),
+                                         ldu,
+                                         stU,
+                                         dV.data(),
+                                         ldv,
+                                         stV,
+                                         dWork.data(),
+                                         size_W,
+                                         dE.data(),
+                                         stE,
+                                         dinfo.data(),
+                                         bc);
     }
 }
 
@@ -412,6 +421,7 @@ void gesvd_initData(const hipsolverHandle_t handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           bool      NRWK,
           typename T,
           typename Wd,
@@ -481,6 +491,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
     // complementary execution to compute all singular vectors if needed (always in-place to ensure
     // we don't combine results computed by gemm_batched with results computed by gemm_strided_batched)
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
+                                        STRIDED,
                                         NRWK,
                                         handle,
                                         left_svectT,
@@ -513,25 +524,34 @@ void gesvd_getError(const hipsolverHandle_t handle,
     gesvd_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A);
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_gesvd<T>(left_svect,
-                       right_svect,
-                       m,
-                       n,
-                       hA[b],
-                       lda,
-                       hS[b],
-                       hU[b],
-                       ldu,
-                       hV[b],
-                       ldv,
-                       hWork.data(),
-                       size_W,
-                       hE[b],
-                       hinfo[b]);
+    hipsolver_test_cache cache("gesvd");
+    cache.arg(type2char<T>()).arg(left_svect).arg(right_svect);
+    cache.arg(m).arg(n).arg(lda).arg(ldu).arg(ldv).arg(bc);
+    cache.input(hA).output(hA).output(hS).output(hU).output(hV).output(hE).output(hinfo);
+    if(!cache.load())
+    {
+        for(int b = 0; b < bc; ++b)
+            cblas_gesvd<T>(left_svect,
+                           right_svect,
+                           m,
+                           n,
+                           hA[b],
+                           lda,
+                           hS[b],
+                           hU[b],
+                           ldu,
+                           hV[b],
+                           ldv,
+                           hWork.data(),
+                           size_W,
+                           hE[b],
+                           hinfo[b]);
+        cache.store();
+    }
 
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
+                                        STRIDED,
                                         NRWK,
                                         handle,
                                         left_svect,
@@ -632,6 +652,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           bool      NRWK,
           typename T,
           typename Wd,
@@ -685,6 +706,7 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
             handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
             cblas_gesvd<T>(left_svect,
@@ -708,12 +730,13 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
     gesvd_initData<true, false, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         gesvd_initData<false, true, T>(
             handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
         CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
+                                            STRIDED,
                                             NRWK,
                                             handle,
                                             left_svect,
@@ -742,15 +765,16 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         gesvd_initData<false, true, T>(
             handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_gesvd(API,
+                        STRIDED,
                         NRWK,
                         handle,
                         left_svect,
@@ -774,9 +798,9 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
                         stE,
                         dinfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, bool NRWK, typename T>
@@ -808,6 +832,7 @@ void testing_gesvd(Arguments& argus)
         if(BATCHED)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+            //                                       STRIDED,
             //                                       NRWK,
             //                                       handle,
             //                                       leftv,
@@ -836,6 +861,7 @@ void testing_gesvd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                                  STRIDED,
                                                   NRWK,
                                                   handle,
                                                   leftv,
@@ -975,6 +1001,7 @@ void testing_gesvd(Arguments& argus)
         if(BATCHED)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+            //                                       STRIDED,
             //                                       NRWK,
             //                                       handle,
             //                                       leftv,
@@ -1003,6 +1030,7 @@ void testing_gesvd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
+                                                  STRIDED,
                                                   NRWK,
                                                   handle,
                                                   leftv,
@@ -1078,8 +1106,8 @@ void testing_gesvd(Arguments& argus)
         //     CHECK_HIP_ERROR(dA.memcheck());
 
         // int w1, w2;
-        // hipsolver_gesvd_bufferSize(API, handle, leftv, rightv, m, n, dA.data(), lda, &w1);
-        // hipsolver_gesvd_bufferSize(API, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2);
+        // hipsolver_gesvd_bufferSize(API, STRIDED, handle, leftv, rightv, m, n, dA.data(), lda, &w1, bc);
+        // hipsolver_gesvd_bufferSize(API, STRIDED, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2, bc);
         // int size_W = max(w1, w2);
         // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         // if(size_W)
@@ -1088,90 +1116,90 @@ void testing_gesvd(Arguments& argus)
         // // check computations
         // if(argus.unit_check || argus.norm_check)
         // {
-        //     gesvd_getError<API, NRWK, T>(handle,
-        //                                  leftv,
-        //                                  rightv,
-        //                                  m,
-        //                                  n,
-        //                                  dA,
-        //                                  lda,
-        //                                  stA,
-        //                                  dS,
-        //                                  stS,
-        //                                  dU,
-        //                                  ldu,
-        //                                  stU,
-        //                                  dV,
-        //                                  ldv,
-        //                                  stV,
-        //                                  dWork,
-        //                                  size_W,
-        //                                  dE,
-        //                                  stE,
-        //                                  dinfo,
-        //                                  bc,
-        //                                  leftvT,
-        //                                  rightvT,
-        //                                  mT,
-        //                                  nT,
-        //                                  dUT,
-        //                                  lduT,
-        //                                  stUT,
-        //                                  dVT,
-        //                                  ldvT,
-        //                                  stVT,
-        //                                  hA,
-        //                                  hS,
-        //                                  hSres,
-        //                                  hU,
-        //                                  Ures,
-        //                                  ldures,
-        //                                  hV,
-        //                                  Vres,
-        //                                  ldvres,
-        //                                  hE,
-        //                                  hEres,
-        //                                  hinfo,
-        //                                  hinfoRes,
-        //                                  &max_error,
-        //                                  &max_errorv);
+        //     gesvd_getError<API, STRIDED, NRWK, T>(handle,
+        //                                           leftv,
+        //                                           rightv,
+        //                                           m,
+        //                                           n,
+        //                                           dA,
+        //                                           lda,
+        //                                           stA,
+        //                                           dS,
+        //                                           stS,
+        //                                           dU,
+        //                                           ldu,
+        //                                           stU,
+        //                                           dV,
+        //                                           ldv,
+        //                                           stV,
+        //                                           dWork,
+        //                                           size_W,
+        //                                           dE,
+        //                                           stE,
+        //                                           dinfo,
+        //                                           bc,
+        //                                           leftvT,
+        //                                           rightvT,
+        //                                           mT,
+        //                                           nT,
+        //                                           dUT,
+        //                                           lduT,
+        //                                           stUT,
+        //                                           dVT,
+        //                                           ldvT,
+        //                                           stVT,
+        //                                           hA,
+        //                                           hS,
+        //                                           hSres,
+        //                                           hU,
+        //                                           Ures,
+        //                                           ldures,
+        //                                           hV,
+        //                                           Vres,
+        //                                           ldvres,
+        //                                           hE,
+        //                                           hEres,
+        //                                           hinfo,
+        //                                           hinfoRes,
+        //                                           &max_error,
+        //                                           &max_errorv);
         // }
 
         // // collect performance data
         // if(argus.timing)
         // {
-        //     gesvd_getPerfData<API, NRWK, T>(handle,
-        //                                     leftv,
-        //                                     rightv,
-        //                                     m,
-        //                                     n,
-        //                                     dA,
-        //                                     lda,
-        //                                     stA,
-        //                                     dS,
-        //                                     stS,
-        //                                     dU,
-        //                                     ldu,
-        //                                     stU,
-        //                                     dV,
-        //                                     ldv,
-        //                                     stV,
-        //                                     dWork,
-        //                                     size_W,
-        //                                     dE,
-        //                                     stE,
-        //                                     dinfo,
-        //                                     bc,
-        //                                     hA,
-        //                                     hS,
-        //                                     hU,
-        //                                     hV,
-        //                                     hE,
-        //                                     hinfo,
-        //                                     &gpu_time_used,
-        //                                     &cpu_time_used,
-        //                                     hot_calls,
-        //                                     argus.perf);
+        //     gesvd_getPerfData<API, STRIDED, NRWK, T>(handle,
+        //                                              leftv,
+        //                                              rightv,
+        //                                              m,
+        //                                              n,
+        //                                              dA,
+        //                                              lda,
+        //                                              stA,
+        //                                              dS,
+        //                                              stS,
+        //                                              dU,
+        //                                              ldu,
+        //                                              stU,
+        //                                              dV,
+        //                                              ldv,
+        //                                              stV,
+        //                                              dWork,
+        //                                              size_W,
+        //                                              dE,
+        //                                              stE,
+        //                                              dinfo,
+        //                                              bc,
+        //                                              hA,
+        //                                              hS,
+        //                                              hU,
+        //                                              hV,
+        //                                              hE,
+        //                                              hinfo,
+        //                                              &gpu_time_used,
+        //                                              &cpu_time_used,
+        //                                              hot_calls,
+        //                                              argus.perf);
         // }
     }
 
@@ -1184,8 +1212,10 @@ void testing_gesvd(Arguments& argus)
             CHECK_HIP_ERROR(dA.memcheck());
 
         int w1, w2;
-        hipsolver_gesvd_bufferSize(API, handle, leftv, rightv, m, n, dA.data(), lda, &w1);
-        hipsolver_gesvd_bufferSize(API, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2);
+        hipsolver_gesvd_bufferSize(
+            API, STRIDED, handle, leftv, rightv, m, n, dA.data(), lda, &w1, bc);
+        hipsolver_gesvd_bufferSize(
+            API, STRIDED, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2, bc);
         int                            size_W = max(w1, w2);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
@@ -1194,90 +1224,90 @@ void testing_gesvd(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            gesvd_getError<API, NRWK, T>(handle,
-                                         leftv,
-                                         rightv,
-                                         m,
-                                         n,
-                                         dA,
-                                         lda,
-                                         stA,
-                                         dS,
-                                         stS,
-                                         dU,
-                                         ldu,
-                                         stU,
-                                         dV,
-                                         ldv,
-                                         stV,
-                                         dWork,
-                                         size_W,
-                                         dE,
-                                         stE,
-                                         dinfo,
-                                         bc,
-                                         leftvT,
-                                         rightvT,
-                                         mT,
-                                         nT,
-                                         dUT,
-                                         lduT,
-                                         stUT,
-                                         dVT,
-                                         ldvT,
-                                         stVT,
-                                         hA,
-                                         hS,
-                                         hSres,
-                                         hU,
-                                         Ures,
-                                         ldures,
-                                         hV,
-                                         Vres,
-                                         ldvres,
-                                         hE,
-                                         hEres,
-                                         hinfo,
-                                         hinfoRes,
-                                         &max_error,
-                                         &max_errorv);
+            gesvd_getError<API, STRIDED, NRWK, T>(handle,
+                                                  leftv,
+                                                  rightv,
+                                                  m,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dS,
+                                                  stS,
+                                                  dU,
+                                                  ldu,
+                                                  stU,
+                                                  dV,
+                                                  ldv,
+                                                  stV,
+                                                  dWork,
+                                                  size_W,
+                                                  dE,
+                                                  stE,
+                                                  dinfo,
+                                                  bc,
+                                                  leftvT,
+                                                  rightvT,
+                                                  mT,
+                                                  nT,
+                                                  dUT,
+                                                  lduT,
+                                                  stUT,
+                                                  dVT,
+                                                  ldvT,
+                                                  stVT,
+                                                  hA,
+                                                  hS,
+                                                  hSres,
+                                                  hU,
+                                                  Ures,
+                                                  ldures,
+                                                  hV,
+                                                  Vres,
+                                                  ldvres,
+                                                  hE,
+                                                  hEres,
+                                                  hinfo,
+                                                  hinfoRes,
+                                                  &max_error,
+                                                  &max_errorv);
         }
 
         // collect performance data
         if(argus.timing)
         {
-            gesvd_getPerfData<API, NRWK, T>(handle,
-                                            leftv,
-                                            rightv,
-                                            m,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dS,
-                                            stS,
-                                            dU,
-                                            ldu,
-                                            stU,
-                                            dV,
-                                            ldv,
-                                            stV,
-                                            dWork,
-                                            size_W,
-                                            dE,
-                                            stE,
-                                            dinfo,
-                                            bc,
-                                            hA,
-                                            hS,
-                                            hU,
-                                            hV,
-                                            hE,
-                                            hinfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+            gesvd_getPerfData<API, STRIDED, NRWK, T>(handle,
+                                                     leftv,
+                                                     rightv,
+                                                     m,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dS,
+                                                     stS,
+                                                     dU,
+                                                     ldu,
+                                                     stU,
+                                                     dV,
+                                                     ldv,
+                                                     stV,
+                                                     dWork,
+                                                     size_W,
+                                                     dE,
+                                                     stE,
+                                                     dinfo,
+                                                     bc,
+                                                     hA,
+                                                     hS,
+                                                     hU,
+                                                     hV,
+                                                     hE,
+                                                     hinfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
         }
     }
 
@@ -487,22 +487,30 @@ void gesvdj_getError(const hipsolverHandle_t handle,
     }
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_gesvd<T>(svect,
-                       svect,
-                       m,
-                       n,
-                       hA[b],
-                       lda,
-                       hS[b],
-                       hU[b],
-                       ldu,
-                       hV[b],
-                       ldv,
-                       hWork.data(),
-                       size_W,
-                       hE.data(),
-                       hinfo[b]);
+    hipsolver_test_cache cache("gesvdj");
+    cache.arg(type2char<T>()).arg(svect).arg(svect);
+    cache.arg(m).arg(n).arg(lda).arg(ldu).arg(ldv).arg(bc);
+    cache.input(hA).output(hA).output(hS).output(hU).output(hV).output(hinfo);
+    if(!cache.load())
+    {
+        for(int b = 0; b < bc; ++b)
+            cblas_gesvd<T>(svect,
+                           svect,
+                           m,
+                           n,
+                           hA[b],
+                           lda,
+                           hS[b],
+                           hU[b],
+                           ldu,
+                           hV[b],
+                           ldv,
+                           hWork.data(),
+                           size_W,
+                           hE.data(),
+                           hinfo[b]);
+        cache.store();
+    }
 
     // Check info for non-convergence
     *max_err = 0;
@@ -601,6 +609,7 @@ void gesvdj_getPerfData(const hipsolverHandle_t handle,
         gesvdj_initData<true, false, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
             cblas_gesvd<T>(svect,
@@ -624,7 +633,7 @@ void gesvdj_getPerfData(const hipsolverHandle_t handle,
     gesvdj_initData<true, false, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         gesvdj_initData<false, true, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
 
@@ -656,13 +665,13 @@ void gesvdj_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         gesvdj_initData<false, true, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_gesvdj(API,
                          STRIDED,
                          handle,
@@ -686,9 +695,9 @@ void gesvdj_getPerfData(const hipsolverHandle_t handle,
                          dinfo.data(),
                          params,
                          bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
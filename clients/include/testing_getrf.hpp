@@ -215,8 +215,9 @@ void getrf_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
+    cblas_batched(bc, [&](int b) {
         cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]);
+    });
 
     // expecting original matrix to be non-singular
     // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
@@ -276,9 +277,11 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
             handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < bc; ++b)
+        cblas_batched(bc, [&](int b) {
             cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]);
+        });
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
@@ -286,7 +289,7 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
         handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         getrf_initData<NPVT, false, true, T>(
             handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
@@ -310,14 +313,14 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         getrf_initData<NPVT, false, true, T>(
             handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_getrf(API,
                         NPVT,
                         handle,
@@ -332,9 +335,9 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
                         stP,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, bool NPVT, typename T>
@@ -0,0 +1,594 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+// Dimension of problem b of a vbatched test. The problems cycle through d, d - d/4 and
+// d - d/2, so that they are grouped into several interleaved buckets
+inline int vbatched_dim(int d, int b)
+{
+    return d - (b % 3) * (d / 4);
+}
+
+// Sets the dimension of each problem in a host array
+inline void vbatched_dims(int d, int bc, host_strided_batch_vector<int>& hD)
+{
+    for(int b = 0; b < bc; b++)
+        hD[b][0] = vbatched_dim(d, b);
+}
+
+template <testAPI_t API, typename T, typename U, typename V>
+void getrf_vbatched_checkBadArgs(const hipsolverHandle_t handle,
+                                 V                       dM,
+                                 V                       dN,
+                                 T                       dA,
+                                 V                       dLda,
+                                 U                       dWork,
+                                 const int               lwork,
+                                 V                       dIpiv,
+                                 V                       dinfo,
+                                 const int               bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_vbatched(
+            API, nullptr, dM, dN, dA, dLda, dWork, lwork, dIpiv, dinfo, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // sizes
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_vbatched(API, handle, dM, dN, dA, dLda, dWork, lwork, dIpiv, dinfo, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_vbatched(
+            API, handle, (V) nullptr, dN, dA, dLda, dWork, lwork, dIpiv, dinfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_vbatched(
+            API, handle, dM, (V) nullptr, dA, dLda, dWork, lwork, dIpiv, dinfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_vbatched(
+            API, handle, dM, dN, (T) nullptr, dLda, dWork, lwork, dIpiv, dinfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_vbatched(
+            API, handle, dM, dN, dA, (V) nullptr, dWork, lwork, dIpiv, dinfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_getrf_vbatched(
+            API, handle, dM, dN, dA, dLda, dWork, lwork, dIpiv, (V) nullptr, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrf_vbatched(API,
+                                                   handle,
+                                                   (V) nullptr,
+                                                   (V) nullptr,
+                                                   (T) nullptr,
+                                                   (V) nullptr,
+                                                   dWork,
+                                                   lwork,
+                                                   (V) nullptr,
+                                                   (V) nullptr,
+                                                   0),
+                          HIPSOLVER_STATUS_SUCCESS);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_getrf_vbatched_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    bc = 1;
+
+    // memory allocations
+    host_strided_batch_vector<int>   hOne(1, 1, 1, 1);
+    device_strided_batch_vector<int> dM(1, 1, 1, 1);
+    device_strided_batch_vector<int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<int> dLda(1, 1, 1, 1);
+    device_batch_vector<T>           dA(1, 1, 1);
+    device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dM.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    hOne[0][0] = 1;
+    CHECK_HIP_ERROR(dM.transfer_from(hOne));
+    CHECK_HIP_ERROR(dN.transfer_from(hOne));
+    CHECK_HIP_ERROR(dLda.transfer_from(hOne));
+
+    int size_W;
+    hipsolver_getrf_vbatched_bufferSize(
+        API, handle, dM.data(), dN.data(), dA.data(), dLda.data(), &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    getrf_vbatched_checkBadArgs<API>(handle,
+                                     dM.data(),
+                                     dN.data(),
+                                     dA.data(),
+                                     dLda.data(),
+                                     dWork.data(),
+                                     size_W,
+                                     dIpiv.data(),
+                                     dInfo.data(),
+                                     bc);
+}
+
+template <bool NPVT, bool CPU, bool GPU, typename T, typename Td, typename Th>
+void getrf_vbatched_initData(const hipsolverHandle_t handle,
+                             const int               m,
+                             const int               n,
+                             Td&                     dA,
+                             const int               lda,
+                             const int               bc,
+                             Th&                     hA)
+{
+    if(CPU)
+    {
+        T tmp;
+        rocblas_init<T>(hA, true);
+
+        for(int b = 0; b < bc; ++b)
+        {
+            int mb = vbatched_dim(m, b);
+            int nb = vbatched_dim(n, b);
+
+            // scale A to avoid singularities
+            for(int i = 0; i < mb; i++)
+            {
+                for(int j = 0; j < nb; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            if(!NPVT)
+            {
+                // shuffle rows to test pivoting
+                // always the same permuation for debugging purposes
+                for(int i = 0; i < mb / 2; i++)
+                {
+                    for(int j = 0; j < nb; j++)
+                    {
+                        tmp                         = hA[b][i + j * lda];
+                        hA[b][i + j * lda]          = hA[b][mb - 1 - i + j * lda];
+                        hA[b][mb - 1 - i + j * lda] = tmp;
+                    }
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          bool NPVT,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void getrf_vbatched_getError(const hipsolverHandle_t handle,
+                             const int               m,
+                             const int               n,
+                             Ud&                     dM,
+                             Ud&                     dN,
+                             Td&                     dA,
+                             const int               lda,
+                             Ud&                     dLda,
+                             Vd&                     dWork,
+                             const int               lwork,
+                             Ud&                     dIpiv,
+                             Ud&                     dInfo,
+                             const int               bc,
+                             Th&                     hA,
+                             Th&                     hARes,
+                             Uh&                     hIpiv,
+                             Uh&                     hIpivRes,
+                             Uh&                     hInfo,
+                             Uh&                     hInfoRes,
+                             double*                 max_err)
+{
+    // input data initialization
+    getrf_vbatched_initData<NPVT, true, true, T>(handle, m, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf_vbatched(API,
+                                                 handle,
+                                                 dM.data(),
+                                                 dN.data(),
+                                                 dA.data(),
+                                                 dLda.data(),
+                                                 dWork.data(),
+                                                 lwork,
+                                                 NPVT ? (int*)nullptr : dIpiv.data(),
+                                                 dInfo.data(),
+                                                 bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // the pivots of all the problems are stored one after the other
+    int offset = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        int mb = vbatched_dim(m, b);
+        int nb = vbatched_dim(n, b);
+        cblas_getrf<T>(mb, nb, hA[b], lda, hIpiv[0] + offset, hInfo[b]);
+        offset += min(mb, nb);
+    }
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    offset   = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        int mb   = vbatched_dim(m, b);
+        int nb   = vbatched_dim(n, b);
+        err      = norm_error('F', mb, nb, lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting (count the number of incorrect pivots)
+        if(!NPVT)
+        {
+            err = 0;
+            for(int i = 0; i < min(mb, nb); ++i)
+                if(hIpiv[0][offset + i] != hIpivRes[0][offset + i])
+                    err++;
+            *max_err = err > *max_err ? err : *max_err;
+        }
+        offset += min(mb, nb);
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          bool NPVT,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void getrf_vbatched_getPerfData(const hipsolverHandle_t handle,
+                                const int               m,
+                                const int               n,
+                                Ud&                     dM,
+                                Ud&                     dN,
+                                Td&                     dA,
+                                const int               lda,
+                                Ud&                     dLda,
+                                Vd&                     dWork,
+                                const int               lwork,
+                                Ud&                     dIpiv,
+                                Ud&                     dInfo,
+                                const int               bc,
+                                Th&                     hA,
+                                Uh&                     hIpiv,
+                                Uh&                     hInfo,
+                                double*                 gpu_time_used,
+                                double*                 cpu_time_used,
+                                const int               hot_calls,
+                                const bool              perf)
+{
+    if(!perf)
+    {
+        getrf_vbatched_initData<NPVT, true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        int offset     = 0;
+        for(int b = 0; b < bc; ++b)
+        {
+            int mb = vbatched_dim(m, b);
+            int nb = vbatched_dim(n, b);
+            cblas_getrf<T>(mb, nb, hA[b], lda, hIpiv[0] + offset, hInfo[b]);
+            offset += min(mb, nb);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrf_vbatched_initData<NPVT, true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        getrf_vbatched_initData<NPVT, false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getrf_vbatched(API,
+                                                     handle,
+                                                     dM.data(),
+                                                     dN.data(),
+                                                     dA.data(),
+                                                     dLda.data(),
+                                                     dWork.data(),
+                                                     lwork,
+                                                     NPVT ? (int*)nullptr : dIpiv.data(),
+                                                     dInfo.data(),
+                                                     bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        getrf_vbatched_initData<NPVT, false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        timer.start();
+        hipsolver_getrf_vbatched(API,
+                                 handle,
+                                 dM.data(),
+                                 dN.data(),
+                                 dA.data(),
+                                 dLda.data(),
+                                 dWork.data(),
+                                 lwork,
+                                 NPVT ? (int*)nullptr : dIpiv.data(),
+                                 dInfo.data(),
+                                 bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, bool NPVT, typename T>
+void testing_getrf_vbatched(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    m   = argus.get<int>("m");
+    int                    n   = argus.get<int>("n", m);
+    int                    lda = argus.get<int>("lda", m);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // m, n and lda are the largest dimensions of the batch
+    size_t size_A    = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || lda < 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(bc >= 0)
+        {
+            host_strided_batch_vector<int>   hM(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+            device_strided_batch_vector<int> dM(1, 1, 1, bc);
+            device_strided_batch_vector<int> dN(1, 1, 1, bc);
+            device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+            device_batch_vector<T>           dA(1, 1, bc);
+            device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+            device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+            vbatched_dims(m, bc, hM);
+            vbatched_dims(n, bc, hN);
+            vbatched_dims(lda, bc, hLda);
+            CHECK_HIP_ERROR(dM.transfer_from(hM));
+            CHECK_HIP_ERROR(dN.transfer_from(hN));
+            CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrf_vbatched(API,
+                                                           handle,
+                                                           dM.data(),
+                                                           dN.data(),
+                                                           dA.data(),
+                                                           dLda.data(),
+                                                           (T*)nullptr,
+                                                           0,
+                                                           dIpiv.data(),
+                                                           dInfo.data(),
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrf_vbatched(API,
+                                                           handle,
+                                                           (int*)nullptr,
+                                                           (int*)nullptr,
+                                                           (T**)nullptr,
+                                                           (int*)nullptr,
+                                                           (T*)nullptr,
+                                                           0,
+                                                           (int*)nullptr,
+                                                           (int*)nullptr,
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // the pivots of all the problems are stored one after the other
+    size_t size_P = 0;
+    for(int b = 0; b < bc; b++)
+        size_P += min(vbatched_dim(m, b), vbatched_dim(n, b));
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // memory allocations
+    host_strided_batch_vector<int>   hM(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+    host_batch_vector<T>             hA(size_A, 1, bc);
+    host_batch_vector<T>             hARes(size_ARes, 1, bc);
+    host_strided_batch_vector<int>   hIpiv(size_P, 1, size_P, 1);
+    host_strided_batch_vector<int>   hIpivRes(size_PRes, 1, size_PRes, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<int> dM(1, 1, 1, bc);
+    device_strided_batch_vector<int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+    device_batch_vector<T>           dA(size_A, 1, bc);
+    device_strided_batch_vector<int> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(bc)
+    {
+        CHECK_HIP_ERROR(dM.memcheck());
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+    }
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // all the problems share lda, which is valid for the largest one
+    vbatched_dims(m, bc, hM);
+    vbatched_dims(n, bc, hN);
+    for(int b = 0; b < bc; b++)
+        hLda[b][0] = lda;
+    CHECK_HIP_ERROR(dM.transfer_from(hM));
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+    int size_W;
+    hipsolver_getrf_vbatched_bufferSize(
+        API, handle, dM.data(), dN.data(), dA.data(), dLda.data(), &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrf_vbatched_getError<API, NPVT, T>(handle,
+                                              m,
+                                              n,
+                                              dM,
+                                              dN,
+                                              dA,
+                                              lda,
+                                              dLda,
+                                              dWork,
+                                              size_W,
+                                              dIpiv,
+                                              dInfo,
+                                              bc,
+                                              hA,
+                                              hARes,
+                                              hIpiv,
+                                              hIpivRes,
+                                              hInfo,
+                                              hInfoRes,
+                                              &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        getrf_vbatched_getPerfData<API, NPVT, T>(handle,
+                                                 m,
+                                                 n,
+                                                 dM,
+                                                 dN,
+                                                 dA,
+                                                 lda,
+                                                 dLda,
+                                                 dWork,
+                                                 size_W,
+                                                 dIpiv,
+                                                 dInfo,
+                                                 bc,
+                                                 hA,
+                                                 hIpiv,
+                                                 hInfo,
+                                                 &gpu_time_used,
+                                                 &cpu_time_used,
+                                                 hot_calls,
+                                                 argus.perf);
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("max_m", "max_n", "lda", "batch_c");
+            rocsolver_bench_output(m, n, lda, bc);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -250,11 +250,10 @@ void getrs_initData(const hipsolverHandle_t    handle,
         }
 
         // do the LU decomposition of matrix A w/ the reference LAPACK routine
-        for(int b = 0; b < bc; ++b)
-        {
+        cblas_batched(bc, [&](int b) {
             int info;
             cblas_getrf<T>(m, m, hA[b], lda, hIpiv[b], &info);
-        }
+        });
     }
 
     if(GPU)
@@ -316,10 +315,9 @@ void getrs_getError(const hipsolverHandle_t    handle,
     CHECK_HIP_ERROR(hBRes.transfer_from(dB));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-    {
+    cblas_batched(bc, [&](int b) {
         cblas_getrs<T>(trans, m, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
-    }
+    });
 
     // error is ||hB - hBRes|| / ||hB||
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
@@ -366,11 +364,11 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
             handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < bc; ++b)
-        {
+        cblas_batched(bc, [&](int b) {
             cblas_getrs<T>(trans, m, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
-        }
+        });
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
@@ -378,7 +376,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
         handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         getrs_initData<false, true, T>(
             handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
@@ -405,14 +403,14 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         getrs_initData<false, true, T>(
             handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_getrs(API,
                         handle,
                         trans,
@@ -430,9 +428,9 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
                         lwork,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
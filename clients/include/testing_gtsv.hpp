@@ -0,0 +1,660 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, bool NOPIVOT, bool STRIDED, typename T, typename U>
+void gtsv_checkBadArgs(const hipsolverHandle_t handle,
+                       const int               n,
+                       const int               nrhs,
+                       T                       dDL,
+                       T                       dD,
+                       T                       dDU,
+                       const int               stD,
+                       T                       dB,
+                       const int               ldb,
+                       const int               stB,
+                       T                       dWork,
+                       const int               lwork,
+                       U                       dInfo,
+                       const int               bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                         NOPIVOT,
+                                         STRIDED,
+                                         nullptr,
+                                         n,
+                                         nrhs,
+                                         dDL,
+                                         dD,
+                                         dDU,
+                                         stD,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dWork,
+                                         lwork,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                         NOPIVOT,
+                                         STRIDED,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         (T) nullptr,
+                                         dD,
+                                         dDU,
+                                         stD,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dWork,
+                                         lwork,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                         NOPIVOT,
+                                         STRIDED,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dDL,
+                                         (T) nullptr,
+                                         dDU,
+                                         stD,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dWork,
+                                         lwork,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                         NOPIVOT,
+                                         STRIDED,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dDL,
+                                         dD,
+                                         (T) nullptr,
+                                         stD,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dWork,
+                                         lwork,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                         NOPIVOT,
+                                         STRIDED,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dDL,
+                                         dD,
+                                         dDU,
+                                         stD,
+                                         (T) nullptr,
+                                         ldb,
+                                         stB,
+                                         dWork,
+                                         lwork,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                         NOPIVOT,
+                                         STRIDED,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dDL,
+                                         dD,
+                                         dDU,
+                                         stD,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dWork,
+                                         lwork,
+                                         (U) nullptr,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, bool NOPIVOT, typename T>
+void testing_gtsv_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    n    = 1;
+    int                    nrhs = 1;
+    int                    ldb  = 1;
+    int                    stD  = 1;
+    int                    stB  = 1;
+    int                    bc   = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dDL(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dD(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dDU(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dDL.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dDU.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_gtsv_bufferSize(API,
+                              NOPIVOT,
+                              STRIDED,
+                              handle,
+                              n,
+                              nrhs,
+                              dDL.data(),
+                              dD.data(),
+                              dDU.data(),
+                              stD,
+                              dB.data(),
+                              ldb,
+                              stB,
+                              &size_W,
+                              bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gtsv_checkBadArgs<API, NOPIVOT, STRIDED>(handle,
+                                             n,
+                                             nrhs,
+                                             dDL.data(),
+                                             dD.data(),
+                                             dDU.data(),
+                                             stD,
+                                             dB.data(),
+                                             ldb,
+                                             stB,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gtsv_initData(const hipsolverHandle_t handle,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dDL,
+                   Td&                     dD,
+                   Td&                     dDU,
+                   const int               stD,
+                   Td&                     dB,
+                   const int               ldb,
+                   const int               stB,
+                   const int               bc,
+                   Th&                     hDL,
+                   Th&                     hD,
+                   Th&                     hDU,
+                   Th&                     hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hDL, true);
+        rocblas_init<T>(hD, true);
+        rocblas_init<T>(hDU, true);
+        rocblas_init<T>(hB, true);
+
+        // scale the diagonal to ensure the systems are non-singular (and that they
+        // can be solved without pivoting)
+        for(int b = 0; b < bc; ++b)
+        {
+            for(int i = 0; i < n; i++)
+                hD[b][i] += T(400);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dDL.transfer_from(hDL));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dDU.transfer_from(hDU));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <testAPI_t API,
+          bool      NOPIVOT,
+          bool      STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void gtsv_getError(const hipsolverHandle_t handle,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dDL,
+                   Td&                     dD,
+                   Td&                     dDU,
+                   const int               stD,
+                   Td&                     dB,
+                   const int               ldb,
+                   const int               stB,
+                   Td&                     dWork,
+                   const int               lwork,
+                   Ud&                     dInfo,
+                   const int               bc,
+                   Th&                     hDL,
+                   Th&                     hD,
+                   Th&                     hDU,
+                   Th&                     hB,
+                   Th&                     hBRes,
+                   Uh&                     hInfo,
+                   Uh&                     hInfoRes,
+                   double*                 max_err)
+{
+    // input data initialization
+    gtsv_initData<true, true, T>(
+        handle, n, nrhs, dDL, dD, dDU, stD, dB, ldb, stB, bc, hDL, hD, hDU, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gtsv(API,
+                                       NOPIVOT,
+                                       STRIDED,
+                                       handle,
+                                       n,
+                                       nrhs,
+                                       dDL.data(),
+                                       dD.data(),
+                                       dDU.data(),
+                                       stD,
+                                       dB.data(),
+                                       ldb,
+                                       stB,
+                                       dWork.data(),
+                                       lwork,
+                                       dInfo.data(),
+                                       bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // (the first element of dl is not referenced)
+    cblas_batched(bc, [&](int b) {
+        cblas_gtsv<T>(n, nrhs, hDL[b] + 1, hD[b], hDU[b], hB[b], ldb, hInfo[b]);
+    });
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('I', n, nrhs, ldb, hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          bool      NOPIVOT,
+          bool      STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void gtsv_getPerfData(const hipsolverHandle_t handle,
+                      const int               n,
+                      const int               nrhs,
+                      Td&                     dDL,
+                      Td&                     dD,
+                      Td&                     dDU,
+                      const int               stD,
+                      Td&                     dB,
+                      const int               ldb,
+                      const int               stB,
+                      Td&                     dWork,
+                      const int               lwork,
+                      Ud&                     dInfo,
+                      const int               bc,
+                      Th&                     hDL,
+                      Th&                     hD,
+                      Th&                     hDU,
+                      Th&                     hB,
+                      Uh&                     hInfo,
+                      double*                 gpu_time_used,
+                      double*                 cpu_time_used,
+                      const int               hot_calls,
+                      const bool              perf)
+{
+    if(!perf)
+    {
+        gtsv_initData<true, false, T>(
+            handle, n, nrhs, dDL, dD, dDU, stD, dB, ldb, stB, bc, hDL, hD, hDU, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_batched(bc, [&](int b) {
+            cblas_gtsv<T>(n, nrhs, hDL[b] + 1, hD[b], hDU[b], hB[b], ldb, hInfo[b]);
+        });
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gtsv_initData<true, false, T>(
+        handle, n, nrhs, dDL, dD, dDU, stD, dB, ldb, stB, bc, hDL, hD, hDU, hB);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        gtsv_initData<false, true, T>(
+            handle, n, nrhs, dDL, dD, dDU, stD, dB, ldb, stB, bc, hDL, hD, hDU, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gtsv(API,
+                                           NOPIVOT,
+                                           STRIDED,
+                                           handle,
+                                           n,
+                                           nrhs,
+                                           dDL.data(),
+                                           dD.data(),
+                                           dDU.data(),
+                                           stD,
+                                           dB.data(),
+                                           ldb,
+                                           stB,
+                                           dWork.data(),
+                                           lwork,
+                                           dInfo.data(),
+                                           bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        gtsv_initData<false, true, T>(
+            handle, n, nrhs, dDL, dD, dDU, stD, dB, ldb, stB, bc, hDL, hD, hDU, hB);
+
+        timer.start();
+        hipsolver_gtsv(API,
+                       NOPIVOT,
+                       STRIDED,
+                       handle,
+                       n,
+                       nrhs,
+                       dDL.data(),
+                       dD.data(),
+                       dDU.data(),
+                       stD,
+                       dB.data(),
+                       ldb,
+                       stB,
+                       dWork.data(),
+                       lwork,
+                       dInfo.data(),
+                       bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, bool NOPIVOT, typename T>
+void testing_gtsv(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    n    = argus.get<int>("n");
+    int                    nrhs = argus.get<int>("nrhs", n);
+    int                    ldb  = argus.get<int>("ldb", n);
+    int                    stD  = argus.get<int>("strideD", n);
+    int                    stB  = argus.get<int>("strideB", ldb * nrhs);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    int stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // determine sizes
+    size_t size_D    = size_t(n);
+    size_t size_B    = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                             NOPIVOT,
+                                             STRIDED,
+                                             handle,
+                                             n,
+                                             nrhs,
+                                             (T*)nullptr,
+                                             (T*)nullptr,
+                                             (T*)nullptr,
+                                             stD,
+                                             (T*)nullptr,
+                                             ldb,
+                                             stB,
+                                             (T*)nullptr,
+                                             0,
+                                             (int*)nullptr,
+                                             bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hDL(size_D, 1, stD, bc);
+    host_strided_batch_vector<T>     hD(size_D, 1, stD, bc);
+    host_strided_batch_vector<T>     hDU(size_D, 1, stD, bc);
+    host_strided_batch_vector<T>     hB(size_B, 1, stB, bc);
+    host_strided_batch_vector<T>     hBRes(size_BRes, 1, stBRes, bc);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T>   dDL(size_D, 1, stD, bc);
+    device_strided_batch_vector<T>   dD(size_D, 1, stD, bc);
+    device_strided_batch_vector<T>   dDU(size_D, 1, stD, bc);
+    device_strided_batch_vector<T>   dB(size_B, 1, stB, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(size_D)
+    {
+        CHECK_HIP_ERROR(dDL.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dDU.memcheck());
+    }
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_gtsv_bufferSize(API,
+                              NOPIVOT,
+                              STRIDED,
+                              handle,
+                              n,
+                              nrhs,
+                              dDL.data(),
+                              dD.data(),
+                              dDU.data(),
+                              stD,
+                              dB.data(),
+                              ldb,
+                              stB,
+                              &size_W,
+                              bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check quick return
+    if(n == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gtsv(API,
+                                             NOPIVOT,
+                                             STRIDED,
+                                             handle,
+                                             n,
+                                             nrhs,
+                                             dDL.data(),
+                                             dD.data(),
+                                             dDU.data(),
+                                             stD,
+                                             dB.data(),
+                                             ldb,
+                                             stB,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gtsv_getError<API, NOPIVOT, STRIDED, T>(handle,
+                                                n,
+                                                nrhs,
+                                                dDL,
+                                                dD,
+                                                dDU,
+                                                stD,
+                                                dB,
+                                                ldb,
+                                                stB,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                bc,
+                                                hDL,
+                                                hD,
+                                                hDU,
+                                                hB,
+                                                hBRes,
+                                                hInfo,
+                                                hInfoRes,
+                                                &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        gtsv_getPerfData<API, NOPIVOT, STRIDED, T>(handle,
+                                                   n,
+                                                   nrhs,
+                                                   dDL,
+                                                   dD,
+                                                   dDU,
+                                                   stD,
+                                                   dB,
+                                                   ldb,
+                                                   stB,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hDL,
+                                                   hD,
+                                                   hDU,
+                                                   hB,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(STRIDED)
+            {
+                rocsolver_bench_output("n", "nrhs", "ldb", "strideD", "strideB", "batch_c");
+                rocsolver_bench_output(n, nrhs, ldb, stD, stB, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "nrhs", "ldb");
+                rocsolver_bench_output(n, nrhs, ldb);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -221,6 +221,7 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
             handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         cblas_orgbr_ungbr<T>(side, m, n, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
@@ -230,7 +231,7 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
         handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         orgbr_ungbr_initData<false, true, T>(
             handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
@@ -252,14 +253,14 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         orgbr_ungbr_initData<false, true, T>(
             handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_orgbr_ungbr(FORTRAN,
                               handle,
                               side,
@@ -272,9 +273,9 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
                               dWork.data(),
                               lwork,
                               dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, typename T>
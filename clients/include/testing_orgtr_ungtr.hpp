@@ -180,6 +180,7 @@ void orgtr_ungtr_getPerfData(const hipsolverHandle_t   handle,
             handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         cblas_orgtr_ungtr<T>(uplo, n, hA[0], lda, hIpiv[0], hW.data(), size_W);
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
@@ -188,7 +189,7 @@ void orgtr_ungtr_getPerfData(const hipsolverHandle_t   handle,
     orgtr_ungtr_initData<true, false, T>(handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         orgtr_ungtr_initData<false, true, T>(
             handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
@@ -208,14 +209,14 @@ void orgtr_ungtr_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         orgtr_ungtr_initData<false, true, T>(
             handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_orgtr_ungtr(FORTRAN,
                               handle,
                               uplo,
@@ -226,9 +227,9 @@ void orgtr_ungtr_getPerfData(const hipsolverHandle_t   handle,
                               dWork.data(),
                               lwork,
                               dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, typename T>
@@ -0,0 +1,485 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, bool STRIDED, typename T, typename U>
+void pbtrf_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        const int                 kd,
+                        T                         dAB,
+                        const int                 ldab,
+                        const int                 stA,
+                        T                         dWork,
+                        const int                 lwork,
+                        U                         dInfo,
+                        const int                 bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pbtrf(
+            API, STRIDED, nullptr, uplo, n, kd, dAB, ldab, stA, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_pbtrf(API,
+                                          STRIDED,
+                                          handle,
+                                          hipsolverFillMode_t(-1),
+                                          n,
+                                          kd,
+                                          dAB,
+                                          ldab,
+                                          stA,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pbtrf(
+            API, STRIDED, handle, uplo, n, kd, (T) nullptr, ldab, stA, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pbtrf(
+            API, STRIDED, handle, uplo, n, kd, dAB, ldab, stA, dWork, lwork, (U) nullptr, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_pbtrf_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    n    = 1;
+    int                    kd   = 0;
+    int                    ldab = 1;
+    int                    stA  = 1;
+    int                    bc   = 1;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dAB(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pbtrf_bufferSize(
+        API, STRIDED, handle, uplo, n, kd, dAB.data(), ldab, stA, &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    pbtrf_checkBadArgs<API, STRIDED>(
+        handle, uplo, n, kd, dAB.data(), ldab, stA, dWork.data(), size_W, dInfo.data(), bc);
+}
+
+// Fills hAB with a random Hermitian band matrix in LAPACK band storage. The diagonal is
+// scaled to ensure positive definiteness, unless the matrix must be singular
+template <typename T, typename Th>
+void pbtrf_initBand(const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 kd,
+                    const int                 ldab,
+                    const int                 bc,
+                    Th&                       hAB,
+                    const bool                singular)
+{
+    rocblas_init<T>(hAB, true);
+
+    int diag = (uplo == HIPSOLVER_FILL_MODE_UPPER) ? kd : 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            T& aii = hAB[b][diag + i * ldab];
+            aii    = aii * conj(aii) * 400 + T(30 * kd);
+        }
+
+        // make some matrices not positive definite
+        if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1) && n > 0)
+        {
+            int i                   = n / (b + 2);
+            hAB[b][diag + i * ldab] = -hAB[b][diag + i * ldab];
+        }
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void pbtrf_initData(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 kd,
+                    Td&                       dAB,
+                    const int                 ldab,
+                    const int                 stA,
+                    const int                 bc,
+                    Th&                       hAB,
+                    const bool                singular)
+{
+    if(CPU)
+        pbtrf_initBand<T>(uplo, n, kd, ldab, bc, hAB, singular);
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    }
+}
+
+template <testAPI_t API,
+          bool      STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void pbtrf_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 kd,
+                    Td&                       dAB,
+                    const int                 ldab,
+                    const int                 stA,
+                    Td&                       dWork,
+                    const int                 lwork,
+                    Ud&                       dInfo,
+                    const int                 bc,
+                    Th&                       hAB,
+                    Th&                       hABRes,
+                    Uh&                       hInfo,
+                    Uh&                       hInfoRes,
+                    double*                   max_err,
+                    const bool                singular)
+{
+    // input data initialization
+    pbtrf_initData<true, true, T>(handle, uplo, n, kd, dAB, ldab, stA, bc, hAB, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_pbtrf(API,
+                                        STRIDED,
+                                        handle,
+                                        uplo,
+                                        n,
+                                        kd,
+                                        dAB.data(),
+                                        ldab,
+                                        stA,
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data(),
+                                        bc));
+    CHECK_HIP_ERROR(hABRes.transfer_from(dAB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cblas_batched(bc, [&](int b) {
+        cblas_pbtrf<T>(uplo, n, kd, hAB[b], ldab, hInfo[b]);
+    });
+
+    // error is ||hAB - hABRes|| / ||hAB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm over the band storage; the factors of the matrices that are
+    // not positive definite are not compared
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        if(hInfoRes[b][0] == 0)
+        {
+            err      = norm_error('F', ldab, n, ldab, hAB[b], hABRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // also check info for non positive definite cases
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          bool      STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void pbtrf_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const int                 n,
+                       const int                 kd,
+                       Td&                       dAB,
+                       const int                 ldab,
+                       const int                 stA,
+                       Td&                       dWork,
+                       const int                 lwork,
+                       Ud&                       dInfo,
+                       const int                 bc,
+                       Th&                       hAB,
+                       Uh&                       hInfo,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf,
+                       const bool                singular)
+{
+    if(!perf)
+    {
+        pbtrf_initData<true, false, T>(handle, uplo, n, kd, dAB, ldab, stA, bc, hAB, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_batched(bc, [&](int b) {
+            cblas_pbtrf<T>(uplo, n, kd, hAB[b], ldab, hInfo[b]);
+        });
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pbtrf_initData<true, false, T>(handle, uplo, n, kd, dAB, ldab, stA, bc, hAB, singular);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        pbtrf_initData<false, true, T>(handle, uplo, n, kd, dAB, ldab, stA, bc, hAB, singular);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_pbtrf(API,
+                                            STRIDED,
+                                            handle,
+                                            uplo,
+                                            n,
+                                            kd,
+                                            dAB.data(),
+                                            ldab,
+                                            stA,
+                                            dWork.data(),
+                                            lwork,
+                                            dInfo.data(),
+                                            bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        pbtrf_initData<false, true, T>(handle, uplo, n, kd, dAB, ldab, stA, bc, hAB, singular);
+
+        timer.start();
+        hipsolver_pbtrf(API,
+                        STRIDED,
+                        handle,
+                        uplo,
+                        n,
+                        kd,
+                        dAB.data(),
+                        ldab,
+                        stA,
+                        dWork.data(),
+                        lwork,
+                        dInfo.data(),
+                        bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_pbtrf(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    kd    = argus.get<int>("kd");
+    int                    ldab  = argus.get<int>("ldab", kd + 1);
+    int                    stA   = argus.get<int>("strideA", ldab * n);
+    int                    bc    = argus.batch_count;
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+    bool                singular  = argus.get<int>("singular", 0) == 1;
+
+    int stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_pbtrf(API,
+                                              STRIDED,
+                                              handle,
+                                              uplo,
+                                              n,
+                                              kd,
+                                              (T*)nullptr,
+                                              ldab,
+                                              stA,
+                                              (T*)nullptr,
+                                              0,
+                                              (int*)nullptr,
+                                              bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(ldab) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || kd < 0 || ldab < kd + 1 || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_pbtrf(API,
+                                              STRIDED,
+                                              handle,
+                                              uplo,
+                                              n,
+                                              kd,
+                                              (T*)nullptr,
+                                              ldab,
+                                              stA,
+                                              (T*)nullptr,
+                                              0,
+                                              (int*)nullptr,
+                                              bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hAB(size_A, 1, stA, bc);
+    host_strided_batch_vector<T>     hABRes(size_ARes, 1, stARes, bc);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T>   dAB(size_A, 1, stA, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pbtrf_bufferSize(
+        API, STRIDED, handle, uplo, n, kd, dAB.data(), ldab, stA, &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        pbtrf_getError<API, STRIDED, T>(handle,
+                                        uplo,
+                                        n,
+                                        kd,
+                                        dAB,
+                                        ldab,
+                                        stA,
+                                        dWork,
+                                        size_W,
+                                        dInfo,
+                                        bc,
+                                        hAB,
+                                        hABRes,
+                                        hInfo,
+                                        hInfoRes,
+                                        &max_error,
+                                        singular);
+
+    // collect performance data
+    if(argus.timing)
+        pbtrf_getPerfData<API, STRIDED, T>(handle,
+                                           uplo,
+                                           n,
+                                           kd,
+                                           dAB,
+                                           ldab,
+                                           stA,
+                                           dWork,
+                                           size_W,
+                                           dInfo,
+                                           bc,
+                                           hAB,
+                                           hInfo,
+                                           &gpu_time_used,
+                                           &cpu_time_used,
+                                           hot_calls,
+                                           argus.perf,
+                                           singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "kd", "ldab", "strideA", "batch_c");
+                rocsolver_bench_output(uploC, n, kd, ldab, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "kd", "ldab");
+                rocsolver_bench_output(uploC, n, kd, ldab);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
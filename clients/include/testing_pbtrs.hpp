@@ -0,0 +1,591 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_pbtrf.hpp"
+
+template <testAPI_t API, bool STRIDED, typename T, typename U>
+void pbtrs_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        const int                 kd,
+                        const int                 nrhs,
+                        T                         dAB,
+                        const int                 ldab,
+                        const int                 stA,
+                        T                         dB,
+                        const int                 ldb,
+                        const int                 stB,
+                        T                         dWork,
+                        const int                 lwork,
+                        U                         dInfo,
+                        const int                 bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_pbtrs(API,
+                                          STRIDED,
+                                          nullptr,
+                                          uplo,
+                                          n,
+                                          kd,
+                                          nrhs,
+                                          dAB,
+                                          ldab,
+                                          stA,
+                                          dB,
+                                          ldb,
+                                          stB,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_pbtrs(API,
+                                          STRIDED,
+                                          handle,
+                                          hipsolverFillMode_t(-1),
+                                          n,
+                                          kd,
+                                          nrhs,
+                                          dAB,
+                                          ldab,
+                                          stA,
+                                          dB,
+                                          ldb,
+                                          stB,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_pbtrs(API,
+                                          STRIDED,
+                                          handle,
+                                          uplo,
+                                          n,
+                                          kd,
+                                          nrhs,
+                                          (T) nullptr,
+                                          ldab,
+                                          stA,
+                                          dB,
+                                          ldb,
+                                          stB,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_pbtrs(API,
+                                          STRIDED,
+                                          handle,
+                                          uplo,
+                                          n,
+                                          kd,
+                                          nrhs,
+                                          dAB,
+                                          ldab,
+                                          stA,
+                                          (T) nullptr,
+                                          ldb,
+                                          stB,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_pbtrs(API,
+                                          STRIDED,
+                                          handle,
+                                          uplo,
+                                          n,
+                                          kd,
+                                          nrhs,
+                                          dAB,
+                                          ldab,
+                                          stA,
+                                          dB,
+                                          ldb,
+                                          stB,
+                                          dWork,
+                                          lwork,
+                                          (U) nullptr,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_pbtrs_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    n    = 1;
+    int                    kd   = 0;
+    int                    nrhs = 1;
+    int                    ldab = 1;
+    int                    ldb  = 1;
+    int                    stA  = 1;
+    int                    stB  = 1;
+    int                    bc   = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dAB(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pbtrs_bufferSize(API,
+                               STRIDED,
+                               handle,
+                               uplo,
+                               n,
+                               kd,
+                               nrhs,
+                               dAB.data(),
+                               ldab,
+                               stA,
+                               dB.data(),
+                               ldb,
+                               stB,
+                               &size_W,
+                               bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    pbtrs_checkBadArgs<API, STRIDED>(handle,
+                                     uplo,
+                                     n,
+                                     kd,
+                                     nrhs,
+                                     dAB.data(),
+                                     ldab,
+                                     stA,
+                                     dB.data(),
+                                     ldb,
+                                     stB,
+                                     dWork.data(),
+                                     size_W,
+                                     dInfo.data(),
+                                     bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void pbtrs_initData(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 kd,
+                    const int                 nrhs,
+                    Td&                       dAB,
+                    const int                 ldab,
+                    const int                 stA,
+                    Td&                       dB,
+                    const int                 ldb,
+                    const int                 stB,
+                    const int                 bc,
+                    Th&                       hAB,
+                    Th&                       hB)
+{
+    if(CPU)
+    {
+        pbtrf_initBand<T>(uplo, n, kd, ldab, bc, hAB, false);
+        rocblas_init<T>(hB, true);
+
+        // do the Cholesky factorization of matrix A w/ the reference LAPACK routine
+        cblas_batched(bc, [&](int b) {
+            int info;
+            cblas_pbtrf<T>(uplo, n, kd, hAB[b], ldab, &info);
+        });
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <testAPI_t API,
+          bool      STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void pbtrs_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 kd,
+                    const int                 nrhs,
+                    Td&                       dAB,
+                    const int                 ldab,
+                    const int                 stA,
+                    Td&                       dB,
+                    const int                 ldb,
+                    const int                 stB,
+                    Td&                       dWork,
+                    const int                 lwork,
+                    Ud&                       dInfo,
+                    const int                 bc,
+                    Th&                       hAB,
+                    Th&                       hB,
+                    Th&                       hBRes,
+                    Uh&                       hInfo,
+                    double*                   max_err)
+{
+    // input data initialization
+    pbtrs_initData<true, true, T>(
+        handle, uplo, n, kd, nrhs, dAB, ldab, stA, dB, ldb, stB, bc, hAB, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_pbtrs(API,
+                                        STRIDED,
+                                        handle,
+                                        uplo,
+                                        n,
+                                        kd,
+                                        nrhs,
+                                        dAB.data(),
+                                        ldab,
+                                        stA,
+                                        dB.data(),
+                                        ldb,
+                                        stB,
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data(),
+                                        bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    cblas_batched(bc, [&](int b) {
+        cblas_pbtrs<T>(uplo, n, kd, nrhs, hAB[b], ldab, hB[b], ldb);
+    });
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('I', n, nrhs, ldb, hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <testAPI_t API,
+          bool      STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void pbtrs_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const int                 n,
+                       const int                 kd,
+                       const int                 nrhs,
+                       Td&                       dAB,
+                       const int                 ldab,
+                       const int                 stA,
+                       Td&                       dB,
+                       const int                 ldb,
+                       const int                 stB,
+                       Td&                       dWork,
+                       const int                 lwork,
+                       Ud&                       dInfo,
+                       const int                 bc,
+                       Th&                       hAB,
+                       Th&                       hB,
+                       Uh&                       hInfo,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf)
+{
+    if(!perf)
+    {
+        pbtrs_initData<true, false, T>(
+            handle, uplo, n, kd, nrhs, dAB, ldab, stA, dB, ldb, stB, bc, hAB, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_batched(bc, [&](int b) {
+            cblas_pbtrs<T>(uplo, n, kd, nrhs, hAB[b], ldab, hB[b], ldb);
+        });
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pbtrs_initData<true, false, T>(
+        handle, uplo, n, kd, nrhs, dAB, ldab, stA, dB, ldb, stB, bc, hAB, hB);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        pbtrs_initData<false, true, T>(
+            handle, uplo, n, kd, nrhs, dAB, ldab, stA, dB, ldb, stB, bc, hAB, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_pbtrs(API,
+                                            STRIDED,
+                                            handle,
+                                            uplo,
+                                            n,
+                                            kd,
+                                            nrhs,
+                                            dAB.data(),
+                                            ldab,
+                                            stA,
+                                            dB.data(),
+                                            ldb,
+                                            stB,
+                                            dWork.data(),
+                                            lwork,
+                                            dInfo.data(),
+                                            bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        pbtrs_initData<false, true, T>(
+            handle, uplo, n, kd, nrhs, dAB, ldab, stA, dB, ldb, stB, bc, hAB, hB);
+
+        timer.start();
+        hipsolver_pbtrs(API,
+                        STRIDED,
+                        handle,
+                        uplo,
+                        n,
+                        kd,
+                        nrhs,
+                        dAB.data(),
+                        ldab,
+                        stA,
+                        dB.data(),
+                        ldb,
+                        stB,
+                        dWork.data(),
+                        lwork,
+                        dInfo.data(),
+                        bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_pbtrs(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    kd    = argus.get<int>("kd");
+    int                    nrhs  = argus.get<int>("nrhs", n);
+    int                    ldab  = argus.get<int>("ldab", kd + 1);
+    int                    ldb   = argus.get<int>("ldb", n);
+    int                    stA   = argus.get<int>("strideA", ldab * n);
+    int                    stB   = argus.get<int>("strideB", ldb * nrhs);
+    int                    bc    = argus.batch_count;
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    int stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(ldab) * n;
+    size_t size_B    = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (n < 0 || kd < 0 || nrhs < 0 || ldab < kd + 1 || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_pbtrs(API,
+                                              STRIDED,
+                                              handle,
+                                              uplo,
+                                              n,
+                                              kd,
+                                              nrhs,
+                                              (T*)nullptr,
+                                              ldab,
+                                              stA,
+                                              (T*)nullptr,
+                                              ldb,
+                                              stB,
+                                              (T*)nullptr,
+                                              0,
+                                              (int*)nullptr,
+                                              bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hAB(size_A, 1, stA, bc);
+    host_strided_batch_vector<T>     hB(size_B, 1, stB, bc);
+    host_strided_batch_vector<T>     hBRes(size_BRes, 1, stBRes, bc);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<T>   dAB(size_A, 1, stA, bc);
+    device_strided_batch_vector<T>   dB(size_B, 1, stB, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dAB.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pbtrs_bufferSize(API,
+                               STRIDED,
+                               handle,
+                               uplo,
+                               n,
+                               kd,
+                               nrhs,
+                               dAB.data(),
+                               ldab,
+                               stA,
+                               dB.data(),
+                               ldb,
+                               stB,
+                               &size_W,
+                               bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        pbtrs_getError<API, STRIDED, T>(handle,
+                                        uplo,
+                                        n,
+                                        kd,
+                                        nrhs,
+                                        dAB,
+                                        ldab,
+                                        stA,
+                                        dB,
+                                        ldb,
+                                        stB,
+                                        dWork,
+                                        size_W,
+                                        dInfo,
+                                        bc,
+                                        hAB,
+                                        hB,
+                                        hBRes,
+                                        hInfo,
+                                        &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        pbtrs_getPerfData<API, STRIDED, T>(handle,
+                                           uplo,
+                                           n,
+                                           kd,
+                                           nrhs,
+                                           dAB,
+                                           ldab,
+                                           stA,
+                                           dB,
+                                           ldb,
+                                           stB,
+                                           dWork,
+                                           size_W,
+                                           dInfo,
+                                           bc,
+                                           hAB,
+                                           hB,
+                                           hInfo,
+                                           &gpu_time_used,
+                                           &cpu_time_used,
+                                           hot_calls,
+                                           argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(STRIDED)
+            {
+                rocsolver_bench_output(
+                    "uplo", "n", "kd", "nrhs", "ldab", "ldb", "strideA", "strideB", "batch_c");
+                rocsolver_bench_output(uploC, n, kd, nrhs, ldab, ldb, stA, stB, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "kd", "nrhs", "ldab", "ldb");
+                rocsolver_bench_output(uploC, n, kd, nrhs, ldab, ldb);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
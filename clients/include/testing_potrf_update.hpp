@@ -0,0 +1,959 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+// calls the update or the downdate wrapper
+template <bool DOWNDATE, typename... Args>
+hipsolverStatus_t hipsolver_potrf_update_downdate(testAPI_t         API,
+                                                  bool              STRIDED,
+                                                  hipsolverHandle_t handle,
+                                                  Args... args)
+{
+    if(DOWNDATE)
+        return hipsolver_potrf_downdate(API, STRIDED, handle, args...);
+    else
+        return hipsolver_potrf_update(API, STRIDED, handle, args...);
+}
+
+template <bool DOWNDATE, typename... Args>
+hipsolverStatus_t hipsolver_potrf_update_downdate_bufferSize(testAPI_t         API,
+                                                             bool              STRIDED,
+                                                             hipsolverHandle_t handle,
+                                                             Args... args)
+{
+    if(DOWNDATE)
+        return hipsolver_potrf_downdate_bufferSize(API, STRIDED, handle, args...);
+    else
+        return hipsolver_potrf_update_bufferSize(API, STRIDED, handle, args...);
+}
+
+template <testAPI_t API, bool STRIDED, bool DOWNDATE, typename T, typename U, typename V>
+void potrf_update_checkBadArgs(const hipsolverHandle_t   handle,
+                               const hipsolverFillMode_t uplo,
+                               const int                 n,
+                               const int                 k,
+                               T                         dA,
+                               const int                 lda,
+                               const int                 stA,
+                               T                         dV,
+                               const int                 ldv,
+                               const int                 stV,
+                               U                         dWork,
+                               const int                 lwork,
+                               V                         dinfo,
+                               const int                 bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                    STRIDED,
+                                                                    nullptr,
+                                                                    uplo,
+                                                                    n,
+                                                                    k,
+                                                                    dA,
+                                                                    lda,
+                                                                    stA,
+                                                                    dV,
+                                                                    ldv,
+                                                                    stV,
+                                                                    dWork,
+                                                                    lwork,
+                                                                    dinfo,
+                                                                    bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                    STRIDED,
+                                                                    handle,
+                                                                    hipsolverFillMode_t(-1),
+                                                                    n,
+                                                                    k,
+                                                                    dA,
+                                                                    lda,
+                                                                    stA,
+                                                                    dV,
+                                                                    ldv,
+                                                                    stV,
+                                                                    dWork,
+                                                                    lwork,
+                                                                    dinfo,
+                                                                    bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                    STRIDED,
+                                                                    handle,
+                                                                    uplo,
+                                                                    n,
+                                                                    k,
+                                                                    (T) nullptr,
+                                                                    lda,
+                                                                    stA,
+                                                                    dV,
+                                                                    ldv,
+                                                                    stV,
+                                                                    dWork,
+                                                                    lwork,
+                                                                    dinfo,
+                                                                    bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                    STRIDED,
+                                                                    handle,
+                                                                    uplo,
+                                                                    n,
+                                                                    k,
+                                                                    dA,
+                                                                    lda,
+                                                                    stA,
+                                                                    (T) nullptr,
+                                                                    ldv,
+                                                                    stV,
+                                                                    dWork,
+                                                                    lwork,
+                                                                    dinfo,
+                                                                    bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                    STRIDED,
+                                                                    handle,
+                                                                    uplo,
+                                                                    n,
+                                                                    k,
+                                                                    dA,
+                                                                    lda,
+                                                                    stA,
+                                                                    dV,
+                                                                    ldv,
+                                                                    stV,
+                                                                    dWork,
+                                                                    lwork,
+                                                                    (V) nullptr,
+                                                                    bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, bool DOWNDATE, typename T>
+void testing_potrf_update_downdate_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    n    = 1;
+    int                    k    = 1;
+    int                    lda  = 1;
+    int                    ldv  = 1;
+    int                    stA  = 1;
+    int                    stV  = 1;
+    int                    bc   = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_batch_vector<T>           dV(1, 1, 1);
+        device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        int size_W;
+        hipsolver_potrf_update_downdate_bufferSize<DOWNDATE>(API,
+                                                             STRIDED,
+                                                             handle,
+                                                             uplo,
+                                                             n,
+                                                             k,
+                                                             dA.data(),
+                                                             lda,
+                                                             stA,
+                                                             dV.data(),
+                                                             ldv,
+                                                             stV,
+                                                             &size_W,
+                                                             bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        potrf_update_checkBadArgs<API, STRIDED, DOWNDATE>(handle,
+                                                          uplo,
+                                                          n,
+                                                          k,
+                                                          dA.data(),
+                                                          lda,
+                                                          stA,
+                                                          dV.data(),
+                                                          ldv,
+                                                          stV,
+                                                          dWork.data(),
+                                                          size_W,
+                                                          dinfo.data(),
+                                                          bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dV(1, 1, 1, 1);
+        device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        int size_W;
+        hipsolver_potrf_update_downdate_bufferSize<DOWNDATE>(API,
+                                                             STRIDED,
+                                                             handle,
+                                                             uplo,
+                                                             n,
+                                                             k,
+                                                             dA.data(),
+                                                             lda,
+                                                             stA,
+                                                             dV.data(),
+                                                             ldv,
+                                                             stV,
+                                                             &size_W,
+                                                             bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        potrf_update_checkBadArgs<API, STRIDED, DOWNDATE>(handle,
+                                                          uplo,
+                                                          n,
+                                                          k,
+                                                          dA.data(),
+                                                          lda,
+                                                          stA,
+                                                          dV.data(),
+                                                          ldv,
+                                                          stV,
+                                                          dWork.data(),
+                                                          size_W,
+                                                          dinfo.data(),
+                                                          bc);
+    }
+}
+
+template <bool CPU,
+          bool GPU,
+          bool DOWNDATE,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void potrf_update_initData(const hipsolverHandle_t   handle,
+                           const hipsolverFillMode_t uplo,
+                           const int                 n,
+                           const int                 k,
+                           Td&                       dA,
+                           const int                 lda,
+                           Td&                       dV,
+                           const int                 ldv,
+                           Ud&                       dInfo,
+                           const int                 bc,
+                           Th&                       hA,
+                           Th&                       hV,
+                           Th&                       hAExp,
+                           Uh&                       hInfo,
+                           const bool                singular,
+                           Th*                       hM = nullptr)
+{
+    if(CPU)
+    {
+        int info;
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hV, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale to ensure positive definiteness of the base matrix B
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] = hA[b][i + i * lda] * conj(hA[b][i + i * lda]) * 400;
+
+            // when singular, the last column of V removes more than B(0,0) from the
+            // leading diagonal element, so the downdated matrix is not positive definite
+            int kk = k;
+            if(singular && DOWNDATE)
+            {
+                kk = k - 1;
+                for(rocblas_int i = 0; i < n; i++)
+                    hV[b][i + kk * ldv] = T(0);
+                hV[b][kk * ldv] = hA[b][0];
+            }
+
+            // the update goes from B to B + V*V', and the downdate from B + V*V' to B
+            for(rocblas_int i = 0; i < lda * n; i++)
+                hAExp[b][i] = hA[b][i];
+            cblas_gemm<T>(HIPSOLVER_OP_N,
+                          HIPSOLVER_OP_C,
+                          n,
+                          n,
+                          kk,
+                          T(1),
+                          hV[b],
+                          ldv,
+                          hV[b],
+                          ldv,
+                          T(1),
+                          DOWNDATE ? hA[b] : hAExp[b],
+                          lda);
+
+            // keep the modified matrix when it is to be refactorized for comparison
+            if(hM)
+                for(rocblas_int i = 0; i < lda * n; i++)
+                    (*hM)[b][i] = hAExp[b][i];
+
+            // the input is the Cholesky factor of the initial matrix
+            cblas_potrf<T>(uplo, n, hA[b], lda, &info);
+            cblas_potrf<T>(uplo, n, hAExp[b], lda, hInfo[b]);
+            if(singular && DOWNDATE)
+                hInfo[b][0] = k;
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dV.transfer_from(hV));
+    }
+}
+
+template <testAPI_t API,
+          bool      STRIDED,
+          bool      DOWNDATE,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void potrf_update_getError(const hipsolverHandle_t   handle,
+                           const hipsolverFillMode_t uplo,
+                           const int                 n,
+                           const int                 k,
+                           Td&                       dA,
+                           const int                 lda,
+                           const int                 stA,
+                           Td&                       dV,
+                           const int                 ldv,
+                           const int                 stV,
+                           Vd&                       dWork,
+                           const int                 lwork,
+                           Ud&                       dInfo,
+                           const int                 bc,
+                           Th&                       hA,
+                           Th&                       hARes,
+                           Th&                       hV,
+                           Th&                       hAExp,
+                           Uh&                       hInfo,
+                           Uh&                       hInfoRes,
+                           const bool                singular,
+                           double*                   max_err)
+{
+    // input data initialization
+    potrf_update_initData<true, true, DOWNDATE, T>(
+        handle, uplo, n, k, dA, lda, dV, ldv, dInfo, bc, hA, hV, hAExp, hInfo, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                  STRIDED,
+                                                                  handle,
+                                                                  uplo,
+                                                                  n,
+                                                                  k,
+                                                                  dA.data(),
+                                                                  lda,
+                                                                  stA,
+                                                                  dV.data(),
+                                                                  ldv,
+                                                                  stV,
+                                                                  dWork.data(),
+                                                                  lwork,
+                                                                  dInfo.data(),
+                                                                  bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // (the reference is the Cholesky factorization of the modified matrix,
+    // computed in potrf_update_initData)
+
+    // error is ||hAExp - hARes|| / ||hAExp||
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        if(hInfoRes[b][0] != 0)
+            continue;
+
+        if(uplo == HIPSOLVER_FILL_MODE_UPPER)
+            err = norm_error_upperTr('F', n, n, lda, hAExp[b], hARes[b]);
+        else
+            err = norm_error_lowerTr('F', n, n, lda, hAExp[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for non positive definite cases
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          bool      BATCHED,
+          bool      STRIDED,
+          bool      DOWNDATE,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void potrf_update_getPerfData(const hipsolverHandle_t   handle,
+                              const hipsolverFillMode_t uplo,
+                              const int                 n,
+                              const int                 k,
+                              Td&                       dA,
+                              const int                 lda,
+                              const int                 stA,
+                              Td&                       dV,
+                              const int                 ldv,
+                              const int                 stV,
+                              Vd&                       dWork,
+                              const int                 lwork,
+                              Ud&                       dInfo,
+                              const int                 bc,
+                              Th&                       hA,
+                              Th&                       hV,
+                              Th&                       hAExp,
+                              Uh&                       hInfo,
+                              Td&                       dM,
+                              Th&                       hM,
+                              const bool                singular,
+                              double*                   gpu_time_used,
+                              double*                   cpu_time_used,
+                              double*                   potrf_time_used,
+                              const int                 hot_calls,
+                              const bool                perf)
+{
+    if(!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no update routine in LAPACK; time the factorization of the
+        // modified matrix instead)
+        potrf_update_initData<true, false, DOWNDATE, T>(
+            handle, uplo, n, k, dA, lda, dV, ldv, dInfo, bc, hA, hV, hAExp, hInfo, singular);
+
+        {
+            hipsolver_serial_host_guard serial;
+            *cpu_time_used = get_time_us_no_sync();
+            cblas_batched(bc, [&](int b) {
+                cblas_potrf<T>(uplo, n, hAExp[b], lda, hInfo[b]);
+            });
+            *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+        }
+
+        // gpu performance of refactorizing the modified matrix with potrf, for comparison
+        // (potrfBatched for arrays of pointers, otherwise one potrf call per problem)
+        potrf_update_initData<true, false, DOWNDATE, T>(
+            handle, uplo, n, k, dA, lda, dV, ldv, dInfo, bc, hA, hV, hAExp, hInfo, singular, &hM);
+
+        int size_WP;
+        hipsolver_potrf_bufferSize(
+            API, handle, uplo, n, dM.data(), lda, &size_WP, BATCHED ? bc : 1);
+        device_strided_batch_vector<T> dWorkP(size_WP, 1, size_WP, 1);
+        if(size_WP)
+            CHECK_HIP_ERROR(dWorkP.memcheck());
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+        hipsolver_perf_timer timer(stream);
+
+        for(int iter = 0; timer.more(iter, hot_calls); iter++)
+        {
+            CHECK_HIP_ERROR(dM.transfer_from(hM));
+
+            timer.start();
+            if(BATCHED)
+                hipsolver_potrf(API,
+                                handle,
+                                uplo,
+                                n,
+                                dM.data(),
+                                lda,
+                                stA,
+                                dWorkP.data(),
+                                size_WP,
+                                dInfo.data(),
+                                bc);
+            else
+                for(int b = 0; b < bc; ++b)
+                    hipsolver_potrf(
+                        API, handle, uplo, n, dM[b], lda, stA, dWorkP.data(), size_WP, dInfo[b], 1);
+            timer.stop();
+        }
+        *potrf_time_used = timer.finish();
+    }
+
+    potrf_update_initData<true, false, DOWNDATE, T>(
+        handle, uplo, n, k, dA, lda, dV, ldv, dInfo, bc, hA, hV, hAExp, hInfo, singular);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        potrf_update_initData<false, true, DOWNDATE, T>(
+            handle, uplo, n, k, dA, lda, dV, ldv, dInfo, bc, hA, hV, hAExp, hInfo, singular);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                      STRIDED,
+                                                                      handle,
+                                                                      uplo,
+                                                                      n,
+                                                                      k,
+                                                                      dA.data(),
+                                                                      lda,
+                                                                      stA,
+                                                                      dV.data(),
+                                                                      ldv,
+                                                                      stV,
+                                                                      dWork.data(),
+                                                                      lwork,
+                                                                      dInfo.data(),
+                                                                      bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        potrf_update_initData<false, true, DOWNDATE, T>(
+            handle, uplo, n, k, dA, lda, dV, ldv, dInfo, bc, hA, hV, hAExp, hInfo, singular);
+
+        timer.start();
+        hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                  STRIDED,
+                                                  handle,
+                                                  uplo,
+                                                  n,
+                                                  k,
+                                                  dA.data(),
+                                                  lda,
+                                                  stA,
+                                                  dV.data(),
+                                                  ldv,
+                                                  stV,
+                                                  dWork.data(),
+                                                  lwork,
+                                                  dInfo.data(),
+                                                  bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, bool DOWNDATE, typename T>
+void testing_potrf_update_downdate(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    k     = argus.get<int>("k", 1);
+    int                    lda   = argus.get<int>("lda", n);
+    int                    ldv   = argus.get<int>("ldv", n);
+    int                    stA   = argus.get<int>("strideA", lda * n);
+    int                    stV   = argus.get<int>("strideV", ldv * k);
+    int                    bc    = argus.batch_count;
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+    bool                singular  = DOWNDATE && argus.get<int>("singular", 0) && k > 0;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                            STRIDED,
+                                                                            handle,
+                                                                            uplo,
+                                                                            n,
+                                                                            k,
+                                                                            (T**)nullptr,
+                                                                            lda,
+                                                                            stA,
+                                                                            (T**)nullptr,
+                                                                            ldv,
+                                                                            stV,
+                                                                            (T*)nullptr,
+                                                                            0,
+                                                                            (int*)nullptr,
+                                                                            bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                            STRIDED,
+                                                                            handle,
+                                                                            uplo,
+                                                                            n,
+                                                                            k,
+                                                                            (T*)nullptr,
+                                                                            lda,
+                                                                            stA,
+                                                                            (T*)nullptr,
+                                                                            ldv,
+                                                                            stV,
+                                                                            (T*)nullptr,
+                                                                            0,
+                                                                            (int*)nullptr,
+                                                                            bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_V    = size_t(ldv) * k;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, potrf_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_M    = (argus.timing && !argus.perf) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || k < 0 || lda < n || lda < 1 || ldv < n || ldv < 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                            STRIDED,
+                                                                            handle,
+                                                                            uplo,
+                                                                            n,
+                                                                            k,
+                                                                            (T**)nullptr,
+                                                                            lda,
+                                                                            stA,
+                                                                            (T**)nullptr,
+                                                                            ldv,
+                                                                            stV,
+                                                                            (T*)nullptr,
+                                                                            0,
+                                                                            (int*)nullptr,
+                                                                            bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrf_update_downdate<DOWNDATE>(API,
+                                                                            STRIDED,
+                                                                            handle,
+                                                                            uplo,
+                                                                            n,
+                                                                            k,
+                                                                            (T*)nullptr,
+                                                                            lda,
+                                                                            stA,
+                                                                            (T*)nullptr,
+                                                                            ldv,
+                                                                            stV,
+                                                                            (T*)nullptr,
+                                                                            0,
+                                                                            (int*)nullptr,
+                                                                            bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc);
+        host_batch_vector<T>             hV(size_V, 1, bc);
+        host_batch_vector<T>             hAExp(size_A, 1, bc);
+        host_batch_vector<T>             hM(size_M, 1, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_batch_vector<T>           dV(size_V, 1, bc);
+        device_batch_vector<T>           dM(size_M, 1, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_M)
+            CHECK_HIP_ERROR(dM.memcheck());
+        if(size_V)
+            CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_potrf_update_downdate_bufferSize<DOWNDATE>(API,
+                                                             STRIDED,
+                                                             handle,
+                                                             uplo,
+                                                             n,
+                                                             k,
+                                                             dA.data(),
+                                                             lda,
+                                                             stA,
+                                                             dV.data(),
+                                                             ldv,
+                                                             stV,
+                                                             &size_W,
+                                                             bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potrf_update_getError<API, STRIDED, DOWNDATE, T>(handle,
+                                                             uplo,
+                                                             n,
+                                                             k,
+                                                             dA,
+                                                             lda,
+                                                             stA,
+                                                             dV,
+                                                             ldv,
+                                                             stV,
+                                                             dWork,
+                                                             size_W,
+                                                             dInfo,
+                                                             bc,
+                                                             hA,
+                                                             hARes,
+                                                             hV,
+                                                             hAExp,
+                                                             hInfo,
+                                                             hInfoRes,
+                                                             singular,
+                                                             &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            potrf_update_getPerfData<API, BATCHED, STRIDED, DOWNDATE, T>(handle,
+                                                                         uplo,
+                                                                         n,
+                                                                         k,
+                                                                         dA,
+                                                                         lda,
+                                                                         stA,
+                                                                         dV,
+                                                                         ldv,
+                                                                         stV,
+                                                                         dWork,
+                                                                         size_W,
+                                                                         dInfo,
+                                                                         bc,
+                                                                         hA,
+                                                                         hV,
+                                                                         hAExp,
+                                                                         hInfo,
+                                                                         dM,
+                                                                         hM,
+                                                                         singular,
+                                                                         &gpu_time_used,
+                                                                         &cpu_time_used,
+                                                                         &potrf_time_used,
+                                                                         hot_calls,
+                                                                         argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T>     hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>     hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T>     hV(size_V, 1, stV, bc);
+        host_strided_batch_vector<T>     hAExp(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>     hM(size_M, 1, stA, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T>   dV(size_V, 1, stV, bc);
+        device_strided_batch_vector<T>   dM(size_M, 1, stA, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_M)
+            CHECK_HIP_ERROR(dM.memcheck());
+        if(size_V)
+            CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_potrf_update_downdate_bufferSize<DOWNDATE>(API,
+                                                             STRIDED,
+                                                             handle,
+                                                             uplo,
+                                                             n,
+                                                             k,
+                                                             dA.data(),
+                                                             lda,
+                                                             stA,
+                                                             dV.data(),
+                                                             ldv,
+                                                             stV,
+                                                             &size_W,
+                                                             bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potrf_update_getError<API, STRIDED, DOWNDATE, T>(handle,
+                                                             uplo,
+                                                             n,
+                                                             k,
+                                                             dA,
+                                                             lda,
+                                                             stA,
+                                                             dV,
+                                                             ldv,
+                                                             stV,
+                                                             dWork,
+                                                             size_W,
+                                                             dInfo,
+                                                             bc,
+                                                             hA,
+                                                             hARes,
+                                                             hV,
+                                                             hAExp,
+                                                             hInfo,
+                                                             hInfoRes,
+                                                             singular,
+                                                             &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            potrf_update_getPerfData<API, BATCHED, STRIDED, DOWNDATE, T>(handle,
+                                                                         uplo,
+                                                                         n,
+                                                                         k,
+                                                                         dA,
+                                                                         lda,
+                                                                         stA,
+                                                                         dV,
+                                                                         ldv,
+                                                                         stV,
+                                                                         dWork,
+                                                                         size_W,
+                                                                         dInfo,
+                                                                         bc,
+                                                                         hA,
+                                                                         hV,
+                                                                         hAExp,
+                                                                         hInfo,
+                                                                         dM,
+                                                                         hM,
+                                                                         singular,
+                                                                         &gpu_time_used,
+                                                                         &cpu_time_used,
+                                                                         &potrf_time_used,
+                                                                         hot_calls,
+                                                                         argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * k * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n * k);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "k", "lda", "ldv", "batch_c");
+                rocsolver_bench_output(uploC, n, k, lda, ldv, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output(
+                    "uplo", "n", "k", "lda", "ldv", "strideA", "strideV", "batch_c");
+                rocsolver_bench_output(uploC, n, k, lda, ldv, stA, stV, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "k", "lda", "ldv");
+                rocsolver_bench_output(uploC, n, k, lda, ldv);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "potrf_gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, potrf_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "potrf_gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, potrf_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_potrf_update(Arguments& argus)
+{
+    testing_potrf_update_downdate<API, BATCHED, STRIDED, false, T>(argus);
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_potrf_downdate(Arguments& argus)
+{
+    testing_potrf_update_downdate<API, BATCHED, STRIDED, true, T>(argus);
+}
@@ -0,0 +1,495 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_getrf_vbatched.hpp"
+
+template <testAPI_t API, typename T, typename U, typename V>
+void potrf_vbatched_checkBadArgs(const hipsolverHandle_t   handle,
+                                 const hipsolverFillMode_t uplo,
+                                 V                         dN,
+                                 T                         dA,
+                                 V                         dLda,
+                                 U                         dWork,
+                                 const int                 lwork,
+                                 V                         dinfo,
+                                 const int                 bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_vbatched(API, nullptr, uplo, dN, dA, dLda, dWork, lwork, dinfo, bc),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_vbatched(API,
+                                                   handle,
+                                                   hipsolverFillMode_t(-1),
+                                                   dN,
+                                                   dA,
+                                                   dLda,
+                                                   dWork,
+                                                   lwork,
+                                                   dinfo,
+                                                   bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // sizes
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_vbatched(API, handle, uplo, dN, dA, dLda, dWork, lwork, dinfo, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_vbatched(API, handle, uplo, (V) nullptr, dA, dLda, dWork, lwork, dinfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_vbatched(API, handle, uplo, dN, (T) nullptr, dLda, dWork, lwork, dinfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_vbatched(API, handle, uplo, dN, dA, (V) nullptr, dWork, lwork, dinfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrf_vbatched(API, handle, uplo, dN, dA, dLda, dWork, lwork, (V) nullptr, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrf_vbatched(API,
+                                                   handle,
+                                                   uplo,
+                                                   (V) nullptr,
+                                                   (T) nullptr,
+                                                   (V) nullptr,
+                                                   dWork,
+                                                   lwork,
+                                                   (V) nullptr,
+                                                   0),
+                          HIPSOLVER_STATUS_SUCCESS);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_potrf_vbatched_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    bc   = 1;
+
+    // memory allocations
+    host_strided_batch_vector<int>   hOne(1, 1, 1, 1);
+    device_strided_batch_vector<int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<int> dLda(1, 1, 1, 1);
+    device_batch_vector<T>           dA(1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    hOne[0][0] = 1;
+    CHECK_HIP_ERROR(dN.transfer_from(hOne));
+    CHECK_HIP_ERROR(dLda.transfer_from(hOne));
+
+    int size_W;
+    hipsolver_potrf_vbatched_bufferSize(
+        API, handle, uplo, dN.data(), dA.data(), dLda.data(), &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    potrf_vbatched_checkBadArgs<API>(
+        handle, uplo, dN.data(), dA.data(), dLda.data(), dWork.data(), size_W, dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void potrf_vbatched_initData(const hipsolverHandle_t handle,
+                             const int               n,
+                             Td&                     dA,
+                             const int               lda,
+                             const int               bc,
+                             Th&                     hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(int b = 0; b < bc; ++b)
+        {
+            // scale to ensure positive definiteness
+            for(int i = 0; i < vbatched_dim(n, b); i++)
+                hA[b][i + i * lda] = hA[b][i + i * lda] * conj(hA[b][i + i * lda]) * 400;
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void potrf_vbatched_getError(const hipsolverHandle_t   handle,
+                             const hipsolverFillMode_t uplo,
+                             const int                 n,
+                             Ud&                       dN,
+                             Td&                       dA,
+                             const int                 lda,
+                             Ud&                       dLda,
+                             Vd&                       dWork,
+                             const int                 lwork,
+                             Ud&                       dInfo,
+                             const int                 bc,
+                             Th&                       hA,
+                             Th&                       hARes,
+                             Uh&                       hInfo,
+                             Uh&                       hInfoRes,
+                             double*                   max_err)
+{
+    // input data initialization
+    potrf_vbatched_initData<true, true, T>(handle, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf_vbatched(API,
+                                                 handle,
+                                                 uplo,
+                                                 dN.data(),
+                                                 dA.data(),
+                                                 dLda.data(),
+                                                 dWork.data(),
+                                                 lwork,
+                                                 dInfo.data(),
+                                                 bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cblas_batched(bc, [&](int b) {
+        cblas_potrf<T>(uplo, vbatched_dim(n, b), hA[b], lda, hInfo[b]);
+    });
+
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LL' - Lres Lres'|| / ||LL'||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    int    nn;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        nn = hInfoRes[b][0] == 0 ? vbatched_dim(n, b) : hInfoRes[b][0];
+        if(uplo == HIPSOLVER_FILL_MODE_UPPER)
+            err = norm_error_upperTr('F', nn, nn, lda, hA[b], hARes[b]);
+        else
+            err = norm_error_lowerTr('F', nn, nn, lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for non positive definite cases
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void potrf_vbatched_getPerfData(const hipsolverHandle_t   handle,
+                                const hipsolverFillMode_t uplo,
+                                const int                 n,
+                                Ud&                       dN,
+                                Td&                       dA,
+                                const int                 lda,
+                                Ud&                       dLda,
+                                Vd&                       dWork,
+                                const int                 lwork,
+                                Ud&                       dInfo,
+                                const int                 bc,
+                                Th&                       hA,
+                                Uh&                       hInfo,
+                                double*                   gpu_time_used,
+                                double*                   cpu_time_used,
+                                const int                 hot_calls,
+                                const bool                perf)
+{
+    if(!perf)
+    {
+        potrf_vbatched_initData<true, false, T>(handle, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_batched(bc, [&](int b) {
+            cblas_potrf<T>(uplo, vbatched_dim(n, b), hA[b], lda, hInfo[b]);
+        });
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrf_vbatched_initData<true, false, T>(handle, n, dA, lda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        potrf_vbatched_initData<false, true, T>(handle, n, dA, lda, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potrf_vbatched(API,
+                                                     handle,
+                                                     uplo,
+                                                     dN.data(),
+                                                     dA.data(),
+                                                     dLda.data(),
+                                                     dWork.data(),
+                                                     lwork,
+                                                     dInfo.data(),
+                                                     bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        potrf_vbatched_initData<false, true, T>(handle, n, dA, lda, bc, hA);
+
+        timer.start();
+        hipsolver_potrf_vbatched(API,
+                                 handle,
+                                 uplo,
+                                 dN.data(),
+                                 dA.data(),
+                                 dLda.data(),
+                                 dWork.data(),
+                                 lwork,
+                                 dInfo.data(),
+                                 bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, typename T>
+void testing_potrf_vbatched(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    lda   = argus.get<int>("lda", n);
+    int                    bc    = argus.batch_count;
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_potrf_vbatched(API,
+                                                       handle,
+                                                       uplo,
+                                                       (int*)nullptr,
+                                                       (T**)nullptr,
+                                                       (int*)nullptr,
+                                                       (T*)nullptr,
+                                                       0,
+                                                       (int*)nullptr,
+                                                       bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    // n and lda are the largest dimensions of the batch
+    size_t size_A    = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || lda < 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(bc >= 0)
+        {
+            host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+            device_strided_batch_vector<int> dN(1, 1, 1, bc);
+            device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+            device_batch_vector<T>           dA(1, 1, bc);
+            device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+            vbatched_dims(n, bc, hN);
+            vbatched_dims(lda, bc, hLda);
+            CHECK_HIP_ERROR(dN.transfer_from(hN));
+            CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrf_vbatched(API,
+                                                           handle,
+                                                           uplo,
+                                                           dN.data(),
+                                                           dA.data(),
+                                                           dLda.data(),
+                                                           (T*)nullptr,
+                                                           0,
+                                                           dInfo.data(),
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrf_vbatched(API,
+                                                           handle,
+                                                           uplo,
+                                                           (int*)nullptr,
+                                                           (T**)nullptr,
+                                                           (int*)nullptr,
+                                                           (T*)nullptr,
+                                                           0,
+                                                           (int*)nullptr,
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+    host_batch_vector<T>             hA(size_A, 1, bc);
+    host_batch_vector<T>             hARes(size_ARes, 1, bc);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+    device_batch_vector<T>           dA(size_A, 1, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(bc)
+    {
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+    }
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+
+    // all the problems share lda, which is valid for the largest one
+    vbatched_dims(n, bc, hN);
+    for(int b = 0; b < bc; b++)
+        hLda[b][0] = lda;
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+    int size_W;
+    hipsolver_potrf_vbatched_bufferSize(
+        API, handle, uplo, dN.data(), dA.data(), dLda.data(), &size_W, bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrf_vbatched_getError<API, T>(handle,
+                                        uplo,
+                                        n,
+                                        dN,
+                                        dA,
+                                        lda,
+                                        dLda,
+                                        dWork,
+                                        size_W,
+                                        dInfo,
+                                        bc,
+                                        hA,
+                                        hARes,
+                                        hInfo,
+                                        hInfoRes,
+                                        &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        potrf_vbatched_getPerfData<API, T>(handle,
+                                           uplo,
+                                           n,
+                                           dN,
+                                           dA,
+                                           lda,
+                                           dLda,
+                                           dWork,
+                                           size_W,
+                                           dInfo,
+                                           bc,
+                                           hA,
+                                           hInfo,
+                                           &gpu_time_used,
+                                           &cpu_time_used,
+                                           hot_calls,
+                                           argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "max_n", "lda", "batch_c");
+            rocsolver_bench_output(uploC, n, lda, bc);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -151,8 +151,9 @@ void potri_getError(const hipsolverHandle_t   handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
+    cblas_batched(bc, [&](int b) {
         cblas_potri<T>(uplo, n, hA[b], lda, hInfo[b]);
+    });
 
     // check info for singularities
     double err = 0;
@@ -204,16 +205,18 @@ void potri_getPerfData(const hipsolverHandle_t   handle,
         potri_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < bc; ++b)
+        cblas_batched(bc, [&](int b) {
             cblas_potri<T>(uplo, n, hA[b], lda, hInfo[b]);
+        });
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
     potri_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         potri_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo);
 
@@ -224,18 +227,18 @@ void potri_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         potri_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_potri(
             FORTRAN, handle, uplo, n, dA.data(), lda, stA, dWork.data(), lwork, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
@@ -255,10 +255,9 @@ void potrs_getError(const hipsolverHandle_t   handle,
     CHECK_HIP_ERROR(hBRes.transfer_from(dB));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-    {
+    cblas_batched(bc, [&](int b) {
         cblas_potrs<T>(uplo, n, nrhs, hA[b], lda, hB[b], ldb);
-    }
+    });
 
     // error is ||hB - hBRes|| / ||hB||
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
@@ -308,18 +307,18 @@ void potrs_getPerfData(const hipsolverHandle_t   handle,
             handle, uplo, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < bc; ++b)
-        {
+        cblas_batched(bc, [&](int b) {
             cblas_potrs<T>(uplo, n, nrhs, hA[b], lda, hB[b], ldb);
-        }
+        });
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
     potrs_initData<true, false, T>(handle, uplo, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         potrs_initData<false, true, T>(
             handle, uplo, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
@@ -344,14 +343,14 @@ void potrs_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         potrs_initData<false, true, T>(
             handle, uplo, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_potrs(API,
                         handle,
                         uplo,
@@ -367,9 +366,9 @@ void potrs_getPerfData(const hipsolverHandle_t   handle,
                         lwork,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
@@ -0,0 +1,606 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_getrf_vbatched.hpp"
+
+template <testAPI_t API, typename T, typename U, typename V>
+void potrs_vbatched_checkBadArgs(const hipsolverHandle_t   handle,
+                                 const hipsolverFillMode_t uplo,
+                                 V                         dN,
+                                 V                         dNrhs,
+                                 T                         dA,
+                                 V                         dLda,
+                                 T                         dB,
+                                 V                         dLdb,
+                                 U                         dWork,
+                                 const int                 lwork,
+                                 V                         dInfo,
+                                 const int                 bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrs_vbatched(
+                              API, nullptr, uplo, dN, dNrhs, dA, dLda, dB, dLdb, dWork, lwork, dInfo, bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrs_vbatched(API,
+                                                   handle,
+                                                   hipsolverFillMode_t(-1),
+                                                   dN,
+                                                   dNrhs,
+                                                   dA,
+                                                   dLda,
+                                                   dB,
+                                                   dLdb,
+                                                   dWork,
+                                                   lwork,
+                                                   dInfo,
+                                                   bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // sizes
+    EXPECT_ROCBLAS_STATUS(hipsolver_potrs_vbatched(
+                              API, handle, uplo, dN, dNrhs, dA, dLda, dB, dLdb, dWork, lwork, dInfo, -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_vbatched(
+            API, handle, uplo, (V) nullptr, dNrhs, dA, dLda, dB, dLdb, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_vbatched(
+            API, handle, uplo, dN, (V) nullptr, dA, dLda, dB, dLdb, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_vbatched(
+            API, handle, uplo, dN, dNrhs, (T) nullptr, dLda, dB, dLdb, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_vbatched(
+            API, handle, uplo, dN, dNrhs, dA, (V) nullptr, dB, dLdb, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_vbatched(
+            API, handle, uplo, dN, dNrhs, dA, dLda, (T) nullptr, dLdb, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potrs_vbatched(
+            API, handle, uplo, dN, dNrhs, dA, dLda, dB, (V) nullptr, dWork, lwork, dInfo, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_potrs_vbatched_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    bc   = 1;
+
+    // memory allocations
+    host_strided_batch_vector<int>   hOne(1, 1, 1, 1);
+    device_strided_batch_vector<int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<int> dNrhs(1, 1, 1, 1);
+    device_strided_batch_vector<int> dLda(1, 1, 1, 1);
+    device_strided_batch_vector<int> dLdb(1, 1, 1, 1);
+    device_batch_vector<T>           dA(1, 1, 1);
+    device_batch_vector<T>           dB(1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    hOne[0][0] = 1;
+    CHECK_HIP_ERROR(dN.transfer_from(hOne));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hOne));
+    CHECK_HIP_ERROR(dLda.transfer_from(hOne));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hOne));
+
+    int size_W;
+    hipsolver_potrs_vbatched_bufferSize(API,
+                                        handle,
+                                        uplo,
+                                        dN.data(),
+                                        dNrhs.data(),
+                                        dA.data(),
+                                        dLda.data(),
+                                        dB.data(),
+                                        dLdb.data(),
+                                        &size_W,
+                                        bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    potrs_vbatched_checkBadArgs<API>(handle,
+                                     uplo,
+                                     dN.data(),
+                                     dNrhs.data(),
+                                     dA.data(),
+                                     dLda.data(),
+                                     dB.data(),
+                                     dLdb.data(),
+                                     dWork.data(),
+                                     size_W,
+                                     dInfo.data(),
+                                     bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void potrs_vbatched_initData(const hipsolverHandle_t   handle,
+                             const hipsolverFillMode_t uplo,
+                             const int                 n,
+                             Td&                       dA,
+                             const int                 lda,
+                             Td&                       dB,
+                             const int                 bc,
+                             Th&                       hA,
+                             Th&                       hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+        int info;
+
+        for(int b = 0; b < bc; ++b)
+        {
+            int nb = vbatched_dim(n, b);
+
+            // scale to ensure positive definiteness
+            for(int i = 0; i < nb; i++)
+                hA[b][i + i * lda] = hA[b][i + i * lda] * conj(hA[b][i + i * lda]) * 400;
+
+            // do the Cholesky factorization of matrix A w/ the reference LAPACK routine
+            cblas_potrf<T>(uplo, nb, hA[b], lda, &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void potrs_vbatched_getError(const hipsolverHandle_t   handle,
+                             const hipsolverFillMode_t uplo,
+                             const int                 n,
+                             const int                 nrhs,
+                             Ud&                       dN,
+                             Ud&                       dNrhs,
+                             Td&                       dA,
+                             const int                 lda,
+                             Ud&                       dLda,
+                             Td&                       dB,
+                             const int                 ldb,
+                             Ud&                       dLdb,
+                             Vd&                       dWork,
+                             const int                 lwork,
+                             Ud&                       dInfo,
+                             const int                 bc,
+                             Th&                       hA,
+                             Th&                       hB,
+                             Th&                       hBRes,
+                             Uh&                       hInfoRes,
+                             double*                   max_err)
+{
+    // input data initialization
+    potrs_vbatched_initData<true, true, T>(handle, uplo, n, dA, lda, dB, bc, hA, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_potrs_vbatched(API,
+                                                 handle,
+                                                 uplo,
+                                                 dN.data(),
+                                                 dNrhs.data(),
+                                                 dA.data(),
+                                                 dLda.data(),
+                                                 dB.data(),
+                                                 dLdb.data(),
+                                                 dWork.data(),
+                                                 lwork,
+                                                 dInfo.data(),
+                                                 bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cblas_batched(bc, [&](int b) {
+        cblas_potrs<T>(uplo, vbatched_dim(n, b), vbatched_dim(nrhs, b), hA[b], lda, hB[b], ldb);
+    });
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err = norm_error('I', vbatched_dim(n, b), vbatched_dim(nrhs, b), ldb, hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // the solve cannot fail, so info must be zero
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfoRes[b][0] != 0)
+            err++;
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th>
+void potrs_vbatched_getPerfData(const hipsolverHandle_t   handle,
+                                const hipsolverFillMode_t uplo,
+                                const int                 n,
+                                const int                 nrhs,
+                                Ud&                       dN,
+                                Ud&                       dNrhs,
+                                Td&                       dA,
+                                const int                 lda,
+                                Ud&                       dLda,
+                                Td&                       dB,
+                                const int                 ldb,
+                                Ud&                       dLdb,
+                                Vd&                       dWork,
+                                const int                 lwork,
+                                Ud&                       dInfo,
+                                const int                 bc,
+                                Th&                       hA,
+                                Th&                       hB,
+                                double*                   gpu_time_used,
+                                double*                   cpu_time_used,
+                                const int                 hot_calls,
+                                const bool                perf)
+{
+    if(!perf)
+    {
+        potrs_vbatched_initData<true, false, T>(handle, uplo, n, dA, lda, dB, bc, hA, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_batched(bc, [&](int b) {
+            cblas_potrs<T>(uplo, vbatched_dim(n, b), vbatched_dim(nrhs, b), hA[b], lda, hB[b], ldb);
+        });
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrs_vbatched_initData<true, false, T>(handle, uplo, n, dA, lda, dB, bc, hA, hB);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        potrs_vbatched_initData<false, true, T>(handle, uplo, n, dA, lda, dB, bc, hA, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potrs_vbatched(API,
+                                                     handle,
+                                                     uplo,
+                                                     dN.data(),
+                                                     dNrhs.data(),
+                                                     dA.data(),
+                                                     dLda.data(),
+                                                     dB.data(),
+                                                     dLdb.data(),
+                                                     dWork.data(),
+                                                     lwork,
+                                                     dInfo.data(),
+                                                     bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        potrs_vbatched_initData<false, true, T>(handle, uplo, n, dA, lda, dB, bc, hA, hB);
+
+        timer.start();
+        hipsolver_potrs_vbatched(API,
+                                 handle,
+                                 uplo,
+                                 dN.data(),
+                                 dNrhs.data(),
+                                 dA.data(),
+                                 dLda.data(),
+                                 dB.data(),
+                                 dLdb.data(),
+                                 dWork.data(),
+                                 lwork,
+                                 dInfo.data(),
+                                 bc);
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, typename T>
+void testing_potrs_vbatched(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    nrhs  = argus.get<int>("nrhs", n);
+    int                    lda   = argus.get<int>("lda", n);
+    int                    ldb   = argus.get<int>("ldb", n);
+    int                    bc    = argus.batch_count;
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_potrs_vbatched(API,
+                                                       handle,
+                                                       uplo,
+                                                       (int*)nullptr,
+                                                       (int*)nullptr,
+                                                       (T**)nullptr,
+                                                       (int*)nullptr,
+                                                       (T**)nullptr,
+                                                       (int*)nullptr,
+                                                       (T*)nullptr,
+                                                       0,
+                                                       (int*)nullptr,
+                                                       bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    // n, nrhs, lda and ldb are the largest dimensions of the batch
+    size_t size_A    = size_t(lda) * n;
+    size_t size_B    = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (n < 0 || nrhs < 0 || lda < n || lda < 1 || ldb < n || ldb < 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(bc >= 0)
+        {
+            host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hNrhs(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+            host_strided_batch_vector<int>   hLdb(1, 1, 1, bc);
+            device_strided_batch_vector<int> dN(1, 1, 1, bc);
+            device_strided_batch_vector<int> dNrhs(1, 1, 1, bc);
+            device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+            device_strided_batch_vector<int> dLdb(1, 1, 1, bc);
+            device_batch_vector<T>           dA(1, 1, bc);
+            device_batch_vector<T>           dB(1, 1, bc);
+            vbatched_dims(n, bc, hN);
+            vbatched_dims(nrhs, bc, hNrhs);
+            vbatched_dims(lda, bc, hLda);
+            vbatched_dims(ldb, bc, hLdb);
+            CHECK_HIP_ERROR(dN.transfer_from(hN));
+            CHECK_HIP_ERROR(dNrhs.transfer_from(hNrhs));
+            CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+            CHECK_HIP_ERROR(dLdb.transfer_from(hLdb));
+
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrs_vbatched(API,
+                                                           handle,
+                                                           uplo,
+                                                           dN.data(),
+                                                           dNrhs.data(),
+                                                           dA.data(),
+                                                           dLda.data(),
+                                                           dB.data(),
+                                                           dLdb.data(),
+                                                           (T*)nullptr,
+                                                           0,
+                                                           (int*)nullptr,
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_potrs_vbatched(API,
+                                                           handle,
+                                                           uplo,
+                                                           (int*)nullptr,
+                                                           (int*)nullptr,
+                                                           (T**)nullptr,
+                                                           (int*)nullptr,
+                                                           (T**)nullptr,
+                                                           (int*)nullptr,
+                                                           (T*)nullptr,
+                                                           0,
+                                                           (int*)nullptr,
+                                                           bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<int>   hN(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hNrhs(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hLda(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hLdb(1, 1, 1, bc);
+    host_batch_vector<T>             hA(size_A, 1, bc);
+    host_batch_vector<T>             hB(size_B, 1, bc);
+    host_batch_vector<T>             hBRes(size_BRes, 1, bc);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<int> dNrhs(1, 1, 1, bc);
+    device_strided_batch_vector<int> dLda(1, 1, 1, bc);
+    device_strided_batch_vector<int> dLdb(1, 1, 1, bc);
+    device_batch_vector<T>           dA(size_A, 1, bc);
+    device_batch_vector<T>           dB(size_B, 1, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(bc)
+    {
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dNrhs.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+        CHECK_HIP_ERROR(dLdb.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+    }
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+
+    // all the problems share lda and ldb, which are valid for the largest one
+    vbatched_dims(n, bc, hN);
+    vbatched_dims(nrhs, bc, hNrhs);
+    for(int b = 0; b < bc; b++)
+    {
+        hLda[b][0] = lda;
+        hLdb[b][0] = ldb;
+    }
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hNrhs));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hLdb));
+
+    int size_W;
+    hipsolver_potrs_vbatched_bufferSize(API,
+                                        handle,
+                                        uplo,
+                                        dN.data(),
+                                        dNrhs.data(),
+                                        dA.data(),
+                                        dLda.data(),
+                                        dB.data(),
+                                        dLdb.data(),
+                                        &size_W,
+                                        bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrs_vbatched_getError<API, T>(handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        dN,
+                                        dNrhs,
+                                        dA,
+                                        lda,
+                                        dLda,
+                                        dB,
+                                        ldb,
+                                        dLdb,
+                                        dWork,
+                                        size_W,
+                                        dInfo,
+                                        bc,
+                                        hA,
+                                        hB,
+                                        hBRes,
+                                        hInfoRes,
+                                        &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        potrs_vbatched_getPerfData<API, T>(handle,
+                                           uplo,
+                                           n,
+                                           nrhs,
+                                           dN,
+                                           dNrhs,
+                                           dA,
+                                           lda,
+                                           dLda,
+                                           dB,
+                                           ldb,
+                                           dLdb,
+                                           dWork,
+                                           size_W,
+                                           dInfo,
+                                           bc,
+                                           hA,
+                                           hB,
+                                           &gpu_time_used,
+                                           &cpu_time_used,
+                                           hot_calls,
+                                           argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "max_n", "max_nrhs", "lda", "ldb", "batch_c");
+            rocsolver_bench_output(uploC, n, nrhs, lda, ldb, bc);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
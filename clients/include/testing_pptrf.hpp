@@ -0,0 +1,358 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, typename T, typename U>
+void pptrf_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        T                         dAP,
+                        T                         dWork,
+                        const int                 lwork,
+                        U                         dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_pptrf(API, nullptr, uplo, n, dAP, dWork, lwork, dInfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pptrf(API, handle, hipsolverFillMode_t(-1), n, dAP, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_pptrf(API, handle, uplo, n, (T) nullptr, dWork, lwork, dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_pptrf(API, handle, uplo, n, dAP, dWork, lwork, (U) nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_pptrf_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    n    = 1;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dAP(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAP.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pptrf_bufferSize(API, handle, uplo, n, dAP.data(), &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    pptrf_checkBadArgs<API>(handle, uplo, n, dAP.data(), dWork.data(), size_W, dInfo.data());
+}
+
+// Copies the triangle of the full matrix A selected by uplo into the packed array AP,
+// following the LAPACK packed storage convention
+template <typename T>
+void pptrf_pack(const hipsolverFillMode_t uplo, const int n, const T* A, const int lda, T* AP)
+{
+    int k = 0;
+    for(int j = 0; j < n; j++)
+    {
+        int i0 = (uplo == HIPSOLVER_FILL_MODE_UPPER) ? 0 : j;
+        int i1 = (uplo == HIPSOLVER_FILL_MODE_UPPER) ? j + 1 : n;
+        for(int i = i0; i < i1; i++)
+            AP[k++] = A[i + j * lda];
+    }
+}
+
+// Fills hA with a random Hermitian positive definite matrix and hAP with its packed
+// triangle. The diagonal is scaled to ensure positive definiteness, unless the matrix
+// must be singular
+template <typename T, typename Th>
+void pptrf_initPacked(const hipsolverFillMode_t uplo,
+                      const int                 n,
+                      Th&                       hA,
+                      Th&                       hAP,
+                      const bool                singular)
+{
+    rocblas_init<T>(hA, true);
+
+    for(int i = 0; i < n; i++)
+        hA[0][i + i * n] = hA[0][i + i * n] * conj(hA[0][i + i * n]) * 400;
+
+    // make the matrix not positive definite
+    if(singular && n > 0)
+        hA[0][n / 2 + (n / 2) * n] = -hA[0][n / 2 + (n / 2) * n];
+
+    pptrf_pack(uplo, n, hA[0], n, hAP[0]);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void pptrf_initData(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    Td&                       dAP,
+                    Th&                       hA,
+                    Th&                       hAP,
+                    const bool                singular)
+{
+    if(CPU)
+        pptrf_initPacked<T>(uplo, n, hA, hAP, singular);
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+    }
+}
+
+template <testAPI_t API, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void pptrf_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    Td&                       dAP,
+                    Td&                       dWork,
+                    const int                 lwork,
+                    Ud&                       dInfo,
+                    Th&                       hA,
+                    Th&                       hAP,
+                    Th&                       hAPRes,
+                    Uh&                       hInfo,
+                    Uh&                       hInfoRes,
+                    double*                   max_err,
+                    const bool                singular)
+{
+    int size_P = n * (n + 1) / 2;
+
+    // input data initialization
+    pptrf_initData<true, true, T>(handle, uplo, n, dAP, hA, hAP, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(
+        hipsolver_pptrf(API, handle, uplo, n, dAP.data(), dWork.data(), lwork, dInfo.data()));
+    CHECK_HIP_ERROR(hAPRes.transfer_from(dAP));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // (the full-storage factorization is used as reference and then packed)
+    cblas_potrf<T>(uplo, n, hA[0], n, hInfo[0]);
+    pptrf_pack(uplo, n, hA[0], n, hAP[0]);
+
+    // error is ||hAP - hAPRes|| / ||hAP||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm over the packed storage; the factor of a matrix that is
+    // not positive definite is not compared
+    *max_err = 0;
+    if(hInfoRes[0][0] == 0)
+        *max_err = norm_error('F', size_P, 1, size_P, hAP[0], hAPRes[0]);
+
+    // also check info for non positive definite cases
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err += 1;
+}
+
+template <testAPI_t API, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void pptrf_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const int                 n,
+                       Td&                       dAP,
+                       Td&                       dWork,
+                       const int                 lwork,
+                       Ud&                       dInfo,
+                       Th&                       hA,
+                       Th&                       hAP,
+                       Uh&                       hInfo,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf,
+                       const bool                singular)
+{
+    if(!perf)
+    {
+        pptrf_initData<true, false, T>(handle, uplo, n, dAP, hA, hAP, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_potrf<T>(uplo, n, hA[0], n, hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pptrf_initData<true, false, T>(handle, uplo, n, dAP, hA, hAP, singular);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        pptrf_initData<false, true, T>(handle, uplo, n, dAP, hA, hAP, singular);
+
+        CHECK_ROCBLAS_ERROR(
+            hipsolver_pptrf(API, handle, uplo, n, dAP.data(), dWork.data(), lwork, dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        pptrf_initData<false, true, T>(handle, uplo, n, dAP, hA, hAP, singular);
+
+        timer.start();
+        hipsolver_pptrf(API, handle, uplo, n, dAP.data(), dWork.data(), lwork, dInfo.data());
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, typename T>
+void testing_pptrf(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+    bool                singular  = argus.get<int>("singular", 0) == 1;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_pptrf(API, handle, uplo, n, (T*)nullptr, (T*)nullptr, 0, (int*)nullptr),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(n) * n;
+    size_t size_P    = size_t(n) * (n + 1) / 2;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_pptrf(API, handle, uplo, n, (T*)nullptr, (T*)nullptr, 0, (int*)nullptr),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hAP(size_P, 1, size_P, 1);
+    host_strided_batch_vector<T>     hAPRes(size_PRes, 1, size_PRes, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dAP(size_P, 1, size_P, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    if(size_P)
+        CHECK_HIP_ERROR(dAP.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pptrf_bufferSize(API, handle, uplo, n, dAP.data(), &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        pptrf_getError<API, T>(handle,
+                               uplo,
+                               n,
+                               dAP,
+                               dWork,
+                               size_W,
+                               dInfo,
+                               hA,
+                               hAP,
+                               hAPRes,
+                               hInfo,
+                               hInfoRes,
+                               &max_error,
+                               singular);
+
+    // collect performance data
+    if(argus.timing)
+        pptrf_getPerfData<API, T>(handle,
+                                  uplo,
+                                  n,
+                                  dAP,
+                                  dWork,
+                                  size_W,
+                                  dInfo,
+                                  hA,
+                                  hAP,
+                                  hInfo,
+                                  &gpu_time_used,
+                                  &cpu_time_used,
+                                  hot_calls,
+                                  argus.perf,
+                                  singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "n");
+            rocsolver_bench_output(uploC, n);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -0,0 +1,383 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_pptrf.hpp"
+
+template <testAPI_t API, typename T, typename U>
+void pptrs_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        const int                 nrhs,
+                        T                         dAP,
+                        T                         dB,
+                        const int                 ldb,
+                        T                         dWork,
+                        const int                 lwork,
+                        U                         dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pptrs(API, nullptr, uplo, n, nrhs, dAP, dB, ldb, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_pptrs(API,
+                                          handle,
+                                          hipsolverFillMode_t(-1),
+                                          n,
+                                          nrhs,
+                                          dAP,
+                                          dB,
+                                          ldb,
+                                          dWork,
+                                          lwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pptrs(API, handle, uplo, n, nrhs, (T) nullptr, dB, ldb, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pptrs(API, handle, uplo, n, nrhs, dAP, (T) nullptr, ldb, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_pptrs(API, handle, uplo, n, nrhs, dAP, dB, ldb, dWork, lwork, (U) nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_pptrs_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    n    = 1;
+    int                    nrhs = 1;
+    int                    ldb  = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dAP(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAP.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pptrs_bufferSize(API, handle, uplo, n, nrhs, dAP.data(), dB.data(), ldb, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    pptrs_checkBadArgs<API>(
+        handle, uplo, n, nrhs, dAP.data(), dB.data(), ldb, dWork.data(), size_W, dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void pptrs_initData(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 nrhs,
+                    Td&                       dAP,
+                    Td&                       dB,
+                    const int                 ldb,
+                    Th&                       hA,
+                    Th&                       hAP,
+                    Th&                       hB)
+{
+    if(CPU)
+    {
+        pptrf_initPacked<T>(uplo, n, hA, hAP, false);
+        rocblas_init<T>(hB, true);
+        int info;
+
+        // do the Cholesky factorization of matrix A w/ the reference LAPACK routine
+        // and keep the factor in both full and packed storage
+        cblas_potrf<T>(uplo, n, hA[0], n, &info);
+        pptrf_pack(uplo, n, hA[0], n, hAP[0]);
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <testAPI_t API, typename T, typename Td, typename Ud, typename Th>
+void pptrs_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 nrhs,
+                    Td&                       dAP,
+                    Td&                       dB,
+                    const int                 ldb,
+                    Td&                       dWork,
+                    const int                 lwork,
+                    Ud&                       dInfo,
+                    Th&                       hA,
+                    Th&                       hAP,
+                    Th&                       hB,
+                    Th&                       hBRes,
+                    double*                   max_err)
+{
+    // input data initialization
+    pptrs_initData<true, true, T>(handle, uplo, n, nrhs, dAP, dB, ldb, hA, hAP, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_pptrs(API,
+                                        handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        dAP.data(),
+                                        dB.data(),
+                                        ldb,
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data()));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    cblas_potrs<T>(uplo, n, nrhs, hA[0], n, hB[0], ldb);
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    *max_err = norm_error('I', n, nrhs, ldb, hB[0], hBRes[0]);
+}
+
+template <testAPI_t API, typename T, typename Td, typename Ud, typename Th>
+void pptrs_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const int                 n,
+                       const int                 nrhs,
+                       Td&                       dAP,
+                       Td&                       dB,
+                       const int                 ldb,
+                       Td&                       dWork,
+                       const int                 lwork,
+                       Ud&                       dInfo,
+                       Th&                       hA,
+                       Th&                       hAP,
+                       Th&                       hB,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf)
+{
+    if(!perf)
+    {
+        pptrs_initData<true, false, T>(handle, uplo, n, nrhs, dAP, dB, ldb, hA, hAP, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_potrs<T>(uplo, n, nrhs, hA[0], n, hB[0], ldb);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pptrs_initData<true, false, T>(handle, uplo, n, nrhs, dAP, dB, ldb, hA, hAP, hB);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        pptrs_initData<false, true, T>(handle, uplo, n, nrhs, dAP, dB, ldb, hA, hAP, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_pptrs(API,
+                                            handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            dAP.data(),
+                                            dB.data(),
+                                            ldb,
+                                            dWork.data(),
+                                            lwork,
+                                            dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        pptrs_initData<false, true, T>(handle, uplo, n, nrhs, dAP, dB, ldb, hA, hAP, hB);
+
+        timer.start();
+        hipsolver_pptrs(API,
+                        handle,
+                        uplo,
+                        n,
+                        nrhs,
+                        dAP.data(),
+                        dB.data(),
+                        ldb,
+                        dWork.data(),
+                        lwork,
+                        dInfo.data());
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, typename T>
+void testing_pptrs(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    nrhs  = argus.get<int>("nrhs", n);
+    int                    ldb   = argus.get<int>("ldb", n);
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(n) * n;
+    size_t size_P    = size_t(n) * (n + 1) / 2;
+    size_t size_B    = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || ldb < n || ldb < 1);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_pptrs(API,
+                                              handle,
+                                              uplo,
+                                              n,
+                                              nrhs,
+                                              (T*)nullptr,
+                                              (T*)nullptr,
+                                              ldb,
+                                              (T*)nullptr,
+                                              0,
+                                              (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hAP(size_P, 1, size_P, 1);
+    host_strided_batch_vector<T>     hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T>     hBRes(size_BRes, 1, size_BRes, 1);
+    device_strided_batch_vector<T>   dAP(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T>   dB(size_B, 1, size_B, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    if(size_P)
+        CHECK_HIP_ERROR(dAP.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_pptrs_bufferSize(API, handle, uplo, n, nrhs, dAP.data(), dB.data(), ldb, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        pptrs_getError<API, T>(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               dAP,
+                               dB,
+                               ldb,
+                               dWork,
+                               size_W,
+                               dInfo,
+                               hA,
+                               hAP,
+                               hB,
+                               hBRes,
+                               &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        pptrs_getPerfData<API, T>(handle,
+                                  uplo,
+                                  n,
+                                  nrhs,
+                                  dAP,
+                                  dB,
+                                  ldb,
+                                  dWork,
+                                  size_W,
+                                  dInfo,
+                                  hA,
+                                  hAP,
+                                  hB,
+                                  &gpu_time_used,
+                                  &cpu_time_used,
+                                  hot_calls,
+                                  argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "n", "nrhs", "ldb");
+            rocsolver_bench_output(uploC, n, nrhs, ldb);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
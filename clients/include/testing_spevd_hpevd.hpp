@@ -0,0 +1,562 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_pptrf.hpp"
+
+template <testAPI_t API, typename T, typename S, typename U>
+void spevd_hpevd_checkBadArgs(const hipsolverHandle_t   handle,
+                              const hipsolverEigMode_t  evect,
+                              const hipsolverFillMode_t uplo,
+                              const int                 n,
+                              T                         dAP,
+                              S                         dD,
+                              T                         dZ,
+                              const int                 ldz,
+                              T                         dWork,
+                              const int                 lwork,
+                              U                         dinfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_spevd_hpevd(API, nullptr, evect, uplo, n, dAP, dD, dZ, ldz, dWork, lwork, dinfo),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_spevd_hpevd(API,
+                                                handle,
+                                                hipsolverEigMode_t(-1),
+                                                uplo,
+                                                n,
+                                                dAP,
+                                                dD,
+                                                dZ,
+                                                ldz,
+                                                dWork,
+                                                lwork,
+                                                dinfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_spevd_hpevd(API,
+                                                handle,
+                                                evect,
+                                                hipsolverFillMode_t(-1),
+                                                n,
+                                                dAP,
+                                                dD,
+                                                dZ,
+                                                ldz,
+                                                dWork,
+                                                lwork,
+                                                dinfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_spevd_hpevd(
+                              API, handle, evect, uplo, n, (T) nullptr, dD, dZ, ldz, dWork, lwork, dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_spevd_hpevd(
+                              API, handle, evect, uplo, n, dAP, (S) nullptr, dZ, ldz, dWork, lwork, dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_spevd_hpevd(API,
+                                                handle,
+                                                HIPSOLVER_EIG_MODE_VECTOR,
+                                                uplo,
+                                                n,
+                                                dAP,
+                                                dD,
+                                                (T) nullptr,
+                                                ldz,
+                                                dWork,
+                                                lwork,
+                                                dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_spevd_hpevd(
+                              API, handle, evect, uplo, n, dAP, dD, dZ, ldz, dWork, lwork, (U) nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_spevd_hpevd_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverEigMode_t     evect = HIPSOLVER_EIG_MODE_NOVECTOR;
+    hipsolverFillMode_t    uplo  = HIPSOLVER_FILL_MODE_LOWER;
+    int                    n     = 1;
+    int                    ldz   = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dAP(1, 1, 1, 1);
+    device_strided_batch_vector<S>   dD(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dZ(1, 1, 1, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAP.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dZ.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int size_W;
+    hipsolver_spevd_hpevd_bufferSize(
+        API, handle, HIPSOLVER_EIG_MODE_VECTOR, uplo, n, dAP.data(), dD.data(), dZ.data(), ldz, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    spevd_hpevd_checkBadArgs<API>(handle,
+                                  evect,
+                                  uplo,
+                                  n,
+                                  dAP.data(),
+                                  dD.data(),
+                                  dZ.data(),
+                                  ldz,
+                                  dWork.data(),
+                                  size_W,
+                                  dinfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void spevd_hpevd_initData(const hipsolverHandle_t   handle,
+                          const hipsolverFillMode_t uplo,
+                          const int                 n,
+                          Td&                       dAP,
+                          Th&                       hA,
+                          Th&                       hAP)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * n] += 400;
+                else
+                    hA[0][i + j * n] -= 4;
+            }
+        }
+
+        pptrf_pack(uplo, n, hA[0], n, hAP[0]);
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void spevd_hpevd_getError(const hipsolverHandle_t   handle,
+                          const hipsolverEigMode_t  evect,
+                          const hipsolverFillMode_t uplo,
+                          const int                 n,
+                          Td&                       dAP,
+                          Sd&                       dD,
+                          Td&                       dZ,
+                          const int                 ldz,
+                          Td&                       dWork,
+                          const int                 lwork,
+                          Id&                       dinfo,
+                          Th&                       hA,
+                          Th&                       hAP,
+                          Sh&                       hD,
+                          Sh&                       hDres,
+                          Th&                       hZres,
+                          Ih&                       hinfo,
+                          Ih&                       hinfoRes,
+                          double*                   max_err)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+    using S                = decltype(std::real(T{}));
+
+    // the reference eigenvalues are computed from the full storage matrix
+    int sizeE  = (!COMPLEX ? 2 * n + 1 : n);
+    int ltwork = (!COMPLEX ? 0 : n + 1);
+    int liwork = 1;
+
+    std::vector<T>   work(ltwork);
+    std::vector<S>   hE(sizeE);
+    std::vector<int> iwork(liwork);
+    std::vector<T>   A(n * n);
+
+    // input data initialization
+    spevd_hpevd_initData<true, true, T>(handle, uplo, n, dAP, hA, hAP);
+    for(int i = 0; i < n * n; i++)
+        A[i] = hA[0][i];
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_spevd_hpevd(API,
+                                              handle,
+                                              evect,
+                                              uplo,
+                                              n,
+                                              dAP.data(),
+                                              dD.data(),
+                                              dZ.data(),
+                                              ldz,
+                                              dWork.data(),
+                                              lwork,
+                                              dinfo.data()));
+
+    CHECK_HIP_ERROR(hDres.transfer_from(dD));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(evect == HIPSOLVER_EIG_MODE_VECTOR)
+        CHECK_HIP_ERROR(hZres.transfer_from(dZ));
+
+    // CPU lapack
+    cblas_syevd_heevd<T>(HIPSOLVER_EIG_MODE_NOVECTOR,
+                         uplo,
+                         n,
+                         hA[0],
+                         n,
+                         hD[0],
+                         work.data(),
+                         ltwork,
+                         hE.data(),
+                         sizeE,
+                         iwork.data(),
+                         liwork,
+                         hinfo[0]);
+
+    // Check info for non-convergence
+    *max_err = 0;
+    if(hinfo[0][0] != hinfoRes[0][0])
+        *max_err += 1;
+
+    // (We expect the used input matrices to always converge. Testing
+    // implicitly the equivalent non-converged matrix is very complicated and it boils
+    // down to essentially run the algorithm again and until convergence is achieved).
+
+    double err = 0;
+
+    if(hinfo[0][0] == 0)
+    {
+        // error is ||hD - hDRes|| / ||hD||
+        // using frobenius norm
+        err      = norm_error('F', 1, n, 1, hD[0], hDres[0]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        if(evect == HIPSOLVER_EIG_MODE_VECTOR)
+        {
+            // eigenvectors are tested implicitly due to their non-uniqueness under
+            // scaling: multiply A with each of the n eigenvectors and divide by the
+            // corresponding eigenvalues
+            T alpha;
+            T beta = 0;
+            for(int j = 0; j < n; j++)
+            {
+                alpha = T(1) / hDres[0][j];
+                cblas_symv_hemv(
+                    uplo, n, alpha, A.data(), n, hZres[0] + j * ldz, 1, beta, hA[0] + j * n, 1);
+            }
+
+            // error is ||hA - hZRes|| / ||hA||
+            // using frobenius norm
+            err      = norm_error('F', n, n, n, hA[0], hZres[0], ldz);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void spevd_hpevd_getPerfData(const hipsolverHandle_t   handle,
+                             const hipsolverEigMode_t  evect,
+                             const hipsolverFillMode_t uplo,
+                             const int                 n,
+                             Td&                       dAP,
+                             Sd&                       dD,
+                             Td&                       dZ,
+                             const int                 ldz,
+                             Td&                       dWork,
+                             const int                 lwork,
+                             Id&                       dinfo,
+                             Th&                       hA,
+                             Th&                       hAP,
+                             Sh&                       hD,
+                             Ih&                       hinfo,
+                             double*                   gpu_time_used,
+                             double*                   cpu_time_used,
+                             const int                 hot_calls,
+                             const bool                perf)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+    using S                = decltype(std::real(T{}));
+
+    int sizeE, ltwork;
+    if(!COMPLEX)
+    {
+        sizeE  = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 2 * n + 1 : 1 + 6 * n + 2 * n * n);
+        ltwork = 0;
+    }
+    else
+    {
+        sizeE  = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? n : 1 + 5 * n + 2 * n * n);
+        ltwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? n + 1 : 2 * n + n * n);
+    }
+    int liwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 1 : 3 + 5 * n);
+
+    std::vector<T>   work(ltwork);
+    std::vector<S>   hE(sizeE);
+    std::vector<int> iwork(liwork);
+
+    if(!perf)
+    {
+        spevd_hpevd_initData<true, false, T>(handle, uplo, n, dAP, hA, hAP);
+
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_syevd_heevd<T>(evect,
+                             uplo,
+                             n,
+                             hA[0],
+                             n,
+                             hD[0],
+                             work.data(),
+                             ltwork,
+                             hE.data(),
+                             sizeE,
+                             iwork.data(),
+                             liwork,
+                             hinfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    spevd_hpevd_initData<true, false, T>(handle, uplo, n, dAP, hA, hAP);
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+    {
+        spevd_hpevd_initData<false, true, T>(handle, uplo, n, dAP, hA, hAP);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_spevd_hpevd(API,
+                                                  handle,
+                                                  evect,
+                                                  uplo,
+                                                  n,
+                                                  dAP.data(),
+                                                  dD.data(),
+                                                  dZ.data(),
+                                                  ldz,
+                                                  dWork.data(),
+                                                  lwork,
+                                                  dinfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        spevd_hpevd_initData<false, true, T>(handle, uplo, n, dAP, hA, hAP);
+
+        timer.start();
+        hipsolver_spevd_hpevd(API,
+                              handle,
+                              evect,
+                              uplo,
+                              n,
+                              dAP.data(),
+                              dD.data(),
+                              dZ.data(),
+                              ldz,
+                              dWork.data(),
+                              lwork,
+                              dinfo.data());
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, typename T>
+void testing_spevd_hpevd(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   evectC = argus.get<char>("jobz");
+    char                   uploC  = argus.get<char>("uplo");
+    int                    n      = argus.get<int>("n");
+    int                    ldz    = argus.get<int>("ldz", n);
+
+    hipsolverEigMode_t  evect     = char2hipsolver_evect(evectC);
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // determine sizes
+    size_t size_A    = size_t(n) * n;
+    size_t size_P    = size_t(n) * (n + 1) / 2;
+    size_t size_Z    = size_t(ldz) * n;
+    size_t size_D    = n;
+    size_t size_Zres = (argus.unit_check || argus.norm_check) ? size_Z : 0;
+    size_t size_Dres = (argus.unit_check || argus.norm_check) ? size_D : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || ldz < 1 || (evect == HIPSOLVER_EIG_MODE_VECTOR && ldz < n));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_spevd_hpevd(API,
+                                                    handle,
+                                                    evect,
+                                                    uplo,
+                                                    n,
+                                                    (T*)nullptr,
+                                                    (S*)nullptr,
+                                                    (T*)nullptr,
+                                                    ldz,
+                                                    (T*)nullptr,
+                                                    0,
+                                                    (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hAP(size_P, 1, size_P, 1);
+    host_strided_batch_vector<S>     hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<S>     hDres(size_Dres, 1, size_Dres, 1);
+    host_strided_batch_vector<T>     hZres(size_Zres, 1, size_Zres, 1);
+    host_strided_batch_vector<int>   hinfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hinfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dAP(size_P, 1, size_P, 1);
+    device_strided_batch_vector<S>   dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T>   dZ(size_Z, 1, size_Z, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    if(size_P)
+        CHECK_HIP_ERROR(dAP.memcheck());
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    if(size_Z)
+        CHECK_HIP_ERROR(dZ.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int size_W;
+    hipsolver_spevd_hpevd_bufferSize(
+        API, handle, evect, uplo, n, dAP.data(), dD.data(), dZ.data(), ldz, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        spevd_hpevd_getError<API, T>(handle,
+                                     evect,
+                                     uplo,
+                                     n,
+                                     dAP,
+                                     dD,
+                                     dZ,
+                                     ldz,
+                                     dWork,
+                                     size_W,
+                                     dinfo,
+                                     hA,
+                                     hAP,
+                                     hD,
+                                     hDres,
+                                     hZres,
+                                     hinfo,
+                                     hinfoRes,
+                                     &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        spevd_hpevd_getPerfData<API, T>(handle,
+                                        evect,
+                                        uplo,
+                                        n,
+                                        dAP,
+                                        dD,
+                                        dZ,
+                                        ldz,
+                                        dWork,
+                                        size_W,
+                                        dinfo,
+                                        hA,
+                                        hAP,
+                                        hD,
+                                        hinfo,
+                                        &gpu_time_used,
+                                        &cpu_time_used,
+                                        hot_calls,
+                                        argus.perf);
+
+    // validate results for rocsolver-test
+    // using 2 * n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("jobz", "uplo", "n", "ldz");
+            rocsolver_bench_output(evectC, uploC, n, ldz);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
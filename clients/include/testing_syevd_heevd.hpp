@@ -303,20 +303,28 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hAres.transfer_from(dA));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_syevd_heevd<T>(evect,
-                             uplo,
-                             n,
-                             hA[b],
-                             lda,
-                             hD[b],
-                             work.data(),
-                             ltwork,
-                             hE.data(),
-                             sizeE,
-                             iwork.data(),
-                             liwork,
-                             hinfo[b]);
+    hipsolver_test_cache cache("syevd_heevd");
+    cache.arg(type2char<T>()).arg(int(evect)).arg(int(uplo));
+    cache.arg(n).arg(lda).arg(bc);
+    cache.input(hA).output(hA).output(hD).output(hinfo);
+    if(!cache.load())
+    {
+        for(int b = 0; b < bc; ++b)
+            cblas_syevd_heevd<T>(evect,
+                                 uplo,
+                                 n,
+                                 hA[b],
+                                 lda,
+                                 hD[b],
+                                 work.data(),
+                                 ltwork,
+                                 hE.data(),
+                                 sizeE,
+                                 iwork.data(),
+                                 liwork,
+                                 hinfo[b]);
+        cache.store();
+    }
 
     // Check info for non-convergence
     *max_err = 0;
@@ -431,6 +439,7 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
         syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
             cblas_syevd_heevd<T>(evect,
@@ -452,7 +461,7 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
     syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
@@ -475,13 +484,13 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_syevd_heevd(FORTRAN,
                               handle,
                               evect,
@@ -496,9 +505,9 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
                               lwork,
                               dinfo.data(),
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
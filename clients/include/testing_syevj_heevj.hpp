@@ -345,20 +345,28 @@ void syevj_heevj_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hAres.transfer_from(dA));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
-        cblas_syevd_heevd<T>(evect,
-                             uplo,
-                             n,
-                             hA[b],
-                             lda,
-                             hD[b],
-                             work.data(),
-                             ltwork,
-                             hE.data(),
-                             sizeE,
-                             iwork.data(),
-                             liwork,
-                             hinfo[b]);
+    hipsolver_test_cache cache("syevd_heevd");
+    cache.arg(type2char<T>()).arg(int(evect)).arg(int(uplo));
+    cache.arg(n).arg(lda).arg(bc);
+    cache.input(hA).output(hA).output(hD).output(hinfo);
+    if(!cache.load())
+    {
+        for(int b = 0; b < bc; ++b)
+            cblas_syevd_heevd<T>(evect,
+                                 uplo,
+                                 n,
+                                 hA[b],
+                                 lda,
+                                 hD[b],
+                                 work.data(),
+                                 ltwork,
+                                 hE.data(),
+                                 sizeE,
+                                 iwork.data(),
+                                 liwork,
+                                 hinfo[b]);
+        cache.store();
+    }
 
     // Check info for non-convergence
     *max_err = 0;
@@ -475,6 +483,7 @@ void syevj_heevj_getPerfData(const hipsolverHandle_t   handle,
         syevj_heevj_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
             cblas_syevd_heevd<T>(evect,
@@ -496,7 +505,7 @@ void syevj_heevj_getPerfData(const hipsolverHandle_t   handle,
     syevj_heevj_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
@@ -521,13 +530,13 @@ void syevj_heevj_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_syevj_heevj(API,
                               STRIDED,
                               handle,
@@ -544,9 +553,9 @@ void syevj_heevj_getPerfData(const hipsolverHandle_t   handle,
                               dinfo.data(),
                               params,
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
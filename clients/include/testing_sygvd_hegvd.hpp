@@ -463,24 +463,32 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hARes.transfer_from(dA));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
+    hipsolver_test_cache cache("sygvd_hegvd");
+    cache.arg(type2char<T>()).arg(int(itype)).arg(int(evect)).arg(int(uplo));
+    cache.arg(n).arg(lda).arg(ldb).arg(bc);
+    cache.input(hA).input(hB).output(hA).output(hB).output(hD).output(hInfo);
+    if(!cache.load())
     {
-        cblas_sygvd_hegvd(itype,
-                          evect,
-                          uplo,
-                          n,
-                          hA[b],
-                          lda,
-                          hB[b],
-                          ldb,
-                          hD[b],
-                          work.data(),
-                          ltwork,
-                          rwork.data(),
-                          lrwork,
-                          iwork.data(),
-                          liwork,
-                          hInfo[b]);
+        for(int b = 0; b < bc; ++b)
+        {
+            cblas_sygvd_hegvd(itype,
+                              evect,
+                              uplo,
+                              n,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              hD[b],
+                              work.data(),
+                              ltwork,
+                              rwork.data(),
+                              lrwork,
+                              iwork.data(),
+                              liwork,
+                              hInfo[b]);
+        }
+        cache.store();
     }
 
     // (We expect the used input matrices to always converge. Testing
@@ -656,6 +664,7 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
         {
@@ -683,7 +692,7 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
         handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         sygvd_hegvd_initData<false, true, T>(
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
@@ -711,14 +720,14 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         sygvd_hegvd_initData<false, true, T>(
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_sygvd_hegvd(FORTRAN,
                               handle,
                               itype,
@@ -737,9 +746,9 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
                               lwork,
                               dInfo.data(),
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
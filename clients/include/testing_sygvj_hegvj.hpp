@@ -479,24 +479,32 @@ void sygvj_hegvj_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hARes.transfer_from(dA));
 
     // CPU lapack
-    for(int b = 0; b < bc; ++b)
+    hipsolver_test_cache cache("sygvd_hegvd");
+    cache.arg(type2char<T>()).arg(int(itype)).arg(int(evect)).arg(int(uplo));
+    cache.arg(n).arg(lda).arg(ldb).arg(bc);
+    cache.input(hA).input(hB).output(hA).output(hB).output(hD).output(hInfo);
+    if(!cache.load())
     {
-        cblas_sygvd_hegvd(itype,
-                          evect,
-                          uplo,
-                          n,
-                          hA[b],
-                          lda,
-                          hB[b],
-                          ldb,
-                          hD[b],
-                          work.data(),
-                          ltwork,
-                          rwork.data(),
-                          lrwork,
-                          iwork.data(),
-                          liwork,
-                          hInfo[b]);
+        for(int b = 0; b < bc; ++b)
+        {
+            cblas_sygvd_hegvd(itype,
+                              evect,
+                              uplo,
+                              n,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              hD[b],
+                              work.data(),
+                              ltwork,
+                              rwork.data(),
+                              lrwork,
+                              iwork.data(),
+                              liwork,
+                              hInfo[b]);
+        }
+        cache.store();
     }
 
     // (We expect the used input matrices to always converge. Testing
@@ -673,6 +681,7 @@ void sygvj_hegvj_getPerfData(const hipsolverHandle_t   handle,
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
         {
@@ -700,7 +709,7 @@ void sygvj_hegvj_getPerfData(const hipsolverHandle_t   handle,
         handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         sygvj_hegvj_initData<false, true, T>(
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
@@ -729,14 +738,14 @@ void sygvj_hegvj_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         sygvj_hegvj_initData<false, true, T>(
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_sygvj_hegvj(API,
                               handle,
                               itype,
@@ -756,9 +765,9 @@ void sygvj_hegvj_getPerfData(const hipsolverHandle_t   handle,
                               dInfo.data(),
                               params,
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
@@ -518,6 +518,7 @@ void sytrd_hetrd_getPerfData(const hipsolverHandle_t   handle,
         sytrd_hetrd_initData<true, false, T>(handle, n, dA, lda, bc, hA);
 
         // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
         *cpu_time_used = get_time_us_no_sync();
         for(int b = 0; b < bc; ++b)
             cblas_sytrd_hetrd<T, S>(uplo, n, hA[b], lda, hD[b], hE[b], hTau[b], hW.data(), 32 * n);
@@ -527,7 +528,7 @@ void sytrd_hetrd_getPerfData(const hipsolverHandle_t   handle,
     sytrd_hetrd_initData<true, false, T>(handle, n, dA, lda, bc, hA);
 
     // cold calls
-    for(int iter = 0; iter < 2; iter++)
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
     {
         sytrd_hetrd_initData<false, true, T>(handle, n, dA, lda, bc, hA);
 
@@ -553,13 +554,13 @@ void sytrd_hetrd_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_perf_timer timer(stream);
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
     {
         sytrd_hetrd_initData<false, true, T>(handle, n, dA, lda, bc, hA);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_sytrd_hetrd(FORTRAN,
                               handle,
                               uplo,
@@ -577,9 +578,9 @@ void sytrd_hetrd_getPerfData(const hipsolverHandle_t   handle,
                               lwork,
                               dInfo.data(),
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    *gpu_time_used = timer.finish();
 }
 
 template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
@@ -0,0 +1,268 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_pptrf.hpp"
+
+template <testAPI_t API, typename T>
+void trttp_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        T                         dA,
+                        const int                 lda,
+                        T                         dAP)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_trttp(API, nullptr, uplo, n, dA, lda, dAP),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_tpttr(API, nullptr, uplo, n, dAP, dA, lda),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_trttp(API, handle, hipsolverFillMode_t(-1), n, dA, lda, dAP),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_tpttr(API, handle, hipsolverFillMode_t(-1), n, dAP, dA, lda),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_trttp(API, handle, uplo, n, (T) nullptr, lda, dAP),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_trttp(API, handle, uplo, n, dA, lda, (T) nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_tpttr(API, handle, uplo, n, (T) nullptr, dA, lda),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_tpttr(API, handle, uplo, n, dAP, (T) nullptr, lda),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T>
+void testing_trttp_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    n    = 1;
+    int                    lda  = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dAP(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dAP.memcheck());
+
+    // check bad arguments
+    trttp_checkBadArgs<API>(handle, uplo, n, dA.data(), lda, dAP.data());
+}
+
+template <testAPI_t API, typename T, typename Td, typename Th>
+void trttp_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    Td&                       dA,
+                    const int                 lda,
+                    Td&                       dAP,
+                    Th&                       hA,
+                    Th&                       hARes,
+                    Th&                       hAP,
+                    Th&                       hAPRes,
+                    double*                   max_err)
+{
+    int size_P = n * (n + 1) / 2;
+
+    // input data initialization
+    rocblas_init<T>(hA, true);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    // execute computations
+    // GPU lapack: pack the triangle of A
+    CHECK_ROCBLAS_ERROR(hipsolver_trttp(API, handle, uplo, n, dA.data(), lda, dAP.data()));
+    CHECK_HIP_ERROR(hAPRes.transfer_from(dAP));
+
+    // CPU reference
+    pptrf_pack(uplo, n, hA[0], lda, hAP[0]);
+
+    // the packed arrays must be identical
+    *max_err = norm_error('F', size_P, 1, size_P, hAP[0], hAPRes[0]);
+
+    // GPU lapack: unpack back into a zeroed matrix
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(T) * lda * n));
+    CHECK_ROCBLAS_ERROR(hipsolver_tpttr(API, handle, uplo, n, dAP.data(), dA.data(), lda));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // the other triangle must be left untouched
+    for(int j = 0; j < n; j++)
+    {
+        int i0 = (uplo == HIPSOLVER_FILL_MODE_UPPER) ? j + 1 : 0;
+        int i1 = (uplo == HIPSOLVER_FILL_MODE_UPPER) ? n : j;
+        for(int i = i0; i < i1; i++)
+            if(hARes[0][i + j * lda] != T(0))
+                *max_err += 1;
+    }
+
+    // and the selected triangle must be restored
+    double err = (uplo == HIPSOLVER_FILL_MODE_UPPER)
+                     ? norm_error_upperTr('F', n, n, lda, hA[0], hARes[0])
+                     : norm_error_lowerTr('F', n, n, lda, hA[0], hARes[0]);
+    *max_err   = err > *max_err ? err : *max_err;
+}
+
+template <testAPI_t API, typename T, typename Td, typename Th>
+void trttp_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const int                 n,
+                       Td&                       dA,
+                       const int                 lda,
+                       Td&                       dAP,
+                       Th&                       hA,
+                       Th&                       hAP,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf)
+{
+    rocblas_init<T>(hA, true);
+
+    if(!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        hipsolver_serial_host_guard serial;
+        *cpu_time_used = get_time_us_no_sync();
+        pptrf_pack(uplo, n, hA[0], lda, hAP[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    // cold calls
+    for(int iter = 0; iter < hipsolver_perf_timer::warmup(); iter++)
+        CHECK_ROCBLAS_ERROR(hipsolver_trttp(API, handle, uplo, n, dA.data(), lda, dAP.data()));
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_perf_timer timer(stream);
+
+    for(int iter = 0; timer.more(iter, hot_calls); iter++)
+    {
+        timer.start();
+        hipsolver_trttp(API, handle, uplo, n, dA.data(), lda, dAP.data());
+        timer.stop();
+    }
+    *gpu_time_used = timer.finish();
+}
+
+template <testAPI_t API, typename T>
+void testing_trttp(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    lda   = argus.get<int>("lda", n);
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_P    = size_t(n) * (n + 1) / 2;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || lda < 1);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_trttp(API, handle, uplo, n, (T*)nullptr, lda, (T*)nullptr),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_tpttr(API, handle, uplo, n, (T*)nullptr, (T*)nullptr, lda),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>   hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>   hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<T>   hAP(size_P, 1, size_P, 1);
+    host_strided_batch_vector<T>   hAPRes(size_PRes, 1, size_PRes, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dAP(size_P, 1, size_P, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dAP.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        trttp_getError<API, T>(handle, uplo, n, dA, lda, dAP, hA, hARes, hAP, hAPRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        trttp_getPerfData<API, T>(handle,
+                                  uplo,
+                                  n,
+                                  dA,
+                                  lda,
+                                  dAP,
+                                  hA,
+                                  hAP,
+                                  &gpu_time_used,
+                                  &cpu_time_used,
+                                  hot_calls,
+                                  argus.perf);
+
+    // validate results for rocsolver-test
+    // copies must be exact, so zero tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 0);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "n", "lda");
+            rocsolver_bench_output(uploC, n, lda);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -9,7 +9,10 @@
 #ifdef __cplusplus
 #include "complex.hpp"
 #include "hipsolver_datatype2string.hpp"
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <immintrin.h>
 #include <random>
 #include <type_traits>
@@ -81,15 +84,33 @@ inline void hipsolver_expect_status(hipsolverStatus_t status, hipsolverStatus_t
 class hipsolver_local_handle
 {
     hipsolverHandle_t m_handle;
+    bool              m_shared;
 
 public:
     hipsolver_local_handle()
+        : m_shared(shared_handle() != nullptr)
     {
-        hipsolverCreate(&m_handle);
+        if(m_shared)
+            m_handle = shared_handle();
+        else
+            hipsolverCreate(&m_handle);
+
+        // transfers of pinned host vectors are queued on the stream of the handle
+        hipsolverGetStream(m_handle, &host_transfer_stream());
     }
     ~hipsolver_local_handle()
     {
-        hipsolverDestroy(m_handle);
+        if(!m_shared)
+            hipsolverDestroy(m_handle);
+    }
+
+    // When set, all local handles use this handle instead of creating their own.
+    // The benchmark client sets it while running a size sweep, so that the handle and its
+    // device workspace are reused from one case to the next.
+    static hipsolverHandle_t& shared_handle()
+    {
+        static hipsolverHandle_t handle = nullptr;
+        return handle;
     }
 
     hipsolver_local_handle(const hipsolver_local_handle&) = delete;
@@ -244,10 +265,15 @@ using real_t = typename real_t_impl<T>::type;
 using hipsolver_rng_t = std::mt19937;
 extern hipsolver_rng_t hipsolver_rng, hipsolver_seed;
 
+// Seed of the counter-based generator, and index of the next array it fills
+const uint64_t  hipsolver_random_seed = 69069;
+extern uint64_t hipsolver_random_key;
+
 // Reset the seed (mainly to ensure repeatability of failures in a given suite)
 inline void hipsolver_seedrand()
 {
-    hipsolver_rng = hipsolver_seed;
+    hipsolver_rng        = hipsolver_seed;
+    hipsolver_random_key = 0;
 }
 
 class hipsolver_nan_rng
@@ -304,58 +330,108 @@ public:
 };
 
 /* ============================================================================================ */
-/* generate random number :*/
+/*! \brief  Counter-based random number generator (Philox4x32-10). Each output depends only on the
+ * key and the counter, so the elements of an array can be generated in any order, and by any
+ * number of threads, with the same results */
 
-/*! \brief  generate a random number in range [1,2,3,4,5,6,7,8,9,10] */
-template <typename T>
-T random_generator()
+inline std::array<uint32_t, 4> hipsolver_philox(uint64_t key, uint64_t ctr_lo, uint64_t ctr_hi)
 {
-    // return rand()/( (T)RAND_MAX + 1);
-    return T(rand() % 10 + 1);
-};
+    uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32);
+    uint32_t c0 = uint32_t(ctr_lo), c1 = uint32_t(ctr_lo >> 32);
+    uint32_t c2 = uint32_t(ctr_hi), c3 = uint32_t(ctr_hi >> 32);
 
-// for hipsolverComplex, generate 2 floats
-/*! \brief  generate two random numbers in range [1,2,3,4,5,6,7,8,9,10] */
-template <>
-inline hipsolverComplex random_generator<hipsolverComplex>()
-{
-    return hipsolverComplex(rand() % 10 + 1, rand() % 10 + 1);
+    for(int r = 0; r < 10; r++)
+    {
+        uint64_t p0 = uint64_t(0xD2511F53) * c0;
+        uint64_t p1 = uint64_t(0xCD9E8D57) * c2;
+
+        c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        c1 = uint32_t(p1);
+        c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c3 = uint32_t(p0);
+
+        k0 += 0x9E3779B9;
+        k1 += 0xBB67AE85;
+    }
+
+    return {c0, c1, c2, c3};
 }
 
-// for hipsolverDoubleComplex, generate 2 doubles
-/*! \brief  generate two random numbers in range [1,2,3,4,5,6,7,8,9,10] */
-template <>
-inline hipsolverDoubleComplex random_generator<hipsolverDoubleComplex>()
+// Key of the next array to be filled with random values. The keys follow a fixed sequence, so every
+// run generates the same arrays in the same order
+inline uint64_t hipsolver_next_random_key()
 {
-    return hipsolverDoubleComplex(rand() % 10 + 1, rand() % 10 + 1);
+    return (hipsolver_random_seed << 32) + hipsolver_random_key++;
 }
 
-/*! \brief  generate a random number in range [-1,-2,-3,-4,-5,-6,-7,-8,-9,-10] */
+/*! \brief  generate the random number in range [1,2,3,4,5,6,7,8,9,10] of the element index of
+ * the problem batch of the array with the given key */
 template <typename T>
-inline T random_generator_negative()
+inline T random_generator(uint64_t key, uint64_t batch, uint64_t index)
 {
-    // return rand()/( (T)RAND_MAX + 1);
-    return -T(rand() % 10 + 1);
-};
+    return T(hipsolver_philox(key, index, batch)[0] % 10 + 1);
+}
 
-// for complex, generate two values, convert both to negative
-/*! \brief  generate a random real value in range [-1, -10] and random
-*           imaginary value in range [-1, -10]
-*/
+// for complex, generate two numbers from the same counter
 template <>
-inline hipsolverComplex random_generator_negative<hipsolverComplex>()
+inline hipsolverComplex
+    random_generator<hipsolverComplex>(uint64_t key, uint64_t batch, uint64_t index)
 {
-    return {float(-(rand() % 10 + 1)), float(-(rand() % 10 + 1))};
+    auto x = hipsolver_philox(key, index, batch);
+    return hipsolverComplex(x[0] % 10 + 1, x[1] % 10 + 1);
 }
 
 template <>
-inline hipsolverDoubleComplex random_generator_negative<hipsolverDoubleComplex>()
+inline hipsolverDoubleComplex
+    random_generator<hipsolverDoubleComplex>(uint64_t key, uint64_t batch, uint64_t index)
+{
+    auto x = hipsolver_philox(key, index, batch);
+    return hipsolverDoubleComplex(x[0] % 10 + 1, x[1] % 10 + 1);
+}
+
+/*! \brief  generate a random number in range [-1,-2,-3,-4,-5,-6,-7,-8,-9,-10] of the element
+ * index of the problem batch of the array with the given key */
+template <typename T>
+inline T random_generator_negative(uint64_t key, uint64_t batch, uint64_t index)
 {
-    return {double(-(rand() % 10 + 1)), double(-(rand() % 10 + 1))};
+    // for complex, both parts are negated
+    return -random_generator<T>(key, batch, index);
 }
 
 /* ============================================================================================ */
 
+/* ============================================================================================ */
+/*! \brief  Host threads */
+
+// Number of host threads used by hipsolver_parallel_for. It defaults to the value of the
+// environment variable HIPSOLVER_CPU_THREADS, or to the number of hardware threads.
+int& hipsolver_host_threads();
+
+// Runs func(i) for every i = 0, ..., n - 1, spreading the calls among the host threads
+void hipsolver_parallel_for(size_t n, const std::function<void(size_t)>& func);
+
+// Runs the host computations of its scope on the calling thread only, so that the timed CPU
+// baselines do not depend on the number of host threads
+class hipsolver_serial_host_guard
+{
+    int m_threads;
+
+public:
+    hipsolver_serial_host_guard()
+        : m_threads(hipsolver_host_threads())
+    {
+        hipsolver_host_threads() = 1;
+    }
+
+    ~hipsolver_serial_host_guard()
+    {
+        hipsolver_host_threads() = m_threads;
+    }
+
+    hipsolver_serial_host_guard(const hipsolver_serial_host_guard&) = delete;
+    hipsolver_serial_host_guard& operator=(const hipsolver_serial_host_guard&) = delete;
+};
+
 /* ============================================================================================ */
 /*! \brief Packs strided_batched matricies into groups of 4 in N */
 template <typename T>
@@ -448,4 +524,82 @@ double get_time_us_no_sync();
 }
 #endif
 
+#ifdef __cplusplus
+
+/* ============================================================================================
+ */
+/*! \brief  summary of the times (in microseconds) measured by a timing loop */
+struct hipsolver_time_stats
+{
+    int    samples = 0;
+    double mean    = 0;
+    double min     = 0;
+    double median  = 0;
+    double p95     = 0;
+    double p99     = 0;
+    double stddev  = 0;
+
+    explicit hipsolver_time_stats(std::vector<double> times = {});
+};
+
+/*! \brief  options of the timing loops of the benchmark client, and the statistics of the last
+ * loop that was run */
+struct hipsolver_bench_timing
+{
+    // number of untimed calls made before the timed ones
+    int warmup = 2;
+
+    // if positive, the timed calls are repeated until this many milliseconds have passed,
+    // instead of a fixed number of times
+    double time_budget = 0;
+
+    // wall time (including host overhead) and device time of the calls timed by the last loop
+    hipsolver_time_stats wall;
+    hipsolver_time_stats device;
+
+    static hipsolver_bench_timing& get()
+    {
+        static hipsolver_bench_timing timing;
+        return timing;
+    }
+};
+
+/*! \brief  timer of the calls made by a timing loop. Each call is measured both with the wall
+ * clock and with hipEvents recorded on the stream, so that the host overhead can be separated
+ * from the device time */
+class hipsolver_perf_timer
+{
+    hipStream_t         m_stream;
+    hipEvent_t          m_start;
+    hipEvent_t          m_stop;
+    double              m_wall_start;
+    double              m_elapsed = 0;
+    std::vector<double> m_wall;
+    std::vector<double> m_device;
+
+public:
+    explicit hipsolver_perf_timer(hipStream_t stream);
+    ~hipsolver_perf_timer();
+
+    hipsolver_perf_timer(const hipsolver_perf_timer&) = delete;
+    hipsolver_perf_timer& operator=(const hipsolver_perf_timer&) = delete;
+
+    // number of untimed calls to make before the timed ones
+    static int warmup()
+    {
+        return hipsolver_bench_timing::get().warmup;
+    }
+
+    // whether another call should be timed, after iter calls have been
+    bool more(int iter, int hot_calls) const;
+
+    void start();
+    void stop();
+
+    // stores the statistics of the timed calls and returns their mean wall time
+    double finish();
+};
+
+#endif // __cplusplus
+
 /* ============================================================================================ */
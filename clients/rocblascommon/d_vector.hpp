@@ -4,6 +4,7 @@
 #pragma once
 
 #include "hipsolver.h"
+#include "host_memory.hpp"
 #include "rocblas_init.hpp"
 //#include "rocblas_test.hpp"
 #include <cinttypes>
@@ -1,10 +1,13 @@
 /* ************************************************************************
- * Copyright 2018-2021 Advanced Micro Devices, Inc.
+ * Copyright 2018-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #pragma once
 
 #include "d_vector.hpp"
 
+#include <algorithm>
+#include <vector>
+
 //
 // Local declaration of the host strided batch vector.
 //
@@ -16,6 +19,8 @@ class host_batch_vector;
 //! and
 //!  - an array of pointers in host memory
 //!  - an array of pointers in device memory
+//! The vectors of the batch are stored in a single allocation, each of them between its own
+//! guards when PAD > 0.
 //!
 template <typename T, size_t PAD = 0, typename U = T>
 class device_batch_vector : private d_vector<T, PAD, U>
@@ -44,7 +49,7 @@ public:
         : m_n(n)
         , m_inc(inc)
         , m_batch_count(batch_count)
-        , d_vector<T, PAD, U>(size_t(n) * std::abs(inc))
+        , d_vector<T, PAD, U>(block_nmemb(n, inc, batch_count))
     {
         if(false == this->try_initialize_memory())
         {
@@ -117,6 +122,14 @@ public:
         return 0;
     }
 
+    //!
+    //! @brief Returns the distance between consecutive vectors of the batch, guards included.
+    //!
+    size_t member_stride() const
+    {
+        return this->batch_nmemb() + 2 * s_pad;
+    }
+
     //!
     //! @brief Access to device data.
     //! @return Pointer to the device data.
@@ -197,23 +210,21 @@ public:
     //!
     hipError_t transfer_from(const host_batch_vector<T>& that)
     {
-        hipError_t hip_err;
         //
-        // Copy each vector.
+        // Both batches are in a single block, so they are copied at once.
         //
-        for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-        {
-            if(hipSuccess
-               != (hip_err = hipMemcpy((*this)[batch_index],
-                                       that[batch_index],
-                                       sizeof(T) * this->nmemb(),
-                                       hipMemcpyHostToDevice)))
-            {
-                return hip_err;
-            }
-        }
+        size_t num_bytes = sizeof(T) * this->batch_nmemb();
+        if(num_bytes == 0 || this->m_batch_count == 0)
+            return hipSuccess;
 
-        return hipSuccess;
+        return host_transfer(this->m_block,
+                             sizeof(T) * this->member_stride(),
+                             that[0],
+                             num_bytes,
+                             num_bytes,
+                             this->m_batch_count,
+                             hipMemcpyHostToDevice,
+                             that.pinned());
     }
 
     //!
@@ -229,12 +240,94 @@ public:
     }
 
 private:
+#ifdef GOOGLE_TEST
+    static constexpr size_t s_pad = PAD;
+#else
+    static constexpr size_t s_pad = 0;
+#endif
+
     rocblas_int m_n{};
     rocblas_int m_inc{};
     rocblas_int m_batch_count{};
+    T*          m_block{};
     T**         m_data{};
     T**         m_device_data{};
 
+    //!
+    //! @brief Returns the number of elements of each vector of the batch.
+    //!
+    size_t batch_nmemb() const
+    {
+        return size_t(this->m_n) * std::abs(this->m_inc);
+    }
+
+    //!
+    //! @brief Returns the number of elements of the block between its outer guards.
+    //!
+    static size_t block_nmemb(rocblas_int n, rocblas_int inc, rocblas_int batch_count)
+    {
+        size_t stride = size_t(n) * std::abs(inc) + 2 * s_pad;
+        return batch_count > 0 ? stride * batch_count - 2 * s_pad : 0;
+    }
+
+    //!
+    //! @brief Returns the guards between consecutive vectors of the batch as a host image of
+    //! batch_count - 1 rows, each with the guard after a vector and the guard before the next.
+    //!
+    std::vector<U> inner_guards_image() const
+    {
+        std::vector<U> image(2 * PAD * std::max(this->m_batch_count - 1, 0));
+        for(size_t g = 0; g < image.size(); g += PAD)
+            std::copy(this->guard, this->guard + PAD, image.begin() + g);
+        return image;
+    }
+
+    //!
+    //! @brief Write the guards between consecutive vectors of the batch with a single copy. The
+    //! guards before the first vector and after the last one are handled by d_vector.
+    //!
+    bool inner_guards_setup()
+    {
+#ifdef GOOGLE_TEST
+        if(PAD > 0 && this->m_batch_count > 1)
+        {
+            std::vector<U> image = this->inner_guards_image();
+            return hipSuccess
+                   == hipMemcpy2D(this->m_data[1] - 2 * PAD,
+                                  sizeof(T) * this->member_stride(),
+                                  image.data(),
+                                  2 * sizeof(this->guard),
+                                  2 * sizeof(this->guard),
+                                  this->m_batch_count - 1,
+                                  hipMemcpyHostToDevice);
+        }
+#endif
+        return true;
+    }
+
+    //!
+    //! @brief Make sure that the guards between consecutive vectors of the batch are unchanged,
+    //! reading them back with a single copy.
+    //!
+    void inner_guards_check()
+    {
+#ifdef GOOGLE_TEST
+        if(PAD > 0 && this->m_batch_count > 1)
+        {
+            std::vector<U> image = this->inner_guards_image();
+            std::vector<U> host(image.size());
+            hipMemcpy2D(host.data(),
+                        2 * sizeof(this->guard),
+                        this->m_data[1] - 2 * PAD,
+                        sizeof(T) * this->member_stride(),
+                        2 * sizeof(this->guard),
+                        this->m_batch_count - 1,
+                        hipMemcpyDeviceToHost);
+            EXPECT_EQ(memcmp(host.data(), image.data(), sizeof(U) * image.size()), 0);
+        }
+#endif
+    }
+
     //!
     //! @brief Try to allocate the ressources.
     //! @return true if success false otherwise.
@@ -250,14 +343,16 @@ private:
             success = (nullptr != (this->m_data = (T**)calloc(this->m_batch_count, sizeof(T*))));
             if(success)
             {
-                for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+                success = (nullptr != (this->m_block = this->device_vector_setup()));
+                if(success)
                 {
-                    success
-                        = (nullptr != (this->m_data[batch_index] = this->device_vector_setup()));
-                    if(!success)
+                    size_t stride = this->member_stride();
+                    for(rocblas_int batch_index = 0; batch_index < this->m_batch_count;
+                        ++batch_index)
                     {
-                        break;
+                        this->m_data[batch_index] = this->m_block + batch_index * stride;
                     }
+                    success = this->inner_guards_setup();
                 }
 
                 if(success)
@@ -278,17 +373,15 @@ private:
     //!
     void free_memory()
     {
-        if(nullptr != this->m_data)
+        if(nullptr != this->m_block)
         {
-            for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-            {
-                if(nullptr != this->m_data[batch_index])
-                {
-                    this->device_vector_teardown(this->m_data[batch_index]);
-                    this->m_data[batch_index] = nullptr;
-                }
-            }
+            this->inner_guards_check();
+            this->device_vector_teardown(this->m_block);
+            this->m_block = nullptr;
+        }
 
+        if(nullptr != this->m_data)
+        {
             free(this->m_data);
             this->m_data = nullptr;
         }
@@ -203,8 +203,11 @@ public:
     //!
     hipError_t transfer_from(const host_strided_batch_vector<T>& that)
     {
-        return hipMemcpy(
-            this->data(), that.data(), sizeof(T) * this->nmemb(), hipMemcpyHostToDevice);
+        return host_transfer(this->data(),
+                             that.data(),
+                             sizeof(T) * this->nmemb(),
+                             hipMemcpyHostToDevice,
+                             that.pinned());
     }
 
     //!
@@ -148,8 +148,11 @@ public:
     //!
     hipError_t transfer_from(const host_vector<T>& that)
     {
-        return hipMemcpy(
-            this->m_data, (const T*)that, this->nmemb() * sizeof(T), hipMemcpyHostToDevice);
+        return host_transfer(this->m_data,
+                             (const T*)that,
+                             this->nmemb() * sizeof(T),
+                             hipMemcpyHostToDevice,
+                             that.pinned());
     }
 
     hipError_t memcheck() const
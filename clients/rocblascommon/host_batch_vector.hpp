@@ -1,8 +1,10 @@
 /* ************************************************************************
- * Copyright 2018-2021 Advanced Micro Devices, Inc.
+ * Copyright 2018-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #pragma once
 
+#include "host_memory.hpp"
+
 //
 // Local declaration of the device batch vector.
 //
@@ -10,7 +12,8 @@ template <typename T, size_t PAD, typename U>
 class device_batch_vector;
 
 //!
-//! @brief Implementation of the batch vector on host.
+//! @brief Implementation of the batch vector on host. The vectors of the batch are stored
+//! contiguously in a single allocation, which is pinned if host_pinned_memory() is set.
 //!
 template <typename T>
 class host_batch_vector
@@ -149,11 +152,9 @@ public:
         if((this->batch_count() == that.batch_count()) && (this->n() == that.n())
            && (this->inc() == that.inc()))
         {
-            size_t num_bytes = this->n() * std::abs(this->inc()) * sizeof(T);
-            for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-            {
-                memcpy((*this)[batch_index], that[batch_index], num_bytes);
-            }
+            size_t num_bytes = sizeof(T) * this->m_batch_count * this->batch_nmemb();
+            if(num_bytes > 0)
+                memcpy(this->m_block, that.m_block, num_bytes);
             return true;
         }
         else
@@ -167,20 +168,33 @@ public:
     //! @param that the vector the data is copied from.
     //! @return the hip error.
     //!
-    hipError_t transfer_from(const device_batch_vector<T>& that)
+    template <size_t PAD, typename U>
+    hipError_t transfer_from(const device_batch_vector<T, PAD, U>& that)
     {
-        hipError_t hip_err;
-        size_t     num_bytes = size_t(this->m_n) * std::abs(this->m_inc) * sizeof(T);
-        for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-        {
-            if(hipSuccess
-               != (hip_err = hipMemcpy(
-                       (*this)[batch_index], that[batch_index], num_bytes, hipMemcpyDeviceToHost)))
-            {
-                return hip_err;
-            }
-        }
-        return hipSuccess;
+        //
+        // Both batches are in a single block, so they are copied at once. On the device, the
+        // vectors are separated by their guards.
+        //
+        size_t num_bytes = sizeof(T) * this->batch_nmemb();
+        if(num_bytes == 0 || this->m_batch_count == 0)
+            return hipSuccess;
+
+        return host_transfer(this->m_block,
+                             num_bytes,
+                             that[0],
+                             sizeof(T) * that.member_stride(),
+                             num_bytes,
+                             this->m_batch_count,
+                             hipMemcpyDeviceToHost,
+                             this->m_pinned);
+    }
+
+    //!
+    //! @brief Tells whether the memory of the vector is pinned.
+    //!
+    bool pinned() const
+    {
+        return this->m_pinned;
     }
 
     //!
@@ -196,20 +210,28 @@ private:
     rocblas_int m_n{};
     rocblas_int m_inc{};
     rocblas_int m_batch_count{};
+    bool        m_pinned = host_pinned_memory();
+    T*          m_block{};
     T**         m_data{};
 
+    size_t batch_nmemb() const
+    {
+        return size_t(this->m_n) * std::abs(this->m_inc);
+    }
+
     bool try_initialize_memory()
     {
-        bool success = (nullptr != (this->m_data = (T**)calloc(this->m_batch_count, sizeof(T*))));
+        size_t nmemb   = this->batch_nmemb();
+        bool   success = (nullptr != (this->m_data = (T**)calloc(this->m_batch_count, sizeof(T*))));
         if(success)
         {
-            size_t nmemb = size_t(this->m_n) * std::abs(this->m_inc);
-            for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+            size_t bytes = std::max(nmemb * this->m_batch_count, size_t(1)) * sizeof(T);
+            success = (nullptr != (this->m_block = (T*)host_calloc(bytes, this->m_pinned)));
+            if(success)
             {
-                success = (nullptr != (this->m_data[batch_index] = (T*)calloc(nmemb, sizeof(T))));
-                if(false == success)
+                for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
                 {
-                    break;
+                    this->m_data[batch_index] = this->m_block + batch_index * nmemb;
                 }
             }
         }
@@ -220,17 +242,14 @@ private:
     {
         if(nullptr != this->m_data)
         {
-            for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-            {
-                if(nullptr != this->m_data[batch_index])
-                {
-                    free(this->m_data[batch_index]);
-                    this->m_data[batch_index] = nullptr;
-                }
-            }
-
             free(this->m_data);
             this->m_data = nullptr;
         }
+
+        if(nullptr != this->m_block)
+        {
+            host_free(this->m_block, this->m_pinned);
+            this->m_block = nullptr;
+        }
     }
 };
@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#pragma once
+
+#include "hipsolver.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+//!
+//! @brief Tells whether new host vectors are allocated in pinned memory. Transfers from and to
+//! pinned memory do not go through the staging copy used for pageable memory.
+//!
+inline bool& host_pinned_memory()
+{
+    static bool pinned = false;
+    return pinned;
+}
+
+//!
+//! @brief Stream of the transfers to and from pinned host vectors. Each local handle sets it to
+//! its own stream when it is created.
+//!
+inline hipStream_t& host_transfer_stream()
+{
+    static hipStream_t stream = nullptr;
+    return stream;
+}
+
+//!
+//! @brief Copies height rows of width bytes between host and device memory. When the host memory
+//! is pinned, the copy is queued on host_transfer_stream() and waited for, as the callers read
+//! the data right after the transfer; pageable memory goes through hipMemcpy2D.
+//!
+inline hipError_t host_transfer(void*         dst,
+                                size_t        dpitch,
+                                const void*   src,
+                                size_t        spitch,
+                                size_t        width,
+                                size_t        height,
+                                hipMemcpyKind kind,
+                                bool          pinned)
+{
+    if(width == 0 || height == 0)
+        return hipSuccess;
+    if(!pinned)
+        return height == 1 ? hipMemcpy(dst, src, width, kind)
+                           : hipMemcpy2D(dst, dpitch, src, spitch, width, height, kind);
+
+    hipStream_t stream = host_transfer_stream();
+    hipError_t  err
+        = height == 1 ? hipMemcpyAsync(dst, src, width, kind, stream)
+                      : hipMemcpy2DAsync(dst, dpitch, src, spitch, width, height, kind, stream);
+    if(err != hipSuccess)
+        return err;
+    return hipStreamSynchronize(stream);
+}
+
+//!
+//! @brief Same as above, for a contiguous block of bytes.
+//!
+inline hipError_t
+    host_transfer(void* dst, const void* src, size_t bytes, hipMemcpyKind kind, bool pinned)
+{
+    return host_transfer(dst, bytes, src, bytes, bytes, 1, kind, pinned);
+}
+
+//!
+//! @brief Allocates zero-initialized host memory.
+//! @param bytes  The size of the allocation.
+//! @param pinned Allocate pinned memory if true, pageable memory otherwise.
+//! @return The allocated memory, or nullptr if the allocation failed.
+//!
+inline void* host_calloc(size_t bytes, bool pinned)
+{
+    if(!pinned)
+        return calloc(1, bytes);
+
+    void* p = nullptr;
+    if(hipHostMalloc(&p, bytes, hipHostMallocDefault) != hipSuccess)
+        return nullptr;
+    memset(p, 0, bytes);
+    return p;
+}
+
+//!
+//! @brief Frees memory allocated by host_calloc.
+//!
+inline void host_free(void* p, bool pinned)
+{
+    if(pinned)
+        hipHostFree(p);
+    else
+        free(p);
+}
+
+//!
+//! @brief Allocator of the host vectors. The kind of memory is fixed when the allocator is
+//! created, following host_pinned_memory().
+//!
+template <typename T>
+struct host_allocator
+{
+    using value_type = T;
+
+    bool pinned = host_pinned_memory();
+
+    host_allocator() = default;
+
+    template <typename U>
+    host_allocator(const host_allocator<U>& that)
+        : pinned(that.pinned)
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        T* p = static_cast<T*>(host_calloc(n * sizeof(T), pinned));
+        if(!p)
+            throw std::bad_alloc();
+        return p;
+    }
+
+    void deallocate(T* p, size_t)
+    {
+        host_free(p, pinned);
+    }
+
+    template <typename U>
+    bool operator==(const host_allocator<U>& that) const
+    {
+        return pinned == that.pinned;
+    }
+
+    template <typename U>
+    bool operator!=(const host_allocator<U>& that) const
+    {
+        return pinned != that.pinned;
+    }
+};
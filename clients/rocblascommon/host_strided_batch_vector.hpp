@@ -1,8 +1,10 @@
 /* ************************************************************************
- * Copyright 2018-2020 Advanced Micro Devices, Inc.
+ * Copyright 2018-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #pragma once
 
+#include "host_memory.hpp"
+
 //
 // Local declaration of the device strided batch vector.
 //
@@ -10,7 +12,8 @@ template <typename T, size_t PAD, typename U>
 class device_strided_batch_vector;
 
 //!
-//! @brief Implementation of a host strided batched vector.
+//! @brief Implementation of a host strided batched vector. The memory is pinned if
+//! host_pinned_memory() is set.
 //!
 template <typename T>
 class host_strided_batch_vector
@@ -83,7 +86,7 @@ public:
 
             if(valid_parameters)
             {
-                this->m_data = new T[this->m_nmemb];
+                this->m_data = (T*)host_calloc(sizeof(T) * this->m_nmemb, this->m_pinned);
             }
         }
     }
@@ -95,7 +98,7 @@ public:
     {
         if(nullptr != this->m_data)
         {
-            delete[] this->m_data;
+            host_free(this->m_data, this->m_pinned);
             this->m_data = nullptr;
         }
     }
@@ -225,8 +228,19 @@ public:
     template <size_t PAD, typename U>
     hipError_t transfer_from(const device_strided_batch_vector<T, PAD, U>& that)
     {
-        return hipMemcpy(
-            this->m_data, that.data(), sizeof(T) * this->m_nmemb, hipMemcpyDeviceToHost);
+        return host_transfer(this->m_data,
+                             that.data(),
+                             sizeof(T) * this->m_nmemb,
+                             hipMemcpyDeviceToHost,
+                             this->m_pinned);
+    }
+
+    //!
+    //! @brief Tells whether the memory of the vector is pinned.
+    //!
+    bool pinned() const
+    {
+        return this->m_pinned;
     }
 
     //!
@@ -245,6 +259,7 @@ private:
     rocblas_stride m_stride{};
     rocblas_int    m_batch_count{};
     size_t         m_nmemb{};
+    bool           m_pinned = host_pinned_memory();
     T*             m_data{};
 
     static size_t calculate_nmemb(
@@ -1,26 +1,27 @@
 /* ************************************************************************
- * Copyright 2018-2020 Advanced Micro Devices, Inc.
+ * Copyright 2018-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #pragma once
 
+#include "host_memory.hpp"
 #include <cmath>
 #include <type_traits>
 #include <vector>
 
 //!
-//! @brief  Pseudo-vector subclass which uses host memory.
+//! @brief  Pseudo-vector subclass which uses host memory, pinned if host_pinned_memory() is set.
 //!
 template <typename T>
-struct host_vector : std::vector<T>
+struct host_vector : std::vector<T, host_allocator<T>>
 {
     // Inherit constructors
-    using std::vector<T>::vector;
+    using std::vector<T, host_allocator<T>>::vector;
 
     //!
     //! @brief Constructor.
     //!
     host_vector(size_t n, ptrdiff_t inc)
-        : std::vector<T>(n * std::abs(inc))
+        : std::vector<T, host_allocator<T>>(n * std::abs(inc))
         , m_n(n)
         , m_inc(inc)
     {
@@ -31,7 +32,7 @@ struct host_vector : std::vector<T>
     //!
     template <typename U, std::enable_if_t<std::is_convertible<U, T>{}, int> = 0>
     host_vector(const host_vector<U>& x)
-        : std::vector<T>(x.size())
+        : std::vector<T, host_allocator<T>>(x.size())
         , m_n(x.size())
         , m_inc(1)
     {
@@ -62,7 +63,16 @@ struct host_vector : std::vector<T>
     //!
     hipError_t transfer_from(const device_vector<T>& that)
     {
-        return hipMemcpy(*this, that, sizeof(T) * this->size(), hipMemcpyDeviceToHost);
+        return host_transfer(
+            *this, that, sizeof(T) * this->size(), hipMemcpyDeviceToHost, this->pinned());
+    }
+
+    //!
+    //! @brief Tells whether the memory of the vector is pinned.
+    //!
+    bool pinned() const
+    {
+        return this->get_allocator().pinned;
     }
 
     //!
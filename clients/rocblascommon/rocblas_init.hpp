@@ -20,15 +20,19 @@
 // for complex number, the real/imag part would be initialized with the same
 // value
 
-// Initialize vector with random values
-template <typename T>
-void rocblas_init(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+// Calls func(b, j) for every column j of every matrix b of a batch, spreading the columns among
+// the host threads when there are enough elements to make it worthwhile
+template <typename F>
+void rocblas_init_columns(size_t M, size_t N, size_t batch_count, F func)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
+    if(M * N * batch_count < (1 << 16))
+    {
+        for(size_t b = 0; b < batch_count; b++)
             for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_generator<T>();
+                func(b, j);
+    }
+    else
+        hipsolver_parallel_for(N * batch_count, [&](size_t c) { func(c / N, c % N); });
 }
 
 // Initialize vector with random values
@@ -36,10 +40,20 @@ template <typename T>
 inline void
     rocblas_init(T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
+    uint64_t key = hipsolver_next_random_key();
+    rocblas_init_columns(M, N, batch_count, [&](size_t b, size_t j) {
+        T* col = A + j * lda + b * stride;
         for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_generator<T>();
+            col[i] = random_generator<T>(key, b, i + j * lda);
+    });
+}
+
+// Initialize vector with random values
+template <typename T>
+void rocblas_init(
+    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+{
+    rocblas_init(A.data(), M, N, lda, stride, batch_count);
 }
 
 template <typename T>
@@ -61,28 +75,24 @@ void rocblas_init_sin(
 // mantissa 10 bits.
 template <typename T>
 void rocblas_init_alternating_sign(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+    T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
+    uint64_t key = hipsolver_next_random_key();
+    rocblas_init_columns(M, N, batch_count, [&](size_t b, size_t j) {
+        T* col = A + j * lda + b * stride;
         for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-            {
-                auto value                        = random_generator<T>();
-                A[i + j * lda + i_batch * stride] = (i ^ j) & 1 ? value : negate(value);
-            }
+        {
+            auto value = random_generator<T>(key, b, i + j * lda);
+            col[i]     = (i ^ j) & 1 ? value : negate(value);
+        }
+    });
 }
 
 template <typename T>
 void rocblas_init_alternating_sign(
-    T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-            {
-                auto value                        = random_generator<T>();
-                A[i + j * lda + i_batch * stride] = (i ^ j) & 1 ? value : negate(value);
-            }
+    rocblas_init_alternating_sign(A.data(), M, N, lda, stride, batch_count);
 }
 
 template <typename T>
@@ -96,37 +106,29 @@ void rocblas_init_cos(
 }
 
 /*! \brief  symmetric matrix initialization: */
-// for real matrix only
 template <typename T>
-void rocblas_init_symmetric(std::vector<T>& A, size_t N, size_t lda)
+void rocblas_init_symmetric(T* A, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
-    for(size_t i = 0; i < N; ++i)
-        for(size_t j = 0; j <= i; ++j)
+    // column j sets the lower part of column j and the upper part of row j, so the columns can be
+    // filled in parallel
+    uint64_t key = hipsolver_next_random_key();
+    rocblas_init_columns(N, N, batch_count, [&](size_t b, size_t j) {
+        T* Ab = A + b * stride;
+        for(size_t i = j; i < N; ++i)
         {
-            auto value = random_generator<T>();
-            // Warning: It's undefined behavior to assign to the
-            // same array element twice in same sequence point (i==j)
-            A[j + i * lda] = value;
-            A[i + j * lda] = value;
+            auto value      = random_generator<T>(key, b, i + j * lda);
+            Ab[i + j * lda] = value;
+            Ab[j + i * lda] = value;
         }
+    });
 }
 
 /*! \brief  symmetric matrix initialization: */
+// for real matrix only
 template <typename T>
-void rocblas_init_symmetric(T* A, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+void rocblas_init_symmetric(std::vector<T>& A, size_t N, size_t lda)
 {
-    for(size_t b = 0; b < batch_count; ++b)
-    {
-        for(size_t i = 0; i < N; ++i)
-            for(size_t j = 0; j <= i; ++j)
-            {
-                auto value = random_generator<T>();
-                // Warning: It's undefined behavior to assign to the
-                // same array element twice in same sequence point (i==j)
-                A[b * stride + j + i * lda] = value;
-                A[b * stride + i + j * lda] = value;
-            }
-    }
+    rocblas_init_symmetric(A.data(), N, lda);
 }
 
 /*! \brief  symmetric matrix clear: */
@@ -153,14 +155,16 @@ void rocblas_clear_symmetric(
 template <typename T>
 void rocblas_init_hermitian(std::vector<T>& A, size_t N, size_t lda)
 {
-    for(size_t i = 0; i < N; ++i)
-        for(size_t j = 0; j <= i; ++j)
+    uint64_t key = hipsolver_next_random_key();
+    rocblas_init_columns(N, N, 1, [&](size_t b, size_t j) {
+        for(size_t i = j; i < N; ++i)
         {
-            auto value     = random_generator<T>();
+            auto value     = random_generator<T>(key, b, i + j * lda);
             A[j + i * lda] = value;
             value.y        = (i == j) ? 0 : negate(value.y);
             A[i + j * lda] = value;
         }
+    });
 }
 
 // // Initialize vector with HPL-like random values
@@ -18,9 +18,9 @@
 //! @brief Random number with type deductions.
 //!
 template <typename T>
-void random_generator(T& n)
+void random_generator(T& n, uint64_t key, uint64_t batch, uint64_t index)
 {
-    n = random_generator<T>();
+    n = random_generator<T>(key, batch, index);
 }
 
 //!
@@ -46,8 +46,8 @@ void rocblas_init_template(U& that, bool seedReset = false)
         hipsolver_seedrand();
     }
 
-    for(rocblas_int batch_index = 0; batch_index < that.batch_count(); ++batch_index)
-    {
+    uint64_t key = hipsolver_next_random_key();
+    rocblas_init_columns(that.n(), 1, that.batch_count(), [&](size_t batch_index, size_t) {
         auto batched_data = that[batch_index];
         auto inc          = std::abs(that.inc());
         auto n            = that.n();
@@ -58,9 +58,9 @@ void rocblas_init_template(U& that, bool seedReset = false)
 
         for(rocblas_int i = 0; i < n; ++i)
         {
-            random_generator(batched_data[i * inc]);
+            random_generator(batched_data[i * inc], key, batch_index, i);
         }
-    }
+    });
 }
 
 //!
@@ -128,7 +128,7 @@ void rocblas_init(host_vector<T>& that, bool seedReset = false)
     {
         hipsolver_seedrand();
     }
-    rocblas_init(that, 1, that.size(), 1);
+    rocblas_init(that.data(), that.size(), 1, that.size());
 }
 
 //!
@@ -7,8 +7,15 @@
 // #include "clientcommon.hpp"
 // #include "rocblas.h"
 #include "../include/complex.hpp"
+#include "../include/utility.hpp"
 #include "hipsolver.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
 using rocblas_float_complex  = hipsolverComplex;
 using rocblas_double_complex = hipsolverDoubleComplex;
 
@@ -67,49 +74,96 @@ inline void xaxpy(int*                    n,
 }
 
 /* Norm of error functions */
+
+// Squared absolute values of gold and of the difference comp - gold
 template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
-double norm_error(char        norm_type,
-                  rocblas_int M,
-                  rocblas_int N,
-                  rocblas_int lda_gold,
-                  T*          gold,
-                  T*          comp,
-                  rocblas_int lda_comp = 0)
+inline void norm_error_abs2(const T& gold, const T& comp, double& ref, double& err)
 {
-    // norm type can be 'O', 'I', 'F', 'o', 'i', 'f' for one, infinity or
-    // Frobenius norm one norm is max column sum infinity norm is max row sum
-    // Frobenius is l2 norm of matrix entries
+    double g = double(gold);
+    double d = double(comp) - g;
+    ref      = g * g;
+    err      = d * d;
+}
 
-    rocblas_int lda = M;
-    lda_comp        = lda_comp > 0 ? lda_comp : lda_gold;
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+inline void norm_error_abs2(const T& gold, const T& comp, double& ref, double& err)
+{
+    double gr = double(std::real(gold)), gi = double(std::imag(gold));
+    double dr = double(std::real(comp)) - gr, di = double(std::imag(comp)) - gi;
+    ref       = gr * gr + gi * gi;
+    err       = dr * dr + di * di;
+}
 
-    host_vector<double> gold_double(N * lda);
-    host_vector<double> comp_double(N * lda);
+// Scaled sum of squares scale^2 * ssq, accumulated as in xlassq so that it does not overflow or
+// underflow. A NaN makes the sum NaN.
+struct norm_error_ssq
+{
+    double scale = 0;
+    double ssq   = 1;
 
-    for(rocblas_int i = 0; i < M; i++)
+    void add(double x)
     {
-        for(rocblas_int j = 0; j < N; j++)
+        double a = std::abs(x);
+        if(a > 0 || std::isnan(a))
         {
-            gold_double[i + j * lda] = double(gold[i + j * lda_gold]);
-            comp_double[i + j * lda] = double(comp[i + j * lda_comp]);
+            if(scale < a)
+            {
+                ssq   = 1 + ssq * (scale / a) * (scale / a);
+                scale = a;
+            }
+            else
+                ssq += (a / scale) * (a / scale);
         }
     }
 
-    double      work[M];
-    rocblas_int incx  = 1;
-    double      alpha = -1.0;
-    rocblas_int size  = lda * N;
+    // adds a sum accumulated separately
+    void add(const norm_error_ssq& other)
+    {
+        if(scale < other.scale)
+        {
+            ssq   = other.ssq + ssq * (scale / other.scale) * (scale / other.scale);
+            scale = other.scale;
+        }
+        else if(scale > 0 || std::isnan(other.ssq))
+            ssq += other.ssq * (other.scale / scale) * (other.scale / scale);
+    }
 
-    double gold_norm = xlange(&norm_type, &M, &N, gold_double.data(), &lda, work);
-    xaxpy(&size, &alpha, gold_double.data(), &incx, comp_double.data(), &incx);
-    double error = xlange(&norm_type, &M, &N, comp_double.data(), &lda, work);
-    if(gold_norm > 0)
-        error /= gold_norm;
+    double value() const
+    {
+        return scale * std::sqrt(ssq);
+    }
+};
 
-    return error;
+// Adds gold and comp - gold to the sums of squares ref and err; for complex types, the real and
+// imaginary parts are added separately, as in xlassq
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+inline void
+    norm_error_ssq_add(const T& gold, const T& comp, norm_error_ssq& ref, norm_error_ssq& err)
+{
+    double g = double(gold);
+    ref.add(g);
+    err.add(double(comp) - g);
 }
 
 template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+inline void
+    norm_error_ssq_add(const T& gold, const T& comp, norm_error_ssq& ref, norm_error_ssq& err)
+{
+    double gr = double(std::real(gold)), gi = double(std::imag(gold));
+    ref.add(gr);
+    ref.add(gi);
+    err.add(double(std::real(comp)) - gr);
+    err.add(double(std::imag(comp)) - gi);
+}
+
+// acc = max(acc, x), where a NaN in either operand gives NaN, as in xlange
+inline void norm_error_max(double& acc, double x)
+{
+    if(x > acc || std::isnan(x))
+        acc = x;
+}
+
+template <typename T>
 double norm_error(char        norm_type,
                   rocblas_int M,
                   rocblas_int N,
@@ -120,33 +174,100 @@ double norm_error(char        norm_type,
 {
     // norm type can be 'O', 'I', 'F', 'o', 'i', 'f' for one, infinity or
     // Frobenius norm one norm is max column sum infinity norm is max row sum
-    // Frobenius is l2 norm of matrix entries
+    // Frobenius is l2 norm of matrix entries. A NaN in gold or comp gives a NaN
+    // error, as with xlange
+
+    lda_comp  = lda_comp > 0 ? lda_comp : lda_gold;
+    char type = char(std::toupper(norm_type));
+    if(type != 'O' && type != 'I' && type != 'F')
+        throw std::invalid_argument("norm_error: invalid norm type");
+    if(M <= 0 || N <= 0)
+        return 0;
+
+    // ||comp - gold|| and ||gold|| are computed in a single pass over the columns. The columns
+    // are split into at most 64 blocks of at least 64K elements, which are reduced in parallel
+    // and then combined in order, so that the result does not depend on the number of threads
+    size_t bcols  = std::max((N + 63) / 64, (65536 + M - 1) / M);
+    size_t blocks = (N + bcols - 1) / bcols;
+
+    std::vector<double>         ref(blocks, 0), err(blocks, 0);
+    std::vector<norm_error_ssq> ref_ssq(type == 'F' ? blocks : 0);
+    std::vector<norm_error_ssq> err_ssq(type == 'F' ? blocks : 0);
+    std::vector<double>         row_ref(type == 'I' ? blocks * M : 0, 0);
+    std::vector<double>         row_err(type == 'I' ? blocks * M : 0, 0);
 
-    rocblas_int lda = M;
-    lda_comp        = lda_comp > 0 ? lda_comp : lda_gold;
+    hipsolver_parallel_for(blocks, [&](size_t k) {
+        size_t jend = std::min(size_t(N), (k + 1) * bcols);
+        for(size_t j = k * bcols; j < jend; j++)
+        {
+            const T* g       = gold + j * lda_gold;
+            const T* c       = comp + j * lda_comp;
+            double   col_ref = 0, col_err = 0;
+            double   r, e;
 
-    host_vector<rocblas_double_complex> gold_double(N * lda);
-    host_vector<rocblas_double_complex> comp_double(N * lda);
+            if(type == 'F')
+            {
+                for(rocblas_int i = 0; i < M; i++)
+                    norm_error_ssq_add(g[i], c[i], ref_ssq[k], err_ssq[k]);
+            }
+            else if(type == 'I')
+            {
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    norm_error_abs2(g[i], c[i], r, e);
+                    row_ref[k * M + i] += std::sqrt(r);
+                    row_err[k * M + i] += std::sqrt(e);
+                }
+            }
+            else
+            {
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    norm_error_abs2(g[i], c[i], r, e);
+                    col_ref += std::sqrt(r);
+                    col_err += std::sqrt(e);
+                }
+                norm_error_max(ref[k], col_ref);
+                norm_error_max(err[k], col_err);
+            }
+        }
+    });
 
-    for(rocblas_int i = 0; i < M; i++)
+    double gold_norm = 0, error = 0;
+    if(type == 'F')
     {
-        for(rocblas_int j = 0; j < N; j++)
+        norm_error_ssq r, e;
+        for(size_t k = 0; k < blocks; k++)
         {
-            gold_double[i + j * lda] = rocblas_double_complex(std::real(gold[i + j * lda_gold]),
-                                                              std::imag(gold[i + j * lda_gold]));
-            comp_double[i + j * lda] = rocblas_double_complex(std::real(comp[i + j * lda_comp]),
-                                                              std::imag(comp[i + j * lda_comp]));
+            r.add(ref_ssq[k]);
+            e.add(err_ssq[k]);
+        }
+        gold_norm = r.value();
+        error     = e.value();
+    }
+    else if(type == 'I')
+    {
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            double r = 0, e = 0;
+            for(size_t k = 0; k < blocks; k++)
+            {
+                r += row_ref[k * M + i];
+                e += row_err[k * M + i];
+            }
+            norm_error_max(gold_norm, r);
+            norm_error_max(error, e);
+        }
+    }
+    else
+    {
+        for(size_t k = 0; k < blocks; k++)
+        {
+            norm_error_max(gold_norm, ref[k]);
+            norm_error_max(error, err[k]);
         }
     }
 
-    double                 work[M];
-    rocblas_int            incx  = 1;
-    rocblas_double_complex alpha = -1.0;
-    rocblas_int            size  = lda * N;
-
-    double gold_norm = xlange(&norm_type, &M, &N, gold_double.data(), &lda, work);
-    xaxpy(&size, &alpha, gold_double.data(), &incx, comp_double.data(), &incx);
-    double error = xlange(&norm_type, &M, &N, comp_double.data(), &lda, work);
     if(gold_norm > 0)
         error /= gold_norm;
 
@@ -157,15 +278,12 @@ template <typename T>
 double norm_error_upperTr(
     char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, T* gold, T* comp)
 {
-    for(rocblas_int i = 0; i < M; ++i)
+    for(rocblas_int j = 0; j < N; ++j)
     {
-        for(rocblas_int j = 0; j < N; ++j)
+        for(rocblas_int i = j + 1; i < M; ++i)
         {
-            if(i > j)
-            {
-                gold[i + j * lda] = T(0);
-                comp[i + j * lda] = T(0);
-            }
+            gold[i + j * lda] = T(0);
+            comp[i + j * lda] = T(0);
         }
     }
     return norm_error(norm_type, M, N, lda, gold, comp);
@@ -175,15 +293,12 @@ template <typename T>
 double norm_error_lowerTr(
     char norm_type, rocblas_int M, rocblas_int N, rocblas_int lda, T* gold, T* comp)
 {
-    for(rocblas_int i = 0; i < M; ++i)
+    for(rocblas_int j = 0; j < N; ++j)
     {
-        for(rocblas_int j = 0; j < N; ++j)
+        for(rocblas_int i = 0; i < std::min(j, M); ++i)
         {
-            if(i < j)
-            {
-                gold[i + j * lda] = T(0);
-                comp[i + j * lda] = T(0);
-            }
+            gold[i + j * lda] = T(0);
+            comp[i + j * lda] = T(0);
         }
     }
     return norm_error(norm_type, M, N, lda, gold, comp);
@@ -86,6 +86,16 @@ public:
         to_consume.erase("perf");
         to_consume.erase("singular");
         to_consume.erase("device");
+        to_consume.erase("cpu_threads");
+        to_consume.erase("pinned");
+        to_consume.erase("output-format");
+        to_consume.erase("plan");
+        to_consume.erase("time_budget");
+        to_consume.erase("warmup");
+        to_consume.erase("sizem");
+        to_consume.erase("sizen");
+        to_consume.erase("sizenrhs");
+        to_consume.erase("sizebatch");
     }
 
     void clear()
@@ -1,5 +1,5 @@
 /* ************************************************************************
- * Copyright 2018-2021 Advanced Micro Devices, Inc.
+ * Copyright 2018-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
 #pragma once
@@ -8,6 +8,10 @@
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #define ROCSOLVER_BENCH_INFORM(case)                                    \
     do                                                                  \
@@ -35,10 +39,87 @@ constexpr double get_epsilon()
 #define ROCSOLVER_TEST_CHECK(T, max_error, tol)
 #endif
 
+// Collects the names and values printed by rocsolver_bench_output, so that the benchmark
+// client can also report them in a machine-readable format. A line made only of strings is
+// taken as the names of the values in the next line.
+class rocsolver_bench_record
+{
+    using field = std::pair<std::string, std::string>;
+
+    std::vector<std::string> m_line;
+    std::vector<std::string> m_names;
+    std::vector<field>       m_fields;
+    bool                     m_line_is_names = true;
+
+public:
+    bool enabled = false;
+
+    static rocsolver_bench_record& get()
+    {
+        static rocsolver_bench_record record;
+        return record;
+    }
+
+    template <typename T>
+    void add_item(const T& arg)
+    {
+        std::stringstream ss;
+        ss << arg;
+        m_line.push_back(ss.str());
+        m_line_is_names = m_line_is_names && std::is_convertible<T, const char*>::value;
+    }
+
+    void end_line()
+    {
+        if(m_line.empty())
+            return;
+
+        if(m_line_is_names)
+            m_names = m_line;
+        else if(m_names.size() == m_line.size())
+        {
+            for(size_t i = 0; i < m_line.size(); i++)
+                m_fields.emplace_back(m_names[i], m_line[i]);
+            m_names.clear();
+        }
+        else
+        {
+            // values printed without names follow the layout of the perf mode
+            const char* perf_names[] = {"gpu_time", "error"};
+            for(size_t i = 0; i < m_line.size() && i < 2; i++)
+                m_fields.emplace_back(perf_names[i], m_line[i]);
+        }
+
+        m_line.clear();
+        m_line_is_names = true;
+    }
+
+    void add_field(const std::string& name, const std::string& value)
+    {
+        m_fields.emplace_back(name, value);
+    }
+
+    const std::vector<field>& fields() const
+    {
+        return m_fields;
+    }
+
+    void clear()
+    {
+        m_line.clear();
+        m_names.clear();
+        m_fields.clear();
+        m_line_is_names = true;
+    }
+};
+
 inline void rocsolver_bench_output()
 {
     // empty version
     std::cerr << std::endl;
+
+    if(rocsolver_bench_record::get().enabled)
+        rocsolver_bench_record::get().end_line();
 }
 
 template <typename T, typename... Ts>
@@ -47,6 +128,9 @@ inline void rocsolver_bench_output(T arg, Ts... args)
     std::stringstream ss;
     ss << std::left << std::setw(15) << arg;
 
+    if(rocsolver_bench_record::get().enabled)
+        rocsolver_bench_record::get().add_item(arg);
+
     std::cerr << ss.str();
     if(sizeof...(Ts) > 0)
         std::cerr << ' ';
@@ -22,8 +22,6 @@ typedef hipsolverHandle_t hipsolverDnHandle_t;
 
 typedef void* hipsolverGesvdjInfo_t;
 
-typedef void* hipsolverSyevjInfo_t;
-
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -988,6 +986,135 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZgesvd(hipsolverHandle_t handle,
                                                      double*           rwork,
                                                      int*              devInfo);
 
+// gesvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                               signed char       jobu,
+                                               signed char       jobv,
+                                               int               m,
+                                               int               n,
+                                               int*              lwork,
+                                               int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                               signed char       jobu,
+                                               signed char       jobv,
+                                               int               m,
+                                               int               n,
+                                               int*              lwork,
+                                               int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                               signed char       jobu,
+                                               signed char       jobv,
+                                               int               m,
+                                               int               n,
+                                               int*              lwork,
+                                               int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                               signed char       jobu,
+                                               signed char       jobv,
+                                               int               m,
+                                               int               n,
+                                               int*              lwork,
+                                               int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                   signed char       jobu,
+                                                                   signed char       jobv,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   float*            A,
+                                                                   int               lda,
+                                                                   int               strideA,
+                                                                   float*            S,
+                                                                   int               strideS,
+                                                                   float*            U,
+                                                                   int               ldu,
+                                                                   int               strideU,
+                                                                   float*            V,
+                                                                   int               ldv,
+                                                                   int               strideV,
+                                                                   float*            work,
+                                                                   int               lwork,
+                                                                   float*            rwork,
+                                                                   int               strideRwork,
+                                                                   int*              devInfo,
+                                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                   signed char       jobu,
+                                                                   signed char       jobv,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   double*           A,
+                                                                   int               lda,
+                                                                   int               strideA,
+                                                                   double*           S,
+                                                                   int               strideS,
+                                                                   double*           U,
+                                                                   int               ldu,
+                                                                   int               strideU,
+                                                                   double*           V,
+                                                                   int               ldv,
+                                                                   int               strideV,
+                                                                   double*           work,
+                                                                   int               lwork,
+                                                                   double*           rwork,
+                                                                   int               strideRwork,
+                                                                   int*              devInfo,
+                                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                   signed char       jobu,
+                                                                   signed char       jobv,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   hipFloatComplex*  A,
+                                                                   int               lda,
+                                                                   int               strideA,
+                                                                   float*            S,
+                                                                   int               strideS,
+                                                                   hipFloatComplex*  U,
+                                                                   int               ldu,
+                                                                   int               strideU,
+                                                                   hipFloatComplex*  V,
+                                                                   int               ldv,
+                                                                   int               strideV,
+                                                                   hipFloatComplex*  work,
+                                                                   int               lwork,
+                                                                   float*            rwork,
+                                                                   int               strideRwork,
+                                                                   int*              devInfo,
+                                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                   signed char       jobu,
+                                                                   signed char       jobv,
+                                                                   int               m,
+                                                                   int               n,
+                                                                   hipDoubleComplex* A,
+                                                                   int               lda,
+                                                                   int               strideA,
+                                                                   double*           S,
+                                                                   int               strideS,
+                                                                   hipDoubleComplex* U,
+                                                                   int               ldu,
+                                                                   int               strideU,
+                                                                   hipDoubleComplex* V,
+                                                                   int               ldv,
+                                                                   int               strideV,
+                                                                   hipDoubleComplex* work,
+                                                                   int               lwork,
+                                                                   double*           rwork,
+                                                                   int               strideRwork,
+                                                                   int*              devInfo,
+                                                                   int               batch_count);
+
 // gesvdj
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSgesvdj_bufferSize(hipsolverDnHandle_t   handle,
                                                                  hipsolverEigMode_t    jobz,
@@ -29,6 +29,48 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetStream(hipsolverHandle_t handle,
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetStream(hipsolverHandle_t handle,
                                                       hipStream_t*      streamId);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetMatrixLayout(hipsolverHandle_t handle,
+                                                             hipsolverLayout_t layout);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetMatrixLayout(hipsolverHandle_t  handle,
+                                                             hipsolverLayout_t* layout);
+
+// handle pool
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolSetCapacity(int capacity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolGetCapacity(int* capacity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolReserve(int count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolClear(void);
+
+// coalescer
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCoalescerCreate(hipsolverCoalescer_t* coalescer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCoalescerDestroy(hipsolverCoalescer_t coalescer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCoalescerSetMaxBatch(hipsolverCoalescer_t coalescer,
+                                                                 int                  max_batch);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCoalescerSetWindow(hipsolverCoalescer_t coalescer,
+                                                               int                  microseconds);
+
+// tuning
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetSvdAlg(hipsolverHandle_t handle,
+                                                      hipsolverSvdAlg_t alg);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetSvdAlg(hipsolverHandle_t  handle,
+                                                      hipsolverSvdAlg_t* alg);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetEigAlg(hipsolverHandle_t handle,
+                                                      hipsolverEigAlg_t alg);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetEigAlg(hipsolverHandle_t  handle,
+                                                      hipsolverEigAlg_t* alg);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverLoadTuningTable(hipsolverHandle_t handle,
+                                                            const char*       path);
+
 // orgbr/ungbr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverSideMode_t side,
@@ -721,6 +763,83 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
                                                    int               lwork,
                                                    int*              devInfo);
 
+// geqrf_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      float*            A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      double*           A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      hipFloatComplex*  A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      hipDoubleComplex* A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           float*            A[],
+                                                           const int*        lda,
+                                                           float*            tau,
+                                                           float*            work,
+                                                           int               lwork,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           double*           A[],
+                                                           const int*        lda,
+                                                           double*           tau,
+                                                           double*           work,
+                                                           int               lwork,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           hipFloatComplex*  A[],
+                                                           const int*        lda,
+                                                           hipFloatComplex*  tau,
+                                                           hipFloatComplex*  work,
+                                                           int               lwork,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           hipDoubleComplex* A[],
+                                                           const int*        lda,
+                                                           hipDoubleComplex* tau,
+                                                           hipDoubleComplex* work,
+                                                           int               lwork,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
 // gesv
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
                                                               int               n,
@@ -911,6 +1030,135 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
                                                    double*           rwork,
                                                    int*              devInfo);
 
+// gesvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            S,
+                                                                 int               strideS,
+                                                                 float*            U,
+                                                                 int               ldu,
+                                                                 int               strideU,
+                                                                 float*            V,
+                                                                 int               ldv,
+                                                                 int               strideV,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 float*            rwork,
+                                                                 int               strideRwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           S,
+                                                                 int               strideS,
+                                                                 double*           U,
+                                                                 int               ldu,
+                                                                 int               strideU,
+                                                                 double*           V,
+                                                                 int               ldv,
+                                                                 int               strideV,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 double*           rwork,
+                                                                 int               strideRwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipFloatComplex*  A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            S,
+                                                                 int               strideS,
+                                                                 hipFloatComplex*  U,
+                                                                 int               ldu,
+                                                                 int               strideU,
+                                                                 hipFloatComplex*  V,
+                                                                 int               ldv,
+                                                                 int               strideV,
+                                                                 hipFloatComplex*  work,
+                                                                 int               lwork,
+                                                                 float*            rwork,
+                                                                 int               strideRwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipDoubleComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           S,
+                                                                 int               strideS,
+                                                                 hipDoubleComplex* U,
+                                                                 int               ldu,
+                                                                 int               strideU,
+                                                                 hipDoubleComplex* V,
+                                                                 int               ldv,
+                                                                 int               strideV,
+                                                                 hipDoubleComplex* work,
+                                                                 int               lwork,
+                                                                 double*           rwork,
+                                                                 int               strideRwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
 // getrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -964,6 +1212,197 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
                                                    int*              devIpiv,
                                                    int*              devInfo);
 
+// getrf_coalesced
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           int                  m,
+                                                           int                  n,
+                                                           float*               A,
+                                                           int                  lda,
+                                                           int*                 devIpiv,
+                                                           int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           int                  m,
+                                                           int                  n,
+                                                           double*              A,
+                                                           int                  lda,
+                                                           int*                 devIpiv,
+                                                           int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           int                  m,
+                                                           int                  n,
+                                                           hipFloatComplex*     A,
+                                                           int                  lda,
+                                                           int*                 devIpiv,
+                                                           int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           int                  m,
+                                                           int                  n,
+                                                           hipDoubleComplex*    A,
+                                                           int                  lda,
+                                                           int*                 devIpiv,
+                                                           int*                 devInfo);
+
+// getrf_interleaved
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         int               m,
+                                                                         int               n,
+                                                                         float*            A,
+                                                                         int               lda,
+                                                                         int*              lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         int               m,
+                                                                         int               n,
+                                                                         double*           A,
+                                                                         int               lda,
+                                                                         int*              lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         int               m,
+                                                                         int               n,
+                                                                         hipFloatComplex*  A,
+                                                                         int               lda,
+                                                                         int*              lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         int               m,
+                                                                         int               n,
+                                                                         hipDoubleComplex* A,
+                                                                         int               lda,
+                                                                         int*              lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfInterleaved(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              float*            A,
+                                                              int               lda,
+                                                              float*            work,
+                                                              int               lwork,
+                                                              int*              devIpiv,
+                                                              int*              devInfo,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfInterleaved(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           work,
+                                                              int               lwork,
+                                                              int*              devIpiv,
+                                                              int*              devInfo,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfInterleaved(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              hipFloatComplex*  A,
+                                                              int               lda,
+                                                              hipFloatComplex*  work,
+                                                              int               lwork,
+                                                              int*              devIpiv,
+                                                              int*              devInfo,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfInterleaved(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              hipDoubleComplex* work,
+                                                              int               lwork,
+                                                              int*              devIpiv,
+                                                              int*              devInfo,
+                                                              int               batch_count);
+
+// getrf_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      float*            A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      double*           A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      hipFloatComplex*  A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                                      const int*        m,
+                                                                      const int*        n,
+                                                                      hipDoubleComplex* A[],
+                                                                      const int*        lda,
+                                                                      int*              lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           float*            A[],
+                                                           const int*        lda,
+                                                           float*            work,
+                                                           int               lwork,
+                                                           int*              devIpiv,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           double*           A[],
+                                                           const int*        lda,
+                                                           double*           work,
+                                                           int               lwork,
+                                                           int*              devIpiv,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           hipFloatComplex*  A[],
+                                                           const int*        lda,
+                                                           hipFloatComplex*  work,
+                                                           int               lwork,
+                                                           int*              devIpiv,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        m,
+                                                           const int*        n,
+                                                           hipDoubleComplex* A[],
+                                                           const int*        lda,
+                                                           hipDoubleComplex* work,
+                                                           int               lwork,
+                                                           int*              devIpiv,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
 // getrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverOperation_t trans,
@@ -1061,6 +1500,1206 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
                                                    int                  lwork,
                                                    int*                 devInfo);
 
+// getrs_interleaved
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         hipsolverOperation_t trans,
+                                                                         int                  n,
+                                                                         int                  nrhs,
+                                                                         float*               A,
+                                                                         int                  lda,
+                                                                         int* devIpiv,
+                                                                         float*               B,
+                                                                         int                  ldb,
+                                                                         int*                 lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         hipsolverOperation_t trans,
+                                                                         int                  n,
+                                                                         int                  nrhs,
+                                                                         double*              A,
+                                                                         int                  lda,
+                                                                         int* devIpiv,
+                                                                         double*              B,
+                                                                         int                  ldb,
+                                                                         int*                 lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         hipsolverOperation_t trans,
+                                                                         int                  n,
+                                                                         int                  nrhs,
+                                                                         hipFloatComplex*     A,
+                                                                         int                  lda,
+                                                                         int* devIpiv,
+                                                                         hipFloatComplex*     B,
+                                                                         int                  ldb,
+                                                                         int*                 lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                                         hipsolverOperation_t trans,
+                                                                         int                  n,
+                                                                         int                  nrhs,
+                                                                         hipDoubleComplex*    A,
+                                                                         int                  lda,
+                                                                         int* devIpiv,
+                                                                         hipDoubleComplex*    B,
+                                                                         int                  ldb,
+                                                                         int*                 lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsInterleaved(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              float*               A,
+                                                              int                  lda,
+                                                              int*                 devIpiv,
+                                                              float*               B,
+                                                              int                  ldb,
+                                                              float*               work,
+                                                              int                  lwork,
+                                                              int*                 devInfo,
+                                                              int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsInterleaved(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              double*              A,
+                                                              int                  lda,
+                                                              int*                 devIpiv,
+                                                              double*              B,
+                                                              int                  ldb,
+                                                              double*              work,
+                                                              int                  lwork,
+                                                              int*                 devInfo,
+                                                              int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsInterleaved(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              hipFloatComplex*     A,
+                                                              int                  lda,
+                                                              int*                 devIpiv,
+                                                              hipFloatComplex*     B,
+                                                              int                  ldb,
+                                                              hipFloatComplex*     work,
+                                                              int                  lwork,
+                                                              int*                 devInfo,
+                                                              int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsInterleaved(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  nrhs,
+                                                              hipDoubleComplex*    A,
+                                                              int                  lda,
+                                                              int*                 devIpiv,
+                                                              hipDoubleComplex*    B,
+                                                              int                  ldb,
+                                                              hipDoubleComplex*    work,
+                                                              int                  lwork,
+                                                              int*                 devInfo,
+                                                              int                  batch_count);
+
+// gtsv
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsv_bufferSize(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             int               nrhs,
+                                                             float*            dl,
+                                                             float*            d,
+                                                             float*            du,
+                                                             float*            B,
+                                                             int               ldb,
+                                                             int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsv_bufferSize(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             int               nrhs,
+                                                             double*           dl,
+                                                             double*           d,
+                                                             double*           du,
+                                                             double*           B,
+                                                             int               ldb,
+                                                             int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsv_bufferSize(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             int               nrhs,
+                                                             hipFloatComplex*  dl,
+                                                             hipFloatComplex*  d,
+                                                             hipFloatComplex*  du,
+                                                             hipFloatComplex*  B,
+                                                             int               ldb,
+                                                             int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsv_bufferSize(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             int               nrhs,
+                                                             hipDoubleComplex* dl,
+                                                             hipDoubleComplex* d,
+                                                             hipDoubleComplex* du,
+                                                             hipDoubleComplex* B,
+                                                             int               ldb,
+                                                             int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsv(hipsolverHandle_t handle,
+                                                  int               n,
+                                                  int               nrhs,
+                                                  float*            dl,
+                                                  float*            d,
+                                                  float*            du,
+                                                  float*            B,
+                                                  int               ldb,
+                                                  float*            work,
+                                                  int               lwork,
+                                                  int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsv(hipsolverHandle_t handle,
+                                                  int               n,
+                                                  int               nrhs,
+                                                  double*           dl,
+                                                  double*           d,
+                                                  double*           du,
+                                                  double*           B,
+                                                  int               ldb,
+                                                  double*           work,
+                                                  int               lwork,
+                                                  int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsv(hipsolverHandle_t handle,
+                                                  int               n,
+                                                  int               nrhs,
+                                                  hipFloatComplex*  dl,
+                                                  hipFloatComplex*  d,
+                                                  hipFloatComplex*  du,
+                                                  hipFloatComplex*  B,
+                                                  int               ldb,
+                                                  hipFloatComplex*  work,
+                                                  int               lwork,
+                                                  int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsv(hipsolverHandle_t handle,
+                                                  int               n,
+                                                  int               nrhs,
+                                                  hipDoubleComplex* dl,
+                                                  hipDoubleComplex* d,
+                                                  hipDoubleComplex* du,
+                                                  hipDoubleComplex* B,
+                                                  int               ldb,
+                                                  hipDoubleComplex* work,
+                                                  int               lwork,
+                                                  int*              devInfo);
+
+// gtsv_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           float*            dl,
+                                                                           float*            d,
+                                                                           float*            du,
+                                                                           int strideD,
+                                                                           float*            B,
+                                                                           int               ldb,
+                                                                           int strideB,
+                                                                           int*              lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           double*           dl,
+                                                                           double*           d,
+                                                                           double*           du,
+                                                                           int strideD,
+                                                                           double*           B,
+                                                                           int               ldb,
+                                                                           int strideB,
+                                                                           int*              lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           hipFloatComplex*  dl,
+                                                                           hipFloatComplex*  d,
+                                                                           hipFloatComplex*  du,
+                                                                           int strideD,
+                                                                           hipFloatComplex*  B,
+                                                                           int               ldb,
+                                                                           int strideB,
+                                                                           int*              lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           int               n,
+                                                                           int               nrhs,
+                                                                           hipDoubleComplex* dl,
+                                                                           hipDoubleComplex* d,
+                                                                           hipDoubleComplex* du,
+                                                                           int strideD,
+                                                                           hipDoubleComplex* B,
+                                                                           int               ldb,
+                                                                           int strideB,
+                                                                           int*              lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvStridedBatched(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                float*            dl,
+                                                                float*            d,
+                                                                float*            du,
+                                                                int               strideD,
+                                                                float*            B,
+                                                                int               ldb,
+                                                                int               strideB,
+                                                                float*            work,
+                                                                int               lwork,
+                                                                int*              devInfo,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvStridedBatched(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           dl,
+                                                                double*           d,
+                                                                double*           du,
+                                                                int               strideD,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                int               strideB,
+                                                                double*           work,
+                                                                int               lwork,
+                                                                int*              devInfo,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvStridedBatched(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipFloatComplex*  dl,
+                                                                hipFloatComplex*  d,
+                                                                hipFloatComplex*  du,
+                                                                int               strideD,
+                                                                hipFloatComplex*  B,
+                                                                int               ldb,
+                                                                int               strideB,
+                                                                hipFloatComplex*  work,
+                                                                int               lwork,
+                                                                int*              devInfo,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvStridedBatched(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* dl,
+                                                                hipDoubleComplex* d,
+                                                                hipDoubleComplex* du,
+                                                                int               strideD,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                int               strideB,
+                                                                hipDoubleComplex* work,
+                                                                int               lwork,
+                                                                int*              devInfo,
+                                                                int               batch_count);
+
+// gtsv_nopivot
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    float*            dl,
+                                                                    float*            d,
+                                                                    float*            du,
+                                                                    float*            B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    double*           dl,
+                                                                    double*           d,
+                                                                    double*           du,
+                                                                    double*           B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    hipFloatComplex*  dl,
+                                                                    hipFloatComplex*  d,
+                                                                    hipFloatComplex*  du,
+                                                                    hipFloatComplex*  B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    int               nrhs,
+                                                                    hipDoubleComplex* dl,
+                                                                    hipDoubleComplex* d,
+                                                                    hipDoubleComplex* du,
+                                                                    hipDoubleComplex* B,
+                                                                    int               ldb,
+                                                                    int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvNopivot(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         float*            dl,
+                                                         float*            d,
+                                                         float*            du,
+                                                         float*            B,
+                                                         int               ldb,
+                                                         float*            work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvNopivot(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         double*           dl,
+                                                         double*           d,
+                                                         double*           du,
+                                                         double*           B,
+                                                         int               ldb,
+                                                         double*           work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvNopivot(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         hipFloatComplex*  dl,
+                                                         hipFloatComplex*  d,
+                                                         hipFloatComplex*  du,
+                                                         hipFloatComplex*  B,
+                                                         int               ldb,
+                                                         hipFloatComplex*  work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvNopivot(hipsolverHandle_t handle,
+                                                         int               n,
+                                                         int               nrhs,
+                                                         hipDoubleComplex* dl,
+                                                         hipDoubleComplex* d,
+                                                         hipDoubleComplex* du,
+                                                         hipDoubleComplex* B,
+                                                         int               ldb,
+                                                         hipDoubleComplex* work,
+                                                         int               lwork,
+                                                         int*              devInfo);
+
+// gtsv_nopivot_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            dl,
+                                                   float*            d,
+                                                   float*            du,
+                                                   int               strideD,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           dl,
+                                                   double*           d,
+                                                   double*           du,
+                                                   int               strideD,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipFloatComplex*  dl,
+                                                   hipFloatComplex*  d,
+                                                   hipFloatComplex*  du,
+                                                   int               strideD,
+                                                   hipFloatComplex*  B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* dl,
+                                                   hipDoubleComplex* d,
+                                                   hipDoubleComplex* du,
+                                                   int               strideD,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       float*            dl,
+                                                                       float*            d,
+                                                                       float*            du,
+                                                                       int               strideD,
+                                                                       float*            B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       float*            work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       double*           dl,
+                                                                       double*           d,
+                                                                       double*           du,
+                                                                       int               strideD,
+                                                                       double*           B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       double*           work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       hipFloatComplex*  dl,
+                                                                       hipFloatComplex*  d,
+                                                                       hipFloatComplex*  du,
+                                                                       int               strideD,
+                                                                       hipFloatComplex*  B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       hipFloatComplex*  work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                                       int               n,
+                                                                       int               nrhs,
+                                                                       hipDoubleComplex* dl,
+                                                                       hipDoubleComplex* d,
+                                                                       hipDoubleComplex* du,
+                                                                       int               strideD,
+                                                                       hipDoubleComplex* B,
+                                                                       int               ldb,
+                                                                       int               strideB,
+                                                                       hipDoubleComplex* work,
+                                                                       int               lwork,
+                                                                       int*              devInfo,
+                                                                       int batch_count);
+
+// pbtrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              float*              AB,
+                                                              int                 ldab,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              double*             AB,
+                                                              int                 ldab,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              hipFloatComplex*    AB,
+                                                              int                 ldab,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              hipDoubleComplex*   AB,
+                                                              int                 ldab,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   float*              AB,
+                                                   int                 ldab,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   double*             AB,
+                                                   int                 ldab,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   hipFloatComplex*    AB,
+                                                   int                 ldab,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   hipDoubleComplex*   AB,
+                                                   int                 ldab,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+// pbtrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             float*              AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             double*             AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             hipFloatComplex*    AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             hipDoubleComplex*   AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 float*              AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 double*             AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 hipFloatComplex*    AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 hipDoubleComplex*   AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+// pbtrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              int                 nrhs,
+                                                              float*              AB,
+                                                              int                 ldab,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              int                 nrhs,
+                                                              double*             AB,
+                                                              int                 ldab,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              int                 nrhs,
+                                                              hipFloatComplex*    AB,
+                                                              int                 ldab,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              int                 nrhs,
+                                                              hipDoubleComplex*   AB,
+                                                              int                 ldab,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   int                 nrhs,
+                                                   float*              AB,
+                                                   int                 ldab,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   int                 nrhs,
+                                                   double*             AB,
+                                                   int                 ldab,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    AB,
+                                                   int                 ldab,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   AB,
+                                                   int                 ldab,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+// pbtrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             float*              AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             float*              B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             double*             AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             double*             B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             hipFloatComplex*    AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 int                 nrhs,
+                                                                 float*              AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 int                 nrhs,
+                                                                 double*             AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 int                 nrhs,
+                                                                 hipFloatComplex*    AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 int                 nrhs,
+                                                                 hipDoubleComplex*   AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+// posv
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             float*              A,
+                                                             int                 lda,
+                                                             float*              B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             double*             A,
+                                                             int                 lda,
+                                                             double*             B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipFloatComplex*    A,
+                                                             int                 lda,
+                                                             hipFloatComplex*    B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipDoubleComplex*   A,
+                                                             int                 lda,
+                                                             hipDoubleComplex*   B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  float*              A,
+                                                  int                 lda,
+                                                  float*              B,
+                                                  int                 ldb,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  double*             A,
+                                                  int                 lda,
+                                                  double*             B,
+                                                  int                 ldb,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  hipFloatComplex*    A,
+                                                  int                 lda,
+                                                  hipFloatComplex*    B,
+                                                  int                 ldb,
+                                                  hipFloatComplex*    work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  hipDoubleComplex*   A,
+                                                  int                 lda,
+                                                  hipDoubleComplex*   B,
+                                                  int                 ldb,
+                                                  hipDoubleComplex*   work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+// posv_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    float*              A[],
+                                                                    int                 lda,
+                                                                    float*              B[],
+                                                                    int                 ldb,
+                                                                    int*                lwork,
+                                                                    int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    double*             A[],
+                                                                    int                 lda,
+                                                                    double*             B[],
+                                                                    int                 ldb,
+                                                                    int*                lwork,
+                                                                    int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    hipFloatComplex*    A[],
+                                                                    int                 lda,
+                                                                    hipFloatComplex*    B[],
+                                                                    int                 ldb,
+                                                                    int*                lwork,
+                                                                    int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 nrhs,
+                                                                    hipDoubleComplex*   A[],
+                                                                    int                 lda,
+                                                                    hipDoubleComplex*   B[],
+                                                                    int                 ldb,
+                                                                    int*                lwork,
+                                                                    int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         float*              A[],
+                                                         int                 lda,
+                                                         float*              B[],
+                                                         int                 ldb,
+                                                         float*              work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         double*             A[],
+                                                         int                 lda,
+                                                         double*             B[],
+                                                         int                 ldb,
+                                                         double*             work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         hipFloatComplex*    A[],
+                                                         int                 lda,
+                                                         hipFloatComplex*    B[],
+                                                         int                 ldb,
+                                                         hipFloatComplex*    work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         hipDoubleComplex*   A[],
+                                                         int                 lda,
+                                                         hipDoubleComplex*   B[],
+                                                         int                 ldb,
+                                                         hipDoubleComplex*   work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+// posv_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           hipsolverFillMode_t uplo,
+                                                                           int                 n,
+                                                                           int                 nrhs,
+                                                                           float*              A,
+                                                                           int                 lda,
+                                                                           int strideA,
+                                                                           float*              B,
+                                                                           int                 ldb,
+                                                                           int strideB,
+                                                                           int* lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           hipsolverFillMode_t uplo,
+                                                                           int                 n,
+                                                                           int                 nrhs,
+                                                                           double*             A,
+                                                                           int                 lda,
+                                                                           int strideA,
+                                                                           double*             B,
+                                                                           int                 ldb,
+                                                                           int strideB,
+                                                                           int* lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           hipsolverFillMode_t uplo,
+                                                                           int                 n,
+                                                                           int                 nrhs,
+                                                                           hipFloatComplex*    A,
+                                                                           int                 lda,
+                                                                           int strideA,
+                                                                           hipFloatComplex*    B,
+                                                                           int                 ldb,
+                                                                           int strideB,
+                                                                           int* lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                           hipsolverFillMode_t uplo,
+                                                                           int                 n,
+                                                                           int                 nrhs,
+                                                                           hipDoubleComplex*   A,
+                                                                           int                 lda,
+                                                                           int strideA,
+                                                                           hipDoubleComplex*   B,
+                                                                           int                 ldb,
+                                                                           int strideB,
+                                                                           int* lwork,
+                                                                           int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                float*              A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                float*              B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                float*              work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                double*             A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                double*             B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                double*             work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipFloatComplex*    A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                hipFloatComplex*    B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                hipFloatComplex*    work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipDoubleComplex*   A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                hipDoubleComplex*   B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                hipDoubleComplex*   work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
 // potrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSize(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1191,6 +2830,856 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   ha
                                                           int*                devInfo,
                                                           int                 batch_count);
 
+// potrf_coalesced
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           hipsolverFillMode_t  uplo,
+                                                           int                  n,
+                                                           float*               A,
+                                                           int                  lda,
+                                                           int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           hipsolverFillMode_t  uplo,
+                                                           int                  n,
+                                                           double*              A,
+                                                           int                  lda,
+                                                           int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           hipsolverFillMode_t  uplo,
+                                                           int                  n,
+                                                           hipFloatComplex*     A,
+                                                           int                  lda,
+                                                           int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfCoalesced(hipsolverHandle_t    handle,
+                                                           hipsolverCoalescer_t coalescer,
+                                                           hipsolverFillMode_t  uplo,
+                                                           int                  n,
+                                                           hipDoubleComplex*    A,
+                                                           int                  lda,
+                                                           int*                 devInfo);
+
+// potrf_interleaved
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         float*              A,
+                                                                         int                 lda,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         double*             A,
+                                                                         int                 lda,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         hipFloatComplex*    A,
+                                                                         int                 lda,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         hipDoubleComplex*   A,
+                                                                         int                 lda,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              float*              work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              double*             work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipFloatComplex*    A,
+                                                              int                 lda,
+                                                              hipFloatComplex*    work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipDoubleComplex*   A,
+                                                              int                 lda,
+                                                              hipDoubleComplex*   work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+// potrf_pipelined
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            float*              B,
+                                                            int                 ldb,
+                                                            int*                info,
+                                                            int                 batch_count,
+                                                            int                 chunk_size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            double*             B,
+                                                            int                 ldb,
+                                                            int*                info,
+                                                            int                 batch_count,
+                                                            int                 chunk_size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            hipFloatComplex*    A,
+                                                            int                 lda,
+                                                            hipFloatComplex*    B,
+                                                            int                 ldb,
+                                                            int*                info,
+                                                            int                 batch_count,
+                                                            int                 chunk_size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfPipelined(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            hipDoubleComplex*   A,
+                                                            int                 lda,
+                                                            hipDoubleComplex*   B,
+                                                            int                 ldb,
+                                                            int*                info,
+                                                            int                 batch_count,
+                                                            int                 chunk_size);
+
+// potrf_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      float*              A[],
+                                                                      const int*          lda,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      double*             A[],
+                                                                      const int*          lda,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      hipFloatComplex*    A[],
+                                                                      const int*          lda,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      hipDoubleComplex*   A[],
+                                                                      const int*          lda,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           float*              A[],
+                                                           const int*          lda,
+                                                           float*              work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           double*             A[],
+                                                           const int*          lda,
+                                                           double*             work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           hipFloatComplex*    A[],
+                                                           const int*          lda,
+                                                           hipFloatComplex*    work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           hipDoubleComplex*   A[],
+                                                           const int*          lda,
+                                                           hipDoubleComplex*   work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+// potrf_update
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 k,
+                                                                    float*              A,
+                                                                    int                 lda,
+                                                                    float*              V,
+                                                                    int                 ldv,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 k,
+                                                                    double*             A,
+                                                                    int                 lda,
+                                                                    double*             V,
+                                                                    int                 ldv,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 k,
+                                                                    hipFloatComplex*    A,
+                                                                    int                 lda,
+                                                                    hipFloatComplex*    V,
+                                                                    int                 ldv,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 k,
+                                                                    hipDoubleComplex*   A,
+                                                                    int                 lda,
+                                                                    hipDoubleComplex*   V,
+                                                                    int                 ldv,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdate(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 k,
+                                                         float*              A,
+                                                         int                 lda,
+                                                         float*              V,
+                                                         int                 ldv,
+                                                         float*              work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdate(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 k,
+                                                         double*             A,
+                                                         int                 lda,
+                                                         double*             V,
+                                                         int                 ldv,
+                                                         double*             work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdate(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 k,
+                                                         hipFloatComplex*    A,
+                                                         int                 lda,
+                                                         hipFloatComplex*    V,
+                                                         int                 ldv,
+                                                         hipFloatComplex*    work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfUpdate(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 k,
+                                                         hipDoubleComplex*   A,
+                                                         int                 lda,
+                                                         hipDoubleComplex*   V,
+                                                         int                 ldv,
+                                                         hipDoubleComplex*   work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+// potrf_update_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            float*              A[],
+                                            int                 lda,
+                                            float*              V[],
+                                            int                 ldv,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            double*             A[],
+                                            int                 lda,
+                                            double*             V[],
+                                            int                 ldv,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            hipFloatComplex*    A[],
+                                            int                 lda,
+                                            hipFloatComplex*    V[],
+                                            int                 ldv,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            hipDoubleComplex*   A[],
+                                            int                 lda,
+                                            hipDoubleComplex*   V[],
+                                            int                 ldv,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                float*              A[],
+                                                                int                 lda,
+                                                                float*              V[],
+                                                                int                 ldv,
+                                                                float*              work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                double*             A[],
+                                                                int                 lda,
+                                                                double*             V[],
+                                                                int                 ldv,
+                                                                double*             work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                hipFloatComplex*    A[],
+                                                                int                 lda,
+                                                                hipFloatComplex*    V[],
+                                                                int                 ldv,
+                                                                hipFloatComplex*    work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                hipDoubleComplex*   A[],
+                                                                int                 lda,
+                                                                hipDoubleComplex*   V[],
+                                                                int                 ldv,
+                                                                hipDoubleComplex*   work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+// potrf_update_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   float*              V,
+                                                   int                 ldv,
+                                                   int                 strideV,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   double*             V,
+                                                   int                 ldv,
+                                                   int                 strideV,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   hipFloatComplex*    V,
+                                                   int                 ldv,
+                                                   int                 strideV,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   int                 strideA,
+                                                   hipDoubleComplex*   V,
+                                                   int                 ldv,
+                                                   int                 strideV,
+                                                   int*                lwork,
+                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        float*              A,
+                                        int                 lda,
+                                        int                 strideA,
+                                        float*              V,
+                                        int                 ldv,
+                                        int                 strideV,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        double*             A,
+                                        int                 lda,
+                                        int                 strideA,
+                                        double*             V,
+                                        int                 ldv,
+                                        int                 strideV,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        hipFloatComplex*    A,
+                                        int                 lda,
+                                        int                 strideA,
+                                        hipFloatComplex*    V,
+                                        int                 ldv,
+                                        int                 strideV,
+                                        hipFloatComplex*    work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        hipDoubleComplex*   A,
+                                        int                 lda,
+                                        int                 strideA,
+                                        hipDoubleComplex*   V,
+                                        int                 ldv,
+                                        int                 strideV,
+                                        hipDoubleComplex*   work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count);
+
+// potrf_downdate
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      int                 n,
+                                                                      int                 k,
+                                                                      float*              A,
+                                                                      int                 lda,
+                                                                      float*              V,
+                                                                      int                 ldv,
+                                                                      int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      int                 n,
+                                                                      int                 k,
+                                                                      double*             A,
+                                                                      int                 lda,
+                                                                      double*             V,
+                                                                      int                 ldv,
+                                                                      int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      int                 n,
+                                                                      int                 k,
+                                                                      hipFloatComplex*    A,
+                                                                      int                 lda,
+                                                                      hipFloatComplex*    V,
+                                                                      int                 ldv,
+                                                                      int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      int                 n,
+                                                                      int                 k,
+                                                                      hipDoubleComplex*   A,
+                                                                      int                 lda,
+                                                                      hipDoubleComplex*   V,
+                                                                      int                 ldv,
+                                                                      int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfDowndate(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           float*              A,
+                                                           int                 lda,
+                                                           float*              V,
+                                                           int                 ldv,
+                                                           float*              work,
+                                                           int                 lwork,
+                                                           int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfDowndate(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           double*             A,
+                                                           int                 lda,
+                                                           double*             V,
+                                                           int                 ldv,
+                                                           double*             work,
+                                                           int                 lwork,
+                                                           int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfDowndate(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           hipFloatComplex*    A,
+                                                           int                 lda,
+                                                           hipFloatComplex*    V,
+                                                           int                 ldv,
+                                                           hipFloatComplex*    work,
+                                                           int                 lwork,
+                                                           int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfDowndate(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           hipDoubleComplex*   A,
+                                                           int                 lda,
+                                                           hipDoubleComplex*   V,
+                                                           int                 ldv,
+                                                           hipDoubleComplex*   work,
+                                                           int                 lwork,
+                                                           int*                devInfo);
+
+// potrf_downdate_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              float*              A[],
+                                              int                 lda,
+                                              float*              V[],
+                                              int                 ldv,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              double*             A[],
+                                              int                 lda,
+                                              double*             V[],
+                                              int                 ldv,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              hipFloatComplex*    A[],
+                                              int                 lda,
+                                              hipFloatComplex*    V[],
+                                              int                 ldv,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 k,
+                                              hipDoubleComplex*   A[],
+                                              int                 lda,
+                                              hipDoubleComplex*   V[],
+                                              int                 ldv,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  float*              A[],
+                                                                  int                 lda,
+                                                                  float*              V[],
+                                                                  int                 ldv,
+                                                                  float*              work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  double*             A[],
+                                                                  int                 lda,
+                                                                  double*             V[],
+                                                                  int                 ldv,
+                                                                  double*             work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  hipFloatComplex*    A[],
+                                                                  int                 lda,
+                                                                  hipFloatComplex*    V[],
+                                                                  int                 ldv,
+                                                                  hipFloatComplex*    work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  hipDoubleComplex*   A[],
+                                                                  int                 lda,
+                                                                  hipDoubleComplex*   V[],
+                                                                  int                 ldv,
+                                                                  hipDoubleComplex*   work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+// potrf_downdate_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     int                 strideA,
+                                                     float*              V,
+                                                     int                 ldv,
+                                                     int                 strideV,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     int                 strideA,
+                                                     double*             V,
+                                                     int                 ldv,
+                                                     int                 strideV,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipFloatComplex*    A,
+                                                     int                 lda,
+                                                     int                 strideA,
+                                                     hipFloatComplex*    V,
+                                                     int                 ldv,
+                                                     int                 strideV,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipDoubleComplex*   A,
+                                                     int                 lda,
+                                                     int                 strideA,
+                                                     hipDoubleComplex*   V,
+                                                     int                 ldv,
+                                                     int                 strideV,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          float*              A,
+                                          int                 lda,
+                                          int                 strideA,
+                                          float*              V,
+                                          int                 ldv,
+                                          int                 strideV,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          double*             A,
+                                          int                 lda,
+                                          int                 strideA,
+                                          double*             V,
+                                          int                 ldv,
+                                          int                 strideV,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          hipFloatComplex*    A,
+                                          int                 lda,
+                                          int                 strideA,
+                                          hipFloatComplex*    V,
+                                          int                 ldv,
+                                          int                 strideV,
+                                          hipFloatComplex*    work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          hipDoubleComplex*   A,
+                                          int                 lda,
+                                          int                 strideA,
+                                          hipDoubleComplex*   V,
+                                          int                 ldv,
+                                          int                 strideV,
+                                          hipDoubleComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count);
+
 // potri
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotri_bufferSize(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1434,6 +3923,539 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   ha
                                                           int*                devInfo,
                                                           int                 batch_count);
 
+// potrs_interleaved
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 nrhs,
+                                                                         float*              A,
+                                                                         int                 lda,
+                                                                         float*              B,
+                                                                         int                 ldb,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 nrhs,
+                                                                         double*             A,
+                                                                         int                 lda,
+                                                                         double*             B,
+                                                                         int                 ldb,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 nrhs,
+                                                                         hipFloatComplex*    A,
+                                                                         int                 lda,
+                                                                         hipFloatComplex*    B,
+                                                                         int                 ldb,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                                         hipsolverFillMode_t uplo,
+                                                                         int                 n,
+                                                                         int                 nrhs,
+                                                                         hipDoubleComplex*   A,
+                                                                         int                 lda,
+                                                                         hipDoubleComplex*   B,
+                                                                         int                 ldb,
+                                                                         int*                lwork,
+                                                                         int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              float*              work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              double*             work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipFloatComplex*    A,
+                                                              int                 lda,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              hipFloatComplex*    work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsInterleaved(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipDoubleComplex*   A,
+                                                              int                 lda,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              hipDoubleComplex*   work,
+                                                              int                 lwork,
+                                                              int*                devInfo,
+                                                              int                 batch_count);
+
+// potrs_vbatched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      const int*          nrhs,
+                                                                      float*              A[],
+                                                                      const int*          lda,
+                                                                      float*              B[],
+                                                                      const int*          ldb,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      const int*          nrhs,
+                                                                      double*             A[],
+                                                                      const int*          lda,
+                                                                      double*             B[],
+                                                                      const int*          ldb,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      const int*          nrhs,
+                                                                      hipFloatComplex*    A[],
+                                                                      const int*          lda,
+                                                                      hipFloatComplex*    B[],
+                                                                      const int*          ldb,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                                      hipsolverFillMode_t uplo,
+                                                                      const int*          n,
+                                                                      const int*          nrhs,
+                                                                      hipDoubleComplex*   A[],
+                                                                      const int*          lda,
+                                                                      hipDoubleComplex*   B[],
+                                                                      const int*          ldb,
+                                                                      int*                lwork,
+                                                                      int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           const int*          nrhs,
+                                                           float*              A[],
+                                                           const int*          lda,
+                                                           float*              B[],
+                                                           const int*          ldb,
+                                                           float*              work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           const int*          nrhs,
+                                                           double*             A[],
+                                                           const int*          lda,
+                                                           double*             B[],
+                                                           const int*          ldb,
+                                                           double*             work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           const int*          nrhs,
+                                                           hipFloatComplex*    A[],
+                                                           const int*          lda,
+                                                           hipFloatComplex*    B[],
+                                                           const int*          ldb,
+                                                           hipFloatComplex*    work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           const int*          nrhs,
+                                                           hipDoubleComplex*   A[],
+                                                           const int*          lda,
+                                                           hipDoubleComplex*   B[],
+                                                           const int*          ldb,
+                                                           hipDoubleComplex*   work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+// pptrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipFloatComplex* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipDoubleComplex* AP, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              AP,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             AP,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipFloatComplex*    AP,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   AP,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+// pptrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              float*              AP,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              double*             AP,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipFloatComplex*    AP,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipDoubleComplex*   AP,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpptrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              AP,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpptrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             AP,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpptrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    AP,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpptrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   AP,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+// spevd/hpevd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSspevd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              float*              AP,
+                                                              float*              D,
+                                                              float*              Z,
+                                                              int                 ldz,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDspevd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              double*             AP,
+                                                              double*             D,
+                                                              double*             Z,
+                                                              int                 ldz,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChpevd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipFloatComplex*    AP,
+                                                              float*              D,
+                                                              hipFloatComplex*    Z,
+                                                              int                 ldz,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhpevd_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipDoubleComplex*   AP,
+                                                              double*             D,
+                                                              hipDoubleComplex*   Z,
+                                                              int                 ldz,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSspevd(hipsolverHandle_t   handle,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              AP,
+                                                   float*              D,
+                                                   float*              Z,
+                                                   int                 ldz,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDspevd(hipsolverHandle_t   handle,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             AP,
+                                                   double*             D,
+                                                   double*             Z,
+                                                   int                 ldz,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChpevd(hipsolverHandle_t   handle,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipFloatComplex*    AP,
+                                                   float*              D,
+                                                   hipFloatComplex*    Z,
+                                                   int                 ldz,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhpevd(hipsolverHandle_t   handle,
+                                                   hipsolverEigMode_t  jobz,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   AP,
+                                                   double*             D,
+                                                   hipDoubleComplex*   Z,
+                                                   int                 ldz,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+// trttp
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverStrttp(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, float* AP);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDtrttp(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, double* AP);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCtrttp(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   hipFloatComplex*    AP);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZtrttp(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   hipDoubleComplex*   AP);
+
+// tpttr
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverStpttr(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, float* A, int lda);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDtpttr(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, double* A, int lda);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCtpttr(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipFloatComplex*    AP,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZtpttr(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipDoubleComplex*   AP,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda);
+
+// interleavedToStrided
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSinterleavedToStrided(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const float*      A,
+                                                                  int               lda,
+                                                                  float*            B,
+                                                                  int               ldb,
+                                                                  int               strideB,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDinterleavedToStrided(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const double*     A,
+                                                                  int               lda,
+                                                                  double*           B,
+                                                                  int               ldb,
+                                                                  int               strideB,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCinterleavedToStrided(hipsolverHandle_t      handle,
+                                                                  int                    m,
+                                                                  int                    n,
+                                                                  const hipFloatComplex* A,
+                                                                  int                    lda,
+                                                                  hipFloatComplex*       B,
+                                                                  int                    ldb,
+                                                                  int                    strideB,
+                                                                  int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZinterleavedToStrided(hipsolverHandle_t       handle,
+                                                                  int                     m,
+                                                                  int                     n,
+                                                                  const hipDoubleComplex* A,
+                                                                  int                     lda,
+                                                                  hipDoubleComplex*       B,
+                                                                  int                     ldb,
+                                                                  int                     strideB,
+                                                                  int batch_count);
+
+// stridedToInterleaved
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSstridedToInterleaved(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const float*      A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  float*            B,
+                                                                  int               ldb,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDstridedToInterleaved(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const double*     A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  double*           B,
+                                                                  int               ldb,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCstridedToInterleaved(hipsolverHandle_t      handle,
+                                                                  int                    m,
+                                                                  int                    n,
+                                                                  const hipFloatComplex* A,
+                                                                  int                    lda,
+                                                                  int                    strideA,
+                                                                  hipFloatComplex*       B,
+                                                                  int                    ldb,
+                                                                  int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZstridedToInterleaved(hipsolverHandle_t       handle,
+                                                                  int                     m,
+                                                                  int                     n,
+                                                                  const hipDoubleComplex* A,
+                                                                  int                     lda,
+                                                                  int                     strideA,
+                                                                  hipDoubleComplex*       B,
+                                                                  int                     ldb,
+                                                                  int batch_count);
+
 // syevd/heevd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverEigMode_t  jobz,
@@ -1515,6 +4537,55 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+// syevj_pipelined/heevj_pipelined
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjPipelined(hipsolverHandle_t    handle,
+                                                            hipsolverEigMode_t   jobz,
+                                                            hipsolverFillMode_t  uplo,
+                                                            int                  n,
+                                                            float*               A,
+                                                            int                  lda,
+                                                            float*               W,
+                                                            int*                 info,
+                                                            hipsolverSyevjInfo_t params,
+                                                            int                  batch_count,
+                                                            int                  chunk_size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjPipelined(hipsolverHandle_t    handle,
+                                                            hipsolverEigMode_t   jobz,
+                                                            hipsolverFillMode_t  uplo,
+                                                            int                  n,
+                                                            double*              A,
+                                                            int                  lda,
+                                                            double*              W,
+                                                            int*                 info,
+                                                            hipsolverSyevjInfo_t params,
+                                                            int                  batch_count,
+                                                            int                  chunk_size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjPipelined(hipsolverHandle_t    handle,
+                                                            hipsolverEigMode_t   jobz,
+                                                            hipsolverFillMode_t  uplo,
+                                                            int                  n,
+                                                            hipFloatComplex*     A,
+                                                            int                  lda,
+                                                            float*               W,
+                                                            int*                 info,
+                                                            hipsolverSyevjInfo_t params,
+                                                            int                  batch_count,
+                                                            int                  chunk_size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjPipelined(hipsolverHandle_t    handle,
+                                                            hipsolverEigMode_t   jobz,
+                                                            hipsolverFillMode_t  uplo,
+                                                            int                  n,
+                                                            hipDoubleComplex*    A,
+                                                            int                  lda,
+                                                            double*              W,
+                                                            int*                 info,
+                                                            hipsolverSyevjInfo_t params,
+                                                            int                  batch_count,
+                                                            int                  chunk_size);
+
 // sygvd/hegvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverEigType_t  itype,
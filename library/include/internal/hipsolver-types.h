@@ -13,6 +13,10 @@
 
 typedef void* hipsolverHandle_t;
 
+typedef void* hipsolverCoalescer_t;
+
+typedef void* hipsolverSyevjInfo_t;
+
 typedef enum
 {
     HIPSOLVER_STATUS_SUCCESS           = 0, // Function succeeds
@@ -30,6 +34,12 @@ typedef enum
 } hipsolverStatus_t;
 
 // set the values of enum constants to be the same as those used in cblas
+typedef enum
+{
+    HIPSOLVER_LAYOUT_ROW_MAJOR    = 101,
+    HIPSOLVER_LAYOUT_COLUMN_MAJOR = 102,
+} hipsolverLayout_t;
+
 typedef enum
 {
     HIPSOLVER_OP_N = 111,
@@ -62,4 +72,18 @@ typedef enum
     HIPSOLVER_EIG_TYPE_3 = 213,
 } hipsolverEigType_t;
 
+typedef enum
+{
+    HIPSOLVER_SVD_ALG_AUTO       = 301,
+    HIPSOLVER_SVD_ALG_OUTOFPLACE = 302,
+    HIPSOLVER_SVD_ALG_INPLACE    = 303,
+} hipsolverSvdAlg_t;
+
+typedef enum
+{
+    HIPSOLVER_EIG_ALG_AUTO = 311,
+    HIPSOLVER_EIG_ALG_DC   = 312,
+    HIPSOLVER_EIG_ALG_QR   = 313,
+} hipsolverEigAlg_t;
+
 #endif // HIPSOLVER_TYPES_H
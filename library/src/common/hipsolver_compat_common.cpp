@@ -1143,6 +1143,239 @@ hipsolverStatus_t hipsolverDnZgesvd(hipsolverHandle_t handle,
         handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, devInfo);
 }
 
+// gesvd_strided_batched
+hipsolverStatus_t hipsolverDnSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                             signed char       jobu,
+                                                             signed char       jobv,
+                                                             int               m,
+                                                             int               n,
+                                                             int*              lwork,
+                                                             int               batch_count)
+{
+    return hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count);
+}
+
+hipsolverStatus_t hipsolverDnDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                             signed char       jobu,
+                                                             signed char       jobv,
+                                                             int               m,
+                                                             int               n,
+                                                             int*              lwork,
+                                                             int               batch_count)
+{
+    return hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count);
+}
+
+hipsolverStatus_t hipsolverDnCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                             signed char       jobu,
+                                                             signed char       jobv,
+                                                             int               m,
+                                                             int               n,
+                                                             int*              lwork,
+                                                             int               batch_count)
+{
+    return hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count);
+}
+
+hipsolverStatus_t hipsolverDnZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                             signed char       jobu,
+                                                             signed char       jobv,
+                                                             int               m,
+                                                             int               n,
+                                                             int*              lwork,
+                                                             int               batch_count)
+{
+    return hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count);
+}
+
+hipsolverStatus_t hipsolverDnSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                  signed char       jobu,
+                                                  signed char       jobv,
+                                                  int               m,
+                                                  int               n,
+                                                  float*            A,
+                                                  int               lda,
+                                                  int               strideA,
+                                                  float*            S,
+                                                  int               strideS,
+                                                  float*            U,
+                                                  int               ldu,
+                                                  int               strideU,
+                                                  float*            V,
+                                                  int               ldv,
+                                                  int               strideV,
+                                                  float*            work,
+                                                  int               lwork,
+                                                  float*            rwork,
+                                                  int               strideRwork,
+                                                  int*              devInfo,
+                                                  int               batch_count)
+{
+    return hipsolverSgesvdStridedBatched(handle,
+                                         jobu,
+                                         jobv,
+                                         m,
+                                         n,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         S,
+                                         strideS,
+                                         U,
+                                         ldu,
+                                         strideU,
+                                         V,
+                                         ldv,
+                                         strideV,
+                                         work,
+                                         lwork,
+                                         rwork,
+                                         strideRwork,
+                                         devInfo,
+                                         batch_count);
+}
+
+hipsolverStatus_t hipsolverDnDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                  signed char       jobu,
+                                                  signed char       jobv,
+                                                  int               m,
+                                                  int               n,
+                                                  double*           A,
+                                                  int               lda,
+                                                  int               strideA,
+                                                  double*           S,
+                                                  int               strideS,
+                                                  double*           U,
+                                                  int               ldu,
+                                                  int               strideU,
+                                                  double*           V,
+                                                  int               ldv,
+                                                  int               strideV,
+                                                  double*           work,
+                                                  int               lwork,
+                                                  double*           rwork,
+                                                  int               strideRwork,
+                                                  int*              devInfo,
+                                                  int               batch_count)
+{
+    return hipsolverDgesvdStridedBatched(handle,
+                                         jobu,
+                                         jobv,
+                                         m,
+                                         n,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         S,
+                                         strideS,
+                                         U,
+                                         ldu,
+                                         strideU,
+                                         V,
+                                         ldv,
+                                         strideV,
+                                         work,
+                                         lwork,
+                                         rwork,
+                                         strideRwork,
+                                         devInfo,
+                                         batch_count);
+}
+
+hipsolverStatus_t hipsolverDnCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                  signed char       jobu,
+                                                  signed char       jobv,
+                                                  int               m,
+                                                  int               n,
+                                                  hipFloatComplex*  A,
+                                                  int               lda,
+                                                  int               strideA,
+                                                  float*            S,
+                                                  int               strideS,
+                                                  hipFloatComplex*  U,
+                                                  int               ldu,
+                                                  int               strideU,
+                                                  hipFloatComplex*  V,
+                                                  int               ldv,
+                                                  int               strideV,
+                                                  hipFloatComplex*  work,
+                                                  int               lwork,
+                                                  float*            rwork,
+                                                  int               strideRwork,
+                                                  int*              devInfo,
+                                                  int               batch_count)
+{
+    return hipsolverCgesvdStridedBatched(handle,
+                                         jobu,
+                                         jobv,
+                                         m,
+                                         n,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         S,
+                                         strideS,
+                                         U,
+                                         ldu,
+                                         strideU,
+                                         V,
+                                         ldv,
+                                         strideV,
+                                         work,
+                                         lwork,
+                                         rwork,
+                                         strideRwork,
+                                         devInfo,
+                                         batch_count);
+}
+
+hipsolverStatus_t hipsolverDnZgesvdStridedBatched(hipsolverHandle_t handle,
+                                                  signed char       jobu,
+                                                  signed char       jobv,
+                                                  int               m,
+                                                  int               n,
+                                                  hipDoubleComplex* A,
+                                                  int               lda,
+                                                  int               strideA,
+                                                  double*           S,
+                                                  int               strideS,
+                                                  hipDoubleComplex* U,
+                                                  int               ldu,
+                                                  int               strideU,
+                                                  hipDoubleComplex* V,
+                                                  int               ldv,
+                                                  int               strideV,
+                                                  hipDoubleComplex* work,
+                                                  int               lwork,
+                                                  double*           rwork,
+                                                  int               strideRwork,
+                                                  int*              devInfo,
+                                                  int               batch_count)
+{
+    return hipsolverZgesvdStridedBatched(handle,
+                                         jobu,
+                                         jobv,
+                                         m,
+                                         n,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         S,
+                                         strideS,
+                                         U,
+                                         ldu,
+                                         strideU,
+                                         V,
+                                         ldv,
+                                         strideV,
+                                         work,
+                                         lwork,
+                                         rwork,
+                                         strideRwork,
+                                         devInfo,
+                                         batch_count);
+}
+
 // getrf
 hipsolverStatus_t hipsolverDnSgetrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
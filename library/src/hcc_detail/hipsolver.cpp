@@ -9,6 +9,18 @@
 #include "hipsolver.h"
 #include "error_macros.hpp"
 #include "exceptions.hpp"
+#include "hipsolver_banded.hpp"
+#include "hipsolver_coalescer.hpp"
+#include "hipsolver_handle_pool.hpp"
+#include "hipsolver_interleaved.hpp"
+#include "hipsolver_layout.hpp"
+#include "hipsolver_packed.hpp"
+#include "hipsolver_pipeline.hpp"
+#include "hipsolver_posv.hpp"
+#include "hipsolver_potrf_update.hpp"
+#include "hipsolver_tsqr.hpp"
+#include "hipsolver_tuning.hpp"
+#include "hipsolver_vbatched.hpp"
 #include "internal/rocblas_device_malloc.hpp"
 #include "rocblas.h"
 #include "rocsolver.h"
@@ -356,8 +368,17 @@ try
     if(!handle)
         return HIPSOLVER_STATUS_HANDLE_IS_NULLPTR;
 
-    // Create the rocBLAS handle
-    return rocblas2hip_status(rocblas_create_handle((rocblas_handle*)handle));
+    // Create the rocBLAS handle, or reuse a pooled one
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_handle_pool::instance().create((rocblas_handle*)handle));
+
+    // a new handle is column-major, even if its address was used by a destroyed handle
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+    {
+        hipsolver_layout_registry::instance().set(*(rocblas_handle*)handle, false);
+        hipsolver_tuning_registry::instance().create(*(rocblas_handle*)handle);
+    }
+    return status;
 }
 catch(...)
 {
@@ -367,7 +388,13 @@ catch(...)
 hipsolverStatus_t hipsolverDestroy(hipsolverHandle_t handle)
 try
 {
-    return rocblas2hip_status(rocblas_destroy_handle((rocblas_handle)handle));
+    if(handle)
+    {
+        hipsolver_layout_registry::instance().set((rocblas_handle)handle, false);
+        hipsolver_tuning_registry::instance().destroy((rocblas_handle)handle);
+    }
+
+    return rocblas2hip_status(hipsolver_handle_pool::instance().destroy((rocblas_handle)handle));
 }
 catch(...)
 {
@@ -400,6 +427,236 @@ catch(...)
     return exception2hip_status();
 }
 
+hipsolverStatus_t hipsolverSetMatrixLayout(hipsolverHandle_t handle, hipsolverLayout_t layout)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(layout != HIPSOLVER_LAYOUT_ROW_MAJOR && layout != HIPSOLVER_LAYOUT_COLUMN_MAJOR)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver_layout_registry::instance().set((rocblas_handle)handle,
+                                              layout == HIPSOLVER_LAYOUT_ROW_MAJOR);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetMatrixLayout(hipsolverHandle_t handle, hipsolverLayout_t* layout)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!layout)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *layout = hipsolver_is_row_major((rocblas_handle)handle) ? HIPSOLVER_LAYOUT_ROW_MAJOR
+                                                             : HIPSOLVER_LAYOUT_COLUMN_MAJOR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** AUXILIARY (HANDLE POOL) ********************/
+hipsolverStatus_t hipsolverHandlePoolSetCapacity(int capacity)
+try
+{
+    if(capacity < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return rocblas2hip_status(hipsolver_handle_pool::instance().set_capacity(capacity));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolGetCapacity(int* capacity)
+try
+{
+    if(!capacity)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *capacity = (int)std::min<size_t>(hipsolver_handle_pool::instance().get_capacity(), INT_MAX);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolReserve(int count)
+try
+{
+    if(count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return rocblas2hip_status(hipsolver_handle_pool::instance().reserve(count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolClear(void)
+try
+{
+    return rocblas2hip_status(hipsolver_handle_pool::instance().clear());
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** AUXILIARY (COALESCER) ********************/
+hipsolverStatus_t hipsolverCoalescerCreate(hipsolverCoalescer_t* coalescer)
+try
+{
+    if(!coalescer)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver_coalescer::create((hipsolver_coalescer**)coalescer);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCoalescerDestroy(hipsolverCoalescer_t coalescer)
+try
+{
+    if(!coalescer)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    delete(hipsolver_coalescer*)coalescer;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCoalescerSetMaxBatch(hipsolverCoalescer_t coalescer, int max_batch)
+try
+{
+    if(!coalescer || max_batch < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    ((hipsolver_coalescer*)coalescer)->set_max_batch(max_batch);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCoalescerSetWindow(hipsolverCoalescer_t coalescer, int microseconds)
+try
+{
+    if(!coalescer || microseconds < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    ((hipsolver_coalescer*)coalescer)->set_window(microseconds);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** AUXILIARY (TUNING) ********************/
+hipsolverStatus_t hipsolverSetSvdAlg(hipsolverHandle_t handle, hipsolverSvdAlg_t alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(alg != HIPSOLVER_SVD_ALG_AUTO && alg != HIPSOLVER_SVD_ALG_OUTOFPLACE
+       && alg != HIPSOLVER_SVD_ALG_INPLACE)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver_tuning_registry::instance().set_svd_alg((rocblas_handle)handle, alg);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetSvdAlg(hipsolverHandle_t handle, hipsolverSvdAlg_t* alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!alg)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *alg = hipsolver_tuning_registry::instance().get_svd_alg((rocblas_handle)handle);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetEigAlg(hipsolverHandle_t handle, hipsolverEigAlg_t alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(alg != HIPSOLVER_EIG_ALG_AUTO && alg != HIPSOLVER_EIG_ALG_DC && alg != HIPSOLVER_EIG_ALG_QR)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver_tuning_registry::instance().set_eig_alg((rocblas_handle)handle, alg);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetEigAlg(hipsolverHandle_t handle, hipsolverEigAlg_t* alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!alg)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *alg = hipsolver_tuning_registry::instance().get_eig_alg((rocblas_handle)handle);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverLoadTuningTable(hipsolverHandle_t handle, const char* path)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    // a null path detaches the table of the handle
+    std::shared_ptr<const hipsolver_tuning_table> table;
+    if(path)
+    {
+        table = hipsolver_tuning_table::load(path);
+        if(!table)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    hipsolver_tuning_registry::instance().set_table((rocblas_handle)handle, table);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
 /******************** AUXILIARY (PARAMS) ********************/
 hipsolverStatus_t hipsolverDnCreateGesvdjInfo(hipsolverGesvdjInfo_t* info)
 try
@@ -2398,6 +2655,11 @@ try
                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // the tall-skinny path is only taken once the arguments pass rocSOLVER's checks
+    if(status == HIPSOLVER_STATUS_SUCCESS && hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels_bufferSize<float>(
+            (rocblas_handle)handle, m, n, nrhs, lwork));
+
     *lwork = sz;
     return status;
 }
@@ -2452,6 +2714,11 @@ try
                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // the tall-skinny path is only taken once the arguments pass rocSOLVER's checks
+    if(status == HIPSOLVER_STATUS_SUCCESS && hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels_bufferSize<double>(
+            (rocblas_handle)handle, m, n, nrhs, lwork));
+
     *lwork = sz;
     return status;
 }
@@ -2506,6 +2773,11 @@ try
                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // the tall-skinny path is only taken once the arguments pass rocSOLVER's checks
+    if(status == HIPSOLVER_STATUS_SUCCESS && hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, nrhs, lwork));
+
     *lwork = sz;
     return status;
 }
@@ -2560,6 +2832,11 @@ try
                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
+    // the tall-skinny path is only taken once the arguments pass rocSOLVER's checks
+    if(status == HIPSOLVER_STATUS_SUCCESS && hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, nrhs, lwork));
+
     *lwork = sz;
     return status;
 }
@@ -2593,6 +2870,19 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      nrhs,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      X,
+                                                      ldx,
+                                                      devInfo));
+
     if(B == X)
         return rocblas2hip_status(rocsolver_sgels(
             (rocblas_handle)handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, devInfo));
@@ -2640,6 +2930,19 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      nrhs,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      X,
+                                                      ldx,
+                                                      devInfo));
+
     if(B == X)
         return rocblas2hip_status(rocsolver_dgels(
             (rocblas_handle)handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, devInfo));
@@ -2687,6 +2990,19 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_float_complex*)A,
+                                                      lda,
+                                                      (rocblas_float_complex*)B,
+                                                      ldb,
+                                                      (rocblas_float_complex*)X,
+                                                      ldx,
+                                                      devInfo));
+
     if(B == X)
         return rocblas2hip_status(rocsolver_cgels((rocblas_handle)handle,
                                                   rocblas_operation_none,
@@ -2742,6 +3058,19 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_tsqr_gels_selected(m, n, nrhs))
+        return rocblas2hip_status(hipsolver_tsqr_gels((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_double_complex*)A,
+                                                      lda,
+                                                      (rocblas_double_complex*)B,
+                                                      ldb,
+                                                      (rocblas_double_complex*)X,
+                                                      ldx,
+                                                      devInfo));
+
     if(B == X)
         return rocblas2hip_status(rocsolver_zgels((rocblas_handle)handle,
                                                   rocblas_operation_none,
@@ -3007,18 +3336,14 @@ catch(...)
     return exception2hip_status();
 }
 
-/******************** GESV ********************/
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
-                                                              int               n,
-                                                              int               nrhs,
-                                                              float*            A,
-                                                              int               lda,
-                                                              int*              devIpiv,
-                                                              float*            B,
-                                                              int               ldb,
-                                                              float*            X,
-                                                              int               ldx,
-                                                              size_t*           lwork)
+/******************** GEQRF_VBATCHED ********************/
+hipsolverStatus_t hipsolverSgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     float*            A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
 try
 {
     if(!handle)
@@ -3029,26 +3354,16 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgesv_outofplace((rocblas_handle)handle,
-                                                                             n,
-                                                                             nrhs,
-                                                                             nullptr,
-                                                                             lda,
-                                                                             nullptr,
-                                                                             nullptr,
-                                                                             ldb,
-                                                                             nullptr,
-                                                                             ldx,
-                                                                             nullptr));
-    rocblas2hip_status(rocsolver_sgesv(
-        (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_geqrf_vbatched_bufferSize<float>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
-    *lwork = sz;
+    *lwork = (int)sz;
     return status;
 }
 catch(...)
@@ -3056,17 +3371,13 @@ catch(...)
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgesv_bufferSize(hipsolverHandle_t handle,
-                                                              int               n,
-                                                              int               nrhs,
-                                                              double*           A,
-                                                              int               lda,
-                                                              int*              devIpiv,
-                                                              double*           B,
-                                                              int               ldb,
-                                                              double*           X,
-                                                              int               ldx,
-                                                              size_t*           lwork)
+hipsolverStatus_t hipsolverDgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     double*           A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
 try
 {
     if(!handle)
@@ -3077,26 +3388,16 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgesv_outofplace((rocblas_handle)handle,
-                                                                             n,
-                                                                             nrhs,
-                                                                             nullptr,
-                                                                             lda,
-                                                                             nullptr,
-                                                                             nullptr,
-                                                                             ldb,
-                                                                             nullptr,
-                                                                             ldx,
-                                                                             nullptr));
-    rocblas2hip_status(rocsolver_dgesv(
-        (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_geqrf_vbatched_bufferSize<double>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
 
-    *lwork = sz;
+    *lwork = (int)sz;
     return status;
 }
 catch(...)
@@ -3104,16 +3405,213 @@ catch(...)
     return exception2hip_status();
 }
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgesv_bufferSize(hipsolverHandle_t handle,
-                                                              int               n,
-                                                              int               nrhs,
-                                                              hipFloatComplex*  A,
-                                                              int               lda,
-                                                              int*              devIpiv,
-                                                              hipFloatComplex*  B,
-                                                              int               ldb,
-                                                              hipFloatComplex*  X,
-                                                              int               ldx,
+hipsolverStatus_t hipsolverCgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipFloatComplex*  A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_geqrf_vbatched_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipDoubleComplex* A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_geqrf_vbatched_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          float*            A[],
+                                          const int*        lda,
+                                          float*            tau,
+                                          float*            work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgeqrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_geqrf_vbatched(
+        (rocblas_handle)handle, m, n, A, lda, tau, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          double*           A[],
+                                          const int*        lda,
+                                          double*           tau,
+                                          double*           work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgeqrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_geqrf_vbatched(
+        (rocblas_handle)handle, m, n, A, lda, tau, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipFloatComplex*  A[],
+                                          const int*        lda,
+                                          hipFloatComplex*  tau,
+                                          hipFloatComplex*  work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgeqrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_geqrf_vbatched((rocblas_handle)handle,
+                                                       m,
+                                                       n,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       (rocblas_float_complex*)tau,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipDoubleComplex* A[],
+                                          const int*        lda,
+                                          hipDoubleComplex* tau,
+                                          hipDoubleComplex* work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgeqrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_geqrf_vbatched((rocblas_handle)handle,
+                                                       m,
+                                                       n,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       (rocblas_double_complex*)tau,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GESV ********************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              float*            A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              float*            B,
+                                                              int               ldb,
+                                                              float*            X,
+                                                              int               ldx,
                                                               size_t*           lwork)
 try
 {
@@ -3125,21 +3623,138 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgesv_outofplace((rocblas_handle)handle,
-                                                                             n,
-                                                                             nrhs,
-                                                                             nullptr,
-                                                                             lda,
-                                                                             nullptr,
-                                                                             nullptr,
-                                                                             ldb,
-                                                                             nullptr,
-                                                                             ldx,
-                                                                             nullptr));
-    rocblas2hip_status(rocsolver_cgesv(
-        (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_gesv_row_major_bufferSize<float>(
+            (rocblas_handle)handle, n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_sgesv_outofplace((rocblas_handle)handle,
+                                                               n,
+                                                               nrhs,
+                                                               nullptr,
+                                                               lda,
+                                                               nullptr,
+                                                               nullptr,
+                                                               ldb,
+                                                               nullptr,
+                                                               ldx,
+                                                               nullptr));
+        rocblas2hip_status(rocsolver_sgesv(
+            (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_gesv_row_major_bufferSize<double>(
+            (rocblas_handle)handle, n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_dgesv_outofplace((rocblas_handle)handle,
+                                                               n,
+                                                               nrhs,
+                                                               nullptr,
+                                                               lda,
+                                                               nullptr,
+                                                               nullptr,
+                                                               ldb,
+                                                               nullptr,
+                                                               ldx,
+                                                               nullptr));
+        rocblas2hip_status(rocsolver_dgesv(
+            (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipFloatComplex*  A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipFloatComplex*  B,
+                                                              int               ldb,
+                                                              hipFloatComplex*  X,
+                                                              int               ldx,
+                                                              size_t*           lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_gesv_row_major_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_cgesv_outofplace((rocblas_handle)handle,
+                                                               n,
+                                                               nrhs,
+                                                               nullptr,
+                                                               lda,
+                                                               nullptr,
+                                                               nullptr,
+                                                               ldb,
+                                                               nullptr,
+                                                               ldx,
+                                                               nullptr));
+        rocblas2hip_status(rocsolver_cgesv(
+            (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -3173,21 +3788,28 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgesv_outofplace((rocblas_handle)handle,
-                                                                             n,
-                                                                             nrhs,
-                                                                             nullptr,
-                                                                             lda,
-                                                                             nullptr,
-                                                                             nullptr,
-                                                                             ldb,
-                                                                             nullptr,
-                                                                             ldx,
-                                                                             nullptr));
-    rocblas2hip_status(rocsolver_zgesv(
-        (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_gesv_row_major_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_zgesv_outofplace((rocblas_handle)handle,
+                                                               n,
+                                                               nrhs,
+                                                               nullptr,
+                                                               lda,
+                                                               nullptr,
+                                                               nullptr,
+                                                               ldb,
+                                                               nullptr,
+                                                               ldx,
+                                                               nullptr));
+        rocblas2hip_status(rocsolver_zgesv(
+            (rocblas_handle)handle, n, nrhs, nullptr, lda, nullptr, nullptr, ldb, nullptr));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -3225,6 +3847,20 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_gesv_row_major((rocblas_handle)handle,
+                                     n,
+                                     nrhs,
+                                     A,
+                                     lda,
+                                     devIpiv,
+                                     B,
+                                     ldb,
+                                     X,
+                                     ldx,
+                                     devInfo));
+
     if(B == X)
         return rocblas2hip_status(
             rocsolver_sgesv((rocblas_handle)handle, n, nrhs, A, lda, devIpiv, B, ldb, devInfo));
@@ -3262,6 +3898,20 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_gesv_row_major((rocblas_handle)handle,
+                                     n,
+                                     nrhs,
+                                     A,
+                                     lda,
+                                     devIpiv,
+                                     B,
+                                     ldb,
+                                     X,
+                                     ldx,
+                                     devInfo));
+
     if(B == X)
         return rocblas2hip_status(
             rocsolver_dgesv((rocblas_handle)handle, n, nrhs, A, lda, devIpiv, B, ldb, devInfo));
@@ -3299,6 +3949,20 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_gesv_row_major((rocblas_handle)handle,
+                                     n,
+                                     nrhs,
+                                     (rocblas_float_complex*)A,
+                                     lda,
+                                     devIpiv,
+                                     (rocblas_float_complex*)B,
+                                     ldb,
+                                     (rocblas_float_complex*)X,
+                                     ldx,
+                                     devInfo));
+
     if(B == X)
         return rocblas2hip_status(rocsolver_cgesv((rocblas_handle)handle,
                                                   n,
@@ -3352,6 +4016,20 @@ try
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_gesv_row_major((rocblas_handle)handle,
+                                     n,
+                                     nrhs,
+                                     (rocblas_double_complex*)A,
+                                     lda,
+                                     devIpiv,
+                                     (rocblas_double_complex*)B,
+                                     ldb,
+                                     (rocblas_double_complex*)X,
+                                     ldx,
+                                     devInfo));
+
     if(B == X)
         return rocblas2hip_status(rocsolver_zgesv((rocblas_handle)handle,
                                                   n,
@@ -3393,22 +4071,25 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   max(m, 1),
-                                                                   nullptr,
-                                                                   max(n, 1),
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_sgesvd((rocblas_handle)handle,
+                                                                        char2rocblas_svect(jobu),
+                                                                        char2rocblas_svect(jobv),
+                                                                        m,
+                                                                        n,
+                                                                        nullptr,
+                                                                        m,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        max(m, 1),
+                                                                        nullptr,
+                                                                        max(n, 1),
+                                                                        nullptr,
+                                                                        rocblas_outofplace,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array (aka rwork)
@@ -3444,22 +4125,25 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   max(m, 1),
-                                                                   nullptr,
-                                                                   max(n, 1),
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_dgesvd((rocblas_handle)handle,
+                                                                        char2rocblas_svect(jobu),
+                                                                        char2rocblas_svect(jobv),
+                                                                        m,
+                                                                        n,
+                                                                        nullptr,
+                                                                        m,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        max(m, 1),
+                                                                        nullptr,
+                                                                        max(n, 1),
+                                                                        nullptr,
+                                                                        rocblas_outofplace,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array (aka rwork)
@@ -3495,22 +4179,25 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   max(m, 1),
-                                                                   nullptr,
-                                                                   max(n, 1),
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_cgesvd((rocblas_handle)handle,
+                                                                        char2rocblas_svect(jobu),
+                                                                        char2rocblas_svect(jobv),
+                                                                        m,
+                                                                        n,
+                                                                        nullptr,
+                                                                        m,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        max(m, 1),
+                                                                        nullptr,
+                                                                        max(n, 1),
+                                                                        nullptr,
+                                                                        rocblas_outofplace,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array (aka rwork)
@@ -3546,22 +4233,25 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
-                                                                   char2rocblas_svect(jobu),
-                                                                   char2rocblas_svect(jobv),
-                                                                   m,
-                                                                   n,
-                                                                   nullptr,
-                                                                   m,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   max(m, 1),
-                                                                   nullptr,
-                                                                   max(n, 1),
-                                                                   nullptr,
-                                                                   rocblas_outofplace,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_zgesvd((rocblas_handle)handle,
+                                                                        char2rocblas_svect(jobu),
+                                                                        char2rocblas_svect(jobv),
+                                                                        m,
+                                                                        n,
+                                                                        nullptr,
+                                                                        m,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        max(m, 1),
+                                                                        nullptr,
+                                                                        max(n, 1),
+                                                                        nullptr,
+                                                                        rocblas_outofplace,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array (aka rwork)
@@ -3630,21 +4320,24 @@ try
         }
     }
 
-    return rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               S,
-                                               U,
-                                               ldu,
-                                               V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n, U, ldu, V, ldv);
+
+    return rocblas2hip_status(hipsolver_auto_sgesvd((rocblas_handle)handle,
+                                                    char2rocblas_svect(jobu),
+                                                    char2rocblas_svect(jobv),
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    S,
+                                                    U,
+                                                    ldu,
+                                                    V,
+                                                    ldv,
+                                                    rwork,
+                                                    rocblas_outofplace,
+                                                    devInfo));
 }
 catch(...)
 {
@@ -3696,21 +4389,24 @@ try
         }
     }
 
-    return rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               A,
-                                               lda,
-                                               S,
-                                               U,
-                                               ldu,
-                                               V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n, U, ldu, V, ldv);
+
+    return rocblas2hip_status(hipsolver_auto_dgesvd((rocblas_handle)handle,
+                                                    char2rocblas_svect(jobu),
+                                                    char2rocblas_svect(jobv),
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    S,
+                                                    U,
+                                                    ldu,
+                                                    V,
+                                                    ldv,
+                                                    rwork,
+                                                    rocblas_outofplace,
+                                                    devInfo));
 }
 catch(...)
 {
@@ -3762,21 +4458,24 @@ try
         }
     }
 
-    return rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               S,
-                                               (rocblas_float_complex*)U,
-                                               ldu,
-                                               (rocblas_float_complex*)V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n, U, ldu, V, ldv);
+
+    return rocblas2hip_status(hipsolver_auto_cgesvd((rocblas_handle)handle,
+                                                    char2rocblas_svect(jobu),
+                                                    char2rocblas_svect(jobv),
+                                                    m,
+                                                    n,
+                                                    (rocblas_float_complex*)A,
+                                                    lda,
+                                                    S,
+                                                    (rocblas_float_complex*)U,
+                                                    ldu,
+                                                    (rocblas_float_complex*)V,
+                                                    ldv,
+                                                    rwork,
+                                                    rocblas_outofplace,
+                                                    devInfo));
 }
 catch(...)
 {
@@ -3828,83 +4527,80 @@ try
         }
     }
 
-    return rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
-                                               char2rocblas_svect(jobu),
-                                               char2rocblas_svect(jobv),
-                                               m,
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               S,
-                                               (rocblas_double_complex*)U,
-                                               ldu,
-                                               (rocblas_double_complex*)V,
-                                               ldv,
-                                               rwork,
-                                               rocblas_outofplace,
-                                               devInfo));
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        hipsolver_transpose_svd(jobu, jobv, m, n, U, ldu, V, ldv);
+
+    return rocblas2hip_status(hipsolver_auto_zgesvd((rocblas_handle)handle,
+                                                    char2rocblas_svect(jobu),
+                                                    char2rocblas_svect(jobv),
+                                                    m,
+                                                    n,
+                                                    (rocblas_double_complex*)A,
+                                                    lda,
+                                                    S,
+                                                    (rocblas_double_complex*)U,
+                                                    ldu,
+                                                    (rocblas_double_complex*)V,
+                                                    ldv,
+                                                    rwork,
+                                                    rocblas_outofplace,
+                                                    devInfo));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GESVDJ ********************/
-hipsolverStatus_t hipsolverDnSgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                                hipsolverEigMode_t    jobz,
-                                                int                   econ,
-                                                int                   m,
-                                                int                   n,
-                                                float*                A,
-                                                int                   lda,
-                                                float*                S,
-                                                float*                U,
-                                                int                   ldu,
-                                                float*                V,
-                                                int                   ldv,
-                                                int*                  lwork,
-                                                hipsolverGesvdjInfo_t params)
+/******************** GESVD_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(ldv < n)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              m,
-                                              n,
-                                              nullptr,
-                                              lda,
-                                              nullptr,
-                                              nullptr,
-                                              ldu,
-                                              nullptr,
-                                              ldv,
-                                              nullptr,
-                                              rocblas_outofplace,
-                                              nullptr));
+        = rocblas2hip_status(hipsolver_auto_sgesvd_strided_batched((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   m * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   max(m, 1),
+                                                                   max(m, 1) * m,
+                                                                   nullptr,
+                                                                   max(n, 1),
+                                                                   max(n, 1) * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) : 0;
-
-    // space for V_copy array
-    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy = use_V_copy ? sizeof(float) * (econ ? min(m, n) : n) * n : 0;
+    // space for E arrays (aka rwork)
+    size_t size_E
+        = min(m, n) > 0 && batch_count > 0 ? sizeof(float) * min(m, n) * batch_count : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -3920,61 +4616,55 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                                hipsolverEigMode_t    jobz,
-                                                int                   econ,
-                                                int                   m,
-                                                int                   n,
-                                                double*               A,
-                                                int                   lda,
-                                                double*               S,
-                                                double*               U,
-                                                int                   ldu,
-                                                double*               V,
-                                                int                   ldv,
-                                                int*                  lwork,
-                                                hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(ldv < n)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              m,
-                                              n,
-                                              nullptr,
-                                              lda,
-                                              nullptr,
-                                              nullptr,
-                                              ldu,
-                                              nullptr,
-                                              ldv,
-                                              nullptr,
-                                              rocblas_outofplace,
-                                              nullptr));
+        = rocblas2hip_status(hipsolver_auto_dgesvd_strided_batched((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   m * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   max(m, 1),
+                                                                   max(m, 1) * m,
+                                                                   nullptr,
+                                                                   max(n, 1),
+                                                                   max(n, 1) * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) : 0;
-
-    // space for V_copy array
-    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy = use_V_copy ? sizeof(double) * (econ ? min(m, n) : n) * n : 0;
+    // space for E arrays (aka rwork)
+    size_t size_E
+        = min(m, n) > 0 && batch_count > 0 ? sizeof(double) * min(m, n) * batch_count : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -3990,62 +4680,55 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnCgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                                hipsolverEigMode_t    jobz,
-                                                int                   econ,
-                                                int                   m,
-                                                int                   n,
-                                                hipFloatComplex*      A,
-                                                int                   lda,
-                                                float*                S,
-                                                hipFloatComplex*      U,
-                                                int                   ldu,
-                                                hipFloatComplex*      V,
-                                                int                   ldv,
-                                                int*                  lwork,
-                                                hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(ldv < n)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              m,
-                                              n,
-                                              nullptr,
-                                              lda,
-                                              nullptr,
-                                              nullptr,
-                                              ldu,
-                                              nullptr,
-                                              ldv,
-                                              nullptr,
-                                              rocblas_outofplace,
-                                              nullptr));
+        = rocblas2hip_status(hipsolver_auto_cgesvd_strided_batched((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   m * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   max(m, 1),
+                                                                   max(m, 1) * m,
+                                                                   nullptr,
+                                                                   max(n, 1),
+                                                                   max(n, 1) * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) : 0;
-
-    // space for V_copy array
-    bool   use_V_copy = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy
-        = use_V_copy ? sizeof(rocblas_float_complex) * (econ ? min(m, n) : n) * n : 0;
+    // space for E arrays (aka rwork)
+    size_t size_E
+        = min(m, n) > 0 && batch_count > 0 ? sizeof(float) * min(m, n) * batch_count : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -4061,62 +4744,55 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnZgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                                hipsolverEigMode_t    jobz,
-                                                int                   econ,
-                                                int                   m,
-                                                int                   n,
-                                                hipDoubleComplex*     A,
-                                                int                   lda,
-                                                double*               S,
-                                                hipDoubleComplex*     U,
-                                                int                   ldu,
-                                                hipDoubleComplex*     V,
-                                                int                   ldv,
-                                                int*                  lwork,
-                                                hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
-    if(ldv < n)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              hip2rocblas_evect2svect(jobz, econ),
-                                              m,
-                                              n,
-                                              nullptr,
-                                              lda,
-                                              nullptr,
-                                              nullptr,
-                                              ldu,
-                                              nullptr,
-                                              ldv,
-                                              nullptr,
-                                              rocblas_outofplace,
-                                              nullptr));
+        = rocblas2hip_status(hipsolver_auto_zgesvd_strided_batched((rocblas_handle)handle,
+                                                                   char2rocblas_svect(jobu),
+                                                                   char2rocblas_svect(jobv),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   m,
+                                                                   m * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   max(m, 1),
+                                                                   max(m, 1) * m,
+                                                                   nullptr,
+                                                                   max(n, 1),
+                                                                   max(n, 1) * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
-    // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) : 0;
-
-    // space for V_copy array
-    bool   use_V_copy = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy
-        = use_V_copy ? sizeof(rocblas_double_complex) * (econ ? min(m, n) : n) * n : 0;
+    // space for E arrays (aka rwork)
+    size_t size_E
+        = min(m, n) > 0 && batch_count > 0 ? sizeof(double) * min(m, n) * batch_count : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -4132,414 +4808,352 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnSgesvdj(hipsolverDnHandle_t   handle,
-                                     hipsolverEigMode_t    jobz,
-                                     int                   econ,
-                                     int                   m,
-                                     int                   n,
-                                     float*                A,
-                                     int                   lda,
-                                     float*                S,
-                                     float*                U,
-                                     int                   ldu,
-                                     float*                V,
-                                     int                   ldv,
-                                     float*                work,
-                                     int                   lwork,
-                                     int*                  devInfo,
-                                     hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                int               strideA,
+                                                float*            S,
+                                                int               strideS,
+                                                float*            U,
+                                                int               ldu,
+                                                int               strideU,
+                                                float*            V,
+                                                int               ldv,
+                                                int               strideV,
+                                                float*            work,
+                                                int               lwork,
+                                                float*            rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
     rocblas_device_malloc mem((rocblas_handle)handle);
-    float*                E;
-    float*                V_copy;
-
-    const float one         = 1.0f;
-    const float zero        = 0.0f;
-    int         ldv_copy    = 1;
-    size_t      size_V_copy = 0;
-    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-    {
-        if(ldv < n || !V)
-            return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = econ ? min(m, n) : n;
-        size_V_copy = sizeof(float) * ldv_copy * n;
-    }
 
-    // prepare workspace
     if(work && lwork)
     {
-        E = work;
-        if(min(m, n) > 0)
-            work = E + min(m, n);
-
-        V_copy = work;
-        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = V_copy + ldv_copy * n;
+        size_t size_work = lwork;
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            // the E arrays are taken from the front of the workspace
+            size_t size_E = sizeof(float) * min(m, n) * batch_count;
+            if(size_work < size_E)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+            size_work -= size_E;
+
+            rwork       = work;
+            strideRwork = min(m, n);
+            work        = rwork + min(m, n) * batch_count;
+        }
 
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, size_work));
     }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnSgesvdj_bufferSize(
-            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
+        CHECK_HIPSOLVER_ERROR(hipsolverSgesvdStridedBatched_bufferSize(
+            (rocblas_handle)handle, jobu, jobv, m, n, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
 
-        mem = rocblas_device_malloc((rocblas_handle)handle, sizeof(float) * min(m, n), size_V_copy);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        E      = (float*)mem[0];
-        V_copy = (float*)mem[1];
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            mem = rocblas_device_malloc(
+                (rocblas_handle)handle, sizeof(float) * min(m, n) * batch_count);
+            if(!mem)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            rwork       = (float*)mem[0];
+            strideRwork = min(m, n);
+        }
     }
 
-    // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_sgesvd((rocblas_handle)handle,
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         m,
-                                         n,
-                                         A,
-                                         lda,
-                                         S,
-                                         U,
-                                         ldu,
-                                         V_copy,
-                                         ldv_copy,
-                                         E,
-                                         rocblas_outofplace,
-                                         devInfo));
-
-    // transpose V
-    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-        return rocblas2hip_status(rocblas_sgeam((rocblas_handle)handle,
-                                                rocblas_operation_transpose,
-                                                rocblas_operation_none,
-                                                n,
-                                                ldv_copy,
-                                                &one,
-                                                V_copy,
-                                                ldv_copy,
-                                                &zero,
-                                                V_copy,
-                                                ldv_copy,
-                                                V,
-                                                ldv));
-    else
-        return HIPSOLVER_STATUS_SUCCESS;
+    return rocblas2hip_status(hipsolver_auto_sgesvd_strided_batched((rocblas_handle)handle,
+                                                                    char2rocblas_svect(jobu),
+                                                                    char2rocblas_svect(jobv),
+                                                                    m,
+                                                                    n,
+                                                                    A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    S,
+                                                                    strideS,
+                                                                    U,
+                                                                    ldu,
+                                                                    strideU,
+                                                                    V,
+                                                                    ldv,
+                                                                    strideV,
+                                                                    rwork,
+                                                                    strideRwork,
+                                                                    rocblas_outofplace,
+                                                                    devInfo,
+                                                                    batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDgesvdj(hipsolverDnHandle_t   handle,
-                                     hipsolverEigMode_t    jobz,
-                                     int                   econ,
-                                     int                   m,
-                                     int                   n,
-                                     double*               A,
-                                     int                   lda,
-                                     double*               S,
-                                     double*               U,
-                                     int                   ldu,
-                                     double*               V,
-                                     int                   ldv,
-                                     double*               work,
-                                     int                   lwork,
-                                     int*                  devInfo,
-                                     hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                int               strideA,
+                                                double*           S,
+                                                int               strideS,
+                                                double*           U,
+                                                int               ldu,
+                                                int               strideU,
+                                                double*           V,
+                                                int               ldv,
+                                                int               strideV,
+                                                double*           work,
+                                                int               lwork,
+                                                double*           rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
     rocblas_device_malloc mem((rocblas_handle)handle);
-    double*               E;
-    double*               V_copy;
-
-    const double one         = 1.0;
-    const double zero        = 0.0;
-    int          ldv_copy    = 1;
-    size_t       size_V_copy = 0;
-    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-    {
-        if(ldv < n || !V)
-            return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = econ ? min(m, n) : n;
-        size_V_copy = sizeof(double) * ldv_copy * n;
-    }
 
-    // prepare workspace
     if(work && lwork)
     {
-        E = work;
-        if(min(m, n) > 0)
-            work = E + min(m, n);
-
-        V_copy = work;
-        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = V_copy + ldv_copy * n;
+        size_t size_work = lwork;
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            // the E arrays are taken from the front of the workspace
+            size_t size_E = sizeof(double) * min(m, n) * batch_count;
+            if(size_work < size_E)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+            size_work -= size_E;
+
+            rwork       = work;
+            strideRwork = min(m, n);
+            work        = rwork + min(m, n) * batch_count;
+        }
 
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, size_work));
     }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnDgesvdj_bufferSize(
-            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
+        CHECK_HIPSOLVER_ERROR(hipsolverDgesvdStridedBatched_bufferSize(
+            (rocblas_handle)handle, jobu, jobv, m, n, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
 
-        mem = rocblas_device_malloc(
-            (rocblas_handle)handle, sizeof(double) * min(m, n), size_V_copy);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        E      = (double*)mem[0];
-        V_copy = (double*)mem[1];
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            mem = rocblas_device_malloc(
+                (rocblas_handle)handle, sizeof(double) * min(m, n) * batch_count);
+            if(!mem)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            rwork       = (double*)mem[0];
+            strideRwork = min(m, n);
+        }
     }
 
-    // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_dgesvd((rocblas_handle)handle,
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         m,
-                                         n,
-                                         A,
-                                         lda,
-                                         S,
-                                         U,
-                                         ldu,
-                                         V_copy,
-                                         ldv_copy,
-                                         E,
-                                         rocblas_outofplace,
-                                         devInfo));
-
-    // transpose V
-    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-        return rocblas2hip_status(rocblas_dgeam((rocblas_handle)handle,
-                                                rocblas_operation_transpose,
-                                                rocblas_operation_none,
-                                                n,
-                                                ldv_copy,
-                                                &one,
-                                                V_copy,
-                                                ldv_copy,
-                                                &zero,
-                                                V_copy,
-                                                ldv_copy,
-                                                V,
-                                                ldv));
-    else
-        return HIPSOLVER_STATUS_SUCCESS;
+    return rocblas2hip_status(hipsolver_auto_dgesvd_strided_batched((rocblas_handle)handle,
+                                                                    char2rocblas_svect(jobu),
+                                                                    char2rocblas_svect(jobv),
+                                                                    m,
+                                                                    n,
+                                                                    A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    S,
+                                                                    strideS,
+                                                                    U,
+                                                                    ldu,
+                                                                    strideU,
+                                                                    V,
+                                                                    ldv,
+                                                                    strideV,
+                                                                    rwork,
+                                                                    strideRwork,
+                                                                    rocblas_outofplace,
+                                                                    devInfo,
+                                                                    batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnCgesvdj(hipsolverDnHandle_t   handle,
-                                     hipsolverEigMode_t    jobz,
-                                     int                   econ,
-                                     int                   m,
-                                     int                   n,
-                                     hipFloatComplex*      A,
-                                     int                   lda,
-                                     float*                S,
-                                     hipFloatComplex*      U,
-                                     int                   ldu,
-                                     hipFloatComplex*      V,
-                                     int                   ldv,
-                                     hipFloatComplex*      work,
-                                     int                   lwork,
-                                     int*                  devInfo,
-                                     hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                hipFloatComplex*  A,
+                                                int               lda,
+                                                int               strideA,
+                                                float*            S,
+                                                int               strideS,
+                                                hipFloatComplex*  U,
+                                                int               ldu,
+                                                int               strideU,
+                                                hipFloatComplex*  V,
+                                                int               ldv,
+                                                int               strideV,
+                                                hipFloatComplex*  work,
+                                                int               lwork,
+                                                float*            rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    rocblas_device_malloc  mem((rocblas_handle)handle);
-    float*                 E;
-    rocblas_float_complex* V_copy;
-
-    const rocblas_float_complex one         = {1.0f, 0.0f};
-    const rocblas_float_complex zero        = {0.0f, 0.0f};
-    int                         ldv_copy    = 1;
-    size_t                      size_V_copy = 0;
-    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-    {
-        if(ldv < n || !V)
-            return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = econ ? min(m, n) : n;
-        size_V_copy = sizeof(rocblas_float_complex) * ldv_copy * n;
-    }
+    rocblas_device_malloc mem((rocblas_handle)handle);
 
-    // prepare workspace
     if(work && lwork)
     {
-        E = (float*)work;
-        if(min(m, n) > 0)
-            work = (hipFloatComplex*)(E + min(m, n));
-
-        V_copy = (rocblas_float_complex*)work;
-        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = (hipFloatComplex*)(V_copy + ldv_copy * n);
+        size_t size_work = lwork;
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            // the E arrays are taken from the front of the workspace
+            size_t size_E = sizeof(float) * min(m, n) * batch_count;
+            if(size_work < size_E)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+            size_work -= size_E;
+
+            rwork       = (float*)work;
+            strideRwork = min(m, n);
+            work        = (hipFloatComplex*)(rwork + min(m, n) * batch_count);
+        }
 
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, size_work));
     }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnCgesvdj_bufferSize(
-            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
+        CHECK_HIPSOLVER_ERROR(hipsolverCgesvdStridedBatched_bufferSize(
+            (rocblas_handle)handle, jobu, jobv, m, n, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
 
-        mem = rocblas_device_malloc((rocblas_handle)handle, sizeof(float) * min(m, n), size_V_copy);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        E      = (float*)mem[0];
-        V_copy = (rocblas_float_complex*)mem[1];
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            mem = rocblas_device_malloc(
+                (rocblas_handle)handle, sizeof(float) * min(m, n) * batch_count);
+            if(!mem)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            rwork       = (float*)mem[0];
+            strideRwork = min(m, n);
+        }
     }
 
-    // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_cgesvd((rocblas_handle)handle,
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         m,
-                                         n,
-                                         (rocblas_float_complex*)A,
-                                         lda,
-                                         S,
-                                         (rocblas_float_complex*)U,
-                                         ldu,
-                                         V_copy,
-                                         ldv_copy,
-                                         E,
-                                         rocblas_outofplace,
-                                         devInfo));
-
-    // transpose V
-    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-        return rocblas2hip_status(rocblas_cgeam((rocblas_handle)handle,
-                                                rocblas_operation_conjugate_transpose,
-                                                rocblas_operation_none,
-                                                n,
-                                                ldv_copy,
-                                                &one,
-                                                V_copy,
-                                                ldv_copy,
-                                                &zero,
-                                                V_copy,
-                                                ldv_copy,
-                                                (rocblas_float_complex*)V,
-                                                ldv));
-    else
-        return HIPSOLVER_STATUS_SUCCESS;
+    return rocblas2hip_status(hipsolver_auto_cgesvd_strided_batched((rocblas_handle)handle,
+                                                                    char2rocblas_svect(jobu),
+                                                                    char2rocblas_svect(jobv),
+                                                                    m,
+                                                                    n,
+                                                                    (rocblas_float_complex*)A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    S,
+                                                                    strideS,
+                                                                    (rocblas_float_complex*)U,
+                                                                    ldu,
+                                                                    strideU,
+                                                                    (rocblas_float_complex*)V,
+                                                                    ldv,
+                                                                    strideV,
+                                                                    rwork,
+                                                                    strideRwork,
+                                                                    rocblas_outofplace,
+                                                                    devInfo,
+                                                                    batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnZgesvdj(hipsolverDnHandle_t   handle,
-                                     hipsolverEigMode_t    jobz,
-                                     int                   econ,
-                                     int                   m,
-                                     int                   n,
-                                     hipDoubleComplex*     A,
-                                     int                   lda,
-                                     double*               S,
-                                     hipDoubleComplex*     U,
-                                     int                   ldu,
-                                     hipDoubleComplex*     V,
-                                     int                   ldv,
-                                     hipDoubleComplex*     work,
-                                     int                   lwork,
-                                     int*                  devInfo,
-                                     hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverZgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                hipDoubleComplex* A,
+                                                int               lda,
+                                                int               strideA,
+                                                double*           S,
+                                                int               strideS,
+                                                hipDoubleComplex* U,
+                                                int               ldu,
+                                                int               strideU,
+                                                hipDoubleComplex* V,
+                                                int               ldv,
+                                                int               strideV,
+                                                hipDoubleComplex* work,
+                                                int               lwork,
+                                                double*           rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    rocblas_device_malloc mem((rocblas_handle)handle);
 
-    rocblas_device_malloc   mem((rocblas_handle)handle);
-    double*                 E;
-    rocblas_double_complex* V_copy;
+    if(work && lwork)
+    {
+        size_t size_work = lwork;
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            // the E arrays are taken from the front of the workspace
+            size_t size_E = sizeof(double) * min(m, n) * batch_count;
+            if(size_work < size_E)
+                return HIPSOLVER_STATUS_INVALID_VALUE;
+            size_work -= size_E;
+
+            rwork       = (double*)work;
+            strideRwork = min(m, n);
+            work        = (hipDoubleComplex*)(rwork + min(m, n) * batch_count);
+        }
 
-    const rocblas_double_complex one         = {1.0, 0.0};
-    const rocblas_double_complex zero        = {0.0, 0.0};
-    int                          ldv_copy    = 1;
-    size_t                       size_V_copy = 0;
-    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-    {
-        if(ldv < n || !V)
-            return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = econ ? min(m, n) : n;
-        size_V_copy = sizeof(rocblas_double_complex) * ldv_copy * n;
-    }
-
-    // prepare workspace
-    if(work && lwork)
-    {
-        E = (double*)work;
-        if(min(m, n) > 0)
-            work = (hipDoubleComplex*)(E + min(m, n));
-
-        V_copy = (rocblas_double_complex*)work;
-        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = (hipDoubleComplex*)(V_copy + ldv_copy * n);
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, size_work));
     }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnZgesvdj_bufferSize(
-            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
+        CHECK_HIPSOLVER_ERROR(hipsolverZgesvdStridedBatched_bufferSize(
+            (rocblas_handle)handle, jobu, jobv, m, n, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
 
-        mem = rocblas_device_malloc(
-            (rocblas_handle)handle, sizeof(double) * min(m, n), size_V_copy);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        E      = (double*)mem[0];
-        V_copy = (rocblas_double_complex*)mem[1];
+        if(!rwork && min(m, n) > 1 && batch_count > 0)
+        {
+            mem = rocblas_device_malloc(
+                (rocblas_handle)handle, sizeof(double) * min(m, n) * batch_count);
+            if(!mem)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+            rwork       = (double*)mem[0];
+            strideRwork = min(m, n);
+        }
     }
 
-    // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_zgesvd((rocblas_handle)handle,
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         hip2rocblas_evect2svect(jobz, econ),
-                                         m,
-                                         n,
-                                         (rocblas_double_complex*)A,
-                                         lda,
-                                         S,
-                                         (rocblas_double_complex*)U,
-                                         ldu,
-                                         V_copy,
-                                         ldv_copy,
-                                         E,
-                                         rocblas_outofplace,
-                                         devInfo));
-
-    // transpose V
-    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-        return rocblas2hip_status(rocblas_zgeam((rocblas_handle)handle,
-                                                rocblas_operation_conjugate_transpose,
-                                                rocblas_operation_none,
-                                                n,
-                                                ldv_copy,
-                                                &one,
-                                                V_copy,
-                                                ldv_copy,
-                                                &zero,
-                                                V_copy,
-                                                ldv_copy,
-                                                (rocblas_double_complex*)V,
-                                                ldv));
-    else
-        return HIPSOLVER_STATUS_SUCCESS;
+    return rocblas2hip_status(hipsolver_auto_zgesvd_strided_batched((rocblas_handle)handle,
+                                                                    char2rocblas_svect(jobu),
+                                                                    char2rocblas_svect(jobv),
+                                                                    m,
+                                                                    n,
+                                                                    (rocblas_double_complex*)A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    S,
+                                                                    strideS,
+                                                                    (rocblas_double_complex*)U,
+                                                                    ldu,
+                                                                    strideU,
+                                                                    (rocblas_double_complex*)V,
+                                                                    ldv,
+                                                                    strideV,
+                                                                    rwork,
+                                                                    strideRwork,
+                                                                    rocblas_outofplace,
+                                                                    devInfo,
+                                                                    batch_count));
 }
 catch(...)
 {
@@ -4547,61 +5161,57 @@ catch(...)
 }
 
 /******************** GESVDJ ********************/
-hipsolverStatus_t hipsolverDnSgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
-                                                       hipsolverEigMode_t    jobz,
-                                                       int                   m,
-                                                       int                   n,
-                                                       float*                A,
-                                                       int                   lda,
-                                                       float*                S,
-                                                       float*                U,
-                                                       int                   ldu,
-                                                       float*                V,
-                                                       int                   ldv,
-                                                       int*                  lwork,
-                                                       hipsolverGesvdjInfo_t params,
-                                                       int                   batch_count)
+hipsolverStatus_t hipsolverDnSgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                                hipsolverEigMode_t    jobz,
+                                                int                   econ,
+                                                int                   m,
+                                                int                   n,
+                                                float*                A,
+                                                int                   lda,
+                                                float*                S,
+                                                float*                U,
+                                                int                   ldu,
+                                                float*                V,
+                                                int                   ldv,
+                                                int*                  lwork,
+                                                hipsolverGesvdjInfo_t params)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(ldv < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_sgesvd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              m,
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              nullptr,
-                                                              ldu,
-                                                              ldu * m,
-                                                              nullptr,
-                                                              ldv,
-                                                              ldv * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              rocblas_outofplace,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_sgesvd((rocblas_handle)handle,
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   m,
+                                                   n,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldu,
+                                                   nullptr,
+                                                   ldv,
+                                                   nullptr,
+                                                   rocblas_outofplace,
+                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) * batch_count : 0;
+    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) : 0;
 
     // space for V_copy array
     bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy = use_V_copy ? sizeof(float) * n * n * batch_count : 0;
+    size_t size_V_copy = use_V_copy ? sizeof(float) * (econ ? min(m, n) : n) * n : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
@@ -4621,61 +5231,57 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
-                                                       hipsolverEigMode_t    jobz,
-                                                       int                   m,
-                                                       int                   n,
-                                                       double*               A,
-                                                       int                   lda,
-                                                       double*               S,
-                                                       double*               U,
-                                                       int                   ldu,
-                                                       double*               V,
-                                                       int                   ldv,
-                                                       int*                  lwork,
-                                                       hipsolverGesvdjInfo_t params,
-                                                       int                   batch_count)
+hipsolverStatus_t hipsolverDnDgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                                hipsolverEigMode_t    jobz,
+                                                int                   econ,
+                                                int                   m,
+                                                int                   n,
+                                                double*               A,
+                                                int                   lda,
+                                                double*               S,
+                                                double*               U,
+                                                int                   ldu,
+                                                double*               V,
+                                                int                   ldv,
+                                                int*                  lwork,
+                                                hipsolverGesvdjInfo_t params)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(ldv < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_dgesvd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              m,
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              nullptr,
-                                                              ldu,
-                                                              ldu * m,
-                                                              nullptr,
-                                                              ldv,
-                                                              ldv * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              rocblas_outofplace,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_dgesvd((rocblas_handle)handle,
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   m,
+                                                   n,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldu,
+                                                   nullptr,
+                                                   ldv,
+                                                   nullptr,
+                                                   rocblas_outofplace,
+                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) * batch_count : 0;
+    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) : 0;
 
     // space for V_copy array
     bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy = use_V_copy ? sizeof(double) * n * n * batch_count : 0;
+    size_t size_V_copy = use_V_copy ? sizeof(double) * (econ ? min(m, n) : n) * n : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
@@ -4695,61 +5301,58 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnCgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
-                                                       hipsolverEigMode_t    jobz,
-                                                       int                   m,
-                                                       int                   n,
-                                                       hipFloatComplex*      A,
-                                                       int                   lda,
-                                                       float*                S,
-                                                       hipFloatComplex*      U,
-                                                       int                   ldu,
-                                                       hipFloatComplex*      V,
-                                                       int                   ldv,
-                                                       int*                  lwork,
-                                                       hipsolverGesvdjInfo_t params,
-                                                       int                   batch_count)
+hipsolverStatus_t hipsolverDnCgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                                hipsolverEigMode_t    jobz,
+                                                int                   econ,
+                                                int                   m,
+                                                int                   n,
+                                                hipFloatComplex*      A,
+                                                int                   lda,
+                                                float*                S,
+                                                hipFloatComplex*      U,
+                                                int                   ldu,
+                                                hipFloatComplex*      V,
+                                                int                   ldv,
+                                                int*                  lwork,
+                                                hipsolverGesvdjInfo_t params)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(ldv < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_cgesvd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              m,
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              nullptr,
-                                                              ldu,
-                                                              ldu * m,
-                                                              nullptr,
-                                                              ldv,
-                                                              ldv * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              rocblas_outofplace,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_cgesvd((rocblas_handle)handle,
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   m,
+                                                   n,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldu,
+                                                   nullptr,
+                                                   ldv,
+                                                   nullptr,
+                                                   rocblas_outofplace,
+                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) * batch_count : 0;
+    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) : 0;
 
     // space for V_copy array
-    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy = use_V_copy ? sizeof(rocblas_float_complex) * n * n * batch_count : 0;
+    bool   use_V_copy = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
+    size_t size_V_copy
+        = use_V_copy ? sizeof(rocblas_float_complex) * (econ ? min(m, n) : n) * n : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
@@ -4769,61 +5372,58 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnZgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
-                                                       hipsolverEigMode_t    jobz,
-                                                       int                   m,
-                                                       int                   n,
-                                                       hipDoubleComplex*     A,
-                                                       int                   lda,
-                                                       double*               S,
-                                                       hipDoubleComplex*     U,
-                                                       int                   ldu,
-                                                       hipDoubleComplex*     V,
-                                                       int                   ldv,
-                                                       int*                  lwork,
-                                                       hipsolverGesvdjInfo_t params,
-                                                       int                   batch_count)
+hipsolverStatus_t hipsolverDnZgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                                hipsolverEigMode_t    jobz,
+                                                int                   econ,
+                                                int                   m,
+                                                int                   n,
+                                                hipDoubleComplex*     A,
+                                                int                   lda,
+                                                double*               S,
+                                                hipDoubleComplex*     U,
+                                                int                   ldu,
+                                                hipDoubleComplex*     V,
+                                                int                   ldv,
+                                                int*                  lwork,
+                                                hipsolverGesvdjInfo_t params)
 try
 {
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(lwork == nullptr)
         return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(ldv < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
     *lwork = 0;
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_zgesvd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              hip2rocblas_evect2svect(jobz, 0),
-                                                              m,
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              nullptr,
-                                                              ldu,
-                                                              ldu * m,
-                                                              nullptr,
-                                                              ldv,
-                                                              ldv * n,
-                                                              nullptr,
-                                                              min(m, n),
-                                                              rocblas_outofplace,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_zgesvd((rocblas_handle)handle,
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   hip2rocblas_evect2svect(jobz, econ),
+                                                   m,
+                                                   n,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldu,
+                                                   nullptr,
+                                                   ldv,
+                                                   nullptr,
+                                                   rocblas_outofplace,
+                                                   nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
-    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) * batch_count : 0;
+    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) : 0;
 
     // space for V_copy array
-    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
-    size_t size_V_copy = use_V_copy ? sizeof(rocblas_double_complex) * n * n * batch_count : 0;
+    bool   use_V_copy = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
+    size_t size_V_copy
+        = use_V_copy ? sizeof(rocblas_double_complex) * (econ ? min(m, n) : n) * n : 0;
 
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
@@ -4843,22 +5443,22 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnSgesvdjBatched(hipsolverDnHandle_t   handle,
-                                            hipsolverEigMode_t    jobz,
-                                            int                   m,
-                                            int                   n,
-                                            float*                A,
-                                            int                   lda,
-                                            float*                S,
-                                            float*                U,
-                                            int                   ldu,
-                                            float*                V,
-                                            int                   ldv,
-                                            float*                work,
-                                            int                   lwork,
-                                            int*                  devInfo,
-                                            hipsolverGesvdjInfo_t params,
-                                            int                   batch_count)
+hipsolverStatus_t hipsolverDnSgesvdj(hipsolverDnHandle_t   handle,
+                                     hipsolverEigMode_t    jobz,
+                                     int                   econ,
+                                     int                   m,
+                                     int                   n,
+                                     float*                A,
+                                     int                   lda,
+                                     float*                S,
+                                     float*                U,
+                                     int                   ldu,
+                                     float*                V,
+                                     int                   ldv,
+                                     float*                work,
+                                     int                   lwork,
+                                     int*                  devInfo,
+                                     hipsolverGesvdjInfo_t params)
 try
 {
     if(!handle)
@@ -4876,8 +5476,8 @@ try
     {
         if(ldv < n || !V)
             return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = n;
-        size_V_copy = sizeof(float) * ldv_copy * n * batch_count;
+        ldv_copy    = econ ? min(m, n) : n;
+        size_V_copy = sizeof(float) * ldv_copy * n;
     }
 
     // prepare workspace
@@ -4885,34 +5485,21 @@ try
     {
         E = work;
         if(min(m, n) > 0)
-            work = E + min(m, n) * batch_count;
+            work = E + min(m, n);
 
         V_copy = work;
         if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = V_copy + ldv_copy * n * batch_count;
+            work = V_copy + ldv_copy * n;
 
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnSgesvdjBatched_bufferSize((rocblas_handle)handle,
-                                                                   jobz,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   S,
-                                                                   U,
-                                                                   ldu,
-                                                                   V,
-                                                                   ldv,
-                                                                   &lwork,
-                                                                   params,
-                                                                   batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverDnSgesvdj_bufferSize(
+            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
 
-        mem = rocblas_device_malloc(
-            (rocblas_handle)handle, sizeof(float) * min(m, n) * batch_count, size_V_copy);
+        mem = rocblas_device_malloc((rocblas_handle)handle, sizeof(float) * min(m, n), size_V_copy);
         if(!mem)
             return HIPSOLVER_STATUS_ALLOC_FAILED;
         E      = (float*)mem[0];
@@ -4920,47 +5507,37 @@ try
     }
 
     // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_sgesvd_strided_batched((rocblas_handle)handle,
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         m,
-                                                         n,
-                                                         A,
-                                                         lda,
-                                                         lda * n,
-                                                         S,
-                                                         min(m, n),
-                                                         U,
-                                                         ldu,
-                                                         ldu * m,
-                                                         V_copy,
-                                                         ldv_copy,
-                                                         ldv_copy * n,
-                                                         E,
-                                                         min(m, n),
-                                                         rocblas_outofplace,
-                                                         devInfo,
-                                                         batch_count));
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_sgesvd((rocblas_handle)handle,
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              m,
+                                              n,
+                                              A,
+                                              lda,
+                                              S,
+                                              U,
+                                              ldu,
+                                              V_copy,
+                                              ldv_copy,
+                                              E,
+                                              rocblas_outofplace,
+                                              devInfo));
 
     // transpose V
     if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-        return rocblas2hip_status(rocblas_sgeam_strided_batched((rocblas_handle)handle,
-                                                                rocblas_operation_transpose,
-                                                                rocblas_operation_none,
-                                                                n,
-                                                                ldv_copy,
-                                                                &one,
-                                                                V_copy,
-                                                                ldv_copy,
-                                                                ldv_copy * n,
-                                                                &zero,
-                                                                V_copy,
-                                                                ldv_copy,
-                                                                ldv_copy * n,
-                                                                V,
-                                                                ldv,
-                                                                ldv * n,
-                                                                batch_count));
+        return rocblas2hip_status(rocblas_sgeam((rocblas_handle)handle,
+                                                rocblas_operation_transpose,
+                                                rocblas_operation_none,
+                                                n,
+                                                ldv_copy,
+                                                &one,
+                                                V_copy,
+                                                ldv_copy,
+                                                &zero,
+                                                V_copy,
+                                                ldv_copy,
+                                                V,
+                                                ldv));
     else
         return HIPSOLVER_STATUS_SUCCESS;
 }
@@ -4969,22 +5546,22 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDgesvdjBatched(hipsolverDnHandle_t   handle,
-                                            hipsolverEigMode_t    jobz,
-                                            int                   m,
-                                            int                   n,
-                                            double*               A,
-                                            int                   lda,
-                                            double*               S,
-                                            double*               U,
-                                            int                   ldu,
-                                            double*               V,
-                                            int                   ldv,
-                                            double*               work,
-                                            int                   lwork,
-                                            int*                  devInfo,
-                                            hipsolverGesvdjInfo_t params,
-                                            int                   batch_count)
+hipsolverStatus_t hipsolverDnDgesvdj(hipsolverDnHandle_t   handle,
+                                     hipsolverEigMode_t    jobz,
+                                     int                   econ,
+                                     int                   m,
+                                     int                   n,
+                                     double*               A,
+                                     int                   lda,
+                                     double*               S,
+                                     double*               U,
+                                     int                   ldu,
+                                     double*               V,
+                                     int                   ldv,
+                                     double*               work,
+                                     int                   lwork,
+                                     int*                  devInfo,
+                                     hipsolverGesvdjInfo_t params)
 try
 {
     if(!handle)
@@ -5002,8 +5579,8 @@ try
     {
         if(ldv < n || !V)
             return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = n;
-        size_V_copy = sizeof(double) * ldv_copy * n * batch_count;
+        ldv_copy    = econ ? min(m, n) : n;
+        size_V_copy = sizeof(double) * ldv_copy * n;
     }
 
     // prepare workspace
@@ -5011,34 +5588,22 @@ try
     {
         E = work;
         if(min(m, n) > 0)
-            work = E + min(m, n) * batch_count;
+            work = E + min(m, n);
 
         V_copy = work;
         if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = V_copy + ldv_copy * n * batch_count;
+            work = V_copy + ldv_copy * n;
 
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnDgesvdjBatched_bufferSize((rocblas_handle)handle,
-                                                                   jobz,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   S,
-                                                                   U,
-                                                                   ldu,
-                                                                   V,
-                                                                   ldv,
-                                                                   &lwork,
-                                                                   params,
-                                                                   batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverDnDgesvdj_bufferSize(
+            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
 
         mem = rocblas_device_malloc(
-            (rocblas_handle)handle, sizeof(double) * min(m, n) * batch_count, size_V_copy);
+            (rocblas_handle)handle, sizeof(double) * min(m, n), size_V_copy);
         if(!mem)
             return HIPSOLVER_STATUS_ALLOC_FAILED;
         E      = (double*)mem[0];
@@ -5046,47 +5611,37 @@ try
     }
 
     // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_dgesvd_strided_batched((rocblas_handle)handle,
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         m,
-                                                         n,
-                                                         A,
-                                                         lda,
-                                                         lda * n,
-                                                         S,
-                                                         min(m, n),
-                                                         U,
-                                                         ldu,
-                                                         ldu * m,
-                                                         V_copy,
-                                                         ldv_copy,
-                                                         ldv_copy * n,
-                                                         E,
-                                                         min(m, n),
-                                                         rocblas_outofplace,
-                                                         devInfo,
-                                                         batch_count));
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_dgesvd((rocblas_handle)handle,
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              m,
+                                              n,
+                                              A,
+                                              lda,
+                                              S,
+                                              U,
+                                              ldu,
+                                              V_copy,
+                                              ldv_copy,
+                                              E,
+                                              rocblas_outofplace,
+                                              devInfo));
 
     // transpose V
     if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-        return rocblas2hip_status(rocblas_dgeam_strided_batched((rocblas_handle)handle,
-                                                                rocblas_operation_transpose,
-                                                                rocblas_operation_none,
-                                                                n,
-                                                                ldv_copy,
-                                                                &one,
-                                                                V_copy,
-                                                                ldv_copy,
-                                                                ldv_copy * n,
-                                                                &zero,
-                                                                V_copy,
-                                                                ldv_copy,
-                                                                ldv_copy * n,
-                                                                V,
-                                                                ldv,
-                                                                ldv * n,
-                                                                batch_count));
+        return rocblas2hip_status(rocblas_dgeam((rocblas_handle)handle,
+                                                rocblas_operation_transpose,
+                                                rocblas_operation_none,
+                                                n,
+                                                ldv_copy,
+                                                &one,
+                                                V_copy,
+                                                ldv_copy,
+                                                &zero,
+                                                V_copy,
+                                                ldv_copy,
+                                                V,
+                                                ldv));
     else
         return HIPSOLVER_STATUS_SUCCESS;
 }
@@ -5095,22 +5650,22 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnCgesvdjBatched(hipsolverDnHandle_t   handle,
-                                            hipsolverEigMode_t    jobz,
-                                            int                   m,
-                                            int                   n,
-                                            hipFloatComplex*      A,
-                                            int                   lda,
-                                            float*                S,
-                                            hipFloatComplex*      U,
-                                            int                   ldu,
-                                            hipFloatComplex*      V,
-                                            int                   ldv,
-                                            hipFloatComplex*      work,
-                                            int                   lwork,
-                                            int*                  devInfo,
-                                            hipsolverGesvdjInfo_t params,
-                                            int                   batch_count)
+hipsolverStatus_t hipsolverDnCgesvdj(hipsolverDnHandle_t   handle,
+                                     hipsolverEigMode_t    jobz,
+                                     int                   econ,
+                                     int                   m,
+                                     int                   n,
+                                     hipFloatComplex*      A,
+                                     int                   lda,
+                                     float*                S,
+                                     hipFloatComplex*      U,
+                                     int                   ldu,
+                                     hipFloatComplex*      V,
+                                     int                   ldv,
+                                     hipFloatComplex*      work,
+                                     int                   lwork,
+                                     int*                  devInfo,
+                                     hipsolverGesvdjInfo_t params)
 try
 {
     if(!handle)
@@ -5128,8 +5683,8 @@ try
     {
         if(ldv < n || !V)
             return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = n;
-        size_V_copy = sizeof(rocblas_float_complex) * ldv_copy * n * batch_count;
+        ldv_copy    = econ ? min(m, n) : n;
+        size_V_copy = sizeof(rocblas_float_complex) * ldv_copy * n;
     }
 
     // prepare workspace
@@ -5137,221 +5692,10148 @@ try
     {
         E = (float*)work;
         if(min(m, n) > 0)
-            work = (hipFloatComplex*)(E + min(m, n) * batch_count);
+            work = (hipFloatComplex*)(E + min(m, n));
 
         V_copy = (rocblas_float_complex*)work;
         if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = (hipFloatComplex*)(V_copy + ldv_copy * n * batch_count);
+            work = (hipFloatComplex*)(V_copy + ldv_copy * n);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnCgesvdj_bufferSize(
+            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        mem = rocblas_device_malloc((rocblas_handle)handle, sizeof(float) * min(m, n), size_V_copy);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E      = (float*)mem[0];
+        V_copy = (rocblas_float_complex*)mem[1];
+    }
+
+    // perform computation
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_cgesvd((rocblas_handle)handle,
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              m,
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              S,
+                                              (rocblas_float_complex*)U,
+                                              ldu,
+                                              V_copy,
+                                              ldv_copy,
+                                              E,
+                                              rocblas_outofplace,
+                                              devInfo));
 
+    // transpose V
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+        return rocblas2hip_status(rocblas_cgeam((rocblas_handle)handle,
+                                                rocblas_operation_conjugate_transpose,
+                                                rocblas_operation_none,
+                                                n,
+                                                ldv_copy,
+                                                &one,
+                                                V_copy,
+                                                ldv_copy,
+                                                &zero,
+                                                V_copy,
+                                                ldv_copy,
+                                                (rocblas_float_complex*)V,
+                                                ldv));
+    else
+        return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnZgesvdj(hipsolverDnHandle_t   handle,
+                                     hipsolverEigMode_t    jobz,
+                                     int                   econ,
+                                     int                   m,
+                                     int                   n,
+                                     hipDoubleComplex*     A,
+                                     int                   lda,
+                                     double*               S,
+                                     hipDoubleComplex*     U,
+                                     int                   ldu,
+                                     hipDoubleComplex*     V,
+                                     int                   ldv,
+                                     hipDoubleComplex*     work,
+                                     int                   lwork,
+                                     int*                  devInfo,
+                                     hipsolverGesvdjInfo_t params)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    rocblas_device_malloc   mem((rocblas_handle)handle);
+    double*                 E;
+    rocblas_double_complex* V_copy;
+
+    const rocblas_double_complex one         = {1.0, 0.0};
+    const rocblas_double_complex zero        = {0.0, 0.0};
+    int                          ldv_copy    = 1;
+    size_t                       size_V_copy = 0;
+    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    {
+        if(ldv < n || !V)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        ldv_copy    = econ ? min(m, n) : n;
+        size_V_copy = sizeof(rocblas_double_complex) * ldv_copy * n;
+    }
+
+    // prepare workspace
+    if(work && lwork)
+    {
+        E = (double*)work;
+        if(min(m, n) > 0)
+            work = (hipDoubleComplex*)(E + min(m, n));
+
+        V_copy = (rocblas_double_complex*)work;
+        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+            work = (hipDoubleComplex*)(V_copy + ldv_copy * n);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnZgesvdj_bufferSize(
+            (rocblas_handle)handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, &lwork, params));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        mem = rocblas_device_malloc(
+            (rocblas_handle)handle, sizeof(double) * min(m, n), size_V_copy);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E      = (double*)mem[0];
+        V_copy = (rocblas_double_complex*)mem[1];
+    }
+
+    // perform computation
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_zgesvd((rocblas_handle)handle,
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              hip2rocblas_evect2svect(jobz, econ),
+                                              m,
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              S,
+                                              (rocblas_double_complex*)U,
+                                              ldu,
+                                              V_copy,
+                                              ldv_copy,
+                                              E,
+                                              rocblas_outofplace,
+                                              devInfo));
+
+    // transpose V
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+        return rocblas2hip_status(rocblas_zgeam((rocblas_handle)handle,
+                                                rocblas_operation_conjugate_transpose,
+                                                rocblas_operation_none,
+                                                n,
+                                                ldv_copy,
+                                                &one,
+                                                V_copy,
+                                                ldv_copy,
+                                                &zero,
+                                                V_copy,
+                                                ldv_copy,
+                                                (rocblas_double_complex*)V,
+                                                ldv));
+    else
+        return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GESVDJ ********************/
+hipsolverStatus_t hipsolverDnSgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   m,
+                                                       int                   n,
+                                                       float*                A,
+                                                       int                   lda,
+                                                       float*                S,
+                                                       float*                U,
+                                                       int                   ldu,
+                                                       float*                V,
+                                                       int                   ldv,
+                                                       int*                  lwork,
+                                                       hipsolverGesvdjInfo_t params,
+                                                       int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_auto_sgesvd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   ldu,
+                                                                   ldu * m,
+                                                                   nullptr,
+                                                                   ldv,
+                                                                   ldv * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    // space for E array
+    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) * batch_count : 0;
+
+    // space for V_copy array
+    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
+    size_t size_V_copy = use_V_copy ? sizeof(float) * n * n * batch_count : 0;
+
+    // update size
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnDgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   m,
+                                                       int                   n,
+                                                       double*               A,
+                                                       int                   lda,
+                                                       double*               S,
+                                                       double*               U,
+                                                       int                   ldu,
+                                                       double*               V,
+                                                       int                   ldv,
+                                                       int*                  lwork,
+                                                       hipsolverGesvdjInfo_t params,
+                                                       int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_auto_dgesvd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   ldu,
+                                                                   ldu * m,
+                                                                   nullptr,
+                                                                   ldv,
+                                                                   ldv * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    // space for E array
+    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) * batch_count : 0;
+
+    // space for V_copy array
+    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
+    size_t size_V_copy = use_V_copy ? sizeof(double) * n * n * batch_count : 0;
+
+    // update size
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnCgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   m,
+                                                       int                   n,
+                                                       hipFloatComplex*      A,
+                                                       int                   lda,
+                                                       float*                S,
+                                                       hipFloatComplex*      U,
+                                                       int                   ldu,
+                                                       hipFloatComplex*      V,
+                                                       int                   ldv,
+                                                       int*                  lwork,
+                                                       hipsolverGesvdjInfo_t params,
+                                                       int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_auto_cgesvd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   ldu,
+                                                                   ldu * m,
+                                                                   nullptr,
+                                                                   ldv,
+                                                                   ldv * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    // space for E array
+    size_t size_E = min(m, n) > 0 ? sizeof(float) * min(m, n) * batch_count : 0;
+
+    // space for V_copy array
+    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
+    size_t size_V_copy = use_V_copy ? sizeof(rocblas_float_complex) * n * n * batch_count : 0;
+
+    // update size
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnZgesvdjBatched_bufferSize(hipsolverDnHandle_t   handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   m,
+                                                       int                   n,
+                                                       hipDoubleComplex*     A,
+                                                       int                   lda,
+                                                       double*               S,
+                                                       hipDoubleComplex*     U,
+                                                       int                   ldu,
+                                                       hipDoubleComplex*     V,
+                                                       int                   ldv,
+                                                       int*                  lwork,
+                                                       hipsolverGesvdjInfo_t params,
+                                                       int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(hipsolver_auto_zgesvd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   hip2rocblas_evect2svect(jobz, 0),
+                                                                   m,
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   nullptr,
+                                                                   ldu,
+                                                                   ldu * m,
+                                                                   nullptr,
+                                                                   ldv,
+                                                                   ldv * n,
+                                                                   nullptr,
+                                                                   min(m, n),
+                                                                   rocblas_outofplace,
+                                                                   nullptr,
+                                                                   batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    // space for E array
+    size_t size_E = min(m, n) > 0 ? sizeof(double) * min(m, n) * batch_count : 0;
+
+    // space for V_copy array
+    bool   use_V_copy  = min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR;
+    size_t size_V_copy = use_V_copy ? sizeof(rocblas_double_complex) * n * n * batch_count : 0;
+
+    // update size
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V_copy);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnSgesvdjBatched(hipsolverDnHandle_t   handle,
+                                            hipsolverEigMode_t    jobz,
+                                            int                   m,
+                                            int                   n,
+                                            float*                A,
+                                            int                   lda,
+                                            float*                S,
+                                            float*                U,
+                                            int                   ldu,
+                                            float*                V,
+                                            int                   ldv,
+                                            float*                work,
+                                            int                   lwork,
+                                            int*                  devInfo,
+                                            hipsolverGesvdjInfo_t params,
+                                            int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    rocblas_device_malloc mem((rocblas_handle)handle);
+    float*                E;
+    float*                V_copy;
+
+    const float one         = 1.0f;
+    const float zero        = 0.0f;
+    int         ldv_copy    = 1;
+    size_t      size_V_copy = 0;
+    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    {
+        if(ldv < n || !V)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        ldv_copy    = n;
+        size_V_copy = sizeof(float) * ldv_copy * n * batch_count;
+    }
+
+    // prepare workspace
+    if(work && lwork)
+    {
+        E = work;
+        if(min(m, n) > 0)
+            work = E + min(m, n) * batch_count;
+
+        V_copy = work;
+        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+            work = V_copy + ldv_copy * n * batch_count;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnSgesvdjBatched_bufferSize((rocblas_handle)handle,
+                                                                   jobz,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   S,
+                                                                   U,
+                                                                   ldu,
+                                                                   V,
+                                                                   ldv,
+                                                                   &lwork,
+                                                                   params,
+                                                                   batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        mem = rocblas_device_malloc(
+            (rocblas_handle)handle, sizeof(float) * min(m, n) * batch_count, size_V_copy);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E      = (float*)mem[0];
+        V_copy = (float*)mem[1];
+    }
+
+    // perform computation
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_sgesvd_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              m,
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              lda * n,
+                                                              S,
+                                                              min(m, n),
+                                                              U,
+                                                              ldu,
+                                                              ldu * m,
+                                                              V_copy,
+                                                              ldv_copy,
+                                                              ldv_copy * n,
+                                                              E,
+                                                              min(m, n),
+                                                              rocblas_outofplace,
+                                                              devInfo,
+                                                              batch_count));
+
+    // transpose V
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+        return rocblas2hip_status(rocblas_sgeam_strided_batched((rocblas_handle)handle,
+                                                                rocblas_operation_transpose,
+                                                                rocblas_operation_none,
+                                                                n,
+                                                                ldv_copy,
+                                                                &one,
+                                                                V_copy,
+                                                                ldv_copy,
+                                                                ldv_copy * n,
+                                                                &zero,
+                                                                V_copy,
+                                                                ldv_copy,
+                                                                ldv_copy * n,
+                                                                V,
+                                                                ldv,
+                                                                ldv * n,
+                                                                batch_count));
+    else
+        return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnDgesvdjBatched(hipsolverDnHandle_t   handle,
+                                            hipsolverEigMode_t    jobz,
+                                            int                   m,
+                                            int                   n,
+                                            double*               A,
+                                            int                   lda,
+                                            double*               S,
+                                            double*               U,
+                                            int                   ldu,
+                                            double*               V,
+                                            int                   ldv,
+                                            double*               work,
+                                            int                   lwork,
+                                            int*                  devInfo,
+                                            hipsolverGesvdjInfo_t params,
+                                            int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    rocblas_device_malloc mem((rocblas_handle)handle);
+    double*               E;
+    double*               V_copy;
+
+    const double one         = 1.0;
+    const double zero        = 0.0;
+    int          ldv_copy    = 1;
+    size_t       size_V_copy = 0;
+    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    {
+        if(ldv < n || !V)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        ldv_copy    = n;
+        size_V_copy = sizeof(double) * ldv_copy * n * batch_count;
+    }
+
+    // prepare workspace
+    if(work && lwork)
+    {
+        E = work;
+        if(min(m, n) > 0)
+            work = E + min(m, n) * batch_count;
+
+        V_copy = work;
+        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+            work = V_copy + ldv_copy * n * batch_count;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnDgesvdjBatched_bufferSize((rocblas_handle)handle,
+                                                                   jobz,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   S,
+                                                                   U,
+                                                                   ldu,
+                                                                   V,
+                                                                   ldv,
+                                                                   &lwork,
+                                                                   params,
+                                                                   batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        mem = rocblas_device_malloc(
+            (rocblas_handle)handle, sizeof(double) * min(m, n) * batch_count, size_V_copy);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E      = (double*)mem[0];
+        V_copy = (double*)mem[1];
+    }
+
+    // perform computation
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_dgesvd_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              m,
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              lda * n,
+                                                              S,
+                                                              min(m, n),
+                                                              U,
+                                                              ldu,
+                                                              ldu * m,
+                                                              V_copy,
+                                                              ldv_copy,
+                                                              ldv_copy * n,
+                                                              E,
+                                                              min(m, n),
+                                                              rocblas_outofplace,
+                                                              devInfo,
+                                                              batch_count));
+
+    // transpose V
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+        return rocblas2hip_status(rocblas_dgeam_strided_batched((rocblas_handle)handle,
+                                                                rocblas_operation_transpose,
+                                                                rocblas_operation_none,
+                                                                n,
+                                                                ldv_copy,
+                                                                &one,
+                                                                V_copy,
+                                                                ldv_copy,
+                                                                ldv_copy * n,
+                                                                &zero,
+                                                                V_copy,
+                                                                ldv_copy,
+                                                                ldv_copy * n,
+                                                                V,
+                                                                ldv,
+                                                                ldv * n,
+                                                                batch_count));
+    else
+        return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnCgesvdjBatched(hipsolverDnHandle_t   handle,
+                                            hipsolverEigMode_t    jobz,
+                                            int                   m,
+                                            int                   n,
+                                            hipFloatComplex*      A,
+                                            int                   lda,
+                                            float*                S,
+                                            hipFloatComplex*      U,
+                                            int                   ldu,
+                                            hipFloatComplex*      V,
+                                            int                   ldv,
+                                            hipFloatComplex*      work,
+                                            int                   lwork,
+                                            int*                  devInfo,
+                                            hipsolverGesvdjInfo_t params,
+                                            int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    rocblas_device_malloc  mem((rocblas_handle)handle);
+    float*                 E;
+    rocblas_float_complex* V_copy;
+
+    const rocblas_float_complex one         = {1.0f, 0.0f};
+    const rocblas_float_complex zero        = {0.0f, 0.0f};
+    int                         ldv_copy    = 1;
+    size_t                      size_V_copy = 0;
+    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    {
+        if(ldv < n || !V)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        ldv_copy    = n;
+        size_V_copy = sizeof(rocblas_float_complex) * ldv_copy * n * batch_count;
+    }
+
+    // prepare workspace
+    if(work && lwork)
+    {
+        E = (float*)work;
+        if(min(m, n) > 0)
+            work = (hipFloatComplex*)(E + min(m, n) * batch_count);
+
+        V_copy = (rocblas_float_complex*)work;
+        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+            work = (hipFloatComplex*)(V_copy + ldv_copy * n * batch_count);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnCgesvdjBatched_bufferSize((rocblas_handle)handle,
+                                                                   jobz,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   S,
+                                                                   U,
+                                                                   ldu,
+                                                                   V,
+                                                                   ldv,
+                                                                   &lwork,
+                                                                   params,
+                                                                   batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        mem = rocblas_device_malloc(
+            (rocblas_handle)handle, sizeof(float) * min(m, n) * batch_count, size_V_copy);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E      = (float*)mem[0];
+        V_copy = (rocblas_float_complex*)mem[1];
+    }
+
+    // perform computation
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_cgesvd_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              m,
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              lda * n,
+                                                              S,
+                                                              min(m, n),
+                                                              (rocblas_float_complex*)U,
+                                                              ldu,
+                                                              ldu * m,
+                                                              V_copy,
+                                                              ldv_copy,
+                                                              ldv_copy * n,
+                                                              E,
+                                                              min(m, n),
+                                                              rocblas_outofplace,
+                                                              devInfo,
+                                                              batch_count));
+
+    // transpose V
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+        return rocblas2hip_status(
+            rocblas_cgeam_strided_batched((rocblas_handle)handle,
+                                          rocblas_operation_conjugate_transpose,
+                                          rocblas_operation_none,
+                                          n,
+                                          ldv_copy,
+                                          &one,
+                                          V_copy,
+                                          ldv_copy,
+                                          ldv_copy * n,
+                                          &zero,
+                                          V_copy,
+                                          ldv_copy,
+                                          ldv_copy * n,
+                                          (rocblas_float_complex*)V,
+                                          ldv,
+                                          ldv * n,
+                                          batch_count));
+    else
+        return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnZgesvdjBatched(hipsolverDnHandle_t   handle,
+                                            hipsolverEigMode_t    jobz,
+                                            int                   m,
+                                            int                   n,
+                                            hipDoubleComplex*     A,
+                                            int                   lda,
+                                            double*               S,
+                                            hipDoubleComplex*     U,
+                                            int                   ldu,
+                                            hipDoubleComplex*     V,
+                                            int                   ldv,
+                                            hipDoubleComplex*     work,
+                                            int                   lwork,
+                                            int*                  devInfo,
+                                            hipsolverGesvdjInfo_t params,
+                                            int                   batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    rocblas_device_malloc   mem((rocblas_handle)handle);
+    double*                 E;
+    rocblas_double_complex* V_copy;
+
+    const rocblas_double_complex one         = {1.0, 0.0};
+    const rocblas_double_complex zero        = {0.0, 0.0};
+    int                          ldv_copy    = 1;
+    size_t                       size_V_copy = 0;
+    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    {
+        if(ldv < n || !V)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        ldv_copy    = n;
+        size_V_copy = sizeof(rocblas_double_complex) * ldv_copy * n * batch_count;
+    }
+
+    // prepare workspace
+    if(work && lwork)
+    {
+        E = (double*)work;
+        if(min(m, n) > 0)
+            work = (hipDoubleComplex*)(E + min(m, n) * batch_count);
+
+        V_copy = (rocblas_double_complex*)work;
+        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+            work = (hipDoubleComplex*)(V_copy + ldv_copy * n * batch_count);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnZgesvdjBatched_bufferSize((rocblas_handle)handle,
+                                                                   jobz,
+                                                                   m,
+                                                                   n,
+                                                                   A,
+                                                                   lda,
+                                                                   S,
+                                                                   U,
+                                                                   ldu,
+                                                                   V,
+                                                                   ldv,
+                                                                   &lwork,
+                                                                   params,
+                                                                   batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+
+        mem = rocblas_device_malloc(
+            (rocblas_handle)handle, sizeof(double) * min(m, n) * batch_count, size_V_copy);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E      = (double*)mem[0];
+        V_copy = (rocblas_double_complex*)mem[1];
+    }
+
+    // perform computation
+    CHECK_ROCBLAS_ERROR(hipsolver_auto_zgesvd_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              hip2rocblas_evect2svect(jobz, 0),
+                                                              m,
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              lda * n,
+                                                              S,
+                                                              min(m, n),
+                                                              (rocblas_double_complex*)U,
+                                                              ldu,
+                                                              ldu * m,
+                                                              V_copy,
+                                                              ldv_copy,
+                                                              ldv_copy * n,
+                                                              E,
+                                                              min(m, n),
+                                                              rocblas_outofplace,
+                                                              devInfo,
+                                                              batch_count));
+
+    // transpose V
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+        return rocblas2hip_status(
+            rocblas_zgeam_strided_batched((rocblas_handle)handle,
+                                          rocblas_operation_conjugate_transpose,
+                                          rocblas_operation_none,
+                                          n,
+                                          ldv_copy,
+                                          &one,
+                                          V_copy,
+                                          ldv_copy,
+                                          ldv_copy * n,
+                                          &zero,
+                                          V_copy,
+                                          ldv_copy,
+                                          ldv_copy * n,
+                                          (rocblas_double_complex*)V,
+                                          ldv,
+                                          ldv * n,
+                                          batch_count));
+    else
+        return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF ********************/
+hipsolverStatus_t hipsolverSgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_sgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_dgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_cgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_cgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_zgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
+    rocsolver_zgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  float*            A,
+                                  int               lda,
+                                  float*            work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(devIpiv != nullptr)
+        return rocblas2hip_status(
+            rocsolver_sgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
+    else
+        return rocblas2hip_status(
+            rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  double*           A,
+                                  int               lda,
+                                  double*           work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(devIpiv != nullptr)
+        return rocblas2hip_status(
+            rocsolver_dgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
+    else
+        return rocblas2hip_status(
+            rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipFloatComplex*  A,
+                                  int               lda,
+                                  hipFloatComplex*  work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(devIpiv != nullptr)
+        return rocblas2hip_status(rocsolver_cgetrf(
+            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devIpiv, devInfo));
+    else
+        return rocblas2hip_status(rocsolver_cgetrf_npvt(
+            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
+                                  int               m,
+                                  int               n,
+                                  hipDoubleComplex* A,
+                                  int               lda,
+                                  hipDoubleComplex* work,
+                                  int               lwork,
+                                  int*              devIpiv,
+                                  int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(devIpiv != nullptr)
+        return rocblas2hip_status(rocsolver_zgetrf(
+            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devIpiv, devInfo));
+    else
+        return rocblas2hip_status(rocsolver_zgetrf_npvt(
+            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_COALESCED ********************/
+} // extern C
+
+// Problems that are invalid or empty are not coalesced, so that the regular
+// function reports them to their caller
+template <typename T, typename U, typename F>
+static hipsolverStatus_t hipsolver_getrf_coalesced(hipsolverHandle_t    handle,
+                                                   hipsolverCoalescer_t coalescer,
+                                                   char                 precision,
+                                                   int                  m,
+                                                   int                  n,
+                                                   U*                   A,
+                                                   int                  lda,
+                                                   int*                 devIpiv,
+                                                   int*                 devInfo,
+                                                   F                    getrf)
+{
+    auto single = [&]() { return getrf(handle, m, n, A, lda, nullptr, 0, devIpiv, devInfo); };
+    if(!handle || !coalescer || m <= 0 || n <= 0 || lda < m || !A || !devInfo)
+        return single();
+
+    auto batched = [&](rocblas_handle h, void** dA, int* info, int* ipiv, int batch_count) {
+        if(devIpiv)
+            return rocblas2hip_status(xgetrf_batched(
+                h, m, n, (T**)dA, lda, ipiv, std::min(m, n), info, batch_count));
+        else
+            return rocblas2hip_status(
+                xgetrf_npvt_batched(h, m, n, (T**)dA, lda, info, batch_count));
+    };
+
+    int    function  = devIpiv ? hipsolver_coalesced_getrf : hipsolver_coalesced_getrf_npvt;
+    size_t ipiv_size = devIpiv ? std::min(m, n) : 0;
+
+    hipsolver_coalesced_key key(function, precision, 0, m, n, lda);
+    return ((hipsolver_coalescer*)coalescer)
+        ->submit((rocblas_handle)handle, key, A, devIpiv, ipiv_size, devInfo, single, batched);
+}
+
+extern "C" {
+
+hipsolverStatus_t hipsolverSgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          float*               A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_getrf_coalesced<float>(
+        handle, coalescer, 's', m, n, A, lda, devIpiv, devInfo, hipsolverSgetrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          double*              A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_getrf_coalesced<double>(
+        handle, coalescer, 'd', m, n, A, lda, devIpiv, devInfo, hipsolverDgetrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          hipFloatComplex*     A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_getrf_coalesced<rocblas_float_complex>(
+        handle, coalescer, 'c', m, n, A, lda, devIpiv, devInfo, hipsolverCgetrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          hipDoubleComplex*    A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_getrf_coalesced<rocblas_double_complex>(
+        handle, coalescer, 'z', m, n, A, lda, devIpiv, devInfo, hipsolverZgetrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        float*            A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_interleaved_bufferSize<float>(
+            (rocblas_handle)handle, m, n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        double*           A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_interleaved_bufferSize<double>(
+            (rocblas_handle)handle, m, n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        hipFloatComplex*  A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_interleaved_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        hipDoubleComplex* A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_interleaved_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             float*            work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgetrfInterleaved_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_interleaved((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             double*           work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgetrfInterleaved_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_interleaved((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgetrfInterleaved_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_interleaved((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgetrfInterleaved_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_interleaved((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_VBATCHED ********************/
+hipsolverStatus_t hipsolverSgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     float*            A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_vbatched_bufferSize<float>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     double*           A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_vbatched_bufferSize<double>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipFloatComplex*  A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_vbatched_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipDoubleComplex* A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrf_vbatched_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, m, n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          float*            A[],
+                                          const int*        lda,
+                                          float*            work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgetrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_vbatched(
+        (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          double*           A[],
+                                          const int*        lda,
+                                          double*           work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgetrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_vbatched(
+        (rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipFloatComplex*  A[],
+                                          const int*        lda,
+                                          hipFloatComplex*  work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgetrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_vbatched((rocblas_handle)handle,
+                                                       m,
+                                                       n,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       devIpiv,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipDoubleComplex* A[],
+                                          const int*        lda,
+                                          hipDoubleComplex* work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgetrfVbatched_bufferSize(
+            (rocblas_handle)handle, m, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrf_vbatched((rocblas_handle)handle,
+                                                       m,
+                                                       n,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       devIpiv,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS ********************/
+hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_getrs_row_major_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_sgetrs((rocblas_handle)handle,
+                                                     hip2rocblas_operation(trans),
+                                                     n,
+                                                     nrhs,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_getrs_row_major_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_dgetrs((rocblas_handle)handle,
+                                                     hip2rocblas_operation(trans),
+                                                     n,
+                                                     nrhs,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_getrs_row_major_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
+                                                     hip2rocblas_operation(trans),
+                                                     n,
+                                                     nrhs,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        status = rocblas2hip_status(hipsolver_getrs_row_major_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, &sz));
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
+                                                     hip2rocblas_operation(trans),
+                                                     n,
+                                                     nrhs,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  float*               A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  float*               B,
+                                  int                  ldb,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_getrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_operation(trans),
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      devIpiv,
+                                      B,
+                                      ldb,
+                                      B,
+                                      ldb));
+
+    return rocblas2hip_status(rocsolver_sgetrs(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  double*              A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  double*              B,
+                                  int                  ldb,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_getrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_operation(trans),
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      devIpiv,
+                                      B,
+                                      ldb,
+                                      B,
+                                      ldb));
+
+    return rocblas2hip_status(rocsolver_dgetrs(
+        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipFloatComplex*     B,
+                                  int                  ldb,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_getrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_operation(trans),
+                                      n,
+                                      nrhs,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      devIpiv,
+                                      (rocblas_float_complex*)B,
+                                      ldb,
+                                      (rocblas_float_complex*)B,
+                                      ldb));
+
+    return rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
+                                               hip2rocblas_operation(trans),
+                                               n,
+                                               nrhs,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               devIpiv,
+                                               (rocblas_float_complex*)B,
+                                               ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipDoubleComplex*    B,
+                                  int                  ldb,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgetrs_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_getrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_operation(trans),
+                                      n,
+                                      nrhs,
+                                      (rocblas_double_complex*)A,
+                                      lda,
+                                      devIpiv,
+                                      (rocblas_double_complex*)B,
+                                      ldb,
+                                      (rocblas_double_complex*)B,
+                                      ldb));
+
+    return rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
+                                               hip2rocblas_operation(trans),
+                                               n,
+                                               nrhs,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               devIpiv,
+                                               (rocblas_double_complex*)B,
+                                               ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        float*               A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        float*               B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrs_interleaved_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        double*              A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        double*              B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrs_interleaved_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        hipFloatComplex*     A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        hipFloatComplex*     B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrs_interleaved_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        hipDoubleComplex*    A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        hipDoubleComplex*    B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_getrs_interleaved_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             float*               work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgetrsInterleaved_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_operation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          devIpiv,
+                                                          B,
+                                                          ldb,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             double*              work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgetrsInterleaved_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_operation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          devIpiv,
+                                                          B,
+                                                          ldb,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             hipFloatComplex*     work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgetrsInterleaved_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_operation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          (rocblas_float_complex*)B,
+                                                          ldb,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             hipDoubleComplex*    work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgetrsInterleaved_bufferSize(
+            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_getrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_operation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          devIpiv,
+                                                          (rocblas_double_complex*)B,
+                                                          ldb,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV ********************/
+hipsolverStatus_t hipsolverSgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            float*            dl,
+                                            float*            d,
+                                            float*            du,
+                                            float*            B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<float>((rocblas_handle)handle, true, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            double*           dl,
+                                            double*           d,
+                                            double*           du,
+                                            double*           B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<double>((rocblas_handle)handle, true, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            hipFloatComplex*  dl,
+                                            hipFloatComplex*  d,
+                                            hipFloatComplex*  du,
+                                            hipFloatComplex*  B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, true, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            hipDoubleComplex* dl,
+                                            hipDoubleComplex* d,
+                                            hipDoubleComplex* du,
+                                            hipDoubleComplex* B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, true, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 float*            dl,
+                                 float*            d,
+                                 float*            du,
+                                 float*            B,
+                                 int               ldb,
+                                 float*            work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgtsv_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched(
+        (rocblas_handle)handle, true, n, nrhs, dl, d, du, 0, B, ldb, 0, devInfo, 1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 double*           dl,
+                                 double*           d,
+                                 double*           du,
+                                 double*           B,
+                                 int               ldb,
+                                 double*           work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgtsv_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched(
+        (rocblas_handle)handle, true, n, nrhs, dl, d, du, 0, B, ldb, 0, devInfo, 1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 hipFloatComplex*  dl,
+                                 hipFloatComplex*  d,
+                                 hipFloatComplex*  du,
+                                 hipFloatComplex*  B,
+                                 int               ldb,
+                                 hipFloatComplex*  work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgtsv_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             true,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)dl,
+                                                             (rocblas_float_complex*)d,
+                                                             (rocblas_float_complex*)du,
+                                                             0,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             0,
+                                                             devInfo,
+                                                             1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 hipDoubleComplex* dl,
+                                 hipDoubleComplex* d,
+                                 hipDoubleComplex* du,
+                                 hipDoubleComplex* B,
+                                 int               ldb,
+                                 hipDoubleComplex* work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgtsv_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             true,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)dl,
+                                                             (rocblas_double_complex*)d,
+                                                             (rocblas_double_complex*)du,
+                                                             0,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             0,
+                                                             devInfo,
+                                                             1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          float*            dl,
+                                                          float*            d,
+                                                          float*            du,
+                                                          int               strideD,
+                                                          float*            B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<float>((rocblas_handle)handle, true, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          double*           dl,
+                                                          double*           d,
+                                                          double*           du,
+                                                          int               strideD,
+                                                          double*           B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<double>((rocblas_handle)handle, true, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipFloatComplex*  dl,
+                                                          hipFloatComplex*  d,
+                                                          hipFloatComplex*  du,
+                                                          int               strideD,
+                                                          hipFloatComplex*  B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, true, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipDoubleComplex* dl,
+                                                          hipDoubleComplex* d,
+                                                          hipDoubleComplex* du,
+                                                          int               strideD,
+                                                          hipDoubleComplex* B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, true, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               float*            dl,
+                                               float*            d,
+                                               float*            du,
+                                               int               strideD,
+                                               float*            B,
+                                               int               ldb,
+                                               int               strideB,
+                                               float*            work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgtsvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      n,
+                                                                      nrhs,
+                                                                      dl,
+                                                                      d,
+                                                                      du,
+                                                                      strideD,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             true,
+                                                             n,
+                                                             nrhs,
+                                                             dl,
+                                                             d,
+                                                             du,
+                                                             strideD,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               double*           dl,
+                                               double*           d,
+                                               double*           du,
+                                               int               strideD,
+                                               double*           B,
+                                               int               ldb,
+                                               int               strideB,
+                                               double*           work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgtsvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      n,
+                                                                      nrhs,
+                                                                      dl,
+                                                                      d,
+                                                                      du,
+                                                                      strideD,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             true,
+                                                             n,
+                                                             nrhs,
+                                                             dl,
+                                                             d,
+                                                             du,
+                                                             strideD,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipFloatComplex*  dl,
+                                               hipFloatComplex*  d,
+                                               hipFloatComplex*  du,
+                                               int               strideD,
+                                               hipFloatComplex*  B,
+                                               int               ldb,
+                                               int               strideB,
+                                               hipFloatComplex*  work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgtsvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      n,
+                                                                      nrhs,
+                                                                      dl,
+                                                                      d,
+                                                                      du,
+                                                                      strideD,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             true,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)dl,
+                                                             (rocblas_float_complex*)d,
+                                                             (rocblas_float_complex*)du,
+                                                             strideD,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipDoubleComplex* dl,
+                                               hipDoubleComplex* d,
+                                               hipDoubleComplex* du,
+                                               int               strideD,
+                                               hipDoubleComplex* B,
+                                               int               ldb,
+                                               int               strideB,
+                                               hipDoubleComplex* work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgtsvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      n,
+                                                                      nrhs,
+                                                                      dl,
+                                                                      d,
+                                                                      du,
+                                                                      strideD,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             true,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)dl,
+                                                             (rocblas_double_complex*)d,
+                                                             (rocblas_double_complex*)du,
+                                                             strideD,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV_NOPIVOT ********************/
+hipsolverStatus_t hipsolverSgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            dl,
+                                                   float*            d,
+                                                   float*            du,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<float>((rocblas_handle)handle, false, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           dl,
+                                                   double*           d,
+                                                   double*           du,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<double>((rocblas_handle)handle, false, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipFloatComplex*  dl,
+                                                   hipFloatComplex*  d,
+                                                   hipFloatComplex*  du,
+                                                   hipFloatComplex*  B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, false, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* dl,
+                                                   hipDoubleComplex* d,
+                                                   hipDoubleComplex* du,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, false, n, nrhs, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        float*            dl,
+                                        float*            d,
+                                        float*            du,
+                                        float*            B,
+                                        int               ldb,
+                                        float*            work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgtsvNopivot_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched(
+        (rocblas_handle)handle, false, n, nrhs, dl, d, du, 0, B, ldb, 0, devInfo, 1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           dl,
+                                        double*           d,
+                                        double*           du,
+                                        double*           B,
+                                        int               ldb,
+                                        double*           work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgtsvNopivot_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched(
+        (rocblas_handle)handle, false, n, nrhs, dl, d, du, 0, B, ldb, 0, devInfo, 1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        hipFloatComplex*  dl,
+                                        hipFloatComplex*  d,
+                                        hipFloatComplex*  du,
+                                        hipFloatComplex*  B,
+                                        int               ldb,
+                                        hipFloatComplex*  work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgtsvNopivot_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             false,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)dl,
+                                                             (rocblas_float_complex*)d,
+                                                             (rocblas_float_complex*)du,
+                                                             0,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             0,
+                                                             devInfo,
+                                                             1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        hipDoubleComplex* dl,
+                                        hipDoubleComplex* d,
+                                        hipDoubleComplex* du,
+                                        hipDoubleComplex* B,
+                                        int               ldb,
+                                        hipDoubleComplex* work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgtsvNopivot_bufferSize(
+            (rocblas_handle)handle, n, nrhs, dl, d, du, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             false,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)dl,
+                                                             (rocblas_double_complex*)d,
+                                                             (rocblas_double_complex*)du,
+                                                             0,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             0,
+                                                             devInfo,
+                                                             1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV_NOPIVOT_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 float*            dl,
+                                                                 float*            d,
+                                                                 float*            du,
+                                                                 int               strideD,
+                                                                 float*            B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<float>((rocblas_handle)handle, false, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 double*           dl,
+                                                                 double*           d,
+                                                                 double*           du,
+                                                                 int               strideD,
+                                                                 double*           B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<double>(
+            (rocblas_handle)handle, false, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 hipFloatComplex*  dl,
+                                                                 hipFloatComplex*  d,
+                                                                 hipFloatComplex*  du,
+                                                                 int               strideD,
+                                                                 hipFloatComplex*  B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, false, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 hipDoubleComplex* dl,
+                                                                 hipDoubleComplex* d,
+                                                                 hipDoubleComplex* du,
+                                                                 int               strideD,
+                                                                 hipDoubleComplex* B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_gtsv_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, false, n, nrhs, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      float*            dl,
+                                                      float*            d,
+                                                      float*            du,
+                                                      int               strideD,
+                                                      float*            B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      float*            work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSgtsvNopivotStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                             n,
+                                                                             nrhs,
+                                                                             dl,
+                                                                             d,
+                                                                             du,
+                                                                             strideD,
+                                                                             B,
+                                                                             ldb,
+                                                                             strideB,
+                                                                             &lwork,
+                                                                             batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             false,
+                                                             n,
+                                                             nrhs,
+                                                             dl,
+                                                             d,
+                                                             du,
+                                                             strideD,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      double*           dl,
+                                                      double*           d,
+                                                      double*           du,
+                                                      int               strideD,
+                                                      double*           B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      double*           work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDgtsvNopivotStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                             n,
+                                                                             nrhs,
+                                                                             dl,
+                                                                             d,
+                                                                             du,
+                                                                             strideD,
+                                                                             B,
+                                                                             ldb,
+                                                                             strideB,
+                                                                             &lwork,
+                                                                             batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             false,
+                                                             n,
+                                                             nrhs,
+                                                             dl,
+                                                             d,
+                                                             du,
+                                                             strideD,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      hipFloatComplex*  dl,
+                                                      hipFloatComplex*  d,
+                                                      hipFloatComplex*  du,
+                                                      int               strideD,
+                                                      hipFloatComplex*  B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      hipFloatComplex*  work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCgtsvNopivotStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                             n,
+                                                                             nrhs,
+                                                                             dl,
+                                                                             d,
+                                                                             du,
+                                                                             strideD,
+                                                                             B,
+                                                                             ldb,
+                                                                             strideB,
+                                                                             &lwork,
+                                                                             batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             false,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)dl,
+                                                             (rocblas_float_complex*)d,
+                                                             (rocblas_float_complex*)du,
+                                                             strideD,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      hipDoubleComplex* dl,
+                                                      hipDoubleComplex* d,
+                                                      hipDoubleComplex* du,
+                                                      int               strideD,
+                                                      hipDoubleComplex* B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      hipDoubleComplex* work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZgtsvNopivotStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                             n,
+                                                                             nrhs,
+                                                                             dl,
+                                                                             d,
+                                                                             du,
+                                                                             strideD,
+                                                                             B,
+                                                                             ldb,
+                                                                             strideB,
+                                                                             &lwork,
+                                                                             batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_gtsv_strided_batched((rocblas_handle)handle,
+                                                             false,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)dl,
+                                                             (rocblas_double_complex*)d,
+                                                             (rocblas_double_complex*)du,
+                                                             strideD,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRF ********************/
+hipsolverStatus_t hipsolverSpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             float*              AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             double*             AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             hipFloatComplex*    AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             hipDoubleComplex*   AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  float*              AB,
+                                  int                 ldab,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpbtrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, AB, ldab, 0, devInfo, 1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  double*             AB,
+                                  int                 ldab,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpbtrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, AB, ldab, 0, devInfo, 1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  hipFloatComplex*    AB,
+                                  int                 ldab,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpbtrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              (rocblas_float_complex*)AB,
+                                                              ldab,
+                                                              0,
+                                                              devInfo,
+                                                              1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  hipDoubleComplex*   AB,
+                                  int                 ldab,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpbtrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              (rocblas_double_complex*)AB,
+                                                              ldab,
+                                                              0,
+                                                              devInfo,
+                                                              1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRF_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           float*              AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           double*             AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           hipFloatComplex*    AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           hipDoubleComplex*   AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrf_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                float*              AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpbtrfStridedBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, strideAB, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                double*             AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpbtrfStridedBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, strideAB, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                hipFloatComplex*    AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipFloatComplex*    work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpbtrfStridedBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, strideAB, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              (rocblas_float_complex*)AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                hipDoubleComplex*   AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipDoubleComplex*   work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpbtrfStridedBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, AB, ldab, strideAB, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              (rocblas_double_complex*)AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRS ********************/
+hipsolverStatus_t hipsolverSpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             float*              AB,
+                                             int                 ldab,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             double*             AB,
+                                             int                 ldab,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             hipFloatComplex*    AB,
+                                             int                 ldab,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   AB,
+                                             int                 ldab,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, 1, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  float*              AB,
+                                  int                 ldab,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpbtrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              AB,
+                                                              ldab,
+                                                              0,
+                                                              B,
+                                                              ldb,
+                                                              0,
+                                                              devInfo,
+                                                              1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  double*             AB,
+                                  int                 ldab,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpbtrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              AB,
+                                                              ldab,
+                                                              0,
+                                                              B,
+                                                              ldb,
+                                                              0,
+                                                              devInfo,
+                                                              1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  hipFloatComplex*    AB,
+                                  int                 ldab,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpbtrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)AB,
+                                                              ldab,
+                                                              0,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb,
+                                                              0,
+                                                              devInfo,
+                                                              1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   AB,
+                                  int                 ldab,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpbtrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)AB,
+                                                              ldab,
+                                                              0,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb,
+                                                              0,
+                                                              devInfo,
+                                                              1));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRS_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           float*              AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           float*              B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           double*             AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           double*             B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           hipFloatComplex*    AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           hipFloatComplex*    B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           hipDoubleComplex*   AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           hipDoubleComplex*   B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pbtrs_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, kd, nrhs, ldab, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                float*              AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                float*              B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpbtrsStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                       uplo,
+                                                                       n,
+                                                                       kd,
+                                                                       nrhs,
+                                                                       AB,
+                                                                       ldab,
+                                                                       strideAB,
+                                                                       B,
+                                                                       ldb,
+                                                                       strideB,
+                                                                       &lwork,
+                                                                       batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              B,
+                                                              ldb,
+                                                              strideB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                double*             AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                double*             B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpbtrsStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                       uplo,
+                                                                       n,
+                                                                       kd,
+                                                                       nrhs,
+                                                                       AB,
+                                                                       ldab,
+                                                                       strideAB,
+                                                                       B,
+                                                                       ldb,
+                                                                       strideB,
+                                                                       &lwork,
+                                                                       batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              B,
+                                                              ldb,
+                                                              strideB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                hipFloatComplex*    AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipFloatComplex*    B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                hipFloatComplex*    work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpbtrsStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                       uplo,
+                                                                       n,
+                                                                       kd,
+                                                                       nrhs,
+                                                                       AB,
+                                                                       ldab,
+                                                                       strideAB,
+                                                                       B,
+                                                                       ldb,
+                                                                       strideB,
+                                                                       &lwork,
+                                                                       batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                hipDoubleComplex*   AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipDoubleComplex*   B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                hipDoubleComplex*   work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpbtrsStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                       uplo,
+                                                                       n,
+                                                                       kd,
+                                                                       nrhs,
+                                                                       AB,
+                                                                       ldab,
+                                                                       strideAB,
+                                                                       B,
+                                                                       ldb,
+                                                                       strideB,
+                                                                       &lwork,
+                                                                       batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_pbtrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              kd,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)AB,
+                                                              ldab,
+                                                              strideAB,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              devInfo,
+                                                              batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV ********************/
+hipsolverStatus_t hipsolverSposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            float*              A,
+                                            int                 lda,
+                                            float*              B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            double*             A,
+                                            int                 lda,
+                                            double*             B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipFloatComplex*    A,
+                                            int                 lda,
+                                            hipFloatComplex*    B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipDoubleComplex*   A,
+                                            int                 lda,
+                                            hipDoubleComplex*   B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 float*              A,
+                                 int                 lda,
+                                 float*              B,
+                                 int                 ldb,
+                                 float*              work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSposv_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv((rocblas_handle)handle,
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             nrhs,
+                                             A,
+                                             lda,
+                                             B,
+                                             ldb,
+                                             devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 double*             A,
+                                 int                 lda,
+                                 double*             B,
+                                 int                 ldb,
+                                 double*             work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDposv_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv((rocblas_handle)handle,
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             nrhs,
+                                             A,
+                                             lda,
+                                             B,
+                                             ldb,
+                                             devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 hipFloatComplex*    A,
+                                 int                 lda,
+                                 hipFloatComplex*    B,
+                                 int                 ldb,
+                                 hipFloatComplex*    work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCposv_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv((rocblas_handle)handle,
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             nrhs,
+                                             (rocblas_float_complex*)A,
+                                             lda,
+                                             (rocblas_float_complex*)B,
+                                             ldb,
+                                             devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 hipDoubleComplex*   A,
+                                 int                 lda,
+                                 hipDoubleComplex*   B,
+                                 int                 ldb,
+                                 hipDoubleComplex*   work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZposv_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv((rocblas_handle)handle,
+                                             hip2rocblas_fill(uplo),
+                                             n,
+                                             nrhs,
+                                             (rocblas_double_complex*)A,
+                                             lda,
+                                             (rocblas_double_complex*)B,
+                                             ldb,
+                                             devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV_BATCHED ********************/
+hipsolverStatus_t hipsolverSposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A[],
+                                                   int                 lda,
+                                                   float*              B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_batched_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A[],
+                                                   int                 lda,
+                                                   double*             B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_batched_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    A[],
+                                                   int                 lda,
+                                                   hipFloatComplex*    B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_batched_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   A[],
+                                                   int                 lda,
+                                                   hipDoubleComplex*   B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_batched_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A[],
+                                        int                 lda,
+                                        float*              B[],
+                                        int                 ldb,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSposvBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_batched((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     B,
+                                                     ldb,
+                                                     devInfo,
+                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A[],
+                                        int                 lda,
+                                        double*             B[],
+                                        int                 ldb,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDposvBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_batched((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     B,
+                                                     ldb,
+                                                     devInfo,
+                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipFloatComplex*    A[],
+                                        int                 lda,
+                                        hipFloatComplex*    B[],
+                                        int                 ldb,
+                                        hipFloatComplex*    work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCposvBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_batched((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_float_complex**)A,
+                                                     lda,
+                                                     (rocblas_float_complex**)B,
+                                                     ldb,
+                                                     devInfo,
+                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipDoubleComplex*   A[],
+                                        int                 lda,
+                                        hipDoubleComplex*   B[],
+                                        int                 ldb,
+                                        hipDoubleComplex*   work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZposvBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_batched((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_double_complex**)A,
+                                                     lda,
+                                                     (rocblas_double_complex**)B,
+                                                     ldb,
+                                                     devInfo,
+                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_strided_batched_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, strideA, ldb, strideB, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_strided_batched_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, strideA, ldb, strideB, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipFloatComplex*    A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          hipFloatComplex*    B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_strided_batched_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, strideA, ldb, strideB, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipDoubleComplex*   A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          hipDoubleComplex*   B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_posv_strided_batched_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, strideA, ldb, strideB, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSposvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      uplo,
+                                                                      n,
+                                                                      nrhs,
+                                                                      A,
+                                                                      lda,
+                                                                      strideA,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_strided_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDposvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      uplo,
+                                                                      n,
+                                                                      nrhs,
+                                                                      A,
+                                                                      lda,
+                                                                      strideA,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_strided_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipFloatComplex*    A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipFloatComplex*    B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               hipFloatComplex*    work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCposvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      uplo,
+                                                                      n,
+                                                                      nrhs,
+                                                                      A,
+                                                                      lda,
+                                                                      strideA,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_strided_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipDoubleComplex*   A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipDoubleComplex*   B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               hipDoubleComplex*   work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZposvStridedBatched_bufferSize((rocblas_handle)handle,
+                                                                      uplo,
+                                                                      n,
+                                                                      nrhs,
+                                                                      A,
+                                                                      lda,
+                                                                      strideA,
+                                                                      B,
+                                                                      ldb,
+                                                                      strideB,
+                                                                      &lwork,
+                                                                      batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_posv_strided_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF ********************/
+hipsolverStatus_t hipsolverSpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_cpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_zpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    return rocblas2hip_status(
+        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    return rocblas2hip_status(
+        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    return rocblas2hip_status(rocsolver_cpotrf((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
+    return rocblas2hip_status(rocsolver_zpotrf((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_spotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_spotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_dpotrf_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cpotrf_batched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zpotrf_batched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_COALESCED ********************/
+} // extern C
+
+// As for getrf, invalid or empty problems are not coalesced
+template <typename T, typename U, typename F>
+static hipsolverStatus_t hipsolver_potrf_coalesced(hipsolverHandle_t    handle,
+                                                   hipsolverCoalescer_t coalescer,
+                                                   char                 precision,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   U*                   A,
+                                                   int                  lda,
+                                                   int*                 devInfo,
+                                                   F                    potrf)
+{
+    auto single = [&]() { return potrf(handle, uplo, n, A, lda, nullptr, 0, devInfo); };
+    if(!handle || !coalescer || n <= 0 || lda < n || !A || !devInfo)
+        return single();
+
+    // the regular function flips the fill mode of a row-major handle
+    rocblas_fill fill    = hip2rocblas_fill(hipsolver_is_row_major((rocblas_handle)handle)
+                                                ? hipsolver_transpose_fill(uplo)
+                                                : uplo);
+    auto         batched = [&](rocblas_handle h, void** dA, int* info, int*, int batch_count) {
+        return rocblas2hip_status(xpotrf_batched(h, fill, n, (T**)dA, lda, info, batch_count));
+    };
+
+    hipsolver_coalesced_key key(hipsolver_coalesced_potrf, precision, fill, n, n, lda);
+    return ((hipsolver_coalescer*)coalescer)
+        ->submit((rocblas_handle)handle, key, A, nullptr, 0, devInfo, single, batched);
+}
+
+extern "C" {
+
+hipsolverStatus_t hipsolverSpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          float*               A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_potrf_coalesced<float>(
+        handle, coalescer, 's', uplo, n, A, lda, devInfo, hipsolverSpotrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          double*              A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_potrf_coalesced<double>(
+        handle, coalescer, 'd', uplo, n, A, lda, devInfo, hipsolverDpotrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          hipFloatComplex*     A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_potrf_coalesced<rocblas_float_complex>(
+        handle, coalescer, 'c', uplo, n, A, lda, devInfo, hipsolverCpotrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          hipDoubleComplex*    A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return hipsolver_potrf_coalesced<rocblas_double_complex>(
+        handle, coalescer, 'z', uplo, n, A, lda, devInfo, hipsolverZpotrf);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        float*              A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_interleaved_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        double*             A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_interleaved_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        hipFloatComplex*    A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_interleaved_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        hipDoubleComplex*   A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_interleaved_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          A,
+                                                          lda,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          devInfo,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_PIPELINED ********************/
+} // extern C
+
+template <typename T, typename FF, typename FS>
+static hipsolverStatus_t hipsolver_potrf_pipelined(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   T*                  A,
+                                                   int                 lda,
+                                                   T*                  B,
+                                                   int                 ldb,
+                                                   int*                info,
+                                                   int                 batch_count,
+                                                   int                 chunk_size,
+                                                   FF                  potrf_batched,
+                                                   FS                  potrs_batched)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n < 0 || nrhs < 0 || lda < std::max(n, 1) || (nrhs > 0 && ldb < std::max(n, 1))
+       || batch_count < 0 || chunk_size < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((n && batch_count && !A) || (n && nrhs && batch_count && !B) || (batch_count && !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(n == 0 || batch_count == 0)
+    {
+        std::fill(info, info + batch_count, 0);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream((rocblas_handle)handle, &stream));
+
+    std::vector<hipsolver_pipeline_array> arrays = {{A, sizeof(T) * lda * n, true, true}};
+    if(nrhs > 0)
+        arrays.push_back({B, sizeof(T) * ldb * nrhs, true, true});
+
+    hipsolver_pipeline pipeline(stream, std::move(arrays), info, batch_count, chunk_size);
+    return pipeline.run([&](const hipsolver_pipeline::chunk& c) {
+        T** dA = (T**)c.pointers[0];
+        CHECK_HIPSOLVER_ERROR(
+            potrf_batched(handle, uplo, n, dA, lda, nullptr, 0, c.info, c.count));
+        if(nrhs == 0)
+            return HIPSOLVER_STATUS_SUCCESS;
+
+        // the infos of potrs would overwrite those of potrf
+        T** dB = (T**)c.pointers[1];
+        return potrs_batched(
+            handle, uplo, n, nrhs, dA, lda, dB, ldb, nullptr, 0, c.scratch_info, c.count);
+    });
+}
+
+extern "C" {
+
+hipsolverStatus_t hipsolverSpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           float*              A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return hipsolver_potrf_pipelined(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     info,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverSpotrfBatched,
+                                     hipsolverSpotrsBatched);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           double*             A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return hipsolver_potrf_pipelined(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     info,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverDpotrfBatched,
+                                     hipsolverDpotrsBatched);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           hipFloatComplex*    B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return hipsolver_potrf_pipelined(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     info,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverCpotrfBatched,
+                                     hipsolverCpotrsBatched);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           hipDoubleComplex*   B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return hipsolver_potrf_pipelined(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     info,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverZpotrfBatched,
+                                     hipsolverZpotrsBatched);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_VBATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     float*              A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_vbatched_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     double*             A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_vbatched_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     hipFloatComplex*    A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_vbatched_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     hipDoubleComplex*   A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_vbatched_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, lda, batch_count, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          float*              A[],
+                                          const int*          lda,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_vbatched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          double*             A[],
+                                          const int*          lda,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_vbatched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          hipFloatComplex*    A[],
+                                          const int*          lda,
+                                          hipFloatComplex*    work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_vbatched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          hipDoubleComplex*   A[],
+                                          const int*          lda,
+                                          hipDoubleComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_vbatched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       devInfo,
+                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_UPDATE ********************/
+hipsolverStatus_t hipsolverSpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float*              V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double*             V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   hipFloatComplex*    V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   hipDoubleComplex*   V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        float*              A,
+                                        int                 lda,
+                                        float*              V,
+                                        int                 ldv,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfUpdate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, A, lda, V, ldv, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        double*             A,
+                                        int                 lda,
+                                        double*             V,
+                                        int                 ldv,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfUpdate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, A, lda, V, ldv, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        hipFloatComplex*    A,
+                                        int                 lda,
+                                        hipFloatComplex*    V,
+                                        int                 ldv,
+                                        hipFloatComplex*    work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfUpdate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     k,
+                                                     (rocblas_float_complex*)A,
+                                                     lda,
+                                                     (rocblas_float_complex*)V,
+                                                     ldv,
+                                                     devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        hipDoubleComplex*   A,
+                                        int                 lda,
+                                        hipDoubleComplex*   V,
+                                        int                 ldv,
+                                        hipDoubleComplex*   work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfUpdate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update((rocblas_handle)handle,
+                                                     hip2rocblas_fill(uplo),
+                                                     n,
+                                                     k,
+                                                     (rocblas_double_complex*)A,
+                                                     lda,
+                                                     (rocblas_double_complex*)V,
+                                                     ldv,
+                                                     devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_UPDATE_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<float>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<double>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipFloatComplex*    A[],
+                                                          int                 lda,
+                                                          hipFloatComplex*    V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipDoubleComplex*   A[],
+                                                          int                 lda,
+                                                          hipDoubleComplex*   V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               float*              A[],
+                                               int                 lda,
+                                               float*              V[],
+                                               int                 ldv,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfUpdateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             k,
+                                                             A,
+                                                             lda,
+                                                             V,
+                                                             ldv,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               double*             A[],
+                                               int                 lda,
+                                               double*             V[],
+                                               int                 ldv,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfUpdateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             k,
+                                                             A,
+                                                             lda,
+                                                             V,
+                                                             ldv,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               hipFloatComplex*    A[],
+                                               int                 lda,
+                                               hipFloatComplex*    V[],
+                                               int                 ldv,
+                                               hipFloatComplex*    work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfUpdateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             k,
+                                                             (rocblas_float_complex**)A,
+                                                             lda,
+                                                             (rocblas_float_complex**)V,
+                                                             ldv,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               hipDoubleComplex*   A[],
+                                               int                 lda,
+                                               hipDoubleComplex*   V[],
+                                               int                 ldv,
+                                               hipDoubleComplex*   work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfUpdateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_batched((rocblas_handle)handle,
+                                                             hip2rocblas_fill(uplo),
+                                                             n,
+                                                             k,
+                                                             (rocblas_double_complex**)A,
+                                                             lda,
+                                                             (rocblas_double_complex**)V,
+                                                             ldv,
+                                                             devInfo,
+                                                             batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_UPDATE_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<float>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<double>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipFloatComplex*    V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipDoubleComplex*   V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_update_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      float*              V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      float*              work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfUpdateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_strided_batched((rocblas_handle)handle,
+                                                                     hip2rocblas_fill(uplo),
+                                                                     n,
+                                                                     k,
+                                                                     A,
+                                                                     lda,
+                                                                     strideA,
+                                                                     V,
+                                                                     ldv,
+                                                                     strideV,
+                                                                     devInfo,
+                                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      double*             V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      double*             work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfUpdateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_strided_batched((rocblas_handle)handle,
+                                                                     hip2rocblas_fill(uplo),
+                                                                     n,
+                                                                     k,
+                                                                     A,
+                                                                     lda,
+                                                                     strideA,
+                                                                     V,
+                                                                     ldv,
+                                                                     strideV,
+                                                                     devInfo,
+                                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      hipFloatComplex*    V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      hipFloatComplex*    work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfUpdateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_strided_batched((rocblas_handle)handle,
+                                                                     hip2rocblas_fill(uplo),
+                                                                     n,
+                                                                     k,
+                                                                     (rocblas_float_complex*)A,
+                                                                     lda,
+                                                                     strideA,
+                                                                     (rocblas_float_complex*)V,
+                                                                     ldv,
+                                                                     strideV,
+                                                                     devInfo,
+                                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      hipDoubleComplex*   V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      hipDoubleComplex*   work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfUpdateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_update_strided_batched((rocblas_handle)handle,
+                                                                     hip2rocblas_fill(uplo),
+                                                                     n,
+                                                                     k,
+                                                                     (rocblas_double_complex*)A,
+                                                                     lda,
+                                                                     strideA,
+                                                                     (rocblas_double_complex*)V,
+                                                                     ldv,
+                                                                     strideV,
+                                                                     devInfo,
+                                                                     batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_DOWNDATE ********************/
+hipsolverStatus_t hipsolverSpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     float*              V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     double*             V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipFloatComplex*    A,
+                                                     int                 lda,
+                                                     hipFloatComplex*    V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipDoubleComplex*   A,
+                                                     int                 lda,
+                                                     hipDoubleComplex*   V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, lda, ldv, 1, false, &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          float*              A,
+                                          int                 lda,
+                                          float*              V,
+                                          int                 ldv,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfDowndate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, A, lda, V, ldv, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          double*             A,
+                                          int                 lda,
+                                          double*             V,
+                                          int                 ldv,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfDowndate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, k, A, lda, V, ldv, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          hipFloatComplex*    A,
+                                          int                 lda,
+                                          hipFloatComplex*    V,
+                                          int                 ldv,
+                                          hipFloatComplex*    work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfDowndate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       k,
+                                                       (rocblas_float_complex*)A,
+                                                       lda,
+                                                       (rocblas_float_complex*)V,
+                                                       ldv,
+                                                       devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          hipDoubleComplex*   A,
+                                          int                 lda,
+                                          hipDoubleComplex*   V,
+                                          int                 ldv,
+                                          hipDoubleComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfDowndate_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       k,
+                                                       (rocblas_double_complex*)A,
+                                                       lda,
+                                                       (rocblas_double_complex*)V,
+                                                       ldv,
+                                                       devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_DOWNDATE_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            float*              A[],
+                                                            int                 lda,
+                                                            float*              V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<float>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            double*             A[],
+                                                            int                 lda,
+                                                            double*             V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<double>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            hipFloatComplex*    A[],
+                                                            int                 lda,
+                                                            hipFloatComplex*    V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            hipDoubleComplex*   A[],
+                                                            int                 lda,
+                                                            hipDoubleComplex*   V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            true,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 float*              A[],
+                                                 int                 lda,
+                                                 float*              V[],
+                                                 int                 ldv,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfDowndateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_batched((rocblas_handle)handle,
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               k,
+                                                               A,
+                                                               lda,
+                                                               V,
+                                                               ldv,
+                                                               devInfo,
+                                                               batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 double*             A[],
+                                                 int                 lda,
+                                                 double*             V[],
+                                                 int                 ldv,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfDowndateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_batched((rocblas_handle)handle,
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               k,
+                                                               A,
+                                                               lda,
+                                                               V,
+                                                               ldv,
+                                                               devInfo,
+                                                               batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 hipFloatComplex*    A[],
+                                                 int                 lda,
+                                                 hipFloatComplex*    V[],
+                                                 int                 ldv,
+                                                 hipFloatComplex*    work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfDowndateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_batched((rocblas_handle)handle,
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               k,
+                                                               (rocblas_float_complex**)A,
+                                                               lda,
+                                                               (rocblas_float_complex**)V,
+                                                               ldv,
+                                                               devInfo,
+                                                               batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 hipDoubleComplex*   A[],
+                                                 int                 lda,
+                                                 hipDoubleComplex*   V[],
+                                                 int                 ldv,
+                                                 hipDoubleComplex*   work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfDowndateBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, k, A, lda, V, ldv, &lwork, batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_batched((rocblas_handle)handle,
+                                                               hip2rocblas_fill(uplo),
+                                                               n,
+                                                               k,
+                                                               (rocblas_double_complex**)A,
+                                                               lda,
+                                                               (rocblas_double_complex**)V,
+                                                               ldv,
+                                                               devInfo,
+                                                               batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_DOWNDATE_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   float*              A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   float*              V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<float>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   double*             A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   double*             V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<double>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   hipFloatComplex*    A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   hipFloatComplex*    V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   hipDoubleComplex*   A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   hipDoubleComplex*   V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrf_downdate_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle,
+            hip2rocblas_fill(uplo),
+            n,
+            k,
+            lda,
+            ldv,
+            batch_count,
+            false,
+            &sz));
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        float*              A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        float*              V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        float*              work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfDowndateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_strided_batched((rocblas_handle)handle,
+                                                                       hip2rocblas_fill(uplo),
+                                                                       n,
+                                                                       k,
+                                                                       A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       V,
+                                                                       ldv,
+                                                                       strideV,
+                                                                       devInfo,
+                                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        double*             A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        double*             V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        double*             work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfDowndateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_strided_batched((rocblas_handle)handle,
+                                                                       hip2rocblas_fill(uplo),
+                                                                       n,
+                                                                       k,
+                                                                       A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       V,
+                                                                       ldv,
+                                                                       strideV,
+                                                                       devInfo,
+                                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        hipFloatComplex*    A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        hipFloatComplex*    V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        hipFloatComplex*    work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfDowndateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_strided_batched((rocblas_handle)handle,
+                                                                       hip2rocblas_fill(uplo),
+                                                                       n,
+                                                                       k,
+                                                                       (rocblas_float_complex*)A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       (rocblas_float_complex*)V,
+                                                                       ldv,
+                                                                       strideV,
+                                                                       devInfo,
+                                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        hipDoubleComplex*   A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        hipDoubleComplex*   V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        hipDoubleComplex*   work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfDowndateStridedBatched_bufferSize(
+            (rocblas_handle)handle,
+            uplo,
+            n,
+            k,
+            A,
+            lda,
+            strideA,
+            V,
+            ldv,
+            strideV,
+            &lwork,
+            batch_count));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(hipsolver_potrf_downdate_strided_batched((rocblas_handle)handle,
+                                                                       hip2rocblas_fill(uplo),
+                                                                       n,
+                                                                       k,
+                                                                       (rocblas_double_complex*)A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       (rocblas_double_complex*)V,
+                                                                       ldv,
+                                                                       strideV,
+                                                                       devInfo,
+                                                                       batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRI ********************/
+hipsolverStatus_t hipsolverSpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_spotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_dpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotri_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_cpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotri_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status = rocblas2hip_status(
+        rocsolver_zpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverSpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(
+        rocsolver_spotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverDpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(
+        rocsolver_dpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverCpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_cpotri((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(
+            hipsolverZpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    return rocblas2hip_status(rocsolver_zpotri((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRS ********************/
+hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+    {
+        rocblas_fill fill = hip2rocblas_fill(hipsolver_transpose_fill(uplo));
+        status            = rocblas2hip_status(hipsolver_potrs_row_major_bufferSize<float>(
+            (rocblas_handle)handle, fill, n, nrhs, &sz));
+    }
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_spotrs(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+    {
+        rocblas_fill fill = hip2rocblas_fill(hipsolver_transpose_fill(uplo));
+        status            = rocblas2hip_status(hipsolver_potrs_row_major_bufferSize<double>(
+            (rocblas_handle)handle, fill, n, nrhs, &sz));
+    }
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_dpotrs(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+    {
+        rocblas_fill fill = hip2rocblas_fill(hipsolver_transpose_fill(uplo));
+        status            = rocblas2hip_status(
+            hipsolver_potrs_row_major_bufferSize<rocblas_float_complex>(
+                (rocblas_handle)handle, fill, n, nrhs, &sz));
+    }
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_cpotrs(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(lwork == nullptr)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    size_t sz;
+
+    hipsolverStatus_t status;
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+    {
+        rocblas_fill fill = hip2rocblas_fill(hipsolver_transpose_fill(uplo));
+        status            = rocblas2hip_status(
+            hipsolver_potrs_row_major_bufferSize<rocblas_double_complex>(
+                (rocblas_handle)handle, fill, n, nrhs, &sz));
+    }
+    else
+    {
+        rocblas_start_device_memory_size_query((rocblas_handle)handle);
+        status = rocblas2hip_status(rocsolver_zpotrs(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
+        rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    }
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return status;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
+    }
+
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_potrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_fill(hipsolver_transpose_fill(uplo)),
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      B,
+                                      ldb));
+
+    return rocblas2hip_status(
+        rocsolver_spotrs((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnCgesvdjBatched_bufferSize((rocblas_handle)handle,
-                                                                   jobz,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   S,
-                                                                   U,
-                                                                   ldu,
-                                                                   V,
-                                                                   ldv,
-                                                                   &lwork,
-                                                                   params,
-                                                                   batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-
-        mem = rocblas_device_malloc(
-            (rocblas_handle)handle, sizeof(float) * min(m, n) * batch_count, size_V_copy);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        E      = (float*)mem[0];
-        V_copy = (rocblas_float_complex*)mem[1];
     }
 
-    // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_cgesvd_strided_batched((rocblas_handle)handle,
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         m,
-                                                         n,
-                                                         (rocblas_float_complex*)A,
-                                                         lda,
-                                                         lda * n,
-                                                         S,
-                                                         min(m, n),
-                                                         (rocblas_float_complex*)U,
-                                                         ldu,
-                                                         ldu * m,
-                                                         V_copy,
-                                                         ldv_copy,
-                                                         ldv_copy * n,
-                                                         E,
-                                                         min(m, n),
-                                                         rocblas_outofplace,
-                                                         devInfo,
-                                                         batch_count));
-
-    // transpose V
-    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    if(hipsolver_is_row_major((rocblas_handle)handle))
         return rocblas2hip_status(
-            rocblas_cgeam_strided_batched((rocblas_handle)handle,
-                                          rocblas_operation_conjugate_transpose,
-                                          rocblas_operation_none,
-                                          n,
-                                          ldv_copy,
-                                          &one,
-                                          V_copy,
-                                          ldv_copy,
-                                          ldv_copy * n,
-                                          &zero,
-                                          V_copy,
-                                          ldv_copy,
-                                          ldv_copy * n,
-                                          (rocblas_float_complex*)V,
-                                          ldv,
-                                          ldv * n,
-                                          batch_count));
-    else
-        return HIPSOLVER_STATUS_SUCCESS;
+            hipsolver_potrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_fill(hipsolver_transpose_fill(uplo)),
+                                      n,
+                                      nrhs,
+                                      A,
+                                      lda,
+                                      B,
+                                      ldb));
+
+    return rocblas2hip_status(
+        rocsolver_dpotrs((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnZgesvdjBatched(hipsolverDnHandle_t   handle,
-                                            hipsolverEigMode_t    jobz,
-                                            int                   m,
-                                            int                   n,
-                                            hipDoubleComplex*     A,
-                                            int                   lda,
-                                            double*               S,
-                                            hipDoubleComplex*     U,
-                                            int                   ldu,
-                                            hipDoubleComplex*     V,
-                                            int                   ldv,
-                                            hipDoubleComplex*     work,
-                                            int                   lwork,
-                                            int*                  devInfo,
-                                            hipsolverGesvdjInfo_t params,
-                                            int                   batch_count)
+hipsolverStatus_t hipsolverCpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-
-    rocblas_device_malloc   mem((rocblas_handle)handle);
-    double*                 E;
-    rocblas_double_complex* V_copy;
-
-    const rocblas_double_complex one         = {1.0, 0.0};
-    const rocblas_double_complex zero        = {0.0, 0.0};
-    int                          ldv_copy    = 1;
-    size_t                       size_V_copy = 0;
-    if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    if(work && lwork)
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
+    else
     {
-        if(ldv < n || !V)
-            return HIPSOLVER_STATUS_INVALID_VALUE;
-        ldv_copy    = n;
-        size_V_copy = sizeof(rocblas_double_complex) * ldv_copy * n * batch_count;
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    // prepare workspace
-    if(work && lwork)
-    {
-        E = (double*)work;
-        if(min(m, n) > 0)
-            work = (hipDoubleComplex*)(E + min(m, n) * batch_count);
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        return rocblas2hip_status(
+            hipsolver_potrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_fill(hipsolver_transpose_fill(uplo)),
+                                      n,
+                                      nrhs,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      (rocblas_float_complex*)B,
+                                      ldb));
 
-        V_copy = (rocblas_double_complex*)work;
-        if(min(m, n) > 0 && jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
-            work = (hipDoubleComplex*)(V_copy + ldv_copy * n * batch_count);
+    return rocblas2hip_status(rocsolver_cpotrs((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               nrhs,
+                                               (rocblas_float_complex*)A,
+                                               lda,
+                                               (rocblas_float_complex*)B,
+                                               ldb));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
+hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    }
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDnZgesvdjBatched_bufferSize((rocblas_handle)handle,
-                                                                   jobz,
-                                                                   m,
-                                                                   n,
-                                                                   A,
-                                                                   lda,
-                                                                   S,
-                                                                   U,
-                                                                   ldu,
-                                                                   V,
-                                                                   ldv,
-                                                                   &lwork,
-                                                                   params,
-                                                                   batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-
-        mem = rocblas_device_malloc(
-            (rocblas_handle)handle, sizeof(double) * min(m, n) * batch_count, size_V_copy);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        E      = (double*)mem[0];
-        V_copy = (rocblas_double_complex*)mem[1];
     }
 
-    // perform computation
-    CHECK_ROCBLAS_ERROR(rocsolver_zgesvd_strided_batched((rocblas_handle)handle,
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         hip2rocblas_evect2svect(jobz, 0),
-                                                         m,
-                                                         n,
-                                                         (rocblas_double_complex*)A,
-                                                         lda,
-                                                         lda * n,
-                                                         S,
-                                                         min(m, n),
-                                                         (rocblas_double_complex*)U,
-                                                         ldu,
-                                                         ldu * m,
-                                                         V_copy,
-                                                         ldv_copy,
-                                                         ldv_copy * n,
-                                                         E,
-                                                         min(m, n),
-                                                         rocblas_outofplace,
-                                                         devInfo,
-                                                         batch_count));
-
-    // transpose V
-    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR)
+    if(hipsolver_is_row_major((rocblas_handle)handle))
         return rocblas2hip_status(
-            rocblas_zgeam_strided_batched((rocblas_handle)handle,
-                                          rocblas_operation_conjugate_transpose,
-                                          rocblas_operation_none,
-                                          n,
-                                          ldv_copy,
-                                          &one,
-                                          V_copy,
-                                          ldv_copy,
-                                          ldv_copy * n,
-                                          &zero,
-                                          V_copy,
-                                          ldv_copy,
-                                          ldv_copy * n,
-                                          (rocblas_double_complex*)V,
-                                          ldv,
-                                          ldv * n,
-                                          batch_count));
-    else
-        return HIPSOLVER_STATUS_SUCCESS;
+            hipsolver_potrs_row_major((rocblas_handle)handle,
+                                      hip2rocblas_fill(hipsolver_transpose_fill(uplo)),
+                                      n,
+                                      nrhs,
+                                      (rocblas_double_complex*)A,
+                                      lda,
+                                      (rocblas_double_complex*)B,
+                                      ldb));
+
+    return rocblas2hip_status(rocsolver_zpotrs((rocblas_handle)handle,
+                                               hip2rocblas_fill(uplo),
+                                               n,
+                                               nrhs,
+                                               (rocblas_double_complex*)A,
+                                               lda,
+                                               (rocblas_double_complex*)B,
+                                               ldb));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GETRF ********************/
-hipsolverStatus_t hipsolverSgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+/******************** POTRS_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
@@ -5363,9 +15845,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_sgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_spotrs_batched((rocblas_handle)handle,
+                                                                           hip2rocblas_fill(uplo),
+                                                                           n,
+                                                                           nrhs,
+                                                                           nullptr,
+                                                                           lda,
+                                                                           nullptr,
+                                                                           ldb,
+                                                                           batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -5381,8 +15869,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
@@ -5394,9 +15890,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_dgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dpotrs_batched((rocblas_handle)handle,
+                                                                           hip2rocblas_fill(uplo),
+                                                                           n,
+                                                                           nrhs,
+                                                                           nullptr,
+                                                                           lda,
+                                                                           nullptr,
+                                                                           ldb,
+                                                                           batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -5412,8 +15914,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverCpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    hipFloatComplex*    B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
@@ -5425,9 +15935,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_cgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_cgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cpotrs_batched((rocblas_handle)handle,
+                                                                           hip2rocblas_fill(uplo),
+                                                                           n,
+                                                                           nrhs,
+                                                                           nullptr,
+                                                                           lda,
+                                                                           nullptr,
+                                                                           ldb,
+                                                                           batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -5443,8 +15959,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverZpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    hipDoubleComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
 try
 {
     if(!handle)
@@ -5456,9 +15980,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_zgetrf((rocblas_handle)handle, m, n, nullptr, lda, nullptr, nullptr));
-    rocsolver_zgetrf_npvt((rocblas_handle)handle, m, n, nullptr, lda, nullptr);
+    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zpotrs_batched((rocblas_handle)handle,
+                                                                           hip2rocblas_fill(uplo),
+                                                                           n,
+                                                                           nrhs,
+                                                                           nullptr,
+                                                                           lda,
+                                                                           nullptr,
+                                                                           ldb,
+                                                                           batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -5474,145 +16004,155 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  float*            A,
-                                  int               lda,
-                                  float*            work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverSpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              B[],
+                                         int                 ldb,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrsBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(
-            rocsolver_sgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(
-            rocsolver_sgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+    return rocblas2hip_status(rocsolver_spotrs_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb, batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  double*           A,
-                                  int               lda,
-                                  double*           work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverDpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             B[],
+                                         int                 ldb,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrsBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(
-            rocsolver_dgetrf((rocblas_handle)handle, m, n, A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(
-            rocsolver_dgetrf_npvt((rocblas_handle)handle, m, n, A, lda, devInfo));
+    return rocblas2hip_status(rocsolver_dpotrs_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb, batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipFloatComplex*  A,
-                                  int               lda,
-                                  hipFloatComplex*  work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverCpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    B[],
+                                         int                 ldb,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrsBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(rocsolver_cgetrf(
-            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(rocsolver_cgetrf_npvt(
-            (rocblas_handle)handle, m, n, (rocblas_float_complex*)A, lda, devInfo));
+    return rocblas2hip_status(rocsolver_cpotrs_batched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       (rocblas_float_complex**)B,
+                                                       ldb,
+                                                       batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
-                                  int               m,
-                                  int               n,
-                                  hipDoubleComplex* A,
-                                  int               lda,
-                                  hipDoubleComplex* work,
-                                  int               lwork,
-                                  int*              devIpiv,
-                                  int*              devInfo)
+hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   B[],
+                                         int                 ldb,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZgetrf_bufferSize((rocblas_handle)handle, m, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrsBatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    if(devIpiv != nullptr)
-        return rocblas2hip_status(rocsolver_zgetrf(
-            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devIpiv, devInfo));
-    else
-        return rocblas2hip_status(rocsolver_zgetrf_npvt(
-            (rocblas_handle)handle, m, n, (rocblas_double_complex*)A, lda, devInfo));
+    return rocblas2hip_status(rocsolver_zpotrs_batched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       (rocblas_double_complex**)B,
+                                                       ldb,
+                                                       batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** GETRS ********************/
-hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             float*               A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             float*               B,
-                                             int                  ldb,
-                                             int*                 lwork)
+/******************** POTRS_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        float*              A,
+                                                        int                 lda,
+                                                        float*              B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
 try
 {
     if(!handle)
@@ -5623,17 +16163,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_sgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
-                                                                   n,
-                                                                   nrhs,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrs_interleaved_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -5648,16 +16180,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             double*              A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             double*              B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverDpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        double*             A,
+                                                        int                 lda,
+                                                        double*             B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
 try
 {
     if(!handle)
@@ -5668,17 +16200,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
-                                                                   n,
-                                                                   nrhs,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrs_interleaved_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -5693,16 +16217,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipFloatComplex*     B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverCpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        hipFloatComplex*    A,
+                                                        int                 lda,
+                                                        hipFloatComplex*    B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
 try
 {
     if(!handle)
@@ -5713,17 +16237,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
-                                                                   n,
-                                                                   nrhs,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrs_interleaved_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -5732,22 +16248,22 @@ try
 
     *lwork = (int)sz;
     return status;
-}
-catch(...)
-{
-    return exception2hip_status();
-}
-
-hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipDoubleComplex*    B,
-                                             int                  ldb,
-                                             int*                 lwork)
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        hipDoubleComplex*   A,
+                                                        int                 lda,
+                                                        hipDoubleComplex*   B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
 try
 {
     if(!handle)
@@ -5758,17 +16274,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
-                                                                   hip2rocblas_operation(trans),
-                                                                   n,
-                                                                   nrhs,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_potrs_interleaved_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -5783,147 +16291,169 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  float*               A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  float*               B,
-                                  int                  ldb,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverSpotrsInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              B,
+                                             int                 ldb,
+                                             float*              work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverSgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrsInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_sgetrs(
-        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+    return rocblas2hip_status(hipsolver_potrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          B,
+                                                          ldb,
+                                                          batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  double*              A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  double*              B,
-                                  int                  ldb,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDpotrsInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             B,
+                                             int                 ldb,
+                                             double*             work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrsInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_dgetrs(
-        (rocblas_handle)handle, hip2rocblas_operation(trans), n, nrhs, A, lda, devIpiv, B, ldb));
+    return rocblas2hip_status(hipsolver_potrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          B,
+                                                          ldb,
+                                                          batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipFloatComplex*     B,
-                                  int                  ldb,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCpotrsInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             hipFloatComplex*    work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverCgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrsInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_cgetrs((rocblas_handle)handle,
-                                               hip2rocblas_operation(trans),
-                                               n,
-                                               nrhs,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               devIpiv,
-                                               (rocblas_float_complex*)B,
-                                               ldb));
+    return rocblas2hip_status(hipsolver_potrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          nrhs,
+                                                          (rocblas_float_complex*)A,
+                                                          lda,
+                                                          (rocblas_float_complex*)B,
+                                                          ldb,
+                                                          batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipDoubleComplex*    B,
-                                  int                  ldb,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZpotrsInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             hipDoubleComplex*   work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverZgetrs_bufferSize(
-            (rocblas_handle)handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrsInterleaved_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_zgetrs((rocblas_handle)handle,
-                                               hip2rocblas_operation(trans),
-                                               n,
-                                               nrhs,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               devIpiv,
-                                               (rocblas_double_complex*)B,
-                                               ldb));
+    return rocblas2hip_status(hipsolver_potrs_interleaved((rocblas_handle)handle,
+                                                          hip2rocblas_fill(uplo),
+                                                          n,
+                                                          nrhs,
+                                                          (rocblas_double_complex*)A,
+                                                          lda,
+                                                          (rocblas_double_complex*)B,
+                                                          ldb,
+                                                          batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRF ********************/
-hipsolverStatus_t hipsolverSpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+/******************** POTRS_VBATCHED ********************/
+hipsolverStatus_t hipsolverSpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     float*              A[],
+                                                     const int*          lda,
+                                                     float*              B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
 try
 {
     if(!handle)
@@ -5934,10 +16464,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_potrs_vbatched_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -5952,8 +16481,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     double*             A[],
+                                                     const int*          lda,
+                                                     double*             B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
 try
 {
     if(!handle)
@@ -5964,10 +16501,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_potrs_vbatched_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -5982,12 +16518,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverCpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     hipFloatComplex*    A[],
+                                                     const int*          lda,
+                                                     hipFloatComplex*    B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
 try
 {
     if(!handle)
@@ -5998,10 +16538,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_cpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_potrs_vbatched_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6016,12 +16555,16 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverZpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     hipDoubleComplex*   A[],
+                                                     const int*          lda,
+                                                     hipDoubleComplex*   B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
 try
 {
     if(!handle)
@@ -6032,10 +16575,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_zpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_potrs_vbatched_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, lda, ldb, batch_count, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6050,130 +16592,165 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverSpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          float*              A[],
+                                          const int*          lda,
+                                          float*              B[],
+                                          const int*          ldb,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverSpotrsVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(
-        rocsolver_spotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+    return rocblas2hip_status(hipsolver_potrs_vbatched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       devInfo,
+                                                       batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverDpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          double*             A[],
+                                          const int*          lda,
+                                          double*             B[],
+                                          const int*          ldb,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverDpotrsVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(
-        rocsolver_dpotrf((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+    return rocblas2hip_status(hipsolver_potrs_vbatched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       lda,
+                                                       B,
+                                                       ldb,
+                                                       devInfo,
+                                                       batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverCpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          hipFloatComplex*    A[],
+                                          const int*          lda,
+                                          hipFloatComplex*    B[],
+                                          const int*          ldb,
+                                          hipFloatComplex*    work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverCpotrsVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_cpotrf((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_potrs_vbatched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       (rocblas_float_complex**)B,
+                                                       ldb,
+                                                       devInfo,
+                                                       batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverZpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          hipDoubleComplex*   A[],
+                                          const int*          lda,
+                                          hipDoubleComplex*   B[],
+                                          const int*          ldb,
+                                          hipDoubleComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZpotrf_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverZpotrsVbatched_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_zpotrf((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_potrs_vbatched((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       (rocblas_double_complex**)B,
+                                                       ldb,
+                                                       devInfo,
+                                                       batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
-}
-
-/******************** POTRF_BATCHED ********************/
-hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+}
+
+/******************** PPTRF ********************/
+hipsolverStatus_t hipsolverSpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, int* lwork)
 try
 {
     if(!handle)
@@ -6184,10 +16761,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_spotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pptrf_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6202,13 +16778,8 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, int* lwork)
 try
 {
     if(!handle)
@@ -6219,10 +16790,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pptrf_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6237,13 +16807,8 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipFloatComplex*    A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverCpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipFloatComplex* AP, int* lwork)
 try
 {
     if(!handle)
@@ -6254,10 +16819,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pptrf_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6272,13 +16836,8 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipDoubleComplex*   A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverZpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipDoubleComplex* AP, int* lwork)
 try
 {
     if(!handle)
@@ -6289,10 +16848,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr, batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_pptrf_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6307,131 +16865,129 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A[],
-                                         int                 lda,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverSpptrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              AP,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverSpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverSpptrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, AP, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_spotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+    return rocblas2hip_status(hipsolver_pptrf_strided_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, AP, 0, devInfo, 1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A[],
-                                         int                 lda,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDpptrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             AP,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverDpptrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, AP, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_dpotrf_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo, batch_count));
+    return rocblas2hip_status(hipsolver_pptrf_strided_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, AP, 0, devInfo, 1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipFloatComplex*    A[],
-                                         int                 lda,
-                                         hipFloatComplex*    work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverCpptrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    AP,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverCpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverCpptrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, AP, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_cpotrf_batched((rocblas_handle)handle,
-                                                       hip2rocblas_fill(uplo),
-                                                       n,
-                                                       (rocblas_float_complex**)A,
-                                                       lda,
-                                                       devInfo,
-                                                       batch_count));
+    return rocblas2hip_status(hipsolver_pptrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              (rocblas_float_complex*)AP,
+                                                              0,
+                                                              devInfo,
+                                                              1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipDoubleComplex*   A[],
-                                         int                 lda,
-                                         hipDoubleComplex*   work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverZpptrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   AP,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
     if(work && lwork)
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverZpotrfBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, A, lda, &lwork, batch_count));
+        CHECK_HIPSOLVER_ERROR(hipsolverZpptrf_bufferSize(
+            (rocblas_handle)handle, uplo, n, AP, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_zpotrf_batched((rocblas_handle)handle,
-                                                       hip2rocblas_fill(uplo),
-                                                       n,
-                                                       (rocblas_double_complex**)A,
-                                                       lda,
-                                                       devInfo,
-                                                       batch_count));
+    return rocblas2hip_status(hipsolver_pptrf_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              (rocblas_double_complex*)AP,
+                                                              0,
+                                                              devInfo,
+                                                              1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRI ********************/
-hipsolverStatus_t hipsolverSpotri_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+/******************** PPTRS ********************/
+hipsolverStatus_t hipsolverSpptrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              AP,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
 try
 {
     if(!handle)
@@ -6442,10 +16998,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_spotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_pptrs_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6460,8 +17015,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotri_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDpptrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             AP,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
 try
 {
     if(!handle)
@@ -6472,10 +17033,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_dpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_pptrs_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6490,11 +17050,13 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotri_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverCpptrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
+                                             int                 nrhs,
+                                             hipFloatComplex*    AP,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
@@ -6506,10 +17068,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_cpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_pptrs_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6524,11 +17085,13 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotri_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZpptrs_bufferSize(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   AP,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
                                              int*                lwork)
 try
 {
@@ -6540,10 +17103,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status = rocblas2hip_status(
-        rocsolver_zpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nullptr, lda, nullptr));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+        hipsolver_pptrs_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, 1, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6558,11 +17120,13 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverSpptrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  float*              A,
-                                  int                 lda,
+                                  int                 nrhs,
+                                  float*              AP,
+                                  float*              B,
+                                  int                 ldb,
                                   float*              work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6572,24 +17136,26 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverSpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverSpptrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, AP, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(
-        rocsolver_spotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+    return rocblas2hip_status(hipsolver_pptrs_strided_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, AP, 0, B, ldb, 0, devInfo, 1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDpptrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  double*             A,
-                                  int                 lda,
+                                  int                 nrhs,
+                                  double*             AP,
+                                  double*             B,
+                                  int                 ldb,
                                   double*             work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6599,24 +17165,26 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverDpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverDpptrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, AP, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(
-        rocsolver_dpotri((rocblas_handle)handle, hip2rocblas_fill(uplo), n, A, lda, devInfo));
+    return rocblas2hip_status(hipsolver_pptrs_strided_batched(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, AP, 0, B, ldb, 0, devInfo, 1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverCpptrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
+                                  int                 nrhs,
+                                  hipFloatComplex*    AP,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
                                   hipFloatComplex*    work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6626,28 +17194,35 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverCpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverCpptrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, AP, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_cpotri((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_pptrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)AP,
+                                                              0,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb,
+                                                              0,
+                                                              devInfo,
+                                                              1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZpptrs(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   AP,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
                                   hipDoubleComplex*   work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6657,32 +17232,37 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(
-            hipsolverZpotri_bufferSize((rocblas_handle)handle, uplo, n, A, lda, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverZpptrs_bufferSize(
+            (rocblas_handle)handle, uplo, n, nrhs, AP, B, ldb, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_zpotri((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_pptrs_strided_batched((rocblas_handle)handle,
+                                                              hip2rocblas_fill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)AP,
+                                                              0,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb,
+                                                              0,
+                                                              devInfo,
+                                                              1));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRS ********************/
-hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
+/******************** SPEVD/HPEVD ********************/
+hipsolverStatus_t hipsolverSspevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             int                 nrhs,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              B,
-                                             int                 ldb,
+                                             float*              AP,
+                                             float*              D,
+                                             float*              Z,
+                                             int                 ldz,
                                              int*                lwork)
 try
 {
@@ -6694,10 +17274,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_spotrs(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_spevd_bufferSize<float>(
+            (rocblas_handle)handle, hip2rocblas_evect(jobz), hip2rocblas_fill(uplo), n, ldz, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6712,14 +17291,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrs_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDspevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             int                 nrhs,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             B,
-                                             int                 ldb,
+                                             double*             AP,
+                                             double*             D,
+                                             double*             Z,
+                                             int                 ldz,
                                              int*                lwork)
 try
 {
@@ -6731,10 +17310,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dpotrs(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_spevd_bufferSize<double>(
+            (rocblas_handle)handle, hip2rocblas_evect(jobz), hip2rocblas_fill(uplo), n, ldz, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6749,14 +17327,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrs_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverChpevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             int                 nrhs,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    B,
-                                             int                 ldb,
+                                             hipFloatComplex*    AP,
+                                             float*              D,
+                                             hipFloatComplex*    Z,
+                                             int                 ldz,
                                              int*                lwork)
 try
 {
@@ -6768,10 +17346,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cpotrs(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_spevd_bufferSize<rocblas_float_complex>(
+            (rocblas_handle)handle, hip2rocblas_evect(jobz), hip2rocblas_fill(uplo), n, ldz, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6786,14 +17363,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrs_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZhpevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             int                 nrhs,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   B,
-                                             int                 ldb,
+                                             hipDoubleComplex*   AP,
+                                             double*             D,
+                                             hipDoubleComplex*   Z,
+                                             int                 ldz,
                                              int*                lwork)
 try
 {
@@ -6805,10 +17382,9 @@ try
     *lwork = 0;
     size_t sz;
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zpotrs(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, nullptr, lda, nullptr, ldb));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    hipsolverStatus_t status = rocblas2hip_status(
+        hipsolver_spevd_bufferSize<rocblas_double_complex>(
+            (rocblas_handle)handle, hip2rocblas_evect(jobz), hip2rocblas_fill(uplo), n, ldz, &sz));
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
         return status;
@@ -6823,14 +17399,14 @@ catch(...)
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrs(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverSspevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  int                 nrhs,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              B,
-                                  int                 ldb,
+                                  float*              AP,
+                                  float*              D,
+                                  float*              Z,
+                                  int                 ldz,
                                   float*              work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6840,27 +17416,34 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverSpotrs_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverSspevd_bufferSize(
+            (rocblas_handle)handle, jobz, uplo, n, AP, D, Z, ldz, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(
-        rocsolver_spotrs((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb));
+    return rocblas2hip_status(hipsolver_spevd_template((rocblas_handle)handle,
+                                                       hip2rocblas_evect(jobz),
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       AP,
+                                                       D,
+                                                       Z,
+                                                       ldz,
+                                                       devInfo));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrs(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDspevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  int                 nrhs,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             B,
-                                  int                 ldb,
+                                  double*             AP,
+                                  double*             D,
+                                  double*             Z,
+                                  int                 ldz,
                                   double*             work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6870,27 +17453,34 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverDpotrs_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverDspevd_bufferSize(
+            (rocblas_handle)handle, jobz, uplo, n, AP, D, Z, ldz, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(
-        rocsolver_dpotrs((rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb));
+    return rocblas2hip_status(hipsolver_spevd_template((rocblas_handle)handle,
+                                                       hip2rocblas_evect(jobz),
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       AP,
+                                                       D,
+                                                       Z,
+                                                       ldz,
+                                                       devInfo));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrs(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverChpevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  int                 nrhs,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    B,
-                                  int                 ldb,
+                                  hipFloatComplex*    AP,
+                                  float*              D,
+                                  hipFloatComplex*    Z,
+                                  int                 ldz,
                                   hipFloatComplex*    work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6900,33 +17490,34 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverCpotrs_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverChpevd_bufferSize(
+            (rocblas_handle)handle, jobz, uplo, n, AP, D, Z, ldz, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_cpotrs((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               nrhs,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               (rocblas_float_complex*)B,
-                                               ldb));
+    return rocblas2hip_status(hipsolver_spevd_template((rocblas_handle)handle,
+                                                       hip2rocblas_evect(jobz),
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       (rocblas_float_complex*)AP,
+                                                       D,
+                                                       (rocblas_float_complex*)Z,
+                                                       ldz,
+                                                       devInfo));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZhpevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  int                 nrhs,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   B,
-                                  int                 ldb,
+                                  hipDoubleComplex*   AP,
+                                  double*             D,
+                                  hipDoubleComplex*   Z,
+                                  int                 ldz,
                                   hipDoubleComplex*   work,
                                   int                 lwork,
                                   int*                devInfo)
@@ -6936,338 +17527,364 @@ try
         CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
     else
     {
-        CHECK_HIPSOLVER_ERROR(hipsolverZpotrs_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork));
+        CHECK_HIPSOLVER_ERROR(hipsolverZhpevd_bufferSize(
+            (rocblas_handle)handle, jobz, uplo, n, AP, D, Z, ldz, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
     }
 
-    return rocblas2hip_status(rocsolver_zpotrs((rocblas_handle)handle,
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               nrhs,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               (rocblas_double_complex*)B,
-                                               ldb));
+    return rocblas2hip_status(hipsolver_spevd_template((rocblas_handle)handle,
+                                                       hip2rocblas_evect(jobz),
+                                                       hip2rocblas_fill(uplo),
+                                                       n,
+                                                       (rocblas_double_complex*)AP,
+                                                       D,
+                                                       (rocblas_double_complex*)Z,
+                                                       ldz,
+                                                       devInfo));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRS_BATCHED ********************/
-hipsolverStatus_t hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    float*              B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+/******************** TRTTP ********************/
+hipsolverStatus_t hipsolverStrttp(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, float* AP)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_spotrs_batched((rocblas_handle)handle,
-                                                                           hip2rocblas_fill(uplo),
-                                                                           n,
-                                                                           nrhs,
-                                                                           nullptr,
-                                                                           lda,
-                                                                           nullptr,
-                                                                           ldb,
-                                                                           batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    return rocblas2hip_status(hipsolver_trttp_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), true, n, A, lda, AP));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    double*             B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDtrttp(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, double* AP)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dpotrs_batched((rocblas_handle)handle,
-                                                                           hip2rocblas_fill(uplo),
-                                                                           n,
-                                                                           nrhs,
-                                                                           nullptr,
-                                                                           lda,
-                                                                           nullptr,
-                                                                           ldb,
-                                                                           batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+    return rocblas2hip_status(hipsolver_trttp_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), true, n, A, lda, AP));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+hipsolverStatus_t hipsolverCtrttp(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    AP)
+try
+{
+    return rocblas2hip_status(hipsolver_trttp_template((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       true,
+                                                       n,
+                                                       (rocblas_float_complex*)A,
+                                                       lda,
+                                                       (rocblas_float_complex*)AP));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    *lwork = (int)sz;
-    return status;
+hipsolverStatus_t hipsolverZtrttp(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   AP)
+try
+{
+    return rocblas2hip_status(hipsolver_trttp_template((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       true,
+                                                       n,
+                                                       (rocblas_double_complex*)A,
+                                                       lda,
+                                                       (rocblas_double_complex*)AP));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipFloatComplex*    A[],
-                                                    int                 lda,
-                                                    hipFloatComplex*    B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+/******************** TPTTR ********************/
+hipsolverStatus_t hipsolverStpttr(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, float* A, int lda)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return rocblas2hip_status(hipsolver_trttp_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), false, n, A, lda, AP));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    *lwork = 0;
-    size_t sz;
+hipsolverStatus_t hipsolverDtpttr(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, double* A, int lda)
+try
+{
+    return rocblas2hip_status(hipsolver_trttp_template(
+        (rocblas_handle)handle, hip2rocblas_fill(uplo), false, n, A, lda, AP));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cpotrs_batched((rocblas_handle)handle,
-                                                                           hip2rocblas_fill(uplo),
-                                                                           n,
-                                                                           nrhs,
-                                                                           nullptr,
-                                                                           lda,
-                                                                           nullptr,
-                                                                           ldb,
-                                                                           batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
+hipsolverStatus_t hipsolverCtpttr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    AP,
+                                  hipFloatComplex*    A,
+                                  int                 lda)
+try
+{
+    return rocblas2hip_status(hipsolver_trttp_template((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       false,
+                                                       n,
+                                                       (rocblas_float_complex*)A,
+                                                       lda,
+                                                       (rocblas_float_complex*)AP));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+hipsolverStatus_t hipsolverZtpttr(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   AP,
+                                  hipDoubleComplex*   A,
+                                  int                 lda)
+try
+{
+    return rocblas2hip_status(hipsolver_trttp_template((rocblas_handle)handle,
+                                                       hip2rocblas_fill(uplo),
+                                                       false,
+                                                       n,
+                                                       (rocblas_double_complex*)A,
+                                                       lda,
+                                                       (rocblas_double_complex*)AP));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    *lwork = (int)sz;
-    return status;
+/******************** INTERLEAVED_TO_STRIDED ********************/
+hipsolverStatus_t hipsolverSinterleavedToStrided(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const float*      A,
+                                                 int               lda,
+                                                 float*            B,
+                                                 int               ldb,
+                                                 int               strideB,
+                                                 int               batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_interleaved_to_strided((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               strideB,
+                                                               batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipDoubleComplex*   A[],
-                                                    int                 lda,
-                                                    hipDoubleComplex*   B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDinterleavedToStrided(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const double*     A,
+                                                 int               lda,
+                                                 double*           B,
+                                                 int               ldb,
+                                                 int               strideB,
+                                                 int               batch_count)
 try
 {
-    if(!handle)
-        return HIPSOLVER_STATUS_NOT_INITIALIZED;
-    if(lwork == nullptr)
-        return HIPSOLVER_STATUS_INVALID_VALUE;
-
-    *lwork = 0;
-    size_t sz;
-
-    rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zpotrs_batched((rocblas_handle)handle,
-                                                                           hip2rocblas_fill(uplo),
-                                                                           n,
-                                                                           nrhs,
-                                                                           nullptr,
-                                                                           lda,
-                                                                           nullptr,
-                                                                           ldb,
-                                                                           batch_count));
-    rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
-
-    if(status != HIPSOLVER_STATUS_SUCCESS)
-        return status;
-    if(sz > INT_MAX)
-        return HIPSOLVER_STATUS_INTERNAL_ERROR;
-
-    *lwork = (int)sz;
-    return status;
+    return rocblas2hip_status(hipsolver_interleaved_to_strided((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               B,
+                                                               ldb,
+                                                               strideB,
+                                                               batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         float*              A[],
-                                         int                 lda,
-                                         float*              B[],
-                                         int                 ldb,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverCinterleavedToStrided(hipsolverHandle_t      handle,
+                                                 int                    m,
+                                                 int                    n,
+                                                 const hipFloatComplex* A,
+                                                 int                    lda,
+                                                 hipFloatComplex*       B,
+                                                 int                    ldb,
+                                                 int                    strideB,
+                                                 int                    batch_count)
 try
 {
-    if(work && lwork)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverSpotrsBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
-
-    return rocblas2hip_status(rocsolver_spotrs_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb, batch_count));
+    return rocblas2hip_status(hipsolver_interleaved_to_strided((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               (const rocblas_float_complex*)A,
+                                                               lda,
+                                                               (rocblas_float_complex*)B,
+                                                               ldb,
+                                                               strideB,
+                                                               batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         double*             A[],
-                                         int                 lda,
-                                         double*             B[],
-                                         int                 ldb,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverZinterleavedToStrided(hipsolverHandle_t       handle,
+                                                 int                     m,
+                                                 int                     n,
+                                                 const hipDoubleComplex* A,
+                                                 int                     lda,
+                                                 hipDoubleComplex*       B,
+                                                 int                     ldb,
+                                                 int                     strideB,
+                                                 int                     batch_count)
 try
 {
-    if(work && lwork)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverDpotrsBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
-
-    return rocblas2hip_status(rocsolver_dpotrs_batched(
-        (rocblas_handle)handle, hip2rocblas_fill(uplo), n, nrhs, A, lda, B, ldb, batch_count));
+    return rocblas2hip_status(hipsolver_interleaved_to_strided((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               (const rocblas_double_complex*)A,
+                                                               lda,
+                                                               (rocblas_double_complex*)B,
+                                                               ldb,
+                                                               strideB,
+                                                               batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipFloatComplex*    A[],
-                                         int                 lda,
-                                         hipFloatComplex*    B[],
-                                         int                 ldb,
-                                         hipFloatComplex*    work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+/******************** STRIDED_TO_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSstridedToInterleaved(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const float*      A,
+                                                 int               lda,
+                                                 int               strideA,
+                                                 float*            B,
+                                                 int               ldb,
+                                                 int               batch_count)
 try
 {
-    if(work && lwork)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverCpotrsBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    return rocblas2hip_status(hipsolver_strided_to_interleaved((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               B,
+                                                               ldb,
+                                                               batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    return rocblas2hip_status(rocsolver_cpotrs_batched((rocblas_handle)handle,
-                                                       hip2rocblas_fill(uplo),
-                                                       n,
-                                                       nrhs,
-                                                       (rocblas_float_complex**)A,
-                                                       lda,
-                                                       (rocblas_float_complex**)B,
-                                                       ldb,
-                                                       batch_count));
+hipsolverStatus_t hipsolverDstridedToInterleaved(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const double*     A,
+                                                 int               lda,
+                                                 int               strideA,
+                                                 double*           B,
+                                                 int               ldb,
+                                                 int               batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_strided_to_interleaved((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               B,
+                                                               ldb,
+                                                               batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipDoubleComplex*   A[],
-                                         int                 lda,
-                                         hipDoubleComplex*   B[],
-                                         int                 ldb,
-                                         hipDoubleComplex*   work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverCstridedToInterleaved(hipsolverHandle_t      handle,
+                                                 int                    m,
+                                                 int                    n,
+                                                 const hipFloatComplex* A,
+                                                 int                    lda,
+                                                 int                    strideA,
+                                                 hipFloatComplex*       B,
+                                                 int                    ldb,
+                                                 int                    batch_count)
 try
 {
-    if(work && lwork)
-        CHECK_ROCBLAS_ERROR(rocblas_set_workspace((rocblas_handle)handle, work, lwork));
-    else
-    {
-        CHECK_HIPSOLVER_ERROR(hipsolverZpotrsBatched_bufferSize(
-            (rocblas_handle)handle, uplo, n, nrhs, A, lda, B, ldb, &lwork, batch_count));
-        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
-    }
+    return rocblas2hip_status(hipsolver_strided_to_interleaved((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               (const rocblas_float_complex*)A,
+                                                               lda,
+                                                               strideA,
+                                                               (rocblas_float_complex*)B,
+                                                               ldb,
+                                                               batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
 
-    return rocblas2hip_status(rocsolver_zpotrs_batched((rocblas_handle)handle,
-                                                       hip2rocblas_fill(uplo),
-                                                       n,
-                                                       nrhs,
-                                                       (rocblas_double_complex**)A,
-                                                       lda,
-                                                       (rocblas_double_complex**)B,
-                                                       ldb,
-                                                       batch_count));
+hipsolverStatus_t hipsolverZstridedToInterleaved(hipsolverHandle_t       handle,
+                                                 int                     m,
+                                                 int                     n,
+                                                 const hipDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     strideA,
+                                                 hipDoubleComplex*       B,
+                                                 int                     ldb,
+                                                 int                     batch_count)
+try
+{
+    return rocblas2hip_status(hipsolver_strided_to_interleaved((rocblas_handle)handle,
+                                                               m,
+                                                               n,
+                                                               (const rocblas_double_complex*)A,
+                                                               lda,
+                                                               strideA,
+                                                               (rocblas_double_complex*)B,
+                                                               ldb,
+                                                               batch_count));
 }
 catch(...)
 {
@@ -7293,24 +17910,32 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_ssyevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
     size_t size_E = n > 0 ? sizeof(float) * n : 0;
 
+    // space for the transpose of the eigenvectors
+    size_t size_V = 0;
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR && hipsolver_is_row_major((rocblas_handle)handle))
+        size_V = hipsolver_syevd_row_major_size<float>(n);
+
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -7344,24 +17969,32 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_dsyevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
     size_t size_E = n > 0 ? sizeof(double) * n : 0;
 
+    // space for the transpose of the eigenvectors
+    size_t size_V = 0;
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR && hipsolver_is_row_major((rocblas_handle)handle))
+        size_V = hipsolver_syevd_row_major_size<double>(n);
+
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -7395,24 +18028,32 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_cheevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
     size_t size_E = n > 0 ? sizeof(float) * n : 0;
 
+    // space for the transpose of the eigenvectors
+    size_t size_V = 0;
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR && hipsolver_is_row_major((rocblas_handle)handle))
+        size_V = hipsolver_syevd_row_major_size<rocblas_float_complex>(n);
+
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -7446,24 +18087,32 @@ try
     *lwork = 0;
     size_t sz;
 
+    if(hipsolver_is_row_major((rocblas_handle)handle))
+        uplo = hipsolver_transpose_fill(uplo);
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_zheevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
     size_t size_E = n > 0 ? sizeof(double) * n : 0;
 
+    // space for the transpose of the eigenvectors
+    size_t size_V = 0;
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR && hipsolver_is_row_major((rocblas_handle)handle))
+        size_V = hipsolver_syevd_row_major_size<rocblas_double_complex>(n);
+
     // update size
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, sz, size_E, size_V);
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     if(status != HIPSOLVER_STATUS_SUCCESS)
@@ -7514,15 +18163,24 @@ try
         E = (float*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+    bool row_major = hipsolver_is_row_major((rocblas_handle)handle);
+    if(row_major)
+        uplo = hipsolver_transpose_fill(uplo);
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_ssyevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        A,
+                                                                        lda,
+                                                                        D,
+                                                                        E,
+                                                                        devInfo));
+
+    if(status == HIPSOLVER_STATUS_SUCCESS && row_major && jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        status = rocblas2hip_status(
+            hipsolver_syevd_row_major_vectors((rocblas_handle)handle, n, A, lda));
+    return status;
 }
 catch(...)
 {
@@ -7564,15 +18222,24 @@ try
         E = (double*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+    bool row_major = hipsolver_is_row_major((rocblas_handle)handle);
+    if(row_major)
+        uplo = hipsolver_transpose_fill(uplo);
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_dsyevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        A,
+                                                                        lda,
+                                                                        D,
+                                                                        E,
+                                                                        devInfo));
+
+    if(status == HIPSOLVER_STATUS_SUCCESS && row_major && jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        status = rocblas2hip_status(
+            hipsolver_syevd_row_major_vectors((rocblas_handle)handle, n, A, lda));
+    return status;
 }
 catch(...)
 {
@@ -7608,21 +18275,30 @@ try
             hipsolverCheevd_bufferSize((rocblas_handle)handle, jobz, uplo, n, A, lda, D, &lwork));
         CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lwork));
 
-        mem = rocblas_device_malloc((rocblas_handle)handle, sizeof(float) * n);
-        if(!mem)
-            return HIPSOLVER_STATUS_ALLOC_FAILED;
-        E = (float*)mem[0];
-    }
-
-    return rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+        mem = rocblas_device_malloc((rocblas_handle)handle, sizeof(float) * n);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E = (float*)mem[0];
+    }
+
+    bool row_major = hipsolver_is_row_major((rocblas_handle)handle);
+    if(row_major)
+        uplo = hipsolver_transpose_fill(uplo);
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_cheevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        (rocblas_float_complex*)A,
+                                                                        lda,
+                                                                        D,
+                                                                        E,
+                                                                        devInfo));
+
+    if(status == HIPSOLVER_STATUS_SUCCESS && row_major && jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        status = rocblas2hip_status(hipsolver_syevd_row_major_vectors(
+            (rocblas_handle)handle, n, (rocblas_float_complex*)A, lda));
+    return status;
 }
 catch(...)
 {
@@ -7664,15 +18340,24 @@ try
         E = (double*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+    bool row_major = hipsolver_is_row_major((rocblas_handle)handle);
+    if(row_major)
+        uplo = hipsolver_transpose_fill(uplo);
+
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_zheevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        (rocblas_double_complex*)A,
+                                                                        lda,
+                                                                        D,
+                                                                        E,
+                                                                        devInfo));
+
+    if(status == HIPSOLVER_STATUS_SUCCESS && row_major && jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        status = rocblas2hip_status(hipsolver_syevd_row_major_vectors(
+            (rocblas_handle)handle, n, (rocblas_double_complex*)A, lda));
+    return status;
 }
 catch(...)
 {
@@ -7700,15 +18385,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_ssyevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -7752,15 +18437,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_dsyevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -7804,15 +18489,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_cheevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -7856,15 +18541,15 @@ try
     size_t sz;
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
-    hipsolverStatus_t status = rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
-                                                                   hip2rocblas_evect(jobz),
-                                                                   hip2rocblas_fill(uplo),
-                                                                   n,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   nullptr,
-                                                                   nullptr,
-                                                                   nullptr));
+    hipsolverStatus_t status = rocblas2hip_status(hipsolver_auto_zheevd((rocblas_handle)handle,
+                                                                        hip2rocblas_evect(jobz),
+                                                                        hip2rocblas_fill(uplo),
+                                                                        n,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        nullptr));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -7924,15 +18609,15 @@ try
         E = (float*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_ssyevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_auto_ssyevd((rocblas_handle)handle,
+                                                    hip2rocblas_evect(jobz),
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    D,
+                                                    E,
+                                                    devInfo));
 }
 catch(...)
 {
@@ -7975,15 +18660,15 @@ try
         E = (double*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_dsyevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_auto_dsyevd((rocblas_handle)handle,
+                                                    hip2rocblas_evect(jobz),
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    D,
+                                                    E,
+                                                    devInfo));
 }
 catch(...)
 {
@@ -8026,15 +18711,15 @@ try
         E = (float*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_cheevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_float_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_auto_cheevd((rocblas_handle)handle,
+                                                    hip2rocblas_evect(jobz),
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    (rocblas_float_complex*)A,
+                                                    lda,
+                                                    D,
+                                                    E,
+                                                    devInfo));
 }
 catch(...)
 {
@@ -8077,15 +18762,15 @@ try
         E = (double*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_zheevd((rocblas_handle)handle,
-                                               hip2rocblas_evect(jobz),
-                                               hip2rocblas_fill(uplo),
-                                               n,
-                                               (rocblas_double_complex*)A,
-                                               lda,
-                                               D,
-                                               E,
-                                               devInfo));
+    return rocblas2hip_status(hipsolver_auto_zheevd((rocblas_handle)handle,
+                                                    hip2rocblas_evect(jobz),
+                                                    hip2rocblas_fill(uplo),
+                                                    n,
+                                                    (rocblas_double_complex*)A,
+                                                    lda,
+                                                    D,
+                                                    E,
+                                                    devInfo));
 }
 catch(...)
 {
@@ -8115,19 +18800,19 @@ try
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_ssyevd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect(jobz),
-                                                              hip2rocblas_fill(uplo),
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_ssyevd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -8173,19 +18858,19 @@ try
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_dsyevd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect(jobz),
-                                                              hip2rocblas_fill(uplo),
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_dsyevd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -8231,19 +18916,19 @@ try
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_cheevd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect(jobz),
-                                                              hip2rocblas_fill(uplo),
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_cheevd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -8289,19 +18974,19 @@ try
 
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status
-        = rocblas2hip_status(rocsolver_zheevd_strided_batched((rocblas_handle)handle,
-                                                              hip2rocblas_evect(jobz),
-                                                              hip2rocblas_fill(uplo),
-                                                              n,
-                                                              nullptr,
-                                                              lda,
-                                                              lda * n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              n,
-                                                              nullptr,
-                                                              batch_count));
+        = rocblas2hip_status(hipsolver_auto_zheevd_strided_batched((rocblas_handle)handle,
+                                                                   hip2rocblas_evect(jobz),
+                                                                   hip2rocblas_fill(uplo),
+                                                                   n,
+                                                                   nullptr,
+                                                                   lda,
+                                                                   lda * n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   n,
+                                                                   nullptr,
+                                                                   batch_count));
     rocblas_stop_device_memory_size_query((rocblas_handle)handle, &sz);
 
     // space for E array
@@ -8362,19 +19047,19 @@ try
         E = (float*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_ssyevd_strided_batched((rocblas_handle)handle,
-                                                               hip2rocblas_evect(jobz),
-                                                               hip2rocblas_fill(uplo),
-                                                               n,
-                                                               A,
-                                                               lda,
-                                                               lda * n,
-                                                               D,
-                                                               n,
-                                                               E,
-                                                               n,
-                                                               devInfo,
-                                                               batch_count));
+    return rocblas2hip_status(hipsolver_auto_ssyevd_strided_batched((rocblas_handle)handle,
+                                                                    hip2rocblas_evect(jobz),
+                                                                    hip2rocblas_fill(uplo),
+                                                                    n,
+                                                                    A,
+                                                                    lda,
+                                                                    lda * n,
+                                                                    D,
+                                                                    n,
+                                                                    E,
+                                                                    n,
+                                                                    devInfo,
+                                                                    batch_count));
 }
 catch(...)
 {
@@ -8418,19 +19103,19 @@ try
         E = (double*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_dsyevd_strided_batched((rocblas_handle)handle,
-                                                               hip2rocblas_evect(jobz),
-                                                               hip2rocblas_fill(uplo),
-                                                               n,
-                                                               A,
-                                                               lda,
-                                                               lda * n,
-                                                               D,
-                                                               n,
-                                                               E,
-                                                               n,
-                                                               devInfo,
-                                                               batch_count));
+    return rocblas2hip_status(hipsolver_auto_dsyevd_strided_batched((rocblas_handle)handle,
+                                                                    hip2rocblas_evect(jobz),
+                                                                    hip2rocblas_fill(uplo),
+                                                                    n,
+                                                                    A,
+                                                                    lda,
+                                                                    lda * n,
+                                                                    D,
+                                                                    n,
+                                                                    E,
+                                                                    n,
+                                                                    devInfo,
+                                                                    batch_count));
 }
 catch(...)
 {
@@ -8474,19 +19159,19 @@ try
         E = (float*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_cheevd_strided_batched((rocblas_handle)handle,
-                                                               hip2rocblas_evect(jobz),
-                                                               hip2rocblas_fill(uplo),
-                                                               n,
-                                                               (rocblas_float_complex*)A,
-                                                               lda,
-                                                               lda * n,
-                                                               D,
-                                                               n,
-                                                               E,
-                                                               n,
-                                                               devInfo,
-                                                               batch_count));
+    return rocblas2hip_status(hipsolver_auto_cheevd_strided_batched((rocblas_handle)handle,
+                                                                    hip2rocblas_evect(jobz),
+                                                                    hip2rocblas_fill(uplo),
+                                                                    n,
+                                                                    (rocblas_float_complex*)A,
+                                                                    lda,
+                                                                    lda * n,
+                                                                    D,
+                                                                    n,
+                                                                    E,
+                                                                    n,
+                                                                    devInfo,
+                                                                    batch_count));
 }
 catch(...)
 {
@@ -8530,19 +19215,204 @@ try
         E = (double*)mem[0];
     }
 
-    return rocblas2hip_status(rocsolver_zheevd_strided_batched((rocblas_handle)handle,
-                                                               hip2rocblas_evect(jobz),
-                                                               hip2rocblas_fill(uplo),
-                                                               n,
-                                                               (rocblas_double_complex*)A,
-                                                               lda,
-                                                               lda * n,
-                                                               D,
-                                                               n,
-                                                               E,
-                                                               n,
-                                                               devInfo,
-                                                               batch_count));
+    return rocblas2hip_status(hipsolver_auto_zheevd_strided_batched((rocblas_handle)handle,
+                                                                    hip2rocblas_evect(jobz),
+                                                                    hip2rocblas_fill(uplo),
+                                                                    n,
+                                                                    (rocblas_double_complex*)A,
+                                                                    lda,
+                                                                    lda * n,
+                                                                    D,
+                                                                    n,
+                                                                    E,
+                                                                    n,
+                                                                    devInfo,
+                                                                    batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** SYEVJ_PIPELINED/HEEVJ_PIPELINED ********************/
+} // extern C
+
+template <typename T, typename S, typename F>
+static hipsolverStatus_t hipsolver_syevj_pipelined(hipsolverHandle_t    handle,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   T*                   A,
+                                                   int                  lda,
+                                                   S*                   W,
+                                                   int*                 info,
+                                                   hipsolverSyevjInfo_t params,
+                                                   int                  batch_count,
+                                                   int                  chunk_size,
+                                                   F                    syevj_batched)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR && jobz != HIPSOLVER_EIG_MODE_VECTOR)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n < 0 || lda < std::max(n, 1) || batch_count < 0 || chunk_size < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((n && batch_count && (!A || !W)) || (batch_count && !info))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(n == 0 || batch_count == 0)
+    {
+        std::fill(info, info + batch_count, 0);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream((rocblas_handle)handle, &stream));
+
+    // without eigenvectors, A is overwritten and does not need to be downloaded
+    bool                                  vectors = (jobz == HIPSOLVER_EIG_MODE_VECTOR);
+    std::vector<hipsolver_pipeline_array> arrays
+        = {{A, sizeof(T) * lda * n, true, vectors}, {W, sizeof(S) * n, false, true}};
+
+    hipsolver_pipeline pipeline(stream, std::move(arrays), info, batch_count, chunk_size);
+    return pipeline.run([&](const hipsolver_pipeline::chunk& c) {
+        return syevj_batched(handle,
+                             jobz,
+                             uplo,
+                             n,
+                             (T*)c.arrays[0],
+                             lda,
+                             (S*)c.arrays[1],
+                             nullptr,
+                             0,
+                             c.info,
+                             params,
+                             c.count);
+    });
+}
+
+extern "C" {
+
+hipsolverStatus_t hipsolverSsyevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           float*               A,
+                                           int                  lda,
+                                           float*               W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return hipsolver_syevj_pipelined(handle,
+                                     jobz,
+                                     uplo,
+                                     n,
+                                     A,
+                                     lda,
+                                     W,
+                                     info,
+                                     params,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverDnSsyevjBatched);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           double*              A,
+                                           int                  lda,
+                                           double*              W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return hipsolver_syevj_pipelined(handle,
+                                     jobz,
+                                     uplo,
+                                     n,
+                                     A,
+                                     lda,
+                                     W,
+                                     info,
+                                     params,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverDnDsyevjBatched);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           hipFloatComplex*     A,
+                                           int                  lda,
+                                           float*               W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return hipsolver_syevj_pipelined(handle,
+                                     jobz,
+                                     uplo,
+                                     n,
+                                     A,
+                                     lda,
+                                     W,
+                                     info,
+                                     params,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverDnCheevjBatched);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           hipDoubleComplex*    A,
+                                           int                  lda,
+                                           double*              W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return hipsolver_syevj_pipelined(handle,
+                                     jobz,
+                                     uplo,
+                                     n,
+                                     A,
+                                     lda,
+                                     W,
+                                     info,
+                                     params,
+                                     batch_count,
+                                     chunk_size,
+                                     hipsolverDnZheevjBatched);
 }
 catch(...)
 {
@@ -0,0 +1,1141 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Tridiagonal and banded Cholesky solvers on the rocSOLVER side.
+ *
+ *  rocSOLVER has no tridiagonal or band factorizations, so these functions are
+ *  composed from strided_batched rocBLAS and rocSOLVER calls. Each step of the
+ *  algorithms works on all the systems of a batch at once:
+ *
+ *  - gtsv copies the three diagonals into a band workspace and reduces it to
+ *    upper triangular form, either with Gaussian elimination without pivoting
+ *    (one superdiagonal), or with Givens rotations (two superdiagonals), which
+ *    is stable for any non-singular matrix. The rotations are also applied to
+ *    B, and the solution is obtained with tbsv.
+ *
+ *  - pbtrf follows the blocked algorithm of LAPACK xPBTRF. The band matrix is
+ *    addressed as a dense matrix with leading dimension ldab-1, so that the
+ *    diagonal blocks and the off-diagonal blocks within the band can be passed
+ *    directly to potrf, trsm, herk, and gemm.
+ *
+ *  - pbtrs solves with the band factor using two calls to tbsv per right-hand
+ *    side.
+ */
+
+#pragma once
+
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <algorithm>
+
+// Block size of the band Cholesky factorization
+#ifndef HIPSOLVER_PBTRF_BLOCKSIZE
+#define HIPSOLVER_PBTRF_BLOCKSIZE 32
+#endif
+
+/******************** HELPERS ********************/
+// Leading dimension of the band workspace used by gtsv
+inline rocblas_int hipsolver_gtsv_ldw(bool pivot)
+{
+    return pivot ? 4 : 3;
+}
+
+// Block size used by pbtrf for the given bandwidth
+inline rocblas_int hipsolver_pbtrf_blocksize(rocblas_int kd)
+{
+    return std::max(1, std::min(HIPSOLVER_PBTRF_BLOCKSIZE, kd));
+}
+
+// Workspace used by hipsolver_banded_diag_info
+template <typename T>
+inline void hipsolver_banded_diag_info_sizes(rocblas_int n,
+                                             rocblas_int batch_count,
+                                             size_t*     size_D,
+                                             size_t*     size_Y,
+                                             size_t*     size_M,
+                                             size_t*     size_iwork)
+{
+    using S = hipsolver_real_t<T>;
+
+    *size_D     = sizeof(T) * n * batch_count;
+    *size_Y     = sizeof(S) * 2 * n * batch_count;
+    *size_M     = sizeof(S) * 5 * batch_count;
+    *size_iwork = sizeof(rocblas_int) * 4 * batch_count;
+}
+
+// Sets info to the index of the first exactly-zero element of the diagonal of each
+// triangular factor, or to zero if there is none, without leaving the device.
+//
+// With Y = a ./ |diag| for a tiny a, sum(Y) is finite unless the diagonal has a zero,
+// in which case it is inf, and iamin gives the index of the first zero. The choice
+// between that index and zero is made by rocSOLVER's partial pivoting: the 2x2 matrix
+// [s 0; sum(Y) idx], with s above any finite sum, has its second row moved to the top
+// only when sum(Y) is inf. The integers are carried through the row swap as the bit
+// patterns of the real values, which are only ever copied.
+template <typename T>
+rocblas_status hipsolver_banded_diag_info(rocblas_handle       handle,
+                                          rocblas_int          n,
+                                          const T*             diag,
+                                          rocblas_int          inc,
+                                          rocblas_stride       stride,
+                                          rocblas_int*         info,
+                                          rocblas_int          batch_count,
+                                          T*                   D,
+                                          hipsolver_real_t<T>* Y,
+                                          hipsolver_real_t<T>* M,
+                                          rocblas_int*         iwork,
+                                          hipStream_t          stream)
+{
+    using S = hipsolver_real_t<T>;
+
+    // a is about the smallest normal number and s about the largest finite number; in
+    // double precision, the 32-bit fill pattern is repeated in both halves
+    const int         a_bits = sizeof(S) == 4 ? 0x00800000 : 0x00100000;
+    const int         s_bits = sizeof(S) == 4 ? 0x7F000000 : 0x7FE00000;
+    const rocblas_int cpx    = sizeof(T) / sizeof(S);
+    const rocblas_int count  = n * batch_count;
+    const rocblas_int words  = sizeof(S) / sizeof(float);
+    const rocblas_int lda    = 2 * batch_count;
+    S*                K      = M + 4 * batch_count;
+    rocblas_int*      idx    = iwork;
+    rocblas_int*      ipiv   = iwork + batch_count;
+    rocblas_int*      iinfo  = iwork + 3 * batch_count;
+
+    // D = diag in contiguous storage; for complex types, the real part of each element
+    // is replaced with its magnitude up to sign, which is zero only if the element is zero
+    RETURN_IF_ROCBLAS_ERROR(
+        xcopy_strided_batched(handle, n, diag, inc, stride, D, 1, n, batch_count));
+    if(cpx == 2)
+        RETURN_IF_ROCBLAS_ERROR(xrotg_strided_batched(
+            handle, (S*)D, 2, (S*)D + 1, 2, Y, 1, Y + count, 1, count));
+
+    // Y = a ./ |D|
+    RETURN_IF_HIP_ERROR(hipMemsetD32Async((hipDeviceptr_t)Y, a_bits, count * words, stream));
+    RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(handle,
+                                                  rocblas_fill_upper,
+                                                  rocblas_operation_none,
+                                                  rocblas_diagonal_non_unit,
+                                                  n,
+                                                  0,
+                                                  (S*)D,
+                                                  cpx,
+                                                  cpx * n,
+                                                  Y,
+                                                  1,
+                                                  n,
+                                                  batch_count));
+
+    {
+        hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_device);
+        RETURN_IF_ROCBLAS_ERROR(xasum_strided_batched(handle, n, Y, 1, n, batch_count, K));
+        RETURN_IF_ROCBLAS_ERROR(
+            xiamin_strided_batched(handle, n, diag, inc, stride, batch_count, idx));
+    }
+
+    // M(:,:,b) = [s 0; K(b) idx(b)], with leading dimension lda and stride 2 between
+    // systems, so that each column of M is contiguous
+    RETURN_IF_HIP_ERROR(hipMemsetD32Async((hipDeviceptr_t)M, s_bits, lda * words, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(M + lda, 0, sizeof(S) * lda, stream));
+    RETURN_IF_ROCBLAS_ERROR(xcopy(handle, batch_count, K, 1, M + 1, 2));
+    RETURN_IF_ROCBLAS_ERROR(
+        xcopy(handle, batch_count, (float*)idx, 1, (float*)(M + lda + 1), 2 * words));
+
+    // info = M(0,1) after pivoting
+    RETURN_IF_ROCBLAS_ERROR(
+        xgetrf_strided_batched(handle, 2, 2, M, lda, 2, ipiv, 2, iinfo, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(
+        xcopy(handle, batch_count, (float*)(M + lda), 2 * words, (float*)info, 1));
+
+    return rocblas_status_success;
+}
+
+/******************** GTSV ********************/
+inline rocblas_status hipsolver_gtsv_argCheck(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              rocblas_int    nrhs,
+                                              const void*    dl,
+                                              const void*    d,
+                                              const void*    du,
+                                              const void*    B,
+                                              rocblas_int    ldb,
+                                              rocblas_int*   info,
+                                              rocblas_int    batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || nrhs < 0 || ldb < n || ldb < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && (!dl || !d || !du)) || (n && nrhs && batch_count && !B)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_gtsv_bufferSize(rocblas_handle handle,
+                                         bool           pivot,
+                                         rocblas_int    n,
+                                         rocblas_int    nrhs,
+                                         rocblas_int    batch_count,
+                                         size_t*        lwork)
+{
+    using S = hipsolver_real_t<T>;
+
+    *lwork = 0;
+    if(n <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    const rocblas_int ldw = hipsolver_gtsv_ldw(pivot);
+    const rocblas_int ldt = 2 * std::max(2, nrhs);
+    size_t            sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    if(pivot)
+    {
+        xrotg_strided_batched(handle,
+                              (T*)nullptr,
+                              ldw,
+                              (T*)nullptr,
+                              ldw,
+                              (hipsolver_real_t<T>*)nullptr,
+                              4,
+                              (T*)nullptr,
+                              4,
+                              batch_count);
+        xgemm_strided_batched(handle,
+                              rocblas_operation_none,
+                              rocblas_operation_none,
+                              2,
+                              std::max(2, nrhs),
+                              2,
+                              (T*)nullptr,
+                              (T*)nullptr,
+                              2,
+                              4,
+                              (T*)nullptr,
+                              ldw - 1,
+                              ldw * n,
+                              (T*)nullptr,
+                              (T*)nullptr,
+                              2,
+                              ldt,
+                              batch_count);
+    }
+    else
+    {
+        xtrsm_strided_batched(handle,
+                              rocblas_side_left,
+                              rocblas_fill_upper,
+                              rocblas_operation_none,
+                              rocblas_diagonal_non_unit,
+                              1,
+                              1,
+                              (T*)nullptr,
+                              (T*)nullptr,
+                              1,
+                              ldw * n,
+                              (T*)nullptr,
+                              1,
+                              ldw * n,
+                              batch_count);
+    }
+    xtbsv_strided_batched(handle,
+                          rocblas_fill_upper,
+                          rocblas_operation_none,
+                          rocblas_diagonal_non_unit,
+                          n,
+                          ldw - 2,
+                          (T*)nullptr,
+                          ldw,
+                          ldw * n,
+                          (T*)nullptr,
+                          1,
+                          n,
+                          batch_count);
+    xasum_strided_batched(handle, n, (S*)nullptr, 1, n, batch_count, (S*)nullptr);
+    xiamin_strided_batched(handle, n, (T*)nullptr, ldw, ldw * n, batch_count, nullptr);
+    xgetrf_strided_batched(
+        handle, 2, 2, (S*)nullptr, 2 * batch_count, 2, nullptr, 2, nullptr, batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the band workspace, the rotations, the rotated rows, and the info helper
+    size_t size_W   = sizeof(T) * ldw * n * batch_count;
+    size_t size_G   = pivot ? sizeof(T) * 4 * batch_count : 0;
+    size_t size_tmp = pivot ? sizeof(T) * ldt * batch_count : 0;
+    size_t size_D, size_Y, size_M, size_iwork;
+    hipsolver_banded_diag_info_sizes<T>(n, batch_count, &size_D, &size_Y, &size_M, &size_iwork);
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(
+        handle, sz, size_W, size_G, size_tmp, size_D, size_Y, size_M, size_iwork);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+// Reduces the band workspace W (leading dimension 3) to upper triangular form with
+// Gaussian elimination, and applies the elimination to B
+template <typename T>
+rocblas_status hipsolver_gtsv_nopivot_template(rocblas_handle handle,
+                                               rocblas_int    n,
+                                               rocblas_int    nrhs,
+                                               T*             W,
+                                               rocblas_stride strideW,
+                                               T*             B,
+                                               rocblas_int    ldb,
+                                               rocblas_stride strideB,
+                                               rocblas_int    batch_count)
+{
+    const rocblas_operation none = rocblas_operation_none;
+    const T                 one  = T(1);
+    const T                 mone = T(-1);
+
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        T* Aii  = W + 1 + 3 * i;
+        T* Ai1i = Aii + 1;
+        T* Aii1 = Aii + 2;
+        T* Ai1  = Aii + 3;
+
+        // l = A(i+1,i) / A(i,i), stored in place of A(i+1,i)
+        RETURN_IF_ROCBLAS_ERROR(xtrsm_strided_batched(handle,
+                                                      rocblas_side_left,
+                                                      rocblas_fill_upper,
+                                                      none,
+                                                      rocblas_diagonal_non_unit,
+                                                      1,
+                                                      1,
+                                                      &one,
+                                                      Aii,
+                                                      1,
+                                                      strideW,
+                                                      Ai1i,
+                                                      1,
+                                                      strideW,
+                                                      batch_count));
+
+        // A(i+1,i+1) -= l * A(i,i+1) and B(i+1,:) -= l * B(i,:)
+        RETURN_IF_ROCBLAS_ERROR(xgemm_strided_batched(handle,
+                                                      none,
+                                                      none,
+                                                      1,
+                                                      1,
+                                                      1,
+                                                      &mone,
+                                                      Ai1i,
+                                                      1,
+                                                      strideW,
+                                                      Aii1,
+                                                      1,
+                                                      strideW,
+                                                      &one,
+                                                      Ai1,
+                                                      1,
+                                                      strideW,
+                                                      batch_count));
+        if(nrhs > 0)
+            RETURN_IF_ROCBLAS_ERROR(xgemm_strided_batched(handle,
+                                                          none,
+                                                          none,
+                                                          1,
+                                                          nrhs,
+                                                          1,
+                                                          &mone,
+                                                          Ai1i,
+                                                          1,
+                                                          strideW,
+                                                          B + i,
+                                                          ldb,
+                                                          strideB,
+                                                          &one,
+                                                          B + i + 1,
+                                                          ldb,
+                                                          strideB,
+                                                          batch_count));
+    }
+
+    return rocblas_status_success;
+}
+
+// Reduces the band workspace W (leading dimension 4) to upper triangular form with
+// Givens rotations, and applies the rotations to B
+template <typename T>
+rocblas_status hipsolver_gtsv_pivot_template(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             rocblas_int    nrhs,
+                                             T*             W,
+                                             rocblas_stride strideW,
+                                             T*             B,
+                                             rocblas_int    ldb,
+                                             rocblas_stride strideB,
+                                             T*             G,
+                                             T*             tmp,
+                                             rocblas_int    ldt,
+                                             rocblas_int    batch_count,
+                                             hipStream_t    stream)
+{
+    using S = hipsolver_real_t<T>;
+
+    const rocblas_operation none = rocblas_operation_none;
+    const rocblas_int       ldv  = 3;
+    const rocblas_stride    incS = 4 * sizeof(T) / sizeof(S);
+    const T                 one  = T(1);
+    const T                 zero = T(0);
+    const S                 mone = S(-1);
+
+    // G = [c s; -conj(s) c] for each system; the imaginary part of c remains zero
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(G, 0, sizeof(T) * 4 * batch_count, stream));
+
+    // A(r,c) = V[r + c*ldv] for the elements within the band
+    T* V = W + 2;
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        T*          Aii = V + i + size_t(i) * ldv;
+        rocblas_int m   = std::min(2, n - 1 - i);
+
+        // annihilate A(i+1,i) against A(i,i)
+        RETURN_IF_ROCBLAS_ERROR(xrotg_strided_batched(
+            handle, Aii, strideW, Aii + 1, strideW, (S*)G, incS, G + 2, 4, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(handle, 1, G, 1, 4, G + 3, 1, 4, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(
+            xcopy_strided_batched(handle, 1, G + 2, 1, 4, G + 1, 1, 4, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(
+            xscal_strided_batched(handle, 1, &mone, (S*)(G + 1), 1, incS, batch_count));
+
+        // apply the rotation to A(i:i+1, i+1:i+m)
+        T* Aij = Aii + ldv;
+        RETURN_IF_ROCBLAS_ERROR(xgemm_strided_batched(handle,
+                                                      none,
+                                                      none,
+                                                      2,
+                                                      m,
+                                                      2,
+                                                      &one,
+                                                      G,
+                                                      2,
+                                                      4,
+                                                      Aij,
+                                                      ldv,
+                                                      strideW,
+                                                      &zero,
+                                                      tmp,
+                                                      2,
+                                                      ldt,
+                                                      batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xgeam_strided_batched(
+            handle, none, none, 2, m, &one, tmp, 2, ldt, &zero, tmp, 2, ldt, Aij, ldv, strideW,
+            batch_count));
+
+        // apply the rotation to B(i:i+1, :)
+        if(nrhs > 0)
+        {
+            RETURN_IF_ROCBLAS_ERROR(xgemm_strided_batched(handle,
+                                                          none,
+                                                          none,
+                                                          2,
+                                                          nrhs,
+                                                          2,
+                                                          &one,
+                                                          G,
+                                                          2,
+                                                          4,
+                                                          B + i,
+                                                          ldb,
+                                                          strideB,
+                                                          &zero,
+                                                          tmp,
+                                                          2,
+                                                          ldt,
+                                                          batch_count));
+            RETURN_IF_ROCBLAS_ERROR(xgeam_strided_batched(handle,
+                                                          none,
+                                                          none,
+                                                          2,
+                                                          nrhs,
+                                                          &one,
+                                                          tmp,
+                                                          2,
+                                                          ldt,
+                                                          &zero,
+                                                          tmp,
+                                                          2,
+                                                          ldt,
+                                                          B + i,
+                                                          ldb,
+                                                          strideB,
+                                                          batch_count));
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_gtsv_strided_batched(rocblas_handle handle,
+                                              bool           pivot,
+                                              rocblas_int    n,
+                                              rocblas_int    nrhs,
+                                              const T*       dl,
+                                              const T*       d,
+                                              const T*       du,
+                                              rocblas_stride strideD,
+                                              T*             B,
+                                              rocblas_int    ldb,
+                                              rocblas_stride strideB,
+                                              rocblas_int*   info,
+                                              rocblas_int    batch_count)
+{
+    using S = hipsolver_real_t<T>;
+
+    rocblas_status st
+        = hipsolver_gtsv_argCheck(handle, n, nrhs, dl, d, du, B, ldb, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(batch_count > 0)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_int    ldw     = hipsolver_gtsv_ldw(pivot);
+    const rocblas_int    ku      = ldw - 2;
+    const rocblas_int    ldt     = 2 * std::max(2, nrhs);
+    const rocblas_stride strideW = ldw * n;
+
+    size_t size_D, size_Y, size_M, size_iwork;
+    hipsolver_banded_diag_info_sizes<T>(n, batch_count, &size_D, &size_Y, &size_M, &size_iwork);
+
+    rocblas_device_malloc mem(handle,
+                              sizeof(T) * strideW * batch_count,
+                              pivot ? sizeof(T) * 4 * batch_count : 0,
+                              pivot ? sizeof(T) * ldt * batch_count : 0,
+                              size_D,
+                              size_Y,
+                              size_M,
+                              size_iwork);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T*           W     = (T*)mem[0];
+    T*           G     = (T*)mem[1];
+    T*           tmp   = (T*)mem[2];
+    T*           D     = (T*)mem[3];
+    S*           Y     = (S*)mem[4];
+    S*           M     = (S*)mem[5];
+    rocblas_int* iwork = (rocblas_int*)mem[6];
+
+    // W = band storage of the matrix, with ku superdiagonals for the factor; dl(0)
+    // and du(n-1) are not referenced
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(W, 0, sizeof(T) * strideW * batch_count, stream));
+    RETURN_IF_ROCBLAS_ERROR(
+        xcopy_strided_batched(handle, n, d, 1, strideD, W + ku, ldw, strideW, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(
+        handle, n - 1, du, 1, strideD, W + ku - 1 + ldw, ldw, strideW, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(
+        handle, n - 1, dl + 1, 1, strideD, W + ku + 1, ldw, strideW, batch_count));
+
+    {
+        hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+        if(pivot)
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_gtsv_pivot_template(handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  W,
+                                                                  strideW,
+                                                                  B,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  G,
+                                                                  tmp,
+                                                                  ldt,
+                                                                  batch_count,
+                                                                  stream));
+        else
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_gtsv_nopivot_template(
+                handle, n, nrhs, W, strideW, B, ldb, strideB, batch_count));
+    }
+
+    // a zero on the diagonal of the factor means the matrix is singular
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_banded_diag_info(
+        handle, n, W + ku, ldw, strideW, info, batch_count, D, Y, M, iwork, stream));
+
+    for(rocblas_int j = 0; j < nrhs; j++)
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(handle,
+                                                      rocblas_fill_upper,
+                                                      rocblas_operation_none,
+                                                      rocblas_diagonal_non_unit,
+                                                      n,
+                                                      ku,
+                                                      W,
+                                                      ldw,
+                                                      strideW,
+                                                      B + size_t(j) * ldb,
+                                                      1,
+                                                      strideB,
+                                                      batch_count));
+
+    return rocblas_status_success;
+}
+
+/******************** PBTRF ********************/
+inline rocblas_status hipsolver_pbtrf_argCheck(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    kd,
+                                               const void*    AB,
+                                               rocblas_int    ldab,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || kd < 0 || ldab < kd + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && !AB) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_pbtrf_bufferSize(rocblas_handle handle,
+                                          rocblas_fill   uplo,
+                                          rocblas_int    n,
+                                          rocblas_int    kd,
+                                          rocblas_int    ldab,
+                                          rocblas_int    batch_count,
+                                          size_t*        lwork)
+{
+    using S = hipsolver_real_t<T>;
+
+    *lwork = 0;
+    if(n <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    const rocblas_int       nb      = hipsolver_pbtrf_blocksize(kd);
+    const rocblas_int       blocks  = (n - 1) / nb + 1;
+    const rocblas_int       ldv     = std::max(ldab - 1, 1);
+    const bool              upper   = (uplo == rocblas_fill_upper);
+    const rocblas_operation ctran   = rocblas_operation_conjugate_transpose;
+    const rocblas_operation none    = rocblas_operation_none;
+    const rocblas_stride    strideA = ldab * n;
+    size_t                  sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xpotrf_strided_batched(handle, uplo, nb, (T*)nullptr, ldv, strideA, nullptr, batch_count);
+    xtrsm_strided_batched(handle,
+                          upper ? rocblas_side_left : rocblas_side_right,
+                          uplo,
+                          ctran,
+                          rocblas_diagonal_non_unit,
+                          nb,
+                          nb,
+                          (T*)nullptr,
+                          (T*)nullptr,
+                          ldv,
+                          strideA,
+                          (T*)nullptr,
+                          nb,
+                          nb * nb,
+                          batch_count);
+    xherk_strided_batched(handle,
+                          uplo,
+                          upper ? ctran : none,
+                          nb,
+                          nb,
+                          (S*)nullptr,
+                          (T*)nullptr,
+                          nb,
+                          nb * nb,
+                          (S*)nullptr,
+                          (T*)nullptr,
+                          ldv,
+                          strideA,
+                          batch_count);
+    xgemm_strided_batched(handle,
+                          upper ? ctran : none,
+                          upper ? none : ctran,
+                          nb,
+                          nb,
+                          nb,
+                          (T*)nullptr,
+                          (T*)nullptr,
+                          ldv,
+                          strideA,
+                          (T*)nullptr,
+                          nb,
+                          nb * nb,
+                          (T*)nullptr,
+                          (T*)nullptr,
+                          ldv,
+                          strideA,
+                          batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the triangular blocks outside the band and the info of each diagonal block
+    size_t size_W    = sizeof(T) * nb * nb * batch_count;
+    size_t size_info = sizeof(rocblas_int) * blocks * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_W, size_info);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_pbtrf_strided_batched(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    kd,
+                                               T*             AB,
+                                               rocblas_int    ldab,
+                                               rocblas_stride strideA,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    using S = hipsolver_real_t<T>;
+
+    rocblas_status st = hipsolver_pbtrf_argCheck(handle, uplo, n, kd, AB, ldab, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(batch_count > 0)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_int       nb      = hipsolver_pbtrf_blocksize(kd);
+    const rocblas_int       blocks  = (n - 1) / nb + 1;
+    const rocblas_int       ldv     = ldab - 1;
+    const rocblas_stride    strideW = nb * nb;
+    const bool              upper   = (uplo == rocblas_fill_upper);
+    const rocblas_operation ctran   = rocblas_operation_conjugate_transpose;
+    const rocblas_operation none    = rocblas_operation_none;
+    const rocblas_diagonal  nonit   = rocblas_diagonal_non_unit;
+    const T                 one     = T(1);
+    const T                 mone    = T(-1);
+    const S                 sone    = S(1);
+    const S                 smone   = S(-1);
+
+    rocblas_device_malloc mem(
+        handle, sizeof(T) * strideW * batch_count, sizeof(rocblas_int) * blocks * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T*           W     = (T*)mem[0];
+    rocblas_int* iinfo = (rocblas_int*)mem[1];
+
+    // A(r,c) = V[r + c*ldv] for the elements within the band
+    T* V = upper ? AB + kd : AB;
+
+    // the triangle of W that is not copied from the band must remain zero
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(W, 0, sizeof(T) * strideW * batch_count, stream));
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    for(rocblas_int i = 0, blk = 0; i < n; i += nb, blk++)
+    {
+        rocblas_int ib  = std::min(nb, n - i);
+        T*          Aii = V + i + size_t(i) * ldv;
+
+        // ldv is zero only for diagonal matrices stored with ldab = 1
+        RETURN_IF_ROCBLAS_ERROR(xpotrf_strided_batched(handle,
+                                                       uplo,
+                                                       ib,
+                                                       Aii,
+                                                       std::max(ldv, 1),
+                                                       strideA,
+                                                       iinfo + blk * batch_count,
+                                                       batch_count));
+        if(kd == 0 || i + ib >= n)
+            continue;
+
+        rocblas_int i2 = std::min(kd - ib, n - i - ib);
+        rocblas_int i3 = std::min(ib, n - i - kd);
+
+        if(upper)
+        {
+            T* A12 = V + i + size_t(i + ib) * ldv;
+            T* A13 = V + i + size_t(i + kd) * ldv;
+            T* A22 = V + i + ib + size_t(i + ib) * ldv;
+            T* A23 = V + i + ib + size_t(i + kd) * ldv;
+            T* A33 = V + i + kd + size_t(i + kd) * ldv;
+
+            if(i2 > 0)
+            {
+                RETURN_IF_ROCBLAS_ERROR(xtrsm_strided_batched(handle,
+                                                              rocblas_side_left,
+                                                              uplo,
+                                                              ctran,
+                                                              nonit,
+                                                              ib,
+                                                              i2,
+                                                              &one,
+                                                              Aii,
+                                                              ldv,
+                                                              strideA,
+                                                              A12,
+                                                              ldv,
+                                                              strideA,
+                                                              batch_count));
+                RETURN_IF_ROCBLAS_ERROR(xherk_strided_batched(handle,
+                                                              uplo,
+                                                              ctran,
+                                                              i2,
+                                                              ib,
+                                                              &smone,
+                                                              A12,
+                                                              ldv,
+                                                              strideA,
+                                                              &sone,
+                                                              A22,
+                                                              ldv,
+                                                              strideA,
+                                                              batch_count));
+            }
+
+            if(i3 > 0)
+            {
+                // W = lower triangle of A13
+                for(rocblas_int jj = 0; jj < i3; jj++)
+                    RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(handle,
+                                                                  ib - jj,
+                                                                  A13 + jj + size_t(jj) * ldv,
+                                                                  1,
+                                                                  strideA,
+                                                                  W + jj + jj * nb,
+                                                                  1,
+                                                                  strideW,
+                                                                  batch_count));
+
+                RETURN_IF_ROCBLAS_ERROR(xtrsm_strided_batched(handle,
+                                                              rocblas_side_left,
+                                                              uplo,
+                                                              ctran,
+                                                              nonit,
+                                                              ib,
+                                                              i3,
+                                                              &one,
+                                                              Aii,
+                                                              ldv,
+                                                              strideA,
+                                                              W,
+                                                              nb,
+                                                              strideW,
+                                                              batch_count));
+                if(i2 > 0)
+                    RETURN_IF_ROCBLAS_ERROR(xgemm_strided_batched(handle,
+                                                                  ctran,
+                                                                  none,
+                                                                  i2,
+                                                                  i3,
+                                                                  ib,
+                                                                  &mone,
+                                                                  A12,
+                                                                  ldv,
+                                                                  strideA,
+                                                                  W,
+                                                                  nb,
+                                                                  strideW,
+                                                                  &one,
+                                                                  A23,
+                                                                  ldv,
+                                                                  strideA,
+                                                                  batch_count));
+                RETURN_IF_ROCBLAS_ERROR(xherk_strided_batched(handle,
+                                                              uplo,
+                                                              ctran,
+                                                              i3,
+                                                              ib,
+                                                              &smone,
+                                                              W,
+                                                              nb,
+                                                              strideW,
+                                                              &sone,
+                                                              A33,
+                                                              ldv,
+                                                              strideA,
+                                                              batch_count));
+
+                // A13 = lower triangle of W
+                for(rocblas_int jj = 0; jj < i3; jj++)
+                    RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(handle,
+                                                                  ib - jj,
+                                                                  W + jj + jj * nb,
+                                                                  1,
+                                                                  strideW,
+                                                                  A13 + jj + size_t(jj) * ldv,
+                                                                  1,
+                                                                  strideA,
+                                                                  batch_count));
+            }
+        }
+        else
+        {
+            T* A21 = V + i + ib + size_t(i) * ldv;
+            T* A31 = V + i + kd + size_t(i) * ldv;
+            T* A22 = V + i + ib + size_t(i + ib) * ldv;
+            T* A32 = V + i + kd + size_t(i + ib) * ldv;
+            T* A33 = V + i + kd + size_t(i + kd) * ldv;
+
+            if(i2 > 0)
+            {
+                RETURN_IF_ROCBLAS_ERROR(xtrsm_strided_batched(handle,
+                                                              rocblas_side_right,
+                                                              uplo,
+                                                              ctran,
+                                                              nonit,
+                                                              i2,
+                                                              ib,
+                                                              &one,
+                                                              Aii,
+                                                              ldv,
+                                                              strideA,
+                                                              A21,
+                                                              ldv,
+                                                              strideA,
+                                                              batch_count));
+                RETURN_IF_ROCBLAS_ERROR(xherk_strided_batched(handle,
+                                                              uplo,
+                                                              none,
+                                                              i2,
+                                                              ib,
+                                                              &smone,
+                                                              A21,
+                                                              ldv,
+                                                              strideA,
+                                                              &sone,
+                                                              A22,
+                                                              ldv,
+                                                              strideA,
+                                                              batch_count));
+            }
+
+            if(i3 > 0)
+            {
+                // W = upper triangle of A31
+                for(rocblas_int jj = 0; jj < ib; jj++)
+                    RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(handle,
+                                                                  std::min(jj + 1, i3),
+                                                                  A31 + size_t(jj) * ldv,
+                                                                  1,
+                                                                  strideA,
+                                                                  W + jj * nb,
+                                                                  1,
+                                                                  strideW,
+                                                                  batch_count));
+
+                RETURN_IF_ROCBLAS_ERROR(xtrsm_strided_batched(handle,
+                                                              rocblas_side_right,
+                                                              uplo,
+                                                              ctran,
+                                                              nonit,
+                                                              i3,
+                                                              ib,
+                                                              &one,
+                                                              Aii,
+                                                              ldv,
+                                                              strideA,
+                                                              W,
+                                                              nb,
+                                                              strideW,
+                                                              batch_count));
+                if(i2 > 0)
+                    RETURN_IF_ROCBLAS_ERROR(xgemm_strided_batched(handle,
+                                                                  none,
+                                                                  ctran,
+                                                                  i3,
+                                                                  i2,
+                                                                  ib,
+                                                                  &mone,
+                                                                  W,
+                                                                  nb,
+                                                                  strideW,
+                                                                  A21,
+                                                                  ldv,
+                                                                  strideA,
+                                                                  &one,
+                                                                  A32,
+                                                                  ldv,
+                                                                  strideA,
+                                                                  batch_count));
+                RETURN_IF_ROCBLAS_ERROR(xherk_strided_batched(handle,
+                                                              uplo,
+                                                              none,
+                                                              i3,
+                                                              ib,
+                                                              &smone,
+                                                              W,
+                                                              nb,
+                                                              strideW,
+                                                              &sone,
+                                                              A33,
+                                                              ldv,
+                                                              strideA,
+                                                              batch_count));
+
+                // A31 = upper triangle of W
+                for(rocblas_int jj = 0; jj < ib; jj++)
+                    RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(handle,
+                                                                  std::min(jj + 1, i3),
+                                                                  W + jj * nb,
+                                                                  1,
+                                                                  strideW,
+                                                                  A31 + size_t(jj) * ldv,
+                                                                  1,
+                                                                  strideA,
+                                                                  batch_count));
+            }
+        }
+    }
+
+    return hipsolver_merge_block_info(stream, nb, blocks, iinfo, info, batch_count);
+}
+
+/******************** PBTRS ********************/
+inline rocblas_status hipsolver_pbtrs_argCheck(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    kd,
+                                               rocblas_int    nrhs,
+                                               const void*    AB,
+                                               rocblas_int    ldab,
+                                               const void*    B,
+                                               rocblas_int    ldb,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || kd < 0 || nrhs < 0 || ldab < kd + 1 || ldb < n || ldb < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && !AB) || (n && nrhs && batch_count && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_pbtrs_bufferSize(rocblas_handle handle,
+                                          rocblas_fill   uplo,
+                                          rocblas_int    n,
+                                          rocblas_int    kd,
+                                          rocblas_int    nrhs,
+                                          rocblas_int    ldab,
+                                          rocblas_int    batch_count,
+                                          size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || nrhs <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xtbsv_strided_batched(handle,
+                          uplo,
+                          rocblas_operation_conjugate_transpose,
+                          rocblas_diagonal_non_unit,
+                          n,
+                          kd,
+                          (T*)nullptr,
+                          ldab,
+                          ldab * n,
+                          (T*)nullptr,
+                          1,
+                          n,
+                          batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_pbtrs_strided_batched(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    kd,
+                                               rocblas_int    nrhs,
+                                               T*             AB,
+                                               rocblas_int    ldab,
+                                               rocblas_stride strideA,
+                                               T*             B,
+                                               rocblas_int    ldb,
+                                               rocblas_stride strideB,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    rocblas_status st = hipsolver_pbtrs_argCheck(
+        handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(batch_count > 0)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // A = U'*U: solve U'*Y = B, then U*X = Y; A = L*L': solve L*Y = B, then L'*X = Y
+    const bool              upper  = (uplo == rocblas_fill_upper);
+    const rocblas_operation first  = upper ? rocblas_operation_conjugate_transpose
+                                           : rocblas_operation_none;
+    const rocblas_operation second = upper ? rocblas_operation_none
+                                           : rocblas_operation_conjugate_transpose;
+
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        T* Bj = B + size_t(j) * ldb;
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(handle,
+                                                      uplo,
+                                                      first,
+                                                      rocblas_diagonal_non_unit,
+                                                      n,
+                                                      kd,
+                                                      AB,
+                                                      ldab,
+                                                      strideA,
+                                                      Bj,
+                                                      1,
+                                                      strideB,
+                                                      batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(handle,
+                                                      uplo,
+                                                      second,
+                                                      rocblas_diagonal_non_unit,
+                                                      n,
+                                                      kd,
+                                                      AB,
+                                                      ldab,
+                                                      strideA,
+                                                      Bj,
+                                                      1,
+                                                      strideB,
+                                                      batch_count));
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Request coalescer used by the coalesced factorizations on the
+ *  rocSOLVER side.
+ *
+ *  Calls of the same function, precision and dimensions submitted through a
+ *  coalescer are collected into a group. The first call of a group waits until
+ *  the group holds max_batch calls, or until the window has elapsed since it
+ *  arrived, and then dispatches the whole group as a single batched call on the
+ *  internal stream of the coalescer. The other calls of the group wait for this
+ *  dispatch, so that every call returns after its work has been enqueued.
+ *
+ *  Stream ordering is preserved with events: the batched call waits for the
+ *  work previously enqueued on the stream of each caller, and the stream of
+ *  each caller waits for the batched call. The info (and pivot indices) of
+ *  each problem are copied to the arrays given by its caller after the batched
+ *  call. A group of a single call is dispatched as the regular function, on
+ *  the handle of its caller.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "rocblas.h"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+// Default maximum number of calls dispatched together
+#ifndef HIPSOLVER_COALESCER_MAX_BATCH
+#define HIPSOLVER_COALESCER_MAX_BATCH 64
+#endif
+
+// Default time, in microseconds, that the first call of a group waits for others
+#ifndef HIPSOLVER_COALESCER_WINDOW
+#define HIPSOLVER_COALESCER_WINDOW 50
+#endif
+
+enum hipsolver_coalesced_function
+{
+    hipsolver_coalesced_potrf,
+    hipsolver_coalesced_getrf,
+    hipsolver_coalesced_getrf_npvt,
+};
+
+// Function, precision, and then the arguments that must match: uplo, m, n and lda
+using hipsolver_coalesced_key = std::tuple<int, int, int, int, int, int>;
+
+// Runs a single call with the handle of its caller
+using hipsolver_coalesced_single = std::function<hipsolverStatus_t()>;
+
+// Runs a batch of calls: (handle, device array of A, info, pivots, batch count)
+using hipsolver_coalesced_batched
+    = std::function<hipsolverStatus_t(rocblas_handle, void**, rocblas_int*, rocblas_int*, int)>;
+
+class hipsolver_coalescer
+{
+    struct request
+    {
+        hipStream_t  stream;
+        hipEvent_t   ready;
+        void*        A;
+        rocblas_int* ipiv;
+        rocblas_int* info;
+    };
+
+    struct group
+    {
+        std::vector<request>                  requests;
+        std::chrono::steady_clock::time_point deadline;
+        bool                                  closed = false;
+        bool                                  done   = false;
+        hipsolverStatus_t                     status = HIPSOLVER_STATUS_SUCCESS;
+    };
+
+    int            device;
+    rocblas_handle handle = nullptr;
+    hipStream_t    stream = nullptr;
+    hipEvent_t     done   = nullptr;
+
+    std::mutex                                                 mutex;
+    std::condition_variable                                    cv;
+    int                                                        max_batch;
+    std::chrono::microseconds                                  window;
+    std::map<hipsolver_coalesced_key, std::shared_ptr<group>> open;
+    std::vector<hipEvent_t>                                    events;
+
+    // device arrays of the batched calls, used by one dispatch at a time
+    std::mutex   dispatch_mutex;
+    void**       dA       = nullptr;
+    rocblas_int* dinfo    = nullptr;
+    rocblas_int* dipiv    = nullptr;
+    size_t       capacity = 0, ipiv_capacity = 0;
+
+    hipsolver_coalescer()
+        : max_batch(HIPSOLVER_COALESCER_MAX_BATCH)
+        , window(HIPSOLVER_COALESCER_WINDOW)
+    {
+    }
+
+    // Gets an event to mark the work enqueued by a caller. The mutex must be held.
+    hipError_t take_event(hipEvent_t* event)
+    {
+        if(events.empty())
+            return hipEventCreateWithFlags(event, hipEventDisableTiming);
+
+        *event = events.back();
+        events.pop_back();
+        return hipSuccess;
+    }
+
+    hipError_t reserve(size_t count, size_t ipiv_count)
+    {
+        if(count > capacity)
+        {
+            // hipFree synchronizes with the previous dispatches that use the arrays
+            hipFree(dA);
+            hipFree(dinfo);
+            dA       = nullptr;
+            dinfo    = nullptr;
+            capacity = 0;
+
+            hipError_t err = hipMalloc(&dA, sizeof(void*) * count);
+            if(err == hipSuccess)
+                err = hipMalloc(&dinfo, sizeof(rocblas_int) * count);
+            if(err != hipSuccess)
+                return err;
+            capacity = count;
+        }
+        if(ipiv_count > ipiv_capacity)
+        {
+            hipFree(dipiv);
+            dipiv         = nullptr;
+            ipiv_capacity = 0;
+
+            hipError_t err = hipMalloc(&dipiv, sizeof(rocblas_int) * ipiv_count);
+            if(err != hipSuccess)
+                return err;
+            ipiv_capacity = ipiv_count;
+        }
+        return hipSuccess;
+    }
+
+    hipsolverStatus_t dispatch(group&                             g,
+                               const hipsolver_coalesced_single&  single,
+                               const hipsolver_coalesced_batched& batched,
+                               size_t                             ipiv_size)
+    {
+        int count = (int)g.requests.size();
+        if(count == 1)
+            return single();
+
+        std::lock_guard<std::mutex> lock(dispatch_mutex);
+        if(reserve(count, ipiv_size * count) != hipSuccess)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        std::vector<void*> hA(count);
+        for(int i = 0; i < count; i++)
+        {
+            hA[i] = g.requests[i].A;
+            if(hipStreamWaitEvent(stream, g.requests[i].ready, 0) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        if(hipMemcpyAsync(dA, hA.data(), sizeof(void*) * count, hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        hipsolverStatus_t status = batched(handle, dA, dinfo, dipiv, count);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        for(int i = 0; i < count; i++)
+        {
+            const request& r = g.requests[i];
+            if(hipMemcpyAsync(
+                   r.info, dinfo + i, sizeof(rocblas_int), hipMemcpyDeviceToDevice, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            if(ipiv_size
+               && hipMemcpyAsync(r.ipiv,
+                                 dipiv + ipiv_size * i,
+                                 sizeof(rocblas_int) * ipiv_size,
+                                 hipMemcpyDeviceToDevice,
+                                 stream)
+                      != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+
+        if(hipEventRecord(done, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        for(const request& r : g.requests)
+        {
+            if(hipStreamWaitEvent(r.stream, done, 0) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+public:
+    static hipsolverStatus_t create(hipsolver_coalescer** coalescer)
+    {
+        std::unique_ptr<hipsolver_coalescer> c(new hipsolver_coalescer);
+        if(hipGetDevice(&c->device) != hipSuccess
+           || hipStreamCreateWithFlags(&c->stream, hipStreamNonBlocking) != hipSuccess
+           || hipEventCreateWithFlags(&c->done, hipEventDisableTiming) != hipSuccess)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        if(rocblas_create_handle(&c->handle) != rocblas_status_success
+           || rocblas_set_stream(c->handle, c->stream) != rocblas_status_success)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        *coalescer = c.release();
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    ~hipsolver_coalescer()
+    {
+        if(stream)
+            hipStreamSynchronize(stream);
+        for(hipEvent_t event : events)
+            hipEventDestroy(event);
+        if(done)
+            hipEventDestroy(done);
+        if(handle)
+            rocblas_destroy_handle(handle);
+        if(stream)
+            hipStreamDestroy(stream);
+        hipFree(dA);
+        hipFree(dinfo);
+        hipFree(dipiv);
+    }
+
+    void set_max_batch(int value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        max_batch = value;
+    }
+
+    void set_window(int microseconds)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        window = std::chrono::microseconds(microseconds);
+    }
+
+    /*! Submits a call, and returns once the group it belongs to has been
+     *  dispatched. ipiv_size is the number of pivot indices of each problem.
+     */
+    hipsolverStatus_t submit(rocblas_handle                     caller,
+                             const hipsolver_coalesced_key&     key,
+                             void*                              A,
+                             rocblas_int*                       ipiv,
+                             size_t                             ipiv_size,
+                             rocblas_int*                       info,
+                             const hipsolver_coalesced_single&  single,
+                             const hipsolver_coalesced_batched& batched)
+    {
+        int current;
+        if(hipGetDevice(&current) != hipSuccess || current != device)
+            return single();
+
+        request r = {nullptr, nullptr, A, ipiv, info};
+        if(rocblas_get_stream(caller, &r.stream) != rocblas_status_success)
+            return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if(max_batch <= 1)
+        {
+            lock.unlock();
+            return single();
+        }
+
+        if(take_event(&r.ready) != hipSuccess)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        if(hipEventRecord(r.ready, r.stream) != hipSuccess)
+        {
+            events.push_back(r.ready);
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+
+        std::shared_ptr<group>& slot   = open[key];
+        bool                    leader = !slot;
+        if(leader)
+        {
+            slot           = std::make_shared<group>();
+            slot->deadline = std::chrono::steady_clock::now() + window;
+        }
+
+        std::shared_ptr<group> g = slot;
+        g->requests.push_back(r);
+        if((int)g->requests.size() >= max_batch)
+        {
+            open.erase(key);
+            g->closed = true;
+            cv.notify_all();
+        }
+
+        if(!leader)
+        {
+            cv.wait(lock, [&] { return g->done; });
+            return g->status;
+        }
+
+        cv.wait_until(lock, g->deadline, [&] { return g->closed; });
+        if(!g->closed)
+        {
+            auto it = open.find(key);
+            if(it != open.end() && it->second == g)
+                open.erase(it);
+            g->closed = true;
+        }
+        lock.unlock();
+
+        hipsolverStatus_t status = dispatch(*g, single, batched, ipiv_size);
+
+        lock.lock();
+        for(const request& q : g->requests)
+            events.push_back(q.ready);
+        g->status = status;
+        g->done   = true;
+        cv.notify_all();
+        return status;
+    }
+};
@@ -0,0 +1,228 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Process-wide pool of rocBLAS handles used by hipsolverCreate and
+ *  hipsolverDestroy on the rocSOLVER side.
+ *
+ *  Creating a rocBLAS handle queries the device and initializes rocBLAS, which
+ *  is costly for applications that create and destroy a handle per request or
+ *  per thread. When the pool has a non-zero capacity, hipsolverDestroy resets
+ *  the handle to its initial state (default stream, host pointer mode and
+ *  rocBLAS-managed workspace) and keeps it, and hipsolverCreate reuses a kept
+ *  handle of the current device instead of creating a new one. A workspace
+ *  set by hipSOLVER or the user is released when the handle is kept, and is
+ *  allocated again on first use, as for a new handle.
+ *
+ *  The pool is never destroyed, as the HIP runtime may already be torn down
+ *  when static objects are; the kept handles are released by
+ *  hipsolverHandlePoolClear, or when the process exits.
+ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <hip/hip_runtime_api.h>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Default number of idle handles kept by the pool. By default, handles are
+// destroyed by hipsolverDestroy.
+#ifndef HIPSOLVER_HANDLE_POOL_CAPACITY
+#define HIPSOLVER_HANDLE_POOL_CAPACITY 0
+#endif
+
+class hipsolver_handle_pool
+{
+    struct entry
+    {
+        rocblas_handle handle;
+        int            device;
+    };
+
+    std::mutex mutex;
+    size_t     capacity = HIPSOLVER_HANDLE_POOL_CAPACITY;
+
+    // idle handles, with the device they were created on
+    std::vector<entry> idle;
+
+    // devices of the handles given out by create
+    std::unordered_map<rocblas_handle, int> active;
+
+    static int current_device()
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            device = -1;
+        return device;
+    }
+
+    static rocblas_status reset(rocblas_handle handle)
+    {
+        rocblas_status status = rocblas_set_stream(handle, 0);
+        if(status == rocblas_status_success)
+            status = rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+        // the workspace may have been set by the user, and may be freed by them
+        if(status == rocblas_status_success && rocblas_is_user_managing_device_memory(handle))
+            status = rocblas_set_device_memory_size(handle, 0);
+        return status;
+    }
+
+    static rocblas_status destroy_all(std::vector<entry>& handles)
+    {
+        rocblas_status status = rocblas_status_success;
+        for(entry& e : handles)
+        {
+            rocblas_status destroyed = rocblas_destroy_handle(e.handle);
+            if(status == rocblas_status_success)
+                status = destroyed;
+        }
+        return status;
+    }
+
+    // Idle handles of the given device. The mutex must be held.
+    size_t count_idle(int device) const
+    {
+        size_t count = 0;
+        for(const entry& e : idle)
+            count += (e.device == device);
+        return count;
+    }
+
+public:
+    static hipsolver_handle_pool& instance()
+    {
+        static hipsolver_handle_pool* pool = new hipsolver_handle_pool;
+        return *pool;
+    }
+
+    rocblas_status create(rocblas_handle* handle)
+    {
+        int device = current_device();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(auto it = idle.rbegin(); it != idle.rend(); ++it)
+            {
+                if(it->device == device)
+                {
+                    *handle = it->handle;
+                    idle.erase(std::next(it).base());
+                    active[*handle] = device;
+                    return rocblas_status_success;
+                }
+            }
+        }
+
+        rocblas_status status = rocblas_create_handle(handle);
+        if(status != rocblas_status_success)
+            return status;
+
+        try
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            active[*handle] = device;
+        }
+        catch(...)
+        {
+            rocblas_destroy_handle(*handle);
+            throw;
+        }
+        return rocblas_status_success;
+    }
+
+    rocblas_status destroy(rocblas_handle handle)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        int  device = 0;
+        bool keep   = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        it = active.find(handle);
+            if(it != active.end())
+            {
+                device = it->second;
+                keep   = idle.size() < capacity;
+                active.erase(it);
+            }
+        }
+
+        if(keep && reset(handle) == rocblas_status_success)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(idle.size() < capacity)
+            {
+                idle.push_back({handle, device});
+                return rocblas_status_success;
+            }
+        }
+
+        return rocblas_destroy_handle(handle);
+    }
+
+    rocblas_status set_capacity(size_t new_capacity)
+    {
+        std::vector<entry> excess;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            capacity = new_capacity;
+            if(idle.size() > capacity)
+            {
+                excess.assign(idle.begin() + capacity, idle.end());
+                idle.resize(capacity);
+            }
+        }
+        return destroy_all(excess);
+    }
+
+    size_t get_capacity()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return capacity;
+    }
+
+    // Creates handles on the current device until count of them are idle, or
+    // the pool is full
+    rocblas_status reserve(size_t count)
+    {
+        int device = current_device();
+        while(true)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(count_idle(device) >= count || idle.size() >= capacity)
+                    return rocblas_status_success;
+            }
+
+            rocblas_handle handle;
+            rocblas_status status = rocblas_create_handle(&handle);
+            if(status != rocblas_status_success)
+                return status;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(idle.size() < capacity)
+                {
+                    idle.push_back({handle, device});
+                    continue;
+                }
+            }
+            return rocblas_destroy_handle(handle);
+        }
+    }
+
+    rocblas_status clear()
+    {
+        std::vector<entry> handles;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            handles.swap(idle);
+        }
+        return destroy_all(handles);
+    }
+};
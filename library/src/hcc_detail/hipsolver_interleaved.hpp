@@ -0,0 +1,450 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Interleaved batched layout on the rocSOLVER side.
+ *
+ *  In the interleaved layout, element (i,j) of problem b of a batch of
+ *  batch_count m-by-n matrices with leading dimension lda is stored at
+ *  A[b + (i + j*lda)*batch_count], so that the same element of all the problems
+ *  is contiguous. For column j, the elements of the batch form the column-major
+ *  batch_count-by-m matrix starting at A + j*lda*batch_count, whose transpose
+ *  is column j of every problem of the strided layout. The conversions between
+ *  both layouts are then a single strided batched geam over the n columns.
+ *
+ *  The interleaved functions convert their matrices into the strided layout in
+ *  the workspace, run the strided batched function, and convert the results
+ *  back. The pivot indices of getrf and getrs are not interleaved: those of
+ *  problem b are stored at ipiv + b*min(m,n).
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <algorithm>
+#include <climits>
+
+/******************** HELPERS ********************/
+inline rocblas_status hipsolver_interleaved_argCheck(rocblas_handle handle,
+                                                     rocblas_int    m,
+                                                     rocblas_int    n,
+                                                     rocblas_int    lda,
+                                                     rocblas_int    batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || lda < m || lda < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_status_continue;
+}
+
+/*! Copies the interleaved batch A into the strided batch B. A may be a
+ *  workspace of the handle, but B may not overlap A.
+ */
+template <typename T>
+rocblas_status hipsolver_interleaved_to_strided(rocblas_handle handle,
+                                                rocblas_int    m,
+                                                rocblas_int    n,
+                                                const T*       A,
+                                                rocblas_int    lda,
+                                                T*             B,
+                                                rocblas_int    ldb,
+                                                rocblas_stride strideB,
+                                                rocblas_int    batch_count)
+{
+    rocblas_status st = hipsolver_interleaved_argCheck(handle, m, n, lda, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+    if(ldb < m || ldb < 1 || strideB < rocblas_stride(ldb) * n || strideB > INT_MAX)
+        return rocblas_status_invalid_size;
+    if(m && n && batch_count && (!A || !B))
+        return rocblas_status_invalid_pointer;
+
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_operation trans   = rocblas_operation_transpose;
+    const rocblas_stride    strideA = rocblas_stride(lda) * batch_count;
+    const T                 one     = T(1);
+    const T                 zero    = T(0);
+
+    // column j of the strided batch is the transpose of the batch_count-by-m matrix
+    // at A + j*lda*batch_count
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    return xgeam_strided_batched(handle,
+                                 trans,
+                                 trans,
+                                 m,
+                                 batch_count,
+                                 &one,
+                                 A,
+                                 batch_count,
+                                 strideA,
+                                 &zero,
+                                 A,
+                                 batch_count,
+                                 strideA,
+                                 B,
+                                 (rocblas_int)strideB,
+                                 ldb,
+                                 n);
+}
+
+/*! Copies the strided batch A into the interleaved batch B. B may not overlap A.
+ */
+template <typename T>
+rocblas_status hipsolver_strided_to_interleaved(rocblas_handle handle,
+                                                rocblas_int    m,
+                                                rocblas_int    n,
+                                                const T*       A,
+                                                rocblas_int    lda,
+                                                rocblas_stride strideA,
+                                                T*             B,
+                                                rocblas_int    ldb,
+                                                rocblas_int    batch_count)
+{
+    rocblas_status st = hipsolver_interleaved_argCheck(handle, m, n, ldb, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+    if(lda < m || lda < 1 || strideA < rocblas_stride(lda) * n || strideA > INT_MAX)
+        return rocblas_status_invalid_size;
+    if(m && n && batch_count && (!A || !B))
+        return rocblas_status_invalid_pointer;
+
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_operation trans   = rocblas_operation_transpose;
+    const rocblas_stride    strideB = rocblas_stride(ldb) * batch_count;
+    const T                 one     = T(1);
+    const T                 zero    = T(0);
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    return xgeam_strided_batched(handle,
+                                 trans,
+                                 trans,
+                                 batch_count,
+                                 m,
+                                 &one,
+                                 A,
+                                 (rocblas_int)strideA,
+                                 lda,
+                                 &zero,
+                                 A,
+                                 (rocblas_int)strideA,
+                                 lda,
+                                 B,
+                                 batch_count,
+                                 strideB,
+                                 n);
+}
+
+/******************** POTRF ********************/
+template <typename T>
+rocblas_status hipsolver_potrf_interleaved_bufferSize(rocblas_handle handle,
+                                                      rocblas_fill   uplo,
+                                                      rocblas_int    n,
+                                                      rocblas_int    batch_count,
+                                                      size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xpotrf_strided_batched(handle, uplo, n, (T*)nullptr, n, n * n, nullptr, batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the strided copy of A
+    size_t size_W = sizeof(T) * n * n * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_W);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_interleaved(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           T*             A,
+                                           rocblas_int    lda,
+                                           rocblas_int*   info,
+                                           rocblas_int    batch_count)
+{
+    rocblas_status st = hipsolver_interleaved_argCheck(handle, n, n, lda, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if((n && batch_count && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    if(n == 0 || batch_count == 0)
+        return xpotrf_strided_batched(handle, uplo, n, A, lda, 0, info, batch_count);
+
+    const rocblas_stride strideW = n * n;
+
+    rocblas_device_malloc mem(handle, sizeof(T) * strideW * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+    T* W = (T*)mem[0];
+
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_interleaved_to_strided(handle, n, n, A, lda, W, n, strideW, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(
+        xpotrf_strided_batched(handle, uplo, n, W, n, strideW, info, batch_count));
+    return hipsolver_strided_to_interleaved(handle, n, n, W, n, strideW, A, lda, batch_count);
+}
+
+/******************** POTRS ********************/
+template <typename T>
+rocblas_status hipsolver_potrs_interleaved_bufferSize(rocblas_handle handle,
+                                                      rocblas_fill   uplo,
+                                                      rocblas_int    n,
+                                                      rocblas_int    nrhs,
+                                                      rocblas_int    batch_count,
+                                                      size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || nrhs <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xpotrs_strided_batched(handle,
+                           uplo,
+                           n,
+                           nrhs,
+                           (T*)nullptr,
+                           n,
+                           n * n,
+                           (T*)nullptr,
+                           n,
+                           n * nrhs,
+                           batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the strided copies of A and B
+    size_t size_WA = sizeof(T) * n * n * batch_count;
+    size_t size_WB = sizeof(T) * n * nrhs * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_WA, size_WB);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_potrs_interleaved(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    nrhs,
+                                           T*             A,
+                                           rocblas_int    lda,
+                                           T*             B,
+                                           rocblas_int    ldb,
+                                           rocblas_int    batch_count)
+{
+    rocblas_status st = hipsolver_interleaved_argCheck(handle, n, nrhs, ldb, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && !A) || (n && nrhs && batch_count && !B))
+        return rocblas_status_invalid_pointer;
+
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_stride strideWA = n * n;
+    const rocblas_stride strideWB = n * nrhs;
+
+    rocblas_device_malloc mem(
+        handle, sizeof(T) * strideWA * batch_count, sizeof(T) * strideWB * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+    T* WA = (T*)mem[0];
+    T* WB = (T*)mem[1];
+
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_interleaved_to_strided(handle, n, n, A, lda, WA, n, strideWA, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_interleaved_to_strided(handle, n, nrhs, B, ldb, WB, n, strideWB, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(xpotrs_strided_batched(
+        handle, uplo, n, nrhs, WA, n, strideWA, WB, n, strideWB, batch_count));
+    return hipsolver_strided_to_interleaved(
+        handle, n, nrhs, WB, n, strideWB, B, ldb, batch_count);
+}
+
+/******************** GETRF ********************/
+template <typename T>
+rocblas_status hipsolver_getrf_interleaved_bufferSize(rocblas_handle handle,
+                                                      rocblas_int    m,
+                                                      rocblas_int    n,
+                                                      rocblas_int    batch_count,
+                                                      size_t*        lwork)
+{
+    *lwork = 0;
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xgetrf_strided_batched(
+        handle, m, n, (T*)nullptr, m, m * n, nullptr, std::min(m, n), nullptr, batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the strided copy of A
+    size_t size_W = sizeof(T) * m * n * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_W);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_getrf_interleaved(rocblas_handle handle,
+                                           rocblas_int    m,
+                                           rocblas_int    n,
+                                           T*             A,
+                                           rocblas_int    lda,
+                                           rocblas_int*   ipiv,
+                                           rocblas_int*   info,
+                                           rocblas_int    batch_count)
+{
+    rocblas_status st = hipsolver_interleaved_argCheck(handle, m, n, lda, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+    if((m && n && batch_count && (!A || !ipiv)) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    const rocblas_stride strideP = std::min(m, n);
+    if(m == 0 || n == 0 || batch_count == 0)
+        return xgetrf_strided_batched(
+            handle, m, n, A, lda, 0, ipiv, strideP, info, batch_count);
+
+    const rocblas_stride strideW = m * n;
+
+    rocblas_device_malloc mem(handle, sizeof(T) * strideW * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+    T* W = (T*)mem[0];
+
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_interleaved_to_strided(handle, m, n, A, lda, W, m, strideW, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(
+        xgetrf_strided_batched(handle, m, n, W, m, strideW, ipiv, strideP, info, batch_count));
+    return hipsolver_strided_to_interleaved(handle, m, n, W, m, strideW, A, lda, batch_count);
+}
+
+/******************** GETRS ********************/
+template <typename T>
+rocblas_status hipsolver_getrs_interleaved_bufferSize(rocblas_handle    handle,
+                                                      rocblas_operation trans,
+                                                      rocblas_int       n,
+                                                      rocblas_int       nrhs,
+                                                      rocblas_int       batch_count,
+                                                      size_t*           lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || nrhs <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xgetrs_strided_batched(handle,
+                           trans,
+                           n,
+                           nrhs,
+                           (T*)nullptr,
+                           n,
+                           n * n,
+                           nullptr,
+                           n,
+                           (T*)nullptr,
+                           n,
+                           n * nrhs,
+                           batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the strided copies of A and B
+    size_t size_WA = sizeof(T) * n * n * batch_count;
+    size_t size_WB = sizeof(T) * n * nrhs * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_WA, size_WB);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_getrs_interleaved(rocblas_handle     handle,
+                                           rocblas_operation  trans,
+                                           rocblas_int        n,
+                                           rocblas_int        nrhs,
+                                           T*                 A,
+                                           rocblas_int        lda,
+                                           const rocblas_int* ipiv,
+                                           T*                 B,
+                                           rocblas_int        ldb,
+                                           rocblas_int        batch_count)
+{
+    rocblas_status st = hipsolver_interleaved_argCheck(handle, n, nrhs, ldb, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && (!A || !ipiv)) || (n && nrhs && batch_count && !B))
+        return rocblas_status_invalid_pointer;
+
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_stride strideWA = n * n;
+    const rocblas_stride strideWB = n * nrhs;
+
+    rocblas_device_malloc mem(
+        handle, sizeof(T) * strideWA * batch_count, sizeof(T) * strideWB * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+    T* WA = (T*)mem[0];
+    T* WB = (T*)mem[1];
+
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_interleaved_to_strided(handle, n, n, A, lda, WA, n, strideWA, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_interleaved_to_strided(handle, n, nrhs, B, ldb, WB, n, strideWB, batch_count));
+    RETURN_IF_ROCBLAS_ERROR(xgetrs_strided_batched(
+        handle, trans, n, nrhs, WA, n, strideWA, ipiv, n, WB, n, strideWB, batch_count));
+    return hipsolver_strided_to_interleaved(
+        handle, n, nrhs, WB, n, strideWB, B, ldb, batch_count);
+}
@@ -0,0 +1,417 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Row-major matrix layout of a handle on the rocSOLVER side.
+ *
+ *  A row-major m-by-n matrix A with leading dimension lda is, in memory, the
+ *  column-major n-by-m matrix A^T, so that the row-major functions are served
+ *  by the column-major ones on the transposed problem (below, ' denotes the
+ *  conjugate transpose):
+ *
+ *  - potrf and syevd/heevd only flip the fill mode, as the stored triangle of
+ *    A^T is the opposite triangle of A. The eigenvectors computed by
+ *    syevd/heevd are however those of A^T = conj(A), and are transposed in
+ *    place into the row-major layout.
+ *
+ *  - gesvd computes the SVD of A^T = conj(V)*S*U^T, so that the roles of U and
+ *    V' and of jobu and jobv are swapped, with no data movement.
+ *
+ *  - potrs solves X^T*A^T = B^T with two triangular solves from the right on
+ *    the column-major B^T, with no data movement. posv combines potrf and
+ *    potrs.
+ *
+ *  - getrf factorizes A^T (P*A^T = L*U), and getrs solves with the factors of
+ *    A^T by transposing B into the workspace. gesv combines both.
+ *
+ *  The layout of each handle is kept in a process-wide registry, which is only
+ *  locked when at least one handle uses the row-major layout.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+
+class hipsolver_layout_registry
+{
+    std::mutex                         mutex;
+    std::unordered_set<rocblas_handle> row_major;
+    std::atomic<size_t>                count{0};
+
+public:
+    static hipsolver_layout_registry& instance()
+    {
+        static hipsolver_layout_registry* registry = new hipsolver_layout_registry;
+        return *registry;
+    }
+
+    void set(rocblas_handle handle, bool is_row_major)
+    {
+        if(!is_row_major && count == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(is_row_major)
+            row_major.insert(handle);
+        else
+            row_major.erase(handle);
+        count = row_major.size();
+    }
+
+    bool is_row_major(rocblas_handle handle)
+    {
+        if(count == 0)
+            return false;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        return row_major.count(handle) > 0;
+    }
+};
+
+/******************** HELPERS ********************/
+inline bool hipsolver_is_row_major(rocblas_handle handle)
+{
+    return hipsolver_layout_registry::instance().is_row_major(handle);
+}
+
+// Fill mode of the transposed matrix. Invalid values are kept, so that they are reported
+inline hipsolverFillMode_t hipsolver_transpose_fill(hipsolverFillMode_t uplo)
+{
+    if(uplo == HIPSOLVER_FILL_MODE_UPPER)
+        return HIPSOLVER_FILL_MODE_LOWER;
+    if(uplo == HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_FILL_MODE_UPPER;
+    return uplo;
+}
+
+inline rocblas_fill hipsolver_transpose_fill(rocblas_fill uplo)
+{
+    if(uplo == rocblas_fill_upper)
+        return rocblas_fill_lower;
+    if(uplo == rocblas_fill_lower)
+        return rocblas_fill_upper;
+    return uplo;
+}
+
+// Arguments of gesvd for the transposed matrix
+inline void hipsolver_transpose_svd(signed char& jobu, signed char& jobv, int& m, int& n)
+{
+    std::swap(jobu, jobv);
+    std::swap(m, n);
+}
+
+template <typename T>
+inline void hipsolver_transpose_svd(
+    signed char& jobu, signed char& jobv, int& m, int& n, T*& U, int& ldu, T*& V, int& ldv)
+{
+    hipsolver_transpose_svd(jobu, jobv, m, n);
+    std::swap(U, V);
+    std::swap(ldu, ldv);
+}
+
+// Copies the m-by-n matrix op(A) into B, with op a transpose or conjugate transpose
+template <typename T>
+rocblas_status hipsolver_transpose_copy(rocblas_handle    handle,
+                                        rocblas_operation op,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        T*                A,
+                                        rocblas_int       lda,
+                                        T*                B,
+                                        rocblas_int       ldb)
+{
+    const T one  = T(1);
+    const T zero = T(0);
+    return xgeam(handle, op, op, m, n, &one, A, lda, &zero, A, lda, B, ldb);
+}
+
+/******************** POTRS ********************/
+template <typename T>
+rocblas_status hipsolver_potrs_row_major_bufferSize(rocblas_handle handle,
+                                                    rocblas_fill   uplo,
+                                                    rocblas_int    n,
+                                                    rocblas_int    nrhs,
+                                                    size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || nrhs <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xtrsm(handle,
+          rocblas_side_right,
+          uplo,
+          rocblas_operation_none,
+          rocblas_diagonal_non_unit,
+          nrhs,
+          n,
+          (T*)nullptr,
+          (T*)nullptr,
+          n,
+          (T*)nullptr,
+          nrhs);
+    xtrsm(handle,
+          rocblas_side_right,
+          uplo,
+          rocblas_operation_conjugate_transpose,
+          rocblas_diagonal_non_unit,
+          nrhs,
+          n,
+          (T*)nullptr,
+          (T*)nullptr,
+          n,
+          (T*)nullptr,
+          nrhs);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+/*! uplo is the fill mode of the factor of A^T, as given to potrf.
+ */
+template <typename T>
+rocblas_status hipsolver_potrs_row_major(rocblas_handle handle,
+                                         rocblas_fill   uplo,
+                                         rocblas_int    n,
+                                         rocblas_int    nrhs,
+                                         T*             A,
+                                         rocblas_int    lda,
+                                         T*             B,
+                                         rocblas_int    ldb)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || nrhs < 0 || lda < n || lda < 1 || ldb < nrhs || ldb < 1)
+        return rocblas_status_invalid_size;
+    if((n && !A) || (n && nrhs && !B))
+        return rocblas_status_invalid_pointer;
+
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // A^T = U'*U: solve Y*U = B^T, then X^T*U' = Y; A^T = L*L': solve Y*L' = B^T, then X^T*L = Y
+    const bool              upper  = (uplo == rocblas_fill_upper);
+    const rocblas_operation first  = upper ? rocblas_operation_none
+                                           : rocblas_operation_conjugate_transpose;
+    const rocblas_operation second = upper ? rocblas_operation_conjugate_transpose
+                                           : rocblas_operation_none;
+    const T                 one    = T(1);
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    RETURN_IF_ROCBLAS_ERROR(xtrsm(handle,
+                                  rocblas_side_right,
+                                  uplo,
+                                  first,
+                                  rocblas_diagonal_non_unit,
+                                  nrhs,
+                                  n,
+                                  &one,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb));
+    RETURN_IF_ROCBLAS_ERROR(xtrsm(handle,
+                                  rocblas_side_right,
+                                  uplo,
+                                  second,
+                                  rocblas_diagonal_non_unit,
+                                  nrhs,
+                                  n,
+                                  &one,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb));
+
+    return rocblas_status_success;
+}
+
+/******************** GETRS ********************/
+template <typename T>
+rocblas_status hipsolver_getrs_row_major_bufferSize(rocblas_handle    handle,
+                                                    rocblas_operation trans,
+                                                    rocblas_int       n,
+                                                    rocblas_int       nrhs,
+                                                    size_t*           lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || nrhs <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xgetrs(handle,
+           trans == rocblas_operation_none ? rocblas_operation_transpose : rocblas_operation_none,
+           n,
+           nrhs,
+           (T*)nullptr,
+           n,
+           nullptr,
+           (T*)nullptr,
+           n);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the column-major copy of B
+    size_t size_W = sizeof(T) * n * nrhs;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_W);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+/*! A and ipiv hold the factorization of A^T computed by getrf, and B and X are
+ *  row-major. X may be equal to B.
+ */
+template <typename T>
+rocblas_status hipsolver_getrs_row_major(rocblas_handle     handle,
+                                         rocblas_operation  trans,
+                                         rocblas_int        n,
+                                         rocblas_int        nrhs,
+                                         T*                 A,
+                                         rocblas_int        lda,
+                                         const rocblas_int* ipiv,
+                                         T*                 B,
+                                         rocblas_int        ldb,
+                                         T*                 X,
+                                         rocblas_int        ldx)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if(n < 0 || nrhs < 0 || lda < n || lda < 1 || ldb < nrhs || ldb < 1 || ldx < nrhs || ldx < 1)
+        return rocblas_status_invalid_size;
+    if((n && (!A || !ipiv)) || (n && nrhs && (!B || !X)))
+        return rocblas_status_invalid_pointer;
+
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // op(A)*X = B is (A^T)^T*X = B, A^T*X = B or conj(A^T)*X = B. The last is solved as
+    // A^T*conj(X) = conj(B), with the copy W = conj(B) = (B^T)'
+    const rocblas_operation solve = (trans == rocblas_operation_none) ? rocblas_operation_transpose
+                                                                      : rocblas_operation_none;
+    const rocblas_operation copy  = (trans == rocblas_operation_conjugate_transpose)
+                                        ? rocblas_operation_conjugate_transpose
+                                        : rocblas_operation_transpose;
+
+    rocblas_device_malloc mem(handle, sizeof(T) * n * nrhs);
+    if(!mem)
+        return rocblas_status_memory_error;
+    T* W = (T*)mem[0];
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_transpose_copy(handle, copy, n, nrhs, B, ldb, W, n));
+    RETURN_IF_ROCBLAS_ERROR(xgetrs(handle, solve, n, nrhs, A, lda, ipiv, W, n));
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_transpose_copy(handle, copy, nrhs, n, W, n, X, ldx));
+
+    return rocblas_status_success;
+}
+
+/******************** GESV ********************/
+template <typename T>
+rocblas_status hipsolver_gesv_row_major_bufferSize(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   rocblas_int    nrhs,
+                                                   size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xgetrf(handle, n, n, (T*)nullptr, n, nullptr, nullptr);
+    xgetrs(handle, rocblas_operation_transpose, n, nrhs, (T*)nullptr, n, nullptr, (T*)nullptr, n);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the column-major copy of B
+    size_t size_W = sizeof(T) * n * nrhs;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_W);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_gesv_row_major(rocblas_handle handle,
+                                        rocblas_int    n,
+                                        rocblas_int    nrhs,
+                                        T*             A,
+                                        rocblas_int    lda,
+                                        rocblas_int*   ipiv,
+                                        T*             B,
+                                        rocblas_int    ldb,
+                                        T*             X,
+                                        rocblas_int    ldx,
+                                        rocblas_int*   info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || nrhs < 0 || lda < n || lda < 1 || ldb < nrhs || ldb < 1 || ldx < nrhs || ldx < 1)
+        return rocblas_status_invalid_size;
+    if((n && (!A || !ipiv)) || (n && nrhs && (!B || !X)) || !info)
+        return rocblas_status_invalid_pointer;
+
+    RETURN_IF_ROCBLAS_ERROR(xgetrf(handle, n, n, A, lda, ipiv, info));
+    return hipsolver_getrs_row_major(
+        handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb, X, ldx);
+}
+
+/******************** SYEVD/HEEVD ********************/
+template <typename T>
+size_t hipsolver_syevd_row_major_size(rocblas_int n)
+{
+    // space for the copy of the eigenvectors
+    return n > 0 ? sizeof(T) * n * n : 0;
+}
+
+/*! Transposes in place the eigenvectors of A^T = conj(A) computed by syevd/heevd,
+ *  which gives the row-major eigenvectors of A.
+ */
+template <typename T>
+rocblas_status
+    hipsolver_syevd_row_major_vectors(rocblas_handle handle, rocblas_int n, T* A, rocblas_int lda)
+{
+    if(n <= 0)
+        return rocblas_status_success;
+
+    rocblas_device_malloc mem(handle, hipsolver_syevd_row_major_size<T>(n));
+    if(!mem)
+        return rocblas_status_memory_error;
+    T* W = (T*)mem[0];
+
+    const rocblas_operation none = rocblas_operation_none;
+    const T                 one  = T(1);
+    const T                 zero = T(0);
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_transpose_copy(
+        handle, rocblas_operation_conjugate_transpose, n, n, A, lda, W, n));
+    RETURN_IF_ROCBLAS_ERROR(xgeam(handle, none, none, n, n, &one, W, n, &zero, W, n, A, lda));
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,683 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Packed-storage Cholesky and eigensolvers on the rocSOLVER side.
+ *
+ *  A packed matrix stores only the upper or the lower triangle, column by column,
+ *  in n*(n+1)/2 elements. rocSOLVER has no packed routines, so these functions are
+ *  composed from rocBLAS and rocSOLVER calls, and never form the full n-by-n matrix:
+ *
+ *  - pptrf factorizes the matrix by blocks of columns. Each block column is copied
+ *    into an n-by-nb workspace and factorized there with potrf. The upper case is
+ *    left-looking (the off-diagonal part of the block column is obtained with tpsv
+ *    against the packed leading factor), and the lower case is right-looking (the
+ *    trailing packed submatrix is updated with one hpr per column of the block).
+ *
+ *  - pptrs solves with the packed factor using two calls to tpsv per right-hand
+ *    side.
+ *
+ *  - spevd/hpevd reduces the packed matrix to tridiagonal form following LAPACK
+ *    xSPTRD/xHPTRD and computes the eigenvalues with sterf. When the eigenvectors
+ *    are requested, the matrix is instead unpacked into Z, which must hold them
+ *    anyway, and solved with syevd/heevd.
+ *
+ *  - trttp and tpttr convert between packed and full storage.
+ */
+
+#pragma once
+
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <algorithm>
+
+// Block size of the packed Cholesky factorization
+#ifndef HIPSOLVER_PPTRF_BLOCKSIZE
+#define HIPSOLVER_PPTRF_BLOCKSIZE 32
+#endif
+
+/******************** HELPERS ********************/
+// Block size used by pptrf for the given matrix size
+inline rocblas_int hipsolver_pptrf_blocksize(rocblas_int n)
+{
+    return std::max(1, std::min(HIPSOLVER_PPTRF_BLOCKSIZE, n));
+}
+
+// Position of the diagonal element of column c in a packed matrix of size n
+inline size_t hipsolver_packed_diag(rocblas_fill uplo, rocblas_int n, rocblas_int c)
+{
+    if(uplo == rocblas_fill_upper)
+        return size_t(c) * (c + 1) / 2 + c;
+    else
+        return size_t(c) * n - size_t(c) * (c - 1) / 2;
+}
+
+// Copies the stored part of columns [c0, c1) between the packed matrix AP and the full
+// matrix A, where element (r,c) of the packed matrix is A[(r - r0) + (c - c0) * lda].
+// For uplo = upper, r0 must be zero
+template <typename T>
+rocblas_status hipsolver_packed_copy(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     bool           pack,
+                                     rocblas_int    n,
+                                     rocblas_int    c0,
+                                     rocblas_int    c1,
+                                     rocblas_int    r0,
+                                     T*             AP,
+                                     rocblas_stride strideP,
+                                     T*             A,
+                                     rocblas_int    lda,
+                                     rocblas_stride strideA,
+                                     rocblas_int    batch_count)
+{
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    for(rocblas_int c = c0; c < c1; c++)
+    {
+        rocblas_int    len = upper ? c + 1 : n - c;
+        rocblas_int    row = upper ? 0 : c;
+        T*             APc = AP + hipsolver_packed_diag(uplo, n, c) - (upper ? c : 0);
+        T*             Ac  = A + (row - r0) + size_t(c - c0) * lda;
+        T*             src = pack ? Ac : APc;
+        T*             dst = pack ? APc : Ac;
+        rocblas_stride ss  = pack ? strideA : strideP;
+        rocblas_stride sd  = pack ? strideP : strideA;
+
+        RETURN_IF_ROCBLAS_ERROR(
+            xcopy_strided_batched(handle, len, src, 1, ss, dst, 1, sd, batch_count));
+    }
+
+    return rocblas_status_success;
+}
+
+/******************** TRTTP/TPTTR ********************/
+inline rocblas_status hipsolver_trttp_argCheck(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               const void*    A,
+                                               rocblas_int    lda,
+                                               const void*    AP)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    if(n && (!A || !AP))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+// Converts between full (A) and packed (AP) storage of a triangular matrix
+template <typename T>
+rocblas_status hipsolver_trttp_template(
+    rocblas_handle handle, rocblas_fill uplo, bool pack, rocblas_int n, T* A, rocblas_int lda, T* AP)
+{
+    rocblas_status st = hipsolver_trttp_argCheck(handle, uplo, n, A, lda, AP);
+    if(st != rocblas_status_continue)
+        return st;
+
+    if(n == 0)
+        return rocblas_status_success;
+
+    return hipsolver_packed_copy(handle, uplo, pack, n, 0, n, 0, AP, 0, A, lda, 0, 1);
+}
+
+/******************** PPTRF ********************/
+inline rocblas_status hipsolver_pptrf_argCheck(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               const void*    AP,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && !AP) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_pptrf_bufferSize(rocblas_handle handle,
+                                          rocblas_fill   uplo,
+                                          rocblas_int    n,
+                                          rocblas_int    batch_count,
+                                          size_t*        lwork)
+{
+    using S = hipsolver_real_t<T>;
+
+    *lwork = 0;
+    if(n <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    const rocblas_int       nb      = hipsolver_pptrf_blocksize(n);
+    const rocblas_int       blocks  = (n - 1) / nb + 1;
+    const rocblas_stride    strideW = rocblas_stride(n) * nb;
+    const rocblas_stride    strideP = rocblas_stride(n) * (n + 1) / 2;
+    const rocblas_operation ctran   = rocblas_operation_conjugate_transpose;
+    size_t                  sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xpotrf_strided_batched(handle, uplo, nb, (T*)nullptr, n, strideW, nullptr, batch_count);
+    if(uplo == rocblas_fill_upper)
+    {
+        xtpsv_strided_batched(handle,
+                              uplo,
+                              ctran,
+                              rocblas_diagonal_non_unit,
+                              n,
+                              (T*)nullptr,
+                              strideP,
+                              (T*)nullptr,
+                              1,
+                              strideW,
+                              batch_count);
+        xherk_strided_batched(handle,
+                              uplo,
+                              ctran,
+                              nb,
+                              n,
+                              (S*)nullptr,
+                              (T*)nullptr,
+                              n,
+                              strideW,
+                              (S*)nullptr,
+                              (T*)nullptr,
+                              n,
+                              strideW,
+                              batch_count);
+    }
+    else
+    {
+        xtrsm_strided_batched(handle,
+                              rocblas_side_right,
+                              uplo,
+                              ctran,
+                              rocblas_diagonal_non_unit,
+                              n,
+                              nb,
+                              (T*)nullptr,
+                              (T*)nullptr,
+                              n,
+                              strideW,
+                              (T*)nullptr,
+                              n,
+                              strideW,
+                              batch_count);
+        xhpr_strided_batched(
+            handle, uplo, n, (S*)nullptr, (T*)nullptr, 1, strideW, (T*)nullptr, strideP, batch_count);
+    }
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the block column and the info of each diagonal block
+    size_t size_W    = sizeof(T) * strideW * batch_count;
+    size_t size_info = sizeof(rocblas_int) * blocks * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_W, size_info);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_pptrf_strided_batched(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               T*             AP,
+                                               rocblas_stride strideP,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    using S = hipsolver_real_t<T>;
+
+    rocblas_status st = hipsolver_pptrf_argCheck(handle, uplo, n, AP, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(batch_count > 0)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_int       nb      = hipsolver_pptrf_blocksize(n);
+    const rocblas_int       blocks  = (n - 1) / nb + 1;
+    const rocblas_int       ldw     = n;
+    const rocblas_stride    strideW = rocblas_stride(ldw) * nb;
+    const bool              upper   = (uplo == rocblas_fill_upper);
+    const rocblas_operation ctran   = rocblas_operation_conjugate_transpose;
+    const rocblas_diagonal  nonit   = rocblas_diagonal_non_unit;
+    const T                 one     = T(1);
+    const S                 sone    = S(1);
+    const S                 smone   = S(-1);
+
+    rocblas_device_malloc mem(
+        handle, sizeof(T) * strideW * batch_count, sizeof(rocblas_int) * blocks * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T*           W     = (T*)mem[0];
+    rocblas_int* iinfo = (rocblas_int*)mem[1];
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    for(rocblas_int j = 0, blk = 0; j < n; j += nb, blk++)
+    {
+        rocblas_int jb = std::min(nb, n - j);
+
+        if(upper)
+        {
+            // W = A(0:j+jb, j:j+jb)
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_packed_copy(
+                handle, uplo, false, n, j, j + jb, 0, AP, strideP, W, ldw, strideW, batch_count));
+
+            if(j > 0)
+            {
+                // U12 = U11^{-H} * A12, with U11 the leading packed factor
+                for(rocblas_int k = 0; k < jb; k++)
+                    RETURN_IF_ROCBLAS_ERROR(xtpsv_strided_batched(handle,
+                                                                  uplo,
+                                                                  ctran,
+                                                                  nonit,
+                                                                  j,
+                                                                  AP,
+                                                                  strideP,
+                                                                  W + size_t(k) * ldw,
+                                                                  1,
+                                                                  strideW,
+                                                                  batch_count));
+
+                // A22 = A22 - U12' * U12
+                RETURN_IF_ROCBLAS_ERROR(xherk_strided_batched(handle,
+                                                              uplo,
+                                                              ctran,
+                                                              jb,
+                                                              j,
+                                                              &smone,
+                                                              W,
+                                                              ldw,
+                                                              strideW,
+                                                              &sone,
+                                                              W + j,
+                                                              ldw,
+                                                              strideW,
+                                                              batch_count));
+            }
+
+            RETURN_IF_ROCBLAS_ERROR(xpotrf_strided_batched(
+                handle, uplo, jb, W + j, ldw, strideW, iinfo + blk * batch_count, batch_count));
+
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_packed_copy(
+                handle, uplo, true, n, j, j + jb, 0, AP, strideP, W, ldw, strideW, batch_count));
+        }
+        else
+        {
+            rocblas_int m = n - j - jb;
+
+            // W = A(j:n, j:j+jb)
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_packed_copy(
+                handle, uplo, false, n, j, j + jb, j, AP, strideP, W, ldw, strideW, batch_count));
+
+            RETURN_IF_ROCBLAS_ERROR(xpotrf_strided_batched(
+                handle, uplo, jb, W, ldw, strideW, iinfo + blk * batch_count, batch_count));
+
+            // L21 = A21 * L11^{-H}
+            if(m > 0)
+                RETURN_IF_ROCBLAS_ERROR(xtrsm_strided_batched(handle,
+                                                              rocblas_side_right,
+                                                              uplo,
+                                                              ctran,
+                                                              nonit,
+                                                              m,
+                                                              jb,
+                                                              &one,
+                                                              W,
+                                                              ldw,
+                                                              strideW,
+                                                              W + jb,
+                                                              ldw,
+                                                              strideW,
+                                                              batch_count));
+
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_packed_copy(
+                handle, uplo, true, n, j, j + jb, j, AP, strideP, W, ldw, strideW, batch_count));
+
+            // A22 = A22 - L21 * L21', where the trailing submatrix is itself a packed matrix
+            T* A22 = AP + hipsolver_packed_diag(uplo, n, j + jb);
+            for(rocblas_int k = 0; k < jb && m > 0; k++)
+                RETURN_IF_ROCBLAS_ERROR(xhpr_strided_batched(handle,
+                                                             uplo,
+                                                             m,
+                                                             &smone,
+                                                             W + jb + size_t(k) * ldw,
+                                                             1,
+                                                             strideW,
+                                                             A22,
+                                                             strideP,
+                                                             batch_count));
+        }
+    }
+
+    return hipsolver_merge_block_info(stream, nb, blocks, iinfo, info, batch_count);
+}
+
+/******************** PPTRS ********************/
+inline rocblas_status hipsolver_pptrs_argCheck(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    nrhs,
+                                               const void*    AP,
+                                               const void*    B,
+                                               rocblas_int    ldb,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || nrhs < 0 || ldb < n || ldb < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && !AP) || (n && nrhs && batch_count && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_pptrs_bufferSize(rocblas_handle handle,
+                                          rocblas_fill   uplo,
+                                          rocblas_int    n,
+                                          rocblas_int    nrhs,
+                                          rocblas_int    batch_count,
+                                          size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || nrhs <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xtpsv_strided_batched(handle,
+                          uplo,
+                          rocblas_operation_conjugate_transpose,
+                          rocblas_diagonal_non_unit,
+                          n,
+                          (T*)nullptr,
+                          rocblas_stride(n) * (n + 1) / 2,
+                          (T*)nullptr,
+                          1,
+                          n,
+                          batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_pptrs_strided_batched(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    nrhs,
+                                               T*             AP,
+                                               rocblas_stride strideP,
+                                               T*             B,
+                                               rocblas_int    ldb,
+                                               rocblas_stride strideB,
+                                               rocblas_int*   info,
+                                               rocblas_int    batch_count)
+{
+    rocblas_status st
+        = hipsolver_pptrs_argCheck(handle, uplo, n, nrhs, AP, B, ldb, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(batch_count > 0)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // A = U'*U: solve U'*Y = B, then U*X = Y; A = L*L': solve L*Y = B, then L'*X = Y
+    const bool              upper  = (uplo == rocblas_fill_upper);
+    const rocblas_operation first  = upper ? rocblas_operation_conjugate_transpose
+                                           : rocblas_operation_none;
+    const rocblas_operation second = upper ? rocblas_operation_none
+                                           : rocblas_operation_conjugate_transpose;
+
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        T* Bj = B + size_t(j) * ldb;
+        RETURN_IF_ROCBLAS_ERROR(xtpsv_strided_batched(handle,
+                                                      uplo,
+                                                      first,
+                                                      rocblas_diagonal_non_unit,
+                                                      n,
+                                                      AP,
+                                                      strideP,
+                                                      Bj,
+                                                      1,
+                                                      strideB,
+                                                      batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xtpsv_strided_batched(handle,
+                                                      uplo,
+                                                      second,
+                                                      rocblas_diagonal_non_unit,
+                                                      n,
+                                                      AP,
+                                                      strideP,
+                                                      Bj,
+                                                      1,
+                                                      strideB,
+                                                      batch_count));
+    }
+
+    return rocblas_status_success;
+}
+
+/******************** SPEVD/HPEVD ********************/
+inline rocblas_status hipsolver_spevd_argCheck(rocblas_handle handle,
+                                               rocblas_evect  evect,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               const void*    AP,
+                                               const void*    W,
+                                               const void*    Z,
+                                               rocblas_int    ldz,
+                                               rocblas_int*   info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(evect != rocblas_evect_original && evect != rocblas_evect_none)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || ldz < 1 || (evect == rocblas_evect_original && ldz < n))
+        return rocblas_status_invalid_size;
+    if((n && (!AP || !W)) || (n && evect == rocblas_evect_original && !Z) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status hipsolver_spevd_bufferSize(rocblas_handle handle,
+                                          rocblas_evect  evect,
+                                          rocblas_fill   uplo,
+                                          rocblas_int    n,
+                                          rocblas_int    ldz,
+                                          size_t*        lwork)
+{
+    using S = hipsolver_real_t<T>;
+
+    *lwork = 0;
+    if(n <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+    size_t size_E = sizeof(S) * n;
+    size_t size_V = 0, size_scalars = 0;
+
+    rocblas_start_device_memory_size_query(handle);
+    if(evect == rocblas_evect_original)
+        xheevd(handle, evect, uplo, n, (T*)nullptr, ldz, (S*)nullptr, (S*)nullptr, nullptr);
+    else
+    {
+        xlarfg(handle, n, (T*)nullptr, (T*)nullptr, 1, (T*)nullptr);
+        xhpmv(handle,
+              uplo,
+              n,
+              (T*)nullptr,
+              (T*)nullptr,
+              (T*)nullptr,
+              1,
+              (T*)nullptr,
+              (T*)nullptr,
+              1);
+        xdotc(handle, n, (T*)nullptr, 1, (T*)nullptr, 1, (T*)nullptr);
+        xsterf(handle, n, (S*)nullptr, (S*)nullptr, nullptr);
+
+        // space for the vectors y and tau*(y'*v)*v, and the device scalars
+        size_V       = sizeof(T) * 2 * n;
+        size_scalars = sizeof(T) * 6;
+    }
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_E, size_V, size_scalars);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+// Copies the real part of a device element into a real device array
+template <typename T, typename S>
+rocblas_status hipsolver_copy_real(S* dst, const T* src, hipStream_t stream)
+{
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst, src, sizeof(S), hipMemcpyDeviceToDevice, stream));
+    return rocblas_status_success;
+}
+
+template <typename T, typename S>
+rocblas_status hipsolver_spevd_template(rocblas_handle handle,
+                                        rocblas_evect  evect,
+                                        rocblas_fill   uplo,
+                                        rocblas_int    n,
+                                        T*             AP,
+                                        S*             W,
+                                        T*             Z,
+                                        rocblas_int    ldz,
+                                        rocblas_int*   info)
+{
+    rocblas_status st = hipsolver_spevd_argCheck(handle, evect, uplo, n, AP, W, Z, ldz, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(info, 0, sizeof(rocblas_int), stream));
+    if(n == 0)
+        return rocblas_status_success;
+
+    if(evect == rocblas_evect_original)
+    {
+        rocblas_device_malloc mem(handle, sizeof(S) * n);
+        if(!mem)
+            return rocblas_status_memory_error;
+
+        S* E = (S*)mem[0];
+
+        RETURN_IF_ROCBLAS_ERROR(
+            hipsolver_packed_copy(handle, uplo, false, n, 0, n, 0, AP, 0, Z, ldz, 0, 1));
+        return xheevd(handle, evect, uplo, n, Z, ldz, W, E, info);
+    }
+
+    rocblas_device_malloc mem(handle, sizeof(S) * n, sizeof(T) * 2 * n, sizeof(T) * 6);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    S* E       = (S*)mem[0];
+    T* y       = (T*)mem[1];
+    T* t       = y + n;
+    T* scalars = (T*)mem[2];
+    T* tau     = scalars;
+    T* dot     = scalars + 1;
+    T* one     = scalars + 2;
+    T* zero    = scalars + 3;
+    T* mhalf   = scalars + 4;
+    T* mone    = scalars + 5;
+
+    const T hconst[4] = {T(1), T(0), T(-0.5), T(-1)};
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(one, hconst, sizeof(hconst), hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // reduce to tridiagonal form; each step generates the reflector H(i) = I - tau*v*v',
+    // and applies it from both sides as A = A - v*w' - w*v', with w = y - (tau/2)*(y'*v)*v
+    // and y = tau*A*v
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_device);
+    for(rocblas_int step = 0; step < n - 1; step++)
+    {
+        rocblas_int i = upper ? n - 2 - step : step;
+
+        // order of the reflector, off-diagonal element, vector v, and remaining submatrix
+        rocblas_int k = upper ? i + 1 : n - i - 1;
+        T*          a = AP + (upper ? hipsolver_packed_diag(uplo, n, i + 1) - 1
+                                    : hipsolver_packed_diag(uplo, n, i) + 1);
+        T*          v = upper ? a - i : a;
+        T*          A = upper ? AP : AP + hipsolver_packed_diag(uplo, n, i + 1);
+
+        if(k > 1)
+        {
+            RETURN_IF_ROCBLAS_ERROR(xlarfg(handle, k, a, upper ? v : v + 1, 1, tau));
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_copy_real(E + i, a, stream));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(a, one, sizeof(T), hipMemcpyDeviceToDevice, stream));
+
+            RETURN_IF_ROCBLAS_ERROR(xhpmv(handle, uplo, k, tau, A, v, 1, zero, y, 1));
+            RETURN_IF_ROCBLAS_ERROR(xdotc(handle, k, y, 1, v, 1, dot));
+            RETURN_IF_ROCBLAS_ERROR(xcopy(handle, k, v, 1, t, 1));
+            RETURN_IF_ROCBLAS_ERROR(xscal(handle, k, tau, t, 1));
+            RETURN_IF_ROCBLAS_ERROR(xscal(handle, k, dot, t, 1));
+            RETURN_IF_ROCBLAS_ERROR(xaxpy(handle, k, mhalf, t, 1, y, 1));
+            RETURN_IF_ROCBLAS_ERROR(xhpr2(handle, uplo, k, mone, v, 1, y, 1, A));
+
+            // restore the off-diagonal element, which is real after larfg
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(a, E + i, sizeof(S), hipMemcpyDeviceToDevice, stream));
+        }
+        else
+            RETURN_IF_ROCBLAS_ERROR(hipsolver_copy_real(E + i, a, stream));
+
+        rocblas_int d = upper ? i + 1 : i;
+        RETURN_IF_ROCBLAS_ERROR(
+            hipsolver_copy_real(W + d, AP + hipsolver_packed_diag(uplo, n, d), stream));
+    }
+    rocblas_int d = upper ? 0 : n - 1;
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_copy_real(W + d, AP + hipsolver_packed_diag(uplo, n, d), stream));
+
+    return xsterf(handle, n, W, E, info);
+}
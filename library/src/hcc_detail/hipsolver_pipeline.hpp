@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Host-to-device streaming pipeline used by the pipelined batched
+ *  functions on the rocSOLVER side.
+ *
+ *  The problems of a pipelined batch are stored in host memory, and are
+ *  processed in chunks of chunk_size problems. Each chunk is uploaded to one of
+ *  HIPSOLVER_PIPELINE_DEPTH sets of device buffers on an upload stream, solved
+ *  on the stream of the handle, and its results are downloaded on a download
+ *  stream. Events order the three stages of each chunk, and the upload of a
+ *  chunk waits for the download of the last chunk that used the same buffers.
+ *  The transfers of some chunks can then overlap with the computations of
+ *  others, so that the time of the batch approaches the larger of the transfer
+ *  and compute times rather than their sum. Transfers from and to pageable
+ *  host memory are staged by the runtime and may not overlap; the host arrays
+ *  should be pinned (hipHostMalloc or hipHostRegister).
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Number of chunks in flight: one being uploaded, one being solved and one
+// being downloaded
+#ifndef HIPSOLVER_PIPELINE_DEPTH
+#define HIPSOLVER_PIPELINE_DEPTH 3
+#endif
+
+// Host array of a pipelined batch, with consecutive problems stride bytes apart
+struct hipsolver_pipeline_array
+{
+    void*  host;
+    size_t stride;
+    bool   upload;
+    bool   download;
+};
+
+class hipsolver_pipeline
+{
+public:
+    // Device buffers of a chunk, given to the solve function
+    struct chunk
+    {
+        // one contiguous buffer per host array, with the same stride
+        std::vector<char*> arrays;
+
+        // for each array, a device array of pointers to the problems of the chunk
+        std::vector<void**> pointers;
+
+        // infos of the problems of the chunk, which are downloaded
+        int* info;
+
+        // infos of secondary calls, which are not downloaded
+        int* scratch_info;
+
+        int count;
+    };
+
+    using solve_function = std::function<hipsolverStatus_t(const chunk&)>;
+
+private:
+    struct slot
+    {
+        chunk      buffers;
+        hipEvent_t uploaded = nullptr;
+        hipEvent_t computed = nullptr;
+        hipEvent_t freed    = nullptr;
+    };
+
+    std::vector<hipsolver_pipeline_array> arrays;
+    int*                                  info;
+    int                                   batch_count;
+    int                                   chunk_size;
+
+    hipStream_t       compute;
+    hipStream_t       upload   = nullptr;
+    hipStream_t       download = nullptr;
+    std::vector<slot> slots;
+    char*             memory = nullptr;
+
+    static size_t align(size_t bytes)
+    {
+        return (bytes + 255) / 256 * 256;
+    }
+
+    hipsolverStatus_t init()
+    {
+        if(hipStreamCreateWithFlags(&upload, hipStreamNonBlocking) != hipSuccess
+           || hipStreamCreateWithFlags(&download, hipStreamNonBlocking) != hipSuccess)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        // a single allocation holds the buffers, pointer arrays and infos of every slot
+        size_t slot_size = align(sizeof(int) * 2 * chunk_size);
+        for(const hipsolver_pipeline_array& a : arrays)
+            slot_size += align(a.stride * chunk_size) + align(sizeof(void*) * chunk_size);
+
+        int depth = std::min(HIPSOLVER_PIPELINE_DEPTH,
+                             (batch_count + chunk_size - 1) / chunk_size);
+        if(hipMalloc(&memory, slot_size * depth) != hipSuccess)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+        slots.resize(depth);
+        std::vector<void*> hptrs(chunk_size);
+        for(int s = 0; s < depth; s++)
+        {
+            slot& sl   = slots[s];
+            char* next = memory + slot_size * s;
+
+            if(hipEventCreateWithFlags(&sl.uploaded, hipEventDisableTiming) != hipSuccess
+               || hipEventCreateWithFlags(&sl.computed, hipEventDisableTiming) != hipSuccess
+               || hipEventCreateWithFlags(&sl.freed, hipEventDisableTiming) != hipSuccess)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+            sl.buffers.info         = (int*)next;
+            sl.buffers.scratch_info = sl.buffers.info + chunk_size;
+            next += align(sizeof(int) * 2 * chunk_size);
+            for(const hipsolver_pipeline_array& a : arrays)
+            {
+                char*  buffer   = next;
+                void** pointers = (void**)(next + align(a.stride * chunk_size));
+                next            = (char*)pointers + align(sizeof(void*) * chunk_size);
+
+                for(int i = 0; i < chunk_size; i++)
+                    hptrs[i] = buffer + a.stride * i;
+                if(hipMemcpy(
+                       pointers, hptrs.data(), sizeof(void*) * chunk_size, hipMemcpyHostToDevice)
+                   != hipSuccess)
+                    return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+                sl.buffers.arrays.push_back(buffer);
+                sl.buffers.pointers.push_back(pointers);
+            }
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipsolverStatus_t run_chunk(slot& sl, size_t first, const solve_function& solve)
+    {
+        chunk& c = sl.buffers;
+        c.count  = (int)std::min<size_t>(chunk_size, batch_count - first);
+
+        // upload, once the previous chunk of the slot has been downloaded
+        if(hipStreamWaitEvent(upload, sl.freed, 0) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        for(size_t k = 0; k < arrays.size(); k++)
+        {
+            const hipsolver_pipeline_array& a = arrays[k];
+            if(a.upload
+               && hipMemcpyAsync(c.arrays[k],
+                                 (char*)a.host + a.stride * first,
+                                 a.stride * c.count,
+                                 hipMemcpyHostToDevice,
+                                 upload)
+                      != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        if(hipEventRecord(sl.uploaded, upload) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        // solve on the stream of the handle
+        if(hipStreamWaitEvent(compute, sl.uploaded, 0) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        hipsolverStatus_t status = solve(c);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        if(hipEventRecord(sl.computed, compute) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        // download
+        if(hipStreamWaitEvent(download, sl.computed, 0) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        for(size_t k = 0; k < arrays.size(); k++)
+        {
+            const hipsolver_pipeline_array& a = arrays[k];
+            if(a.download
+               && hipMemcpyAsync((char*)a.host + a.stride * first,
+                                 c.arrays[k],
+                                 a.stride * c.count,
+                                 hipMemcpyDeviceToHost,
+                                 download)
+                      != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        if(hipMemcpyAsync(
+               info + first, c.info, sizeof(int) * c.count, hipMemcpyDeviceToHost, download)
+               != hipSuccess
+           || hipEventRecord(sl.freed, download) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+public:
+    /*! info is a host array of batch_count infos. batch_count and chunk_size
+     *  must be positive.
+     */
+    hipsolver_pipeline(hipStream_t                           compute,
+                       std::vector<hipsolver_pipeline_array> arrays,
+                       int*                                  info,
+                       int                                   batch_count,
+                       int                                   chunk_size)
+        : arrays(std::move(arrays))
+        , info(info)
+        , batch_count(batch_count)
+        , chunk_size(std::min(chunk_size, batch_count))
+        , compute(compute)
+    {
+    }
+
+    ~hipsolver_pipeline()
+    {
+        if(upload)
+            hipStreamSynchronize(upload);
+        if(download)
+            hipStreamSynchronize(download);
+        for(slot& sl : slots)
+        {
+            if(sl.uploaded)
+                hipEventDestroy(sl.uploaded);
+            if(sl.computed)
+                hipEventDestroy(sl.computed);
+            if(sl.freed)
+                hipEventDestroy(sl.freed);
+        }
+        if(upload)
+            hipStreamDestroy(upload);
+        if(download)
+            hipStreamDestroy(download);
+
+        // hipFree waits for the kernels that may still use the buffers
+        hipFree(memory);
+    }
+
+    /*! Runs solve on every chunk, and returns once the results of all chunks
+     *  have been downloaded.
+     */
+    hipsolverStatus_t run(const solve_function& solve)
+    {
+        hipsolverStatus_t status = init();
+        for(size_t first = 0, c = 0;
+            status == HIPSOLVER_STATUS_SUCCESS && first < size_t(batch_count);
+            first += chunk_size, c++)
+            status = run_chunk(slots[c % slots.size()], first, solve);
+
+        if(status == HIPSOLVER_STATUS_SUCCESS && hipStreamSynchronize(download) != hipSuccess)
+            status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return status;
+    }
+};
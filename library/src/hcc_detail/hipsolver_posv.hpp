@@ -0,0 +1,373 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Combined Cholesky factorization and solve (posv) on the rocSOLVER
+ *  side.
+ *
+ *  posv factorizes A with potrf and solves with the factor with potrs, in a
+ *  single call. The arguments of both steps are checked before A is
+ *  overwritten, and a single workspace query covers both steps: as they run one
+ *  after the other, the workspace is the larger of their workspaces. The
+ *  single-matrix function follows the layout of the handle; the batched
+ *  functions take column-major matrices.
+ *
+ *  As in LAPACK, the solve is skipped for the problems whose info is not zero,
+ *  so their B is not modified. The infos are read back once the factorization
+ *  is done, which synchronizes the stream of the handle. When some problems of a
+ *  batch failed, the solve runs as a batched solve on pointers to the others.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_layout.hpp"
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <algorithm>
+#include <vector>
+
+/******************** HELPERS ********************/
+inline rocblas_status hipsolver_posv_argCheck(rocblas_handle handle,
+                                              rocblas_fill   uplo,
+                                              rocblas_int    n,
+                                              rocblas_int    nrhs,
+                                              const void*    A,
+                                              rocblas_int    lda,
+                                              const void*    B,
+                                              rocblas_int    ldb,
+                                              rocblas_int    ldb_min,
+                                              rocblas_int*   info,
+                                              rocblas_int    batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || nrhs < 0 || lda < n || lda < 1 || ldb < ldb_min || ldb < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((n && batch_count && !A) || (n && nrhs && batch_count && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+// Reads back the infos of the factorization, and lists the problems that were factorized
+inline rocblas_status hipsolver_posv_factorized(rocblas_handle            handle,
+                                                const rocblas_int*        info,
+                                                rocblas_int               batch_count,
+                                                std::vector<rocblas_int>& factorized)
+{
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    std::vector<rocblas_int> hinfo(batch_count);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hinfo.data(), info, sizeof(rocblas_int) * batch_count, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    factorized.clear();
+    for(rocblas_int b = 0; b < batch_count; b++)
+        if(hinfo[b] == 0)
+            factorized.push_back(b);
+    return rocblas_status_success;
+}
+
+// Solves the factorized problems of a batch, given the pointers to all the problems on the host
+template <typename T>
+rocblas_status hipsolver_posv_solve_factorized(rocblas_handle                  handle,
+                                               rocblas_fill                    uplo,
+                                               rocblas_int                     n,
+                                               rocblas_int                     nrhs,
+                                               const std::vector<T*>&          hA,
+                                               rocblas_int                     lda,
+                                               const std::vector<T*>&          hB,
+                                               rocblas_int                     ldb,
+                                               const std::vector<rocblas_int>& factorized,
+                                               rocblas_int                     batch_count)
+{
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    rocblas_device_malloc mem(handle, sizeof(T*) * 2 * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    // pointers to A, then to B, of the factorized problems. Transfers from pageable memory
+    // are staged before hipMemcpyAsync returns, so hptrs may be released after the call
+    const rocblas_int count = factorized.size();
+    std::vector<T*>   hptrs(2 * count);
+    for(rocblas_int i = 0; i < count; i++)
+    {
+        hptrs[i]         = hA[factorized[i]];
+        hptrs[count + i] = hB[factorized[i]];
+    }
+
+    T** ptrs = (T**)mem[0];
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        ptrs, hptrs.data(), sizeof(T*) * 2 * count, hipMemcpyHostToDevice, stream));
+
+    return xpotrs_batched(handle, uplo, n, nrhs, ptrs, lda, ptrs + count, ldb, count);
+}
+
+/******************** POSV ********************/
+template <typename T>
+rocblas_status hipsolver_posv_bufferSize(rocblas_handle handle,
+                                         rocblas_fill   uplo,
+                                         rocblas_int    n,
+                                         rocblas_int    nrhs,
+                                         rocblas_int    lda,
+                                         rocblas_int    ldb,
+                                         size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0)
+        return rocblas_status_success;
+
+    size_t sz, size_potrs = 0;
+
+    // on a row-major handle, the solve is done with two triangular solves
+    const bool row_major = hipsolver_is_row_major(handle);
+    if(row_major)
+    {
+        uplo = hipsolver_transpose_fill(uplo);
+        hipsolver_potrs_row_major_bufferSize<T>(handle, uplo, n, nrhs, &size_potrs);
+    }
+
+    rocblas_start_device_memory_size_query(handle);
+    xpotrf_strided_batched(handle, uplo, n, (T*)nullptr, lda, rocblas_stride(lda) * n, nullptr, 1);
+    if(!row_major)
+        xpotrs_strided_batched(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (T*)nullptr,
+                               lda,
+                               rocblas_stride(lda) * n,
+                               (T*)nullptr,
+                               ldb,
+                               rocblas_stride(ldb) * nrhs,
+                               1);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = std::max(sz, size_potrs);
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_posv(rocblas_handle handle,
+                              rocblas_fill   uplo,
+                              rocblas_int    n,
+                              rocblas_int    nrhs,
+                              T*             A,
+                              rocblas_int    lda,
+                              T*             B,
+                              rocblas_int    ldb,
+                              rocblas_int*   info)
+{
+    const bool     row_major = handle && hipsolver_is_row_major(handle);
+    rocblas_status st        = hipsolver_posv_argCheck(
+        handle, uplo, n, nrhs, A, lda, B, ldb, row_major ? nrhs : n, info, 1);
+    if(st != rocblas_status_continue)
+        return st;
+
+    if(row_major)
+        uplo = hipsolver_transpose_fill(uplo);
+
+    RETURN_IF_ROCBLAS_ERROR(
+        xpotrf_strided_batched(handle, uplo, n, A, lda, rocblas_stride(lda) * n, info, 1));
+
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    std::vector<rocblas_int> factorized;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_posv_factorized(handle, info, 1, factorized));
+    if(factorized.empty())
+        return rocblas_status_success;
+
+    if(row_major)
+        return hipsolver_potrs_row_major(handle, uplo, n, nrhs, A, lda, B, ldb);
+
+    return xpotrs_strided_batched(handle,
+                                  uplo,
+                                  n,
+                                  nrhs,
+                                  A,
+                                  lda,
+                                  rocblas_stride(lda) * n,
+                                  B,
+                                  ldb,
+                                  rocblas_stride(ldb) * nrhs,
+                                  1);
+}
+
+/******************** POSV_BATCHED ********************/
+template <typename T>
+rocblas_status hipsolver_posv_batched_bufferSize(rocblas_handle handle,
+                                                 rocblas_fill   uplo,
+                                                 rocblas_int    n,
+                                                 rocblas_int    nrhs,
+                                                 rocblas_int    lda,
+                                                 rocblas_int    ldb,
+                                                 rocblas_int    batch_count,
+                                                 size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xpotrf_batched(handle, uplo, n, (T* const*)nullptr, lda, nullptr, batch_count);
+    xpotrs_batched(
+        handle, uplo, n, nrhs, (T* const*)nullptr, lda, (T* const*)nullptr, ldb, batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // pointers to the factorized problems, when some of them failed
+    size_t size_ptr = sizeof(T*) * 2 * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_ptr);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_posv_batched(rocblas_handle handle,
+                                      rocblas_fill   uplo,
+                                      rocblas_int    n,
+                                      rocblas_int    nrhs,
+                                      T* const       A[],
+                                      rocblas_int    lda,
+                                      T* const       B[],
+                                      rocblas_int    ldb,
+                                      rocblas_int*   info,
+                                      rocblas_int    batch_count)
+{
+    rocblas_status st
+        = hipsolver_posv_argCheck(handle, uplo, n, nrhs, A, lda, B, ldb, n, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    RETURN_IF_ROCBLAS_ERROR(xpotrf_batched(handle, uplo, n, A, lda, info, batch_count));
+
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    std::vector<rocblas_int> factorized;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_posv_factorized(handle, info, batch_count, factorized));
+    if(factorized.empty())
+        return rocblas_status_success;
+    if(factorized.size() == size_t(batch_count))
+        return xpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    std::vector<T*> hA(batch_count), hB(batch_count);
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hA.data(), A, sizeof(T*) * batch_count, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hB.data(), B, sizeof(T*) * batch_count, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return hipsolver_posv_solve_factorized(
+        handle, uplo, n, nrhs, hA, lda, hB, ldb, factorized, batch_count);
+}
+
+/******************** POSV_STRIDED_BATCHED ********************/
+template <typename T>
+rocblas_status hipsolver_posv_strided_batched_bufferSize(rocblas_handle handle,
+                                                         rocblas_fill   uplo,
+                                                         rocblas_int    n,
+                                                         rocblas_int    nrhs,
+                                                         rocblas_int    lda,
+                                                         rocblas_stride strideA,
+                                                         rocblas_int    ldb,
+                                                         rocblas_stride strideB,
+                                                         rocblas_int    batch_count,
+                                                         size_t*        lwork)
+{
+    *lwork = 0;
+    if(n <= 0 || batch_count <= 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xpotrf_strided_batched(handle, uplo, n, (T*)nullptr, lda, strideA, nullptr, batch_count);
+    xpotrs_strided_batched(handle,
+                           uplo,
+                           n,
+                           nrhs,
+                           (T*)nullptr,
+                           lda,
+                           strideA,
+                           (T*)nullptr,
+                           ldb,
+                           strideB,
+                           batch_count);
+    xpotrs_batched(
+        handle, uplo, n, nrhs, (T* const*)nullptr, lda, (T* const*)nullptr, ldb, batch_count);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // pointers to the factorized problems, when some of them failed
+    size_t size_ptr = sizeof(T*) * 2 * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_ptr);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_posv_strided_batched(rocblas_handle handle,
+                                              rocblas_fill   uplo,
+                                              rocblas_int    n,
+                                              rocblas_int    nrhs,
+                                              T*             A,
+                                              rocblas_int    lda,
+                                              rocblas_stride strideA,
+                                              T*             B,
+                                              rocblas_int    ldb,
+                                              rocblas_stride strideB,
+                                              rocblas_int*   info,
+                                              rocblas_int    batch_count)
+{
+    rocblas_status st
+        = hipsolver_posv_argCheck(handle, uplo, n, nrhs, A, lda, B, ldb, n, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    RETURN_IF_ROCBLAS_ERROR(
+        xpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count));
+
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    std::vector<rocblas_int> factorized;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_posv_factorized(handle, info, batch_count, factorized));
+    if(factorized.empty())
+        return rocblas_status_success;
+    if(factorized.size() == size_t(batch_count))
+        return xpotrs_strided_batched(
+            handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+
+    std::vector<T*> hA(batch_count), hB(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hA[b] = A + b * strideA;
+        hB[b] = B + b * strideB;
+    }
+
+    return hipsolver_posv_solve_factorized(
+        handle, uplo, n, nrhs, hA, lda, hB, ldb, factorized, batch_count);
+}
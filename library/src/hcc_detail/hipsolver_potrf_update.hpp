@@ -0,0 +1,788 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Rank-k update and downdate of a Cholesky factorization on the
+ *  rocSOLVER side.
+ *
+ *  Both operations modify the triangular factor R (A = R'*R). The factor is
+ *  copied to a workspace as L = R', so that the rows of R are contiguous, and
+ *  copied back to A at the end. Every step works on all the problems of a batch
+ *  at once with strided_batched rocBLAS and rocSOLVER calls, and the scalars of
+ *  each problem stay on the device.
+ *
+ *  The columns v of V are processed one at a time, with sigma = 1 for the
+ *  update and sigma = -1 for the downdate. With p = inv(L)*v,
+ *
+ *      A + sigma*v*v' = L*(I + sigma*p*p')*L',
+ *
+ *  and the Cholesky factor M of I + sigma*p*p' is known in closed form: with
+ *  beta(0) = 1 and beta(j+1)^2 = beta(j)^2 + sigma*|p(j)|^2,
+ *
+ *      M(j,j) = beta(j+1) / beta(j),
+ *      M(i,j) = sigma*p(i)*conj(p(j)) / (beta(j)*beta(j+1))   for i > j.
+ *
+ *  M is the product of the sequence of plane rotations that the LINPACK
+ *  algorithms (xCHUD, xCHDD) apply one row at a time. Column j of the new
+ *  factor L*M is a combination of L(:,j) and of the suffix sum of the columns
+ *  L(:,i)*p(i), i > j, so the whole sequence is applied to all the columns at
+ *  once: the prefix sums beta(j)^2 and the row-wise suffix sums are bidiagonal
+ *  solves, the square roots are 1x1 Cholesky factorizations, the divisions are
+ *  diagonal solves, and the scalings are dgmm. The number of calls is
+ *  proportional to the number of columns of V, and depends neither on n nor on
+ *  the batch size, for O(k*n^2) flops per problem.
+ *
+ *  The downdated matrix is positive definite iff beta(n)^2 = 1 - ||p||^2 > 0
+ *  for every column of V. These values are kept on the diagonal of a k x k
+ *  matrix, whose Cholesky factorization sets info to the first column for
+ *  which the test fails. As the check is only known on the device, the
+ *  problems that fail are still processed to the end, and their factor is
+ *  left undefined.
+ */
+
+#pragma once
+
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <vector>
+
+/******************** HELPERS ********************/
+// Validates the arguments shared by the update and downdate functions. As in rocSOLVER,
+// the pointers are not checked during a workspace size query
+inline rocblas_status hipsolver_potrf_update_argCheck(rocblas_handle handle,
+                                                      rocblas_fill   uplo,
+                                                      rocblas_int    n,
+                                                      rocblas_int    k,
+                                                      const void*    A,
+                                                      rocblas_int    lda,
+                                                      const void*    V,
+                                                      rocblas_int    ldv,
+                                                      rocblas_int*   info,
+                                                      rocblas_int    batch_count = 1)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || k < 0 || lda < n || lda < 1 || ldv < n || ldv < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    if((n && k && batch_count && (!A || !V)) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+// Operation that gives L = R' from the stored triangle of A, and back
+inline rocblas_operation hipsolver_potrf_update_op(rocblas_fill uplo)
+{
+    return uplo == rocblas_fill_upper ? rocblas_operation_conjugate_transpose
+                                      : rocblas_operation_none;
+}
+
+// Copies the factors of a single problem or of a strided batch to the workspace W as
+// L = R'. V is used in place
+template <typename T>
+rocblas_status hipsolver_potrf_update_load(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           T*             A,
+                                           rocblas_int    lda,
+                                           rocblas_stride strideA,
+                                           T*             V,
+                                           rocblas_int    ldv,
+                                           rocblas_stride strideV,
+                                           T*             W,
+                                           rocblas_stride strideW,
+                                           T*             Vw,
+                                           T**            ptrs,
+                                           T*&            Vp,
+                                           rocblas_int&   ldvp,
+                                           rocblas_int    batch_count,
+                                           hipStream_t    stream)
+{
+    const rocblas_operation op   = hipsolver_potrf_update_op(uplo);
+    const T                 one  = T(1);
+    const T                 zero = T(0);
+
+    Vp   = V;
+    ldvp = ldv;
+    return xgeam_strided_batched(handle,
+                                 op,
+                                 op,
+                                 n,
+                                 n,
+                                 &one,
+                                 A,
+                                 lda,
+                                 strideA,
+                                 &zero,
+                                 A,
+                                 lda,
+                                 strideA,
+                                 W,
+                                 n,
+                                 strideW,
+                                 batch_count);
+}
+
+// Copies the factors of a batch given as arrays of pointers to the workspace W as L = R',
+// and V to the workspace Vw, so that the problems can be passed to strided_batched calls.
+// ptrs receives the pointers to the workspaces of each problem
+template <typename T>
+rocblas_status hipsolver_potrf_update_load(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           T* const       A[],
+                                           rocblas_int    lda,
+                                           rocblas_stride strideA,
+                                           T* const       V[],
+                                           rocblas_int    ldv,
+                                           rocblas_stride strideV,
+                                           T*             W,
+                                           rocblas_stride strideW,
+                                           T*             Vw,
+                                           T**            ptrs,
+                                           T*&            Vp,
+                                           rocblas_int&   ldvp,
+                                           rocblas_int    batch_count,
+                                           hipStream_t    stream)
+{
+    const rocblas_operation op   = hipsolver_potrf_update_op(uplo);
+    const rocblas_operation none = rocblas_operation_none;
+    const T                 one  = T(1);
+    const T                 zero = T(0);
+
+    std::vector<T*> hptrs(2 * batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hptrs[b]               = W + b * strideW;
+        hptrs[batch_count + b] = Vw + b * rocblas_stride(n) * k;
+    }
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        ptrs, hptrs.data(), sizeof(T*) * 2 * batch_count, hipMemcpyHostToDevice, stream));
+
+    Vp   = Vw;
+    ldvp = n;
+    RETURN_IF_ROCBLAS_ERROR(
+        xgeam_batched(handle, op, op, n, n, &one, A, lda, &zero, A, lda, ptrs, n, batch_count));
+    return xgeam_batched(
+        handle, none, none, n, k, &one, V, ldv, &zero, V, ldv, ptrs + batch_count, n, batch_count);
+}
+
+// Copies the factor L = R' in the workspace W back to A
+template <typename T>
+rocblas_status hipsolver_potrf_update_store(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            T*             A,
+                                            rocblas_int    lda,
+                                            rocblas_stride strideA,
+                                            T*             W,
+                                            rocblas_stride strideW,
+                                            T**            ptrs,
+                                            rocblas_int    batch_count)
+{
+    const rocblas_operation op   = hipsolver_potrf_update_op(uplo);
+    const T                 one  = T(1);
+    const T                 zero = T(0);
+
+    return xgeam_strided_batched(handle,
+                                 op,
+                                 op,
+                                 n,
+                                 n,
+                                 &one,
+                                 W,
+                                 n,
+                                 strideW,
+                                 &zero,
+                                 W,
+                                 n,
+                                 strideW,
+                                 A,
+                                 lda,
+                                 strideA,
+                                 batch_count);
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_update_store(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            T* const       A[],
+                                            rocblas_int    lda,
+                                            rocblas_stride strideA,
+                                            T*             W,
+                                            rocblas_stride strideW,
+                                            T**            ptrs,
+                                            rocblas_int    batch_count)
+{
+    const rocblas_operation op   = hipsolver_potrf_update_op(uplo);
+    const T                 one  = T(1);
+    const T                 zero = T(0);
+
+    return xgeam_batched(
+        handle, op, op, n, n, &one, ptrs, n, &zero, ptrs, n, A, lda, batch_count);
+}
+
+/******************** POTRF_UPDATE ********************/
+template <typename T>
+rocblas_status hipsolver_potrf_update_bufferSize_template(rocblas_handle handle,
+                                                          rocblas_fill   uplo,
+                                                          rocblas_int    n,
+                                                          rocblas_int    k,
+                                                          rocblas_int    lda,
+                                                          rocblas_int    ldv,
+                                                          rocblas_int    batch_count,
+                                                          bool           batched,
+                                                          bool           downdate,
+                                                          size_t*        lwork)
+{
+    *lwork = 0;
+    size_t sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status st = hipsolver_potrf_update_argCheck(
+        handle, uplo, n, k, nullptr, lda, nullptr, ldv, nullptr, batch_count);
+    if(st == rocblas_status_continue && n > 0 && k > 0 && batch_count > 0)
+    {
+        xtrsm_strided_batched(handle,
+                              rocblas_side_left,
+                              rocblas_fill_lower,
+                              rocblas_operation_none,
+                              rocblas_diagonal_non_unit,
+                              n,
+                              1,
+                              (T*)nullptr,
+                              (T*)nullptr,
+                              n,
+                              rocblas_stride(n) * n,
+                              (T*)nullptr,
+                              n,
+                              n + 1,
+                              batch_count);
+        xpotrf_strided_batched(
+            handle, rocblas_fill_lower, 1, (T*)nullptr, 1, 1, nullptr, (n + 1) * batch_count);
+        if(downdate)
+            xpotrf_strided_batched(
+                handle, rocblas_fill_lower, k, (T*)nullptr, k, k * k, nullptr, batch_count);
+    }
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    if(st != rocblas_status_continue)
+        return st;
+    if(n == 0 || k == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // space for the copy of the factors, the scaled columns and their suffix sums, the
+    // solution p, the values beta, the scalings d and c, the info of the 1x1
+    // factorizations, the bidiagonal matrix, and a device one; for the downdate, also for
+    // the matrix of the values of 1 - ||p||^2; for arrays of pointers, also for the copy
+    // of V and the pointers to both copies
+    size_t size_W    = sizeof(T) * n * n * batch_count;
+    size_t size_Y    = sizeof(T) * n * n * batch_count;
+    size_t size_p    = sizeof(T) * (n + 1) * batch_count;
+    size_t size_beta = sizeof(T) * (n + 1) * batch_count;
+    size_t size_dc   = sizeof(T) * 2 * n * batch_count;
+    size_t size_info = sizeof(rocblas_int) * (n + 1) * batch_count;
+    size_t size_band = sizeof(T) * 2 * (n + 1);
+    size_t size_one  = sizeof(T);
+    size_t size_D    = downdate ? sizeof(T) * k * k * batch_count : 0;
+    size_t size_Vw   = batched ? sizeof(T) * n * k * batch_count : 0;
+    size_t size_ptr  = batched ? sizeof(T*) * 2 * batch_count : 0;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle,
+                                           sz,
+                                           size_W,
+                                           size_Y,
+                                           size_p,
+                                           size_beta,
+                                           size_dc,
+                                           size_info,
+                                           size_band,
+                                           size_one,
+                                           size_D,
+                                           size_Vw,
+                                           size_ptr);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_update_bufferSize(rocblas_handle handle,
+                                                 rocblas_fill   uplo,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 rocblas_int    lda,
+                                                 rocblas_int    ldv,
+                                                 rocblas_int    batch_count,
+                                                 bool           batched,
+                                                 size_t*        lwork)
+{
+    return hipsolver_potrf_update_bufferSize_template<T>(
+        handle, uplo, n, k, lda, ldv, batch_count, batched, false, lwork);
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_downdate_bufferSize(rocblas_handle handle,
+                                                   rocblas_fill   uplo,
+                                                   rocblas_int    n,
+                                                   rocblas_int    k,
+                                                   rocblas_int    lda,
+                                                   rocblas_int    ldv,
+                                                   rocblas_int    batch_count,
+                                                   bool           batched,
+                                                   size_t*        lwork)
+{
+    return hipsolver_potrf_update_bufferSize_template<T>(
+        handle, uplo, n, k, lda, ldv, batch_count, batched, true, lwork);
+}
+
+// Updates (sigma = 1) or downdates (sigma = -1) the factors L = R' held in W (leading
+// dimension n) with the columns of V. For the downdate, the diagonal of D receives the
+// values of 1 - ||p||^2
+template <typename T>
+rocblas_status hipsolver_potrf_update_template(rocblas_handle handle,
+                                               rocblas_int    n,
+                                               rocblas_int    k,
+                                               T*             W,
+                                               rocblas_stride strideW,
+                                               T*             V,
+                                               rocblas_int    ldv,
+                                               rocblas_stride strideV,
+                                               bool           downdate,
+                                               rocblas_int    batch_count,
+                                               T*             Y,
+                                               T*             P,
+                                               T*             beta,
+                                               T*             dc,
+                                               rocblas_int*   iinfo,
+                                               T*             band,
+                                               T*             d_one,
+                                               T*             D)
+{
+    using S = hipsolver_real_t<T>;
+
+    const rocblas_int       ldw     = n;
+    const rocblas_int       ldy     = n * batch_count;
+    const rocblas_stride    strideY = n;
+    const rocblas_stride    strideP = n + 1;
+    const rocblas_stride    strideC = 2 * n;
+    const rocblas_int       nP      = (n + 1) * batch_count;
+    const rocblas_fill      lower   = rocblas_fill_lower;
+    const rocblas_fill      upper   = rocblas_fill_upper;
+    const rocblas_operation none    = rocblas_operation_none;
+    const rocblas_diagonal  unit    = rocblas_diagonal_unit;
+    const rocblas_diagonal  nonunit = rocblas_diagonal_non_unit;
+    const T                 one     = T(1);
+    const T                 sigma   = downdate ? T(-1) : T(1);
+    const S                 s_sigma = downdate ? S(-1) : S(1);
+    const S                 s_zero  = S(0);
+
+    // p(j) is stored after a leading entry that receives beta(0)^2; the scalings d and c
+    // of each problem are stored one after the other. The rows of the scaled columns Y
+    // of all the problems are stacked, so that the suffix sums along the rows of every
+    // problem are a single batch of bidiagonal solves
+    T* p = P + 1;
+    T* d = dc;
+    T* c = dc + n;
+
+    for(rocblas_int l = 0; l < k; l++)
+    {
+        // solve L*p = v
+        RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(
+            handle, n, V + size_t(l) * ldv, 1, strideV, p, 1, strideP, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xtrsm_strided_batched(handle,
+                                                      rocblas_side_left,
+                                                      lower,
+                                                      none,
+                                                      nonunit,
+                                                      n,
+                                                      1,
+                                                      &one,
+                                                      W,
+                                                      ldw,
+                                                      strideW,
+                                                      p,
+                                                      n,
+                                                      strideP,
+                                                      batch_count));
+
+        // beta(j)^2 = 1 + sigma*sum_{i < j} |p(i)|^2: the 1x1 herks give sigma*|p(i)|^2 for
+        // all the entries at once, and the prefix sums solve a unit lower bidiagonal
+        // system with -1 on the subdiagonal
+        RETURN_IF_ROCBLAS_ERROR(xherk_strided_batched(
+            handle, lower, none, 1, 1, &s_sigma, P, 1, 1, &s_zero, beta, 1, 1, nP));
+        RETURN_IF_ROCBLAS_ERROR(
+            xcopy_strided_batched(handle, 1, d_one, 1, 0, beta, 1, strideP, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(
+            handle, lower, none, unit, n + 1, 1, band, 2, 0, beta, 1, strideP, batch_count));
+        if(downdate)
+            RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(handle,
+                                                          1,
+                                                          beta + n,
+                                                          1,
+                                                          strideP,
+                                                          D + size_t(l) * (k + 1),
+                                                          1,
+                                                          rocblas_stride(k) * k,
+                                                          batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xpotrf_strided_batched(handle, lower, 1, beta, 1, 1, iinfo, nP));
+
+        // d(j) = beta(j+1) / beta(j) and c(j) = conj(p(j)) / (beta(j)*beta(j+1)); the
+        // divisions are diagonal solves, and d is real so it is not changed by the
+        // conjugation
+        RETURN_IF_ROCBLAS_ERROR(xcopy_strided_batched(
+            handle, n, beta + 1, 1, strideP, d, 1, strideC, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(
+            xcopy_strided_batched(handle, n, p, 1, strideP, c, 1, strideC, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xlacgv(handle, 2 * n * batch_count, dc, 1));
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(
+            handle, upper, none, nonunit, n, 0, beta, 1, strideP, d, 1, strideC, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(
+            handle, upper, none, nonunit, n, 0, beta, 1, strideP, c, 1, strideC, batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(handle,
+                                                      upper,
+                                                      none,
+                                                      nonunit,
+                                                      n,
+                                                      0,
+                                                      beta + 1,
+                                                      1,
+                                                      strideP,
+                                                      c,
+                                                      1,
+                                                      strideC,
+                                                      batch_count));
+
+        // Y(:,j) = sum_{i >= j} L(:,i)*p(i): the suffix sums along the n*batch_count rows
+        // solve unit upper bidiagonal systems with -1 on the superdiagonal
+        RETURN_IF_ROCBLAS_ERROR(xdgmm_strided_batched(handle,
+                                                      rocblas_side_right,
+                                                      n,
+                                                      n,
+                                                      W,
+                                                      ldw,
+                                                      strideW,
+                                                      p,
+                                                      1,
+                                                      strideP,
+                                                      Y,
+                                                      ldy,
+                                                      strideY,
+                                                      batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xtbsv_strided_batched(
+            handle, upper, none, unit, n, 1, band, 2, 0, Y, ldy, 1, n * batch_count));
+
+        // L(:,j) = d(j)*L(:,j) + sigma*c(j)*Y(:,j+1)
+        RETURN_IF_ROCBLAS_ERROR(xdgmm_strided_batched(handle,
+                                                      rocblas_side_right,
+                                                      n,
+                                                      n,
+                                                      W,
+                                                      ldw,
+                                                      strideW,
+                                                      d,
+                                                      1,
+                                                      strideC,
+                                                      W,
+                                                      ldw,
+                                                      strideW,
+                                                      batch_count));
+        if(n == 1)
+            continue;
+
+        T* Y1 = Y + size_t(ldy);
+        RETURN_IF_ROCBLAS_ERROR(xdgmm_strided_batched(handle,
+                                                      rocblas_side_right,
+                                                      n,
+                                                      n - 1,
+                                                      Y1,
+                                                      ldy,
+                                                      strideY,
+                                                      c,
+                                                      1,
+                                                      strideC,
+                                                      Y1,
+                                                      ldy,
+                                                      strideY,
+                                                      batch_count));
+        RETURN_IF_ROCBLAS_ERROR(xgeam_strided_batched(handle,
+                                                      none,
+                                                      none,
+                                                      n,
+                                                      n - 1,
+                                                      &one,
+                                                      W,
+                                                      ldw,
+                                                      strideW,
+                                                      &sigma,
+                                                      Y1,
+                                                      ldy,
+                                                      strideY,
+                                                      W,
+                                                      ldw,
+                                                      strideW,
+                                                      batch_count));
+    }
+
+    return rocblas_status_success;
+}
+
+/******************** IMPLEMENTATION ********************/
+template <typename T, typename U>
+rocblas_status hipsolver_potrf_update_impl(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           U              A,
+                                           rocblas_int    lda,
+                                           rocblas_stride strideA,
+                                           U              V,
+                                           rocblas_int    ldv,
+                                           rocblas_stride strideV,
+                                           rocblas_int*   info,
+                                           rocblas_int    batch_count,
+                                           bool           batched,
+                                           bool           downdate)
+{
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // only the downdate can fail for a valid Cholesky factor
+    if(batch_count > 0)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+    if(n == 0 || k == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const rocblas_stride strideW = rocblas_stride(n) * n;
+    const rocblas_stride strideD = rocblas_stride(k) * k;
+
+    rocblas_device_malloc mem(handle,
+                              sizeof(T) * strideW * batch_count,
+                              sizeof(T) * strideW * batch_count,
+                              sizeof(T) * (n + 1) * batch_count,
+                              sizeof(T) * (n + 1) * batch_count,
+                              sizeof(T) * 2 * n * batch_count,
+                              sizeof(rocblas_int) * (n + 1) * batch_count,
+                              sizeof(T) * 2 * (n + 1),
+                              sizeof(T),
+                              downdate ? sizeof(T) * strideD * batch_count : 0,
+                              batched ? sizeof(T) * n * k * batch_count : 0,
+                              batched ? sizeof(T*) * 2 * batch_count : 0);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T*           W     = (T*)mem[0];
+    T*           Y     = (T*)mem[1];
+    T*           P     = (T*)mem[2];
+    T*           beta  = (T*)mem[3];
+    T*           dc    = (T*)mem[4];
+    rocblas_int* iinfo = (rocblas_int*)mem[5];
+    T*           band  = (T*)mem[6];
+    T*           d_one = (T*)mem[7];
+    T*           D     = (T*)mem[8];
+    T*           Vw    = (T*)mem[9];
+    T**          ptrs  = (T**)mem[10];
+
+    // band storage of the bidiagonal matrices with -1 off the diagonal; the diagonal is
+    // not referenced. Transfers from pageable memory are staged before hipMemcpyAsync
+    // returns, so the host buffers need not outlive the calls
+    static const T one = T(1);
+    std::vector<T> hband(2 * (n + 1), T(-1));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(d_one, &one, sizeof(T), hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        band, hband.data(), sizeof(T) * hband.size(), hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(P, 0, sizeof(T) * (n + 1) * batch_count, stream));
+    if(downdate)
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(D, 0, sizeof(T) * strideD * batch_count, stream));
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+
+    T*          Vp;
+    rocblas_int ldvp;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_potrf_update_load(handle,
+                                                        uplo,
+                                                        n,
+                                                        k,
+                                                        A,
+                                                        lda,
+                                                        strideA,
+                                                        V,
+                                                        ldv,
+                                                        strideV,
+                                                        W,
+                                                        strideW,
+                                                        Vw,
+                                                        ptrs,
+                                                        Vp,
+                                                        ldvp,
+                                                        batch_count,
+                                                        stream));
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_potrf_update_template(handle,
+                                        n,
+                                        k,
+                                        W,
+                                        strideW,
+                                        Vp,
+                                        ldvp,
+                                        batched ? rocblas_stride(ldvp) * k : strideV,
+                                        downdate,
+                                        batch_count,
+                                        Y,
+                                        P,
+                                        beta,
+                                        dc,
+                                        iinfo,
+                                        band,
+                                        d_one,
+                                        D));
+
+    // info = first column of V for which 1 - ||p||^2 is not positive
+    if(downdate)
+        RETURN_IF_ROCBLAS_ERROR(xpotrf_strided_batched(
+            handle, rocblas_fill_lower, k, D, k, strideD, info, batch_count));
+
+    return hipsolver_potrf_update_store(
+        handle, uplo, n, A, lda, strideA, W, strideW, ptrs, batch_count);
+}
+
+/******************** ENTRY POINTS ********************/
+template <typename T>
+rocblas_status hipsolver_potrf_update(rocblas_handle handle,
+                                      rocblas_fill   uplo,
+                                      rocblas_int    n,
+                                      rocblas_int    k,
+                                      T*             A,
+                                      rocblas_int    lda,
+                                      T*             V,
+                                      rocblas_int    ldv,
+                                      rocblas_int*   info)
+{
+    rocblas_status st = hipsolver_potrf_update_argCheck(handle, uplo, n, k, A, lda, V, ldv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    return hipsolver_potrf_update_impl<T>(
+        handle, uplo, n, k, A, lda, 0, V, ldv, 0, info, 1, false, false);
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_update_batched(rocblas_handle handle,
+                                              rocblas_fill   uplo,
+                                              rocblas_int    n,
+                                              rocblas_int    k,
+                                              T* const       A[],
+                                              rocblas_int    lda,
+                                              T* const       V[],
+                                              rocblas_int    ldv,
+                                              rocblas_int*   info,
+                                              rocblas_int    batch_count)
+{
+    rocblas_status st
+        = hipsolver_potrf_update_argCheck(handle, uplo, n, k, A, lda, V, ldv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    return hipsolver_potrf_update_impl<T>(
+        handle, uplo, n, k, A, lda, 0, V, ldv, 0, info, batch_count, true, false);
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_update_strided_batched(rocblas_handle handle,
+                                                      rocblas_fill   uplo,
+                                                      rocblas_int    n,
+                                                      rocblas_int    k,
+                                                      T*             A,
+                                                      rocblas_int    lda,
+                                                      rocblas_stride strideA,
+                                                      T*             V,
+                                                      rocblas_int    ldv,
+                                                      rocblas_stride strideV,
+                                                      rocblas_int*   info,
+                                                      rocblas_int    batch_count)
+{
+    rocblas_status st
+        = hipsolver_potrf_update_argCheck(handle, uplo, n, k, A, lda, V, ldv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    return hipsolver_potrf_update_impl<T>(
+        handle, uplo, n, k, A, lda, strideA, V, ldv, strideV, info, batch_count, false, false);
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_downdate(rocblas_handle handle,
+                                        rocblas_fill   uplo,
+                                        rocblas_int    n,
+                                        rocblas_int    k,
+                                        T*             A,
+                                        rocblas_int    lda,
+                                        T*             V,
+                                        rocblas_int    ldv,
+                                        rocblas_int*   info)
+{
+    rocblas_status st = hipsolver_potrf_update_argCheck(handle, uplo, n, k, A, lda, V, ldv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    return hipsolver_potrf_update_impl<T>(
+        handle, uplo, n, k, A, lda, 0, V, ldv, 0, info, 1, false, true);
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_downdate_batched(rocblas_handle handle,
+                                                rocblas_fill   uplo,
+                                                rocblas_int    n,
+                                                rocblas_int    k,
+                                                T* const       A[],
+                                                rocblas_int    lda,
+                                                T* const       V[],
+                                                rocblas_int    ldv,
+                                                rocblas_int*   info,
+                                                rocblas_int    batch_count)
+{
+    rocblas_status st
+        = hipsolver_potrf_update_argCheck(handle, uplo, n, k, A, lda, V, ldv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    return hipsolver_potrf_update_impl<T>(
+        handle, uplo, n, k, A, lda, 0, V, ldv, 0, info, batch_count, true, true);
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_downdate_strided_batched(rocblas_handle handle,
+                                                        rocblas_fill   uplo,
+                                                        rocblas_int    n,
+                                                        rocblas_int    k,
+                                                        T*             A,
+                                                        rocblas_int    lda,
+                                                        rocblas_stride strideA,
+                                                        T*             V,
+                                                        rocblas_int    ldv,
+                                                        rocblas_stride strideV,
+                                                        rocblas_int*   info,
+                                                        rocblas_int    batch_count)
+{
+    rocblas_status st
+        = hipsolver_potrf_update_argCheck(handle, uplo, n, k, A, lda, V, ldv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    return hipsolver_potrf_update_impl<T>(
+        handle, uplo, n, k, A, lda, strideA, V, ldv, strideV, info, batch_count, false, true);
+}
@@ -0,0 +1,218 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Tall-skinny QR (TSQR) path used by the gels functions on the
+ *  rocSOLVER side.
+ *
+ *  When m >> n, the least-squares problem is reduced with a two-level tree: the
+ *  row blocks of the augmented matrix [A|B] are copied side by side into the
+ *  workspace and factorized with a single strided_batched geqrf. The leading n
+ *  rows of each factor hold both the R factor of the block of A and the leading
+ *  rows of Q' times the block of B, so no separate ormqr/unmqr is needed and the
+ *  number of launches does not depend on the number of blocks. These rows are
+ *  stacked, and the stacked (much shorter) problem is solved with
+ *  rocsolver_?gels, which also reports a singular R through info without any
+ *  host synchronization. A and B are not modified.
+ *
+ *  The HIPSOLVER_GELS_TSQR environment variable overrides the selection: "on"
+ *  takes the tall-skinny path whenever the shape allows it, and "off" never
+ *  takes it.
+ */
+
+#pragma once
+
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+// Minimum ratio between the number of rows and the number of columns of [A|B]
+// for which the tall-skinny path is selected
+#ifndef HIPSOLVER_TSQR_MIN_ASPECT_RATIO
+#define HIPSOLVER_TSQR_MIN_ASPECT_RATIO 16
+#endif
+
+// Maximum number of columns of [A|B] for which the tall-skinny path is selected
+#ifndef HIPSOLVER_TSQR_MAX_COLS
+#define HIPSOLVER_TSQR_MAX_COLS 128
+#endif
+
+// Minimum number of rows of the row blocks factorized at the first level
+#ifndef HIPSOLVER_TSQR_BLOCK_ROWS
+#define HIPSOLVER_TSQR_BLOCK_ROWS 512
+#endif
+
+/******************** HELPERS ********************/
+// Number of rows of each row block at the first level of the reduction tree
+inline rocblas_int hipsolver_tsqr_block_rows(rocblas_int k)
+{
+    return std::max(HIPSOLVER_TSQR_BLOCK_ROWS, 4 * k);
+}
+
+// Selection forced by HIPSOLVER_GELS_TSQR: 1 for "on", 0 for "off", and -1 otherwise.
+// The variable is read once per process
+inline int hipsolver_tsqr_override()
+{
+    static const int mode = []() {
+        const char* value = std::getenv("HIPSOLVER_GELS_TSQR");
+        if(value && std::strcmp(value, "on") == 0)
+            return 1;
+        if(value && std::strcmp(value, "off") == 0)
+            return 0;
+        return -1;
+    }();
+    return mode;
+}
+
+// Returns true if gels should use the tall-skinny path for the given sizes
+inline bool hipsolver_tsqr_gels_selected(rocblas_int m, rocblas_int n, rocblas_int nrhs)
+{
+    const int mode = hipsolver_tsqr_override();
+    if(mode == 0 || n <= 0 || nrhs <= 0 || n + nrhs > HIPSOLVER_TSQR_MAX_COLS)
+        return false;
+
+    rocblas_int k = n + nrhs;
+    if(m < 2 * hipsolver_tsqr_block_rows(k))
+        return false;
+    return mode == 1 || m / k >= HIPSOLVER_TSQR_MIN_ASPECT_RATIO;
+}
+
+/******************** GELS ********************/
+template <typename T>
+rocblas_status hipsolver_tsqr_gels_bufferSize(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int nrhs, size_t* lwork)
+{
+    const rocblas_int k   = n + nrhs;
+    const rocblas_int mb  = hipsolver_tsqr_block_rows(k);
+    const rocblas_int p   = m / mb;
+    const rocblas_int ldS = p * n + (m - p * mb);
+    size_t            sz;
+
+    rocblas_start_device_memory_size_query(handle);
+    xgeqrf_strided_batched(
+        handle, mb, k, (T*)nullptr, mb, rocblas_stride(mb) * k, (T*)nullptr, k, p);
+    xgels(handle,
+          rocblas_operation_none,
+          ldS,
+          n,
+          nrhs,
+          (T*)nullptr,
+          ldS,
+          (T*)nullptr,
+          ldS,
+          (rocblas_int*)nullptr);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the Householder scalars and the copies of the row blocks of [A|B], and
+    // the stacked problem
+    size_t size_tau = sizeof(T) * p * k;
+    size_t size_C   = sizeof(T) * p * mb * k;
+    size_t size_S   = sizeof(T) * ldS * k;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_tau, size_C, size_S);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_tsqr_gels(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    nrhs,
+                                   T*             A,
+                                   rocblas_int    lda,
+                                   T*             B,
+                                   rocblas_int    ldb,
+                                   T*             X,
+                                   rocblas_int    ldx,
+                                   rocblas_int*   info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(lda < m || ldb < m || ldx < n)
+        return rocblas_status_invalid_size;
+    if(!A || !B || !X || !info)
+        return rocblas_status_invalid_pointer;
+
+    const rocblas_int       k    = n + nrhs;
+    const rocblas_int       mb   = hipsolver_tsqr_block_rows(k);
+    const rocblas_int       p    = m / mb;
+    const rocblas_int       r    = m - p * mb;
+    const rocblas_int       ldS  = p * n + r;
+    const rocblas_stride    strC = rocblas_stride(mb) * k;
+    const rocblas_operation none = rocblas_operation_none;
+
+    rocblas_device_malloc mem(
+        handle, sizeof(T) * p * k, sizeof(T) * p * mb * k, sizeof(T) * ldS * k);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T* tau = (T*)mem[0];
+    T* C   = (T*)mem[1];
+    T* S   = (T*)mem[2];
+    T* SB  = S + size_t(n) * ldS;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    hipsolver_pointer_mode_guard guard(handle, rocblas_pointer_mode_host);
+    const T                      one  = T(1);
+    const T                      zero = T(0);
+
+    // first level: copy the p row blocks of A and B side by side, leaving out the last
+    // r rows, and factorize the blocks of [A|B] at once
+    RETURN_IF_ROCBLAS_ERROR(xgeam_strided_batched(
+        handle, none, none, mb, n, &one, A, lda, mb, &zero, A, lda, mb, C, mb, strC, p));
+    RETURN_IF_ROCBLAS_ERROR(xgeam_strided_batched(handle,
+                                                  none,
+                                                  none,
+                                                  mb,
+                                                  nrhs,
+                                                  &one,
+                                                  B,
+                                                  ldb,
+                                                  mb,
+                                                  &zero,
+                                                  B,
+                                                  ldb,
+                                                  mb,
+                                                  C + size_t(mb) * n,
+                                                  mb,
+                                                  strC,
+                                                  p));
+    RETURN_IF_ROCBLAS_ERROR(xgeqrf_strided_batched(handle, mb, k, C, mb, strC, tau, k, p));
+
+    // stack the leading n rows of the p factors, which hold the triangular factors of A
+    // and the leading rows of the transformed blocks of B, followed by the remaining r
+    // rows of A and B
+    RETURN_IF_ROCBLAS_ERROR(xgeam_strided_batched(
+        handle, none, none, n, k, &one, C, mb, strC, &zero, C, mb, strC, S, ldS, n, p));
+    for(rocblas_int j = 0; j < n - 1; j++)
+        RETURN_IF_HIP_ERROR(hipMemset2DAsync(S + size_t(j) * ldS + j + 1,
+                                             sizeof(T) * n,
+                                             0,
+                                             sizeof(T) * (n - j - 1),
+                                             p,
+                                             stream));
+    if(r > 0)
+    {
+        T* Ar = A + size_t(p) * mb;
+        T* Br = B + size_t(p) * mb;
+        RETURN_IF_ROCBLAS_ERROR(
+            xgeam(handle, none, none, r, n, &one, Ar, lda, &zero, Ar, lda, S + size_t(p) * n, ldS));
+        RETURN_IF_ROCBLAS_ERROR(xgeam(
+            handle, none, none, r, nrhs, &one, Br, ldb, &zero, Br, ldb, SB + size_t(p) * n, ldS));
+    }
+
+    // second level: solve the stacked problem; info is set on the device if R is singular
+    RETURN_IF_ROCBLAS_ERROR(xgels(handle, none, ldS, n, nrhs, S, ldS, SB, ldS, info));
+
+    return xgeam(handle, none, none, n, nrhs, &one, SB, ldS, &zero, SB, ldS, X, ldx);
+}
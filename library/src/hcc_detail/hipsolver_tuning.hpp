@@ -0,0 +1,729 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Shape-aware selection of the SVD and eigensolver methods on the
+ *  rocSOLVER side.
+ *
+ *  On this backend, gesvd and gesvdj are served by rocSOLVER's gesvd, which can
+ *  run out-of-place (the default) or in-place, and syevd/heevd and syevj/heevj
+ *  are served by rocSOLVER's divide-and-conquer syevd/heevd, which can be
+ *  replaced by the QR-iteration syev/heev. The faster method depends on the
+ *  matrix shape, the batch size, the precision and the device.
+ *
+ *  Each handle has a method for each family, which is either forced with
+ *  hipsolverSetSvdAlg/hipsolverSetEigAlg or, in the default AUTO mode, looked up
+ *  in the tuning table of the handle. A tuning table is a text file with one
+ *  entry per line,
+ *
+ *      <family> <precision> <m> <n> <batch_count> <method>
+ *
+ *  where family is gesvd (methods outofplace and inplace) or syevd (methods dc
+ *  and qr, with n = m), and precision is one of s, d, c and z. Text following a
+ *  '#' is ignored. The entry of the same family and precision that is nearest
+ *  to the problem, in the sum of the log2 ratios of m, n and batch_count, is
+ *  used. Such files are written by the hipsolver-tune benchmark.
+ *
+ *  New handles use the table given by the HIPSOLVER_TUNING_FILE environment
+ *  variable, if any, which is read once per process. Without a table, or if no
+ *  entry matches, the default methods are used.
+ *
+ *  The state of each handle is kept in a process-wide registry, which is only
+ *  locked when at least one handle has a tuning table or a forced method.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "rocblas.h"
+#include "rocsolver.h"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class hipsolver_tuning_family
+{
+    gesvd,
+    syevd,
+};
+
+class hipsolver_tuning_table
+{
+    struct entry
+    {
+        hipsolver_tuning_family family;
+        char                    precision;
+        rocblas_int             m;
+        rocblas_int             n;
+        rocblas_int             batch_count;
+        int                     method;
+    };
+
+    std::vector<entry> entries;
+
+    static double distance(rocblas_int a, rocblas_int b)
+    {
+        return std::fabs(std::log2(double(std::max(a, 1))) - std::log2(double(std::max(b, 1))));
+    }
+
+public:
+    /*! Parses the tuning file at path. Returns nullptr if the file cannot be read
+     *  or is malformed.
+     */
+    static std::shared_ptr<const hipsolver_tuning_table> load(const char* path)
+    {
+        std::ifstream file(path);
+        if(!file)
+            return nullptr;
+
+        auto        table = std::make_shared<hipsolver_tuning_table>();
+        std::string line;
+        while(std::getline(file, line))
+        {
+            line = line.substr(0, line.find('#'));
+
+            std::istringstream stream(line);
+            std::string        family, precision, method, extra;
+            entry              e;
+            if(!(stream >> family))
+                continue;
+            if(!(stream >> precision >> e.m >> e.n >> e.batch_count >> method) || stream >> extra)
+                return nullptr;
+
+            if(precision.size() != 1 || std::string("sdcz").find(precision[0]) == std::string::npos)
+                return nullptr;
+            if(e.m < 0 || e.n < 0 || e.batch_count < 1)
+                return nullptr;
+            e.precision = precision[0];
+
+            if(family == "gesvd" && method == "outofplace")
+                e.method = HIPSOLVER_SVD_ALG_OUTOFPLACE;
+            else if(family == "gesvd" && method == "inplace")
+                e.method = HIPSOLVER_SVD_ALG_INPLACE;
+            else if(family == "syevd" && method == "dc")
+                e.method = HIPSOLVER_EIG_ALG_DC;
+            else if(family == "syevd" && method == "qr")
+                e.method = HIPSOLVER_EIG_ALG_QR;
+            else
+                return nullptr;
+            e.family = (family == "gesvd") ? hipsolver_tuning_family::gesvd
+                                           : hipsolver_tuning_family::syevd;
+
+            table->entries.push_back(e);
+        }
+
+        if(file.bad())
+            return nullptr;
+        return table;
+    }
+
+    /*! Returns the method of the nearest entry, or 0 if there is none.
+     */
+    int find(hipsolver_tuning_family family,
+             char                    precision,
+             rocblas_int             m,
+             rocblas_int             n,
+             rocblas_int             batch_count) const
+    {
+        int    method = 0;
+        double best   = 0;
+        for(const entry& e : entries)
+        {
+            if(e.family != family || e.precision != precision)
+                continue;
+
+            double d = distance(e.m, m) + distance(e.n, n) + distance(e.batch_count, batch_count);
+            if(!method || d < best)
+            {
+                method = e.method;
+                best   = d;
+            }
+        }
+        return method;
+    }
+};
+
+class hipsolver_tuning_registry
+{
+    struct state
+    {
+        std::shared_ptr<const hipsolver_tuning_table> table;
+        hipsolverSvdAlg_t                             svd_alg = HIPSOLVER_SVD_ALG_AUTO;
+        hipsolverEigAlg_t                             eig_alg = HIPSOLVER_EIG_ALG_AUTO;
+
+        bool is_default() const
+        {
+            return !table && svd_alg == HIPSOLVER_SVD_ALG_AUTO && eig_alg == HIPSOLVER_EIG_ALG_AUTO;
+        }
+    };
+
+    std::mutex                                mutex;
+    std::unordered_map<rocblas_handle, state> handles;
+    std::atomic<size_t>                       count{0};
+
+    template <typename F>
+    void update(rocblas_handle handle, F f)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        state                       s = handles.count(handle) ? handles[handle] : state();
+        f(s);
+        if(s.is_default())
+            handles.erase(handle);
+        else
+            handles[handle] = s;
+        count = handles.size();
+    }
+
+    template <typename F>
+    int lookup(rocblas_handle handle, F f)
+    {
+        if(count == 0)
+            return 0;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = handles.find(handle);
+        return it != handles.end() ? f(it->second) : 0;
+    }
+
+public:
+    static hipsolver_tuning_registry& instance()
+    {
+        static hipsolver_tuning_registry* registry = new hipsolver_tuning_registry;
+        return *registry;
+    }
+
+    // The table given by HIPSOLVER_TUNING_FILE. A file that cannot be loaded is ignored
+    static std::shared_ptr<const hipsolver_tuning_table> default_table()
+    {
+        static std::shared_ptr<const hipsolver_tuning_table> table = []() {
+            const char* path = std::getenv("HIPSOLVER_TUNING_FILE");
+            return path && *path ? hipsolver_tuning_table::load(path) : nullptr;
+        }();
+        return table;
+    }
+
+    // A new handle is in AUTO mode with the default table, even if its address was used
+    // by a destroyed handle
+    void create(rocblas_handle handle)
+    {
+        auto table = default_table();
+        if(!table && count == 0)
+            return;
+
+        update(handle, [&](state& s) {
+            s       = state();
+            s.table = table;
+        });
+    }
+
+    void destroy(rocblas_handle handle)
+    {
+        if(count == 0)
+            return;
+
+        update(handle, [](state& s) { s = state(); });
+    }
+
+    void set_table(rocblas_handle handle, std::shared_ptr<const hipsolver_tuning_table> table)
+    {
+        update(handle, [&](state& s) { s.table = table; });
+    }
+
+    void set_svd_alg(rocblas_handle handle, hipsolverSvdAlg_t alg)
+    {
+        update(handle, [&](state& s) { s.svd_alg = alg; });
+    }
+
+    void set_eig_alg(rocblas_handle handle, hipsolverEigAlg_t alg)
+    {
+        update(handle, [&](state& s) { s.eig_alg = alg; });
+    }
+
+    hipsolverSvdAlg_t get_svd_alg(rocblas_handle handle)
+    {
+        int alg = lookup(handle, [](const state& s) { return (int)s.svd_alg; });
+        return alg ? (hipsolverSvdAlg_t)alg : HIPSOLVER_SVD_ALG_AUTO;
+    }
+
+    hipsolverEigAlg_t get_eig_alg(rocblas_handle handle)
+    {
+        int alg = lookup(handle, [](const state& s) { return (int)s.eig_alg; });
+        return alg ? (hipsolverEigAlg_t)alg : HIPSOLVER_EIG_ALG_AUTO;
+    }
+
+    /*! Returns the method to use for the given problem: the forced method, if any,
+     *  or else the method of the tuning table. Returns 0 for the default method.
+     */
+    int select(rocblas_handle          handle,
+               hipsolver_tuning_family family,
+               char                    precision,
+               rocblas_int             m,
+               rocblas_int             n,
+               rocblas_int             batch_count)
+    {
+        return lookup(handle, [&](const state& s) {
+            if(family == hipsolver_tuning_family::gesvd && s.svd_alg != HIPSOLVER_SVD_ALG_AUTO)
+                return (int)s.svd_alg;
+            if(family == hipsolver_tuning_family::syevd && s.eig_alg != HIPSOLVER_EIG_ALG_AUTO)
+                return (int)s.eig_alg;
+            return s.table ? s.table->find(family, precision, m, n, batch_count) : 0;
+        });
+    }
+};
+
+/******************** HELPERS ********************/
+inline rocblas_workmode hipsolver_svd_workmode(rocblas_handle   handle,
+                                               char             precision,
+                                               rocblas_int      m,
+                                               rocblas_int      n,
+                                               rocblas_int      batch_count,
+                                               rocblas_workmode fallback)
+{
+    int method = hipsolver_tuning_registry::instance().select(
+        handle, hipsolver_tuning_family::gesvd, precision, m, n, batch_count);
+    if(method == HIPSOLVER_SVD_ALG_OUTOFPLACE)
+        return rocblas_outofplace;
+    if(method == HIPSOLVER_SVD_ALG_INPLACE)
+        return rocblas_inplace;
+    return fallback;
+}
+
+inline bool hipsolver_eig_uses_qr(rocblas_handle handle,
+                                  char           precision,
+                                  rocblas_int    n,
+                                  rocblas_int    batch_count)
+{
+    return hipsolver_tuning_registry::instance().select(
+               handle, hipsolver_tuning_family::syevd, precision, n, n, batch_count)
+           == HIPSOLVER_EIG_ALG_QR;
+}
+
+/******************** GESVD ********************/
+// Same arguments as rocsolver_?gesvd, with fast_alg as the default method
+inline rocblas_status hipsolver_auto_sgesvd(rocblas_handle   handle,
+                                            rocblas_svect    left_svect,
+                                            rocblas_svect    right_svect,
+                                            rocblas_int      m,
+                                            rocblas_int      n,
+                                            float*           A,
+                                            rocblas_int      lda,
+                                            float*           S,
+                                            float*           U,
+                                            rocblas_int      ldu,
+                                            float*           V,
+                                            rocblas_int      ldv,
+                                            float*           E,
+                                            rocblas_workmode fast_alg,
+                                            rocblas_int*     info)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 's', m, n, 1, fast_alg);
+    return rocsolver_sgesvd(
+        handle, left_svect, right_svect, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status hipsolver_auto_dgesvd(rocblas_handle   handle,
+                                            rocblas_svect    left_svect,
+                                            rocblas_svect    right_svect,
+                                            rocblas_int      m,
+                                            rocblas_int      n,
+                                            double*          A,
+                                            rocblas_int      lda,
+                                            double*          S,
+                                            double*          U,
+                                            rocblas_int      ldu,
+                                            double*          V,
+                                            rocblas_int      ldv,
+                                            double*          E,
+                                            rocblas_workmode fast_alg,
+                                            rocblas_int*     info)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 'd', m, n, 1, fast_alg);
+    return rocsolver_dgesvd(
+        handle, left_svect, right_svect, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status hipsolver_auto_cgesvd(rocblas_handle         handle,
+                                            rocblas_svect          left_svect,
+                                            rocblas_svect          right_svect,
+                                            rocblas_int            m,
+                                            rocblas_int            n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int            lda,
+                                            float*                 S,
+                                            rocblas_float_complex* U,
+                                            rocblas_int            ldu,
+                                            rocblas_float_complex* V,
+                                            rocblas_int            ldv,
+                                            float*                 E,
+                                            rocblas_workmode       fast_alg,
+                                            rocblas_int*           info)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 'c', m, n, 1, fast_alg);
+    return rocsolver_cgesvd(
+        handle, left_svect, right_svect, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status hipsolver_auto_zgesvd(rocblas_handle          handle,
+                                            rocblas_svect           left_svect,
+                                            rocblas_svect           right_svect,
+                                            rocblas_int             m,
+                                            rocblas_int             n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int             lda,
+                                            double*                 S,
+                                            rocblas_double_complex* U,
+                                            rocblas_int             ldu,
+                                            rocblas_double_complex* V,
+                                            rocblas_int             ldv,
+                                            double*                 E,
+                                            rocblas_workmode        fast_alg,
+                                            rocblas_int*            info)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 'z', m, n, 1, fast_alg);
+    return rocsolver_zgesvd(
+        handle, left_svect, right_svect, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+/******************** GESVD_STRIDED_BATCHED ********************/
+// Same arguments as rocsolver_?gesvd_strided_batched, with fast_alg as the default method
+inline rocblas_status hipsolver_auto_sgesvd_strided_batched(rocblas_handle   handle,
+                                                            rocblas_svect    left_svect,
+                                                            rocblas_svect    right_svect,
+                                                            rocblas_int      m,
+                                                            rocblas_int      n,
+                                                            float*           A,
+                                                            rocblas_int      lda,
+                                                            rocblas_stride   strideA,
+                                                            float*           S,
+                                                            rocblas_stride   strideS,
+                                                            float*           U,
+                                                            rocblas_int      ldu,
+                                                            rocblas_stride   strideU,
+                                                            float*           V,
+                                                            rocblas_int      ldv,
+                                                            rocblas_stride   strideV,
+                                                            float*           E,
+                                                            rocblas_stride   strideE,
+                                                            rocblas_workmode fast_alg,
+                                                            rocblas_int*     info,
+                                                            rocblas_int      batch_count)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 's', m, n, batch_count, fast_alg);
+    return rocsolver_sgesvd_strided_batched(handle,
+                                            left_svect,
+                                            right_svect,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            S,
+                                            strideS,
+                                            U,
+                                            ldu,
+                                            strideU,
+                                            V,
+                                            ldv,
+                                            strideV,
+                                            E,
+                                            strideE,
+                                            fast_alg,
+                                            info,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_auto_dgesvd_strided_batched(rocblas_handle   handle,
+                                                            rocblas_svect    left_svect,
+                                                            rocblas_svect    right_svect,
+                                                            rocblas_int      m,
+                                                            rocblas_int      n,
+                                                            double*          A,
+                                                            rocblas_int      lda,
+                                                            rocblas_stride   strideA,
+                                                            double*          S,
+                                                            rocblas_stride   strideS,
+                                                            double*          U,
+                                                            rocblas_int      ldu,
+                                                            rocblas_stride   strideU,
+                                                            double*          V,
+                                                            rocblas_int      ldv,
+                                                            rocblas_stride   strideV,
+                                                            double*          E,
+                                                            rocblas_stride   strideE,
+                                                            rocblas_workmode fast_alg,
+                                                            rocblas_int*     info,
+                                                            rocblas_int      batch_count)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 'd', m, n, batch_count, fast_alg);
+    return rocsolver_dgesvd_strided_batched(handle,
+                                            left_svect,
+                                            right_svect,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            S,
+                                            strideS,
+                                            U,
+                                            ldu,
+                                            strideU,
+                                            V,
+                                            ldv,
+                                            strideV,
+                                            E,
+                                            strideE,
+                                            fast_alg,
+                                            info,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_auto_cgesvd_strided_batched(rocblas_handle         handle,
+                                                            rocblas_svect          left_svect,
+                                                            rocblas_svect          right_svect,
+                                                            rocblas_int            m,
+                                                            rocblas_int            n,
+                                                            rocblas_float_complex* A,
+                                                            rocblas_int            lda,
+                                                            rocblas_stride         strideA,
+                                                            float*                 S,
+                                                            rocblas_stride         strideS,
+                                                            rocblas_float_complex* U,
+                                                            rocblas_int            ldu,
+                                                            rocblas_stride         strideU,
+                                                            rocblas_float_complex* V,
+                                                            rocblas_int            ldv,
+                                                            rocblas_stride         strideV,
+                                                            float*                 E,
+                                                            rocblas_stride         strideE,
+                                                            rocblas_workmode       fast_alg,
+                                                            rocblas_int*           info,
+                                                            rocblas_int            batch_count)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 'c', m, n, batch_count, fast_alg);
+    return rocsolver_cgesvd_strided_batched(handle,
+                                            left_svect,
+                                            right_svect,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            S,
+                                            strideS,
+                                            U,
+                                            ldu,
+                                            strideU,
+                                            V,
+                                            ldv,
+                                            strideV,
+                                            E,
+                                            strideE,
+                                            fast_alg,
+                                            info,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_auto_zgesvd_strided_batched(rocblas_handle          handle,
+                                                            rocblas_svect           left_svect,
+                                                            rocblas_svect           right_svect,
+                                                            rocblas_int             m,
+                                                            rocblas_int             n,
+                                                            rocblas_double_complex* A,
+                                                            rocblas_int             lda,
+                                                            rocblas_stride          strideA,
+                                                            double*                 S,
+                                                            rocblas_stride          strideS,
+                                                            rocblas_double_complex* U,
+                                                            rocblas_int             ldu,
+                                                            rocblas_stride          strideU,
+                                                            rocblas_double_complex* V,
+                                                            rocblas_int             ldv,
+                                                            rocblas_stride          strideV,
+                                                            double*                 E,
+                                                            rocblas_stride          strideE,
+                                                            rocblas_workmode        fast_alg,
+                                                            rocblas_int*            info,
+                                                            rocblas_int             batch_count)
+{
+    fast_alg = hipsolver_svd_workmode(handle, 'z', m, n, batch_count, fast_alg);
+    return rocsolver_zgesvd_strided_batched(handle,
+                                            left_svect,
+                                            right_svect,
+                                            m,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            S,
+                                            strideS,
+                                            U,
+                                            ldu,
+                                            strideU,
+                                            V,
+                                            ldv,
+                                            strideV,
+                                            E,
+                                            strideE,
+                                            fast_alg,
+                                            info,
+                                            batch_count);
+}
+
+/******************** SYEVD/HEEVD ********************/
+// Same arguments as rocsolver_?syevd/heevd, which are replaced by ?syev/heev when
+// the QR iteration is selected
+inline rocblas_status hipsolver_auto_ssyevd(rocblas_handle handle,
+                                            rocblas_evect  evect,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            float*         A,
+                                            rocblas_int    lda,
+                                            float*         D,
+                                            float*         E,
+                                            rocblas_int*   info)
+{
+    if(hipsolver_eig_uses_qr(handle, 's', n, 1))
+        return rocsolver_ssyev(handle, evect, uplo, n, A, lda, D, E, info);
+    return rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status hipsolver_auto_dsyevd(rocblas_handle handle,
+                                            rocblas_evect  evect,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            double*        A,
+                                            rocblas_int    lda,
+                                            double*        D,
+                                            double*        E,
+                                            rocblas_int*   info)
+{
+    if(hipsolver_eig_uses_qr(handle, 'd', n, 1))
+        return rocsolver_dsyev(handle, evect, uplo, n, A, lda, D, E, info);
+    return rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status hipsolver_auto_cheevd(rocblas_handle         handle,
+                                            rocblas_evect          evect,
+                                            rocblas_fill           uplo,
+                                            rocblas_int            n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int            lda,
+                                            float*                 D,
+                                            float*                 E,
+                                            rocblas_int*           info)
+{
+    if(hipsolver_eig_uses_qr(handle, 'c', n, 1))
+        return rocsolver_cheev(handle, evect, uplo, n, A, lda, D, E, info);
+    return rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status hipsolver_auto_zheevd(rocblas_handle          handle,
+                                            rocblas_evect           evect,
+                                            rocblas_fill            uplo,
+                                            rocblas_int             n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int             lda,
+                                            double*                 D,
+                                            double*                 E,
+                                            rocblas_int*            info)
+{
+    if(hipsolver_eig_uses_qr(handle, 'z', n, 1))
+        return rocsolver_zheev(handle, evect, uplo, n, A, lda, D, E, info);
+    return rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+/******************** SYEVD/HEEVD_STRIDED_BATCHED ********************/
+// Same arguments as rocsolver_?syevd/heevd_strided_batched, which are replaced by
+// ?syev/heev_strided_batched when the QR iteration is selected
+inline rocblas_status hipsolver_auto_ssyevd_strided_batched(rocblas_handle handle,
+                                                            rocblas_evect  evect,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            float*         A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            float*         D,
+                                                            rocblas_stride strideD,
+                                                            float*         E,
+                                                            rocblas_stride strideE,
+                                                            rocblas_int*   info,
+                                                            rocblas_int    batch_count)
+{
+    if(hipsolver_eig_uses_qr(handle, 's', n, batch_count))
+        return rocsolver_ssyev_strided_batched(
+            handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+    return rocsolver_ssyevd_strided_batched(
+        handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+}
+
+inline rocblas_status hipsolver_auto_dsyevd_strided_batched(rocblas_handle handle,
+                                                            rocblas_evect  evect,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            double*        A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            double*        D,
+                                                            rocblas_stride strideD,
+                                                            double*        E,
+                                                            rocblas_stride strideE,
+                                                            rocblas_int*   info,
+                                                            rocblas_int    batch_count)
+{
+    if(hipsolver_eig_uses_qr(handle, 'd', n, batch_count))
+        return rocsolver_dsyev_strided_batched(
+            handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+    return rocsolver_dsyevd_strided_batched(
+        handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+}
+
+inline rocblas_status hipsolver_auto_cheevd_strided_batched(rocblas_handle         handle,
+                                                            rocblas_evect          evect,
+                                                            rocblas_fill           uplo,
+                                                            rocblas_int            n,
+                                                            rocblas_float_complex* A,
+                                                            rocblas_int            lda,
+                                                            rocblas_stride         strideA,
+                                                            float*                 D,
+                                                            rocblas_stride         strideD,
+                                                            float*                 E,
+                                                            rocblas_stride         strideE,
+                                                            rocblas_int*           info,
+                                                            rocblas_int            batch_count)
+{
+    if(hipsolver_eig_uses_qr(handle, 'c', n, batch_count))
+        return rocsolver_cheev_strided_batched(
+            handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+    return rocsolver_cheevd_strided_batched(
+        handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+}
+
+inline rocblas_status hipsolver_auto_zheevd_strided_batched(rocblas_handle          handle,
+                                                            rocblas_evect           evect,
+                                                            rocblas_fill            uplo,
+                                                            rocblas_int             n,
+                                                            rocblas_double_complex* A,
+                                                            rocblas_int             lda,
+                                                            rocblas_stride          strideA,
+                                                            double*                 D,
+                                                            rocblas_stride          strideD,
+                                                            double*                 E,
+                                                            rocblas_stride          strideE,
+                                                            rocblas_int*            info,
+                                                            rocblas_int             batch_count)
+{
+    if(hipsolver_eig_uses_qr(handle, 'z', n, batch_count))
+        return rocsolver_zheev_strided_batched(
+            handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+    return rocsolver_zheevd_strided_batched(
+        handle, evect, uplo, n, A, lda, strideA, D, strideD, E, strideE, info, batch_count);
+}
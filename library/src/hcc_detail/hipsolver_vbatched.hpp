@@ -0,0 +1,654 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Variable-size batched (vbatched) factorizations and solvers on the
+ *  rocSOLVER side.
+ *
+ *  The batched functions of rocSOLVER require all the problems of a batch to
+ *  share their dimensions. The vbatched functions take instead device arrays
+ *  with the dimensions of each problem. These are read back to the host, and the
+ *  problems are grouped into buckets of identical dimensions (keeping their
+ *  relative order). Every bucket is then processed with a single call to the
+ *  corresponding batched function of rocSOLVER, using an array of pointers
+ *  permuted into bucket order. The workspace of the whole batch is the largest
+ *  workspace required by any bucket, plus the arrays used for the permutation.
+ *
+ *  The per-problem outputs (info, and the pivot indices of getrf or the
+ *  Householder scalars of geqrf) are computed in bucket order and scattered
+ *  back to the user order at the end. The pivot indices and Householder scalars
+ *  of all the problems are stored one after the other: those of problem i start
+ *  at offset min(m_0,n_0) + ... + min(m_{i-1},n_{i-1}).
+ */
+
+#pragma once
+
+#include "hipsolver_xfunctions.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+/******************** HELPERS ********************/
+// Dimensions of the problems of a vbatched call, grouped into buckets of equal dimensions
+struct hipsolver_vbatch
+{
+    rocblas_int              count = 0;
+    std::vector<rocblas_int> m, n, nrhs, lda, ldb;
+
+    // problem indices sorted by bucket, and the first entry of each bucket in order
+    // (with a final entry equal to count)
+    std::vector<rocblas_int> order;
+    std::vector<rocblas_int> start;
+
+    // offset of the pivot indices or Householder scalars of each problem, and their total
+    std::vector<size_t> offset;
+    size_t              total_k = 0;
+
+    rocblas_int buckets() const
+    {
+        return rocblas_int(start.size()) - 1;
+    }
+
+    // a representative problem of bucket b
+    rocblas_int first(rocblas_int b) const
+    {
+        return order[start[b]];
+    }
+
+    rocblas_int size(rocblas_int b) const
+    {
+        return start[b + 1] - start[b];
+    }
+
+    rocblas_int k(rocblas_int i) const
+    {
+        return std::min(m[i], n[i]);
+    }
+};
+
+// Copies an array of dimensions to the host, or fills it with a default value
+inline rocblas_status hipsolver_vbatch_dims_to_host(std::vector<rocblas_int>& h_dims,
+                                                    const rocblas_int*        d_dims,
+                                                    rocblas_int               count,
+                                                    rocblas_int               deflt,
+                                                    hipStream_t               stream)
+{
+    if(!d_dims)
+    {
+        h_dims.assign(count, deflt);
+        return rocblas_status_success;
+    }
+
+    h_dims.resize(count);
+    if(count > 0)
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            h_dims.data(), d_dims, sizeof(rocblas_int) * count, hipMemcpyDeviceToHost, stream));
+    return rocblas_status_success;
+}
+
+// Reads the dimensions of the problems and groups them into buckets. A nullptr m means that
+// the matrices are square, and a nullptr nrhs means that there are no right-hand sides
+inline rocblas_status hipsolver_vbatch_load(rocblas_handle     handle,
+                                            hipsolver_vbatch&  vb,
+                                            rocblas_int        batch_count,
+                                            const rocblas_int* m,
+                                            const rocblas_int* n,
+                                            const rocblas_int* lda,
+                                            const rocblas_int* nrhs = nullptr,
+                                            const rocblas_int* ldb  = nullptr)
+{
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    vb.count = batch_count;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_dims_to_host(vb.m, m, batch_count, 0, stream));
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_dims_to_host(vb.n, n, batch_count, 0, stream));
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_dims_to_host(vb.lda, lda, batch_count, 1, stream));
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_dims_to_host(vb.nrhs, nrhs, batch_count, 0, stream));
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_dims_to_host(vb.ldb, ldb, batch_count, 1, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // the defaults that depend on n
+    if(!m)
+        vb.m = vb.n;
+    if(!ldb)
+        for(rocblas_int i = 0; i < batch_count; i++)
+            vb.ldb[i] = std::max(vb.n[i], 1);
+
+    vb.offset.resize(batch_count);
+    vb.total_k = 0;
+    for(rocblas_int i = 0; i < batch_count; i++)
+    {
+        if(vb.m[i] < 0 || vb.n[i] < 0 || vb.nrhs[i] < 0 || vb.lda[i] < vb.m[i] || vb.lda[i] < 1
+           || vb.ldb[i] < vb.n[i] || vb.ldb[i] < 1)
+            return rocblas_status_invalid_size;
+
+        vb.offset[i] = vb.total_k;
+        vb.total_k += vb.k(i);
+    }
+
+    // stable sort of the problems by their dimensions
+    auto key = [&vb](rocblas_int i) {
+        return std::make_tuple(vb.m[i], vb.n[i], vb.nrhs[i], vb.lda[i], vb.ldb[i]);
+    };
+    vb.order.resize(batch_count);
+    for(rocblas_int i = 0; i < batch_count; i++)
+        vb.order[i] = i;
+    std::stable_sort(vb.order.begin(), vb.order.end(), [&key](rocblas_int a, rocblas_int b) {
+        return key(a) < key(b);
+    });
+
+    vb.start.clear();
+    for(rocblas_int j = 0; j < batch_count; j++)
+        if(j == 0 || key(vb.order[j]) != key(vb.order[j - 1]))
+            vb.start.push_back(j);
+    vb.start.push_back(batch_count);
+
+    return rocblas_status_success;
+}
+
+// Uploads an array of device pointers permuted into bucket order
+template <typename T>
+rocblas_status hipsolver_vbatch_permute_pointers(const hipsolver_vbatch& vb,
+                                                 T* const                A[],
+                                                 T**                     dA,
+                                                 hipStream_t             stream)
+{
+    std::vector<T*> h_ptrs;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_pointers_to_host(h_ptrs, A, vb.count));
+
+    std::vector<T*> hA(vb.count);
+    for(rocblas_int j = 0; j < vb.count; j++)
+        hA[j] = h_ptrs[vb.order[j]];
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(dA, hA.data(), sizeof(T*) * vb.count, hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
+// Copies the per-problem outputs computed in bucket order to the user order. With per_k, each
+// problem has min(m,n) entries; otherwise, it has a single entry
+template <typename U>
+rocblas_status hipsolver_vbatch_scatter(
+    const hipsolver_vbatch& vb, bool per_k, const U* src, U* dst, hipStream_t stream)
+{
+    size_t total = per_k ? vb.total_k : vb.count;
+    if(total == 0)
+        return rocblas_status_success;
+
+    std::vector<U> hsrc(total);
+    std::vector<U> hdst(total);
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hsrc.data(), src, sizeof(U) * total, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    size_t pos = 0;
+    for(rocblas_int j = 0; j < vb.count; j++)
+    {
+        rocblas_int i   = vb.order[j];
+        size_t      len = per_k ? vb.k(i) : 1;
+        size_t      off = per_k ? vb.offset[i] : i;
+        std::copy(hsrc.begin() + pos, hsrc.begin() + pos + len, hdst.begin() + off);
+        pos += len;
+    }
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(dst, hdst.data(), sizeof(U) * total, hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
+/******************** GETRF_VBATCHED ********************/
+template <typename T>
+rocblas_status hipsolver_getrf_vbatched_bufferSize(rocblas_handle     handle,
+                                                   const rocblas_int* m,
+                                                   const rocblas_int* n,
+                                                   const rocblas_int* lda,
+                                                   rocblas_int        batch_count,
+                                                   size_t*            lwork)
+{
+    *lwork = 0;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!m || !n || !lda))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_load(handle, vb, batch_count, m, n, lda));
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    // the workspace of the largest bucket, with or without pivoting
+    rocblas_start_device_memory_size_query(handle);
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i = vb.first(b);
+        if(vb.k(i) == 0)
+            continue;
+        xgetrf_batched(handle,
+                       vb.m[i],
+                       vb.n[i],
+                       (T**)nullptr,
+                       vb.lda[i],
+                       (rocblas_int*)nullptr,
+                       vb.k(i),
+                       (rocblas_int*)nullptr,
+                       vb.size(b));
+        xgetrf_npvt_batched(handle,
+                            vb.m[i],
+                            vb.n[i],
+                            (T**)nullptr,
+                            vb.lda[i],
+                            (rocblas_int*)nullptr,
+                            vb.size(b));
+    }
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the permuted pointers, and the info and pivots in bucket order
+    size_t size_ptrs = sizeof(T*) * batch_count;
+    size_t size_info = sizeof(rocblas_int) * batch_count;
+    size_t size_piv  = sizeof(rocblas_int) * vb.total_k;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_ptrs, size_info, size_piv);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_getrf_vbatched(rocblas_handle     handle,
+                                        const rocblas_int* m,
+                                        const rocblas_int* n,
+                                        T* const           A[],
+                                        const rocblas_int* lda,
+                                        rocblas_int*       ipiv,
+                                        rocblas_int*       info,
+                                        rocblas_int        batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!m || !n || !lda || !A || !info))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_load(handle, vb, batch_count, m, n, lda));
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    rocblas_device_malloc mem(handle,
+                              sizeof(T*) * batch_count,
+                              sizeof(rocblas_int) * batch_count,
+                              sizeof(rocblas_int) * vb.total_k);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T**          dA    = (T**)mem[0];
+    rocblas_int* tinfo = (rocblas_int*)mem[1];
+    rocblas_int* tpiv  = (rocblas_int*)mem[2];
+
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_permute_pointers(vb, A, dA, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(tinfo, 0, sizeof(rocblas_int) * batch_count, stream));
+
+    size_t pos = 0;
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i  = vb.first(b);
+        rocblas_int s  = vb.start[b];
+        rocblas_int kk = vb.k(i);
+        if(kk == 0)
+            continue;
+
+        if(ipiv)
+            RETURN_IF_ROCBLAS_ERROR(xgetrf_batched(handle,
+                                                   vb.m[i],
+                                                   vb.n[i],
+                                                   dA + s,
+                                                   vb.lda[i],
+                                                   tpiv + pos,
+                                                   kk,
+                                                   tinfo + s,
+                                                   vb.size(b)));
+        else
+            RETURN_IF_ROCBLAS_ERROR(xgetrf_npvt_batched(
+                handle, vb.m[i], vb.n[i], dA + s, vb.lda[i], tinfo + s, vb.size(b)));
+        pos += size_t(kk) * vb.size(b);
+    }
+
+    if(ipiv)
+        RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_scatter(vb, true, tpiv, ipiv, stream));
+    return hipsolver_vbatch_scatter(vb, false, tinfo, info, stream);
+}
+
+/******************** POTRF_VBATCHED ********************/
+template <typename T>
+rocblas_status hipsolver_potrf_vbatched_bufferSize(rocblas_handle     handle,
+                                                   rocblas_fill       uplo,
+                                                   const rocblas_int* n,
+                                                   const rocblas_int* lda,
+                                                   rocblas_int        batch_count,
+                                                   size_t*            lwork)
+{
+    *lwork = 0;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!n || !lda))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_load(handle, vb, batch_count, nullptr, n, lda));
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    // the workspace of the largest bucket
+    rocblas_start_device_memory_size_query(handle);
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i = vb.first(b);
+        if(vb.n[i] == 0)
+            continue;
+        xpotrf_batched(
+            handle, uplo, vb.n[i], (T**)nullptr, vb.lda[i], (rocblas_int*)nullptr, vb.size(b));
+    }
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the permuted pointers and the info in bucket order
+    size_t size_ptrs = sizeof(T*) * batch_count;
+    size_t size_info = sizeof(rocblas_int) * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_ptrs, size_info);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_potrf_vbatched(rocblas_handle     handle,
+                                        rocblas_fill       uplo,
+                                        const rocblas_int* n,
+                                        T* const           A[],
+                                        const rocblas_int* lda,
+                                        rocblas_int*       info,
+                                        rocblas_int        batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!n || !lda || !A || !info))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_load(handle, vb, batch_count, nullptr, n, lda));
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    rocblas_device_malloc mem(
+        handle, sizeof(T*) * batch_count, sizeof(rocblas_int) * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T**          dA    = (T**)mem[0];
+    rocblas_int* tinfo = (rocblas_int*)mem[1];
+
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_permute_pointers(vb, A, dA, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(tinfo, 0, sizeof(rocblas_int) * batch_count, stream));
+
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i = vb.first(b);
+        rocblas_int s = vb.start[b];
+        if(vb.n[i] == 0)
+            continue;
+        RETURN_IF_ROCBLAS_ERROR(
+            xpotrf_batched(handle, uplo, vb.n[i], dA + s, vb.lda[i], tinfo + s, vb.size(b)));
+    }
+
+    return hipsolver_vbatch_scatter(vb, false, tinfo, info, stream);
+}
+
+/******************** POTRS_VBATCHED ********************/
+template <typename T>
+rocblas_status hipsolver_potrs_vbatched_bufferSize(rocblas_handle     handle,
+                                                   rocblas_fill       uplo,
+                                                   const rocblas_int* n,
+                                                   const rocblas_int* nrhs,
+                                                   const rocblas_int* lda,
+                                                   const rocblas_int* ldb,
+                                                   rocblas_int        batch_count,
+                                                   size_t*            lwork)
+{
+    *lwork = 0;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!n || !nrhs || !lda || !ldb))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_vbatch_load(handle, vb, batch_count, nullptr, n, lda, nrhs, ldb));
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    // the workspace of the largest bucket
+    rocblas_start_device_memory_size_query(handle);
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i = vb.first(b);
+        if(vb.n[i] == 0 || vb.nrhs[i] == 0)
+            continue;
+        xpotrs_batched(handle,
+                       uplo,
+                       vb.n[i],
+                       vb.nrhs[i],
+                       (T**)nullptr,
+                       vb.lda[i],
+                       (T**)nullptr,
+                       vb.ldb[i],
+                       vb.size(b));
+    }
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the permuted pointers to A and B
+    size_t size_ptrs = sizeof(T*) * batch_count;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_ptrs, size_ptrs);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_potrs_vbatched(rocblas_handle     handle,
+                                        rocblas_fill       uplo,
+                                        const rocblas_int* n,
+                                        const rocblas_int* nrhs,
+                                        T* const           A[],
+                                        const rocblas_int* lda,
+                                        T* const           B[],
+                                        const rocblas_int* ldb,
+                                        rocblas_int*       info,
+                                        rocblas_int        batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!n || !nrhs || !lda || !ldb || !A || !B))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(
+        hipsolver_vbatch_load(handle, vb, batch_count, nullptr, n, lda, nrhs, ldb));
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // the solve cannot fail once the arguments are valid
+    if(info)
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+
+    rocblas_device_malloc mem(handle, sizeof(T*) * batch_count, sizeof(T*) * batch_count);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T** dA = (T**)mem[0];
+    T** dB = (T**)mem[1];
+
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_permute_pointers(vb, A, dA, stream));
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_permute_pointers(vb, B, dB, stream));
+
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i = vb.first(b);
+        rocblas_int s = vb.start[b];
+        if(vb.n[i] == 0 || vb.nrhs[i] == 0)
+            continue;
+        RETURN_IF_ROCBLAS_ERROR(xpotrs_batched(handle,
+                                               uplo,
+                                               vb.n[i],
+                                               vb.nrhs[i],
+                                               dA + s,
+                                               vb.lda[i],
+                                               dB + s,
+                                               vb.ldb[i],
+                                               vb.size(b)));
+    }
+
+    return rocblas_status_success;
+}
+
+/******************** GEQRF_VBATCHED ********************/
+template <typename T>
+rocblas_status hipsolver_geqrf_vbatched_bufferSize(rocblas_handle     handle,
+                                                   const rocblas_int* m,
+                                                   const rocblas_int* n,
+                                                   const rocblas_int* lda,
+                                                   rocblas_int        batch_count,
+                                                   size_t*            lwork)
+{
+    *lwork = 0;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!m || !n || !lda))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_load(handle, vb, batch_count, m, n, lda));
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    size_t sz;
+
+    // the workspace of the largest bucket
+    rocblas_start_device_memory_size_query(handle);
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i = vb.first(b);
+        if(vb.k(i) == 0)
+            continue;
+        xgeqrf_batched(
+            handle, vb.m[i], vb.n[i], (T**)nullptr, vb.lda[i], (T*)nullptr, vb.k(i), vb.size(b));
+    }
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    // space for the permuted pointers and the Householder scalars in bucket order
+    size_t size_ptrs = sizeof(T*) * batch_count;
+    size_t size_tau  = sizeof(T) * vb.total_k;
+
+    // update size
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_set_optimal_device_memory_size(handle, sz, size_ptrs, size_tau);
+    rocblas_stop_device_memory_size_query(handle, &sz);
+
+    *lwork = sz;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_geqrf_vbatched(rocblas_handle     handle,
+                                        const rocblas_int* m,
+                                        const rocblas_int* n,
+                                        T* const           A[],
+                                        const rocblas_int* lda,
+                                        T*                 tau,
+                                        rocblas_int*       info,
+                                        rocblas_int        batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(batch_count && (!m || !n || !lda || !A))
+        return rocblas_status_invalid_pointer;
+
+    hipsolver_vbatch vb;
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_load(handle, vb, batch_count, m, n, lda));
+    if(vb.total_k && !tau)
+        return rocblas_status_invalid_pointer;
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // the factorization cannot fail once the arguments are valid
+    if(info)
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream));
+
+    rocblas_device_malloc mem(handle, sizeof(T*) * batch_count, sizeof(T) * vb.total_k);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    T** dA   = (T**)mem[0];
+    T*  ttau = (T*)mem[1];
+
+    RETURN_IF_ROCBLAS_ERROR(hipsolver_vbatch_permute_pointers(vb, A, dA, stream));
+
+    size_t pos = 0;
+    for(rocblas_int b = 0; b < vb.buckets(); b++)
+    {
+        rocblas_int i  = vb.first(b);
+        rocblas_int s  = vb.start[b];
+        rocblas_int kk = vb.k(i);
+        if(kk == 0)
+            continue;
+        RETURN_IF_ROCBLAS_ERROR(xgeqrf_batched(
+            handle, vb.m[i], vb.n[i], dA + s, vb.lda[i], ttau + pos, kk, vb.size(b)));
+        pos += size_t(kk) * vb.size(b);
+    }
+
+    return hipsolver_vbatch_scatter(vb, true, ttau, tau, stream);
+}
@@ -0,0 +1,2742 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Type-generic overloads of the rocBLAS and rocSOLVER functions used by the
+ *  templated helpers of the rocSOLVER side.
+ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocsolver.h"
+#include <complex>
+#include <vector>
+
+inline rocblas_status xgeqrf(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* tau)
+{
+    return rocsolver_sgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status xgeqrf(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, double* A, rocblas_int lda, double* tau)
+{
+    return rocsolver_dgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status xgeqrf(rocblas_handle         handle,
+                             rocblas_int            m,
+                             rocblas_int            n,
+                             rocblas_float_complex* A,
+                             rocblas_int            lda,
+                             rocblas_float_complex* tau)
+{
+    return rocsolver_cgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status xgeqrf(rocblas_handle          handle,
+                             rocblas_int             m,
+                             rocblas_int             n,
+                             rocblas_double_complex* A,
+                             rocblas_int             lda,
+                             rocblas_double_complex* tau)
+{
+    return rocsolver_zgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status xgeqrf_strided_batched(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             float*         A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             float*         tau,
+                                             rocblas_stride strideP,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_sgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideP, batch_count);
+}
+
+inline rocblas_status xgeqrf_strided_batched(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             double*        A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             double*        tau,
+                                             rocblas_stride strideP,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_dgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideP, batch_count);
+}
+
+inline rocblas_status xgeqrf_strided_batched(rocblas_handle         handle,
+                                             rocblas_int            m,
+                                             rocblas_int            n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int            lda,
+                                             rocblas_stride         strideA,
+                                             rocblas_float_complex* tau,
+                                             rocblas_stride         strideP,
+                                             rocblas_int            batch_count)
+{
+    return rocsolver_cgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideP, batch_count);
+}
+
+inline rocblas_status xgeqrf_strided_batched(rocblas_handle          handle,
+                                             rocblas_int             m,
+                                             rocblas_int             n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int             lda,
+                                             rocblas_stride          strideA,
+                                             rocblas_double_complex* tau,
+                                             rocblas_stride          strideP,
+                                             rocblas_int             batch_count)
+{
+    return rocsolver_zgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideP, batch_count);
+}
+
+inline rocblas_status xlarfg(
+    rocblas_handle handle, rocblas_int n, float* alpha, float* x, rocblas_int incx, float* tau)
+{
+    return rocsolver_slarfg(handle, n, alpha, x, incx, tau);
+}
+
+inline rocblas_status xlarfg(
+    rocblas_handle handle, rocblas_int n, double* alpha, double* x, rocblas_int incx, double* tau)
+{
+    return rocsolver_dlarfg(handle, n, alpha, x, incx, tau);
+}
+
+inline rocblas_status xlarfg(rocblas_handle         handle,
+                             rocblas_int            n,
+                             rocblas_float_complex* alpha,
+                             rocblas_float_complex* x,
+                             rocblas_int            incx,
+                             rocblas_float_complex* tau)
+{
+    return rocsolver_clarfg(handle, n, alpha, x, incx, tau);
+}
+
+inline rocblas_status xlarfg(rocblas_handle          handle,
+                             rocblas_int             n,
+                             rocblas_double_complex* alpha,
+                             rocblas_double_complex* x,
+                             rocblas_int             incx,
+                             rocblas_double_complex* tau)
+{
+    return rocsolver_zlarfg(handle, n, alpha, x, incx, tau);
+}
+
+inline rocblas_status xlarf(rocblas_handle handle,
+                            rocblas_side   side,
+                            rocblas_int    m,
+                            rocblas_int    n,
+                            float*         x,
+                            rocblas_int    incx,
+                            const float*   tau,
+                            float*         A,
+                            rocblas_int    lda)
+{
+    return rocsolver_slarf(handle, side, m, n, x, incx, tau, A, lda);
+}
+
+inline rocblas_status xlarf(rocblas_handle handle,
+                            rocblas_side   side,
+                            rocblas_int    m,
+                            rocblas_int    n,
+                            double*        x,
+                            rocblas_int    incx,
+                            const double*  tau,
+                            double*        A,
+                            rocblas_int    lda)
+{
+    return rocsolver_dlarf(handle, side, m, n, x, incx, tau, A, lda);
+}
+
+inline rocblas_status xlarf(rocblas_handle               handle,
+                            rocblas_side                 side,
+                            rocblas_int                  m,
+                            rocblas_int                  n,
+                            rocblas_float_complex*       x,
+                            rocblas_int                  incx,
+                            const rocblas_float_complex* tau,
+                            rocblas_float_complex*       A,
+                            rocblas_int                  lda)
+{
+    return rocsolver_clarf(handle, side, m, n, x, incx, tau, A, lda);
+}
+
+inline rocblas_status xlarf(rocblas_handle                handle,
+                            rocblas_side                  side,
+                            rocblas_int                   m,
+                            rocblas_int                   n,
+                            rocblas_double_complex*       x,
+                            rocblas_int                   incx,
+                            const rocblas_double_complex* tau,
+                            rocblas_double_complex*       A,
+                            rocblas_int                   lda)
+{
+    return rocsolver_zlarf(handle, side, m, n, x, incx, tau, A, lda);
+}
+
+inline rocblas_status xcopy(rocblas_handle handle,
+                            rocblas_int    n,
+                            const float*   x,
+                            rocblas_int    incx,
+                            float*         y,
+                            rocblas_int    incy)
+{
+    return rocblas_scopy(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status xcopy(rocblas_handle handle,
+                            rocblas_int    n,
+                            const double*  x,
+                            rocblas_int    incx,
+                            double*        y,
+                            rocblas_int    incy)
+{
+    return rocblas_dcopy(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status xcopy(rocblas_handle               handle,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* x,
+                            rocblas_int                  incx,
+                            rocblas_float_complex*       y,
+                            rocblas_int                  incy)
+{
+    return rocblas_ccopy(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status xcopy(rocblas_handle                handle,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* x,
+                            rocblas_int                   incx,
+                            rocblas_double_complex*       y,
+                            rocblas_int                   incy)
+{
+    return rocblas_zcopy(handle, n, x, incx, y, incy);
+}
+
+inline rocblas_status xiamin(
+    rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, rocblas_int* result)
+{
+    return rocblas_isamin(handle, n, x, incx, result);
+}
+
+inline rocblas_status xiamin(
+    rocblas_handle handle, rocblas_int n, const double* x, rocblas_int incx, rocblas_int* result)
+{
+    return rocblas_idamin(handle, n, x, incx, result);
+}
+
+inline rocblas_status xiamin(rocblas_handle               handle,
+                             rocblas_int                  n,
+                             const rocblas_float_complex* x,
+                             rocblas_int                  incx,
+                             rocblas_int*                 result)
+{
+    return rocblas_icamin(handle, n, x, incx, result);
+}
+
+inline rocblas_status xiamin(rocblas_handle                handle,
+                             rocblas_int                   n,
+                             const rocblas_double_complex* x,
+                             rocblas_int                   incx,
+                             rocblas_int*                  result)
+{
+    return rocblas_izamin(handle, n, x, incx, result);
+}
+
+inline rocblas_status xrot(rocblas_handle handle,
+                           rocblas_int    n,
+                           float*         x,
+                           rocblas_int    incx,
+                           float*         y,
+                           rocblas_int    incy,
+                           const float*   c,
+                           const float*   s)
+{
+    return rocblas_srot(handle, n, x, incx, y, incy, c, s);
+}
+
+inline rocblas_status xrot(rocblas_handle handle,
+                           rocblas_int    n,
+                           double*        x,
+                           rocblas_int    incx,
+                           double*        y,
+                           rocblas_int    incy,
+                           const double*  c,
+                           const double*  s)
+{
+    return rocblas_drot(handle, n, x, incx, y, incy, c, s);
+}
+
+inline rocblas_status xrot(rocblas_handle               handle,
+                           rocblas_int                  n,
+                           rocblas_float_complex*       x,
+                           rocblas_int                  incx,
+                           rocblas_float_complex*       y,
+                           rocblas_int                  incy,
+                           const float*                 c,
+                           const rocblas_float_complex* s)
+{
+    return rocblas_crot(handle, n, x, incx, y, incy, c, s);
+}
+
+inline rocblas_status xrot(rocblas_handle                handle,
+                           rocblas_int                   n,
+                           rocblas_double_complex*       x,
+                           rocblas_int                   incx,
+                           rocblas_double_complex*       y,
+                           rocblas_int                   incy,
+                           const double*                 c,
+                           const rocblas_double_complex* s)
+{
+    return rocblas_zrot(handle, n, x, incx, y, incy, c, s);
+}
+
+inline rocblas_status xgeam(rocblas_handle    handle,
+                            rocblas_operation transA,
+                            rocblas_operation transB,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const float*      alpha,
+                            const float*      A,
+                            rocblas_int       lda,
+                            const float*      beta,
+                            const float*      B,
+                            rocblas_int       ldb,
+                            float*            C,
+                            rocblas_int       ldc)
+{
+    return rocblas_sgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+inline rocblas_status xgeam(rocblas_handle    handle,
+                            rocblas_operation transA,
+                            rocblas_operation transB,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const double*     alpha,
+                            const double*     A,
+                            rocblas_int       lda,
+                            const double*     beta,
+                            const double*     B,
+                            rocblas_int       ldb,
+                            double*           C,
+                            rocblas_int       ldc)
+{
+    return rocblas_dgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+inline rocblas_status xgeam(rocblas_handle               handle,
+                            rocblas_operation            transA,
+                            rocblas_operation            transB,
+                            rocblas_int                  m,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* alpha,
+                            const rocblas_float_complex* A,
+                            rocblas_int                  lda,
+                            const rocblas_float_complex* beta,
+                            const rocblas_float_complex* B,
+                            rocblas_int                  ldb,
+                            rocblas_float_complex*       C,
+                            rocblas_int                  ldc)
+{
+    return rocblas_cgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+inline rocblas_status xgeam(rocblas_handle                handle,
+                            rocblas_operation             transA,
+                            rocblas_operation             transB,
+                            rocblas_int                   m,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* alpha,
+                            const rocblas_double_complex* A,
+                            rocblas_int                   lda,
+                            const rocblas_double_complex* beta,
+                            const rocblas_double_complex* B,
+                            rocblas_int                   ldb,
+                            rocblas_double_complex*       C,
+                            rocblas_int                   ldc)
+{
+    return rocblas_zgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+inline rocblas_status xgeam_strided_batched(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_operation transB,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            const float*      beta,
+                                            const float*      B,
+                                            rocblas_int       ldb,
+                                            rocblas_stride    strideB,
+                                            float*            C,
+                                            rocblas_int       ldc,
+                                            rocblas_stride    strideC,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_sgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xgeam_strided_batched(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_operation transB,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            const double*     beta,
+                                            const double*     B,
+                                            rocblas_int       ldb,
+                                            rocblas_stride    strideB,
+                                            double*           C,
+                                            rocblas_int       ldc,
+                                            rocblas_stride    strideC,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_dgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xgeam_strided_batched(rocblas_handle               handle,
+                                            rocblas_operation            transA,
+                                            rocblas_operation            transB,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            rocblas_stride               strideA,
+                                            const rocblas_float_complex* beta,
+                                            const rocblas_float_complex* B,
+                                            rocblas_int                  ldb,
+                                            rocblas_stride               strideB,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc,
+                                            rocblas_stride               strideC,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_cgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xgeam_strided_batched(rocblas_handle                handle,
+                                            rocblas_operation             transA,
+                                            rocblas_operation             transB,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            rocblas_stride                strideA,
+                                            const rocblas_double_complex* beta,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int                   ldb,
+                                            rocblas_stride                strideB,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc,
+                                            rocblas_stride                strideC,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_zgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xtrsv(rocblas_handle    handle,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            const float*      A,
+                            rocblas_int       lda,
+                            float*            x,
+                            rocblas_int       incx)
+{
+    return rocblas_strsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+inline rocblas_status xtrsv(rocblas_handle    handle,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            const double*     A,
+                            rocblas_int       lda,
+                            double*           x,
+                            rocblas_int       incx)
+{
+    return rocblas_dtrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+inline rocblas_status xtrsv(rocblas_handle               handle,
+                            rocblas_fill                 uplo,
+                            rocblas_operation            transA,
+                            rocblas_diagonal             diag,
+                            rocblas_int                  m,
+                            const rocblas_float_complex* A,
+                            rocblas_int                  lda,
+                            rocblas_float_complex*       x,
+                            rocblas_int                  incx)
+{
+    return rocblas_ctrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+inline rocblas_status xtrsv(rocblas_handle                handle,
+                            rocblas_fill                  uplo,
+                            rocblas_operation             transA,
+                            rocblas_diagonal              diag,
+                            rocblas_int                   m,
+                            const rocblas_double_complex* A,
+                            rocblas_int                   lda,
+                            rocblas_double_complex*       x,
+                            rocblas_int                   incx)
+{
+    return rocblas_ztrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+inline rocblas_status xtrsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const float*      alpha,
+                            const float*      A,
+                            rocblas_int       lda,
+                            float*            B,
+                            rocblas_int       ldb)
+{
+    return rocblas_strsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status xtrsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const double*     alpha,
+                            const double*     A,
+                            rocblas_int       lda,
+                            double*           B,
+                            rocblas_int       ldb)
+{
+    return rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status xtrsm(rocblas_handle               handle,
+                            rocblas_side                 side,
+                            rocblas_fill                 uplo,
+                            rocblas_operation            transA,
+                            rocblas_diagonal             diag,
+                            rocblas_int                  m,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* alpha,
+                            const rocblas_float_complex* A,
+                            rocblas_int                  lda,
+                            rocblas_float_complex*       B,
+                            rocblas_int                  ldb)
+{
+    return rocblas_ctrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status xtrsm(rocblas_handle                handle,
+                            rocblas_side                  side,
+                            rocblas_fill                  uplo,
+                            rocblas_operation             transA,
+                            rocblas_diagonal              diag,
+                            rocblas_int                   m,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* alpha,
+                            const rocblas_double_complex* A,
+                            rocblas_int                   lda,
+                            rocblas_double_complex*       B,
+                            rocblas_int                   ldb)
+{
+    return rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+inline rocblas_status xscal(
+    rocblas_handle handle, rocblas_int n, const float* alpha, float* x, rocblas_int incx)
+{
+    return rocblas_sscal(handle, n, alpha, x, incx);
+}
+
+inline rocblas_status xscal(
+    rocblas_handle handle, rocblas_int n, const double* alpha, double* x, rocblas_int incx)
+{
+    return rocblas_dscal(handle, n, alpha, x, incx);
+}
+
+inline rocblas_status xscal(rocblas_handle               handle,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* alpha,
+                            rocblas_float_complex*       x,
+                            rocblas_int                  incx)
+{
+    return rocblas_cscal(handle, n, alpha, x, incx);
+}
+
+inline rocblas_status xscal(rocblas_handle                handle,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* alpha,
+                            rocblas_double_complex*       x,
+                            rocblas_int                   incx)
+{
+    return rocblas_zscal(handle, n, alpha, x, incx);
+}
+
+inline rocblas_status xlacgv(rocblas_handle handle, rocblas_int n, float* x, rocblas_int incx)
+{
+    return rocblas_status_success;
+}
+
+inline rocblas_status xlacgv(rocblas_handle handle, rocblas_int n, double* x, rocblas_int incx)
+{
+    return rocblas_status_success;
+}
+
+inline rocblas_status
+    xlacgv(rocblas_handle handle, rocblas_int n, rocblas_float_complex* x, rocblas_int incx)
+{
+    return rocsolver_clacgv(handle, n, x, incx);
+}
+
+inline rocblas_status
+    xlacgv(rocblas_handle handle, rocblas_int n, rocblas_double_complex* x, rocblas_int incx)
+{
+    return rocsolver_zlacgv(handle, n, x, incx);
+}
+
+inline rocblas_status xcopy_strided_batched(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            float*         y,
+                                            rocblas_int    incy,
+                                            rocblas_stride stridey,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_scopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+inline rocblas_status xcopy_strided_batched(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            double*        y,
+                                            rocblas_int    incy,
+                                            rocblas_stride stridey,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_dcopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+inline rocblas_status xcopy_strided_batched(rocblas_handle               handle,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            rocblas_stride               stridex,
+                                            rocblas_float_complex*       y,
+                                            rocblas_int                  incy,
+                                            rocblas_stride               stridey,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_ccopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+inline rocblas_status xcopy_strided_batched(rocblas_handle                handle,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            rocblas_stride                stridex,
+                                            rocblas_double_complex*       y,
+                                            rocblas_int                   incy,
+                                            rocblas_stride                stridey,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_zcopy_strided_batched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+inline rocblas_status xcopy_batched(rocblas_handle     handle,
+                                    rocblas_int        n,
+                                    const float* const x[],
+                                    rocblas_int        incx,
+                                    float* const       y[],
+                                    rocblas_int        incy,
+                                    rocblas_int        batch_count)
+{
+    return rocblas_scopy_batched(handle, n, x, incx, y, incy, batch_count);
+}
+
+inline rocblas_status xcopy_batched(rocblas_handle      handle,
+                                    rocblas_int         n,
+                                    const double* const x[],
+                                    rocblas_int         incx,
+                                    double* const       y[],
+                                    rocblas_int         incy,
+                                    rocblas_int         batch_count)
+{
+    return rocblas_dcopy_batched(handle, n, x, incx, y, incy, batch_count);
+}
+
+inline rocblas_status xcopy_batched(rocblas_handle                     handle,
+                                    rocblas_int                        n,
+                                    const rocblas_float_complex* const x[],
+                                    rocblas_int                        incx,
+                                    rocblas_float_complex* const       y[],
+                                    rocblas_int                        incy,
+                                    rocblas_int                        batch_count)
+{
+    return rocblas_ccopy_batched(handle, n, x, incx, y, incy, batch_count);
+}
+
+inline rocblas_status xcopy_batched(rocblas_handle                      handle,
+                                    rocblas_int                         n,
+                                    const rocblas_double_complex* const x[],
+                                    rocblas_int                         incx,
+                                    rocblas_double_complex* const       y[],
+                                    rocblas_int                         incy,
+                                    rocblas_int                         batch_count)
+{
+    return rocblas_zcopy_batched(handle, n, x, incx, y, incy, batch_count);
+}
+
+inline rocblas_status xscal_strided_batched(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const float*   alpha,
+                                            float*         x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_sscal_strided_batched(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xscal_strided_batched(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const double*  alpha,
+                                            double*        x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_dscal_strided_batched(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xscal_strided_batched(rocblas_handle               handle,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            rocblas_float_complex*       x,
+                                            rocblas_int                  incx,
+                                            rocblas_stride               stridex,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_cscal_strided_batched(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xscal_strided_batched(rocblas_handle                handle,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            rocblas_double_complex*       x,
+                                            rocblas_int                   incx,
+                                            rocblas_stride                stridex,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_zscal_strided_batched(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xasum_strided_batched(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            rocblas_int    batch_count,
+                                            float*         result)
+{
+    return rocblas_sasum_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status xasum_strided_batched(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            rocblas_int    batch_count,
+                                            double*        result)
+{
+    return rocblas_dasum_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status xiamin_strided_batched(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const float*   x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             rocblas_int    batch_count,
+                                             rocblas_int*   result)
+{
+    return rocblas_isamin_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status xiamin_strided_batched(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const double*  x,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             rocblas_int    batch_count,
+                                             rocblas_int*   result)
+{
+    return rocblas_idamin_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status xiamin_strided_batched(rocblas_handle               handle,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             rocblas_stride               stridex,
+                                             rocblas_int                  batch_count,
+                                             rocblas_int*                 result)
+{
+    return rocblas_icamin_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status xiamin_strided_batched(rocblas_handle                handle,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             rocblas_stride                stridex,
+                                             rocblas_int                   batch_count,
+                                             rocblas_int*                  result)
+{
+    return rocblas_izamin_strided_batched(handle, n, x, incx, stridex, batch_count, result);
+}
+
+inline rocblas_status xrotg_strided_batched(rocblas_handle handle,
+                                            float*         a,
+                                            rocblas_stride stride_a,
+                                            float*         b,
+                                            rocblas_stride stride_b,
+                                            float*         c,
+                                            rocblas_stride stride_c,
+                                            float*         s,
+                                            rocblas_stride stride_s,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_srotg_strided_batched(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+inline rocblas_status xrotg_strided_batched(rocblas_handle handle,
+                                            double*        a,
+                                            rocblas_stride stride_a,
+                                            double*        b,
+                                            rocblas_stride stride_b,
+                                            double*        c,
+                                            rocblas_stride stride_c,
+                                            double*        s,
+                                            rocblas_stride stride_s,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_drotg_strided_batched(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+inline rocblas_status xrotg_strided_batched(rocblas_handle         handle,
+                                            rocblas_float_complex* a,
+                                            rocblas_stride         stride_a,
+                                            rocblas_float_complex* b,
+                                            rocblas_stride         stride_b,
+                                            float*                 c,
+                                            rocblas_stride         stride_c,
+                                            rocblas_float_complex* s,
+                                            rocblas_stride         stride_s,
+                                            rocblas_int            batch_count)
+{
+    return rocblas_crotg_strided_batched(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+inline rocblas_status xrotg_strided_batched(rocblas_handle          handle,
+                                            rocblas_double_complex* a,
+                                            rocblas_stride          stride_a,
+                                            rocblas_double_complex* b,
+                                            rocblas_stride          stride_b,
+                                            double*                 c,
+                                            rocblas_stride          stride_c,
+                                            rocblas_double_complex* s,
+                                            rocblas_stride          stride_s,
+                                            rocblas_int             batch_count)
+{
+    return rocblas_zrotg_strided_batched(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+inline rocblas_status xgemm_strided_batched(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_operation transB,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            const float*      B,
+                                            rocblas_int       ldb,
+                                            rocblas_stride    strideB,
+                                            const float*      beta,
+                                            float*            C,
+                                            rocblas_int       ldc,
+                                            rocblas_stride    strideC,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_sgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xgemm_strided_batched(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_operation transB,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            const double*     B,
+                                            rocblas_int       ldb,
+                                            rocblas_stride    strideB,
+                                            const double*     beta,
+                                            double*           C,
+                                            rocblas_int       ldc,
+                                            rocblas_stride    strideC,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_dgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xgemm_strided_batched(rocblas_handle               handle,
+                                            rocblas_operation            transA,
+                                            rocblas_operation            transB,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            rocblas_int                  k,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            rocblas_stride               strideA,
+                                            const rocblas_float_complex* B,
+                                            rocblas_int                  ldb,
+                                            rocblas_stride               strideB,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc,
+                                            rocblas_stride               strideC,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_cgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xgemm_strided_batched(rocblas_handle                handle,
+                                            rocblas_operation             transA,
+                                            rocblas_operation             transB,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            rocblas_stride                strideA,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int                   ldb,
+                                            rocblas_stride                strideB,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc,
+                                            rocblas_stride                strideC,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_zgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status xtrsm_strided_batched(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            float*            B,
+                                            rocblas_int       ldb,
+                                            rocblas_stride    strideB,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_strsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status xtrsm_strided_batched(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            double*           B,
+                                            rocblas_int       ldb,
+                                            rocblas_stride    strideB,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_dtrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status xtrsm_strided_batched(rocblas_handle               handle,
+                                            rocblas_side                 side,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_diagonal             diag,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            rocblas_stride               strideA,
+                                            rocblas_float_complex*       B,
+                                            rocblas_int                  ldb,
+                                            rocblas_stride               strideB,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_ctrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status xtrsm_strided_batched(rocblas_handle                handle,
+                                            rocblas_side                  side,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
+                                            rocblas_diagonal              diag,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            rocblas_stride                strideA,
+                                            rocblas_double_complex*       B,
+                                            rocblas_int                   ldb,
+                                            rocblas_stride                strideB,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_ztrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status xtbsv_strided_batched(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            float*            x,
+                                            rocblas_int       incx,
+                                            rocblas_stride    stridex,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_stbsv_strided_batched(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xtbsv_strided_batched(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            double*           x,
+                                            rocblas_int       incx,
+                                            rocblas_stride    stridex,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_dtbsv_strided_batched(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xtbsv_strided_batched(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_diagonal             diag,
+                                            rocblas_int                  n,
+                                            rocblas_int                  k,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            rocblas_stride               strideA,
+                                            rocblas_float_complex*       x,
+                                            rocblas_int                  incx,
+                                            rocblas_stride               stridex,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_ctbsv_strided_batched(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xtbsv_strided_batched(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
+                                            rocblas_diagonal              diag,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            rocblas_stride                strideA,
+                                            rocblas_double_complex*       x,
+                                            rocblas_int                   incx,
+                                            rocblas_stride                stridex,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_ztbsv_strided_batched(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xdgmm_strided_batched(rocblas_handle handle,
+                                            rocblas_side   side,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            const float*   A,
+                                            rocblas_int    lda,
+                                            rocblas_stride strideA,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            float*         C,
+                                            rocblas_int    ldc,
+                                            rocblas_stride strideC,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_sdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xdgmm_strided_batched(rocblas_handle handle,
+                                            rocblas_side   side,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            const double*  A,
+                                            rocblas_int    lda,
+                                            rocblas_stride strideA,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            double*        C,
+                                            rocblas_int    ldc,
+                                            rocblas_stride strideC,
+                                            rocblas_int    batch_count)
+{
+    return rocblas_ddgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xdgmm_strided_batched(rocblas_handle               handle,
+                                            rocblas_side                 side,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            rocblas_stride               strideA,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            rocblas_stride               stridex,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc,
+                                            rocblas_stride               strideC,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_cdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xdgmm_strided_batched(rocblas_handle                handle,
+                                            rocblas_side                  side,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            rocblas_stride                strideA,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            rocblas_stride                stridex,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc,
+                                            rocblas_stride                strideC,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_zdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xpotrf_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             float*         A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             rocblas_int*   info,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_spotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+inline rocblas_status xpotrf_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             double*        A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             rocblas_int*   info,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_dpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+inline rocblas_status xpotrf_strided_batched(rocblas_handle         handle,
+                                             rocblas_fill           uplo,
+                                             rocblas_int            n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int            lda,
+                                             rocblas_stride         strideA,
+                                             rocblas_int*           info,
+                                             rocblas_int            batch_count)
+{
+    return rocsolver_cpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+inline rocblas_status xpotrf_strided_batched(rocblas_handle          handle,
+                                             rocblas_fill            uplo,
+                                             rocblas_int             n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int             lda,
+                                             rocblas_stride          strideA,
+                                             rocblas_int*            info,
+                                             rocblas_int             batch_count)
+{
+    return rocsolver_zpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
+}
+
+// the real overloads map to syrk, for which the transpose is the conjugate transpose
+inline rocblas_status xherk_strided_batched(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            const float*      beta,
+                                            float*            C,
+                                            rocblas_int       ldc,
+                                            rocblas_stride    strideC,
+                                            rocblas_int       batch_count)
+{
+    rocblas_operation trans
+        = (transA == rocblas_operation_none ? transA : rocblas_operation_transpose);
+    return rocblas_ssyrk_strided_batched(
+        handle, uplo, trans, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xherk_strided_batched(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            rocblas_stride    strideA,
+                                            const double*     beta,
+                                            double*           C,
+                                            rocblas_int       ldc,
+                                            rocblas_stride    strideC,
+                                            rocblas_int       batch_count)
+{
+    rocblas_operation trans
+        = (transA == rocblas_operation_none ? transA : rocblas_operation_transpose);
+    return rocblas_dsyrk_strided_batched(
+        handle, uplo, trans, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xherk_strided_batched(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_int                  n,
+                                            rocblas_int                  k,
+                                            const float*                 alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            rocblas_stride               strideA,
+                                            const float*                 beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc,
+                                            rocblas_stride               strideC,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_cherk_strided_batched(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xherk_strided_batched(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const double*                 alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            rocblas_stride                strideA,
+                                            const double*                 beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc,
+                                            rocblas_stride                strideC,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_zherk_strided_batched(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status xaxpy(rocblas_handle handle,
+                            rocblas_int    n,
+                            const float*   alpha,
+                            const float*   x,
+                            rocblas_int    incx,
+                            float*         y,
+                            rocblas_int    incy)
+{
+    return rocblas_saxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+inline rocblas_status xaxpy(rocblas_handle handle,
+                            rocblas_int    n,
+                            const double*  alpha,
+                            const double*  x,
+                            rocblas_int    incx,
+                            double*        y,
+                            rocblas_int    incy)
+{
+    return rocblas_daxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+inline rocblas_status xaxpy(rocblas_handle               handle,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* alpha,
+                            const rocblas_float_complex* x,
+                            rocblas_int                  incx,
+                            rocblas_float_complex*       y,
+                            rocblas_int                  incy)
+{
+    return rocblas_caxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+inline rocblas_status xaxpy(rocblas_handle                handle,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* alpha,
+                            const rocblas_double_complex* x,
+                            rocblas_int                   incx,
+                            rocblas_double_complex*       y,
+                            rocblas_int                   incy)
+{
+    return rocblas_zaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+inline rocblas_status xtpsv_strided_batched(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            const float*      AP,
+                                            rocblas_stride    strideA,
+                                            float*            x,
+                                            rocblas_int       incx,
+                                            rocblas_stride    stridex,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_stpsv_strided_batched(
+        handle, uplo, transA, diag, n, AP, strideA, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xtpsv_strided_batched(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       n,
+                                            const double*     AP,
+                                            rocblas_stride    strideA,
+                                            double*           x,
+                                            rocblas_int       incx,
+                                            rocblas_stride    stridex,
+                                            rocblas_int       batch_count)
+{
+    return rocblas_dtpsv_strided_batched(
+        handle, uplo, transA, diag, n, AP, strideA, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xtpsv_strided_batched(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_diagonal             diag,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* AP,
+                                            rocblas_stride               strideA,
+                                            rocblas_float_complex*       x,
+                                            rocblas_int                  incx,
+                                            rocblas_stride               stridex,
+                                            rocblas_int                  batch_count)
+{
+    return rocblas_ctpsv_strided_batched(
+        handle, uplo, transA, diag, n, AP, strideA, x, incx, stridex, batch_count);
+}
+
+inline rocblas_status xtpsv_strided_batched(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
+                                            rocblas_diagonal              diag,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* AP,
+                                            rocblas_stride                strideA,
+                                            rocblas_double_complex*       x,
+                                            rocblas_int                   incx,
+                                            rocblas_stride                stridex,
+                                            rocblas_int                   batch_count)
+{
+    return rocblas_ztpsv_strided_batched(
+        handle, uplo, transA, diag, n, AP, strideA, x, incx, stridex, batch_count);
+}
+
+// the real overloads of the packed hermitian functions map to their symmetric counterparts
+inline rocblas_status xhpr_strided_batched(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const float*   alpha,
+                                           const float*   x,
+                                           rocblas_int    incx,
+                                           rocblas_stride stridex,
+                                           float*         AP,
+                                           rocblas_stride strideA,
+                                           rocblas_int    batch_count)
+{
+    return rocblas_sspr_strided_batched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideA, batch_count);
+}
+
+inline rocblas_status xhpr_strided_batched(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const double*  alpha,
+                                           const double*  x,
+                                           rocblas_int    incx,
+                                           rocblas_stride stridex,
+                                           double*        AP,
+                                           rocblas_stride strideA,
+                                           rocblas_int    batch_count)
+{
+    return rocblas_dspr_strided_batched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideA, batch_count);
+}
+
+inline rocblas_status xhpr_strided_batched(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_int                  n,
+                                           const float*                 alpha,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int                  incx,
+                                           rocblas_stride               stridex,
+                                           rocblas_float_complex*       AP,
+                                           rocblas_stride               strideA,
+                                           rocblas_int                  batch_count)
+{
+    return rocblas_chpr_strided_batched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideA, batch_count);
+}
+
+inline rocblas_status xhpr_strided_batched(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_int                   n,
+                                           const double*                 alpha,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int                   incx,
+                                           rocblas_stride                stridex,
+                                           rocblas_double_complex*       AP,
+                                           rocblas_stride                strideA,
+                                           rocblas_int                   batch_count)
+{
+    return rocblas_zhpr_strided_batched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideA, batch_count);
+}
+
+inline rocblas_status xhpmv(rocblas_handle handle,
+                            rocblas_fill   uplo,
+                            rocblas_int    n,
+                            const float*   alpha,
+                            const float*   AP,
+                            const float*   x,
+                            rocblas_int    incx,
+                            const float*   beta,
+                            float*         y,
+                            rocblas_int    incy)
+{
+    return rocblas_sspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+inline rocblas_status xhpmv(rocblas_handle handle,
+                            rocblas_fill   uplo,
+                            rocblas_int    n,
+                            const double*  alpha,
+                            const double*  AP,
+                            const double*  x,
+                            rocblas_int    incx,
+                            const double*  beta,
+                            double*        y,
+                            rocblas_int    incy)
+{
+    return rocblas_dspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+inline rocblas_status xhpmv(rocblas_handle               handle,
+                            rocblas_fill                 uplo,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* alpha,
+                            const rocblas_float_complex* AP,
+                            const rocblas_float_complex* x,
+                            rocblas_int                  incx,
+                            const rocblas_float_complex* beta,
+                            rocblas_float_complex*       y,
+                            rocblas_int                  incy)
+{
+    return rocblas_chpmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+inline rocblas_status xhpmv(rocblas_handle                handle,
+                            rocblas_fill                  uplo,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* alpha,
+                            const rocblas_double_complex* AP,
+                            const rocblas_double_complex* x,
+                            rocblas_int                   incx,
+                            const rocblas_double_complex* beta,
+                            rocblas_double_complex*       y,
+                            rocblas_int                   incy)
+{
+    return rocblas_zhpmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+inline rocblas_status xhpr2(rocblas_handle handle,
+                            rocblas_fill   uplo,
+                            rocblas_int    n,
+                            const float*   alpha,
+                            const float*   x,
+                            rocblas_int    incx,
+                            const float*   y,
+                            rocblas_int    incy,
+                            float*         AP)
+{
+    return rocblas_sspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+inline rocblas_status xhpr2(rocblas_handle handle,
+                            rocblas_fill   uplo,
+                            rocblas_int    n,
+                            const double*  alpha,
+                            const double*  x,
+                            rocblas_int    incx,
+                            const double*  y,
+                            rocblas_int    incy,
+                            double*        AP)
+{
+    return rocblas_dspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+inline rocblas_status xhpr2(rocblas_handle               handle,
+                            rocblas_fill                 uplo,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* alpha,
+                            const rocblas_float_complex* x,
+                            rocblas_int                  incx,
+                            const rocblas_float_complex* y,
+                            rocblas_int                  incy,
+                            rocblas_float_complex*       AP)
+{
+    return rocblas_chpr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+inline rocblas_status xhpr2(rocblas_handle                handle,
+                            rocblas_fill                  uplo,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* alpha,
+                            const rocblas_double_complex* x,
+                            rocblas_int                   incx,
+                            const rocblas_double_complex* y,
+                            rocblas_int                   incy,
+                            rocblas_double_complex*       AP)
+{
+    return rocblas_zhpr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+inline rocblas_status xdotc(rocblas_handle handle,
+                            rocblas_int    n,
+                            const float*   x,
+                            rocblas_int    incx,
+                            const float*   y,
+                            rocblas_int    incy,
+                            float*         result)
+{
+    return rocblas_sdot(handle, n, x, incx, y, incy, result);
+}
+
+inline rocblas_status xdotc(rocblas_handle handle,
+                            rocblas_int    n,
+                            const double*  x,
+                            rocblas_int    incx,
+                            const double*  y,
+                            rocblas_int    incy,
+                            double*        result)
+{
+    return rocblas_ddot(handle, n, x, incx, y, incy, result);
+}
+
+inline rocblas_status xdotc(rocblas_handle               handle,
+                            rocblas_int                  n,
+                            const rocblas_float_complex* x,
+                            rocblas_int                  incx,
+                            const rocblas_float_complex* y,
+                            rocblas_int                  incy,
+                            rocblas_float_complex*       result)
+{
+    return rocblas_cdotc(handle, n, x, incx, y, incy, result);
+}
+
+inline rocblas_status xdotc(rocblas_handle                handle,
+                            rocblas_int                   n,
+                            const rocblas_double_complex* x,
+                            rocblas_int                   incx,
+                            const rocblas_double_complex* y,
+                            rocblas_int                   incy,
+                            rocblas_double_complex*       result)
+{
+    return rocblas_zdotc(handle, n, x, incx, y, incy, result);
+}
+
+inline rocblas_status xheevd(rocblas_handle handle,
+                             rocblas_evect  evect,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             float*         A,
+                             rocblas_int    lda,
+                             float*         D,
+                             float*         E,
+                             rocblas_int*   info)
+{
+    return rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status xheevd(rocblas_handle handle,
+                             rocblas_evect  evect,
+                             rocblas_fill   uplo,
+                             rocblas_int    n,
+                             double*        A,
+                             rocblas_int    lda,
+                             double*        D,
+                             double*        E,
+                             rocblas_int*   info)
+{
+    return rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status xheevd(rocblas_handle         handle,
+                             rocblas_evect          evect,
+                             rocblas_fill           uplo,
+                             rocblas_int            n,
+                             rocblas_float_complex* A,
+                             rocblas_int            lda,
+                             float*                 D,
+                             float*                 E,
+                             rocblas_int*           info)
+{
+    return rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status xheevd(rocblas_handle          handle,
+                             rocblas_evect           evect,
+                             rocblas_fill            uplo,
+                             rocblas_int             n,
+                             rocblas_double_complex* A,
+                             rocblas_int             lda,
+                             double*                 D,
+                             double*                 E,
+                             rocblas_int*            info)
+{
+    return rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status xsterf(
+    rocblas_handle handle, rocblas_int n, float* D, float* E, rocblas_int* info)
+{
+    return rocsolver_ssterf(handle, n, D, E, info);
+}
+
+inline rocblas_status xsterf(
+    rocblas_handle handle, rocblas_int n, double* D, double* E, rocblas_int* info)
+{
+    return rocsolver_dsterf(handle, n, D, E, info);
+}
+
+inline rocblas_status xgetrf(rocblas_handle handle,
+                             rocblas_int    m,
+                             rocblas_int    n,
+                             float*         A,
+                             rocblas_int    lda,
+                             rocblas_int*   ipiv,
+                             rocblas_int*   info)
+{
+    return rocsolver_sgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status xgetrf(rocblas_handle handle,
+                             rocblas_int    m,
+                             rocblas_int    n,
+                             double*        A,
+                             rocblas_int    lda,
+                             rocblas_int*   ipiv,
+                             rocblas_int*   info)
+{
+    return rocsolver_dgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status xgetrf(rocblas_handle         handle,
+                             rocblas_int            m,
+                             rocblas_int            n,
+                             rocblas_float_complex* A,
+                             rocblas_int            lda,
+                             rocblas_int*           ipiv,
+                             rocblas_int*           info)
+{
+    return rocsolver_cgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status xgetrf(rocblas_handle          handle,
+                             rocblas_int             m,
+                             rocblas_int             n,
+                             rocblas_double_complex* A,
+                             rocblas_int             lda,
+                             rocblas_int*            ipiv,
+                             rocblas_int*            info)
+{
+    return rocsolver_zgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status xgetrs(rocblas_handle     handle,
+                             rocblas_operation  trans,
+                             rocblas_int        n,
+                             rocblas_int        nrhs,
+                             float*             A,
+                             rocblas_int        lda,
+                             const rocblas_int* ipiv,
+                             float*             B,
+                             rocblas_int        ldb)
+{
+    return rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status xgetrs(rocblas_handle     handle,
+                             rocblas_operation  trans,
+                             rocblas_int        n,
+                             rocblas_int        nrhs,
+                             double*            A,
+                             rocblas_int        lda,
+                             const rocblas_int* ipiv,
+                             double*            B,
+                             rocblas_int        ldb)
+{
+    return rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status xgetrs(rocblas_handle         handle,
+                             rocblas_operation      trans,
+                             rocblas_int            n,
+                             rocblas_int            nrhs,
+                             rocblas_float_complex* A,
+                             rocblas_int            lda,
+                             const rocblas_int*     ipiv,
+                             rocblas_float_complex* B,
+                             rocblas_int            ldb)
+{
+    return rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status xgetrs(rocblas_handle          handle,
+                             rocblas_operation       trans,
+                             rocblas_int             n,
+                             rocblas_int             nrhs,
+                             rocblas_double_complex* A,
+                             rocblas_int             lda,
+                             const rocblas_int*      ipiv,
+                             rocblas_double_complex* B,
+                             rocblas_int             ldb)
+{
+    return rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status xgetrf_batched(rocblas_handle handle,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     float* const   A[],
+                                     rocblas_int    lda,
+                                     rocblas_int*   ipiv,
+                                     rocblas_stride strideP,
+                                     rocblas_int*   info,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_sgetrf_batched(handle, m, n, A, lda, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrf_batched(rocblas_handle handle,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     double* const  A[],
+                                     rocblas_int    lda,
+                                     rocblas_int*   ipiv,
+                                     rocblas_stride strideP,
+                                     rocblas_int*   info,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_dgetrf_batched(handle, m, n, A, lda, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrf_batched(rocblas_handle               handle,
+                                     rocblas_int                  m,
+                                     rocblas_int                  n,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int                  lda,
+                                     rocblas_int*                 ipiv,
+                                     rocblas_stride               strideP,
+                                     rocblas_int*                 info,
+                                     rocblas_int                  batch_count)
+{
+    return rocsolver_cgetrf_batched(handle, m, n, A, lda, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrf_batched(rocblas_handle                handle,
+                                     rocblas_int                   m,
+                                     rocblas_int                   n,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int                   lda,
+                                     rocblas_int*                  ipiv,
+                                     rocblas_stride                strideP,
+                                     rocblas_int*                  info,
+                                     rocblas_int                   batch_count)
+{
+    return rocsolver_zgetrf_batched(handle, m, n, A, lda, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrf_npvt_batched(rocblas_handle handle,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          float* const   A[],
+                                          rocblas_int    lda,
+                                          rocblas_int*   info,
+                                          rocblas_int    batch_count)
+{
+    return rocsolver_sgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xgetrf_npvt_batched(rocblas_handle handle,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          double* const  A[],
+                                          rocblas_int    lda,
+                                          rocblas_int*   info,
+                                          rocblas_int    batch_count)
+{
+    return rocsolver_dgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xgetrf_npvt_batched(rocblas_handle               handle,
+                                          rocblas_int                  m,
+                                          rocblas_int                  n,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int                  lda,
+                                          rocblas_int*                 info,
+                                          rocblas_int                  batch_count)
+{
+    return rocsolver_cgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xgetrf_npvt_batched(rocblas_handle                handle,
+                                          rocblas_int                   m,
+                                          rocblas_int                   n,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int                   lda,
+                                          rocblas_int*                  info,
+                                          rocblas_int                   batch_count)
+{
+    return rocsolver_zgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xpotrf_batched(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     float* const   A[],
+                                     rocblas_int    lda,
+                                     rocblas_int*   info,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_spotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xpotrf_batched(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     double* const  A[],
+                                     rocblas_int    lda,
+                                     rocblas_int*   info,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_dpotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xpotrf_batched(rocblas_handle               handle,
+                                     rocblas_fill                 uplo,
+                                     rocblas_int                  n,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int                  lda,
+                                     rocblas_int*                 info,
+                                     rocblas_int                  batch_count)
+{
+    return rocsolver_cpotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xpotrf_batched(rocblas_handle                handle,
+                                     rocblas_fill                  uplo,
+                                     rocblas_int                   n,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int                   lda,
+                                     rocblas_int*                  info,
+                                     rocblas_int                   batch_count)
+{
+    return rocsolver_zpotrf_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+inline rocblas_status xpotrs_batched(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     rocblas_int    nrhs,
+                                     float* const   A[],
+                                     rocblas_int    lda,
+                                     float* const   B[],
+                                     rocblas_int    ldb,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_spotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status xpotrs_batched(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     rocblas_int    nrhs,
+                                     double* const  A[],
+                                     rocblas_int    lda,
+                                     double* const  B[],
+                                     rocblas_int    ldb,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_dpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status xpotrs_batched(rocblas_handle               handle,
+                                     rocblas_fill                 uplo,
+                                     rocblas_int                  n,
+                                     rocblas_int                  nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int                  lda,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int                  ldb,
+                                     rocblas_int                  batch_count)
+{
+    return rocsolver_cpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status xpotrs_batched(rocblas_handle                handle,
+                                     rocblas_fill                  uplo,
+                                     rocblas_int                   n,
+                                     rocblas_int                   nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int                   lda,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int                   ldb,
+                                     rocblas_int                   batch_count)
+{
+    return rocsolver_zpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status xpotrs_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             rocblas_int    nrhs,
+                                             float*         A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             float*         B,
+                                             rocblas_int    ldb,
+                                             rocblas_stride strideB,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_spotrs_strided_batched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xpotrs_strided_batched(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             rocblas_int    nrhs,
+                                             double*        A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             double*        B,
+                                             rocblas_int    ldb,
+                                             rocblas_stride strideB,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_dpotrs_strided_batched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xpotrs_strided_batched(rocblas_handle         handle,
+                                             rocblas_fill           uplo,
+                                             rocblas_int            n,
+                                             rocblas_int            nrhs,
+                                             rocblas_float_complex* A,
+                                             rocblas_int            lda,
+                                             rocblas_stride         strideA,
+                                             rocblas_float_complex* B,
+                                             rocblas_int            ldb,
+                                             rocblas_stride         strideB,
+                                             rocblas_int            batch_count)
+{
+    return rocsolver_cpotrs_strided_batched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xpotrs_strided_batched(rocblas_handle          handle,
+                                             rocblas_fill            uplo,
+                                             rocblas_int             n,
+                                             rocblas_int             nrhs,
+                                             rocblas_double_complex* A,
+                                             rocblas_int             lda,
+                                             rocblas_stride          strideA,
+                                             rocblas_double_complex* B,
+                                             rocblas_int             ldb,
+                                             rocblas_stride          strideB,
+                                             rocblas_int             batch_count)
+{
+    return rocsolver_zpotrs_strided_batched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xgetrf_strided_batched(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             float*         A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             rocblas_int*   ipiv,
+                                             rocblas_stride strideP,
+                                             rocblas_int*   info,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_sgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrf_strided_batched(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             double*        A,
+                                             rocblas_int    lda,
+                                             rocblas_stride strideA,
+                                             rocblas_int*   ipiv,
+                                             rocblas_stride strideP,
+                                             rocblas_int*   info,
+                                             rocblas_int    batch_count)
+{
+    return rocsolver_dgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrf_strided_batched(rocblas_handle         handle,
+                                             rocblas_int            m,
+                                             rocblas_int            n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int            lda,
+                                             rocblas_stride         strideA,
+                                             rocblas_int*           ipiv,
+                                             rocblas_stride         strideP,
+                                             rocblas_int*           info,
+                                             rocblas_int            batch_count)
+{
+    return rocsolver_cgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrf_strided_batched(rocblas_handle          handle,
+                                             rocblas_int             m,
+                                             rocblas_int             n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int             lda,
+                                             rocblas_stride          strideA,
+                                             rocblas_int*            ipiv,
+                                             rocblas_stride          strideP,
+                                             rocblas_int*            info,
+                                             rocblas_int             batch_count)
+{
+    return rocsolver_zgetrf_strided_batched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+inline rocblas_status xgetrs_strided_batched(rocblas_handle     handle,
+                                             rocblas_operation  trans,
+                                             rocblas_int        n,
+                                             rocblas_int        nrhs,
+                                             float*             A,
+                                             rocblas_int        lda,
+                                             rocblas_stride     strideA,
+                                             const rocblas_int* ipiv,
+                                             rocblas_stride     strideP,
+                                             float*             B,
+                                             rocblas_int        ldb,
+                                             rocblas_stride     strideB,
+                                             rocblas_int        batch_count)
+{
+    return rocsolver_sgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xgetrs_strided_batched(rocblas_handle     handle,
+                                             rocblas_operation  trans,
+                                             rocblas_int        n,
+                                             rocblas_int        nrhs,
+                                             double*            A,
+                                             rocblas_int        lda,
+                                             rocblas_stride     strideA,
+                                             const rocblas_int* ipiv,
+                                             rocblas_stride     strideP,
+                                             double*            B,
+                                             rocblas_int        ldb,
+                                             rocblas_stride     strideB,
+                                             rocblas_int        batch_count)
+{
+    return rocsolver_dgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xgetrs_strided_batched(rocblas_handle         handle,
+                                             rocblas_operation      trans,
+                                             rocblas_int            n,
+                                             rocblas_int            nrhs,
+                                             rocblas_float_complex* A,
+                                             rocblas_int            lda,
+                                             rocblas_stride         strideA,
+                                             const rocblas_int*     ipiv,
+                                             rocblas_stride         strideP,
+                                             rocblas_float_complex* B,
+                                             rocblas_int            ldb,
+                                             rocblas_stride         strideB,
+                                             rocblas_int            batch_count)
+{
+    return rocsolver_cgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xgetrs_strided_batched(rocblas_handle          handle,
+                                             rocblas_operation       trans,
+                                             rocblas_int             n,
+                                             rocblas_int             nrhs,
+                                             rocblas_double_complex* A,
+                                             rocblas_int             lda,
+                                             rocblas_stride          strideA,
+                                             const rocblas_int*      ipiv,
+                                             rocblas_stride          strideP,
+                                             rocblas_double_complex* B,
+                                             rocblas_int             ldb,
+                                             rocblas_stride          strideB,
+                                             rocblas_int             batch_count)
+{
+    return rocsolver_zgetrs_strided_batched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+inline rocblas_status xgeqrf_batched(rocblas_handle handle,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     float* const   A[],
+                                     rocblas_int    lda,
+                                     float*         tau,
+                                     rocblas_stride strideT,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_sgeqrf_batched(handle, m, n, A, lda, tau, strideT, batch_count);
+}
+
+inline rocblas_status xgeqrf_batched(rocblas_handle handle,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     double* const  A[],
+                                     rocblas_int    lda,
+                                     double*        tau,
+                                     rocblas_stride strideT,
+                                     rocblas_int    batch_count)
+{
+    return rocsolver_dgeqrf_batched(handle, m, n, A, lda, tau, strideT, batch_count);
+}
+
+inline rocblas_status xgeqrf_batched(rocblas_handle               handle,
+                                     rocblas_int                  m,
+                                     rocblas_int                  n,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int                  lda,
+                                     rocblas_float_complex*       tau,
+                                     rocblas_stride               strideT,
+                                     rocblas_int                  batch_count)
+{
+    return rocsolver_cgeqrf_batched(handle, m, n, A, lda, tau, strideT, batch_count);
+}
+
+inline rocblas_status xgeqrf_batched(rocblas_handle                handle,
+                                     rocblas_int                   m,
+                                     rocblas_int                   n,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int                   lda,
+                                     rocblas_double_complex*       tau,
+                                     rocblas_stride                strideT,
+                                     rocblas_int                   batch_count)
+{
+    return rocsolver_zgeqrf_batched(handle, m, n, A, lda, tau, strideT, batch_count);
+}
+
+inline rocblas_status xormqr(rocblas_handle    handle,
+                             rocblas_side      side,
+                             rocblas_operation trans,
+                             rocblas_int       m,
+                             rocblas_int       n,
+                             rocblas_int       k,
+                             float*            A,
+                             rocblas_int       lda,
+                             float*            ipiv,
+                             float*            C,
+                             rocblas_int       ldc)
+{
+    return rocsolver_sormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+}
+
+inline rocblas_status xormqr(rocblas_handle    handle,
+                             rocblas_side      side,
+                             rocblas_operation trans,
+                             rocblas_int       m,
+                             rocblas_int       n,
+                             rocblas_int       k,
+                             double*           A,
+                             rocblas_int       lda,
+                             double*           ipiv,
+                             double*           C,
+                             rocblas_int       ldc)
+{
+    return rocsolver_dormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+}
+
+inline rocblas_status xormqr(rocblas_handle         handle,
+                             rocblas_side           side,
+                             rocblas_operation      trans,
+                             rocblas_int            m,
+                             rocblas_int            n,
+                             rocblas_int            k,
+                             rocblas_float_complex* A,
+                             rocblas_int            lda,
+                             rocblas_float_complex* ipiv,
+                             rocblas_float_complex* C,
+                             rocblas_int            ldc)
+{
+    return rocsolver_cunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+}
+
+inline rocblas_status xormqr(rocblas_handle          handle,
+                             rocblas_side            side,
+                             rocblas_operation       trans,
+                             rocblas_int             m,
+                             rocblas_int             n,
+                             rocblas_int             k,
+                             rocblas_double_complex* A,
+                             rocblas_int             lda,
+                             rocblas_double_complex* ipiv,
+                             rocblas_double_complex* C,
+                             rocblas_int             ldc)
+{
+    return rocsolver_zunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+}
+
+inline rocblas_status xgels(rocblas_handle    handle,
+                            rocblas_operation trans,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            rocblas_int       nrhs,
+                            float*            A,
+                            rocblas_int       lda,
+                            float*            B,
+                            rocblas_int       ldb,
+                            rocblas_int*      info)
+{
+    return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status xgels(rocblas_handle    handle,
+                            rocblas_operation trans,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            rocblas_int       nrhs,
+                            double*           A,
+                            rocblas_int       lda,
+                            double*           B,
+                            rocblas_int       ldb,
+                            rocblas_int*      info)
+{
+    return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status xgels(rocblas_handle         handle,
+                            rocblas_operation      trans,
+                            rocblas_int            m,
+                            rocblas_int            n,
+                            rocblas_int            nrhs,
+                            rocblas_float_complex* A,
+                            rocblas_int            lda,
+                            rocblas_float_complex* B,
+                            rocblas_int            ldb,
+                            rocblas_int*           info)
+{
+    return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status xgels(rocblas_handle          handle,
+                            rocblas_operation       trans,
+                            rocblas_int             m,
+                            rocblas_int             n,
+                            rocblas_int             nrhs,
+                            rocblas_double_complex* A,
+                            rocblas_int             lda,
+                            rocblas_double_complex* B,
+                            rocblas_int             ldb,
+                            rocblas_int*            info)
+{
+    return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status xgeam_batched(rocblas_handle     handle,
+                                    rocblas_operation  transA,
+                                    rocblas_operation  transB,
+                                    rocblas_int        m,
+                                    rocblas_int        n,
+                                    const float*       alpha,
+                                    const float* const A[],
+                                    rocblas_int        lda,
+                                    const float*       beta,
+                                    const float* const B[],
+                                    rocblas_int        ldb,
+                                    float* const       C[],
+                                    rocblas_int        ldc,
+                                    rocblas_int        batch_count)
+{
+    return rocblas_sgeam_batched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+}
+
+inline rocblas_status xgeam_batched(rocblas_handle      handle,
+                                    rocblas_operation   transA,
+                                    rocblas_operation   transB,
+                                    rocblas_int         m,
+                                    rocblas_int         n,
+                                    const double*       alpha,
+                                    const double* const A[],
+                                    rocblas_int         lda,
+                                    const double*       beta,
+                                    const double* const B[],
+                                    rocblas_int         ldb,
+                                    double* const       C[],
+                                    rocblas_int         ldc,
+                                    rocblas_int         batch_count)
+{
+    return rocblas_dgeam_batched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+}
+
+inline rocblas_status xgeam_batched(rocblas_handle                     handle,
+                                    rocblas_operation                  transA,
+                                    rocblas_operation                  transB,
+                                    rocblas_int                        m,
+                                    rocblas_int                        n,
+                                    const rocblas_float_complex*       alpha,
+                                    const rocblas_float_complex* const A[],
+                                    rocblas_int                        lda,
+                                    const rocblas_float_complex*       beta,
+                                    const rocblas_float_complex* const B[],
+                                    rocblas_int                        ldb,
+                                    rocblas_float_complex* const       C[],
+                                    rocblas_int                        ldc,
+                                    rocblas_int                        batch_count)
+{
+    return rocblas_cgeam_batched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+}
+
+inline rocblas_status xgeam_batched(rocblas_handle                      handle,
+                                    rocblas_operation                   transA,
+                                    rocblas_operation                   transB,
+                                    rocblas_int                         m,
+                                    rocblas_int                         n,
+                                    const rocblas_double_complex*       alpha,
+                                    const rocblas_double_complex* const A[],
+                                    rocblas_int                         lda,
+                                    const rocblas_double_complex*       beta,
+                                    const rocblas_double_complex* const B[],
+                                    rocblas_int                         ldb,
+                                    rocblas_double_complex* const       C[],
+                                    rocblas_int                         ldc,
+                                    rocblas_int                         batch_count)
+{
+    return rocblas_zgeam_batched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+}
+
+/******************** HELPERS ********************/
+#define RETURN_IF_ROCBLAS_ERROR(STATUS)       \
+    do                                        \
+    {                                         \
+        rocblas_status _status = (STATUS);    \
+        if(_status != rocblas_status_success) \
+            return _status;                   \
+    } while(0)
+
+#define RETURN_IF_HIP_ERROR(STATUS)               \
+    do                                            \
+    {                                             \
+        if((STATUS) != hipSuccess)                \
+            return rocblas_status_internal_error; \
+    } while(0)
+
+// Host-side counterpart of the rocBLAS types, used for the rotation parameters
+template <typename T>
+struct hipsolver_host_type
+{
+    using type = T;
+};
+
+template <>
+struct hipsolver_host_type<rocblas_float_complex>
+{
+    using type = std::complex<float>;
+};
+
+template <>
+struct hipsolver_host_type<rocblas_double_complex>
+{
+    using type = std::complex<double>;
+};
+
+template <typename T>
+using hipsolver_host_t = typename hipsolver_host_type<T>::type;
+
+// Real type associated with a rocBLAS type
+template <typename T>
+using hipsolver_real_t = decltype(std::real(hipsolver_host_t<T>{}));
+
+// Sets the pointer mode of the handle, and restores the previous mode on scope exit
+struct hipsolver_pointer_mode_guard
+{
+    rocblas_handle       handle;
+    rocblas_pointer_mode old_mode;
+
+    hipsolver_pointer_mode_guard(rocblas_handle handle, rocblas_pointer_mode mode)
+        : handle(handle)
+    {
+        rocblas_get_pointer_mode(handle, &old_mode);
+        rocblas_set_pointer_mode(handle, mode);
+    }
+
+    ~hipsolver_pointer_mode_guard()
+    {
+        rocblas_set_pointer_mode(handle, old_mode);
+    }
+};
+
+// Combines the info of the diagonal blocks of a blocked factorization, stored block by block
+// in iinfo, into the global index of the first non-positive leading minor of each matrix. The
+// blocks that follow a failed block in the same matrix are not meaningful
+inline rocblas_status hipsolver_merge_block_info(hipStream_t        stream,
+                                                 rocblas_int        nb,
+                                                 rocblas_int        blocks,
+                                                 const rocblas_int* iinfo,
+                                                 rocblas_int*       info,
+                                                 rocblas_int        batch_count)
+{
+    std::vector<rocblas_int> hiinfo(blocks * batch_count);
+    std::vector<rocblas_int> hinfo(batch_count, 0);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hiinfo.data(),
+                                       iinfo,
+                                       sizeof(rocblas_int) * blocks * batch_count,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        for(rocblas_int blk = 0; blk < blocks; blk++)
+        {
+            if(hiinfo[blk * batch_count + b] != 0)
+            {
+                hinfo[b] = blk * nb + hiinfo[blk * batch_count + b];
+                break;
+            }
+        }
+    }
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        info, hinfo.data(), sizeof(rocblas_int) * batch_count, hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
+// Copies an array of device pointers to the host
+template <typename T>
+rocblas_status
+    hipsolver_pointers_to_host(std::vector<T*>& h_ptrs, T* const d_ptrs[], rocblas_int count)
+{
+    h_ptrs.resize(count);
+    if(count > 0)
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(h_ptrs.data(), d_ptrs, sizeof(T*) * count, hipMemcpyDeviceToHost));
+    return rocblas_status_success;
+}
@@ -9,6 +9,11 @@ module hipsolver_enums
     !   hipSOLVER types   !
     !---------------------!
 
+    enum, bind(c)
+        enumerator :: HIPSOLVER_LAYOUT_ROW_MAJOR    = 101
+        enumerator :: HIPSOLVER_LAYOUT_COLUMN_MAJOR = 102
+    end enum
+
     enum, bind(c)
         enumerator :: HIPSOLVER_OP_N = 111
         enumerator :: HIPSOLVER_OP_T = 112
@@ -36,6 +41,18 @@ module hipsolver_enums
         enumerator :: HIPSOLVER_EIG_TYPE_3 = 213
     end enum
 
+    enum, bind(c)
+        enumerator :: HIPSOLVER_SVD_ALG_AUTO       = 301
+        enumerator :: HIPSOLVER_SVD_ALG_OUTOFPLACE = 302
+        enumerator :: HIPSOLVER_SVD_ALG_INPLACE    = 303
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPSOLVER_EIG_ALG_AUTO = 311
+        enumerator :: HIPSOLVER_EIG_ALG_DC   = 312
+        enumerator :: HIPSOLVER_EIG_ALG_QR   = 313
+    end enum
+
     enum, bind(c)
         enumerator :: HIPSOLVER_STATUS_SUCCESS           = 0
         enumerator :: HIPSOLVER_STATUS_NOT_INITIALIZED   = 1
@@ -102,6 +119,167 @@ module hipsolver
         end function hipsolverGetStream
     end interface
 
+    interface
+        function hipsolverSetMatrixLayout(handle, layout) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSetMatrixLayout')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_LAYOUT_ROW_MAJOR)), value :: layout
+        end function hipsolverSetMatrixLayout
+    end interface
+
+    interface
+        function hipsolverGetMatrixLayout(handle, layout) &
+                result(c_int) &
+                bind(c, name = 'hipsolverGetMatrixLayout')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: layout
+        end function hipsolverGetMatrixLayout
+    end interface
+
+    interface
+        function hipsolverHandlePoolSetCapacity(capacity) &
+                result(c_int) &
+                bind(c, name = 'hipsolverHandlePoolSetCapacity')
+            use iso_c_binding
+            implicit none
+            integer(c_int), value :: capacity
+        end function hipsolverHandlePoolSetCapacity
+    end interface
+
+    interface
+        function hipsolverHandlePoolGetCapacity(capacity) &
+                result(c_int) &
+                bind(c, name = 'hipsolverHandlePoolGetCapacity')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: capacity
+        end function hipsolverHandlePoolGetCapacity
+    end interface
+
+    interface
+        function hipsolverHandlePoolReserve(count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverHandlePoolReserve')
+            use iso_c_binding
+            implicit none
+            integer(c_int), value :: count
+        end function hipsolverHandlePoolReserve
+    end interface
+
+    interface
+        function hipsolverHandlePoolClear() &
+                result(c_int) &
+                bind(c, name = 'hipsolverHandlePoolClear')
+            use iso_c_binding
+            implicit none
+        end function hipsolverHandlePoolClear
+    end interface
+
+    interface
+        function hipsolverCoalescerCreate(coalescer) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCoalescerCreate')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: coalescer
+        end function hipsolverCoalescerCreate
+    end interface
+
+    interface
+        function hipsolverCoalescerDestroy(coalescer) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCoalescerDestroy')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: coalescer
+        end function hipsolverCoalescerDestroy
+    end interface
+
+    interface
+        function hipsolverCoalescerSetMaxBatch(coalescer, max_batch) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCoalescerSetMaxBatch')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: coalescer
+            integer(c_int), value :: max_batch
+        end function hipsolverCoalescerSetMaxBatch
+    end interface
+
+    interface
+        function hipsolverCoalescerSetWindow(coalescer, microseconds) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCoalescerSetWindow')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: coalescer
+            integer(c_int), value :: microseconds
+        end function hipsolverCoalescerSetWindow
+    end interface
+
+    interface
+        function hipsolverSetSvdAlg(handle, alg) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSetSvdAlg')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SVD_ALG_AUTO)), value :: alg
+        end function hipsolverSetSvdAlg
+    end interface
+
+    interface
+        function hipsolverGetSvdAlg(handle, alg) &
+                result(c_int) &
+                bind(c, name = 'hipsolverGetSvdAlg')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: alg
+        end function hipsolverGetSvdAlg
+    end interface
+
+    interface
+        function hipsolverSetEigAlg(handle, alg) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSetEigAlg')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_ALG_AUTO)), value :: alg
+        end function hipsolverSetEigAlg
+    end interface
+
+    interface
+        function hipsolverGetEigAlg(handle, alg) &
+                result(c_int) &
+                bind(c, name = 'hipsolverGetEigAlg')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: alg
+        end function hipsolverGetEigAlg
+    end interface
+
+    interface
+        function hipsolverLoadTuningTable(handle, path) &
+                result(c_int) &
+                bind(c, name = 'hipsolverLoadTuningTable')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            character(c_char) :: path(*)
+        end function hipsolverLoadTuningTable
+    end interface
+
     !------------!
     !   LAPACK   !
     !------------!
@@ -1402,6 +1580,159 @@ module hipsolver
         end function hipsolverZgeqrf
     end interface
 
+    ! ******************** GEQRF_VBATCHED ********************
+    interface
+        function hipsolverSgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgeqrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfVbatched
+    end interface
+    
+    interface
+        function hipsolverDgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfVbatched
+    end interface
+    
+    interface
+        function hipsolverCgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfVbatched
+    end interface
+    
+    interface
+        function hipsolverZgeqrfVbatched(handle, m, n, A, lda, tau, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfVbatched
+    end interface
+
     ! ******************** GESV ********************
     interface
         function hipsolverSSgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork) &
@@ -1752,88 +2083,297 @@ module hipsolver
         end function hipsolverZgesvd
     end interface
 
-    ! ******************** GETRF ********************
+    ! ******************** GESVD_STRIDED_BATCHED ********************
     interface
-        function hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrf_bufferSize')
+                bind(c, name = 'hipsolverSgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverSgetrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrf_bufferSize')
+                bind(c, name = 'hipsolverDgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverDgetrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrf_bufferSize')
+                bind(c, name = 'hipsolverCgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverCgetrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrf_bufferSize')
+                bind(c, name = 'hipsolverZgesvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: lwork
-        end function hipsolverZgetrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdStridedBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverSgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrf')
+                bind(c, name = 'hipsolverSgesvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
             type(c_ptr), value :: info
-        end function hipsolverSgetrf
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+            strideS, U, ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdStridedBatched
+    end interface
+
+    ! ******************** GETRF ********************
+    interface
+        function hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZgetrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverSgetrf
     end interface
     
     interface
@@ -1850,965 +2390,6051 @@ module hipsolver
             integer(c_int), value :: lda
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverDgetrf
+    end interface
+    
+    interface
+        function hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverCgetrf
+    end interface
+    
+    interface
+        function hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverZgetrf
+    end interface
+
+    ! ******************** GETRF_COALESCED ********************
+    interface
+        function hipsolverSgetrfCoalesced(handle, coalescer, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverSgetrfCoalesced
+    end interface
+    
+    interface
+        function hipsolverDgetrfCoalesced(handle, coalescer, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverDgetrfCoalesced
+    end interface
+    
+    interface
+        function hipsolverCgetrfCoalesced(handle, coalescer, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverCgetrfCoalesced
+    end interface
+    
+    interface
+        function hipsolverZgetrfCoalesced(handle, coalescer, m, n, A, lda, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverZgetrfCoalesced
+    end interface
+
+    ! ******************** GETRF_INTERLEAVED ********************
+    interface
+        function hipsolverSgetrfInterleaved_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrfInterleaved_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrfInterleaved_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrfInterleaved_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgetrfInterleaved(handle, m, n, A, lda, work, lwork, devIpiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfInterleaved
+    end interface
+    
+    interface
+        function hipsolverDgetrfInterleaved(handle, m, n, A, lda, work, lwork, devIpiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfInterleaved
+    end interface
+    
+    interface
+        function hipsolverCgetrfInterleaved(handle, m, n, A, lda, work, lwork, devIpiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfInterleaved
+    end interface
+    
+    interface
+        function hipsolverZgetrfInterleaved(handle, m, n, A, lda, work, lwork, devIpiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfInterleaved
+    end interface
+
+    ! ******************** GETRF_VBATCHED ********************
+    interface
+        function hipsolverSgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrfVbatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfVbatched
+    end interface
+    
+    interface
+        function hipsolverDgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfVbatched
+    end interface
+    
+    interface
+        function hipsolverCgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfVbatched
+    end interface
+    
+    interface
+        function hipsolverZgetrfVbatched(handle, m, n, A, lda, work, lwork, ipiv, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfVbatched
+    end interface
+
+    ! ******************** GETRS ********************
+    interface
+        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZgetrs_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgetrs
+    end interface
+    
+    interface
+        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgetrs
+    end interface
+    
+    interface
+        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgetrs
+    end interface
+    
+    interface
+        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgetrs
+    end interface
+
+    ! ******************** GETRS_INTERLEAVED ********************
+    interface
+        function hipsolverSgetrsInterleaved_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, &
+            B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrsInterleaved_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, &
+            B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrsInterleaved_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, &
+            B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrsInterleaved_bufferSize(handle, trans, n, nrhs, A, lda, devIpiv, &
+            B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgetrsInterleaved(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &
+            work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsInterleaved
+    end interface
+    
+    interface
+        function hipsolverDgetrsInterleaved(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &
+            work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsInterleaved
+    end interface
+    
+    interface
+        function hipsolverCgetrsInterleaved(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &
+            work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsInterleaved
+    end interface
+    
+    interface
+        function hipsolverZgetrsInterleaved(handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, &
+            work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: devIpiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsInterleaved
+    end interface
+
+    ! ******************** GTSV ********************
+    interface
+        function hipsolverSgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSgtsv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDgtsv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCgtsv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgtsv_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZgtsv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgtsv
+    end interface
+    
+    interface
+        function hipsolverDgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgtsv
+    end interface
+    
+    interface
+        function hipsolverCgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgtsv
+    end interface
+    
+    interface
+        function hipsolverZgtsv(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgtsv
+    end interface
+    
+    ! ******************** GTSV_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, &
+            ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgtsvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, &
+            ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgtsvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, &
+            ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgtsvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgtsvStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, strideD, B, &
+            ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgtsvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgtsvStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgtsvStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgtsvStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgtsvStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgtsvStridedBatched
+    end interface
+    
+    ! ******************** GTSV_NOPIVOT ********************
+    interface
+        function hipsolverSgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsvNopivot_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSgtsvNopivot_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsvNopivot_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDgtsvNopivot_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsvNopivot_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCgtsvNopivot_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgtsvNopivot_bufferSize(handle, n, nrhs, dl, d, du, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsvNopivot_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZgtsvNopivot_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsvNopivot')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgtsvNopivot
+    end interface
+    
+    interface
+        function hipsolverDgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsvNopivot')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgtsvNopivot
+    end interface
+    
+    interface
+        function hipsolverCgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsvNopivot')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgtsvNopivot
+    end interface
+    
+    interface
+        function hipsolverZgtsvNopivot(handle, n, nrhs, dl, d, du, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsvNopivot')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgtsvNopivot
+    end interface
+    
+    ! ******************** GTSV_NOPIVOT_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, &
+            strideD, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsvNopivotStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgtsvNopivotStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, &
+            strideD, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsvNopivotStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgtsvNopivotStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, &
+            strideD, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsvNopivotStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgtsvNopivotStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgtsvNopivotStridedBatched_bufferSize(handle, n, nrhs, dl, d, du, &
+            strideD, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsvNopivotStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgtsvNopivotStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgtsvNopivotStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgtsvNopivotStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgtsvNopivotStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgtsvNopivotStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgtsvNopivotStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgtsvNopivotStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgtsvNopivotStridedBatched(handle, n, nrhs, dl, d, du, strideD, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgtsvNopivotStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgtsvNopivotStridedBatched
+    end interface
+    
+    ! ******************** PBTRF ********************
+    interface
+        function hipsolverSpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: lwork
+        end function hipsolverSpbtrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: lwork
+        end function hipsolverDpbtrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: lwork
+        end function hipsolverCpbtrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpbtrf_bufferSize(handle, uplo, n, kd, AB, ldab, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: lwork
+        end function hipsolverZpbtrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpbtrf
+    end interface
+    
+    interface
+        function hipsolverDpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpbtrf
+    end interface
+    
+    interface
+        function hipsolverCpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpbtrf
+    end interface
+    
+    interface
+        function hipsolverZpbtrf(handle, uplo, n, kd, AB, ldab, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpbtrf
+    end interface
+    
+    ! ******************** PBTRF_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpbtrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpbtrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpbtrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpbtrfStridedBatched_bufferSize(handle, uplo, n, kd, AB, ldab, strideAB, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpbtrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+            lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpbtrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+            lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpbtrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+            lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpbtrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZpbtrfStridedBatched(handle, uplo, n, kd, AB, ldab, strideAB, work, &
+            lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpbtrfStridedBatched
+    end interface
+    
+    ! ******************** PBTRS ********************
+    interface
+        function hipsolverSpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSpbtrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDpbtrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCpbtrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpbtrs_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZpbtrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+            info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpbtrs
+    end interface
+    
+    interface
+        function hipsolverDpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+            info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpbtrs
+    end interface
+    
+    interface
+        function hipsolverCpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+            info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpbtrs
+    end interface
+    
+    interface
+        function hipsolverZpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, work, lwork, &
+            info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpbtrs
+    end interface
+    
+    ! ******************** PBTRS_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpbtrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpbtrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpbtrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpbtrsStridedBatched_bufferSize(handle, uplo, n, kd, nrhs, AB, ldab, &
+            strideAB, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpbtrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpbtrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpbtrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpbtrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpbtrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpbtrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpbtrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZpbtrsStridedBatched(handle, uplo, n, kd, nrhs, AB, ldab, strideAB, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpbtrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: kd
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AB
+            integer(c_int), value :: ldab
+            integer(c_int), value :: strideAB
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpbtrsStridedBatched
+    end interface
+    
+    ! ******************** POSV ********************
+    interface
+        function hipsolverSposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSposv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSposv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDposv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDposv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCposv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCposv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZposv_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZposv_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSposv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSposv
+    end interface
+    
+    interface
+        function hipsolverDposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDposv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDposv
+    end interface
+    
+    interface
+        function hipsolverCposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCposv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCposv
+    end interface
+    
+    interface
+        function hipsolverZposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZposv')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZposv
+    end interface
+
+    ! ******************** POSV_BATCHED ********************
+    interface
+        function hipsolverSposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSposvBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSposvBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDposvBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDposvBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCposvBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCposvBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZposvBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZposvBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSposvBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSposvBatched
+    end interface
+    
+    interface
+        function hipsolverDposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDposvBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDposvBatched
+    end interface
+    
+    interface
+        function hipsolverCposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCposvBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCposvBatched
+    end interface
+    
+    interface
+        function hipsolverZposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZposvBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZposvBatched
+    end interface
+
+    ! ******************** POSV_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, &
+            strideA, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSposvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSposvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, &
+            strideA, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDposvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDposvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, &
+            strideA, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCposvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCposvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZposvStridedBatched_bufferSize(handle, uplo, n, nrhs, A, lda, &
+            strideA, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZposvStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZposvStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSposvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSposvStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDposvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDposvStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCposvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCposvStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZposvStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZposvStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZposvStridedBatched
+    end interface
+
+    ! ******************** POTRF ********************
+    interface
+        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrf
+    end interface
+
+    interface
+        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrf
+    end interface
+
+    interface
+        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrf
+    end interface
+
+    interface
+        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotrf
+    end interface
+    
+    ! ******************** POTRF_BATCHED ********************
+    interface
+        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched
+    end interface
+
+    ! ******************** POTRF_COALESCED ********************
+    interface
+        function hipsolverSpotrfCoalesced(handle, coalescer, uplo, n, A, lda, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipsolverSpotrfCoalesced
+    end interface
+    
+    interface
+        function hipsolverDpotrfCoalesced(handle, coalescer, uplo, n, A, lda, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipsolverDpotrfCoalesced
+    end interface
+    
+    interface
+        function hipsolverCpotrfCoalesced(handle, coalescer, uplo, n, A, lda, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipsolverCpotrfCoalesced
+    end interface
+    
+    interface
+        function hipsolverZpotrfCoalesced(handle, coalescer, uplo, n, A, lda, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfCoalesced')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: coalescer
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipsolverZpotrfCoalesced
+    end interface
+
+    ! ******************** POTRF_INTERLEAVED ********************
+    interface
+        function hipsolverSpotrfInterleaved_bufferSize(handle, uplo, n, A, lda, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfInterleaved_bufferSize(handle, uplo, n, A, lda, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfInterleaved_bufferSize(handle, uplo, n, A, lda, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfInterleaved_bufferSize(handle, uplo, n, A, lda, lwork, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfInterleaved(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfInterleaved
+    end interface
+    
+    interface
+        function hipsolverDpotrfInterleaved(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfInterleaved
+    end interface
+    
+    interface
+        function hipsolverCpotrfInterleaved(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfInterleaved
+    end interface
+    
+    interface
+        function hipsolverZpotrfInterleaved(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfInterleaved
+    end interface
+
+    ! ******************** POTRF_PIPELINED ********************
+    interface
+        function hipsolverSpotrfPipelined(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverSpotrfPipelined
+    end interface
+    
+    interface
+        function hipsolverDpotrfPipelined(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverDpotrfPipelined
+    end interface
+    
+    interface
+        function hipsolverCpotrfPipelined(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverCpotrfPipelined
+    end interface
+    
+    interface
+        function hipsolverZpotrfPipelined(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverZpotrfPipelined
+    end interface
+
+    ! ******************** POTRF_VBATCHED ********************
+    interface
+        function hipsolverSpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfVbatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfVbatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfVbatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfVbatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfVbatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfVbatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfVbatched(handle, uplo, n, A, lda, work, lwork, info, &
+            batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfVbatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfVbatched
+    end interface
+
+    ! ******************** POTRF_UPDATE ********************
+    interface
+        function hipsolverSpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfUpdate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrfUpdate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfUpdate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrfUpdate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfUpdate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrfUpdate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfUpdate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfUpdate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrfUpdate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfUpdate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrfUpdate
+    end interface
+    
+    interface
+        function hipsolverDpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfUpdate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrfUpdate
+    end interface
+    
+    interface
+        function hipsolverCpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfUpdate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrfUpdate
+    end interface
+    
+    interface
+        function hipsolverZpotrfUpdate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfUpdate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotrfUpdate
+    end interface
+    
+    ! ******************** POTRF_UPDATE_BATCHED ********************
+    interface
+        function hipsolverSpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfUpdateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfUpdateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfUpdateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfUpdateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfUpdateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfUpdateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfUpdateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfUpdateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfUpdateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfUpdateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfUpdateBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfUpdateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfUpdateBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfUpdateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfUpdateBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfUpdateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfUpdateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfUpdateBatched
+    end interface
+    
+    ! ******************** POTRF_UPDATE_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfUpdateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfUpdateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfUpdateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfUpdateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfUpdateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfUpdateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfUpdateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfUpdateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfUpdateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfUpdateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfUpdateStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfUpdateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfUpdateStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfUpdateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfUpdateStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfUpdateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfUpdateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfUpdateStridedBatched
+    end interface
+    
+    ! ******************** POTRF_DOWNDATE ********************
+    interface
+        function hipsolverSpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfDowndate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrfDowndate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfDowndate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrfDowndate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfDowndate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrfDowndate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfDowndate_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfDowndate_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrfDowndate_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfDowndate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrfDowndate
+    end interface
+    
+    interface
+        function hipsolverDpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfDowndate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrfDowndate
+    end interface
+    
+    interface
+        function hipsolverCpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfDowndate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrfDowndate
+    end interface
+    
+    interface
+        function hipsolverZpotrfDowndate(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfDowndate')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotrfDowndate
+    end interface
+    
+    ! ******************** POTRF_DOWNDATE_BATCHED ********************
+    interface
+        function hipsolverSpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfDowndateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfDowndateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfDowndateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfDowndateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfDowndateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfDowndateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfDowndateBatched_bufferSize(handle, uplo, n, k, A, lda, V, ldv, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfDowndateBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfDowndateBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfDowndateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfDowndateBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfDowndateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfDowndateBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfDowndateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfDowndateBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfDowndateBatched(handle, uplo, n, k, A, lda, V, ldv, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfDowndateBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfDowndateBatched
+    end interface
+    
+    ! ******************** POTRF_DOWNDATE_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfDowndateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfDowndateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfDowndateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfDowndateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfDowndateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfDowndateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfDowndateStridedBatched_bufferSize(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfDowndateStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfDowndateStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfDowndateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfDowndateStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfDowndateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfDowndateStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfDowndateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfDowndateStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfDowndateStridedBatched(handle, uplo, n, k, A, lda, strideA, &
+            V, ldv, strideV, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfDowndateStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfDowndateStridedBatched
+    end interface
+    
+    ! ******************** POTRI ********************
+    interface
+        function hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotri_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotri_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotri_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotri_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotri_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotri
+    end interface
+
+    interface
+        function hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotri
+    end interface
+
+    interface
+        function hipsolverCpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotri
+    end interface
+
+    interface
+        function hipsolverZpotri(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotri')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotri
+    end interface
+
+    ! ******************** POTRS ********************
+    interface
+        function hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrs_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrs
+    end interface
+
+    interface
+        function hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrs
+    end interface
+
+    interface
+        function hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrs
+    end interface
+
+    interface
+        function hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotrs
+    end interface
+
+    ! ******************** POTRS_BATCHED ********************
+    interface
+        function hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsBatched
+    end interface
+
+    interface
+        function hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsBatched
+    end interface
+
+    interface
+        function hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsBatched
+    end interface
+
+    interface
+        function hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsBatched
+    end interface
+
+    ! ******************** POTRS_INTERLEAVED ********************
+    interface
+        function hipsolverSpotrsInterleaved_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrsInterleaved_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrsInterleaved_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrsInterleaved_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, &
+            lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrsInterleaved_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsInterleaved_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSpotrsInterleaved(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrsInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsInterleaved
+    end interface
+    
+    interface
+        function hipsolverDpotrsInterleaved(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrsInterleaved')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgetrf
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsInterleaved
     end interface
     
     interface
-        function hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverCpotrsInterleaved(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrf')
+                bind(c, name = 'hipsolverCpotrsInterleaved')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: info
-        end function hipsolverCgetrf
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsInterleaved
     end interface
     
     interface
-        function hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverZpotrsInterleaved(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrf')
+                bind(c, name = 'hipsolverZpotrsInterleaved')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: info
-        end function hipsolverZgetrf
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsInterleaved
     end interface
 
-    ! ******************** GETRS ********************
+    ! ******************** POTRS_VBATCHED ********************
     interface
-        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverSpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrs_bufferSize')
+                bind(c, name = 'hipsolverSpotrsVbatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverSgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsVbatched_bufferSize
     end interface
     
     interface
-        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverDpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrs_bufferSize')
+                bind(c, name = 'hipsolverDpotrsVbatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverDgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsVbatched_bufferSize
     end interface
     
     interface
-        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverCpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrs_bufferSize')
+                bind(c, name = 'hipsolverCpotrsVbatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverCgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsVbatched_bufferSize
     end interface
     
     interface
-        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverZpotrsVbatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrs_bufferSize')
+                bind(c, name = 'hipsolverZpotrsVbatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: lwork
-        end function hipsolverZgetrs_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsVbatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverSpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrs')
+                bind(c, name = 'hipsolverSpotrsVbatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsVbatched
     end interface
     
     interface
-        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverDpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrs')
+                bind(c, name = 'hipsolverDpotrsVbatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsVbatched
     end interface
     
     interface
-        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverCpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrs')
+                bind(c, name = 'hipsolverCpotrsVbatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsVbatched
     end interface
     
     interface
-        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverZpotrsVbatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, &
+            info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrs')
+                bind(c, name = 'hipsolverZpotrsVbatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
-            integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            type(c_ptr), value :: n
+            type(c_ptr), value :: nrhs
             type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: lda
             type(c_ptr), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZgetrs
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsVbatched
     end interface
 
-    ! ******************** POTRF ********************
+    ! ******************** PPTRF ********************
     interface
-        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverSpptrf_bufferSize(handle, uplo, n, AP, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrf_bufferSize')
+                bind(c, name = 'hipsolverSpptrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: lwork
-        end function hipsolverSpotrf_bufferSize
+        end function hipsolverSpptrf_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverDpptrf_bufferSize(handle, uplo, n, AP, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrf_bufferSize')
+                bind(c, name = 'hipsolverDpptrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: lwork
-        end function hipsolverDpotrf_bufferSize
+        end function hipsolverDpptrf_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverCpptrf_bufferSize(handle, uplo, n, AP, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrf_bufferSize')
+                bind(c, name = 'hipsolverCpptrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: lwork
-        end function hipsolverCpotrf_bufferSize
+        end function hipsolverCpptrf_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverZpptrf_bufferSize(handle, uplo, n, AP, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrf_bufferSize')
+                bind(c, name = 'hipsolverZpptrf_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: lwork
-        end function hipsolverZpotrf_bufferSize
+        end function hipsolverZpptrf_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverSpptrf(handle, uplo, n, AP, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrf')
+                bind(c, name = 'hipsolverSpptrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSpotrf
+        end function hipsolverSpptrf
     end interface
-
+    
     interface
-        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverDpptrf(handle, uplo, n, AP, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrf')
+                bind(c, name = 'hipsolverDpptrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDpotrf
+        end function hipsolverDpptrf
     end interface
-
+    
     interface
-        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverCpptrf(handle, uplo, n, AP, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrf')
+                bind(c, name = 'hipsolverCpptrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCpotrf
+        end function hipsolverCpptrf
     end interface
-
+    
     interface
-        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverZpptrf(handle, uplo, n, AP, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrf')
+                bind(c, name = 'hipsolverZpptrf')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZpotrf
+        end function hipsolverZpptrf
     end interface
     
-    ! ******************** POTRF_BATCHED ********************
+    ! ******************** PPTRS ********************
     interface
-        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverSpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverSpptrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched_bufferSize
+        end function hipsolverSpptrs_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverDpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverDpptrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched_bufferSize
+        end function hipsolverDpptrs_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverCpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverCpptrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched_bufferSize
+        end function hipsolverCpptrs_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverZpptrs_bufferSize(handle, uplo, n, nrhs, AP, B, ldb, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverZpptrs_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: lwork
-            integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched_bufferSize
+        end function hipsolverZpptrs_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverSpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrfBatched')
+                bind(c, name = 'hipsolverSpptrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched
+        end function hipsolverSpptrs
     end interface
     
     interface
-        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverDpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrfBatched')
+                bind(c, name = 'hipsolverDpptrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched
+        end function hipsolverDpptrs
     end interface
     
     interface
-        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverCpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrfBatched')
+                bind(c, name = 'hipsolverCpptrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched
+        end function hipsolverCpptrs
     end interface
     
     interface
-        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverZpptrs(handle, uplo, n, nrhs, AP, B, ldb, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrfBatched')
+                bind(c, name = 'hipsolverZpptrs')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched
+        end function hipsolverZpptrs
     end interface
-
-    ! ******************** POTRI ********************
+    
+    ! ******************** SPEVD/HPEVD ********************
     interface
-        function hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverSspevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotri_bufferSize')
+                bind(c, name = 'hipsolverSspevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: lwork
-        end function hipsolverSpotri_bufferSize
+        end function hipsolverSspevd_bufferSize
     end interface
     
     interface
-        function hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverDspevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotri_bufferSize')
+                bind(c, name = 'hipsolverDspevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: lwork
-        end function hipsolverDpotri_bufferSize
+        end function hipsolverDspevd_bufferSize
     end interface
     
     interface
-        function hipsolverCpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverChpevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotri_bufferSize')
+                bind(c, name = 'hipsolverChpevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: lwork
-        end function hipsolverCpotri_bufferSize
+        end function hipsolverChpevd_bufferSize
     end interface
     
     interface
-        function hipsolverZpotri_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverZhpevd_bufferSize(handle, jobz, uplo, n, AP, D, Z, ldz, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotri_bufferSize')
+                bind(c, name = 'hipsolverZhpevd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: lwork
-        end function hipsolverZpotri_bufferSize
+        end function hipsolverZhpevd_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverSspevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotri')
+                bind(c, name = 'hipsolverSspevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSpotri
+        end function hipsolverSspevd
     end interface
-
+    
     interface
-        function hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverDspevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotri')
+                bind(c, name = 'hipsolverDspevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDpotri
+        end function hipsolverDspevd
     end interface
-
+    
     interface
-        function hipsolverCpotri(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverChpevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotri')
+                bind(c, name = 'hipsolverChpevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCpotri
+        end function hipsolverChpevd
     end interface
-
+    
     interface
-        function hipsolverZpotri(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverZhpevd(handle, jobz, uplo, n, AP, D, Z, ldz, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotri')
+                bind(c, name = 'hipsolverZhpevd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: D
+            type(c_ptr), value :: Z
+            integer(c_int), value :: ldz
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZpotri
+        end function hipsolverZhpevd
     end interface
-
-    ! ******************** POTRS ********************
+    
+    ! ******************** TRTTP ********************
     interface
-        function hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+        function hipsolverStrttp(handle, uplo, n, A, lda, AP) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrs_bufferSize')
+                bind(c, name = 'hipsolverStrttp')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
-        end function hipsolverSpotrs_bufferSize
+            type(c_ptr), value :: AP
+        end function hipsolverStrttp
     end interface
     
     interface
-        function hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+        function hipsolverDtrttp(handle, uplo, n, A, lda, AP) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrs_bufferSize')
+                bind(c, name = 'hipsolverDtrttp')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
-        end function hipsolverDpotrs_bufferSize
+            type(c_ptr), value :: AP
+        end function hipsolverDtrttp
     end interface
     
     interface
-        function hipsolverCpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+        function hipsolverCtrttp(handle, uplo, n, A, lda, AP) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrs_bufferSize')
+                bind(c, name = 'hipsolverCtrttp')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
-        end function hipsolverCpotrs_bufferSize
+            type(c_ptr), value :: AP
+        end function hipsolverCtrttp
     end interface
     
     interface
-        function hipsolverZpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork) &
+        function hipsolverZtrttp(handle, uplo, n, A, lda, AP) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrs_bufferSize')
+                bind(c, name = 'hipsolverZtrttp')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
-        end function hipsolverZpotrs_bufferSize
+            type(c_ptr), value :: AP
+        end function hipsolverZtrttp
     end interface
-
+    
+    ! ******************** TPTTR ********************
     interface
-        function hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        function hipsolverStpttr(handle, uplo, n, AP, A, lda) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrs')
+                bind(c, name = 'hipsolverStpttr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
-        end function hipsolverSpotrs
+        end function hipsolverStpttr
     end interface
-
+    
     interface
-        function hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        function hipsolverDtpttr(handle, uplo, n, AP, A, lda) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrs')
+                bind(c, name = 'hipsolverDtpttr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
-        end function hipsolverDpotrs
+        end function hipsolverDtpttr
     end interface
-
+    
     interface
-        function hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        function hipsolverCtpttr(handle, uplo, n, AP, A, lda) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrs')
+                bind(c, name = 'hipsolverCtpttr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
-        end function hipsolverCpotrs
+        end function hipsolverCtpttr
     end interface
-
+    
     interface
-        function hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info) &
+        function hipsolverZtpttr(handle, uplo, n, AP, A, lda) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrs')
+                bind(c, name = 'hipsolverZtpttr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
+            type(c_ptr), value :: AP
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
-        end function hipsolverZpotrs
+        end function hipsolverZtpttr
     end interface
 
-    ! ******************** POTRS_BATCHED ********************
+    ! ******************** INTERLEAVED_TO_STRIDED ********************
     interface
-        function hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+        function hipsolverSinterleavedToStrided(handle, m, n, A, lda, B, ldb, strideB, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrsBatched_bufferSize')
+                bind(c, name = 'hipsolverSinterleavedToStrided')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
+            integer(c_int), value :: strideB
             integer(c_int), value :: batch_count
-        end function hipsolverSpotrsBatched_bufferSize
+        end function hipsolverSinterleavedToStrided
     end interface
     
     interface
-        function hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+        function hipsolverDinterleavedToStrided(handle, m, n, A, lda, B, ldb, strideB, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrsBatched_bufferSize')
+                bind(c, name = 'hipsolverDinterleavedToStrided')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
+            integer(c_int), value :: strideB
             integer(c_int), value :: batch_count
-        end function hipsolverDpotrsBatched_bufferSize
+        end function hipsolverDinterleavedToStrided
     end interface
     
     interface
-        function hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+        function hipsolverCinterleavedToStrided(handle, m, n, A, lda, B, ldb, strideB, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrsBatched_bufferSize')
+                bind(c, name = 'hipsolverCinterleavedToStrided')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
+            integer(c_int), value :: strideB
             integer(c_int), value :: batch_count
-        end function hipsolverCpotrsBatched_bufferSize
+        end function hipsolverCinterleavedToStrided
     end interface
     
     interface
-        function hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count) &
+        function hipsolverZinterleavedToStrided(handle, m, n, A, lda, B, ldb, strideB, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrsBatched_bufferSize')
+                bind(c, name = 'hipsolverZinterleavedToStrided')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: lwork
+            integer(c_int), value :: strideB
             integer(c_int), value :: batch_count
-        end function hipsolverZpotrsBatched_bufferSize
+        end function hipsolverZinterleavedToStrided
     end interface
 
+    ! ******************** STRIDED_TO_INTERLEAVED ********************
     interface
-        function hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        function hipsolverSstridedToInterleaved(handle, m, n, A, lda, strideA, B, ldb, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrsBatched')
+                bind(c, name = 'hipsolverSstridedToInterleaved')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverSpotrsBatched
+        end function hipsolverSstridedToInterleaved
     end interface
-
+    
     interface
-        function hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        function hipsolverDstridedToInterleaved(handle, m, n, A, lda, strideA, B, ldb, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrsBatched')
+                bind(c, name = 'hipsolverDstridedToInterleaved')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverDpotrsBatched
+        end function hipsolverDstridedToInterleaved
     end interface
-
+    
     interface
-        function hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        function hipsolverCstridedToInterleaved(handle, m, n, A, lda, strideA, B, ldb, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrsBatched')
+                bind(c, name = 'hipsolverCstridedToInterleaved')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverCpotrsBatched
+        end function hipsolverCstridedToInterleaved
     end interface
-
+    
     interface
-        function hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count) &
+        function hipsolverZstridedToInterleaved(handle, m, n, A, lda, strideA, B, ldb, &
+            batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrsBatched')
+                bind(c, name = 'hipsolverZstridedToInterleaved')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: work
-            integer(c_int), value :: lwork
-            type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverZpotrsBatched
+        end function hipsolverZstridedToInterleaved
     end interface
 
     ! ******************** SYEVD/HEEVD ********************
@@ -2964,6 +8590,95 @@ module hipsolver
         end function hipsolverZheevd
     end interface
 
+    ! ******************** SYEVJ_PIPELINED/HEEVJ_PIPELINED ********************
+    interface
+        function hipsolverSsyevjPipelined(handle, jobz, uplo, n, A, lda, W, info, params, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevjPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverSsyevjPipelined
+    end interface
+    
+    interface
+        function hipsolverDsyevjPipelined(handle, jobz, uplo, n, A, lda, W, info, params, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevjPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverDsyevjPipelined
+    end interface
+    
+    interface
+        function hipsolverCheevjPipelined(handle, jobz, uplo, n, A, lda, W, info, params, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevjPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverCheevjPipelined
+    end interface
+    
+    interface
+        function hipsolverZheevjPipelined(handle, jobz, uplo, n, A, lda, W, info, params, &
+            batch_count, chunk_size) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevjPipelined')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: chunk_size
+        end function hipsolverZheevjPipelined
+    end interface
+
     ! ******************** SYGVD/HEGVD ********************
     interface
         function hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
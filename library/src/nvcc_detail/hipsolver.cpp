@@ -224,6 +224,201 @@ catch(...)
     return exception2hip_status();
 }
 
+hipsolverStatus_t hipsolverSetMatrixLayout(hipsolverHandle_t handle, hipsolverLayout_t layout)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(layout == HIPSOLVER_LAYOUT_COLUMN_MAJOR)
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(layout == HIPSOLVER_LAYOUT_ROW_MAJOR)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetMatrixLayout(hipsolverHandle_t handle, hipsolverLayout_t* layout)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!layout)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *layout = HIPSOLVER_LAYOUT_COLUMN_MAJOR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** AUXILIARY (HANDLE POOL) ********************/
+hipsolverStatus_t hipsolverHandlePoolSetCapacity(int capacity)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolGetCapacity(int* capacity)
+try
+{
+    if(capacity != nullptr)
+        *capacity = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolReserve(int count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolClear(void)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** AUXILIARY (COALESCER) ********************/
+hipsolverStatus_t hipsolverCoalescerCreate(hipsolverCoalescer_t* coalescer)
+try
+{
+    if(coalescer != nullptr)
+        *coalescer = nullptr;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCoalescerDestroy(hipsolverCoalescer_t coalescer)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCoalescerSetMaxBatch(hipsolverCoalescer_t coalescer, int max_batch)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCoalescerSetWindow(hipsolverCoalescer_t coalescer, int microseconds)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** AUXILIARY (TUNING) ********************/
+hipsolverStatus_t hipsolverSetSvdAlg(hipsolverHandle_t handle, hipsolverSvdAlg_t alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(alg == HIPSOLVER_SVD_ALG_AUTO)
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(alg != HIPSOLVER_SVD_ALG_OUTOFPLACE && alg != HIPSOLVER_SVD_ALG_INPLACE)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetSvdAlg(hipsolverHandle_t handle, hipsolverSvdAlg_t* alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!alg)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *alg = HIPSOLVER_SVD_ALG_AUTO;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSetEigAlg(hipsolverHandle_t handle, hipsolverEigAlg_t alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(alg == HIPSOLVER_EIG_ALG_AUTO)
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(alg != HIPSOLVER_EIG_ALG_DC && alg != HIPSOLVER_EIG_ALG_QR)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetEigAlg(hipsolverHandle_t handle, hipsolverEigAlg_t* alg)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!alg)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *alg = HIPSOLVER_EIG_ALG_AUTO;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverLoadTuningTable(hipsolverHandle_t handle, const char* path)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
 /******************** AUXILIARY (PARAMS) ********************/
 hipsolverStatus_t hipsolverDnCreateGesvdjInfo(hipsolverGesvdjInfo_t* info)
 try
@@ -2003,6 +2198,155 @@ catch(...)
     return exception2hip_status();
 }
 
+/******************** GEQRF_VBATCHED ********************/
+hipsolverStatus_t hipsolverSgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     float*            A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     double*           A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipFloatComplex*  A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipDoubleComplex* A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          float*            A[],
+                                          const int*        lda,
+                                          float*            tau,
+                                          float*            work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          double*           A[],
+                                          const int*        lda,
+                                          double*           tau,
+                                          double*           work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipFloatComplex*  A[],
+                                          const int*        lda,
+                                          hipFloatComplex*  tau,
+                                          hipFloatComplex*  work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgeqrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipDoubleComplex* A[],
+                                          const int*        lda,
+                                          hipDoubleComplex* tau,
+                                          hipDoubleComplex* work,
+                                          int               lwork,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
 /******************** GESV ********************/
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
                                                               int               n,
@@ -2457,68 +2801,257 @@ catch(...)
     return exception2hip_status();
 }
 
-/******************** GESVDJ ********************/
-hipsolverStatus_t hipsolverDnSgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                                hipsolverEigMode_t    jobz,
-                                                int                   econ,
-                                                int                   m,
-                                                int                   n,
-                                                float*                A,
-                                                int                   lda,
-                                                float*                S,
-                                                float*                U,
-                                                int                   ldu,
-                                                float*                V,
-                                                int                   ldv,
-                                                int*                  lwork,
-                                                hipsolverGesvdjInfo_t params)
+/******************** GESVD_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSgesvdj_bufferSize((cusolverDnHandle_t)handle,
-                                                        hip2cuda_evect(jobz),
-                                                        econ,
-                                                        m,
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        S,
-                                                        U,
-                                                        ldu,
-                                                        V,
-                                                        ldv,
-                                                        lwork,
-                                                        (gesvdjInfo_t)params));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDnDgesvdj_bufferSize(hipsolverDnHandle_t   handle,
-                                                hipsolverEigMode_t    jobz,
-                                                int                   econ,
-                                                int                   m,
-                                                int                   n,
-                                                double*               A,
-                                                int                   lda,
-                                                double*               S,
-                                                double*               U,
-                                                int                   ldu,
-                                                double*               V,
-                                                int                   ldv,
-                                                int*                  lwork,
-                                                hipsolverGesvdjInfo_t params)
+hipsolverStatus_t hipsolverDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDgesvdj_bufferSize((cusolverDnHandle_t)handle,
-                                                        hip2cuda_evect(jobz),
-                                                        econ,
-                                                        m,
-                                                        n,
-                                                        A,
-                                                        lda,
-                                                        S,
-                                                        U,
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           int*              lwork,
+                                                           int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                int               strideA,
+                                                float*            S,
+                                                int               strideS,
+                                                float*            U,
+                                                int               ldu,
+                                                int               strideU,
+                                                float*            V,
+                                                int               ldv,
+                                                int               strideV,
+                                                float*            work,
+                                                int               lwork,
+                                                float*            rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                int               strideA,
+                                                double*           S,
+                                                int               strideS,
+                                                double*           U,
+                                                int               ldu,
+                                                int               strideU,
+                                                double*           V,
+                                                int               ldv,
+                                                int               strideV,
+                                                double*           work,
+                                                int               lwork,
+                                                double*           rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                hipFloatComplex*  A,
+                                                int               lda,
+                                                int               strideA,
+                                                float*            S,
+                                                int               strideS,
+                                                hipFloatComplex*  U,
+                                                int               ldu,
+                                                int               strideU,
+                                                hipFloatComplex*  V,
+                                                int               ldv,
+                                                int               strideV,
+                                                hipFloatComplex*  work,
+                                                int               lwork,
+                                                float*            rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgesvdStridedBatched(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                hipDoubleComplex* A,
+                                                int               lda,
+                                                int               strideA,
+                                                double*           S,
+                                                int               strideS,
+                                                hipDoubleComplex* U,
+                                                int               ldu,
+                                                int               strideU,
+                                                hipDoubleComplex* V,
+                                                int               ldv,
+                                                int               strideV,
+                                                hipDoubleComplex* work,
+                                                int               lwork,
+                                                double*           rwork,
+                                                int               strideRwork,
+                                                int*              devInfo,
+                                                int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GESVDJ ********************/
+hipsolverStatus_t hipsolverDnSgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                                hipsolverEigMode_t    jobz,
+                                                int                   econ,
+                                                int                   m,
+                                                int                   n,
+                                                float*                A,
+                                                int                   lda,
+                                                float*                S,
+                                                float*                U,
+                                                int                   ldu,
+                                                float*                V,
+                                                int                   ldv,
+                                                int*                  lwork,
+                                                hipsolverGesvdjInfo_t params)
+try
+{
+    return cuda2hip_status(cusolverDnSgesvdj_bufferSize((cusolverDnHandle_t)handle,
+                                                        hip2cuda_evect(jobz),
+                                                        econ,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        S,
+                                                        U,
+                                                        ldu,
+                                                        V,
+                                                        ldv,
+                                                        lwork,
+                                                        (gesvdjInfo_t)params));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnDgesvdj_bufferSize(hipsolverDnHandle_t   handle,
+                                                hipsolverEigMode_t    jobz,
+                                                int                   econ,
+                                                int                   m,
+                                                int                   n,
+                                                double*               A,
+                                                int                   lda,
+                                                double*               S,
+                                                double*               U,
+                                                int                   ldu,
+                                                double*               V,
+                                                int                   ldv,
+                                                int*                  lwork,
+                                                hipsolverGesvdjInfo_t params)
+try
+{
+    return cuda2hip_status(cusolverDnDgesvdj_bufferSize((cusolverDnHandle_t)handle,
+                                                        hip2cuda_evect(jobz),
+                                                        econ,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        S,
+                                                        U,
                                                         ldu,
                                                         V,
                                                         ldv,
@@ -3198,1014 +3731,5938 @@ catch(...)
     return exception2hip_status();
 }
 
-/******************** GETRS ********************/
-hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             float*               A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             float*               B,
-                                             int                  ldb,
-                                             int*                 lwork)
+/******************** GETRF_COALESCED ********************/
+hipsolverStatus_t hipsolverSgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          float*               A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             double*              A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             double*              B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverDgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          double*              A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipFloatComplex*     A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipFloatComplex*     B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverCgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          hipFloatComplex*     A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
-                                             hipsolverOperation_t trans,
-                                             int                  n,
-                                             int                  nrhs,
-                                             hipDoubleComplex*    A,
-                                             int                  lda,
-                                             int*                 devIpiv,
-                                             hipDoubleComplex*    B,
-                                             int                  ldb,
-                                             int*                 lwork)
+hipsolverStatus_t hipsolverZgetrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          int                  m,
+                                          int                  n,
+                                          hipDoubleComplex*    A,
+                                          int                  lda,
+                                          int*                 devIpiv,
+                                          int*                 devInfo)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  float*               A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  float*               B,
-                                  int                  ldb,
-                                  float*               work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+/******************** GETRF_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        float*            A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            A,
-                                            lda,
-                                            devIpiv,
-                                            B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  double*              A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  double*              B,
-                                  int                  ldb,
-                                  double*              work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverDgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        double*           A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            A,
-                                            lda,
-                                            devIpiv,
-                                            B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipFloatComplex*     A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipFloatComplex*     B,
-                                  int                  ldb,
-                                  hipFloatComplex*     work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverCgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        hipFloatComplex*  A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnCgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            (cuComplex*)A,
-                                            lda,
-                                            devIpiv,
-                                            (cuComplex*)B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
-                                  hipsolverOperation_t trans,
-                                  int                  n,
-                                  int                  nrhs,
-                                  hipDoubleComplex*    A,
-                                  int                  lda,
-                                  int*                 devIpiv,
-                                  hipDoubleComplex*    B,
-                                  int                  ldb,
-                                  hipDoubleComplex*    work,
-                                  int                  lwork,
-                                  int*                 devInfo)
+hipsolverStatus_t hipsolverZgetrfInterleaved_bufferSize(hipsolverHandle_t handle,
+                                                        int               m,
+                                                        int               n,
+                                                        hipDoubleComplex* A,
+                                                        int               lda,
+                                                        int*              lwork,
+                                                        int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZgetrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_operation(trans),
-                                            n,
-                                            nrhs,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            devIpiv,
-                                            (cuDoubleComplex*)B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRF ********************/
-hipsolverStatus_t hipsolverSpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverSgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             float*            work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             double*           work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             hipFloatComplex*  work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfInterleaved(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             hipDoubleComplex* work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo,
+                                             int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRF_VBATCHED ********************/
+hipsolverStatus_t hipsolverSgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     float*            A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     double*           A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipFloatComplex*  A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                                     const int*        m,
+                                                     const int*        n,
+                                                     hipDoubleComplex* A[],
+                                                     const int*        lda,
+                                                     int*              lwork,
+                                                     int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          float*            A[],
+                                          const int*        lda,
+                                          float*            work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          double*           A[],
+                                          const int*        lda,
+                                          double*           work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipFloatComplex*  A[],
+                                          const int*        lda,
+                                          hipFloatComplex*  work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrfVbatched(hipsolverHandle_t handle,
+                                          const int*        m,
+                                          const int*        n,
+                                          hipDoubleComplex* A[],
+                                          const int*        lda,
+                                          hipDoubleComplex* work,
+                                          int               lwork,
+                                          int*              devIpiv,
+                                          int*              devInfo,
+                                          int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS ********************/
+hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             int*                 lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  float*               A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  float*               B,
+                                  int                  ldb,
+                                  float*               work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            devIpiv,
+                                            B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  double*              A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  double*              B,
+                                  int                  ldb,
+                                  double*              work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            devIpiv,
+                                            B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipFloatComplex*     A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipFloatComplex*     B,
+                                  int                  ldb,
+                                  hipFloatComplex*     work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            (cuComplex*)A,
+                                            lda,
+                                            devIpiv,
+                                            (cuComplex*)B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipDoubleComplex*    A,
+                                  int                  lda,
+                                  int*                 devIpiv,
+                                  hipDoubleComplex*    B,
+                                  int                  ldb,
+                                  hipDoubleComplex*    work,
+                                  int                  lwork,
+                                  int*                 devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZgetrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_operation(trans),
+                                            n,
+                                            nrhs,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            devIpiv,
+                                            (cuDoubleComplex*)B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GETRS_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        float*               A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        float*               B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        double*              A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        double*              B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        hipFloatComplex*     A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        hipFloatComplex*     B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsInterleaved_bufferSize(hipsolverHandle_t    handle,
+                                                        hipsolverOperation_t trans,
+                                                        int                  n,
+                                                        int                  nrhs,
+                                                        hipDoubleComplex*    A,
+                                                        int                  lda,
+                                                        int*                 devIpiv,
+                                                        hipDoubleComplex*    B,
+                                                        int                  ldb,
+                                                        int*                 lwork,
+                                                        int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             float*               B,
+                                             int                  ldb,
+                                             float*               work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             double*              B,
+                                             int                  ldb,
+                                             double*              work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             hipFloatComplex*     work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgetrsInterleaved(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             hipDoubleComplex*    work,
+                                             int                  lwork,
+                                             int*                 devInfo,
+                                             int                  batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV ********************/
+hipsolverStatus_t hipsolverSgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            float*            dl,
+                                            float*            d,
+                                            float*            du,
+                                            float*            B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            double*           dl,
+                                            double*           d,
+                                            double*           du,
+                                            double*           B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            hipFloatComplex*  dl,
+                                            hipFloatComplex*  d,
+                                            hipFloatComplex*  du,
+                                            hipFloatComplex*  B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsv_bufferSize(hipsolverHandle_t handle,
+                                            int               n,
+                                            int               nrhs,
+                                            hipDoubleComplex* dl,
+                                            hipDoubleComplex* d,
+                                            hipDoubleComplex* du,
+                                            hipDoubleComplex* B,
+                                            int               ldb,
+                                            int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 float*            dl,
+                                 float*            d,
+                                 float*            du,
+                                 float*            B,
+                                 int               ldb,
+                                 float*            work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 double*           dl,
+                                 double*           d,
+                                 double*           du,
+                                 double*           B,
+                                 int               ldb,
+                                 double*           work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 hipFloatComplex*  dl,
+                                 hipFloatComplex*  d,
+                                 hipFloatComplex*  du,
+                                 hipFloatComplex*  B,
+                                 int               ldb,
+                                 hipFloatComplex*  work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsv(hipsolverHandle_t handle,
+                                 int               n,
+                                 int               nrhs,
+                                 hipDoubleComplex* dl,
+                                 hipDoubleComplex* d,
+                                 hipDoubleComplex* du,
+                                 hipDoubleComplex* B,
+                                 int               ldb,
+                                 hipDoubleComplex* work,
+                                 int               lwork,
+                                 int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          float*            dl,
+                                                          float*            d,
+                                                          float*            du,
+                                                          int               strideD,
+                                                          float*            B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          double*           dl,
+                                                          double*           d,
+                                                          double*           du,
+                                                          int               strideD,
+                                                          double*           B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipFloatComplex*  dl,
+                                                          hipFloatComplex*  d,
+                                                          hipFloatComplex*  du,
+                                                          int               strideD,
+                                                          hipFloatComplex*  B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          int               nrhs,
+                                                          hipDoubleComplex* dl,
+                                                          hipDoubleComplex* d,
+                                                          hipDoubleComplex* du,
+                                                          int               strideD,
+                                                          hipDoubleComplex* B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          int*              lwork,
+                                                          int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               float*            dl,
+                                               float*            d,
+                                               float*            du,
+                                               int               strideD,
+                                               float*            B,
+                                               int               ldb,
+                                               int               strideB,
+                                               float*            work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               double*           dl,
+                                               double*           d,
+                                               double*           du,
+                                               int               strideD,
+                                               double*           B,
+                                               int               ldb,
+                                               int               strideB,
+                                               double*           work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipFloatComplex*  dl,
+                                               hipFloatComplex*  d,
+                                               hipFloatComplex*  du,
+                                               int               strideD,
+                                               hipFloatComplex*  B,
+                                               int               ldb,
+                                               int               strideB,
+                                               hipFloatComplex*  work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvStridedBatched(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipDoubleComplex* dl,
+                                               hipDoubleComplex* d,
+                                               hipDoubleComplex* du,
+                                               int               strideD,
+                                               hipDoubleComplex* B,
+                                               int               ldb,
+                                               int               strideB,
+                                               hipDoubleComplex* work,
+                                               int               lwork,
+                                               int*              devInfo,
+                                               int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV_NOPIVOT ********************/
+hipsolverStatus_t hipsolverSgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            dl,
+                                                   float*            d,
+                                                   float*            du,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           dl,
+                                                   double*           d,
+                                                   double*           du,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipFloatComplex*  dl,
+                                                   hipFloatComplex*  d,
+                                                   hipFloatComplex*  du,
+                                                   hipFloatComplex*  B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivot_bufferSize(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* dl,
+                                                   hipDoubleComplex* d,
+                                                   hipDoubleComplex* du,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   int*              lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        float*            dl,
+                                        float*            d,
+                                        float*            du,
+                                        float*            B,
+                                        int               ldb,
+                                        float*            work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           dl,
+                                        double*           d,
+                                        double*           du,
+                                        double*           B,
+                                        int               ldb,
+                                        double*           work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        hipFloatComplex*  dl,
+                                        hipFloatComplex*  d,
+                                        hipFloatComplex*  du,
+                                        hipFloatComplex*  B,
+                                        int               ldb,
+                                        hipFloatComplex*  work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivot(hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        hipDoubleComplex* dl,
+                                        hipDoubleComplex* d,
+                                        hipDoubleComplex* du,
+                                        hipDoubleComplex* B,
+                                        int               ldb,
+                                        hipDoubleComplex* work,
+                                        int               lwork,
+                                        int*              devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** GTSV_NOPIVOT_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 float*            dl,
+                                                                 float*            d,
+                                                                 float*            du,
+                                                                 int               strideD,
+                                                                 float*            B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 double*           dl,
+                                                                 double*           d,
+                                                                 double*           du,
+                                                                 int               strideD,
+                                                                 double*           B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 hipFloatComplex*  dl,
+                                                                 hipFloatComplex*  d,
+                                                                 hipFloatComplex*  du,
+                                                                 int               strideD,
+                                                                 hipFloatComplex*  B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivotStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               nrhs,
+                                                                 hipDoubleComplex* dl,
+                                                                 hipDoubleComplex* d,
+                                                                 hipDoubleComplex* du,
+                                                                 int               strideD,
+                                                                 hipDoubleComplex* B,
+                                                                 int               ldb,
+                                                                 int               strideB,
+                                                                 int*              lwork,
+                                                                 int               batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      float*            dl,
+                                                      float*            d,
+                                                      float*            du,
+                                                      int               strideD,
+                                                      float*            B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      float*            work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      double*           dl,
+                                                      double*           d,
+                                                      double*           du,
+                                                      int               strideD,
+                                                      double*           B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      double*           work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      hipFloatComplex*  dl,
+                                                      hipFloatComplex*  d,
+                                                      hipFloatComplex*  du,
+                                                      int               strideD,
+                                                      hipFloatComplex*  B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      hipFloatComplex*  work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZgtsvNopivotStridedBatched(hipsolverHandle_t handle,
+                                                      int               n,
+                                                      int               nrhs,
+                                                      hipDoubleComplex* dl,
+                                                      hipDoubleComplex* d,
+                                                      hipDoubleComplex* du,
+                                                      int               strideD,
+                                                      hipDoubleComplex* B,
+                                                      int               ldb,
+                                                      int               strideB,
+                                                      hipDoubleComplex* work,
+                                                      int               lwork,
+                                                      int*              devInfo,
+                                                      int               batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRF ********************/
+hipsolverStatus_t hipsolverSpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             float*              AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             double*             AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             hipFloatComplex*    AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             hipDoubleComplex*   AB,
+                                             int                 ldab,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  float*              AB,
+                                  int                 ldab,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  double*             AB,
+                                  int                 ldab,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  hipFloatComplex*    AB,
+                                  int                 ldab,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  hipDoubleComplex*   AB,
+                                  int                 ldab,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRF_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           float*              AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           double*             AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           hipFloatComplex*    AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           hipDoubleComplex*   AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                float*              AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                double*             AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                hipFloatComplex*    AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipFloatComplex*    work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                hipDoubleComplex*   AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipDoubleComplex*   work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRS ********************/
+hipsolverStatus_t hipsolverSpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             float*              AB,
+                                             int                 ldab,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             double*             AB,
+                                             int                 ldab,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             hipFloatComplex*    AB,
+                                             int                 ldab,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   AB,
+                                             int                 ldab,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  float*              AB,
+                                  int                 ldab,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  double*             AB,
+                                  int                 ldab,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  hipFloatComplex*    AB,
+                                  int                 ldab,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   AB,
+                                  int                 ldab,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PBTRS_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           float*              AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           float*              B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           double*             AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           double*             B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           hipFloatComplex*    AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           hipFloatComplex*    B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 kd,
+                                                           int                 nrhs,
+                                                           hipDoubleComplex*   AB,
+                                                           int                 ldab,
+                                                           int                 strideAB,
+                                                           hipDoubleComplex*   B,
+                                                           int                 ldb,
+                                                           int                 strideB,
+                                                           int*                lwork,
+                                                           int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                float*              AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                float*              B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                float*              work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                double*             AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                double*             B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                double*             work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                hipFloatComplex*    AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipFloatComplex*    B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                hipFloatComplex*    work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 kd,
+                                                int                 nrhs,
+                                                hipDoubleComplex*   AB,
+                                                int                 ldab,
+                                                int                 strideAB,
+                                                hipDoubleComplex*   B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                hipDoubleComplex*   work,
+                                                int                 lwork,
+                                                int*                devInfo,
+                                                int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV ********************/
+// posv runs potrf, then potrs only if the factorization succeeded, so that B is not modified
+// otherwise. Reading devInfo synchronizes the stream of the handle.
+static hipsolverStatus_t
+    hipsolver_posv_info(hipsolverHandle_t handle, const int* devInfo, int* info)
+{
+    cudaStream_t     stream;
+    cusolverStatus_t status = cusolverDnGetStream((cusolverDnHandle_t)handle, &stream);
+    if(status != CUSOLVER_STATUS_SUCCESS)
+        return cuda2hip_status(status);
+
+    if(cudaMemcpyAsync(info, devInfo, sizeof(int), cudaMemcpyDeviceToHost, stream) != cudaSuccess
+       || cudaStreamSynchronize(stream) != cudaSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+hipsolverStatus_t hipsolverSposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            float*              A,
+                                            int                 lda,
+                                            float*              B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            double*             A,
+                                            int                 lda,
+                                            double*             B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipFloatComplex*    A,
+                                            int                 lda,
+                                            hipFloatComplex*    B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    return hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposv_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipDoubleComplex*   A,
+                                            int                 lda,
+                                            hipDoubleComplex*   B,
+                                            int                 ldb,
+                                            int*                lwork)
+try
+{
+    return hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 float*              A,
+                                 int                 lda,
+                                 float*              B,
+                                 int                 ldb,
+                                 float*              work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nrhs < 0 || ldb < n || ldb < 1 || (n && nrhs && !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverStatus_t status = hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+    if(status != HIPSOLVER_STATUS_SUCCESS || n == 0 || nrhs == 0)
+        return status;
+
+    int info;
+    status = hipsolver_posv_info(handle, devInfo, &info);
+    if(status != HIPSOLVER_STATUS_SUCCESS || info != 0)
+        return status;
+
+    return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 double*             A,
+                                 int                 lda,
+                                 double*             B,
+                                 int                 ldb,
+                                 double*             work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nrhs < 0 || ldb < n || ldb < 1 || (n && nrhs && !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverStatus_t status = hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+    if(status != HIPSOLVER_STATUS_SUCCESS || n == 0 || nrhs == 0)
+        return status;
+
+    int info;
+    status = hipsolver_posv_info(handle, devInfo, &info);
+    if(status != HIPSOLVER_STATUS_SUCCESS || info != 0)
+        return status;
+
+    return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 hipFloatComplex*    A,
+                                 int                 lda,
+                                 hipFloatComplex*    B,
+                                 int                 ldb,
+                                 hipFloatComplex*    work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nrhs < 0 || ldb < n || ldb < 1 || (n && nrhs && !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverStatus_t status = hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+    if(status != HIPSOLVER_STATUS_SUCCESS || n == 0 || nrhs == 0)
+        return status;
+
+    int info;
+    status = hipsolver_posv_info(handle, devInfo, &info);
+    if(status != HIPSOLVER_STATUS_SUCCESS || info != 0)
+        return status;
+
+    return hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposv(hipsolverHandle_t   handle,
+                                 hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 hipDoubleComplex*   A,
+                                 int                 lda,
+                                 hipDoubleComplex*   B,
+                                 int                 ldb,
+                                 hipDoubleComplex*   work,
+                                 int                 lwork,
+                                 int*                devInfo)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(nrhs < 0 || ldb < n || ldb < 1 || (n && nrhs && !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverStatus_t status = hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+    if(status != HIPSOLVER_STATUS_SUCCESS || n == 0 || nrhs == 0)
+        return status;
+
+    int info;
+    status = hipsolver_posv_info(handle, devInfo, &info);
+    if(status != HIPSOLVER_STATUS_SUCCESS || info != 0)
+        return status;
+
+    return hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, devInfo);
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV_BATCHED ********************/
+// cusolverDn<type>potrsBatched only solves a single right-hand side, and cuSOLVER has no strided
+// batched potrf, so the batched variants of posv are not supported
+hipsolverStatus_t hipsolverSposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A[],
+                                                   int                 lda,
+                                                   float*              B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A[],
+                                                   int                 lda,
+                                                   double*             B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    A[],
+                                                   int                 lda,
+                                                   hipFloatComplex*    B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   A[],
+                                                   int                 lda,
+                                                   hipDoubleComplex*   B[],
+                                                   int                 ldb,
+                                                   int*                lwork,
+                                                   int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A[],
+                                        int                 lda,
+                                        float*              B[],
+                                        int                 ldb,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A[],
+                                        int                 lda,
+                                        double*             B[],
+                                        int                 ldb,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipFloatComplex*    A[],
+                                        int                 lda,
+                                        hipFloatComplex*    B[],
+                                        int                 ldb,
+                                        hipFloatComplex*    work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvBatched(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipDoubleComplex*   A[],
+                                        int                 lda,
+                                        hipDoubleComplex*   B[],
+                                        int                 ldb,
+                                        hipDoubleComplex*   work,
+                                        int                 lwork,
+                                        int*                devInfo,
+                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POSV_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipFloatComplex*    A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          hipFloatComplex*    B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipDoubleComplex*   A,
+                                                          int                 lda,
+                                                          int                 strideA,
+                                                          hipDoubleComplex*   B,
+                                                          int                 ldb,
+                                                          int                 strideB,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipFloatComplex*    A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipFloatComplex*    B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               hipFloatComplex*    work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZposvStridedBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipDoubleComplex*   A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipDoubleComplex*   B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               hipDoubleComplex*   work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF ********************/
+hipsolverStatus_t hipsolverSpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSpotrf_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDpotrf_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCpotrf_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZpotrf_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuDoubleComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSpotrf(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDpotrf(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCpotrf((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZpotrf((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return cuda2hip_status(cusolverDnSpotrfBatched(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return cuda2hip_status(cusolverDnDpotrfBatched(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, devInfo, batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return cuda2hip_status(cusolverDnCpotrfBatched((cusolverDnHandle_t)handle,
+                                                   hip2cuda_fill(uplo),
+                                                   n,
+                                                   (cuComplex**)A,
+                                                   lda,
+                                                   devInfo,
+                                                   batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return cuda2hip_status(cusolverDnZpotrfBatched((cusolverDnHandle_t)handle,
+                                                   hip2cuda_fill(uplo),
+                                                   n,
+                                                   (cuDoubleComplex**)A,
+                                                   lda,
+                                                   devInfo,
+                                                   batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_COALESCED ********************/
+hipsolverStatus_t hipsolverSpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          float*               A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          double*              A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          hipFloatComplex*     A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfCoalesced(hipsolverHandle_t    handle,
+                                          hipsolverCoalescer_t coalescer,
+                                          hipsolverFillMode_t  uplo,
+                                          int                  n,
+                                          hipDoubleComplex*    A,
+                                          int                  lda,
+                                          int*                 devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        float*              A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        double*             A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        hipFloatComplex*    A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        hipDoubleComplex*   A,
+                                                        int                 lda,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_PIPELINED ********************/
+hipsolverStatus_t hipsolverSpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           float*              A,
+                                           int                 lda,
+                                           float*              B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           double*             A,
+                                           int                 lda,
+                                           double*             B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           hipFloatComplex*    A,
+                                           int                 lda,
+                                           hipFloatComplex*    B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfPipelined(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           int                 n,
+                                           int                 nrhs,
+                                           hipDoubleComplex*   A,
+                                           int                 lda,
+                                           hipDoubleComplex*   B,
+                                           int                 ldb,
+                                           int*                info,
+                                           int                 batch_count,
+                                           int                 chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_VBATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     float*              A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     double*             A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     hipFloatComplex*    A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     hipDoubleComplex*   A[],
+                                                     const int*          lda,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          float*              A[],
+                                          const int*          lda,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          double*             A[],
+                                          const int*          lda,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          hipFloatComplex*    A[],
+                                          const int*          lda,
+                                          hipFloatComplex*    work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          hipDoubleComplex*   A[],
+                                          const int*          lda,
+                                          hipDoubleComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_UPDATE ********************/
+hipsolverStatus_t hipsolverSpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float*              V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double*             V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   hipFloatComplex*    V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   hipDoubleComplex*   V,
+                                                   int                 ldv,
+                                                   int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        float*              A,
+                                        int                 lda,
+                                        float*              V,
+                                        int                 ldv,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        double*             A,
+                                        int                 lda,
+                                        double*             V,
+                                        int                 ldv,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        hipFloatComplex*    A,
+                                        int                 lda,
+                                        hipFloatComplex*    V,
+                                        int                 ldv,
+                                        hipFloatComplex*    work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdate(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 k,
+                                        hipDoubleComplex*   A,
+                                        int                 lda,
+                                        hipDoubleComplex*   V,
+                                        int                 ldv,
+                                        hipDoubleComplex*   work,
+                                        int                 lwork,
+                                        int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_UPDATE_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipFloatComplex*    A[],
+                                                          int                 lda,
+                                                          hipFloatComplex*    V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipDoubleComplex*   A[],
+                                                          int                 lda,
+                                                          hipDoubleComplex*   V[],
+                                                          int                 ldv,
+                                                          int*                lwork,
+                                                          int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               float*              A[],
+                                               int                 lda,
+                                               float*              V[],
+                                               int                 ldv,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               double*             A[],
+                                               int                 lda,
+                                               double*             V[],
+                                               int                 ldv,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               hipFloatComplex*    A[],
+                                               int                 lda,
+                                               hipFloatComplex*    V[],
+                                               int                 ldv,
+                                               hipFloatComplex*    work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 k,
+                                               hipDoubleComplex*   A[],
+                                               int                 lda,
+                                               hipDoubleComplex*   V[],
+                                               int                 ldv,
+                                               hipDoubleComplex*   work,
+                                               int                 lwork,
+                                               int*                devInfo,
+                                               int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_UPDATE_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipFloatComplex*    V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipDoubleComplex*   V,
+                                                                 int                 ldv,
+                                                                 int                 strideV,
+                                                                 int*                lwork,
+                                                                 int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      float*              V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      float*              work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      double*             V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      double*             work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      hipFloatComplex*    V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      hipFloatComplex*    work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfUpdateStridedBatched(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 k,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      int                 strideA,
+                                                      hipDoubleComplex*   V,
+                                                      int                 ldv,
+                                                      int                 strideV,
+                                                      hipDoubleComplex*   work,
+                                                      int                 lwork,
+                                                      int*                devInfo,
+                                                      int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_DOWNDATE ********************/
+hipsolverStatus_t hipsolverSpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     float*              V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     double*             V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipFloatComplex*    A,
+                                                     int                 lda,
+                                                     hipFloatComplex*    V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndate_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 k,
+                                                     hipDoubleComplex*   A,
+                                                     int                 lda,
+                                                     hipDoubleComplex*   V,
+                                                     int                 ldv,
+                                                     int*                lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          float*              A,
+                                          int                 lda,
+                                          float*              V,
+                                          int                 ldv,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          double*             A,
+                                          int                 lda,
+                                          double*             V,
+                                          int                 ldv,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          hipFloatComplex*    A,
+                                          int                 lda,
+                                          hipFloatComplex*    V,
+                                          int                 ldv,
+                                          hipFloatComplex*    work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndate(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          int                 k,
+                                          hipDoubleComplex*   A,
+                                          int                 lda,
+                                          hipDoubleComplex*   V,
+                                          int                 ldv,
+                                          hipDoubleComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_DOWNDATE_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            float*              A[],
+                                                            int                 lda,
+                                                            float*              V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            double*             A[],
+                                                            int                 lda,
+                                                            double*             V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            hipFloatComplex*    A[],
+                                                            int                 lda,
+                                                            hipFloatComplex*    V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateBatched_bufferSize(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 k,
+                                                            hipDoubleComplex*   A[],
+                                                            int                 lda,
+                                                            hipDoubleComplex*   V[],
+                                                            int                 ldv,
+                                                            int*                lwork,
+                                                            int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 float*              A[],
+                                                 int                 lda,
+                                                 float*              V[],
+                                                 int                 ldv,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 double*             A[],
+                                                 int                 lda,
+                                                 double*             V[],
+                                                 int                 ldv,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 hipFloatComplex*    A[],
+                                                 int                 lda,
+                                                 hipFloatComplex*    V[],
+                                                 int                 ldv,
+                                                 hipFloatComplex*    work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 int                 k,
+                                                 hipDoubleComplex*   A[],
+                                                 int                 lda,
+                                                 hipDoubleComplex*   V[],
+                                                 int                 ldv,
+                                                 hipDoubleComplex*   work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRF_DOWNDATE_STRIDED_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   float*              A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   float*              V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   double*             A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   double*             V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   hipFloatComplex*    A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   hipFloatComplex*    V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 k,
+                                                                   hipDoubleComplex*   A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   hipDoubleComplex*   V,
+                                                                   int                 ldv,
+                                                                   int                 strideV,
+                                                                   int*                lwork,
+                                                                   int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        float*              A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        float*              V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        float*              work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        double*             A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        double*             V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        double*             work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        hipFloatComplex*    A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        hipFloatComplex*    V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        hipFloatComplex*    work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrfDowndateStridedBatched(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 k,
+                                                        hipDoubleComplex*   A,
+                                                        int                 lda,
+                                                        int                 strideA,
+                                                        hipDoubleComplex*   V,
+                                                        int                 ldv,
+                                                        int                 strideV,
+                                                        hipDoubleComplex*   work,
+                                                        int                 lwork,
+                                                        int*                devInfo,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRI ********************/
+hipsolverStatus_t hipsolverSpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnSpotri_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+try
+{
+    return cuda2hip_status(cusolverDnDpotri_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotri_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnCpotri_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotri_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int*                lwork)
+try
+{
+    return cuda2hip_status(cusolverDnZpotri_bufferSize(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuDoubleComplex*)A, lda, lwork));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSpotri(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDpotri(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCpotri((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZpotri((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)work,
+                                            lwork,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRS ********************/
+hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  float*              A,
+                                  int                 lda,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnSpotrs(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, nrhs, A, lda, B, ldb, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  double*             A,
+                                  int                 lda,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnDpotrs(
+        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, nrhs, A, lda, B, ldb, devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnCpotrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            nrhs,
+                                            (cuComplex*)A,
+                                            lda,
+                                            (cuComplex*)B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
+try
+{
+    return cuda2hip_status(cusolverDnZpotrs((cusolverDnHandle_t)handle,
+                                            hip2cuda_fill(uplo),
+                                            n,
+                                            nrhs,
+                                            (cuDoubleComplex*)A,
+                                            lda,
+                                            (cuDoubleComplex*)B,
+                                            ldb,
+                                            devInfo));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** POTRS_BATCHED ********************/
+hipsolverStatus_t hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipFloatComplex*    A[],
+                                                    int                 lda,
+                                                    hipFloatComplex*    B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipDoubleComplex*   A[],
+                                                    int                 lda,
+                                                    hipDoubleComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+try
+{
+    *lwork = 0;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              B[],
+                                         int                 ldb,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return cuda2hip_status(cusolverDnSpotrsBatched((cusolverDnHandle_t)handle,
+                                                   hip2cuda_fill(uplo),
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   devInfo,
+                                                   batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             B[],
+                                         int                 ldb,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+try
+{
+    return cuda2hip_status(cusolverDnDpotrsBatched((cusolverDnHandle_t)handle,
+                                                   hip2cuda_fill(uplo),
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   devInfo,
+                                                   batch_count));
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    B[],
+                                         int                 ldb,
+                                         hipFloatComplex*    work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSpotrf_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+    return cuda2hip_status(cusolverDnCpotrsBatched((cusolverDnHandle_t)handle,
+                                                   hip2cuda_fill(uplo),
+                                                   n,
+                                                   nrhs,
+                                                   (cuComplex**)A,
+                                                   lda,
+                                                   (cuComplex**)B,
+                                                   ldb,
+                                                   devInfo,
+                                                   batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   B[],
+                                         int                 ldb,
+                                         hipDoubleComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDpotrf_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+    return cuda2hip_status(cusolverDnZpotrsBatched((cusolverDnHandle_t)handle,
+                                                   hip2cuda_fill(uplo),
+                                                   n,
+                                                   nrhs,
+                                                   (cuDoubleComplex**)A,
+                                                   lda,
+                                                   (cuDoubleComplex**)B,
+                                                   ldb,
+                                                   devInfo,
+                                                   batch_count));
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
+/******************** POTRS_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        float*              A,
+                                                        int                 lda,
+                                                        float*              B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        double*             A,
+                                                        int                 lda,
+                                                        double*             B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        hipFloatComplex*    A,
+                                                        int                 lda,
+                                                        hipFloatComplex*    B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsInterleaved_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        int                 nrhs,
+                                                        hipDoubleComplex*   A,
+                                                        int                 lda,
+                                                        hipDoubleComplex*   B,
+                                                        int                 ldb,
+                                                        int*                lwork,
+                                                        int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrsInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              B,
+                                             int                 ldb,
+                                             float*              work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsInterleaved(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             B,
+                                             int                 ldb,
+                                             double*             work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsInterleaved(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              hipFloatComplex*    A,
                                              int                 lda,
-                                             int*                lwork)
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             hipFloatComplex*    work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnCpotrf_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZpotrsInterleaved(hipsolverHandle_t   handle,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
+                                             int                 nrhs,
                                              hipDoubleComplex*   A,
                                              int                 lda,
-                                             int*                lwork)
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             hipDoubleComplex*   work,
+                                             int                 lwork,
+                                             int*                devInfo,
+                                             int                 batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZpotrf_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuDoubleComplex*)A, lda, lwork));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
+/******************** POTRS_VBATCHED ********************/
+hipsolverStatus_t hipsolverSpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     float*              A[],
+                                                     const int*          lda,
+                                                     float*              B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     double*             A[],
+                                                     const int*          lda,
+                                                     double*             B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     hipFloatComplex*    A[],
+                                                     const int*          lda,
+                                                     hipFloatComplex*    B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsVbatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     const int*          n,
+                                                     const int*          nrhs,
+                                                     hipDoubleComplex*   A[],
+                                                     const int*          lda,
+                                                     hipDoubleComplex*   B[],
+                                                     const int*          ldb,
+                                                     int*                lwork,
+                                                     int                 batch_count)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          float*              A[],
+                                          const int*          lda,
+                                          float*              B[],
+                                          const int*          ldb,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          double*             A[],
+                                          const int*          lda,
+                                          double*             B[],
+                                          const int*          ldb,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          hipFloatComplex*    A[],
+                                          const int*          lda,
+                                          hipFloatComplex*    B[],
+                                          const int*          ldb,
+                                          hipFloatComplex*    work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpotrsVbatched(hipsolverHandle_t   handle,
+                                          hipsolverFillMode_t uplo,
+                                          const int*          n,
+                                          const int*          nrhs,
+                                          hipDoubleComplex*   A[],
+                                          const int*          lda,
+                                          hipDoubleComplex*   B[],
+                                          const int*          ldb,
+                                          hipDoubleComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+/******************** PPTRF ********************/
+hipsolverStatus_t hipsolverSpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, int* lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, int* lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipFloatComplex* AP, int* lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZpptrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, hipDoubleComplex* AP, int* lwork)
+try
+{
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSpptrf(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  float*              A,
-                                  int                 lda,
+                                  float*              AP,
                                   float*              work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnSpotrf(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDpptrf(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  double*             A,
-                                  int                 lda,
+                                  double*             AP,
                                   double*             work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnDpotrf(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverCpptrf(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
+                                  hipFloatComplex*    AP,
                                   hipFloatComplex*    work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnCpotrf((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZpptrf(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
+                                  hipDoubleComplex*   AP,
                                   hipDoubleComplex*   work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnZpotrf((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRF_BATCHED ********************/
-hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+/******************** PPTRS ********************/
+hipsolverStatus_t hipsolverSpptrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              AP,
+                                             float*              B,
+                                             int                 ldb,
+                                             int*                lwork)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDpptrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             AP,
+                                             double*             B,
+                                             int                 ldb,
+                                             int*                lwork)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipFloatComplex*    A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverCpptrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    AP,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int*                lwork)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipDoubleComplex*   A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverZpptrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   AP,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int*                lwork)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A[],
-                                         int                 lda,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverSpptrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  float*              AP,
+                                  float*              B,
+                                  int                 ldb,
+                                  float*              work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnSpotrfBatched(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, devInfo, batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A[],
-                                         int                 lda,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDpptrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  double*             AP,
+                                  double*             B,
+                                  int                 ldb,
+                                  double*             work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnDpotrfBatched(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, devInfo, batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipFloatComplex*    A[],
-                                         int                 lda,
-                                         hipFloatComplex*    work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverCpptrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipFloatComplex*    AP,
+                                  hipFloatComplex*    B,
+                                  int                 ldb,
+                                  hipFloatComplex*    work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnCpotrfBatched((cusolverDnHandle_t)handle,
-                                                   hip2cuda_fill(uplo),
-                                                   n,
-                                                   (cuComplex**)A,
-                                                   lda,
-                                                   devInfo,
-                                                   batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipDoubleComplex*   A[],
-                                         int                 lda,
-                                         hipDoubleComplex*   work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverZpptrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 nrhs,
+                                  hipDoubleComplex*   AP,
+                                  hipDoubleComplex*   B,
+                                  int                 ldb,
+                                  hipDoubleComplex*   work,
+                                  int                 lwork,
+                                  int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnZpotrfBatched((cusolverDnHandle_t)handle,
-                                                   hip2cuda_fill(uplo),
-                                                   n,
-                                                   (cuDoubleComplex**)A,
-                                                   lda,
-                                                   devInfo,
-                                                   batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRI ********************/
-hipsolverStatus_t hipsolverSpotri_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+/******************** SPEVD/HPEVD ********************/
+hipsolverStatus_t hipsolverSspevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              AP,
+                                             float*              D,
+                                             float*              Z,
+                                             int                 ldz,
+                                             int*                lwork)
 try
 {
-    return cuda2hip_status(cusolverDnSpotri_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotri_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+hipsolverStatus_t hipsolverDspevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             AP,
+                                             double*             D,
+                                             double*             Z,
+                                             int                 ldz,
+                                             int*                lwork)
 try
 {
-    return cuda2hip_status(cusolverDnDpotri_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, lwork));
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotri_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverChpevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
+                                             hipFloatComplex*    AP,
+                                             float*              D,
+                                             hipFloatComplex*    Z,
+                                             int                 ldz,
                                              int*                lwork)
 try
 {
-    return cuda2hip_status(cusolverDnCpotri_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuComplex*)A, lda, lwork));
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotri_bufferSize(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZhpevd_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
                                              hipsolverFillMode_t uplo,
                                              int                 n,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
+                                             hipDoubleComplex*   AP,
+                                             double*             D,
+                                             hipDoubleComplex*   Z,
+                                             int                 ldz,
                                              int*                lwork)
 try
 {
-    return cuda2hip_status(cusolverDnZpotri_bufferSize(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, (cuDoubleComplex*)A, lda, lwork));
+    if(lwork != nullptr)
+        *lwork = 0;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverSspevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  float*              A,
-                                  int                 lda,
+                                  float*              AP,
+                                  float*              D,
+                                  float*              Z,
+                                  int                 ldz,
                                   float*              work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnSpotri(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverDspevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  double*             A,
-                                  int                 lda,
+                                  double*             AP,
+                                  double*             D,
+                                  double*             Z,
+                                  int                 ldz,
                                   double*             work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnDpotri(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, A, lda, work, lwork, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverChpevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  hipFloatComplex*    A,
-                                  int                 lda,
+                                  hipFloatComplex*    AP,
+                                  float*              D,
+                                  hipFloatComplex*    Z,
+                                  int                 ldz,
                                   hipFloatComplex*    work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnCpotri((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZhpevd(hipsolverHandle_t   handle,
+                                  hipsolverEigMode_t  jobz,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  hipDoubleComplex*   A,
-                                  int                 lda,
+                                  hipDoubleComplex*   AP,
+                                  double*             D,
+                                  hipDoubleComplex*   Z,
+                                  int                 ldz,
                                   hipDoubleComplex*   work,
                                   int                 lwork,
                                   int*                devInfo)
 try
 {
-    return cuda2hip_status(cusolverDnZpotri((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)work,
-                                            lwork,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRS ********************/
-hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             float*              A,
-                                             int                 lda,
-                                             float*              B,
-                                             int                 ldb,
-                                             int*                lwork)
+/******************** TRTTP ********************/
+hipsolverStatus_t hipsolverStrttp(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, float* AP)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             double*             A,
-                                             int                 lda,
-                                             double*             B,
-                                             int                 ldb,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverDtrttp(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, double* AP)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             hipFloatComplex*    A,
-                                             int                 lda,
-                                             hipFloatComplex*    B,
-                                             int                 ldb,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverCtrttp(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipFloatComplex*    A,
+                                  int                 lda,
+                                  hipFloatComplex*    AP)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrs_bufferSize(hipsolverHandle_t   handle,
-                                             hipsolverFillMode_t uplo,
-                                             int                 n,
-                                             int                 nrhs,
-                                             hipDoubleComplex*   A,
-                                             int                 lda,
-                                             hipDoubleComplex*   B,
-                                             int                 ldb,
-                                             int*                lwork)
+hipsolverStatus_t hipsolverZtrttp(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  hipDoubleComplex*   A,
+                                  int                 lda,
+                                  hipDoubleComplex*   AP)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrs(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  int                 nrhs,
-                                  float*              A,
-                                  int                 lda,
-                                  float*              B,
-                                  int                 ldb,
-                                  float*              work,
-                                  int                 lwork,
-                                  int*                devInfo)
+/******************** TPTTR ********************/
+hipsolverStatus_t hipsolverStpttr(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* AP, float* A, int lda)
 try
 {
-    return cuda2hip_status(cusolverDnSpotrs(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, nrhs, A, lda, B, ldb, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrs(hipsolverHandle_t   handle,
-                                  hipsolverFillMode_t uplo,
-                                  int                 n,
-                                  int                 nrhs,
-                                  double*             A,
-                                  int                 lda,
-                                  double*             B,
-                                  int                 ldb,
-                                  double*             work,
-                                  int                 lwork,
-                                  int*                devInfo)
+hipsolverStatus_t hipsolverDtpttr(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* AP, double* A, int lda)
 try
 {
-    return cuda2hip_status(cusolverDnDpotrs(
-        (cusolverDnHandle_t)handle, hip2cuda_fill(uplo), n, nrhs, A, lda, B, ldb, devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrs(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverCtpttr(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  int                 nrhs,
+                                  hipFloatComplex*    AP,
                                   hipFloatComplex*    A,
-                                  int                 lda,
-                                  hipFloatComplex*    B,
-                                  int                 ldb,
-                                  hipFloatComplex*    work,
-                                  int                 lwork,
-                                  int*                devInfo)
+                                  int                 lda)
 try
 {
-    return cuda2hip_status(cusolverDnCpotrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            nrhs,
-                                            (cuComplex*)A,
-                                            lda,
-                                            (cuComplex*)B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t   handle,
+hipsolverStatus_t hipsolverZtpttr(hipsolverHandle_t   handle,
                                   hipsolverFillMode_t uplo,
                                   int                 n,
-                                  int                 nrhs,
+                                  hipDoubleComplex*   AP,
                                   hipDoubleComplex*   A,
-                                  int                 lda,
-                                  hipDoubleComplex*   B,
-                                  int                 ldb,
-                                  hipDoubleComplex*   work,
-                                  int                 lwork,
-                                  int*                devInfo)
+                                  int                 lda)
 try
 {
-    return cuda2hip_status(cusolverDnZpotrs((cusolverDnHandle_t)handle,
-                                            hip2cuda_fill(uplo),
-                                            n,
-                                            nrhs,
-                                            (cuDoubleComplex*)A,
-                                            lda,
-                                            (cuDoubleComplex*)B,
-                                            ldb,
-                                            devInfo));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-/******************** POTRS_BATCHED ********************/
-hipsolverStatus_t hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    float*              B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+/******************** INTERLEAVED_TO_STRIDED ********************/
+hipsolverStatus_t hipsolverSinterleavedToStrided(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const float*      A,
+                                                 int               lda,
+                                                 float*            B,
+                                                 int               ldb,
+                                                 int               strideB,
+                                                 int               batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    double*             B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverDinterleavedToStrided(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const double*     A,
+                                                 int               lda,
+                                                 double*           B,
+                                                 int               ldb,
+                                                 int               strideB,
+                                                 int               batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipFloatComplex*    A[],
-                                                    int                 lda,
-                                                    hipFloatComplex*    B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverCinterleavedToStrided(hipsolverHandle_t      handle,
+                                                 int                    m,
+                                                 int                    n,
+                                                 const hipFloatComplex* A,
+                                                 int                    lda,
+                                                 hipFloatComplex*       B,
+                                                 int                    ldb,
+                                                 int                    strideB,
+                                                 int                    batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrsBatched_bufferSize(hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipDoubleComplex*   A[],
-                                                    int                 lda,
-                                                    hipDoubleComplex*   B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 batch_count)
+hipsolverStatus_t hipsolverZinterleavedToStrided(hipsolverHandle_t       handle,
+                                                 int                     m,
+                                                 int                     n,
+                                                 const hipDoubleComplex* A,
+                                                 int                     lda,
+                                                 hipDoubleComplex*       B,
+                                                 int                     ldb,
+                                                 int                     strideB,
+                                                 int                     batch_count)
 try
 {
-    *lwork = 0;
-    return HIPSOLVER_STATUS_SUCCESS;
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverSpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         float*              A[],
-                                         int                 lda,
-                                         float*              B[],
-                                         int                 ldb,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+/******************** STRIDED_TO_INTERLEAVED ********************/
+hipsolverStatus_t hipsolverSstridedToInterleaved(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const float*      A,
+                                                 int               lda,
+                                                 int               strideA,
+                                                 float*            B,
+                                                 int               ldb,
+                                                 int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnSpotrsBatched((cusolverDnHandle_t)handle,
-                                                   hip2cuda_fill(uplo),
-                                                   n,
-                                                   nrhs,
-                                                   A,
-                                                   lda,
-                                                   B,
-                                                   ldb,
-                                                   devInfo,
-                                                   batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverDpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         double*             A[],
-                                         int                 lda,
-                                         double*             B[],
-                                         int                 ldb,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverDstridedToInterleaved(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 const double*     A,
+                                                 int               lda,
+                                                 int               strideA,
+                                                 double*           B,
+                                                 int               ldb,
+                                                 int               batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnDpotrsBatched((cusolverDnHandle_t)handle,
-                                                   hip2cuda_fill(uplo),
-                                                   n,
-                                                   nrhs,
-                                                   A,
-                                                   lda,
-                                                   B,
-                                                   ldb,
-                                                   devInfo,
-                                                   batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverCpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipFloatComplex*    A[],
-                                         int                 lda,
-                                         hipFloatComplex*    B[],
-                                         int                 ldb,
-                                         hipFloatComplex*    work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverCstridedToInterleaved(hipsolverHandle_t      handle,
+                                                 int                    m,
+                                                 int                    n,
+                                                 const hipFloatComplex* A,
+                                                 int                    lda,
+                                                 int                    strideA,
+                                                 hipFloatComplex*       B,
+                                                 int                    ldb,
+                                                 int                    batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnCpotrsBatched((cusolverDnHandle_t)handle,
-                                                   hip2cuda_fill(uplo),
-                                                   n,
-                                                   nrhs,
-                                                   (cuComplex**)A,
-                                                   lda,
-                                                   (cuComplex**)B,
-                                                   ldb,
-                                                   devInfo,
-                                                   batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
     return exception2hip_status();
 }
 
-hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipDoubleComplex*   A[],
-                                         int                 lda,
-                                         hipDoubleComplex*   B[],
-                                         int                 ldb,
-                                         hipDoubleComplex*   work,
-                                         int                 lwork,
-                                         int*                devInfo,
-                                         int                 batch_count)
+hipsolverStatus_t hipsolverZstridedToInterleaved(hipsolverHandle_t       handle,
+                                                 int                     m,
+                                                 int                     n,
+                                                 const hipDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     strideA,
+                                                 hipDoubleComplex*       B,
+                                                 int                     ldb,
+                                                 int                     batch_count)
 try
 {
-    return cuda2hip_status(cusolverDnZpotrsBatched((cusolverDnHandle_t)handle,
-                                                   hip2cuda_fill(uplo),
-                                                   n,
-                                                   nrhs,
-                                                   (cuDoubleComplex**)A,
-                                                   lda,
-                                                   (cuDoubleComplex**)B,
-                                                   ldb,
-                                                   devInfo,
-                                                   batch_count));
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
 }
 catch(...)
 {
@@ -4887,6 +10344,87 @@ catch(...)
     return exception2hip_status();
 }
 
+/******************** SYEVJ_PIPELINED/HEEVJ_PIPELINED ********************/
+hipsolverStatus_t hipsolverSsyevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           float*               A,
+                                           int                  lda,
+                                           float*               W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           double*              A,
+                                           int                  lda,
+                                           double*              W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           hipFloatComplex*     A,
+                                           int                  lda,
+                                           float*               W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevjPipelined(hipsolverHandle_t    handle,
+                                           hipsolverEigMode_t   jobz,
+                                           hipsolverFillMode_t  uplo,
+                                           int                  n,
+                                           hipDoubleComplex*    A,
+                                           int                  lda,
+                                           double*              W,
+                                           int*                 info,
+                                           hipsolverSyevjInfo_t params,
+                                           int                  batch_count,
+                                           int                  chunk_size)
+try
+{
+    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception2hip_status();
+}
+
 /******************** SYGVD/HEGVD ********************/
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverEigType_t  itype,
@@ -0,0 +1,45 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef HIPSOLVER_STUB_H
+#define HIPSOLVER_STUB_H
+
+/*! \file
+ *  \brief Control of the stub backend, a host-only replacement of rocBLAS and rocSOLVER that is
+ *  selected with USE_STUB_BACKEND. The stub does no computation: each rocBLAS or rocSOLVER
+ *  function records the call, reports a workspace size when the handle is in a device memory
+ *  size query, and returns a chosen status. This allows the wrapper layer of the rocSOLVER
+ *  backend to be tested and benchmarked without a GPU.
+ *
+ *  Functions are named as in rocBLAS and rocSOLVER (e.g. "rocsolver_sgetrf"). A null name
+ *  applies the setting to every function. Functions that are not stubbed are rejected with
+ *  rocblas_status_invalid_value.
+ */
+
+#include "rocblas.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Restores the defaults: no workspace, rocblas_status_success, and no recorded calls
+void hipsolver_stub_reset(void);
+
+// Sets the workspace size, in bytes, reported by a function in device memory size queries
+rocblas_status hipsolver_stub_set_workspace_size(const char* name, size_t size);
+
+// Sets the status returned by a function
+rocblas_status hipsolver_stub_set_status(const char* name, rocblas_status status);
+
+// Returns the number of calls to a function since the last reset, or to all functions
+size_t hipsolver_stub_call_count(const char* name);
+
+// Returns the name of the last function called, or null if there was none since the last reset
+const char* hipsolver_stub_last_call(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSOLVER_STUB_H */
@@ -0,0 +1,370 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipsolver_stub.h"
+#include "internal/rocblas_device_malloc.hpp"
+#include "rocblas.h"
+#include "rocsolver_stub.hpp"
+#include <atomic>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+/******************** STATE ********************/
+struct _rocblas_handle
+{
+    hipStream_t          stream       = 0;
+    rocblas_pointer_mode pointer_mode = rocblas_pointer_mode_host;
+
+    // device memory size query
+    bool   query      = false;
+    size_t query_size = 0;
+
+    // device memory set by the user (or by hipSOLVER on behalf of the user)
+    bool   user_memory = false;
+    size_t memory_size = 0;
+};
+
+struct rocblas_device_malloc_base
+{
+    bool               success = false;
+    void*              block   = nullptr;
+    std::vector<void*> ptrs;
+};
+
+static const char* const stub_names[] = {
+#define HIPSOLVER_STUB_FUNCTION(name, params) #name,
+#include "rocsolver_stub_functions.hpp"
+#undef HIPSOLVER_STUB_FUNCTION
+};
+
+static size_t              stub_sizes[hipsolver_stub_function_count];
+static rocblas_status      stub_statuses[hipsolver_stub_function_count];
+static std::atomic<size_t> stub_calls[hipsolver_stub_function_count];
+static std::atomic<int>    stub_last_call(-1);
+
+// Raises the size reported by a device memory size query. Returns the status of the query.
+static rocblas_status stub_query_size(rocblas_handle handle, size_t size)
+{
+    if(size <= handle->query_size)
+        return rocblas_status_size_unchanged;
+
+    handle->query_size = size;
+    return rocblas_status_size_increased;
+}
+
+static size_t stub_sum_sizes(size_t count, va_list sizes)
+{
+    size_t total = 0;
+    for(size_t i = 0; i < count; i++)
+        total += va_arg(sizes, size_t);
+    return total;
+}
+
+rocblas_status hipsolver_stub_call(rocblas_handle handle, hipsolver_stub_function_id function)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    stub_calls[function].fetch_add(1, std::memory_order_relaxed);
+    stub_last_call.store(function, std::memory_order_relaxed);
+
+    rocblas_status status = stub_statuses[function];
+    if(status != rocblas_status_success)
+        return status;
+
+    if(handle->query)
+        return stub_query_size(handle, stub_sizes[function]);
+    return rocblas_status_success;
+}
+
+/******************** CONTROL ********************/
+// Applies a setting to the named function, or to all of them if name is null
+template <typename F>
+static rocblas_status stub_apply(const char* name, F setting)
+{
+    bool found = false;
+    for(int i = 0; i < hipsolver_stub_function_count; i++)
+    {
+        if(!name || strcmp(name, stub_names[i]) == 0)
+        {
+            setting(i);
+            found = true;
+        }
+    }
+    return found ? rocblas_status_success : rocblas_status_invalid_value;
+}
+
+extern "C" {
+
+void hipsolver_stub_reset(void)
+{
+    for(int i = 0; i < hipsolver_stub_function_count; i++)
+    {
+        stub_sizes[i]    = 0;
+        stub_statuses[i] = rocblas_status_success;
+        stub_calls[i]    = 0;
+    }
+    stub_last_call = -1;
+}
+
+rocblas_status hipsolver_stub_set_workspace_size(const char* name, size_t size)
+{
+    return stub_apply(name, [&](int i) { stub_sizes[i] = size; });
+}
+
+rocblas_status hipsolver_stub_set_status(const char* name, rocblas_status status)
+{
+    return stub_apply(name, [&](int i) { stub_statuses[i] = status; });
+}
+
+size_t hipsolver_stub_call_count(const char* name)
+{
+    size_t count = 0;
+    stub_apply(name, [&](int i) { count += stub_calls[i]; });
+    return count;
+}
+
+const char* hipsolver_stub_last_call(void)
+{
+    int last = stub_last_call;
+    return last < 0 ? nullptr : stub_names[last];
+}
+
+/******************** HANDLE ********************/
+rocblas_status rocblas_create_handle(rocblas_handle* handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    *handle = new(std::nothrow) _rocblas_handle;
+    return *handle ? rocblas_status_success : rocblas_status_memory_error;
+}
+
+rocblas_status rocblas_destroy_handle(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    delete handle;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_stream(rocblas_handle handle, hipStream_t stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->stream = stream;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stream)
+        return rocblas_status_invalid_pointer;
+
+    *stream = handle->stream;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_pointer_mode(rocblas_handle handle, rocblas_pointer_mode pointer_mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->pointer_mode = pointer_mode;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_pointer_mode(rocblas_handle handle, rocblas_pointer_mode* pointer_mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!pointer_mode)
+        return rocblas_status_invalid_pointer;
+
+    *pointer_mode = handle->pointer_mode;
+    return rocblas_status_success;
+}
+
+/******************** DEVICE MEMORY ********************/
+rocblas_status rocblas_start_device_memory_size_query(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->query)
+        return rocblas_status_size_query_mismatch;
+
+    handle->query      = true;
+    handle->query_size = 0;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_stop_device_memory_size_query(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!handle->query)
+        return rocblas_status_size_query_mismatch;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+
+    *size         = handle->query_size;
+    handle->query = false;
+    return rocblas_status_success;
+}
+
+bool rocblas_is_device_memory_size_query(rocblas_handle handle)
+{
+    return handle && handle->query;
+}
+
+rocblas_status rocblas_set_optimal_device_memory_size_impl(rocblas_handle handle, size_t count, ...)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!handle->query)
+        return rocblas_status_size_query_mismatch;
+
+    va_list sizes;
+    va_start(sizes, count);
+    size_t total = stub_sum_sizes(count, sizes);
+    va_end(sizes);
+
+    return stub_query_size(handle, total);
+}
+
+rocblas_status rocblas_get_device_memory_size(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+
+    *size = handle->memory_size;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_device_memory_size(rocblas_handle handle, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->user_memory = (size > 0);
+    handle->memory_size = size;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_workspace(rocblas_handle handle, void* addr, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->user_memory = (addr && size > 0);
+    handle->memory_size = handle->user_memory ? size : 0;
+    return rocblas_status_success;
+}
+
+bool rocblas_is_managing_device_memory(rocblas_handle handle)
+{
+    return handle && !handle->user_memory;
+}
+
+bool rocblas_is_user_managing_device_memory(rocblas_handle handle)
+{
+    return handle && handle->user_memory;
+}
+
+/*
+ * Workspace allocations. The stub never dereferences the workspace, so it is taken from host
+ * memory. During a size query, the requested sizes are reported and the allocation fails, as
+ * in rocBLAS.
+ */
+rocblas_status rocblas_device_malloc_alloc(rocblas_handle               handle,
+                                           rocblas_device_malloc_base** res,
+                                           size_t                       count,
+                                           ...)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!res)
+        return rocblas_status_invalid_pointer;
+
+    std::vector<size_t> sizes(count);
+    va_list             args;
+    va_start(args, count);
+    for(size_t i = 0; i < count; i++)
+        sizes[i] = va_arg(args, size_t);
+    va_end(args);
+
+    size_t total = 0;
+    for(size_t size : sizes)
+        total += size;
+
+    *res = new(std::nothrow) rocblas_device_malloc_base;
+    if(!*res)
+        return rocblas_status_memory_error;
+
+    if(handle->query)
+        return stub_query_size(handle, total);
+    if(handle->user_memory && total > handle->memory_size)
+        return rocblas_status_success;
+
+    (*res)->block = calloc(1, total ? total : 1);
+    if((*res)->block)
+    {
+        char* ptr = static_cast<char*>((*res)->block);
+        for(size_t size : sizes)
+        {
+            (*res)->ptrs.push_back(ptr);
+            ptr += size;
+        }
+        (*res)->success = true;
+    }
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_device_malloc_success(rocblas_device_malloc_base* ptr, bool* res)
+{
+    if(!ptr || !res)
+        return rocblas_status_invalid_pointer;
+
+    *res = ptr->success;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_device_malloc_ptr(rocblas_device_malloc_base* ptr, void** res)
+{
+    if(!ptr || !res)
+        return rocblas_status_invalid_pointer;
+
+    *res = ptr->block;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_device_malloc_get(rocblas_device_malloc_base* ptr, size_t index, void** res)
+{
+    if(!ptr || !res || index >= ptr->ptrs.size())
+        return rocblas_status_invalid_pointer;
+
+    *res = ptr->ptrs[index];
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_device_malloc_free(rocblas_device_malloc_base* ptr)
+{
+    if(!ptr)
+        return rocblas_status_invalid_pointer;
+
+    free(ptr->block);
+    delete ptr;
+    return rocblas_status_success;
+}
+
+} // extern "C"
@@ -0,0 +1,24 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+/*! \file
+ *  \brief Internal declarations of the stub backend, shared by the translation unit that
+ *  implements the rocBLAS handle and the one that defines the stubbed compute functions.
+ */
+
+#include "rocblas.h"
+
+// Identifiers of the stubbed compute functions
+enum hipsolver_stub_function_id
+{
+#define HIPSOLVER_STUB_FUNCTION(name, params) hipsolver_stub_##name,
+#include "rocsolver_stub_functions.hpp"
+#undef HIPSOLVER_STUB_FUNCTION
+    hipsolver_stub_function_count
+};
+
+// Records a call to a stubbed function and returns its status
+rocblas_status hipsolver_stub_call(rocblas_handle handle, hipsolver_stub_function_id function);
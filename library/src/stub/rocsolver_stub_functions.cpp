@@ -0,0 +1,21 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas.h"
+#include "rocsolver.h"
+#include "rocsolver_stub.hpp"
+
+/*
+ * The stubbed functions are defined with the parameter lists of rocblas.h and rocsolver.h, so
+ * they are called through their real prototypes. As the definitions are extern "C", any
+ * difference with the declarations in those headers is a compilation error.
+ */
+
+#define HIPSOLVER_STUB_FUNCTION(name, params)                      \
+    extern "C" rocblas_status name params                          \
+    {                                                              \
+        return hipsolver_stub_call(handle, hipsolver_stub_##name); \
+    }
+#include "rocsolver_stub_functions.hpp"
+#undef HIPSOLVER_STUB_FUNCTION
@@ -0,0 +1,651 @@
+/* ************************************************************************
+ * Copyright 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief List of the rocBLAS and rocSOLVER functions called by hcc_detail, which the stub
+ *  backend replaces. This file is included once for each use, with
+ *  HIPSOLVER_STUB_FUNCTION(name, params) defined to expand each entry. params is the parameter
+ *  list of the function, as declared in rocblas.h and rocsolver.h, written with the
+ *  HIPSOLVER_STUB_SIG_* macro of its family. The handle is always named handle.
+ */
+
+// clang-format off
+#define HIPSOLVER_STUB_SIG_AMIN(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, rocblas_int* result)
+#define HIPSOLVER_STUB_SIG_AMIN_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, rocblas_stride stridex, \
+     rocblas_int batch_count, rocblas_int* result)
+#define HIPSOLVER_STUB_SIG_ASUM_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, rocblas_stride stridex, \
+     rocblas_int batch_count, R* result)
+#define HIPSOLVER_STUB_SIG_AXPY(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* alpha, const T* x, rocblas_int incx, T* y, \
+     rocblas_int incy)
+#define HIPSOLVER_STUB_SIG_COPY(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, T* y, rocblas_int incy)
+#define HIPSOLVER_STUB_SIG_COPY_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* const x[], rocblas_int incx, T* const y[], \
+     rocblas_int incy, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_COPY_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, rocblas_stride stridex, \
+     T* y, rocblas_int incy, rocblas_stride stridey, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_DOT(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* x, rocblas_int incx, const T* y, \
+     rocblas_int incy, T* result)
+#define HIPSOLVER_STUB_SIG_SCAL(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* alpha, T* x, rocblas_int incx)
+#define HIPSOLVER_STUB_SIG_SCAL_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int n, const T* alpha, T* x, rocblas_int incx, \
+     rocblas_stride stridex, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_ROT(T, R) \
+    (rocblas_handle handle, rocblas_int n, T* x, rocblas_int incx, T* y, rocblas_int incy, \
+     const R* c, const T* s)
+#define HIPSOLVER_STUB_SIG_ROTG_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, T* a, rocblas_stride stride_a, T* b, rocblas_stride stride_b, R* c, \
+     rocblas_stride stride_c, T* s, rocblas_stride stride_s, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GEAM(T, R) \
+    (rocblas_handle handle, rocblas_operation transA, rocblas_operation transB, rocblas_int m, \
+     rocblas_int n, const T* alpha, const T* A, rocblas_int lda, const T* beta, const T* B, \
+     rocblas_int ldb, T* C, rocblas_int ldc)
+#define HIPSOLVER_STUB_SIG_GEAM_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_operation transA, rocblas_operation transB, rocblas_int m, \
+     rocblas_int n, const T* alpha, const T* const A[], rocblas_int lda, const T* beta, \
+     const T* const B[], rocblas_int ldb, T* const C[], rocblas_int ldc, \
+     rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GEAM_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_operation transA, rocblas_operation transB, rocblas_int m, \
+     rocblas_int n, const T* alpha, const T* A, rocblas_int lda, rocblas_stride stride_A, \
+     const T* beta, const T* B, rocblas_int ldb, rocblas_stride stride_B, T* C, rocblas_int ldc, \
+     rocblas_stride stride_C, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GEMM_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_operation transA, rocblas_operation transB, rocblas_int m, \
+     rocblas_int n, rocblas_int k, const T* alpha, const T* A, rocblas_int lda, \
+     rocblas_stride stride_a, const T* B, rocblas_int ldb, rocblas_stride stride_b, \
+     const T* beta, T* C, rocblas_int ldc, rocblas_stride stride_c, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_DGMM_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_side side, rocblas_int m, rocblas_int n, const T* A, \
+     rocblas_int lda, rocblas_stride stride_A, const T* x, rocblas_int incx, \
+     rocblas_stride stride_x, T* C, rocblas_int ldc, rocblas_stride stride_C, \
+     rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_HERK_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_operation transA, rocblas_int n, \
+     rocblas_int k, const R* alpha, const T* A, rocblas_int lda, rocblas_stride stride_A, \
+     const R* beta, T* C, rocblas_int ldc, rocblas_stride stride_C, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_HPMV(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, const T* alpha, const T* AP, \
+     const T* x, rocblas_int incx, const T* beta, T* y, rocblas_int incy)
+#define HIPSOLVER_STUB_SIG_HPR2(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, const T* alpha, const T* x, \
+     rocblas_int incx, const T* y, rocblas_int incy, T* AP)
+#define HIPSOLVER_STUB_SIG_HPR_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, const R* alpha, const T* x, \
+     rocblas_int incx, rocblas_stride stride_x, T* AP, rocblas_stride stride_A, \
+     rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_TBSV_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag, \
+     rocblas_int n, rocblas_int k, const T* A, rocblas_int lda, rocblas_stride stride_A, T* x, \
+     rocblas_int incx, rocblas_stride stride_x, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_TPSV_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag, \
+     rocblas_int n, const T* AP, rocblas_stride stride_A, T* x, rocblas_int incx, \
+     rocblas_stride stride_x, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_TRSM(T, R) \
+    (rocblas_handle handle, rocblas_side side, rocblas_fill uplo, rocblas_operation transA, \
+     rocblas_diagonal diag, rocblas_int m, rocblas_int n, const T* alpha, const T* A, \
+     rocblas_int lda, T* B, rocblas_int ldb)
+#define HIPSOLVER_STUB_SIG_TRSM_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_side side, rocblas_fill uplo, rocblas_operation transA, \
+     rocblas_diagonal diag, rocblas_int m, rocblas_int n, const T* alpha, const T* A, \
+     rocblas_int lda, rocblas_stride stride_a, T* B, rocblas_int ldb, rocblas_stride stride_b, \
+     rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_TRSV(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag, \
+     rocblas_int m, const T* A, rocblas_int lda, T* x, rocblas_int incx)
+#define HIPSOLVER_STUB_SIG_GEBRD(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, R* D, R* E, \
+     T* tauq, T* taup)
+#define HIPSOLVER_STUB_SIG_GELS(T, R) \
+    (rocblas_handle handle, rocblas_operation trans, rocblas_int m, rocblas_int n, \
+     rocblas_int nrhs, T* A, rocblas_int lda, T* B, rocblas_int ldb, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_GELS_OUTOFPLACE(T, R) \
+    (rocblas_handle handle, rocblas_operation trans, rocblas_int m, rocblas_int n, \
+     rocblas_int nrhs, T* A, rocblas_int lda, T* B, rocblas_int ldb, T* X, rocblas_int ldx, \
+     rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_GEQRF(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv)
+#define HIPSOLVER_STUB_SIG_GEQRF_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* const A[], rocblas_int lda, \
+     T* ipiv, rocblas_stride strideP, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GEQRF_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, \
+     rocblas_stride strideA, T* ipiv, rocblas_stride strideP, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GESV(T, R) \
+    (rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T* A, rocblas_int lda, \
+     rocblas_int* ipiv, T* B, rocblas_int ldb, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_GESV_OUTOFPLACE(T, R) \
+    (rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T* A, rocblas_int lda, \
+     rocblas_int* ipiv, T* B, rocblas_int ldb, T* X, rocblas_int ldx, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_GESVD(T, R) \
+    (rocblas_handle handle, rocblas_svect left_svect, rocblas_svect right_svect, rocblas_int m, \
+     rocblas_int n, T* A, rocblas_int lda, R* S, T* U, rocblas_int ldu, T* V, rocblas_int ldv, \
+     R* E, rocblas_workmode fast_alg, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_GESVD_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_svect left_svect, rocblas_svect right_svect, rocblas_int m, \
+     rocblas_int n, T* A, rocblas_int lda, rocblas_stride strideA, R* S, rocblas_stride strideS, \
+     T* U, rocblas_int ldu, rocblas_stride strideU, T* V, rocblas_int ldv, \
+     rocblas_stride strideV, R* E, rocblas_stride strideE, rocblas_workmode fast_alg, \
+     rocblas_int* info, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GETRF(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, \
+     rocblas_int* ipiv, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_GETRF_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* const A[], rocblas_int lda, \
+     rocblas_int* ipiv, rocblas_stride strideP, rocblas_int* info, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GETRF_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, \
+     rocblas_stride strideA, rocblas_int* ipiv, rocblas_stride strideP, rocblas_int* info, \
+     rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GETRF_NPVT(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, \
+     rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_GETRF_NPVT_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, T* const A[], rocblas_int lda, \
+     rocblas_int* info, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_GETRS(T, R) \
+    (rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, T* A, \
+     rocblas_int lda, const rocblas_int* ipiv, T* B, rocblas_int ldb)
+#define HIPSOLVER_STUB_SIG_GETRS_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, T* A, \
+     rocblas_int lda, rocblas_stride strideA, const rocblas_int* ipiv, rocblas_stride strideP, \
+     T* B, rocblas_int ldb, rocblas_stride strideB, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_HEEV(T, R) \
+    (rocblas_handle handle, rocblas_evect evect, rocblas_fill uplo, rocblas_int n, T* A, \
+     rocblas_int lda, R* D, R* E, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_evect evect, rocblas_fill uplo, rocblas_int n, T* A, \
+     rocblas_int lda, rocblas_stride strideA, R* D, rocblas_stride strideD, R* E, \
+     rocblas_stride strideE, rocblas_int* info, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_HEGVD(T, R) \
+    (rocblas_handle handle, rocblas_eform itype, rocblas_evect evect, rocblas_fill uplo, \
+     rocblas_int n, T* A, rocblas_int lda, T* B, rocblas_int ldb, R* D, R* E, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_HETRD(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, R* D, R* E, \
+     T* tau)
+#define HIPSOLVER_STUB_SIG_LACGV(T, R) \
+    (rocblas_handle handle, rocblas_int n, T* x, rocblas_int incx)
+#define HIPSOLVER_STUB_SIG_LARF(T, R) \
+    (rocblas_handle handle, rocblas_side side, rocblas_int m, rocblas_int n, T* x, \
+     rocblas_int incx, const T* alpha, T* A, rocblas_int lda)
+#define HIPSOLVER_STUB_SIG_LARFG(T, R) \
+    (rocblas_handle handle, rocblas_int n, T* alpha, T* x, rocblas_int incx, T* tau)
+#define HIPSOLVER_STUB_SIG_ORGBR(T, R) \
+    (rocblas_handle handle, rocblas_storev storev, rocblas_int m, rocblas_int n, rocblas_int k, \
+     T* A, rocblas_int lda, T* ipiv)
+#define HIPSOLVER_STUB_SIG_ORGQR(T, R) \
+    (rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k, T* A, rocblas_int lda, \
+     T* ipiv)
+#define HIPSOLVER_STUB_SIG_ORGTR(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, T* ipiv)
+#define HIPSOLVER_STUB_SIG_ORMQR(T, R) \
+    (rocblas_handle handle, rocblas_side side, rocblas_operation trans, rocblas_int m, \
+     rocblas_int n, rocblas_int k, T* A, rocblas_int lda, T* ipiv, T* C, rocblas_int ldc)
+#define HIPSOLVER_STUB_SIG_ORMTR(T, R) \
+    (rocblas_handle handle, rocblas_side side, rocblas_fill uplo, rocblas_operation trans, \
+     rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* C, rocblas_int ldc)
+#define HIPSOLVER_STUB_SIG_POTRF(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, \
+     rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_POTRF_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T* const A[], rocblas_int lda, \
+     rocblas_int* info, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_POTRF_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, \
+     rocblas_stride strideA, rocblas_int* info, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_POTRS(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T* A, \
+     rocblas_int lda, T* B, rocblas_int ldb)
+#define HIPSOLVER_STUB_SIG_POTRS_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T* const A[], \
+     rocblas_int lda, T* const B[], rocblas_int ldb, rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_POTRS_STRIDED_BATCHED(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T* A, \
+     rocblas_int lda, rocblas_stride strideA, T* B, rocblas_int ldb, rocblas_stride strideB, \
+     rocblas_int batch_count)
+#define HIPSOLVER_STUB_SIG_STERF(T, R) \
+    (rocblas_handle handle, rocblas_int n, R* D, R* E, rocblas_int* info)
+#define HIPSOLVER_STUB_SIG_SYTRF(T, R) \
+    (rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, \
+     rocblas_int* ipiv, rocblas_int* info)
+
+HIPSOLVER_STUB_FUNCTION(rocblas_caxpy, HIPSOLVER_STUB_SIG_AXPY(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ccopy, HIPSOLVER_STUB_SIG_COPY(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ccopy_batched,
+                        HIPSOLVER_STUB_SIG_COPY_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ccopy_strided_batched,
+                        HIPSOLVER_STUB_SIG_COPY_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cdgmm_strided_batched,
+                        HIPSOLVER_STUB_SIG_DGMM_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cdotc, HIPSOLVER_STUB_SIG_DOT(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cgeam, HIPSOLVER_STUB_SIG_GEAM(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cgeam_batched,
+                        HIPSOLVER_STUB_SIG_GEAM_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cgeam_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEAM_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cgemm_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEMM_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cherk_strided_batched,
+                        HIPSOLVER_STUB_SIG_HERK_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_chpmv, HIPSOLVER_STUB_SIG_HPMV(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_chpr2, HIPSOLVER_STUB_SIG_HPR2(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_chpr_strided_batched,
+                        HIPSOLVER_STUB_SIG_HPR_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_crot, HIPSOLVER_STUB_SIG_ROT(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_crotg_strided_batched,
+                        HIPSOLVER_STUB_SIG_ROTG_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cscal, HIPSOLVER_STUB_SIG_SCAL(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_cscal_strided_batched,
+                        HIPSOLVER_STUB_SIG_SCAL_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ctbsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TBSV_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ctpsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TPSV_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ctrsm, HIPSOLVER_STUB_SIG_TRSM(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ctrsm_strided_batched,
+                        HIPSOLVER_STUB_SIG_TRSM_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ctrsv, HIPSOLVER_STUB_SIG_TRSV(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_dasum_strided_batched,
+                        HIPSOLVER_STUB_SIG_ASUM_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_daxpy, HIPSOLVER_STUB_SIG_AXPY(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dcopy, HIPSOLVER_STUB_SIG_COPY(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dcopy_batched, HIPSOLVER_STUB_SIG_COPY_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dcopy_strided_batched,
+                        HIPSOLVER_STUB_SIG_COPY_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_ddgmm_strided_batched,
+                        HIPSOLVER_STUB_SIG_DGMM_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_ddot, HIPSOLVER_STUB_SIG_DOT(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dgeam, HIPSOLVER_STUB_SIG_GEAM(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dgeam_batched, HIPSOLVER_STUB_SIG_GEAM_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dgeam_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEAM_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dgemm_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEMM_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_drot, HIPSOLVER_STUB_SIG_ROT(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_drotg_strided_batched,
+                        HIPSOLVER_STUB_SIG_ROTG_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dscal, HIPSOLVER_STUB_SIG_SCAL(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dscal_strided_batched,
+                        HIPSOLVER_STUB_SIG_SCAL_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dspmv, HIPSOLVER_STUB_SIG_HPMV(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dspr2, HIPSOLVER_STUB_SIG_HPR2(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dspr_strided_batched,
+                        HIPSOLVER_STUB_SIG_HPR_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dsyrk_strided_batched,
+                        HIPSOLVER_STUB_SIG_HERK_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dtbsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TBSV_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dtpsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TPSV_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dtrsm, HIPSOLVER_STUB_SIG_TRSM(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dtrsm_strided_batched,
+                        HIPSOLVER_STUB_SIG_TRSM_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_dtrsv, HIPSOLVER_STUB_SIG_TRSV(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_icamin, HIPSOLVER_STUB_SIG_AMIN(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_icamin_strided_batched,
+                        HIPSOLVER_STUB_SIG_AMIN_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_idamin, HIPSOLVER_STUB_SIG_AMIN(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_idamin_strided_batched,
+                        HIPSOLVER_STUB_SIG_AMIN_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_isamin, HIPSOLVER_STUB_SIG_AMIN(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_isamin_strided_batched,
+                        HIPSOLVER_STUB_SIG_AMIN_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_izamin, HIPSOLVER_STUB_SIG_AMIN(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_izamin_strided_batched,
+                        HIPSOLVER_STUB_SIG_AMIN_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_sasum_strided_batched,
+                        HIPSOLVER_STUB_SIG_ASUM_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_saxpy, HIPSOLVER_STUB_SIG_AXPY(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_scopy, HIPSOLVER_STUB_SIG_COPY(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_scopy_batched, HIPSOLVER_STUB_SIG_COPY_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_scopy_strided_batched,
+                        HIPSOLVER_STUB_SIG_COPY_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sdgmm_strided_batched,
+                        HIPSOLVER_STUB_SIG_DGMM_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sdot, HIPSOLVER_STUB_SIG_DOT(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sgeam, HIPSOLVER_STUB_SIG_GEAM(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sgeam_batched, HIPSOLVER_STUB_SIG_GEAM_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sgeam_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEAM_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sgemm_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEMM_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_srot, HIPSOLVER_STUB_SIG_ROT(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_srotg_strided_batched,
+                        HIPSOLVER_STUB_SIG_ROTG_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sscal, HIPSOLVER_STUB_SIG_SCAL(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sscal_strided_batched,
+                        HIPSOLVER_STUB_SIG_SCAL_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sspmv, HIPSOLVER_STUB_SIG_HPMV(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sspr2, HIPSOLVER_STUB_SIG_HPR2(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_sspr_strided_batched,
+                        HIPSOLVER_STUB_SIG_HPR_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_ssyrk_strided_batched,
+                        HIPSOLVER_STUB_SIG_HERK_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_stbsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TBSV_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_stpsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TPSV_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_strsm, HIPSOLVER_STUB_SIG_TRSM(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_strsm_strided_batched,
+                        HIPSOLVER_STUB_SIG_TRSM_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_strsv, HIPSOLVER_STUB_SIG_TRSV(float, float))
+HIPSOLVER_STUB_FUNCTION(rocblas_zaxpy, HIPSOLVER_STUB_SIG_AXPY(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zcopy, HIPSOLVER_STUB_SIG_COPY(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zcopy_batched,
+                        HIPSOLVER_STUB_SIG_COPY_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zcopy_strided_batched,
+                        HIPSOLVER_STUB_SIG_COPY_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zdgmm_strided_batched,
+                        HIPSOLVER_STUB_SIG_DGMM_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zdotc, HIPSOLVER_STUB_SIG_DOT(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zgeam, HIPSOLVER_STUB_SIG_GEAM(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zgeam_batched,
+                        HIPSOLVER_STUB_SIG_GEAM_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zgeam_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEAM_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zgemm_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEMM_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zherk_strided_batched,
+                        HIPSOLVER_STUB_SIG_HERK_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zhpmv, HIPSOLVER_STUB_SIG_HPMV(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zhpr2, HIPSOLVER_STUB_SIG_HPR2(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zhpr_strided_batched,
+                        HIPSOLVER_STUB_SIG_HPR_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zrot, HIPSOLVER_STUB_SIG_ROT(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zrotg_strided_batched,
+                        HIPSOLVER_STUB_SIG_ROTG_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zscal, HIPSOLVER_STUB_SIG_SCAL(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_zscal_strided_batched,
+                        HIPSOLVER_STUB_SIG_SCAL_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_ztbsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TBSV_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_ztpsv_strided_batched,
+                        HIPSOLVER_STUB_SIG_TPSV_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_ztrsm, HIPSOLVER_STUB_SIG_TRSM(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_ztrsm_strided_batched,
+                        HIPSOLVER_STUB_SIG_TRSM_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocblas_ztrsv, HIPSOLVER_STUB_SIG_TRSV(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgebrd, HIPSOLVER_STUB_SIG_GEBRD(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgels, HIPSOLVER_STUB_SIG_GELS(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgels_outofplace,
+                        HIPSOLVER_STUB_SIG_GELS_OUTOFPLACE(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgeqrf, HIPSOLVER_STUB_SIG_GEQRF(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgeqrf_batched,
+                        HIPSOLVER_STUB_SIG_GEQRF_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgeqrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEQRF_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgesv, HIPSOLVER_STUB_SIG_GESV(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgesv_outofplace,
+                        HIPSOLVER_STUB_SIG_GESV_OUTOFPLACE(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgesvd, HIPSOLVER_STUB_SIG_GESVD(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgesvd_strided_batched,
+                        HIPSOLVER_STUB_SIG_GESVD_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgetrf, HIPSOLVER_STUB_SIG_GETRF(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgetrf_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgetrf_npvt,
+                        HIPSOLVER_STUB_SIG_GETRF_NPVT(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgetrf_npvt_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_NPVT_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgetrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgetrs, HIPSOLVER_STUB_SIG_GETRS(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cgetrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRS_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cheev, HIPSOLVER_STUB_SIG_HEEV(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cheev_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cheevd, HIPSOLVER_STUB_SIG_HEEV(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cheevd_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_chegvd, HIPSOLVER_STUB_SIG_HEGVD(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_chetrd, HIPSOLVER_STUB_SIG_HETRD(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_clacgv, HIPSOLVER_STUB_SIG_LACGV(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_clarf, HIPSOLVER_STUB_SIG_LARF(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_clarfg, HIPSOLVER_STUB_SIG_LARFG(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cpotrf, HIPSOLVER_STUB_SIG_POTRF(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cpotrf_batched,
+                        HIPSOLVER_STUB_SIG_POTRF_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cpotrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRF_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cpotri, HIPSOLVER_STUB_SIG_POTRF(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cpotrs, HIPSOLVER_STUB_SIG_POTRS(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cpotrs_batched,
+                        HIPSOLVER_STUB_SIG_POTRS_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cpotrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRS_STRIDED_BATCHED(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_csytrf, HIPSOLVER_STUB_SIG_SYTRF(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cungbr, HIPSOLVER_STUB_SIG_ORGBR(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cungqr, HIPSOLVER_STUB_SIG_ORGQR(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cungtr, HIPSOLVER_STUB_SIG_ORGTR(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cunmqr, HIPSOLVER_STUB_SIG_ORMQR(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_cunmtr, HIPSOLVER_STUB_SIG_ORMTR(rocblas_float_complex, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgebrd, HIPSOLVER_STUB_SIG_GEBRD(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgels, HIPSOLVER_STUB_SIG_GELS(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgels_outofplace,
+                        HIPSOLVER_STUB_SIG_GELS_OUTOFPLACE(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgeqrf, HIPSOLVER_STUB_SIG_GEQRF(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgeqrf_batched, HIPSOLVER_STUB_SIG_GEQRF_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgeqrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEQRF_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgesv, HIPSOLVER_STUB_SIG_GESV(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgesv_outofplace,
+                        HIPSOLVER_STUB_SIG_GESV_OUTOFPLACE(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgesvd, HIPSOLVER_STUB_SIG_GESVD(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgesvd_strided_batched,
+                        HIPSOLVER_STUB_SIG_GESVD_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgetrf, HIPSOLVER_STUB_SIG_GETRF(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgetrf_batched, HIPSOLVER_STUB_SIG_GETRF_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgetrf_npvt, HIPSOLVER_STUB_SIG_GETRF_NPVT(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgetrf_npvt_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_NPVT_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgetrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgetrs, HIPSOLVER_STUB_SIG_GETRS(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dgetrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRS_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dlarf, HIPSOLVER_STUB_SIG_LARF(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dlarfg, HIPSOLVER_STUB_SIG_LARFG(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dorgbr, HIPSOLVER_STUB_SIG_ORGBR(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dorgqr, HIPSOLVER_STUB_SIG_ORGQR(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dorgtr, HIPSOLVER_STUB_SIG_ORGTR(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dormqr, HIPSOLVER_STUB_SIG_ORMQR(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dormtr, HIPSOLVER_STUB_SIG_ORMTR(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dpotrf, HIPSOLVER_STUB_SIG_POTRF(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dpotrf_batched, HIPSOLVER_STUB_SIG_POTRF_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dpotrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRF_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dpotri, HIPSOLVER_STUB_SIG_POTRF(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dpotrs, HIPSOLVER_STUB_SIG_POTRS(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dpotrs_batched, HIPSOLVER_STUB_SIG_POTRS_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dpotrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRS_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsterf, HIPSOLVER_STUB_SIG_STERF(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsyev, HIPSOLVER_STUB_SIG_HEEV(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsyev_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsyevd, HIPSOLVER_STUB_SIG_HEEV(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsyevd_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsygvd, HIPSOLVER_STUB_SIG_HEGVD(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsytrd, HIPSOLVER_STUB_SIG_HETRD(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_dsytrf, HIPSOLVER_STUB_SIG_SYTRF(double, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgebrd, HIPSOLVER_STUB_SIG_GEBRD(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgels, HIPSOLVER_STUB_SIG_GELS(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgels_outofplace,
+                        HIPSOLVER_STUB_SIG_GELS_OUTOFPLACE(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgeqrf, HIPSOLVER_STUB_SIG_GEQRF(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgeqrf_batched, HIPSOLVER_STUB_SIG_GEQRF_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgeqrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEQRF_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgesv, HIPSOLVER_STUB_SIG_GESV(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgesv_outofplace,
+                        HIPSOLVER_STUB_SIG_GESV_OUTOFPLACE(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgesvd, HIPSOLVER_STUB_SIG_GESVD(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgesvd_strided_batched,
+                        HIPSOLVER_STUB_SIG_GESVD_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgetrf, HIPSOLVER_STUB_SIG_GETRF(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgetrf_batched, HIPSOLVER_STUB_SIG_GETRF_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgetrf_npvt, HIPSOLVER_STUB_SIG_GETRF_NPVT(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgetrf_npvt_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_NPVT_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgetrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgetrs, HIPSOLVER_STUB_SIG_GETRS(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sgetrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRS_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_slarf, HIPSOLVER_STUB_SIG_LARF(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_slarfg, HIPSOLVER_STUB_SIG_LARFG(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sorgbr, HIPSOLVER_STUB_SIG_ORGBR(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sorgqr, HIPSOLVER_STUB_SIG_ORGQR(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sorgtr, HIPSOLVER_STUB_SIG_ORGTR(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sormqr, HIPSOLVER_STUB_SIG_ORMQR(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_sormtr, HIPSOLVER_STUB_SIG_ORMTR(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_spotrf, HIPSOLVER_STUB_SIG_POTRF(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_spotrf_batched, HIPSOLVER_STUB_SIG_POTRF_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_spotrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRF_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_spotri, HIPSOLVER_STUB_SIG_POTRF(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_spotrs, HIPSOLVER_STUB_SIG_POTRS(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_spotrs_batched, HIPSOLVER_STUB_SIG_POTRS_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_spotrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRS_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssterf, HIPSOLVER_STUB_SIG_STERF(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssyev, HIPSOLVER_STUB_SIG_HEEV(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssyev_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssyevd, HIPSOLVER_STUB_SIG_HEEV(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssyevd_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssygvd, HIPSOLVER_STUB_SIG_HEGVD(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssytrd, HIPSOLVER_STUB_SIG_HETRD(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_ssytrf, HIPSOLVER_STUB_SIG_SYTRF(float, float))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgebrd, HIPSOLVER_STUB_SIG_GEBRD(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgels, HIPSOLVER_STUB_SIG_GELS(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgels_outofplace,
+                        HIPSOLVER_STUB_SIG_GELS_OUTOFPLACE(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgeqrf, HIPSOLVER_STUB_SIG_GEQRF(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgeqrf_batched,
+                        HIPSOLVER_STUB_SIG_GEQRF_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgeqrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GEQRF_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgesv, HIPSOLVER_STUB_SIG_GESV(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgesv_outofplace,
+                        HIPSOLVER_STUB_SIG_GESV_OUTOFPLACE(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgesvd, HIPSOLVER_STUB_SIG_GESVD(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgesvd_strided_batched,
+                        HIPSOLVER_STUB_SIG_GESVD_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgetrf, HIPSOLVER_STUB_SIG_GETRF(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgetrf_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgetrf_npvt,
+                        HIPSOLVER_STUB_SIG_GETRF_NPVT(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgetrf_npvt_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_NPVT_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgetrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRF_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgetrs, HIPSOLVER_STUB_SIG_GETRS(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zgetrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_GETRS_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zheev, HIPSOLVER_STUB_SIG_HEEV(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zheev_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zheevd, HIPSOLVER_STUB_SIG_HEEV(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zheevd_strided_batched,
+                        HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zhegvd, HIPSOLVER_STUB_SIG_HEGVD(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zhetrd, HIPSOLVER_STUB_SIG_HETRD(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zlacgv, HIPSOLVER_STUB_SIG_LACGV(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zlarf, HIPSOLVER_STUB_SIG_LARF(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zlarfg, HIPSOLVER_STUB_SIG_LARFG(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zpotrf, HIPSOLVER_STUB_SIG_POTRF(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zpotrf_batched,
+                        HIPSOLVER_STUB_SIG_POTRF_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zpotrf_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRF_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zpotri, HIPSOLVER_STUB_SIG_POTRF(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zpotrs, HIPSOLVER_STUB_SIG_POTRS(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zpotrs_batched,
+                        HIPSOLVER_STUB_SIG_POTRS_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zpotrs_strided_batched,
+                        HIPSOLVER_STUB_SIG_POTRS_STRIDED_BATCHED(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zsytrf, HIPSOLVER_STUB_SIG_SYTRF(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zungbr, HIPSOLVER_STUB_SIG_ORGBR(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zungqr, HIPSOLVER_STUB_SIG_ORGQR(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zungtr, HIPSOLVER_STUB_SIG_ORGTR(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zunmqr, HIPSOLVER_STUB_SIG_ORMQR(rocblas_double_complex, double))
+HIPSOLVER_STUB_FUNCTION(rocsolver_zunmtr, HIPSOLVER_STUB_SIG_ORMTR(rocblas_double_complex, double))
+
+#undef HIPSOLVER_STUB_SIG_AMIN
+#undef HIPSOLVER_STUB_SIG_AMIN_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_ASUM_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_AXPY
+#undef HIPSOLVER_STUB_SIG_COPY
+#undef HIPSOLVER_STUB_SIG_COPY_BATCHED
+#undef HIPSOLVER_STUB_SIG_COPY_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_DOT
+#undef HIPSOLVER_STUB_SIG_SCAL
+#undef HIPSOLVER_STUB_SIG_SCAL_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_ROT
+#undef HIPSOLVER_STUB_SIG_ROTG_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_GEAM
+#undef HIPSOLVER_STUB_SIG_GEAM_BATCHED
+#undef HIPSOLVER_STUB_SIG_GEAM_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_GEMM_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_DGMM_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_HERK_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_HPMV
+#undef HIPSOLVER_STUB_SIG_HPR2
+#undef HIPSOLVER_STUB_SIG_HPR_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_TBSV_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_TPSV_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_TRSM
+#undef HIPSOLVER_STUB_SIG_TRSM_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_TRSV
+#undef HIPSOLVER_STUB_SIG_GEBRD
+#undef HIPSOLVER_STUB_SIG_GELS
+#undef HIPSOLVER_STUB_SIG_GELS_OUTOFPLACE
+#undef HIPSOLVER_STUB_SIG_GEQRF
+#undef HIPSOLVER_STUB_SIG_GEQRF_BATCHED
+#undef HIPSOLVER_STUB_SIG_GEQRF_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_GESV
+#undef HIPSOLVER_STUB_SIG_GESV_OUTOFPLACE
+#undef HIPSOLVER_STUB_SIG_GESVD
+#undef HIPSOLVER_STUB_SIG_GESVD_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_GETRF
+#undef HIPSOLVER_STUB_SIG_GETRF_BATCHED
+#undef HIPSOLVER_STUB_SIG_GETRF_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_GETRF_NPVT
+#undef HIPSOLVER_STUB_SIG_GETRF_NPVT_BATCHED
+#undef HIPSOLVER_STUB_SIG_GETRS
+#undef HIPSOLVER_STUB_SIG_GETRS_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_HEEV
+#undef HIPSOLVER_STUB_SIG_HEEV_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_HEGVD
+#undef HIPSOLVER_STUB_SIG_HETRD
+#undef HIPSOLVER_STUB_SIG_LACGV
+#undef HIPSOLVER_STUB_SIG_LARF
+#undef HIPSOLVER_STUB_SIG_LARFG
+#undef HIPSOLVER_STUB_SIG_ORGBR
+#undef HIPSOLVER_STUB_SIG_ORGQR
+#undef HIPSOLVER_STUB_SIG_ORGTR
+#undef HIPSOLVER_STUB_SIG_ORMQR
+#undef HIPSOLVER_STUB_SIG_ORMTR
+#undef HIPSOLVER_STUB_SIG_POTRF
+#undef HIPSOLVER_STUB_SIG_POTRF_BATCHED
+#undef HIPSOLVER_STUB_SIG_POTRF_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_POTRS
+#undef HIPSOLVER_STUB_SIG_POTRS_BATCHED
+#undef HIPSOLVER_STUB_SIG_POTRS_STRIDED_BATCHED
+#undef HIPSOLVER_STUB_SIG_STERF
+#undef HIPSOLVER_STUB_SIG_SYTRF
+// clang-format on